@@ -93,6 +93,13 @@
 #ifdef HAVE_LIBLZMA
 #include <lzma.h>
 #endif
+#ifdef HAVE_LIBLZ4
+#include <lz4.h>
+#include <lz4frame.h>
+#endif
+#ifdef HAVE_LIBZSTD
+#include <zstd.h>
+#endif
 
 #ifdef HAVE_ICONV
 #ifdef HAVE_ICONV_H
@@ -1601,34 +1608,675 @@ open_xzstream(const char *filename, const char *flags)
 		free(xz);
 		return NULL;
 	}
-	s->read = stream_xzread;
-	s->write = stream_xzwrite;
-	s->close = stream_xzclose;
-	s->flush = stream_xzflush;
-	s->stream_data.p = (void *) xz;
+	s->read = stream_xzread;
+	s->write = stream_xzwrite;
+	s->close = stream_xzclose;
+	s->flush = stream_xzflush;
+	s->stream_data.p = (void *) xz;
+	if (flags[0] == 'r' && flags[1] != 'b') {
+		char buf[UTF8BOMLENGTH];
+		if (stream_xzread(s, buf, 1, UTF8BOMLENGTH) == UTF8BOMLENGTH &&
+		    strncmp(buf, UTF8BOM, UTF8BOMLENGTH) == 0) {
+			s->isutf8 = 1;
+		} else {
+			rewind(xz->fp);
+		}
+	}
+	return s;
+}
+
+static stream *
+open_xzrstream(const char *filename)
+{
+	stream *s;
+
+	if ((s = open_xzstream(filename, "rb")) == NULL)
+		return NULL;
+	s->type = ST_BIN;
+	if (s->errnr == MNSTR_NO__ERROR &&
+	    stream_xzread(s, (void *) &s->byteorder, sizeof(s->byteorder), 1) < 1) {
+		stream_xzclose(s);
+		destroy(s);
+		return NULL;
+	}
+	return s;
+}
+
+static stream *
+open_xzwstream(const char *filename, const char *mode)
+{
+	stream *s;
+
+	if ((s = open_xzstream(filename, mode)) == NULL)
+		return NULL;
+	s->access = ST_WRITE;
+	s->type = ST_BIN;
+	if (s->errnr == MNSTR_NO__ERROR &&
+	    stream_xzwrite(s, (void *) &s->byteorder, sizeof(s->byteorder), 1) < 1) {
+		stream_xzclose(s);
+		destroy(s);
+		return NULL;
+	}
+	return s;
+}
+
+static stream *
+open_xzrastream(const char *filename)
+{
+	stream *s;
+
+	if ((s = open_xzstream(filename, "rb")) == NULL)
+		return NULL;
+	s->type = ST_ASCII;
+	return s;
+}
+
+static stream *
+open_xzwastream(const char *filename, const char *mode)
+{
+	stream *s;
+
+	if ((s = open_xzstream(filename, mode)) == NULL)
+		return NULL;
+	s->access = ST_WRITE;
+	s->type = ST_ASCII;
+	return s;
+}
+#else
+#define open_xzrstream(filename)	NULL
+#define open_xzwstream(filename, mode)	NULL
+#define open_xzrastream(filename)	NULL
+#define open_xzwastream(filename, mode)	NULL
+#endif
+
+/* ------------------------------------------------------------------ */
+/* streams working on a lz4-compressed disk file */
+
+#ifdef HAVE_LIBLZ4
+#define LZ4BUFSIZ 64*1024
+#ifndef LZ4F_HEADER_SIZE_MAX
+#define LZ4F_HEADER_SIZE_MAX 19
+#endif
+typedef struct lz4_stream {
+	FILE *fp;
+	LZ4F_compressionContext_t cctx;
+	LZ4F_decompressionContext_t dctx;
+	char *out;		/* compressed output (write) */
+	size_t outsiz;
+	size_t inpos, inlen;	/* unconsumed compressed input (read) */
+	int eof;
+	char buf[LZ4BUFSIZ];
+} lz4_stream;
+
+static void
+lz4_free(lz4_stream *lz)
+{
+	if (lz->cctx)
+		LZ4F_freeCompressionContext(lz->cctx);
+	if (lz->dctx)
+		LZ4F_freeDecompressionContext(lz->dctx);
+	if (lz->out)
+		free(lz->out);
+	free(lz);
+}
+
+static ssize_t
+stream_lz4read(stream *s, void *buf, size_t elmsize, size_t cnt)
+{
+	lz4_stream *lz = s->stream_data.p;
+	size_t size = elmsize * cnt, ressize = 0;
+	char *outbuf = buf;
+
+	if (lz == NULL) {
+		s->errnr = MNSTR_READ_ERROR;
+		return -1;
+	}
+
+	while (ressize < size) {
+		size_t insz, outsz, ret;
+
+		if (lz->inpos == lz->inlen && !lz->eof) {
+			lz->inpos = 0;
+			lz->inlen = fread(lz->buf, 1, LZ4BUFSIZ, lz->fp);
+			if (lz->inlen == 0) {
+				if (ferror(lz->fp)) {
+					s->errnr = MNSTR_READ_ERROR;
+					return -1;
+				}
+				lz->eof = 1;
+			}
+		}
+		insz = lz->inlen - lz->inpos;
+		outsz = size - ressize;
+		/* at the end of the file this is called without input
+		 * to drain what the decoder still holds */
+		ret = LZ4F_decompress(lz->dctx, outbuf + ressize, &outsz,
+				      lz->buf + lz->inpos, &insz, NULL);
+		if (LZ4F_isError(ret)) {
+			s->errnr = MNSTR_READ_ERROR;
+			return -1;
+		}
+		lz->inpos += insz;
+		ressize += outsz;
+		if (lz->eof && outsz == 0)
+			break;
+	}
+	if (ressize) {
+#ifdef WIN32
+		/* on Windows when in text mode, convert \r\n line
+		 * endings to \n */
+		if (s->type == ST_ASCII) {
+			char *p1, *p2, *pe;
+
+			p1 = buf;
+			pe = p1 + ressize;
+			while (p1 < pe && *p1 != '\r')
+				p1++;
+			p2 = p1;
+			while (p1 < pe) {
+				if (*p1 == '\r' && p1[1] == '\n')
+					ressize--;
+				else
+					*p2++ = *p1;
+				p1++;
+			}
+		}
+#endif
+		return (ssize_t) (ressize / elmsize);
+	}
+	return 0;
+}
+
+static ssize_t
+stream_lz4write(stream *s, const void *buf, size_t elmsize, size_t cnt)
+{
+	lz4_stream *lz = s->stream_data.p;
+	size_t size = elmsize * cnt;
+	const char *inbuf = buf;
+
+	if (lz == NULL) {
+		s->errnr = MNSTR_WRITE_ERROR;
+		return -1;
+	}
+
+	while (size) {
+		size_t sz = size > LZ4BUFSIZ ? LZ4BUFSIZ : size;
+		size_t ret = LZ4F_compressUpdate(lz->cctx, lz->out, lz->outsiz, inbuf, sz, NULL);
+
+		if (LZ4F_isError(ret) ||
+		    fwrite(lz->out, 1, ret, lz->fp) != ret) {
+			s->errnr = MNSTR_WRITE_ERROR;
+			return -1;
+		}
+		inbuf += sz;
+		size -= sz;
+	}
+	return (ssize_t) cnt;
+}
+
+static void
+stream_lz4close(stream *s)
+{
+	lz4_stream *lz = s->stream_data.p;
+
+	if (lz) {
+		if (s->access == ST_WRITE) {
+			size_t ret = LZ4F_compressEnd(lz->cctx, lz->out, lz->outsiz, NULL);
+
+			if (LZ4F_isError(ret) ||
+			    fwrite(lz->out, 1, ret, lz->fp) != ret)
+				s->errnr = MNSTR_WRITE_ERROR;
+		}
+		fflush(lz->fp);
+		fclose(lz->fp);
+		lz4_free(lz);
+	}
+	s->stream_data.p = NULL;
+}
+
+static int
+stream_lz4flush(stream *s)
+{
+	lz4_stream *lz = s->stream_data.p;
+
+	if (lz == NULL)
+		return -1;
+	if (s->access == ST_WRITE) {
+		size_t ret = LZ4F_flush(lz->cctx, lz->out, lz->outsiz, NULL);
+
+		if (LZ4F_isError(ret) ||
+		    fwrite(lz->out, 1, ret, lz->fp) != ret ||
+		    fflush(lz->fp))
+			return -1;
+	}
+	return 0;
+}
+
+static stream *
+open_lz4stream(const char *filename, const char *flags)
+{
+	stream *s;
+	lz4_stream *lz;
+	size_t ret;
+
+	if ((lz = malloc(sizeof(struct lz4_stream))) == NULL)
+		return NULL;
+	memset(lz, 0, sizeof(lz4_stream));
+	if (flags[0] == 'r') {
+		if (LZ4F_isError(LZ4F_createDecompressionContext(&lz->dctx, LZ4F_VERSION))) {
+			lz->dctx = NULL;
+			lz4_free(lz);
+			return NULL;
+		}
+	} else {
+		/* the bound covers both a full chunk and the frame
+		 * header and footer */
+		lz->outsiz = LZ4F_compressBound(LZ4BUFSIZ, NULL) + LZ4F_HEADER_SIZE_MAX;
+		if (LZ4F_isError(LZ4F_createCompressionContext(&lz->cctx, LZ4F_VERSION))) {
+			lz->cctx = NULL;
+			lz4_free(lz);
+			return NULL;
+		}
+		if ((lz->out = malloc(lz->outsiz)) == NULL) {
+			lz4_free(lz);
+			return NULL;
+		}
+	}
+	if ((s = create_stream(filename)) == NULL) {
+		lz4_free(lz);
+		return NULL;
+	}
+#ifdef HAVE__WFOPEN
+	{
+		wchar_t *wfname = utf8towchar(filename);
+		wchar_t *wflags = utf8towchar(flags);
+		if (wfname != NULL && wflags != NULL)
+			lz->fp = _wfopen(wfname, wflags);
+		else
+			lz->fp = NULL;
+		if (wfname)
+			free(wfname);
+		if (wflags)
+			free(wflags);
+	}
+#else
+	{
+		char *fname = cvfilename(filename);
+		if (fname) {
+			lz->fp = fopen(fname, flags);
+			free(fname);
+		} else
+			lz->fp = NULL;
+	}
+#endif
+	if (lz->fp == NULL) {
+		destroy(s);
+		lz4_free(lz);
+		return NULL;
+	}
+	s->read = stream_lz4read;
+	s->write = stream_lz4write;
+	s->close = stream_lz4close;
+	s->flush = stream_lz4flush;
+	s->stream_data.p = (void *) lz;
+	if (flags[0] == 'r' && flags[1] != 'b') {
+		char buf[UTF8BOMLENGTH];
+		if (stream_lz4read(s, buf, 1, UTF8BOMLENGTH) == UTF8BOMLENGTH &&
+		    strncmp(buf, UTF8BOM, UTF8BOMLENGTH) == 0) {
+			s->isutf8 = 1;
+		} else {
+			/* start decoding afresh */
+			LZ4F_freeDecompressionContext(lz->dctx);
+			if (LZ4F_isError(LZ4F_createDecompressionContext(&lz->dctx, LZ4F_VERSION)))
+				lz->dctx = NULL;
+			lz->inpos = lz->inlen = 0;
+			lz->eof = 0;
+			s->errnr = MNSTR_NO__ERROR;
+			rewind(lz->fp);
+			if (lz->dctx == NULL) {
+				stream_lz4close(s);
+				destroy(s);
+				return NULL;
+			}
+		}
+	} else if (flags[0] != 'r') {
+		ret = LZ4F_compressBegin(lz->cctx, lz->out, lz->outsiz, NULL);
+		if (LZ4F_isError(ret) ||
+		    fwrite(lz->out, 1, ret, lz->fp) != ret) {
+			fclose(lz->fp);
+			lz4_free(lz);
+			destroy(s);
+			return NULL;
+		}
+	}
+	return s;
+}
+
+static stream *
+open_lz4rstream(const char *filename)
+{
+	stream *s;
+
+	if ((s = open_lz4stream(filename, "rb")) == NULL)
+		return NULL;
+	s->type = ST_BIN;
+	if (s->errnr == MNSTR_NO__ERROR &&
+	    stream_lz4read(s, (void *) &s->byteorder, sizeof(s->byteorder), 1) < 1) {
+		stream_lz4close(s);
+		destroy(s);
+		return NULL;
+	}
+	return s;
+}
+
+static stream *
+open_lz4wstream(const char *filename, const char *mode)
+{
+	stream *s;
+
+	if ((s = open_lz4stream(filename, mode)) == NULL)
+		return NULL;
+	s->access = ST_WRITE;
+	s->type = ST_BIN;
+	if (s->errnr == MNSTR_NO__ERROR &&
+	    stream_lz4write(s, (void *) &s->byteorder, sizeof(s->byteorder), 1) < 1) {
+		stream_lz4close(s);
+		destroy(s);
+		return NULL;
+	}
+	return s;
+}
+
+static stream *
+open_lz4rastream(const char *filename)
+{
+	stream *s;
+
+	if ((s = open_lz4stream(filename, "rb")) == NULL)
+		return NULL;
+	s->type = ST_ASCII;
+	return s;
+}
+
+static stream *
+open_lz4wastream(const char *filename, const char *mode)
+{
+	stream *s;
+
+	if ((s = open_lz4stream(filename, mode)) == NULL)
+		return NULL;
+	s->access = ST_WRITE;
+	s->type = ST_ASCII;
+	return s;
+}
+#else
+#define open_lz4rstream(filename)	NULL
+#define open_lz4wstream(filename, mode)	NULL
+#define open_lz4rastream(filename)	NULL
+#define open_lz4wastream(filename, mode)	NULL
+#endif
+
+/* ------------------------------------------------------------------ */
+/* streams working on a zstd-compressed disk file */
+
+#ifdef HAVE_LIBZSTD
+#define ZSTBUFSIZ 128*1024
+typedef struct zst_stream {
+	FILE *fp;
+	ZSTD_CStream *cs;
+	ZSTD_DStream *ds;
+	ZSTD_inBuffer in;	/* unconsumed compressed input (read) */
+	int eof;
+	char buf[ZSTBUFSIZ];
+} zst_stream;
+
+static void
+zst_free(zst_stream *zs)
+{
+	if (zs->cs)
+		ZSTD_freeCStream(zs->cs);
+	if (zs->ds)
+		ZSTD_freeDStream(zs->ds);
+	free(zs);
+}
+
+static ssize_t
+stream_zstread(stream *s, void *buf, size_t elmsize, size_t cnt)
+{
+	zst_stream *zs = s->stream_data.p;
+	ZSTD_outBuffer out;
+	size_t ressize;
+
+	if (zs == NULL) {
+		s->errnr = MNSTR_READ_ERROR;
+		return -1;
+	}
+
+	out.dst = buf;
+	out.size = elmsize * cnt;
+	out.pos = 0;
+	while (out.pos < out.size) {
+		size_t pos = out.pos, ret;
+
+		if (zs->in.pos == zs->in.size && !zs->eof) {
+			zs->in.pos = 0;
+			zs->in.size = fread(zs->buf, 1, ZSTBUFSIZ, zs->fp);
+			if (zs->in.size == 0) {
+				if (ferror(zs->fp)) {
+					s->errnr = MNSTR_READ_ERROR;
+					return -1;
+				}
+				zs->eof = 1;
+			}
+		}
+		/* at the end of the file this is called without input
+		 * to drain what the decoder still holds */
+		ret = ZSTD_decompressStream(zs->ds, &out, &zs->in);
+		if (ZSTD_isError(ret)) {
+			s->errnr = MNSTR_READ_ERROR;
+			return -1;
+		}
+		if (zs->eof && out.pos == pos)
+			break;
+	}
+	ressize = out.pos;
+	if (ressize) {
+#ifdef WIN32
+		/* on Windows when in text mode, convert \r\n line
+		 * endings to \n */
+		if (s->type == ST_ASCII) {
+			char *p1, *p2, *pe;
+
+			p1 = buf;
+			pe = p1 + ressize;
+			while (p1 < pe && *p1 != '\r')
+				p1++;
+			p2 = p1;
+			while (p1 < pe) {
+				if (*p1 == '\r' && p1[1] == '\n')
+					ressize--;
+				else
+					*p2++ = *p1;
+				p1++;
+			}
+		}
+#endif
+		return (ssize_t) (ressize / elmsize);
+	}
+	return 0;
+}
+
+static ssize_t
+stream_zstwrite(stream *s, const void *buf, size_t elmsize, size_t cnt)
+{
+	zst_stream *zs = s->stream_data.p;
+	ZSTD_inBuffer in;
+
+	if (zs == NULL) {
+		s->errnr = MNSTR_WRITE_ERROR;
+		return -1;
+	}
+
+	in.src = buf;
+	in.size = elmsize * cnt;
+	in.pos = 0;
+	while (in.pos < in.size) {
+		ZSTD_outBuffer out;
+		size_t ret;
+
+		out.dst = zs->buf;
+		out.size = ZSTBUFSIZ;
+		out.pos = 0;
+		ret = ZSTD_compressStream(zs->cs, &out, &in);
+		if (ZSTD_isError(ret) ||
+		    fwrite(zs->buf, 1, out.pos, zs->fp) != out.pos) {
+			s->errnr = MNSTR_WRITE_ERROR;
+			return -1;
+		}
+	}
+	return (ssize_t) cnt;
+}
+
+/* drain the encoder with either ZSTD_flushStream or ZSTD_endStream */
+static int
+zst_drain(zst_stream *zs, size_t (*drain)(ZSTD_CStream *, ZSTD_outBuffer *))
+{
+	size_t ret;
+
+	do {
+		ZSTD_outBuffer out;
+
+		out.dst = zs->buf;
+		out.size = ZSTBUFSIZ;
+		out.pos = 0;
+		ret = (*drain)(zs->cs, &out);
+		if (ZSTD_isError(ret) ||
+		    fwrite(zs->buf, 1, out.pos, zs->fp) != out.pos)
+			return -1;
+	} while (ret > 0);
+	return 0;
+}
+
+static void
+stream_zstclose(stream *s)
+{
+	zst_stream *zs = s->stream_data.p;
+
+	if (zs) {
+		if (s->access == ST_WRITE && zst_drain(zs, ZSTD_endStream) < 0)
+			s->errnr = MNSTR_WRITE_ERROR;
+		fflush(zs->fp);
+		fclose(zs->fp);
+		zst_free(zs);
+	}
+	s->stream_data.p = NULL;
+}
+
+static int
+stream_zstflush(stream *s)
+{
+	zst_stream *zs = s->stream_data.p;
+
+	if (zs == NULL)
+		return -1;
+	if (s->access == ST_WRITE &&
+	    (zst_drain(zs, ZSTD_flushStream) < 0 || fflush(zs->fp)))
+		return -1;
+	return 0;
+}
+
+static stream *
+open_zststream(const char *filename, const char *flags)
+{
+	stream *s;
+	zst_stream *zs;
+
+	if ((zs = malloc(sizeof(struct zst_stream))) == NULL)
+		return NULL;
+	memset(zs, 0, sizeof(zst_stream));
+	if (flags[0] == 'r') {
+		if ((zs->ds = ZSTD_createDStream()) == NULL ||
+		    ZSTD_isError(ZSTD_initDStream(zs->ds))) {
+			zst_free(zs);
+			return NULL;
+		}
+		zs->in.src = zs->buf;
+	} else {
+		if ((zs->cs = ZSTD_createCStream()) == NULL ||
+		    ZSTD_isError(ZSTD_initCStream(zs->cs, 3))) {
+			zst_free(zs);
+			return NULL;
+		}
+	}
+	if ((s = create_stream(filename)) == NULL) {
+		zst_free(zs);
+		return NULL;
+	}
+#ifdef HAVE__WFOPEN
+	{
+		wchar_t *wfname = utf8towchar(filename);
+		wchar_t *wflags = utf8towchar(flags);
+		if (wfname != NULL && wflags != NULL)
+			zs->fp = _wfopen(wfname, wflags);
+		else
+			zs->fp = NULL;
+		if (wfname)
+			free(wfname);
+		if (wflags)
+			free(wflags);
+	}
+#else
+	{
+		char *fname = cvfilename(filename);
+		if (fname) {
+			zs->fp = fopen(fname, flags);
+			free(fname);
+		} else
+			zs->fp = NULL;
+	}
+#endif
+	if (zs->fp == NULL) {
+		destroy(s);
+		zst_free(zs);
+		return NULL;
+	}
+	s->read = stream_zstread;
+	s->write = stream_zstwrite;
+	s->close = stream_zstclose;
+	s->flush = stream_zstflush;
+	s->stream_data.p = (void *) zs;
 	if (flags[0] == 'r' && flags[1] != 'b') {
 		char buf[UTF8BOMLENGTH];
-		if (stream_xzread(s, buf, 1, UTF8BOMLENGTH) == UTF8BOMLENGTH &&
+		if (stream_zstread(s, buf, 1, UTF8BOMLENGTH) == UTF8BOMLENGTH &&
 		    strncmp(buf, UTF8BOM, UTF8BOMLENGTH) == 0) {
 			s->isutf8 = 1;
 		} else {
-			rewind(xz->fp);
+			/* start decoding afresh */
+			zs->in.pos = zs->in.size = 0;
+			zs->eof = 0;
+			s->errnr = MNSTR_NO__ERROR;
+			rewind(zs->fp);
+			if (ZSTD_isError(ZSTD_initDStream(zs->ds))) {
+				stream_zstclose(s);
+				destroy(s);
+				return NULL;
+			}
 		}
 	}
 	return s;
 }
 
 static stream *
-open_xzrstream(const char *filename)
+open_zstrstream(const char *filename)
 {
 	stream *s;
 
-	if ((s = open_xzstream(filename, "rb")) == NULL)
+	if ((s = open_zststream(filename, "rb")) == NULL)
 		return NULL;
 	s->type = ST_BIN;
 	if (s->errnr == MNSTR_NO__ERROR &&
-	    stream_xzread(s, (void *) &s->byteorder, sizeof(s->byteorder), 1) < 1) {
-		stream_xzclose(s);
+	    stream_zstread(s, (void *) &s->byteorder, sizeof(s->byteorder), 1) < 1) {
+		stream_zstclose(s);
 		destroy(s);
 		return NULL;
 	}
@@ -1636,17 +2284,17 @@ open_xzrstream(const char *filename)
 }
 
 static stream *
-open_xzwstream(const char *filename, const char *mode)
+open_zstwstream(const char *filename, const char *mode)
 {
 	stream *s;
 
-	if ((s = open_xzstream(filename, mode)) == NULL)
+	if ((s = open_zststream(filename, mode)) == NULL)
 		return NULL;
 	s->access = ST_WRITE;
 	s->type = ST_BIN;
 	if (s->errnr == MNSTR_NO__ERROR &&
-	    stream_xzwrite(s, (void *) &s->byteorder, sizeof(s->byteorder), 1) < 1) {
-		stream_xzclose(s);
+	    stream_zstwrite(s, (void *) &s->byteorder, sizeof(s->byteorder), 1) < 1) {
+		stream_zstclose(s);
 		destroy(s);
 		return NULL;
 	}
@@ -1654,32 +2302,32 @@ open_xzwstream(const char *filename, const char *mode)
 }
 
 static stream *
-open_xzrastream(const char *filename)
+open_zstrastream(const char *filename)
 {
 	stream *s;
 
-	if ((s = open_xzstream(filename, "rb")) == NULL)
+	if ((s = open_zststream(filename, "rb")) == NULL)
 		return NULL;
 	s->type = ST_ASCII;
 	return s;
 }
 
 static stream *
-open_xzwastream(const char *filename, const char *mode)
+open_zstwastream(const char *filename, const char *mode)
 {
 	stream *s;
 
-	if ((s = open_xzstream(filename, mode)) == NULL)
+	if ((s = open_zststream(filename, mode)) == NULL)
 		return NULL;
 	s->access = ST_WRITE;
 	s->type = ST_ASCII;
 	return s;
 }
 #else
-#define open_xzrstream(filename)	NULL
-#define open_xzwstream(filename, mode)	NULL
-#define open_xzrastream(filename)	NULL
-#define open_xzwastream(filename, mode)	NULL
+#define open_zstrstream(filename)	NULL
+#define open_zstwstream(filename, mode)	NULL
+#define open_zstrastream(filename)	NULL
+#define open_zstwastream(filename, mode)	NULL
 #endif
 
 /* ------------------------------------------------------------------ */
@@ -1704,6 +2352,10 @@ open_rstream(const char *filename)
 		return open_bzrstream(filename);
 	if (strcmp(ext, "xz") == 0)
 		return open_xzrstream(filename);
+	if (strcmp(ext, "lz4") == 0)
+		return open_lz4rstream(filename);
+	if (strcmp(ext, "zst") == 0)
+		return open_zstrstream(filename);
 
 	if ((s = open_stream(filename, "rb")) == NULL)
 		return NULL;
@@ -1739,6 +2391,10 @@ open_wstream_(const char *filename, char *mode)
 		return open_bzwstream(filename, mode);
 	if (strcmp(ext, "xz") == 0)
 		return open_xzwstream(filename, mode);
+	if (strcmp(ext, "lz4") == 0)
+		return open_lz4wstream(filename, mode);
+	if (strcmp(ext, "zst") == 0)
+		return open_zstwstream(filename, mode);
 
 	if ((s = open_stream(filename, mode)) == NULL)
 		return NULL;
@@ -1786,6 +2442,10 @@ open_rastream(const char *filename)
 		return open_bzrastream(filename);
 	if (strcmp(ext, "xz") == 0)
 		return open_xzrastream(filename);
+	if (strcmp(ext, "lz4") == 0)
+		return open_lz4rastream(filename);
+	if (strcmp(ext, "zst") == 0)
+		return open_zstrastream(filename);
 
 	if ((s = open_stream(filename, "r")) == NULL)
 		return NULL;
@@ -1812,6 +2472,10 @@ open_wastream_(const char *filename, char *mode)
 		return open_bzwastream(filename, mode);
 	if (strcmp(ext, "xz") == 0)
 		return open_xzwastream(filename, mode);
+	if (strcmp(ext, "lz4") == 0)
+		return open_lz4wastream(filename, mode);
+	if (strcmp(ext, "zst") == 0)
+		return open_zstwastream(filename, mode);
 
 	if ((s = open_stream(filename, mode)) == NULL)
 		return NULL;
@@ -3938,11 +4602,433 @@ block_stream(stream *s)
 	return ns;
 }
 
+/* ------------------------------------------------------------------ */
+/* block streams with a negotiated block size, optionally compressing
+ * each block as a whole */
+
+typedef struct bs2 {
+	stream *s;		/* underlying stream */
+	size_t nr;		/* how far we got in buf (write) */
+	size_t itotal;		/* amount available in buf (read) */
+	size_t readpos;		/* how much of buf was returned (read) */
+	int final;		/* buf is the last block of a message (read) */
+	size_t bufsiz;		/* size of buf */
+	compression_method comp;
+	char *compbuf;		/* the block in its compressed form */
+	size_t compbufsiz;
+	size_t blks;		/* read/writen blocks (possibly partial) */
+	size_t bytes;		/* read/writen bytes (uncompressed) */
+	char *buf;		/* the buffered data */
+} bs2;
+
+int
+compression_supported(compression_method comp)
+{
+	switch (comp) {
+	case COMPRESSION_NONE:
+		return 1;
+#ifdef HAVE_LIBLZ4
+	case COMPRESSION_LZ4:
+		return 1;
+#endif
+#ifdef HAVE_LIBZSTD
+	case COMPRESSION_ZSTD:
+		return 1;
+#endif
+	default:
+		return 0;
+	}
+}
+
+static size_t
+compression_size_bound(compression_method comp, size_t bufsiz)
+{
+	(void) bufsiz;
+	switch (comp) {
+#ifdef HAVE_LIBLZ4
+	case COMPRESSION_LZ4:
+		return (size_t) LZ4_compressBound((int) bufsiz);
+#endif
+#ifdef HAVE_LIBZSTD
+	case COMPRESSION_ZSTD:
+		return ZSTD_compressBound(bufsiz);
+#endif
+	default:
+		return 0;
+	}
+}
+
+static void
+bs2_free(bs2 *s)
+{
+	if (s->buf)
+		free(s->buf);
+	if (s->compbuf)
+		free(s->compbuf);
+	free(s);
+}
+
+static bs2 *
+bs2_create(stream *s, size_t bufsiz, compression_method comp)
+{
+	bs2 *ns;
+
+	if ((ns = malloc(sizeof(*ns))) == NULL)
+		return NULL;
+	memset(ns, 0, sizeof(*ns));
+	ns->s = s;
+	ns->bufsiz = bufsiz;
+	ns->comp = comp;
+	ns->compbufsiz = compression_size_bound(comp, bufsiz);
+	if ((ns->buf = malloc(bufsiz)) == NULL ||
+	    (ns->compbufsiz > 0 &&
+	     (ns->compbuf = malloc(ns->compbufsiz)) == NULL)) {
+		bs2_free(ns);
+		return NULL;
+	}
+	return ns;
+}
+
+/* Compress the collected data (unless comp is COMPRESSION_NONE) and
+ * write it to the underlying stream as a single block.  An empty
+ * block is only ever written to mark a flush. */
+static int
+bs2_writeblock(stream *ss, bs2 *s, int flush)
+{
+	const char *data = s->buf;
+	size_t len = s->nr;
+	lng blksize;
+
+	if (len > 0) {
+		switch (s->comp) {
+#ifdef HAVE_LIBLZ4
+		case COMPRESSION_LZ4: {
+			int n = LZ4_compress_default(s->buf, s->compbuf, (int) s->nr, (int) s->compbufsiz);
+
+			if (n <= 0) {
+				ss->errnr = MNSTR_WRITE_ERROR;
+				return -1;
+			}
+			data = s->compbuf;
+			len = (size_t) n;
+			break;
+		}
+#endif
+#ifdef HAVE_LIBZSTD
+		case COMPRESSION_ZSTD: {
+			size_t n = ZSTD_compress(s->compbuf, s->compbufsiz, s->buf, s->nr, 1);
+
+			if (ZSTD_isError(n)) {
+				ss->errnr = MNSTR_WRITE_ERROR;
+				return -1;
+			}
+			data = s->compbuf;
+			len = n;
+			break;
+		}
+#endif
+		default:
+			break;
+		}
+	}
+	/* as with block_stream, the low-order bit marks a flush */
+	blksize = (lng) (len << 1) | (flush != 0);
+#ifdef WORDS_BIGENDIAN
+	blksize = long_long_SWAP(blksize);
+#endif
+	if (!mnstr_writeLng(s->s, blksize) ||
+	    (len > 0 && s->s->write(s->s, data, 1, len) != (ssize_t) len)) {
+		ss->errnr = MNSTR_WRITE_ERROR;
+		return -1;
+	}
+	s->blks++;
+	s->bytes += s->nr;
+	s->nr = 0;
+	return 0;
+}
+
+static ssize_t
+bs2_write(stream *ss, const void *buf, size_t elmsize, size_t cnt)
+{
+	bs2 *s;
+	size_t todo = cnt * elmsize;
+
+	s = (bs2 *) ss->stream_data.p;
+	if (s == NULL)
+		return -1;
+	assert(ss->access == ST_WRITE);
+	assert(s->nr < s->bufsiz);
+	while (todo > 0) {
+		size_t n = s->bufsiz - s->nr;
+
+		if (todo < n)
+			n = todo;
+		memcpy(s->buf + s->nr, buf, n);
+		s->nr += n;
+		todo -= n;
+		buf = ((const char *) buf + n);
+		if (s->nr == s->bufsiz && bs2_writeblock(ss, s, 0) < 0)
+			return -1;
+	}
+	return (ssize_t) cnt;
+}
+
+static int
+bs2_flush(stream *ss)
+{
+	bs2 *s;
+
+	s = (bs2 *) ss->stream_data.p;
+	if (s == NULL)
+		return -1;
+	assert(ss->access == ST_WRITE);
+	if (ss->access == ST_WRITE)
+		return bs2_writeblock(ss, s, 1);
+	return 0;
+}
+
+/* Read the next block from the underlying stream and decompress it
+ * into buf.  Returns 1 on success, 0 at end of file, -1 on error. */
+static int
+bs2_readblock(stream *ss, bs2 *s)
+{
+	lng blksize = 0;
+	size_t len;
+	char *dst;
+	ssize_t m;
+
+	switch (mnstr_readLng(s->s, &blksize)) {
+	case -1:
+		ss->errnr = s->s->errnr;
+		return -1;
+	case 0:
+		return 0;
+	case 1:
+		break;
+	}
+	len = (size_t) (blksize >> 1);
+	if (blksize < 0 ||
+	    len > (s->comp == COMPRESSION_NONE ? s->bufsiz : s->compbufsiz)) {
+		ss->errnr = MNSTR_READ_ERROR;
+		return -1;
+	}
+	s->final = (int) (blksize & 1);
+	dst = s->comp == COMPRESSION_NONE ? s->buf : s->compbuf;
+	for (s->itotal = 0; s->itotal < len; s->itotal += m) {
+		if ((m = s->s->read(s->s, dst + s->itotal, 1, len - s->itotal)) <= 0) {
+			ss->errnr = s->s->errnr ? s->s->errnr : MNSTR_READ_ERROR;
+			return -1;
+		}
+	}
+	if (len > 0) {
+		switch (s->comp) {
+#ifdef HAVE_LIBLZ4
+		case COMPRESSION_LZ4: {
+			int n = LZ4_decompress_safe(s->compbuf, s->buf, (int) len, (int) s->bufsiz);
+
+			if (n < 0) {
+				ss->errnr = MNSTR_READ_ERROR;
+				return -1;
+			}
+			s->itotal = (size_t) n;
+			break;
+		}
+#endif
+#ifdef HAVE_LIBZSTD
+		case COMPRESSION_ZSTD: {
+			size_t n = ZSTD_decompress(s->buf, s->bufsiz, s->compbuf, len);
+
+			if (ZSTD_isError(n)) {
+				ss->errnr = MNSTR_READ_ERROR;
+				return -1;
+			}
+			s->itotal = n;
+			break;
+		}
+#endif
+		default:
+			break;
+		}
+	}
+	s->readpos = 0;
+	s->blks++;
+	s->bytes += s->itotal;
+	return 1;
+}
+
+/* Read buffered data and return the number of items read.  As with
+ * bs_read, after the last block of a message has been returned, a
+ * single read returns 0 to indicate the end of the message. */
+static ssize_t
+bs2_read(stream *ss, void *buf, size_t elmsize, size_t cnt)
+{
+	bs2 *s;
+	size_t todo = cnt * elmsize, done = 0;
+
+	s = (bs2 *) ss->stream_data.p;
+	if (s == NULL)
+		return -1;
+	assert(ss->access == ST_READ);
+
+	for (;;) {
+		size_t n;
+
+		if (s->readpos == s->itotal) {
+			if (s->final) {
+				/* only an empty read consumes the
+				 * end-of-message marker */
+				if (done == 0)
+					s->final = 0;
+				break;
+			}
+			if (todo == 0 && done > 0)
+				break;
+			switch (bs2_readblock(ss, s)) {
+			case -1:
+				return -1;
+			case 0:
+				return (ssize_t) (elmsize > 0 ? done / elmsize : 0);
+			}
+			continue;
+		}
+		if (todo == 0)
+			break;
+		n = s->itotal - s->readpos;
+		if (todo < n)
+			n = todo;
+		memcpy((char *) buf + done, s->buf + s->readpos, n);
+		s->readpos += n;
+		done += n;
+		todo -= n;
+	}
+	return (ssize_t) (elmsize > 0 ? done / elmsize : 0);
+}
+
+static void
+bs2_update_timeout(stream *ss)
+{
+	bs2 *s;
+
+	if ((s = ss->stream_data.p) != NULL && s->s) {
+		s->s->timeout = ss->timeout;
+		s->s->timeout_func = ss->timeout_func;
+		if (s->s->update_timeout)
+			(*s->s->update_timeout)(s->s);
+	}
+}
+
+static int
+bs2_isalive(stream *ss)
+{
+	bs2 *s;
+
+	if ((s = ss->stream_data.p) != NULL && s->s) {
+		if (s->s->isalive)
+			return (*s->s->isalive)(s->s);
+		return 1;
+	}
+	return 0;
+}
+
+static void
+bs2_close(stream *ss)
+{
+	bs2 *s;
+
+	s = (bs2 *) ss->stream_data.p;
+	assert(s);
+	if (s == NULL)
+		return;
+	assert(s->s);
+	if (s->s)
+		s->s->close(s->s);
+}
+
+static void
+bs2_destroy(stream *ss)
+{
+	bs2 *s;
+
+	s = (bs2 *) ss->stream_data.p;
+	assert(s);
+	if (s) {
+		assert(s->s);
+		if (s->s)
+			s->s->destroy(s->s);
+		bs2_free(s);
+	}
+	destroy(ss);
+}
+
+static void
+bs2_clrerr(stream *s)
+{
+	if (s->stream_data.p)
+		mnstr_clearerr(((bs2 *) s->stream_data.p)->s);
+}
+
+stream *
+block_stream2(stream *s, size_t bufsiz, compression_method comp)
+{
+	stream *ns, *os = NULL;
+	bs2 *b;
+
+	if (s == NULL || bufsiz == 0 || !compression_supported(comp))
+		return NULL;
+#ifdef STREAM_DEBUG
+	fprintf(stderr, "block_stream2 %s\n", s->name ? s->name : "<unnamed>");
+#endif
+	if (s->read == bs_read || s->write == bs_write) {
+		/* replace the block stream, reusing its underlying
+		 * stream; this is only safe at a message boundary */
+		os = s;
+		s = ((bs *) os->stream_data.p)->s;
+	} else if (s->read == bs2_read || s->write == bs2_write) {
+		os = s;
+		s = ((bs2 *) os->stream_data.p)->s;
+	}
+	if ((ns = create_stream(s->name)) == NULL)
+		return NULL;
+	if ((b = bs2_create(s, bufsiz, comp)) == NULL) {
+		destroy(ns);
+		return NULL;
+	}
+	if (os) {
+		if (os->read == bs_read || os->write == bs_write)
+			free(os->stream_data.p);
+		else
+			bs2_free(os->stream_data.p);
+		ns->type = os->type;
+		ns->access = os->access;
+		ns->byteorder = os->byteorder;
+		destroy(os);
+	} else {
+		ns->type = s->type;
+		ns->access = s->access;
+	}
+	/* blocksizes have a fixed little endian byteorder */
+#ifdef WORDS_BIGENDIAN
+	s->byteorder = 3412;	/* simply != 1234 */
+#endif
+	ns->close = bs2_close;
+	ns->clrerr = bs2_clrerr;
+	ns->destroy = bs2_destroy;
+	ns->flush = bs2_flush;
+	ns->read = bs2_read;
+	ns->write = bs2_write;
+	ns->update_timeout = bs2_update_timeout;
+	ns->isalive = bs2_isalive;
+	ns->stream_data.p = (void *) b;
+
+	return ns;
+}
+
 int
 isa_block_stream(stream *s)
 {
 	assert(s != NULL);
-	return s && (s->read == bs_read || s->write == bs_write);
+	return s && (s->read == bs_read || s->write == bs_write ||
+		     s->read == bs2_read || s->write == bs2_write);
 }
 
 /* ------------------------------------------------------------------ */
@@ -3955,7 +5041,7 @@ mnstr_read_block(stream *s, void *buf, size_t elmsize, size_t cnt)
 
 	if (s == NULL || buf == NULL)
 		return -1;
-	assert(s->read == bs_read || s->write == bs_write);
+	assert(isa_block_stream(s));
 	if ((len = mnstr_read(s, buf, elmsize, cnt)) < 0 ||
 	    mnstr_read(s, &x, 0, 0) < 0	/* read prompt */ ||
 	    x > 0)
@@ -221,6 +221,21 @@ stream_export buffer *mnstr_get_buffer(stream *s);
 stream_export stream *wbstream(stream *s, size_t buflen);
 stream_export stream *block_stream(stream *s);
 stream_export int isa_block_stream(stream *s);
+
+/* Block stream with a negotiated block size whose blocks may be
+ * compressed as a whole.  Each block is preceded by a lng holding
+ * the (compressed) length shifted left by one, the low-order bit
+ * again marking a flush.  Both ends must agree on bufsiz and comp.
+ * When handed a block_stream, the new stream takes over the stream
+ * underneath it and the old wrapper is destroyed. */
+typedef enum compression_method {
+	COMPRESSION_NONE = 0,
+	COMPRESSION_LZ4,
+	COMPRESSION_ZSTD
+} compression_method;
+
+stream_export stream *block_stream2(stream *s, size_t bufsiz, compression_method comp);
+stream_export int compression_supported(compression_method comp);
 /* read block of data including the end of block marker */
 stream_export ssize_t mnstr_read_block(stream *s, void *buf, size_t elmsize, size_t cnt);
 
@@ -64,20 +64,20 @@ unsigned char mal_init_inline_arr[] =
 42,78,230,216,40,67,78,230,199,20,158,204,178,81,70,158,236,32,166,240,100,150,141,50,242,100,7,49,133,39,75,173,250,126,76,225,201,82,171,190,31,83,120,178,212,170,239,199,20,158,44,181,234,251,49,21,39,115,108,148,33,39,243,99,10,79,54,240,107,144,244,201,14,98,10,79,54,240,51,147,244,201,14,98,10,79,102,217,40,35,79,118,16,83,120,178,212,170,239,199,20,158,44,181,234,251,49,133,39,75,173,250,126,76,197,201,28,27,101,200,201,252,152,194,147,89,54,202,200,147,29,196,20,158,204,178,81,70,158,236,32,166,240,100,150,141,50,242,100,7,49,133,39,179,108,148,145,39,59,136,41,60,89,106,213,247,99,10,79,150,90,245,253,152,138,147,57,54,202,144,147,249,49,133,39,27,248,205,107,250,100,7,49,133,39,27,248,49,109,250,100,7,49,133,39,27,248,149,110,250,100,7,49,133,39,27,248,249,111,250,100,7,49,133,39,27,248,93,113,250,100,7,49,133,39,75,173,250,126,76,242,100,7,63,197,190,183,81,118,252,238,103,199,209,254,254,253,119,128,117,243,20,211,142,214,149,180,143,58,108,148,145,39,59,136,41,60,153,245,106,53,242,100,7,49,133,39,179,154,236,145,39,59,136,41,60,153,213,110,137,60,217,65,76,225,201,172,15,222,145,39,59,136,41,60,153,85,130,35,79,118,16,83,113,50,199,70,25,114,50,63,166,240,100,169,85,223,143,41,60,89,106,213,247,99,10,79,150,90,245,253,152,194,147,165,86,125,63,166,240,100,169,85,223,143,41,60,89,106,213,247,99,42,78,230,216,40,67,78,230,199,20,158,108,96,150,15,125,178,131,152,194,147,165,86,125,63,166,240,100,169,85,223,143,41,60,89,106,213,247,99,10,79,150,90,245,253,152,194,147,165,86,125,63,166,226,100,142,141,50,228,100,126,76,225,201,44,27,101,228,201,14,98,10,79,102,217,40,35,79,118,16,83,120,178,212,170,239,199,20,158,44,181,234,251,49,133,39,75,173,250,126,76,225,201,82,171,190,31,83,113,50,199,70,25,114,50,63,166,240,100,3,51,27,233,147,29,196,20,158,108,96,24,36,125,178,131,152,194,147,89,54,202,200,147,29,196,20,158,44,181,234,251,49,133,39,75,173,250,126,76,225,201,82,171,190,31,83,113,50,199,70,25,114,50,63,166,240,100,150,141,50,242,100,7,49,133,39,179,108,148,145,39,59,136,41,60,153,101,163,140,60,217,65,76,225,201,44,27,101,228,201,14,98,10,79,150,90,245,253,152,194,147,165,86,125,63,166,226,100,142,141,50,228,100,126,76,225,201,6,38,83,211,39,59,136,41,60,217,192,200,107,250,100,7,49,133,39,27,152,165,77,159,236,32,166,240,100,3,67,186,233,147,29,196,20,158,108,96,250,55,125,178,131,152,194,147,165,86,125,63,38,121,178,203,191,246,234,205,215,215,241,144,143,239,46,133,234,241,221,217,118,242,248,238,198,15,138,158,254,203,231,72,255,241,246,205,87,175,30,31,222,156,254,255,221,151,95,252,223,127,186,59,47,244,135,223,252,250,63,255,116,90,122,183,240,235,107,153,176,214,61,191,22,60,94,250,242,63,250,219,221,187,135,127,156,254,229,211,255,236,213,227,235,51,122,223,60,199,124,134,239,147,157,41,116,255,33,224,243,223,188,180,19,245,73,111,162,246,145,246,233,137,138,180,55,186,106,34,125,253,250,7,192,92,123,138,105,71,235,122,172,62,217,25,93,51,178,101,201,113,84,164,220,108,29,196,20,102,203,186,238,233,49,180,62,98,68,69,202,205,214,65,76,97,182,172,43,172,30,67,235,99,83,84,164,220,108,29,196,20,102,203,186,150,235,49,180,62,10,70,69,202,205,214,65,76,97,182,172,15,157,122,12,173,166,70,36,134,7,49,133,24,90,31,111,35,79,118,16,83,113,178,149,69,61,244,89,94,69,10,229,161,99,187,15,201,150,31,83,152,173,132,207,160,171,72,25,217,178,190,74,16,153,173,131,152,194,108,37,124,6,93,69,202,200,214,245,166,156,154,173,131,152,194,108,37,124,6,93,69,202,200,214,83,164,220,108,29,196,20,102,43,225,51,232,42,82,70,182,158,34,229,102,235,32,166,48,91,9,159,65,157,47,204,68,98,24,252,25,212,249,194,76,228,201,130,63,131,174,190,48,19,250,44,175,34,133,242,208,249,18,80,72,182,252,152,194,108,37,124,6,93,69,
 202,200,150,245,197,166,200,108,29,196,20,102,43,225,51,232,42,82,70,182,172,47,107,69,102,235,32,166,48,91,9,159,65,87,145,50,178,245,20,41,55,91,7,49,133,217,74,248,12,186,138,148,145,173,167,72,185,217,58,136,41,204,86,194,103,80,231,235,123,145,24,6,127,6,117,190,190,23,121,178,224,207,160,171,175,239,133,62,203,171,72,161,60,116,190,146,24,146,45,63,166,48,91,9,159,65,87,145,50,178,101,125,205,50,50,91,7,49,133,217,74,248,12,186,138,148,145,45,235,171,163,145,217,58,136,41,204,86,194,103,208,85,164,140,108,89,95,135,141,204,214,65,76,97,182,18,62,131,174,34,101,100,235,41,82,110,182,14,98,10,179,149,240,25,212,249,50,113,36,134,193,159,65,157,47,19,71,158,44,248,51,232,234,203,196,161,207,242,42,82,40,15,157,47,72,135,100,203,143,41,204,86,194,103,208,85,164,140,108,89,95,250,142,204,214,65,76,97,182,18,62,131,174,34,101,100,203,250,34,123,100,182,14,98,10,179,149,240,25,116,21,41,35,91,214,151,243,35,179,117,16,83,152,173,132,207,160,171,72,25,217,178,126,112,32,50,91,7,49,133,217,74,248,12,234,252,180,65,36,134,193,159,65,157,159,54,136,60,89,240,103,208,213,79,27,132,178,195,249,17,133,16,12,253,152,66,12,19,62,175,57,63,215,16,137,225,65,76,33,134,9,159,162,156,31,134,136,196,240,32,166,16,195,132,207,54,206,79,80,68,98,120,16,83,136,97,194,39,14,231,199,46,34,49,60,136,41,196,48,225,19,135,243,179,26,145,24,6,127,226,112,126,86,35,242,100,193,159,56,156,159,213,8,57,153,31,83,120,178,216,207,1,183,79,118,16,83,120,178,88,117,190,125,178,131,152,194,147,197,106,230,237,147,29,196,20,158,44,86,201,110,159,236,32,166,240,100,177,250,114,251,100,7,49,133,39,75,173,250,126,76,242,100,207,1,127,218,51,17,237,247,159,219,71,251,233,205,163,157,206,241,250,235,135,187,251,127,221,253,247,195,187,183,237,111,149,188,253,26,153,197,246,251,207,237,152,235,24,135,9,252,105,199,143,29,196,159,242,32,178,252,148,214,143,4,196,159,242,32,178,252,148,214,151,235,227,79,121,16,89,126,74,235,75,233,241,167,60,136,44,63,165,249,251,123,225,167,60,136,44,63,165,249,171,76,225,167,60,136,172,59,229,234,171,215,169,140,245,35,203,79,105,78,92,11,63,229,65,100,249,41,173,175,250,198,159,242,32,178,252,148,214,87,100,227,79,121,16,89,126,74,235,171,165,241,167,60,136,44,63,229,4,37,241,35,203,79,57,65,73,252,200,186,83,174,190,64,153,170,36,126,100,249,41,39,40,137,31,89,126,74,115,162,91,248,41,15,34,203,79,105,125,209,45,254,148,7,145,229,167,180,190,32,22,127,202,131,200,242,83,78,80,18,63,178,252,148,19,148,196,143,172,59,229,234,107,80,169,74,226,71,150,159,114,130,146,248,145,229,167,156,160,36,126,100,249,41,205,137,113,225,167,60,136,44,63,165,245,53,143,248,83,30,68,150,159,114,130,146,248,145,229,167,156,160,36,126,100,221,41,87,95,102,72,85,18,63,178,252,148,19,148,196,143,44,63,229,4,37,241,35,203,79,57,65,73,252,200,242,83,154,19,233,194,79,121,16,89,126,202,9,74,226,71,150,159,114,130,146,248,145,117,167,244,166,214,197,157,210,143,44,63,165,57,193,46,252,148,7,145,229,167,52,167,217,133,159,242,32,178,252,148,230,100,187,240,83,30,68,150,159,210,156,114,23,126,202,131,200,242,83,78,80,18,63,178,252,148,19,148,196,143,172,59,165,55,9,47,238,148,126,100,249,41,205,169,120,225,167,60,136,44,63,165,57,33,47,252,148,7,145,229,167,52,167,229,133,159,242,32,178,252,148,230,228,188,240,83,30,68,150,159,210,156,162,23,126,202,131,200,242,83,78,80,18,63,242,208,41,159,195,190,122,243,245,197,42,246,250,233,114,240,250,98,225,124,189,149,231,127,255,221,205,112,167,255,250,20,176,69,237,199,229,142,221,189,232,114,142,249,9,93,206,121,55,140,46,231,180,206,209,229,156,206,130,187,220,243,122,87,19,224,113,102,127,255,135,91,171,253,254,15,155,189,117,153,182,161,181,156,156,66,107,57,9,133,214,114,178,9,173,229,164,210,89,235,121,177,127,118,101,242,47,183,
 151,251,203,110,111,255,236,74,38,186,156,147,79,116,57,39,165,232,114,78,86,209,229,156,196,186,203,61,175,247,203,95,118,164,226,203,63,254,167,45,51,191,252,229,165,230,191,123,245,250,253,67,243,13,147,239,31,207,35,79,223,189,122,243,183,135,187,247,15,95,189,125,243,245,221,219,127,60,156,254,249,235,70,115,190,123,255,45,240,157,140,211,54,14,54,112,16,241,80,103,87,8,88,95,148,72,70,224,96,27,209,8,88,95,162,72,70,224,96,27,209,8,88,95,176,72,70,224,96,27,209,8,88,95,190,72,70,224,96,27,97,8,56,19,220,178,16,240,183,17,141,128,165,163,201,8,28,108,35,26,1,235,75,0,201,8,28,108,35,26,1,235,11,2,201,8,28,108,35,26,1,235,203,3,201,8,28,108,35,12,1,103,142,80,22,2,254,54,162,17,176,102,243,36,35,112,176,141,104,4,172,75,80,50,2,7,219,136,70,192,50,184,39,35,112,176,141,104,4,44,243,123,50,2,7,219,8,67,192,153,102,145,133,128,191,141,104,4,172,9,17,201,8,28,108,35,26,1,107,234,66,50,2,7,219,136,70,192,234,96,37,35,112,176,141,104,4,44,243,118,50,2,7,219,8,67,192,249,77,245,44,4,252,109,68,35,96,253,78,121,50,2,7,219,136,70,192,250,237,239,100,4,14,182,17,141,128,245,123,218,201,8,28,108,35,26,1,235,245,67,50,2,7,219,16,34,240,188,137,207,62,235,120,87,241,135,35,8,62,251,140,135,224,29,244,202,228,15,183,33,184,110,128,37,193,10,1,235,93,69,50,2,7,219,136,70,192,122,87,145,140,192,193,54,162,17,176,222,85,36,35,112,176,141,104,4,172,119,21,201,8,28,108,35,12,1,231,93,69,22,2,254,54,162,17,176,222,85,36,35,112,176,141,104,4,172,119,21,201,8,28,108,35,26,1,235,93,69,50,2,7,219,136,70,192,122,87,145,140,192,193,54,194,16,112,222,85,100,33,224,111,35,26,1,235,93,69,50,2,7,219,136,70,192,122,87,145,140,192,193,54,162,17,176,222,85,36,35,112,176,141,104,4,172,119,21,201,8,28,108,35,12,1,231,93,69,22,2,254,54,162,17,176,222,85,36,35,112,176,141,104,4,172,119,21,201,8,28,108,35,26,1,235,93,69,50,2,7,219,136,70,192,122,87,145,140,192,193,54,194,16,112,222,85,100,33,224,111,35,26,1,235,93,69,50,2,7,219,136,70,192,122,87,145,140,192,193,54,162,17,176,222,85,36,35,112,176,141,104,4,172,119,21,201,8,28,108,67,136,192,242,214,168,227,235,67,95,254,233,230,203,154,205,247,95,158,204,153,143,239,46,143,242,227,187,209,149,222,190,190,8,195,233,63,70,87,90,191,136,17,172,116,125,161,33,88,233,250,98,64,176,210,181,193,46,88,233,218,168,22,172,244,244,61,92,197,74,79,223,117,29,99,230,106,22,128,96,37,1,11,86,77,81,197,74,2,22,172,154,116,138,149,4,44,88,253,198,248,208,74,235,223,241,22,172,36,96,193,170,33,164,88,73,192,130,85,131,66,177,146,128,5,171,223,7,30,90,105,253,27,188,130,149,4,44,88,93,134,21,43,9,88,176,186,156,41,86,18,176,96,245,219,158,67,43,173,127,63,83,176,146,128,5,171,139,128,98,37,1,11,86,31,76,21,43,9,88,176,250,93,190,161,149,86,191,125,167,88,73,192,130,213,111,184,41,86,18,176,96,245,91,100,138,149,4,44,88,253,166,214,208,74,171,223,173,82,172,36,96,193,234,247,151,20,43,9,88,176,250,29,33,197,74,2,22,172,126,15,7,93,105,89,234,69,207,77,248,139,155,107,189,216,110,235,69,207,93,24,89,203,187,13,35,107,121,247,97,98,45,147,237,196,90,38,223,137,181,76,198,19,107,153,156,39,214,50,89,79,172,101,242,30,226,170,115,59,38,214,146,112,194,187,33,19,107,73,56,225,221,146,137,181,36,156,240,110,202,200,90,222,93,153,88,75,194,9,239,190,76,172,37,225,132,119,103,38,214,146,112,194,187,55,35,107,121,55,103,98,45,9,39,188,219,51,177,150,132,19,222,13,154,88,75,194,9,239,22,141,172,229,221,163,137,181,36,156,240,238,210,196,90,18,78,120,247,105,98,45,9,39,188,59,53,178,150,119,171,38,214,146,112,194,187,89,19,107,73,56,225,221,174,137,181,36,156,240,110,216,200,90,222,29,155,88,
-75,194,9,239,158,77,172,37,225,132,119,215,38,214,146,112,194,187,111,31,175,181,188,124,239,184,111,255,250,230,221,253,179,205,182,62,235,184,109,3,43,57,119,109,96,37,231,166,141,175,100,241,29,95,201,98,59,190,146,197,117,124,37,139,233,248,74,22,207,241,149,44,150,35,204,60,190,91,227,43,9,88,224,220,171,241,149,4,44,112,238,212,248,74,2,22,56,247,105,96,37,231,54,141,175,36,96,129,115,147,198,87,18,176,192,185,69,227,43,9,88,224,220,160,129,149,156,251,51,190,146,128,5,206,221,25,95,73,192,2,231,222,140,175,36,96,129,115,103,6,86,114,110,204,248,74,2,22,56,183,101,124,37,1,11,156,155,50,190,146,128,5,206,45,25,88,201,185,35,227,43,9,88,224,220,143,241,149,4,44,112,238,198,248,74,2,22,56,247,98,96,37,231,86,140,175,36,96,129,115,35,198,87,18,176,192,185,13,227,43,9,88,224,220,132,143,87,90,150,234,121,243,252,235,155,183,234,207,182,55,244,207,122,222,60,67,107,121,183,97,100,45,239,62,76,172,101,178,157,88,203,228,59,177,150,201,120,98,45,147,243,196,90,38,235,137,181,76,222,67,92,117,110,199,196,90,18,78,120,55,100,98,45,9,39,188,91,50,177,150,132,19,222,77,25,89,203,187,43,19,107,73,56,225,221,151,137,181,36,156,240,238,204,196,90,18,78,120,247,102,100,45,239,230,76,172,37,225,132,119,123,38,214,146,112,194,187,65,19,107,73,56,225,221,162,145,181,188,123,52,177,150,132,19,222,93,154,88,75,194,9,239,62,77,172,37,225,132,119,167,70,214,242,110,213,196,90,18,78,120,55,107,98,45,9,39,188,219,53,177,150,132,19,222,13,27,89,203,187,99,19,107,73,56,225,221,179,137,181,36,156,240,238,218,196,90,18,78,120,247,237,227,181,158,23,123,209,115,225,254,226,127,223,90,236,197,118,99,47,122,46,220,208,90,206,133,27,90,203,185,112,51,107,89,196,103,214,178,136,207,172,101,17,159,89,203,34,62,179,150,69,124,102,45,139,248,24,87,143,47,220,204,90,18,78,56,23,110,102,45,9,39,156,11,55,179,150,132,19,206,133,27,90,203,185,112,51,107,73,56,225,92,184,153,181,36,156,112,46,220,204,90,18,78,56,23,110,104,45,231,194,205,172,37,225,132,115,225,102,214,146,112,194,185,112,51,107,73,56,225,92,184,161,181,156,11,55,179,150,132,19,206,133,155,89,75,194,9,231,194,205,172,37,225,132,115,225,134,214,114,46,220,204,90,18,78,56,23,110,102,45,9,39,156,11,55,179,150,132,19,206,133,27,90,203,185,112,51,107,73,56,225,92,184,153,181,36,156,112,46,220,204,90,18,78,56,23,110,103,173,231,197,126,210,115,225,254,221,205,219,251,79,182,27,251,73,207,133,27,90,203,185,112,67,107,57,23,110,102,45,139,248,204,90,22,241,153,181,44,226,51,107,89,196,103,214,178,136,207,172,101,17,31,227,234,241,133,155,89,75,194,9,231,194,205,172,37,225,132,115,225,102,214,146,112,194,185,112,67,107,57,23,110,102,45,9,39,156,11,55,179,150,132,19,206,133,155,89,75,194,9,231,194,13,173,229,92,184,153,181,36,156,112,46,220,204,90,18,78,56,23,110,102,45,9,39,156,11,55,180,150,115,225,102,214,146,112,194,185,112,51,107,73,56,225,92,184,153,181,36,156,112,46,220,208,90,206,133,155,89,75,194,9,231,194,205,172,37,225,132,115,225,102,214,146,112,194,185,112,67,107,57,23,110,102,45,9,39,156,11,55,179,150,132,19,206,133,155,89,75,194,9,231,194,237,172,245,188,216,87,127,255,199,254,198,189,27,61,248,31,191,253,95,187,229,62,254,244,147,255,249,201,167,119,175,191,185,124,105,251,147,23,47,62,217,58,223,175,107,175,111,224,218,181,215,55,114,237,218,206,88,214,255,191,189,111,107,114,220,70,214,124,238,250,21,28,191,88,117,142,166,220,85,179,79,174,245,137,104,219,29,30,199,105,95,198,238,241,137,137,13,135,130,162,40,21,167,41,82,77,82,170,46,255,250,69,226,66,38,192,4,9,145,128,170,102,119,28,225,46,145,0,50,63,228,141,64,18,0,125,208,182,125,240,212,7,109,219,167,68,125,208,182,125,164,211,7,109,219,231,47,125,208,150,158,23,132,182,244,68,207,190,163,101,4,130,208,14,98,131,122,198,32,8,
-237,32,54,168,103,20,130,208,14,98,131,122,198,193,47,109,61,3,17,132,118,16,27,212,51,20,65,104,7,177,65,61,131,17,132,118,16,27,212,51,28,126,105,235,25,143,32,180,131,216,160,158,17,9,66,59,136,13,234,25,147,32,180,131,216,160,158,81,241,75,91,207,176,4,161,29,196,6,245,12,76,16,218,65,108,80,207,208,4,161,29,196,6,245,12,142,95,218,122,70,39,8,237,32,54,168,103,124,130,208,14,98,131,122,70,40,8,237,32,54,168,103,140,252,210,214,51,72,65,104,7,177,65,61,195,20,132,118,16,27,212,51,80,65,104,7,177,65,61,67,53,147,118,75,124,157,54,143,105,90,44,214,95,198,197,211,234,118,153,151,242,199,67,38,126,144,233,176,175,223,190,255,159,183,111,127,236,24,126,173,8,69,239,126,138,224,219,119,127,253,62,202,138,36,63,214,217,73,251,242,159,172,182,170,159,88,203,166,202,146,150,51,235,162,252,113,55,206,185,109,78,65,96,157,5,8,191,221,69,139,178,138,78,89,146,70,167,180,170,227,107,26,210,169,204,54,139,211,151,39,145,245,130,63,166,104,127,250,241,183,183,191,160,51,37,190,137,235,38,250,237,205,187,191,191,141,154,146,183,39,232,137,228,159,63,114,60,62,120,35,39,66,130,55,114,34,10,120,35,39,28,223,27,57,225,235,222,200,9,247,246,70,78,120,180,55,114,158,205,88,228,153,167,147,235,60,63,107,58,47,235,59,246,8,57,214,64,11,35,156,152,109,69,219,36,90,150,55,56,83,104,217,222,224,76,161,101,123,131,51,133,150,237,13,206,20,90,182,55,56,83,104,217,222,224,76,161,101,123,131,51,133,150,79,91,181,173,152,116,163,213,17,107,82,228,69,253,81,192,8,181,70,127,24,115,98,214,183,84,83,104,217,70,177,19,104,89,71,173,19,104,89,71,169,19,104,89,71,165,19,104,89,71,161,19,104,89,71,157,19,104,89,71,153,19,104,249,180,85,235,91,79,39,90,45,49,102,90,157,23,177,139,243,168,177,6,24,153,32,38,188,200,19,45,238,69,126,104,9,47,242,67,75,120,145,31,90,194,139,252,208,18,94,228,135,150,240,34,63,180,132,23,249,161,229,211,86,133,23,77,165,213,18,99,230,208,121,17,187,56,143,26,107,128,145,9,98,194,139,60,209,226,94,228,135,150,240,34,63,180,132,23,249,161,37,188,200,15,45,225,69,126,104,9,47,242,67,75,120,145,31,90,62,109,85,120,209,84,90,45,49,166,194,206,139,216,197,121,212,88,3,140,76,16,19,94,228,137,22,247,34,63,180,132,23,249,161,37,188,200,15,45,225,69,126,104,9,47,242,67,75,120,145,31,90,194,139,252,208,242,105,171,194,139,166,210,106,137,49,177,119,94,196,46,206,163,198,26,96,100,130,152,240,34,79,180,184,23,249,161,37,188,200,15,45,225,69,126,104,9,47,242,67,75,120,145,31,90,194,139,252,208,18,94,228,135,150,79,91,21,94,52,149,86,75,140,137,170,243,34,118,113,30,53,214,0,35,19,196,132,23,121,162,197,189,200,15,45,225,69,126,104,9,47,242,67,75,120,145,31,90,194,139,252,208,18,94,228,135,150,240,34,63,180,124,218,170,240,162,169,180,90,98,172,123,157,23,177,139,243,168,177,6,24,153,32,38,188,200,19,45,238,69,126,104,9,47,242,67,75,120,145,31,90,194,139,252,208,18,94,228,135,150,240,34,63,180,132,23,249,161,229,211,86,133,23,77,165,213,18,211,222,202,158,253,250,201,120,153,133,95,201,122,162,197,189,200,15,45,225,69,126,104,9,47,242,67,75,120,145,31,90,194,139,252,208,18,94,228,135,150,240,34,63,180,124,218,170,240,162,169,180,186,132,95,83,161,76,119,83,157,153,241,107,42,45,123,200,137,201,76,183,31,90,34,211,237,133,150,204,116,123,161,37,51,221,94,104,201,76,183,23,90,50,211,237,133,150,204,116,123,161,37,51,221,94,104,249,180,85,153,233,158,72,171,37,182,207,138,69,187,62,41,66,11,148,248,223,142,246,155,119,223,176,170,189,117,88,236,94,84,110,187,117,73,24,39,43,91,21,229,170,200,242,51,56,200,22,163,140,150,81,182,43,202,42,43,118,17,171,30,157,226,252,152,214,26,247,248,147,51,219,248,83,159,95,252,201,222,177,248,211,185,29,107,91,140,50,178,118,12,26,66,149,3,87,255,129,171,255,96,83,63,20,
-88,44,224,96,88,83,218,12,45,116,18,197,247,253,234,244,98,28,107,117,122,161,146,170,222,229,159,183,205,67,90,164,121,157,46,214,124,175,105,35,229,187,149,210,37,132,91,63,102,77,242,0,235,15,218,30,127,191,149,253,205,234,168,169,142,105,84,9,97,255,240,253,183,223,190,123,27,1,253,232,151,239,191,251,235,123,44,216,60,45,118,205,195,162,166,211,223,236,166,168,208,113,121,199,175,65,123,191,190,255,229,251,31,191,3,98,251,114,115,204,211,40,222,237,42,44,228,227,30,250,19,55,255,7,158,11,191,247,95,244,126,253,230,61,171,131,85,150,39,199,60,110,4,165,116,7,191,88,5,224,245,245,205,103,247,54,194,75,102,50,171,108,187,74,247,135,230,137,94,254,224,139,83,45,126,51,245,205,236,78,196,212,247,16,37,76,3,217,6,238,231,89,221,56,50,246,220,93,27,146,1,53,26,111,26,3,170,49,16,39,93,141,51,152,120,86,99,0,36,3,106,52,124,61,160,26,3,113,210,213,56,131,137,103,53,6,64,50,160,70,227,93,75,64,53,6,226,164,171,113,6,19,207,106,12,128,100,64,141,70,178,63,160,26,3,113,210,213,56,131,137,103,53,6,64,50,160,70,35,79,22,80,141,129,56,233,106,156,193,196,179,26,3,32,161,160,176,71,112,152,33,14,16,190,204,16,135,115,122,142,33,142,201,248,25,135,56,82,141,254,7,30,54,53,6,226,244,28,67,28,23,53,94,104,136,35,213,232,127,224,97,83,99,32,78,207,49,196,113,81,227,133,134,56,82,141,254,7,30,54,53,6,226,244,28,67,28,23,53,94,104,136,35,213,232,127,224,97,83,99,32,78,207,49,196,113,81,227,133,134,56,44,118,135,121,54,2,225,203,60,27,57,167,231,120,54,154,140,159,241,217,40,213,232,255,137,101,83,99,32,78,207,241,108,116,81,227,133,158,141,82,141,254,159,88,54,53,6,226,244,28,207,70,23,53,94,232,217,40,213,232,255,137,101,83,99,32,78,207,241,108,116,81,227,133,158,141,204,233,195,4,85,32,124,153,160,202,57,61,71,80,53,25,63,99,80,149,106,244,31,234,108,106,12,196,233,57,130,170,139,26,47,20,84,165,26,253,135,58,155,26,3,113,122,142,160,234,162,198,11,5,85,102,45,97,188,17,8,95,198,27,57,167,231,240,70,147,241,51,122,163,84,163,127,31,177,169,49,16,167,231,240,70,23,53,94,200,27,183,57,31,169,26,219,34,60,8,23,8,83,253,10,196,73,87,227,12,38,103,168,209,100,236,185,187,19,212,232,223,71,108,106,12,196,233,57,188,209,69,141,23,242,70,198,38,140,26,129,240,101,212,200,57,61,135,26,77,198,151,86,227,161,42,55,163,43,28,161,210,48,63,168,113,76,154,158,136,77,242,110,11,255,60,242,27,91,237,120,30,171,49,197,14,177,15,209,245,41,234,237,191,189,14,171,222,160,252,198,150,8,60,175,122,67,225,25,82,111,63,115,31,86,189,65,249,141,189,30,121,94,245,134,194,51,164,222,126,242,41,172,122,131,242,27,203,240,61,175,122,67,225,25,82,111,127,26,28,86,189,65,249,141,229,26,158,87,189,161,240,12,169,183,63,146,11,171,222,160,252,198,134,203,207,171,222,80,120,72,64,214,21,151,126,196,237,190,238,210,35,191,231,27,90,77,91,131,25,94,189,161,134,58,238,235,49,131,169,247,146,67,171,105,107,51,195,171,55,212,80,199,125,157,102,48,245,94,114,104,53,109,205,102,120,245,134,26,234,184,175,223,12,166,222,75,14,173,166,173,229,12,175,222,80,67,29,247,117,157,193,212,123,201,161,213,180,53,158,1,213,107,93,233,233,71,220,238,235,61,61,242,123,190,103,239,180,181,159,225,213,27,234,89,232,190,14,52,152,122,47,249,236,157,182,38,52,188,122,67,61,11,221,215,135,6,83,239,37,159,189,211,214,138,134,87,111,168,103,161,251,186,209,96,234,189,228,179,119,218,26,210,128,234,181,174,36,245,35,110,247,245,164,30,249,61,95,112,158,182,182,52,188,122,67,5,75,247,117,166,193,212,123,201,224,60,109,205,105,120,245,134,10,150,238,235,79,131,169,247,146,193,121,218,90,212,128,234,181,174,72,245,35,110,247,117,169,30,249,61,159,247,78,91,163,26,94,189,161,188,201,125,189,106,48,245,94,210,123,167,173,93,13,168,94,235,10,86,63,226,118,95,199,234,145,223,
-216,106,214,112,234,157,182,166,53,188,122,67,121,147,251,250,214,96,234,189,164,247,78,91,235,26,80,189,214,21,175,126,196,237,190,238,213,35,191,231,83,239,180,53,176,158,212,171,254,203,179,117,21,87,79,81,253,49,87,119,229,145,160,12,23,191,41,47,69,133,238,76,223,184,106,22,215,252,128,212,168,69,248,235,223,222,213,236,111,86,162,131,119,127,229,167,157,242,131,92,171,50,129,210,98,7,21,129,68,147,66,157,250,51,147,240,157,164,76,16,190,27,161,124,168,82,86,225,144,229,233,6,32,91,184,100,69,214,16,60,224,246,219,226,148,85,101,1,77,208,249,172,172,32,139,243,236,143,52,106,30,210,40,237,234,68,219,178,138,126,120,243,78,255,180,223,177,217,148,143,197,98,147,230,241,19,44,219,88,66,181,36,229,74,213,206,64,134,142,201,218,171,199,42,62,220,219,136,212,15,205,124,34,89,113,14,145,129,254,76,239,196,116,228,206,112,247,167,132,233,22,167,243,89,101,118,179,83,231,119,105,195,245,184,63,230,77,6,31,164,103,134,197,156,164,137,243,114,23,37,101,209,164,159,154,155,232,234,199,52,221,48,51,2,13,39,101,197,12,171,233,204,41,218,164,135,180,216,164,69,146,165,245,213,34,227,14,114,115,60,128,151,45,25,250,242,152,111,162,53,115,203,45,195,196,203,214,89,177,97,134,7,244,147,35,163,198,104,164,159,210,228,216,48,230,215,216,124,154,42,46,234,69,243,116,72,185,194,146,135,56,43,248,175,34,222,167,252,176,223,158,225,242,38,113,210,104,158,247,38,66,183,17,114,78,26,98,2,224,131,218,89,179,172,210,60,141,235,116,89,149,121,190,142,147,15,17,235,51,119,69,142,236,200,168,108,89,96,193,0,5,217,197,181,5,6,246,83,160,19,49,118,241,177,41,5,63,76,2,119,93,148,234,68,197,189,142,220,251,42,219,237,152,76,65,129,146,90,121,72,171,152,247,18,116,21,131,63,70,235,188,76,62,96,218,241,186,172,12,210,252,22,77,153,23,185,17,150,134,211,105,172,86,138,106,53,182,20,93,21,102,108,42,79,182,239,112,196,173,45,182,74,59,151,223,246,200,12,115,195,75,183,13,255,115,105,4,77,247,43,219,139,90,37,255,55,61,49,106,226,186,107,213,254,98,222,177,201,56,82,184,250,120,76,171,39,218,228,61,98,110,248,233,228,193,57,44,89,147,67,112,5,8,86,140,48,120,29,63,198,60,40,55,123,76,26,224,210,72,71,115,227,182,99,177,162,73,5,63,22,159,196,15,126,179,172,132,105,111,246,153,187,101,243,150,95,84,233,169,252,144,70,64,207,17,198,177,78,43,206,250,16,215,245,227,134,255,100,225,95,8,36,121,72,247,177,244,188,60,63,75,40,64,119,190,252,53,41,29,170,236,84,139,135,135,94,222,201,83,136,238,124,129,1,105,54,184,218,165,245,217,88,33,38,245,20,218,65,245,4,16,184,240,136,125,54,210,172,69,154,13,73,250,230,230,198,205,216,171,20,70,220,236,169,159,126,242,160,223,56,129,33,174,179,76,226,28,198,29,77,188,134,195,253,121,83,71,222,251,142,249,190,227,126,232,238,30,154,169,79,53,13,211,102,243,5,27,218,201,171,249,226,201,246,135,220,61,14,9,213,200,113,208,0,235,244,20,231,139,100,191,233,40,235,147,29,213,6,77,200,196,228,131,127,28,67,12,239,216,239,8,166,38,98,14,165,241,161,216,44,163,242,216,28,142,141,24,161,251,101,25,45,160,78,121,0,173,197,57,155,244,165,112,201,217,69,204,99,96,220,35,175,24,144,52,222,95,235,115,166,36,63,110,210,197,86,143,110,145,62,129,226,117,70,177,105,19,51,197,122,203,42,154,194,127,147,239,82,54,65,69,194,97,224,247,108,30,214,137,167,229,255,203,155,115,133,243,57,27,246,198,66,24,204,56,57,167,207,105,67,96,83,107,54,115,78,171,5,155,13,11,32,173,24,150,172,48,95,213,205,190,17,87,117,182,19,210,193,51,16,132,237,174,15,14,122,143,160,32,125,113,210,251,230,154,227,87,32,34,54,228,141,235,104,207,170,170,104,183,140,24,176,27,142,105,193,0,20,113,115,172,210,107,252,181,144,109,126,172,31,86,224,71,145,249,97,19,166,184,182,180,3,199,111,113,104,224,30,69,249,168,13,166,107,246,212,106,228,55,79,246,245,142,118,61,81,11,207,187,10,24,79,131,54,
-152,50,146,148,27,98,244,248,144,178,169,200,87,95,193,135,79,144,83,180,44,68,84,26,100,241,125,225,200,229,79,95,189,166,88,60,86,155,49,22,255,83,109,102,177,96,35,177,49,22,239,138,221,57,44,240,71,107,126,139,171,12,34,233,130,205,115,197,52,255,20,87,157,133,242,175,242,136,79,209,68,186,97,162,182,104,198,38,231,199,188,25,228,145,152,199,136,244,11,144,229,149,49,255,221,8,255,200,252,10,206,142,98,250,157,27,83,99,46,202,108,19,226,198,2,254,177,5,38,134,105,37,235,117,236,222,22,64,241,139,77,86,243,39,80,29,159,32,125,4,0,244,144,201,102,170,137,254,165,166,34,253,212,172,56,202,69,212,61,138,24,88,54,91,41,18,213,99,252,214,12,0,116,173,58,12,242,43,63,192,20,138,187,174,115,24,146,30,102,45,114,114,55,125,4,98,17,107,83,253,110,226,136,186,23,65,26,28,118,215,15,36,166,203,243,133,209,54,34,25,171,244,136,149,183,97,3,114,178,99,5,176,140,218,201,16,129,69,182,94,177,22,24,13,191,169,113,22,185,84,1,138,151,106,154,97,227,188,85,182,249,196,228,218,249,0,154,22,136,129,142,248,201,135,132,226,39,30,213,113,69,113,71,49,84,213,145,230,169,174,14,229,215,144,82,2,136,159,11,78,55,156,201,13,167,255,121,244,245,155,247,2,178,28,255,125,96,247,191,188,122,245,58,250,51,179,163,58,21,136,174,94,221,178,235,172,128,248,83,95,189,186,99,23,34,137,85,251,237,221,226,152,109,80,170,251,200,196,136,59,124,253,255,92,143,151,204,60,153,85,21,98,138,26,21,213,10,174,255,63,80,245,80,199,255,21,173,96,84,10,73,153,31,247,133,41,134,104,68,203,78,61,18,164,95,78,151,206,215,223,191,96,55,7,12,216,187,82,129,114,38,70,118,47,187,223,47,95,243,106,162,179,73,243,38,142,22,208,201,14,225,95,216,192,72,239,65,164,119,1,42,48,202,248,70,116,125,245,234,149,118,163,237,228,183,111,223,189,127,195,74,122,95,199,20,253,129,113,154,232,14,7,243,121,29,197,135,67,158,165,155,27,237,195,152,85,249,207,52,105,120,21,54,118,57,174,235,52,103,215,24,163,135,62,68,3,61,144,8,102,245,130,225,238,73,92,130,103,197,26,88,27,118,113,221,34,135,203,22,55,92,232,160,25,195,30,224,118,70,15,144,217,128,177,21,102,42,237,225,198,135,133,12,202,146,149,220,189,52,115,112,81,254,221,75,208,254,160,182,239,102,170,91,118,180,135,80,187,168,70,192,176,0,149,167,219,166,231,49,239,224,91,181,117,147,30,196,140,21,234,64,14,45,173,162,127,150,89,193,172,58,85,252,121,244,203,138,66,22,69,139,124,89,93,71,229,73,190,112,228,45,179,130,39,223,178,77,26,45,24,218,235,207,186,94,192,156,89,188,169,94,36,76,13,69,35,94,239,145,115,43,89,177,39,55,224,195,226,101,204,67,170,122,239,205,152,49,98,219,140,225,16,47,57,5,121,45,219,115,128,119,221,232,177,210,205,179,186,12,108,212,189,107,224,190,204,140,78,79,53,0,56,65,201,120,54,188,225,55,163,53,44,229,16,111,117,185,1,114,210,55,156,106,180,56,148,117,157,173,243,167,54,1,184,129,218,85,122,200,217,244,92,138,22,158,11,202,36,180,198,98,110,89,119,51,185,226,184,95,203,254,150,213,134,253,106,223,230,167,90,206,83,60,94,206,232,120,149,109,120,207,151,208,148,22,129,160,105,136,224,239,252,102,151,255,168,213,180,183,47,11,98,2,156,228,105,92,173,248,51,114,65,65,52,118,88,0,10,212,196,128,242,13,148,136,7,174,182,42,33,219,44,162,65,65,92,163,240,173,173,10,200,54,164,37,114,22,53,16,150,189,196,11,165,198,217,57,12,211,230,65,49,165,204,34,75,58,110,12,107,90,235,162,177,33,106,113,51,218,86,229,190,19,120,63,185,113,204,155,95,211,102,209,172,115,57,100,107,154,74,242,61,72,174,121,90,168,17,95,156,139,183,36,81,154,228,177,26,217,65,180,5,92,124,155,171,158,25,131,22,204,20,184,217,25,248,126,102,254,21,87,144,48,23,175,105,4,22,200,25,142,2,69,9,41,14,23,93,3,104,116,9,208,209,62,48,142,191,187,6,125,112,143,130,215,110,4,250,170,124,92,9,206,47,21,187,122,2,255,110,233,129,240,193,
-51,251,192,67,23,143,15,60,88,195,186,162,77,186,141,161,244,155,95,127,131,210,125,76,117,52,253,116,40,153,211,136,80,129,94,97,108,213,219,11,128,156,30,212,123,141,164,253,253,145,61,212,196,175,226,152,231,149,186,125,73,85,75,236,160,241,179,197,244,205,79,63,255,35,250,254,199,247,63,201,55,91,76,52,255,114,146,25,51,36,220,3,47,18,234,7,64,22,81,170,116,243,158,203,40,234,210,251,4,24,85,119,4,142,170,166,194,95,212,103,218,124,195,35,242,162,146,161,12,197,90,20,128,159,14,105,119,181,201,118,89,83,27,1,209,124,235,69,160,20,177,95,173,39,52,129,84,229,225,91,187,4,250,175,28,160,193,176,28,160,134,155,16,76,222,53,99,94,137,71,157,35,235,154,226,221,176,255,11,131,127,205,1,96,206,43,120,203,200,198,45,187,42,222,164,171,146,205,25,94,223,254,175,133,28,127,234,7,39,252,253,231,239,218,22,29,175,111,57,175,7,180,56,163,29,116,178,97,223,19,187,98,186,236,22,91,66,205,159,4,151,72,114,213,214,3,240,183,247,52,40,180,218,68,14,124,12,116,168,49,26,242,200,245,0,24,225,38,173,147,42,91,11,128,219,9,248,78,89,250,56,128,239,52,136,15,26,147,248,160,96,2,54,50,216,253,53,141,55,139,250,75,225,239,53,68,181,122,213,106,181,231,43,50,188,60,176,70,134,41,189,229,37,204,144,101,88,89,176,167,17,31,86,95,195,24,93,144,143,106,202,174,5,205,95,120,179,179,145,144,143,204,185,88,190,121,56,22,31,206,134,146,64,43,27,18,94,168,198,243,40,242,122,132,182,100,228,183,140,166,26,10,191,4,184,63,169,181,179,139,1,36,237,2,91,26,141,100,15,83,124,158,53,252,2,175,104,134,197,161,89,74,34,136,183,91,158,13,248,165,124,172,187,1,59,147,11,155,6,25,62,199,103,165,178,58,140,45,204,56,41,128,138,23,162,98,214,8,19,125,217,32,130,6,224,132,248,181,37,95,180,74,205,210,202,195,211,10,198,250,139,72,44,210,140,174,94,117,35,138,246,87,221,254,42,234,222,82,19,214,5,88,72,160,212,205,127,195,122,228,84,154,193,58,173,27,161,252,133,62,94,208,250,155,237,173,35,133,239,247,210,12,196,64,129,79,77,214,74,217,34,31,4,125,189,122,181,203,78,41,155,60,29,15,114,113,13,67,13,170,44,171,58,90,176,223,95,64,135,174,213,78,147,118,165,2,79,219,44,62,241,140,212,29,74,166,223,253,110,30,245,206,107,246,133,40,160,203,231,47,61,3,219,162,149,122,209,245,144,28,214,89,113,174,44,212,66,37,214,75,206,71,91,99,243,71,90,149,171,178,90,149,69,106,100,23,111,33,171,164,47,130,64,149,59,150,217,22,218,241,61,8,113,86,212,204,149,152,177,67,214,163,80,11,35,218,247,228,89,125,19,125,95,36,144,202,97,22,185,47,217,120,170,138,179,218,88,48,146,178,65,171,106,83,100,57,160,205,138,60,43,208,147,14,86,20,212,199,181,6,126,141,161,47,163,221,1,231,202,118,106,236,42,46,139,114,197,40,171,163,221,187,102,247,87,175,22,187,101,186,124,96,183,191,138,118,85,121,60,0,31,254,99,177,59,92,179,242,61,148,192,206,165,155,125,252,105,241,0,183,146,215,112,143,13,218,146,155,172,102,116,23,123,113,247,182,189,93,148,205,34,121,205,239,118,55,255,107,177,95,222,114,247,230,247,187,2,166,23,86,251,118,153,220,114,134,117,91,192,12,4,104,71,112,115,7,119,193,98,254,115,241,217,221,237,235,215,175,255,132,164,241,37,171,95,109,178,34,206,179,230,137,61,128,75,177,80,43,90,124,182,140,246,181,160,186,187,237,40,176,171,101,244,217,127,221,94,127,6,101,32,93,185,8,136,193,130,22,59,142,68,234,4,241,1,10,235,251,43,72,133,245,85,130,172,140,245,127,117,44,178,143,199,78,79,42,109,153,161,81,120,87,45,234,236,139,69,209,228,67,148,109,101,214,35,203,163,154,153,56,12,36,226,38,90,71,155,50,173,139,207,155,232,33,62,165,145,108,204,107,137,164,212,103,17,130,161,18,113,85,189,80,78,198,231,50,228,207,107,188,246,231,231,236,144,126,35,150,93,162,97,83,75,79,102,200,106,125,175,70,199,78,228,202,112,122,178,218,253,146,38,236,217,180,232,237,17,106,139,208,58,35,240,162,
-166,100,56,30,212,46,146,56,207,97,241,15,90,98,210,39,29,171,153,169,47,22,93,80,252,152,175,212,10,39,214,233,78,104,221,34,45,92,131,92,50,35,34,20,15,207,230,162,41,125,123,157,40,100,108,162,5,95,121,174,173,28,226,171,100,248,13,216,179,193,46,247,7,54,25,133,223,48,199,237,118,148,71,121,92,55,176,36,211,172,27,125,36,42,103,27,53,153,101,246,137,44,1,122,165,240,24,145,23,246,7,170,7,47,239,25,60,115,19,216,171,213,246,96,9,253,206,152,116,5,195,154,63,132,128,21,95,187,117,212,122,189,89,175,160,175,208,107,66,186,170,212,192,160,164,171,248,243,58,82,196,176,66,44,97,19,206,42,43,181,189,178,176,51,0,140,69,237,21,128,19,123,145,181,48,78,170,138,193,76,230,34,85,41,115,192,250,65,49,53,150,250,201,14,179,129,96,127,115,199,55,239,222,179,26,239,69,13,148,96,231,155,153,248,184,68,109,72,99,148,96,171,77,61,68,124,217,204,99,33,134,5,194,26,197,189,134,98,187,57,238,15,171,36,102,161,137,5,18,177,227,167,51,202,164,60,22,13,58,117,171,147,101,219,10,205,105,217,61,153,53,47,26,184,35,71,177,2,22,175,220,99,204,226,202,10,44,6,162,88,149,62,86,89,147,58,179,111,219,18,16,218,120,21,73,170,220,46,51,230,77,73,191,247,124,145,33,3,112,245,74,236,142,234,82,63,236,97,150,127,64,128,174,94,29,18,237,178,121,96,99,179,141,214,130,177,248,80,35,15,100,15,155,186,254,225,107,237,206,105,111,220,0,42,122,35,142,90,191,181,207,138,109,222,232,183,226,127,154,183,138,83,82,63,106,119,248,234,104,226,97,208,117,158,144,32,191,111,145,90,12,235,215,255,72,23,12,16,27,57,200,76,15,11,65,44,210,244,77,22,2,141,108,112,239,72,129,47,157,32,214,234,206,33,37,114,130,129,104,138,151,195,131,196,201,183,77,237,235,192,78,206,253,119,63,53,27,214,199,59,97,160,114,73,137,102,130,124,101,9,190,35,23,152,104,149,158,14,122,157,125,185,209,111,176,121,12,31,88,25,148,90,7,148,182,196,230,24,251,199,108,211,60,232,94,194,57,214,124,103,0,170,252,144,198,7,253,6,11,172,134,81,31,224,94,247,128,98,119,216,156,160,98,116,245,106,98,160,100,125,144,9,17,245,30,31,177,246,104,22,149,34,230,69,60,65,15,129,145,146,115,59,175,249,183,192,253,11,92,188,228,230,11,175,224,232,132,74,166,22,134,21,129,95,115,254,91,39,225,117,98,13,65,35,111,224,255,173,156,11,40,71,244,4,39,62,196,116,157,231,244,155,167,133,204,238,68,95,246,182,135,201,26,230,184,151,13,21,213,108,179,42,31,229,203,129,6,150,164,104,11,121,88,199,116,70,107,156,64,194,203,118,34,188,110,103,144,49,60,3,105,214,245,141,177,243,98,128,55,123,30,243,206,94,195,90,147,122,141,207,116,225,5,157,38,126,246,5,136,143,105,217,12,122,165,182,71,130,233,107,107,172,174,94,25,19,188,171,87,155,116,155,21,105,127,222,118,245,202,28,119,51,163,203,12,119,56,228,177,110,249,123,181,132,75,90,120,183,55,175,221,114,162,155,160,137,185,235,253,79,107,200,119,161,193,58,63,137,67,212,178,244,58,207,107,170,207,244,36,22,238,151,7,226,54,155,189,31,249,46,68,61,20,64,90,179,70,39,32,178,129,249,167,52,49,6,204,144,155,214,110,37,135,99,94,26,131,241,172,124,140,51,52,162,183,139,132,117,104,84,32,172,14,41,14,126,102,208,194,66,154,23,34,63,234,10,248,30,40,212,236,111,239,126,250,78,220,188,183,214,134,9,135,88,205,79,52,123,15,133,15,101,190,33,218,203,173,86,6,59,121,247,30,103,137,159,234,125,89,0,254,35,159,18,54,241,14,231,19,12,171,230,10,39,108,58,133,196,69,172,102,115,168,224,80,149,59,96,143,95,176,139,156,129,246,130,94,49,21,73,78,195,63,80,106,234,31,191,254,240,211,143,28,235,125,175,11,135,152,129,93,0,41,56,250,198,104,195,11,239,237,77,52,17,187,53,129,185,15,221,196,108,3,214,187,183,66,19,165,247,3,141,8,112,227,141,8,120,170,145,217,10,220,213,134,14,202,238,173,13,8,100,195,13,8,84,162,193,149,246,230,166,74,97,21,39,207,156,177,192,172,162,142,48,
-201,109,190,201,176,219,67,150,23,27,83,86,28,40,219,129,53,23,146,236,61,201,76,44,211,91,144,45,68,153,182,79,158,61,159,96,164,176,136,78,112,72,83,36,150,253,69,170,237,15,255,253,246,31,80,124,31,245,158,168,162,21,250,204,88,187,254,26,162,159,70,129,221,229,68,104,182,76,91,83,217,194,39,56,166,178,149,11,33,166,176,5,125,77,101,203,55,20,78,99,11,118,51,149,173,24,105,76,98,171,173,173,63,147,45,240,155,200,150,115,154,200,118,155,79,214,45,28,160,56,149,237,102,157,79,101,11,7,251,77,101,203,198,147,83,217,138,183,110,231,50,174,74,216,234,188,250,84,86,43,78,237,129,111,134,143,138,117,187,130,234,36,40,19,168,140,182,247,61,124,125,226,221,144,10,179,88,27,111,74,59,207,212,58,112,204,63,172,122,60,187,189,8,31,243,155,77,10,75,66,143,197,70,198,64,190,176,95,132,66,248,211,198,81,118,177,106,235,154,137,127,184,7,111,216,209,118,244,19,172,121,40,88,188,101,131,136,90,156,27,119,16,175,5,32,61,143,186,221,7,209,126,185,17,65,105,195,172,6,8,54,58,250,3,165,201,69,151,137,92,44,32,133,207,97,25,95,229,6,56,227,48,24,216,12,78,161,56,45,54,203,154,47,11,169,228,218,187,104,157,62,168,29,95,155,18,22,143,48,80,209,255,142,94,195,18,133,45,188,171,150,37,215,125,241,81,162,179,32,86,21,122,98,188,24,118,125,10,44,222,110,172,24,200,180,130,51,93,162,90,157,134,32,4,159,126,144,253,248,160,30,89,120,247,134,52,202,59,131,10,122,123,11,155,77,192,134,20,120,134,58,142,140,234,159,13,185,4,63,70,178,82,143,105,248,211,77,25,30,154,75,186,4,255,226,86,7,165,27,2,104,128,46,225,18,92,38,180,129,225,207,109,2,156,151,225,18,66,116,3,46,1,21,122,98,124,121,46,193,5,63,236,18,210,40,71,92,2,108,104,178,75,72,241,73,230,218,66,102,118,113,73,151,16,83,135,22,74,247,16,212,0,93,194,37,184,76,104,3,195,107,231,0,206,203,112,9,33,186,1,151,224,169,23,83,140,47,207,37,196,198,157,65,151,144,70,57,226,18,89,49,195,37,248,8,176,194,3,254,150,59,187,184,164,75,136,145,98,11,165,27,216,106,128,46,225,18,92,38,180,129,225,189,117,0,231,101,184,132,16,221,128,75,64,133,158,24,95,158,75,112,193,15,187,132,52,202,17,151,0,27,154,236,18,252,165,123,165,102,252,240,167,229,206,46,46,233,18,34,227,212,66,233,178,9,26,160,75,184,4,151,9,109,96,88,59,0,231,101,184,132,16,221,128,75,104,199,100,41,49,190,60,151,224,130,31,118,9,105,148,35,46,1,54,52,217,37,182,57,23,159,204,207,192,159,150,59,187,8,97,125,86,159,224,95,202,232,176,116,201,31,13,209,37,124,66,10,69,216,20,254,246,10,0,24,103,188,205,203,184,225,223,49,40,65,169,167,249,182,68,58,130,146,23,50,125,184,213,147,214,115,0,6,180,251,122,213,84,199,34,65,18,21,59,90,76,137,242,90,6,64,126,175,221,207,21,4,159,102,129,155,117,14,0,101,194,16,254,160,5,159,249,69,253,128,127,82,164,195,210,101,35,53,68,151,240,3,41,20,97,96,248,43,38,0,224,197,248,129,146,23,242,3,184,213,147,214,75,240,3,41,81,225,7,166,68,159,201,15,226,252,240,16,47,152,45,9,116,172,90,19,195,79,3,33,156,194,92,55,43,94,123,197,126,105,91,108,114,126,206,166,88,106,2,203,188,235,166,42,139,114,255,20,241,234,237,54,149,47,97,65,56,227,43,86,72,84,241,38,59,214,130,161,60,188,3,58,39,79,18,134,13,173,89,17,171,175,75,24,38,208,129,70,54,128,161,247,237,128,117,0,204,128,232,0,28,92,149,57,119,98,16,13,18,33,254,218,18,137,166,19,167,118,10,213,116,52,124,200,193,220,0,44,13,22,144,226,77,212,189,236,57,124,168,232,174,56,238,87,144,50,214,71,20,204,172,214,141,216,17,38,246,154,240,51,86,78,105,197,12,240,17,141,207,134,248,161,77,219,52,107,8,94,36,107,86,176,224,190,60,202,95,189,161,144,16,208,155,126,163,223,68,170,62,110,60,8,192,5,128,41,8,59,150,25,18,33,85,98,108,163,239,169,129,149,251,180,0,251,174,125,154,115,32,
-3,16,47,235,93,12,192,67,255,93,0,56,25,192,92,137,24,211,142,135,198,22,3,180,215,5,173,11,64,142,188,199,21,170,186,89,128,133,159,209,243,62,107,232,48,201,26,58,12,139,70,220,53,32,33,12,199,0,253,221,4,142,1,211,5,224,2,128,50,1,26,203,12,137,144,42,33,98,128,254,194,72,249,128,31,11,24,142,1,125,206,129,12,192,26,3,122,66,247,208,127,23,0,78,6,48,87,34,198,74,222,194,26,3,180,247,35,173,11,100,5,193,21,170,186,89,128,133,159,209,243,62,107,232,48,201,26,58,204,7,202,206,26,144,16,134,99,128,254,50,6,199,128,233,2,112,1,64,153,0,141,101,134,68,72,149,16,49,64,83,67,235,3,126,44,96,56,6,244,57,7,50,0,107,12,232,9,221,67,255,93,0,56,25,192,92,137,232,26,121,172,54,182,24,160,189,16,106,93,224,17,239,128,86,92,249,138,33,39,11,176,240,51,122,222,103,13,29,38,89,67,135,249,113,31,206,26,144,16,134,99,128,254,246,9,199,128,233,2,112,1,64,153,0,141,101,134,68,72,149,16,49,64,83,67,235,3,126,44,96,56,6,244,57,7,50,0,107,12,232,9,221,67,255,93,0,56,25,192,92,137,232,26,201,139,157,45,6,104,111,192,90,23,200,241,23,108,20,87,168,234,102,1,22,126,70,207,251,172,161,195,36,107,232,48,44,239,118,215,128,132,48,28,3,244,215,109,56,6,76,23,128,11,0,202,4,104,44,51,36,66,170,132,136,1,154,26,90,31,240,99,1,195,49,160,207,57,144,1,88,99,64,79,232,30,250,239,2,192,201,0,230,74,68,215,72,187,113,70,121,38,48,110,111,26,142,184,106,11,240,39,202,5,227,182,200,212,121,143,131,41,114,27,55,184,79,113,76,76,142,14,125,85,210,215,192,244,151,204,119,219,136,250,62,119,110,231,135,89,146,118,55,196,222,167,52,250,184,228,41,151,132,42,184,185,205,87,60,17,97,108,204,60,244,212,25,199,18,142,98,89,53,127,156,135,169,249,195,51,170,246,194,65,70,237,173,49,73,181,77,189,249,10,196,171,49,99,157,100,47,195,44,207,241,21,223,22,228,142,204,52,165,51,81,206,180,41,59,78,124,126,147,187,28,131,91,25,71,187,137,159,160,13,126,246,200,91,230,147,71,222,238,155,147,44,48,221,203,160,108,118,157,230,194,123,218,227,148,232,156,206,240,32,4,162,255,172,145,133,212,147,230,140,206,14,177,34,245,109,103,235,171,247,38,30,249,108,233,137,92,68,138,25,138,37,158,41,52,147,153,61,115,228,111,6,128,113,44,148,207,79,70,35,127,142,74,68,222,24,148,138,106,228,197,234,181,167,6,105,126,103,91,194,16,43,119,171,247,105,27,174,136,200,167,132,27,186,89,214,98,195,167,88,187,75,205,187,253,180,251,21,197,1,187,252,81,179,232,44,87,91,23,33,171,244,184,170,175,203,138,239,37,212,237,97,189,157,233,144,108,196,147,18,143,179,40,110,196,179,207,198,15,15,110,76,79,109,140,231,92,67,60,228,200,87,188,236,46,169,201,198,250,100,105,44,143,149,1,242,52,218,54,118,55,68,224,158,10,214,8,8,141,37,26,56,144,111,79,122,229,241,79,236,190,4,200,88,139,252,115,60,119,43,56,168,209,52,210,38,149,103,93,247,223,145,126,204,215,121,185,70,34,144,119,76,41,200,219,196,11,66,81,64,189,13,236,104,247,197,33,11,41,137,156,193,10,203,69,1,39,68,35,139,72,233,168,102,157,128,180,125,197,156,56,254,4,205,230,86,102,48,110,205,48,215,110,49,238,189,110,54,225,176,110,2,111,162,135,77,149,13,37,89,122,231,248,156,9,79,59,13,153,122,57,12,42,50,150,139,205,64,171,171,233,184,22,13,196,217,239,203,238,168,119,227,44,218,247,191,180,85,223,199,89,126,239,74,70,158,114,57,72,208,4,181,47,139,230,1,45,78,151,131,157,254,162,116,237,172,117,173,17,101,83,76,225,124,29,186,94,211,89,82,230,146,121,43,42,109,143,161,222,106,8,150,81,213,229,153,69,11,203,178,27,216,46,44,98,19,240,121,130,210,157,179,47,40,135,253,201,227,251,146,253,10,201,178,63,212,89,72,176,4,195,175,144,92,118,172,142,238,84,245,43,36,203,142,65,103,33,65,125,191,66,114,216,195,56,190,119,209,175,144,44,123,200,156,133,4,47,241,252,10,201,
-97,87,219,248,110,54,191,66,178,236,42,114,22,18,188,229,240,43,36,135,125,78,227,251,155,230,8,137,31,244,180,104,71,39,228,231,148,197,57,135,218,201,107,188,25,121,78,123,145,126,106,34,94,172,29,110,249,192,30,177,31,22,189,115,130,181,177,15,175,131,230,190,101,81,151,121,214,29,228,11,223,18,132,5,223,242,192,114,248,174,104,156,231,242,176,198,58,58,214,252,252,121,78,133,253,194,236,171,20,206,15,27,228,206,171,76,103,14,205,51,190,215,12,62,120,184,137,234,188,108,180,131,236,78,113,114,60,238,135,49,136,58,8,196,67,89,138,207,93,196,135,67,85,198,201,3,232,58,177,64,211,15,221,134,111,84,241,19,105,6,57,182,213,140,79,89,241,211,217,179,98,147,37,105,221,126,117,73,126,16,69,29,92,218,125,125,54,205,143,155,84,255,152,129,188,137,170,165,135,44,47,119,71,163,158,186,235,48,208,105,179,59,231,13,118,70,167,231,231,248,142,45,243,212,109,20,37,102,237,38,162,59,11,38,19,6,199,54,61,233,136,223,168,88,144,161,20,183,45,1,132,147,219,103,163,209,82,241,96,176,29,148,126,186,65,206,82,109,105,118,53,87,141,207,207,177,51,67,78,63,45,228,80,249,168,190,227,130,231,243,108,34,192,43,233,43,204,209,247,83,197,92,162,142,98,56,244,63,226,117,97,166,69,30,222,42,185,161,228,215,17,127,59,70,95,222,14,167,165,122,96,110,239,167,182,174,184,101,165,173,162,13,211,79,125,9,47,238,231,12,230,246,126,106,107,39,91,86,218,74,193,48,253,212,151,41,226,126,206,96,174,166,240,236,153,82,47,78,221,151,54,180,46,202,114,146,135,44,163,58,212,145,237,78,108,36,103,249,162,47,142,92,212,127,189,221,47,114,131,171,237,147,149,248,80,46,216,240,90,28,247,150,189,30,242,235,100,98,137,7,236,232,118,221,246,129,55,162,104,251,131,173,152,250,199,110,197,77,32,112,8,25,223,31,231,34,39,216,16,121,25,57,137,189,131,103,201,41,16,184,118,27,193,136,61,225,19,173,176,202,250,251,6,250,80,28,183,16,224,77,13,238,246,164,157,89,101,216,147,71,112,8,217,160,61,97,57,97,149,133,149,147,131,61,153,114,10,4,174,93,146,62,98,79,120,118,136,85,214,95,131,222,135,226,184,28,29,47,144,119,183,39,237,192,39,195,158,60,130,67,200,6,237,9,203,9,171,44,172,156,28,236,201,148,83,32,112,237,242,230,17,123,194,103,41,97,149,245,215,51,247,161,56,46,109,198,139,173,221,237,73,59,45,201,176,39,143,224,16,178,65,123,194,114,194,42,11,43,39,7,123,50,229,20,8,92,187,84,118,196,158,240,220,23,171,172,191,54,182,15,197,113,153,44,94,184,235,110,79,218,81,67,134,61,121,4,135,144,13,218,19,150,19,86,89,88,57,57,216,147,41,167,64,224,240,200,174,73,221,198,153,112,94,235,101,198,153,242,16,220,115,198,153,129,192,181,200,212,123,210,147,229,244,96,56,124,138,96,172,177,59,251,168,0,141,41,19,200,157,20,198,157,69,59,0,130,22,128,137,99,134,142,16,40,165,136,33,165,248,20,204,8,12,74,66,67,176,130,136,10,217,178,56,105,215,193,179,224,216,215,203,120,150,60,75,247,28,207,10,4,142,80,36,31,171,247,4,51,98,64,188,209,12,207,18,74,26,242,44,5,98,216,92,20,14,127,158,5,186,26,82,138,79,193,140,192,112,245,172,160,162,66,182,44,150,176,56,120,22,156,30,123,25,207,146,71,242,158,227,89,129,192,17,138,164,5,51,98,64,188,209,12,207,18,74,26,242,44,5,98,216,92,20,14,127,158,197,191,109,59,160,20,159,130,25,129,225,234,89,65,69,133,108,89,156,251,235,224,89,112,8,237,101,60,75,158,236,123,142,103,5,2,71,40,146,207,223,122,130,25,49,32,222,104,134,103,9,37,13,121,150,2,49,108,46,10,135,63,207,2,93,13,41,197,167,96,70,96,184,122,86,80,81,33,91,22,111,133,29,60,11,206,178,189,140,103,201,3,130,207,241,172,64,224,8,69,242,153,108,79,48,35,6,196,27,205,240,44,161,164,33,207,82,32,134,205,69,225,240,231,89,160,171,33,165,248,20,204,8,12,87,207,10,42,42,252,46,97,40,131,129,223,108,224,36,65,216,55,27,14,25,12,243,205,70,32,112,45,50,51,131,97,10,134,
-27,80,159,177,57,29,62,239,160,179,177,12,6,5,130,22,128,109,90,62,65,71,3,25,12,74,41,62,5,51,2,195,230,89,54,88,65,68,133,108,121,48,131,97,126,45,232,50,158,229,144,193,48,165,21,8,28,161,72,145,193,48,5,51,98,64,106,58,60,213,179,232,12,6,5,98,216,92,204,105,249,124,207,194,25,12,74,41,62,5,51,2,195,213,179,130,138,10,217,242,96,6,3,235,14,39,9,194,122,150,67,6,195,148,86,32,112,132,34,105,193,140,24,144,154,14,79,245,44,58,131,65,129,24,54,23,115,90,62,223,179,112,6,131,82,138,79,193,140,192,112,245,172,160,162,66,182,60,152,193,192,186,195,73,130,176,158,229,144,193,48,165,21,8,28,161,72,145,193,48,5,51,98,64,106,58,60,213,179,232,12,6,5,98,216,92,204,105,249,124,207,194,25,12,74,41,62,5,51,2,195,213,179,130,138,10,217,242,96,6,3,235,14,39,9,194,122,150,67,6,195,148,86,32,112,132,34,69,6,195,20,204,136,1,169,233,240,84,207,162,51,24,20,136,97,115,49,167,229,243,61,11,103,48,40,165,248,20,204,8,12,87,207,10,42,42,188,122,109,40,131,129,215,210,225,36,65,216,181,116,14,25,12,115,45,93,32,112,45,50,51,131,97,10,134,27,80,159,177,57,29,62,239,152,230,177,12,6,5,130,22,128,109,90,62,65,71,3,25,12,74,41,62,5,51,2,195,230,89,54,88,65,68,133,108,121,48,131,129,117,135,147,4,97,61,203,33,131,97,74,43,16,56,66,145,34,131,97,10,102,196,128,212,116,120,170,103,209,25,12,10,196,176,185,152,211,242,249,158,133,51,24,148,82,124,10,102,4,134,171,103,5,21,21,178,229,193,12,134,249,217,228,203,120,150,67,6,195,148,86,32,112,132,34,105,193,140,24,144,154,14,79,245,44,58,131,65,129,24,54,23,115,90,62,223,179,112,6,131,82,138,79,193,140,192,112,245,172,160,162,66,182,60,152,193,192,186,195,73,130,176,158,229,144,193,48,165,21,8,28,161,72,145,193,48,5,51,98,64,106,58,60,213,179,232,12,6,5,98,216,92,204,105,249,124,207,194,25,12,74,41,62,5,51,2,195,213,179,130,138,10,217,242,96,6,3,235,14,39,9,194,122,150,67,6,195,148,86,32,112,132,34,69,6,195,20,204,136,1,169,233,240,84,207,162,51,24,20,136,97,115,49,167,229,243,61,11,103,48,40,165,248,20,204,8,12,87,207,10,42,42,188,95,106,40,131,129,119,111,225,36,65,216,221,91,14,25,12,115,247,86,32,112,45,50,51,131,97,10,134,27,80,159,177,57,29,62,239,35,51,99,25,12,10,4,45,0,219,180,124,130,142,6,50,24,148,82,124,10,102,4,134,205,179,108,176,130,136,10,217,242,96,6,3,235,14,39,9,194,122,150,67,6,195,148,86,32,112,132,34,69,6,195,20,204,136,1,169,233,240,84,207,162,51,24,20,136,97,115,49,167,229,243,61,11,103,48,40,165,248,20,204,8,12,87,207,10,42,42,100,203,131,25,12,172,59,156,36,8,235,89,14,25,12,83,90,129,192,17,138,164,5,51,98,64,106,58,60,213,179,232,12,6,5,98,216,92,204,105,249,124,207,194,25,12,74,41,62,5,51,2,195,213,179,130,138,10,217,242,96,6,3,235,14,39,9,194,122,150,67,6,195,148,86,32,112,132,34,69,6,195,20,204,136,1,169,233,240,84,207,162,51,24,20,136,97,115,49,167,229,243,61,11,103,48,40,165,248,20,204,8,12,87,207,10,42,42,100,203,131,25,12,172,59,156,36,8,235,89,14,25,12,83,90,129,192,17,138,20,25,12,83,48,35,6,164,166,195,83,61,139,206,96,80,32,134,205,197,156,150,207,247,44,156,193,160,148,226,83,48,35,48,92,61,43,168,168,240,9,29,67,25,12,124,94,8,78,18,132,61,47,196,33,131,97,158,23,18,8,92,139,204,204,96,152,130,225,6,212,103,108,78,135,207,251,68,230,88,6,131,2,65,11,192,54,45,159,160,163,129,12,6,165,20,159,130,25,129,97,243,44,27,172,32,162,66,182,60,152,193,208,78,235,125,184,212,137,69,14,25,12,83,90,129,192,17,138,20,25,12,83,48,35,6,164,166,195,83,61,139,206,96,80,32,134,205,197,156,150,207,247,44,156,193,160,148,226,83,48,35,48,92,61,43,168,168,144,45,15,102,48,176,238,112,
-146,32,172,103,57,100,48,76,105,5,2,71,40,146,22,204,136,1,169,233,240,84,207,162,51,24,20,136,97,115,49,167,229,243,61,11,103,48,40,165,248,20,204,8,12,87,207,10,42,42,100,203,131,25,12,172,59,156,36,8,235,89,14,25,12,83,90,129,192,17,138,20,25,12,83,48,35,6,164,166,195,83,61,139,206,96,80,32,134,205,197,156,150,207,247,44,156,193,160,148,226,83,48,35,48,92,61,43,168,168,144,45,15,102,48,176,238,112,146,32,172,103,57,100,48,76,105,5,2,71,40,82,100,48,76,193,140,24,144,154,14,79,245,44,58,131,65,129,24,54,23,115,90,62,223,179,112,6,131,82,138,79,193,140,192,112,245,172,160,162,226,0,183,249,232,46,18,86,133,204,96,192,253,49,227,101,117,206,209,154,68,227,152,193,128,195,99,109,25,12,143,224,90,100,102,6,195,20,12,55,160,62,99,115,58,204,106,56,122,86,143,41,97,55,20,8,90,0,182,105,249,4,29,13,100,48,40,165,248,20,204,8,12,155,103,217,96,5,17,21,178,229,193,12,6,214,29,78,18,132,245,44,135,12,134,41,173,64,224,8,69,138,12,134,41,152,17,3,82,211,225,169,158,69,103,48,40,16,195,230,98,78,203,231,123,22,206,96,80,74,241,41,152,17,24,174,158,21,84,84,200,150,7,51,24,88,119,56,73,16,214,179,28,50,24,166,180,2,129,35,20,73,11,102,196,128,212,116,120,170,103,209,25,12,10,196,176,185,152,211,242,249,158,133,51,24,148,82,124,10,102,4,134,171,103,5,21,21,178,229,193,12,6,214,29,78,18,132,245,44,135,12,134,41,173,64,224,8,69,138,12,134,41,152,17,3,82,211,225,169,158,69,103,48,40,16,195,230,98,78,203,231,123,22,206,96,80,74,241,41,152,17,24,174,158,21,84,84,200,150,7,51,24,88,119,56,73,16,214,179,28,50,24,166,180,2,129,35,20,41,50,24,166,96,70,12,72,77,135,167,122,22,157,193,160,64,12,155,139,57,45,159,239,89,56,131,65,41,197,167,96,70,96,184,122,86,80,81,137,79,149,174,243,177,12,6,171,66,102,48,224,254,152,241,178,58,231,104,77,162,113,204,96,192,103,93,108,25,12,143,224,90,100,102,6,195,20,12,55,160,62,227,222,116,120,157,59,122,86,143,41,97,55,20,8,90,0,182,105,249,4,29,13,100,48,40,165,248,20,204,8,12,155,103,217,96,5,17,21,178,229,193,12,6,214,29,78,18,132,245,44,135,12,134,41,173,64,224,8,69,138,12,134,41,152,17,3,106,167,195,19,61,139,206,96,80,32,134,205,197,156,150,207,247,44,156,193,160,148,226,83,48,35,48,92,61,43,168,168,144,45,15,102,48,176,238,112,146,32,172,103,57,100,48,76,105,5,2,71,40,146,22,204,136,1,181,211,225,137,158,69,103,48,40,16,195,230,98,78,203,231,123,22,206,96,80,74,241,41,152,17,24,174,158,21,84,84,200,150,7,51,24,88,119,56,73,16,214,179,28,50,24,166,180,2,129,35,20,41,50,24,166,96,70,12,168,157,14,79,244,44,58,131,65,129,24,54,23,115,90,62,223,179,112,6,131,82,138,79,193,140,192,112,245,172,160,162,66,182,60,152,193,192,186,195,73,130,176,158,229,144,193,48,165,21,8,28,161,72,145,193,48,5,51,98,64,237,116,120,162,103,209,25,12,10,196,176,185,152,211,242,249,158,133,51,24,148,82,124,10,102,4,134,171,103,5,17,149,250,111,95,110,142,121,26,213,31,115,118,243,16,55,77,90,21,112,117,179,201,182,219,197,250,203,184,120,90,221,2,178,172,203,62,253,250,183,119,80,218,1,169,210,230,200,154,53,213,49,141,178,109,148,28,171,232,79,95,69,135,42,61,69,149,96,167,40,195,224,182,35,206,187,203,57,116,223,135,201,80,250,102,6,163,150,203,1,72,46,163,160,61,57,116,216,129,83,128,110,105,253,98,247,86,34,68,40,5,45,35,217,205,18,254,136,35,103,34,204,175,107,210,231,250,144,70,178,56,173,254,156,110,162,93,85,30,15,53,209,87,141,47,234,36,112,135,95,119,192,31,126,252,5,31,233,226,17,7,7,17,23,31,220,187,205,42,211,140,88,193,96,87,5,151,137,157,60,155,43,183,164,180,168,211,213,89,221,235,154,144,236,120,113,254,52,218,89,141,243,180,46,79,69,162,66,101,188,219,85,55,233,167,172,110,48,
-132,59,6,225,65,58,46,136,160,99,249,230,221,119,188,54,138,100,87,219,99,145,52,89,89,8,98,73,121,138,171,69,122,139,243,90,233,29,74,182,193,191,247,87,175,210,215,221,189,232,203,175,218,160,253,31,172,237,50,189,187,102,85,234,215,80,10,133,156,114,125,220,47,210,215,188,224,182,95,112,203,11,238,250,5,156,212,169,45,144,76,234,219,101,205,75,146,182,118,82,30,139,70,18,42,180,234,240,81,171,132,147,249,139,118,255,139,197,233,110,89,240,130,91,173,224,207,139,250,245,242,244,23,94,98,182,184,21,45,164,150,78,247,87,169,210,3,23,221,125,95,160,149,139,60,147,147,214,117,165,6,37,202,205,109,39,149,102,147,158,148,192,54,119,230,125,89,31,203,106,195,132,181,225,247,43,212,147,228,196,238,138,174,212,154,168,42,212,63,86,166,245,176,234,119,176,62,174,199,140,102,25,237,196,69,153,193,200,56,213,77,117,203,221,180,171,237,110,93,184,138,194,34,204,108,185,91,166,203,237,18,30,13,202,226,172,149,111,205,202,119,3,149,239,140,202,167,59,27,82,194,68,185,168,132,149,10,50,210,86,41,2,154,209,82,21,116,235,165,106,232,102,108,161,97,183,103,165,88,90,227,149,187,194,199,245,157,156,104,145,35,55,232,4,166,57,3,83,11,216,253,129,80,35,246,141,174,218,93,175,154,161,182,206,91,234,77,129,203,190,250,138,21,46,121,80,19,165,53,46,205,182,44,98,23,105,94,167,172,86,177,188,133,241,168,114,48,93,228,220,241,106,228,121,88,229,118,231,147,82,191,119,10,220,34,109,170,84,194,115,185,240,47,114,45,184,103,119,45,56,114,159,12,220,189,2,21,184,123,5,42,112,203,2,215,192,141,171,195,89,254,202,7,240,125,205,244,113,129,102,241,70,139,89,129,219,46,207,228,164,117,253,185,2,55,136,106,110,224,238,119,210,61,112,67,109,103,235,210,170,56,5,110,178,178,45,112,147,149,109,129,187,143,244,204,192,109,18,192,70,75,86,232,7,110,179,70,63,112,19,52,60,4,238,49,133,143,235,59,57,209,34,127,145,129,27,222,252,4,9,220,195,206,119,86,224,22,89,121,165,18,254,170,0,254,69,174,197,39,17,86,215,130,185,14,25,184,123,5,42,112,247,10,84,224,150,5,174,129,27,87,135,35,76,149,15,224,251,154,233,227,2,205,226,141,22,179,2,183,93,158,201,73,235,250,115,5,110,16,213,220,192,221,239,164,123,224,134,218,206,214,165,85,113,10,220,100,101,91,224,38,43,219,2,119,31,233,153,129,219,36,128,141,150,172,208,15,220,102,141,126,224,38,104,120,8,220,99,10,31,215,119,114,162,69,254,34,3,55,100,121,131,4,238,97,231,59,43,112,139,151,62,74,37,252,77,20,252,139,92,11,238,217,93,11,14,88,34,3,119,175,64,5,238,94,129,10,220,178,192,53,112,227,234,112,114,147,242,1,124,95,51,125,92,160,89,188,209,98,86,224,182,203,51,57,105,93,127,174,192,13,162,154,27,184,251,157,116,15,220,80,219,217,186,180,42,78,129,155,172,108,11,220,100,101,91,224,238,35,61,51,112,155,4,176,209,146,21,250,129,219,172,209,15,220,4,13,15,129,123,76,225,227,250,78,78,180,200,95,100,224,134,247,214,65,2,247,176,243,157,21,184,197,59,69,165,18,254,162,19,254,69,174,5,247,236,174,5,251,202,201,192,221,43,80,129,187,87,160,2,183,44,112,13,220,184,58,108,88,87,62,128,239,107,166,143,11,52,139,55,90,204,10,220,118,121,38,39,173,235,207,21,184,65,84,115,3,119,191,147,238,129,27,106,59,91,151,86,197,41,112,147,149,109,129,155,172,108,11,220,125,164,103,6,110,147,0,54,90,178,66,63,112,155,53,250,129,155,160,225,33,112,143,41,124,92,223,201,137,22,249,139,12,220,176,44,34,72,224,30,118,190,179,2,55,108,89,233,84,2,87,215,240,47,114,45,184,103,119,45,216,78,67,6,238,94,129,10,220,189,2,21,184,101,129,107,224,198,213,97,159,142,242,1,124,95,51,125,92,160,89,188,209,98,86,224,182,203,51,57,105,93,127,174,192,13,162,154,27,184,251,157,116,15,220,80,219,217,186,180,42,78,129,155,172,108,11,220,100,101,91,224,238,35,61,51,112,155,4,176,209,146,21,250,129,219,172,209,15,220,4,13,15,129,123,76,225,227,250,78,78,180,200,95,
-100,224,134,29,120,65,2,247,176,243,157,21,184,97,165,94,167,18,184,186,134,127,145,107,193,61,187,107,193,42,66,50,112,247,10,84,224,238,21,168,192,45,11,92,3,55,174,14,203,19,149,15,224,251,154,233,227,2,205,226,141,22,179,2,183,93,158,201,73,235,250,115,5,110,16,213,220,192,221,239,164,123,224,134,218,206,214,165,85,113,10,220,100,101,91,224,38,43,219,2,119,31,233,153,129,219,36,128,141,150,172,208,15,220,102,141,126,224,38,104,120,8,220,99,10,31,215,119,114,162,69,254,34,3,55,44,60,14,18,184,135,157,175,23,184,179,34,207,138,52,106,117,83,127,204,87,105,113,202,170,178,128,245,137,139,235,69,17,239,165,236,235,166,250,125,121,138,243,35,186,6,78,188,138,40,184,102,72,178,162,62,164,73,115,179,75,155,183,152,82,135,9,55,0,236,248,90,128,53,96,112,188,176,8,243,80,165,249,113,147,2,49,254,223,255,5,53,211,47,63,
+75,194,9,239,158,77,172,37,225,132,119,215,38,214,146,112,194,187,111,31,175,181,188,124,239,184,111,255,250,230,221,253,179,205,182,62,235,184,109,3,43,57,119,109,96,37,231,166,141,175,100,241,29,95,201,98,59,190,146,197,117,124,37,139,233,248,74,22,207,241,149,44,150,35,204,60,190,91,227,43,9,88,224,220,171,241,149,4,44,112,238,212,248,74,2,22,56,247,105,96,37,231,54,141,175,36,96,129,115,147,198,87,18,176,192,185,69,227,43,9,88,224,220,160,129,149,156,251,51,190,146,128,5,206,221,25,95,73,192,2,231,222,140,175,36,96,129,115,103,6,86,114,110,204,248,74,2,22,56,183,101,124,37,1,11,156,155,50,190,146,128,5,206,45,25,88,201,185,35,227,43,9,88,224,220,143,241,149,4,44,112,238,198,248,74,2,22,56,247,98,96,37,231,86,140,175,36,96,129,115,35,198,87,18,176,192,185,13,227,43,9,88,224,220,132,143,87,90,150,234,121,243,252,235,155,183,234,207,182,55,244,207,122,222,60,67,107,121,183,97,100,45,239,62,76,172,101,178,157,88,203,228,59,177,150,201,120,98,45,147,243,196,90,38,235,137,181,76,222,67,92,117,110,199,196,90,18,78,120,55,100,98,45,9,39,188,91,50,177,150,132,19,222,77,25,89,203,187,43,19,107,73,56,225,221,151,137,181,36,156,240,238,204,196,90,18,78,120,247,102,100,45,239,230,76,172,37,225,132,119,123,38,214,146,112,194,187,65,19,107,73,56,225,221,162,145,181,188,123,52,177,150,132,19,222,93,154,88,75,194,9,239,62,77,172,37,225,132,119,167,70,214,242,110,213,196,90,18,78,120,55,107,98,45,9,39,188,219,53,177,150,132,19,222,13,27,89,203,187,99,19,107,73,56,225,221,179,137,181,36,156,240,238,218,196,90,18,78,120,247,237,227,181,158,23,123,209,115,225,254,226,127,223,90,236,197,118,99,47,122,46,220,208,90,206,133,27,90,203,185,112,51,107,89,196,103,214,178,136,207,172,101,17,159,89,203,34,62,179,150,69,124,102,45,139,248,24,87,143,47,220,204,90,18,78,56,23,110,102,45,9,39,156,11,55,179,150,132,19,206,133,27,90,203,185,112,51,107,73,56,225,92,184,153,181,36,156,112,46,220,204,90,18,78,56,23,110,104,45,231,194,205,172,37,225,132,115,225,102,214,146,112,194,185,112,51,107,73,56,225,92,184,161,181,156,11,55,179,150,132,19,206,133,155,89,75,194,9,231,194,205,172,37,225,132,115,225,134,214,114,46,220,204,90,18,78,56,23,110,102,45,9,39,156,11,55,179,150,132,19,206,133,27,90,203,185,112,51,107,73,56,225,92,184,153,181,36,156,112,46,220,204,90,18,78,56,23,110,103,173,231,197,126,210,115,225,254,221,205,219,251,79,182,27,251,73,207,133,27,90,203,185,112,67,107,57,23,110,102,45,139,248,204,90,22,241,153,181,44,226,51,107,89,196,103,214,178,136,207,172,101,17,31,227,234,241,133,155,89,75,194,9,231,194,205,172,37,225,132,115,225,102,214,146,112,194,185,112,67,107,57,23,110,102,45,9,39,156,11,55,179,150,132,19,206,133,155,89,75,194,9,231,194,13,173,229,92,184,153,181,36,156,112,46,220,204,90,18,78,56,23,110,102,45,9,39,156,11,55,180,150,115,225,102,214,146,112,194,185,112,51,107,73,56,225,92,184,153,181,36,156,112,46,220,208,90,206,133,155,89,75,194,9,231,194,205,172,37,225,132,115,225,102,214,146,112,194,185,112,67,107,57,23,110,102,45,9,39,156,11,55,179,150,132,19,206,133,155,89,75,194,9,231,194,237,172,245,188,216,87,127,255,199,254,198,189,27,61,248,31,191,253,95,187,229,62,254,244,147,255,249,201,167,119,175,191,185,124,105,251,147,23,47,62,217,58,223,175,107,175,111,224,218,181,215,55,114,237,218,206,88,214,255,191,189,175,125,110,220,70,250,252,60,254,43,184,249,18,249,78,235,140,189,247,41,190,60,85,147,100,42,155,122,38,47,155,204,102,107,235,42,165,162,40,74,230,14,69,106,72,74,30,231,175,63,52,94,200,6,216,32,33,18,144,189,119,155,170,140,69,2,232,254,161,223,8,52,1,208,7,109,219,7,79,125,208,182,125,74,212,7,109,219,71,58,125,208,182,125,254,210,7,109,233,121,65,104,75,79,244,236,59,90,70,32,8,237,32,54,168,103,12,130,208,
+14,98,131,122,70,33,8,237,32,54,168,103,28,252,210,214,51,16,65,104,7,177,65,61,67,17,132,118,16,27,212,51,24,65,104,7,177,65,61,195,225,151,182,158,241,8,66,59,136,13,234,25,145,32,180,131,216,160,158,49,9,66,59,136,13,234,25,21,191,180,245,12,75,16,218,65,108,80,207,192,4,161,29,196,6,245,12,77,16,218,65,108,80,207,224,248,165,173,103,116,130,208,14,98,131,122,198,39,8,237,32,54,168,103,132,130,208,14,98,131,122,198,200,47,109,61,131,20,132,118,16,27,212,51,76,65,104,7,177,65,61,3,21,132,118,16,27,212,51,84,51,105,183,196,215,105,243,152,166,197,98,253,101,92,60,173,110,151,121,41,127,60,100,226,7,153,14,251,250,237,251,127,188,125,251,99,199,240,107,69,40,122,247,83,4,223,190,251,235,247,81,86,36,249,177,206,78,218,151,255,100,181,85,253,196,90,54,85,150,180,156,89,23,229,143,187,113,206,109,115,10,2,235,44,64,248,237,46,90,148,85,116,202,146,52,58,165,85,29,95,211,144,78,101,182,89,156,190,60,137,172,23,252,49,69,251,211,143,191,189,253,5,157,41,241,77,92,55,209,111,111,222,253,253,109,212,148,188,61,65,79,36,255,252,145,227,241,193,27,57,17,18,188,145,19,81,192,27,57,225,248,222,200,9,95,247,70,78,184,183,55,114,194,163,189,145,243,108,198,34,207,60,157,92,231,249,89,211,121,89,223,177,71,200,177,6,90,24,225,196,108,43,218,38,209,178,188,193,153,66,203,246,6,103,10,45,219,27,156,41,180,108,111,112,166,208,178,189,193,153,66,203,246,6,103,10,45,219,27,156,41,180,124,218,170,109,197,164,27,173,142,88,147,34,47,234,143,2,70,168,53,250,195,152,19,179,190,165,154,66,203,54,138,157,64,203,58,106,157,64,203,58,74,157,64,203,58,42,157,64,203,58,10,157,64,203,58,234,156,64,203,58,202,156,64,203,167,173,90,223,122,58,209,106,137,49,211,234,188,136,93,156,71,141,53,192,200,4,49,225,69,158,104,113,47,242,67,75,120,145,31,90,194,139,252,208,18,94,228,135,150,240,34,63,180,132,23,249,161,37,188,200,15,45,159,182,42,188,104,42,173,150,24,51,135,206,139,216,197,121,212,88,3,140,76,16,19,94,228,137,22,247,34,63,180,132,23,249,161,37,188,200,15,45,225,69,126,104,9,47,242,67,75,120,145,31,90,194,139,252,208,242,105,171,194,139,166,210,106,137,49,21,118,94,196,46,206,163,198,26,96,100,130,152,240,34,79,180,184,23,249,161,37,188,200,15,45,225,69,126,104,9,47,242,67,75,120,145,31,90,194,139,252,208,18,94,228,135,150,79,91,21,94,52,149,86,75,140,137,189,243,34,118,113,30,53,214,0,35,19,196,132,23,121,162,197,189,200,15,45,225,69,126,104,9,47,242,67,75,120,145,31,90,194,139,252,208,18,94,228,135,150,240,34,63,180,124,218,170,240,162,169,180,90,98,76,84,157,23,177,139,243,168,177,6,24,153,32,38,188,200,19,45,238,69,126,104,9,47,242,67,75,120,145,31,90,194,139,252,208,18,94,228,135,150,240,34,63,180,132,23,249,161,229,211,86,133,23,77,165,213,18,99,221,235,188,136,93,156,71,141,53,192,200,4,49,225,69,158,104,113,47,242,67,75,120,145,31,90,194,139,252,208,18,94,228,135,150,240,34,63,180,132,23,249,161,37,188,200,15,45,159,182,42,188,104,42,173,150,152,246,86,246,236,215,79,198,203,44,252,74,214,19,45,238,69,126,104,9,47,242,67,75,120,145,31,90,194,139,252,208,18,94,228,135,150,240,34,63,180,132,23,249,161,229,211,86,133,23,77,165,213,37,252,154,10,101,186,155,234,204,140,95,83,105,217,67,78,76,102,186,253,208,18,153,110,47,180,100,166,219,11,45,153,233,246,66,75,102,186,189,208,146,153,110,47,180,100,166,219,11,45,153,233,246,66,203,167,173,202,76,247,68,90,45,177,125,86,44,218,245,73,17,90,160,196,255,118,180,223,188,251,134,85,237,173,195,98,247,162,114,219,173,75,194,56,89,217,170,40,87,69,150,159,193,65,182,24,101,180,140,178,93,81,86,89,177,139,88,245,232,20,231,199,180,214,184,199,159,156,217,198,159,250,252,226,79,246,142,197,159,206,237,88,219,98,148,145,181,99,208,16,170,28,184,250,15,92,253,7,155,250,161,192,
+98,1,7,195,154,210,102,104,161,147,40,190,239,87,167,23,227,88,171,211,11,149,84,245,46,255,188,109,30,210,34,205,235,116,177,230,123,77,27,41,223,173,148,46,33,220,250,49,107,146,7,88,127,208,246,248,251,173,236,111,86,71,77,117,76,163,74,8,251,135,239,191,253,246,221,219,8,232,71,191,124,255,221,95,223,99,193,230,105,177,107,30,22,53,157,254,102,55,69,133,142,203,59,126,13,218,251,245,253,47,223,255,248,29,16,219,151,155,99,158,70,241,110,87,97,33,31,247,208,159,184,249,63,240,92,248,189,255,162,247,235,55,239,89,29,172,178,60,57,230,113,35,40,165,59,248,197,42,0,175,175,111,62,187,183,17,94,50,147,89,101,219,85,186,63,52,79,244,242,7,95,156,106,241,155,169,111,102,119,34,166,190,135,40,97,26,200,54,112,63,207,234,198,145,177,231,238,218,144,12,168,209,120,211,24,80,141,129,56,233,106,156,193,196,179,26,3,32,25,80,163,225,235,1,213,24,136,147,174,198,25,76,60,171,49,0,146,1,53,26,239,90,2,170,49,16,39,93,141,51,152,120,86,99,0,36,3,106,52,146,253,1,213,24,136,147,174,198,25,76,60,171,49,0,146,1,53,26,121,178,128,106,12,196,73,87,227,12,38,158,213,24,0,9,5,133,61,130,195,12,113,128,240,101,134,56,156,211,115,12,113,76,198,207,56,196,145,106,244,63,240,176,169,49,16,167,231,24,226,184,168,241,66,67,28,169,70,255,3,15,155,26,3,113,122,142,33,142,139,26,47,52,196,145,106,244,63,240,176,169,49,16,167,231,24,226,184,168,241,66,67,28,169,70,255,3,15,155,26,3,113,122,142,33,142,139,26,47,52,196,97,177,59,204,179,17,8,95,230,217,200,57,61,199,179,209,100,252,140,207,70,169,70,255,79,44,155,26,3,113,122,142,103,163,139,26,47,244,108,148,106,244,255,196,178,169,49,16,167,231,120,54,186,168,241,66,207,70,169,70,255,79,44,155,26,3,113,122,142,103,163,139,26,47,244,108,100,78,31,38,168,2,225,203,4,85,206,233,57,130,170,201,248,25,131,170,84,163,255,80,103,83,99,32,78,207,17,84,93,212,120,161,160,42,213,232,63,212,217,212,24,136,211,115,4,85,23,53,94,40,168,50,107,9,227,141,64,248,50,222,200,57,61,135,55,154,140,159,209,27,165,26,253,251,136,77,141,129,56,61,135,55,186,168,241,66,222,184,205,249,72,213,216,22,225,65,184,64,152,234,87,32,78,186,26,103,48,57,67,141,38,99,207,221,157,160,70,255,62,98,83,99,32,78,207,225,141,46,106,188,144,55,50,54,97,212,8,132,47,163,70,206,233,57,212,104,50,190,180,26,15,85,185,25,93,225,8,149,134,249,65,141,99,210,244,68,108,146,119,91,248,231,145,223,216,106,199,243,88,141,41,118,136,125,136,174,79,81,111,255,237,117,88,245,6,229,55,182,68,224,121,213,27,10,207,144,122,251,153,251,176,234,13,202,111,236,245,200,243,170,55,20,158,33,245,246,147,79,97,213,27,148,223,88,134,239,121,213,27,10,207,144,122,251,211,224,176,234,13,202,111,44,215,240,188,234,13,133,103,72,189,253,145,92,88,245,6,229,55,54,92,126,94,245,134,194,67,2,178,174,184,244,35,110,247,117,151,30,249,61,223,208,106,218,26,204,240,234,13,53,212,113,95,143,25,76,189,151,28,90,77,91,155,25,94,189,161,134,58,238,235,52,131,169,247,146,67,171,105,107,54,195,171,55,212,80,199,125,253,102,48,245,94,114,104,53,109,45,103,120,245,134,26,234,184,175,235,12,166,222,75,14,173,166,173,241,12,168,94,235,74,79,63,226,118,95,239,233,145,223,243,61,123,167,173,253,12,175,222,80,207,66,247,117,160,193,212,123,201,103,239,180,53,161,225,213,27,234,89,232,190,62,52,152,122,47,249,236,157,182,86,52,188,122,67,61,11,221,215,141,6,83,239,37,159,189,211,214,144,6,84,175,117,37,169,31,113,187,175,39,245,200,239,249,130,243,180,181,165,225,213,27,42,88,186,175,51,13,166,222,75,6,231,105,107,78,195,171,55,84,176,116,95,127,26,76,189,151,12,206,211,214,162,6,84,175,117,69,170,31,113,187,175,75,245,200,239,249,188,119,218,26,213,240,234,13,229,77,238,235,85,131,169,247,146,222,59,109,237,106,64,245,90,87,176,250,17,183,251,58,86,143,252,198,
+86,179,134,83,239,180,53,173,225,213,27,202,155,220,215,183,6,83,239,37,189,119,218,90,215,128,234,181,174,120,245,35,110,247,117,175,30,249,61,159,122,167,173,129,245,164,94,245,95,158,173,171,184,122,138,234,143,185,186,43,143,4,101,184,248,77,121,41,42,116,103,250,198,85,179,184,230,7,164,70,45,194,95,255,246,174,102,127,179,18,29,188,251,43,63,237,148,31,228,90,149,9,148,22,59,168,8,36,154,20,234,212,159,153,132,239,36,101,130,240,221,8,229,67,149,178,10,135,44,79,55,0,217,194,37,43,178,134,224,1,183,223,22,167,172,42,11,104,130,206,103,101,5,89,156,103,127,164,81,243,144,70,105,87,39,218,150,85,244,195,155,119,250,167,253,142,205,166,124,44,22,155,52,143,159,96,217,198,18,170,37,41,87,170,118,6,50,116,76,214,94,61,86,241,225,222,70,164,126,104,230,19,201,138,115,136,12,244,103,122,39,166,35,119,134,187,63,37,76,183,56,157,207,42,179,155,157,58,191,75,27,174,199,253,49,111,50,248,32,61,51,44,230,36,77,156,151,187,40,41,139,38,253,212,220,68,87,63,166,233,134,153,17,104,56,41,43,102,88,77,103,78,209,38,61,164,197,38,45,146,44,173,175,22,25,119,144,155,227,1,188,108,201,208,151,199,124,19,173,153,91,110,25,38,94,182,206,138,13,51,60,160,159,28,25,53,70,35,253,148,38,199,134,49,191,198,230,211,84,113,81,47,154,167,67,202,21,150,60,196,89,193,127,21,241,62,229,135,253,246,12,151,55,137,147,70,243,188,55,17,186,141,144,115,210,16,19,0,31,212,206,154,101,149,230,105,92,167,203,170,204,243,117,156,124,136,88,159,185,43,114,100,71,70,101,203,2,11,6,40,200,46,174,45,48,176,159,2,157,136,177,139,143,77,41,248,97,18,184,235,162,84,39,42,238,117,228,222,87,217,110,199,100,10,10,148,212,202,67,90,197,188,151,160,171,24,252,49,90,231,101,242,1,211,142,215,101,101,144,230,183,104,202,188,200,141,176,52,156,78,99,181,82,84,171,177,165,232,170,48,99,83,121,178,125,135,35,110,109,177,85,218,185,252,182,71,102,152,27,94,186,109,248,159,75,35,104,186,95,217,94,212,42,249,191,233,137,81,19,215,93,171,246,23,243,142,77,198,145,194,213,199,99,90,61,209,38,239,17,115,195,79,39,15,206,97,201,154,28,130,43,64,176,98,132,193,235,248,49,230,65,185,217,99,210,0,151,70,58,154,27,183,29,139,21,77,42,248,177,248,36,126,240,155,101,37,76,123,179,207,220,45,155,183,252,162,74,79,229,135,52,2,122,142,48,142,117,90,113,214,135,184,174,31,55,252,39,11,255,66,32,201,67,186,143,165,231,229,249,89,66,1,186,243,229,175,73,233,80,101,167,90,60,60,244,242,78,158,66,116,231,11,12,72,179,193,213,46,173,207,198,10,49,169,167,208,14,170,39,128,192,133,71,236,179,145,102,45,210,108,72,210,55,55,55,110,198,94,165,48,226,102,79,253,244,147,7,253,198,9,12,113,157,101,18,231,48,238,104,226,53,28,238,207,155,58,242,222,119,204,247,29,247,67,119,247,208,76,125,170,105,152,54,155,47,216,208,78,94,205,23,79,182,63,228,238,113,72,168,70,142,131,6,88,167,167,56,95,36,251,77,71,89,159,236,168,54,104,66,38,38,31,252,227,24,98,120,199,126,71,48,53,17,115,40,141,15,197,102,25,149,199,230,112,108,196,8,221,47,203,104,1,117,202,3,104,45,206,217,164,47,133,75,206,46,98,30,3,227,30,121,197,128,164,241,254,90,159,51,37,249,113,147,46,182,122,116,139,244,9,20,175,51,138,77,155,152,41,214,91,86,209,20,254,155,124,151,178,9,42,18,14,3,191,103,243,176,78,60,45,255,95,222,156,43,156,207,217,176,55,22,194,96,198,201,57,125,78,27,2,155,90,179,153,115,90,45,216,108,88,0,105,197,176,100,133,249,170,110,246,141,184,170,179,157,144,14,158,129,32,108,119,125,112,208,123,4,5,233,139,147,222,55,215,28,191,2,17,177,33,111,92,71,123,86,85,69,187,101,196,128,221,112,76,11,6,160,136,155,99,149,94,227,175,133,108,243,99,253,176,2,63,138,204,15,155,48,197,181,165,29,56,126,139,67,3,247,40,202,71,109,48,93,179,167,86,35,191,121,178,175,119,180,235,137,90,120,222,85,192,120,26,180,193,
+148,145,164,220,16,163,199,135,148,77,69,190,250,10,62,124,130,156,162,101,33,162,210,32,139,239,11,71,46,127,250,234,53,197,226,177,218,140,177,248,71,181,153,197,130,141,196,198,88,188,43,118,231,176,192,31,173,249,45,174,50,136,164,11,54,207,21,211,252,83,92,117,22,202,191,202,35,62,69,19,233,134,137,218,162,25,155,156,31,243,102,144,71,98,30,35,210,47,64,150,87,198,252,119,35,252,35,243,43,56,59,138,233,119,110,76,141,185,40,179,77,136,27,11,248,199,22,152,24,166,149,172,215,177,123,91,0,197,47,54,89,205,159,64,117,124,130,244,17,0,208,67,38,155,169,38,250,151,154,138,244,83,179,226,40,23,81,247,40,98,96,217,108,165,72,84,143,241,91,51,0,208,181,234,48,200,175,252,0,83,40,238,186,206,97,72,122,152,181,200,201,221,244,17,136,69,172,77,245,187,137,35,234,94,4,105,112,216,93,63,144,152,46,207,23,70,219,136,100,172,210,35,86,222,134,13,200,201,142,21,192,50,106,39,67,4,22,217,122,197,90,96,52,252,166,198,89,228,82,5,40,94,170,105,134,141,243,86,217,230,19,147,107,231,3,104,90,32,6,58,226,39,31,18,138,159,120,84,199,21,197,29,197,80,85,71,154,167,186,58,148,95,67,74,9,32,126,46,56,221,112,38,55,156,254,231,209,215,111,222,11,200,114,252,247,129,221,255,242,234,213,235,232,207,204,142,234,84,32,186,122,117,203,174,179,2,226,79,125,245,234,142,93,136,36,86,237,183,119,139,99,182,65,169,238,35,19,35,238,240,245,255,115,61,94,50,243,100,86,85,136,41,106,84,84,43,184,254,255,64,213,67,29,255,119,180,130,81,41,36,101,126,220,23,166,24,162,17,45,59,245,72,144,126,57,93,58,95,127,255,134,221,28,48,96,239,74,5,202,153,24,217,189,236,126,191,124,205,171,137,206,38,205,155,56,90,64,39,59,132,127,97,3,35,189,7,145,222,5,168,192,40,227,27,209,245,213,171,87,218,141,182,147,223,190,125,247,254,13,43,233,125,29,83,244,7,198,105,162,59,28,204,231,117,20,31,14,121,150,110,110,180,15,99,86,229,191,210,164,225,85,216,216,229,184,174,211,156,93,99,140,30,250,16,13,244,64,34,152,213,11,134,187,39,113,9,158,21,107,96,109,216,197,117,139,28,46,91,220,112,161,131,102,12,123,128,219,25,61,64,102,3,198,86,152,169,180,135,27,31,22,50,40,75,86,114,247,210,204,193,69,249,119,47,65,251,131,218,190,155,169,110,217,209,30,66,237,162,26,1,195,2,84,158,110,155,158,199,188,131,111,213,214,77,122,16,51,86,168,3,57,180,180,138,254,85,102,5,179,234,84,241,231,209,47,43,10,89,20,45,242,101,117,29,149,39,249,194,145,183,204,10,158,124,203,54,105,180,96,104,175,63,235,122,1,115,102,241,166,122,145,48,53,20,141,120,189,71,206,173,100,197,158,220,128,15,139,151,49,15,169,234,189,55,99,198,136,109,51,134,67,188,228,20,228,181,108,207,1,222,117,163,199,74,55,207,234,50,176,81,247,174,129,251,50,51,58,61,213,0,224,4,37,227,217,240,134,223,140,214,176,148,67,188,213,229,6,200,73,223,112,170,209,226,80,214,117,182,206,159,218,4,224,6,106,87,233,33,103,211,115,41,90,120,46,40,147,208,26,139,185,101,221,205,228,138,227,126,45,251,91,86,27,246,171,125,155,159,106,57,79,241,120,57,163,227,85,182,225,61,95,66,83,90,4,130,166,33,130,191,243,155,93,254,163,86,211,222,190,44,136,9,112,146,167,113,181,226,207,200,5,5,209,216,97,1,40,80,19,3,202,55,80,34,30,184,218,170,132,108,179,136,6,5,113,141,194,183,182,42,32,219,144,150,200,89,212,64,88,246,18,47,148,26,103,231,48,76,155,7,197,148,50,139,44,233,184,49,172,105,173,139,198,134,168,197,205,104,91,149,251,78,224,253,228,198,49,111,126,77,155,69,179,206,229,144,173,105,42,201,247,32,185,230,105,161,70,124,113,46,222,146,68,105,146,199,106,100,7,209,22,112,241,109,174,122,102,12,90,48,83,224,102,103,224,251,153,249,87,92,65,194,92,188,166,17,88,32,103,56,10,20,37,164,56,92,116,13,160,209,37,64,71,251,192,56,254,238,26,244,193,61,10,94,187,17,232,171,242,113,37,56,191,84,236,234,9,252,187,165,7,194,7,207,
+236,3,15,93,60,62,240,96,13,235,138,54,233,54,134,210,111,126,253,13,74,247,49,213,209,244,211,161,100,78,35,66,5,122,133,177,85,111,47,0,114,122,80,239,53,146,246,247,71,246,80,19,191,138,99,158,87,234,246,37,85,45,177,131,198,207,22,211,55,63,253,252,207,232,251,31,223,255,36,223,108,49,209,252,219,73,102,204,144,112,15,188,72,168,31,0,89,68,169,210,205,123,46,163,168,75,239,19,96,84,221,17,56,170,154,10,127,81,159,105,243,13,143,200,139,74,134,50,20,107,81,0,126,58,164,221,213,38,219,101,77,109,4,68,243,173,23,129,82,196,126,181,158,208,4,82,149,135,111,237,18,232,191,114,128,6,195,114,128,26,110,66,48,121,215,140,121,37,30,117,142,172,107,138,119,195,254,47,12,254,53,7,128,57,175,224,45,35,27,183,236,170,120,147,174,74,54,103,120,125,251,191,22,114,252,169,31,156,240,247,159,191,107,91,116,188,190,229,188,30,208,226,140,118,208,201,134,125,79,236,138,233,178,91,108,9,53,127,18,92,34,201,85,91,15,192,223,222,211,160,208,106,19,57,240,49,208,161,198,104,200,35,215,3,96,132,155,180,78,170,108,45,0,110,39,224,59,101,233,227,0,190,211,32,62,104,76,226,131,130,9,216,200,96,247,215,52,222,44,234,47,133,191,215,16,213,234,85,171,213,158,175,200,240,242,192,26,25,166,244,150,151,48,67,150,97,101,193,158,70,124,88,125,13,99,116,65,62,170,41,187,22,52,127,225,205,206,70,66,62,50,231,98,249,230,225,88,124,56,27,74,2,173,108,72,120,161,26,207,163,200,235,17,218,146,145,223,50,154,106,40,252,18,224,254,164,214,206,46,6,144,180,11,108,105,52,146,61,76,241,121,214,240,11,188,162,25,22,135,102,41,137,32,222,110,121,54,224,151,242,177,238,6,236,76,46,108,26,100,248,28,159,149,202,234,48,182,48,227,164,0,42,94,136,138,89,35,76,244,101,131,8,26,128,19,226,215,150,124,209,42,53,75,43,15,79,43,24,235,47,34,177,72,51,186,122,213,141,40,218,95,117,251,171,168,123,75,77,88,23,96,33,129,82,55,255,13,235,145,83,105,6,235,180,110,132,242,23,250,120,65,235,111,182,183,142,20,190,223,75,51,16,3,5,62,53,89,43,101,139,124,16,244,245,234,213,46,59,165,108,242,116,60,200,197,53,12,53,168,178,172,234,104,193,126,127,1,29,186,86,59,77,218,149,10,60,109,179,248,196,51,82,119,40,153,126,247,187,121,212,59,175,217,23,162,128,46,159,191,244,12,108,139,86,234,69,215,67,114,88,103,197,185,178,80,11,149,88,47,57,159,107,251,32,155,81,231,203,18,106,60,208,163,70,114,102,6,167,107,111,0,250,71,149,177,199,64,26,39,15,109,94,160,140,216,72,135,35,138,4,179,107,152,11,0,74,214,28,54,246,228,241,19,27,160,50,79,138,217,211,2,86,246,195,243,182,19,34,78,148,253,145,86,229,170,172,86,101,145,26,201,209,91,72,138,233,107,56,80,229,14,96,182,133,118,124,11,69,156,21,53,147,4,243,85,72,218,20,106,93,71,251,154,63,171,111,162,239,139,4,50,81,204,161,246,37,27,14,86,113,86,27,235,93,82,54,230,86,109,138,44,7,180,89,145,103,5,122,80,195,130,136,250,184,214,192,175,49,244,101,180,59,224,84,223,78,13,189,197,101,81,174,24,101,117,50,125,215,236,254,234,213,98,183,76,151,15,236,246,87,209,174,42,143,7,224,195,127,44,118,135,107,86,190,135,18,216,120,117,179,143,63,45,30,224,86,242,26,238,177,49,103,114,147,213,140,238,98,47,238,222,182,183,139,178,89,36,175,249,221,238,230,127,45,246,203,91,30,157,248,253,174,128,233,133,213,190,93,38,183,156,97,221,22,48,115,2,218,17,220,220,193,93,48,248,255,185,248,236,238,246,245,235,215,127,66,210,248,146,213,175,54,204,24,242,172,121,98,227,135,82,172,51,139,22,159,45,163,125,45,168,238,110,59,10,236,106,25,125,246,95,183,215,159,65,25,72,87,174,97,98,176,160,197,142,35,145,58,65,124,128,194,250,254,10,50,121,125,149,32,43,99,253,95,29,139,236,227,177,211,147,202,186,102,104,18,209,85,139,58,251,98,15,1,102,193,217,86,38,109,178,60,170,153,33,195,56,40,110,162,117,180,41,211,186,248,188,137,30,226,83,26,201,198,
+188,150,200,169,125,22,33,24,42,143,88,213,11,21,35,184,135,146,63,175,241,210,165,159,179,67,250,141,88,53,138,70,125,45,61,153,224,171,245,173,38,29,59,145,234,195,217,213,106,247,75,154,176,71,235,162,183,197,169,45,66,203,164,192,139,154,146,225,120,80,155,96,226,60,135,181,75,104,133,76,159,116,172,38,214,190,88,116,49,253,99,190,82,11,180,88,167,59,161,117,107,204,112,13,114,197,143,8,176,252,233,98,174,249,210,119,7,138,66,198,38,90,240,133,243,218,194,39,190,200,135,223,128,45,39,236,114,127,96,115,105,248,13,83,244,110,67,60,139,137,117,3,43,74,205,186,209,71,162,114,182,81,115,113,102,159,200,18,160,87,10,143,17,167,97,123,163,26,55,240,158,193,144,33,129,173,102,109,15,150,208,239,140,73,87,48,172,249,51,20,88,241,165,103,71,173,215,155,245,10,250,10,189,38,164,171,74,13,12,74,186,138,63,175,35,69,12,11,220,18,54,95,174,178,82,219,234,11,27,27,192,88,212,86,7,56,112,24,89,11,227,164,170,24,204,100,42,85,149,50,7,172,31,20,83,99,165,162,236,48,27,199,246,247,166,124,243,238,61,171,241,94,212,64,239,7,248,94,44,62,172,82,251,233,24,37,216,41,84,15,17,95,54,243,88,136,81,141,176,70,113,175,161,216,110,142,251,195,42,97,207,228,148,5,18,177,97,169,51,202,164,60,22,13,58,52,172,147,101,219,10,77,201,217,61,153,244,47,26,184,35,7,225,2,22,175,220,99,204,226,202,10,44,6,162,88,149,62,194,0,193,153,125,219,150,128,208,198,171,72,82,229,118,153,49,111,74,250,189,231,107,36,25,128,171,87,98,115,87,151,185,98,15,179,252,3,2,116,245,234,144,104,151,205,3,140,76,180,22,140,197,135,26,121,32,123,216,212,245,15,95,107,119,78,123,227,6,80,209,27,113,212,250,173,125,86,108,243,70,191,21,255,203,188,85,156,146,250,81,187,195,23,119,19,15,131,174,243,132,4,249,125,139,212,98,88,126,255,71,186,96,128,216,200,65,38,170,88,8,98,145,166,111,178,16,104,100,131,123,71,10,124,229,7,177,212,120,14,41,145,210,12,68,83,188,219,30,36,78,190,44,107,223,102,118,114,238,191,186,170,217,172,36,222,9,3,149,43,98,52,19,228,11,99,240,29,185,62,70,171,244,116,208,235,236,203,141,126,131,77,195,248,192,202,160,212,58,160,180,37,54,69,218,63,102,155,230,65,247,18,206,177,230,27,27,80,229,135,52,62,232,55,88,96,53,140,250,0,247,186,7,20,187,195,134,247,21,163,171,87,19,3,37,235,131,76,136,168,247,248,136,181,71,179,168,196,38,24,226,253,2,4,70,74,206,237,180,236,63,2,247,47,112,241,142,158,175,27,131,147,31,42,153,25,25,86,4,126,75,251,31,157,132,215,137,53,4,141,44,32,248,143,114,46,160,28,209,19,156,248,16,211,117,254,74,162,121,90,200,228,84,244,101,111,119,155,172,97,142,123,217,80,81,205,54,171,242,81,190,219,104,96,69,141,182,14,137,117,76,103,180,198,249,47,188,234,40,194,203,142,6,25,195,51,144,102,93,223,24,27,71,6,120,179,231,49,239,236,53,44,149,169,215,248,72,26,94,208,105,226,103,95,128,248,152,150,205,160,87,106,119,39,152,190,182,68,236,234,149,49,193,187,122,181,73,183,89,145,246,231,109,87,175,204,113,55,51,186,204,112,135,67,30,235,150,191,87,43,208,164,133,119,91,11,219,29,51,186,9,154,152,187,222,255,180,134,124,23,26,172,243,131,68,68,45,75,175,243,188,166,250,76,79,98,225,126,121,32,110,179,217,251,145,111,162,212,67,1,100,101,107,116,128,35,27,152,127,74,19,99,192,12,169,117,237,86,114,56,230,165,49,24,207,202,199,56,67,35,122,187,72,88,135,70,5,194,234,144,226,224,71,30,45,44,164,121,33,242,163,174,128,111,225,66,205,254,246,238,167,239,196,205,123,107,109,152,112,136,205,8,68,179,247,80,248,80,230,27,162,189,220,41,102,176,147,119,239,113,146,251,169,222,151,5,224,63,242,41,97,19,239,112,62,193,176,106,174,112,194,166,83,72,92,196,106,54,135,10,14,85,185,3,246,120,125,128,200,25,104,235,11,20,83,145,228,52,252,3,165,166,254,249,235,15,63,253,200,177,222,247,186,112,136,25,216,5,144,130,147,123,140,54,188,240,
+222,222,68,19,177,91,19,152,251,208,77,204,54,96,189,123,43,52,81,122,63,208,136,0,55,222,136,128,167,26,153,173,192,93,109,232,160,236,222,218,128,64,54,220,128,64,37,26,92,105,47,158,170,20,22,161,242,204,25,11,204,42,234,8,147,220,230,155,12,187,61,100,121,177,49,101,197,129,178,29,88,50,34,201,222,147,204,196,42,195,5,217,66,148,105,219,252,217,243,9,70,10,139,232,4,103,76,69,98,213,98,164,218,254,240,223,111,255,9,197,247,81,239,137,42,90,161,175,164,181,203,199,33,250,105,20,216,93,78,132,102,203,180,53,149,45,124,65,100,42,91,185,142,99,10,91,208,215,84,182,124,63,228,52,182,96,55,83,217,138,145,198,36,182,218,214,128,51,217,2,191,137,108,57,167,137,108,183,249,100,221,194,249,143,83,217,110,214,249,84,182,112,46,225,84,182,108,60,57,149,173,120,235,118,46,227,170,132,157,218,171,79,101,181,226,212,30,248,94,254,168,88,183,11,192,78,130,50,129,202,104,123,223,195,215,39,222,13,169,48,139,181,241,166,180,243,76,173,3,199,252,195,170,199,179,219,74,241,49,191,217,164,176,162,245,88,108,100,12,228,251,18,68,40,132,63,109,28,101,23,171,182,174,153,248,135,123,176,64,0,237,166,63,193,139,226,130,197,91,54,136,168,197,177,119,7,241,90,0,210,243,168,219,125,16,237,135,39,17,148,54,204,106,128,96,159,166,63,80,154,92,116,153,200,181,14,82,248,28,150,241,81,113,128,51,14,131,129,205,224,16,141,211,98,179,172,249,170,150,74,46,29,140,214,233,131,218,176,182,41,97,237,11,3,21,253,239,232,53,172,176,216,194,187,106,89,114,221,23,31,37,58,11,98,85,161,39,198,139,97,215,167,192,226,237,198,138,129,76,43,56,146,38,170,213,97,14,66,240,233,7,217,143,15,234,145,133,151,46,72,163,188,51,168,160,183,183,176,87,6,108,72,129,103,168,227,200,168,254,217,144,75,240,83,48,43,245,152,134,63,221,148,225,161,185,164,75,240,15,134,117,80,186,33,128,6,232,18,46,193,101,66,27,24,254,90,40,192,121,25,46,33,68,55,224,18,80,161,39,198,151,231,18,92,240,195,46,33,141,114,196,37,192,134,38,187,132,20,159,100,174,173,195,102,23,151,116,9,49,117,104,161,116,15,65,13,208,37,92,130,203,132,54,48,188,244,15,224,188,12,151,16,162,27,112,9,158,122,49,197,248,242,92,66,236,59,26,116,9,105,148,35,46,145,21,51,92,130,143,0,43,60,224,111,185,179,139,75,186,132,24,41,182,80,186,129,173,6,232,18,46,193,101,66,27,24,222,26,8,112,94,134,75,8,209,13,184,4,84,232,137,241,229,185,4,23,252,176,75,72,163,28,113,9,176,161,201,46,193,95,186,87,106,198,15,127,90,238,236,226,146,46,33,50,78,45,148,46,155,160,1,186,132,75,112,153,208,6,134,181,3,112,94,134,75,8,209,13,184,132,118,202,151,18,227,203,115,9,46,248,97,151,144,70,57,226,18,96,67,147,93,98,155,115,241,201,252,12,252,105,185,179,139,16,214,103,245,9,254,161,143,14,75,151,252,209,16,93,194,39,164,80,132,77,225,79,199,0,128,113,198,219,188,140,27,254,25,134,18,148,122,154,111,75,164,35,40,121,33,211,135,91,61,105,61,7,96,64,187,175,87,77,117,44,18,36,81,177,33,199,148,40,175,101,0,228,247,218,237,104,65,240,105,22,184,89,231,0,80,38,12,225,15,90,240,153,95,212,15,248,23,81,58,44,93,54,82,67,116,9,63,144,66,17,6,134,63,194,2,0,94,140,31,40,121,33,63,128,91,61,105,189,4,63,144,18,21,126,96,74,244,153,252,32,206,15,15,241,130,217,146,64,199,170,53,49,252,52,16,194,33,210,117,179,226,181,87,236,151,182,67,40,231,199,132,138,165,38,176,204,187,110,170,178,40,247,79,17,175,222,110,83,249,18,22,132,51,190,98,133,68,21,111,178,99,45,24,202,179,71,160,115,242,32,100,216,143,155,21,177,250,56,134,97,2,29,104,100,3,24,122,223,14,88,7,192,12,136,14,192,185,91,153,115,39,6,209,32,17,226,143,69,145,104,58,113,106,135,104,77,71,195,135,28,204,13,192,210,96,1,41,222,3,222,203,158,195,119,150,238,138,227,126,5,41,99,125,68,193,204,106,221,136,13,109,98,175,9,63,34,230,148,86,204,
+0,31,209,248,108,136,31,218,115,78,179,134,224,69,178,102,5,11,238,203,163,252,213,27,10,9,1,189,233,55,250,77,164,234,227,198,131,0,92,0,152,130,176,99,153,33,17,82,37,198,41,0,61,53,176,114,159,22,96,63,116,128,230,28,200,0,196,203,122,23,3,240,208,127,23,0,78,6,48,87,34,198,180,227,161,177,197,0,237,117,65,235,2,144,35,239,113,133,170,110,22,96,225,103,244,188,207,26,58,76,178,134,14,195,162,17,119,13,72,8,195,49,64,127,55,129,99,192,116,1,184,0,160,76,128,198,50,67,34,164,74,136,24,160,191,48,82,62,224,199,2,134,99,64,159,115,32,3,176,198,128,158,208,61,244,223,5,128,147,1,204,149,136,177,146,183,176,198,0,237,253,72,235,2,89,65,112,133,170,110,22,96,225,103,244,188,207,26,58,76,178,134,14,243,129,178,179,6,36,132,225,24,160,191,140,193,49,96,186,0,92,0,80,38,64,99,153,33,17,82,37,68,12,208,212,208,250,128,31,11,24,142,1,125,206,129,12,192,26,3,122,66,247,208,127,23,0,78,6,48,87,34,186,70,30,171,141,45,6,104,47,132,90,23,120,196,59,160,21,87,190,98,200,201,2,44,252,140,158,247,89,67,135,73,214,208,97,126,90,137,179,6,36,132,225,24,160,191,125,194,49,96,186,0,92,0,80,38,64,99,153,33,17,82,37,68,12,208,212,208,250,128,31,11,24,142,1,125,206,129,12,192,26,3,122,66,247,208,127,23,0,78,6,48,87,34,186,70,242,98,103,139,1,218,27,176,214,5,114,252,1,30,197,21,170,186,89,128,133,159,209,243,62,107,232,48,201,26,58,12,203,187,221,53,32,33,12,199,0,253,117,27,142,1,211,5,224,2,128,50,1,26,203,12,137,144,42,33,98,128,166,134,214,7,252,88,192,112,12,232,115,14,100,0,214,24,208,19,186,135,254,187,0,112,50,128,185,18,209,53,210,110,156,81,158,9,140,219,155,134,35,174,218,2,252,133,117,193,184,45,50,117,222,227,96,138,220,198,13,238,83,28,19,147,163,67,95,149,244,53,48,253,37,243,221,54,162,190,207,157,219,249,97,150,164,221,13,177,247,41,141,62,46,121,72,39,161,10,110,110,243,21,79,68,24,27,51,15,61,117,198,177,132,163,88,86,205,31,231,97,106,254,240,140,170,189,112,144,81,123,107,76,82,109,83,111,190,2,241,106,204,88,39,217,203,48,203,115,124,197,183,5,185,35,51,77,233,76,148,51,109,202,142,19,159,223,228,46,199,224,86,198,209,110,226,39,104,131,159,61,242,150,249,228,145,183,251,230,36,11,76,247,50,40,155,93,167,185,240,158,246,56,37,58,167,51,60,8,129,232,63,107,100,33,245,164,57,163,179,67,172,72,125,219,217,250,234,189,137,71,62,91,122,34,23,145,98,134,98,137,103,10,205,100,102,207,28,249,155,1,96,28,11,229,243,147,209,200,159,163,18,145,55,6,165,162,26,121,177,122,237,169,65,154,223,217,150,48,196,202,221,234,125,218,134,43,34,242,41,225,134,110,150,181,216,240,41,214,238,82,243,110,63,237,126,69,113,62,48,127,212,44,58,203,213,214,69,200,42,61,174,234,227,184,226,115,15,117,123,214,112,103,58,36,27,241,164,196,227,44,138,27,241,236,179,241,195,131,27,211,83,27,227,57,215,16,15,57,242,21,47,187,75,106,178,177,62,89,26,203,99,101,128,60,141,182,141,221,13,17,184,167,130,53,2,66,99,137,6,14,228,219,147,94,121,252,19,187,47,1,50,214,34,255,154,208,221,10,14,106,52,141,180,73,229,81,221,253,119,164,31,243,117,94,174,145,8,228,29,83,10,242,54,241,130,80,20,80,111,3,59,218,125,113,200,66,74,34,103,176,194,114,81,192,9,209,200,34,82,58,170,89,39,32,109,95,49,39,142,191,160,179,185,149,25,140,91,51,204,181,91,140,123,175,155,77,56,172,155,192,155,232,97,83,101,67,73,150,222,57,62,103,194,211,78,67,166,94,14,131,138,140,229,98,51,208,234,106,58,174,69,3,113,116,253,178,59,169,222,56,139,246,253,47,109,213,247,113,150,223,187,146,145,167,92,14,18,52,65,237,203,162,121,64,139,211,229,96,167,191,40,93,59,42,94,107,68,217,20,83,56,95,135,174,215,116,150,148,185,100,222,138,74,219,99,168,183,26,130,101,84,117,121,102,209,194,178,236,6,182,11,139,216,4,
+124,158,160,116,231,236,11,202,97,127,242,248,190,100,191,66,178,236,15,117,22,18,44,193,240,43,36,151,29,171,163,59,85,253,10,201,178,99,208,89,72,80,223,175,144,28,246,48,142,239,93,244,43,36,203,30,50,103,33,193,75,60,191,66,114,216,213,54,190,155,205,175,144,44,187,138,156,133,4,111,57,252,10,201,97,159,211,248,254,166,57,66,226,7,61,45,218,209,9,249,53,104,113,206,161,118,242,26,111,70,158,211,94,164,159,154,136,23,107,135,91,62,176,71,236,135,69,239,156,96,109,236,195,235,160,185,111,89,212,101,158,117,7,249,194,167,16,97,193,183,60,176,28,62,139,26,231,185,60,172,177,142,142,53,63,127,158,83,97,191,48,251,42,133,243,195,6,185,243,42,211,153,67,243,140,239,53,131,239,53,110,162,58,47,27,237,32,187,83,156,28,143,251,97,12,162,14,2,241,80,150,226,115,23,241,225,80,149,240,81,15,166,235,196,2,77,63,116,27,62,177,197,79,164,25,228,216,86,51,190,196,197,79,103,207,138,77,150,164,117,251,209,40,249,61,23,243,155,32,135,42,205,143,155,84,255,152,129,188,137,170,165,135,44,47,119,71,163,158,186,235,48,208,105,179,59,231,13,118,70,167,231,231,248,142,45,243,212,109,20,37,102,237,38,162,59,11,38,19,6,199,54,61,233,136,223,168,88,144,161,20,183,45,1,132,147,219,103,163,209,82,241,96,176,29,148,126,186,65,206,82,109,105,118,53,87,141,207,207,177,51,67,78,63,45,228,80,249,168,190,227,130,231,243,108,34,192,43,233,43,204,209,231,95,197,92,162,142,98,56,244,63,226,117,97,166,69,30,222,42,185,161,228,215,17,127,59,70,95,222,14,167,165,122,96,110,239,167,182,174,184,101,165,173,162,13,211,79,125,9,47,238,231,12,230,246,126,106,107,39,91,86,218,74,193,48,253,212,151,41,226,126,206,96,174,166,240,236,153,82,47,78,221,151,54,180,46,202,114,146,135,44,163,58,212,145,237,78,108,36,103,249,162,47,142,92,212,127,189,221,47,114,131,171,237,139,155,248,80,46,216,240,90,28,247,150,189,30,242,227,106,98,137,7,236,232,118,221,246,129,55,162,104,251,131,173,152,250,199,110,197,77,32,112,8,25,223,31,231,34,39,216,16,121,25,57,137,189,131,103,201,41,16,184,118,27,193,136,61,225,19,173,176,202,250,251,6,250,80,28,183,16,224,77,13,238,246,164,157,89,101,216,147,71,112,8,217,160,61,97,57,97,149,133,149,147,131,61,153,114,10,4,174,93,146,62,98,79,120,118,136,85,214,95,131,222,135,226,184,28,29,47,144,119,183,39,237,192,39,195,158,60,130,67,200,6,237,9,203,9,171,44,172,156,28,236,201,148,83,32,112,237,242,230,17,123,194,103,41,97,149,245,215,51,247,161,56,46,109,198,139,173,221,237,73,59,45,201,176,39,143,224,16,178,65,123,194,114,194,42,11,43,39,7,123,50,229,20,8,92,187,84,118,196,158,240,220,23,171,172,191,54,182,15,197,113,153,44,94,184,235,110,79,218,81,67,134,61,121,4,135,144,13,218,19,150,19,86,89,88,57,57,216,147,41,167,64,224,240,200,174,73,221,198,153,112,94,235,101,198,153,242,16,220,115,198,153,129,192,181,200,212,123,210,147,229,244,96,56,124,138,96,172,177,59,251,168,0,141,41,19,200,157,20,198,157,69,59,0,130,22,128,137,99,134,142,16,40,165,136,33,165,248,20,204,8,12,74,66,67,176,130,136,10,217,178,56,105,215,193,179,224,216,215,203,120,150,60,75,247,28,207,10,4,142,80,36,31,171,247,4,51,98,64,188,209,12,207,18,74,26,242,44,5,98,216,92,20,14,127,158,5,186,26,82,138,79,193,140,192,112,245,172,160,162,66,182,44,150,176,56,120,22,156,30,123,25,207,146,71,242,158,227,89,129,192,17,138,164,5,51,98,64,188,209,12,207,18,74,26,242,44,5,98,216,92,20,14,127,158,197,191,109,59,160,20,159,130,25,129,225,234,89,65,69,133,108,89,156,251,235,224,89,112,8,237,101,60,75,158,236,123,142,103,5,2,71,40,146,207,223,122,130,25,49,32,222,104,134,103,9,37,13,121,150,2,49,108,46,10,135,63,207,2,93,13,41,197,167,96,70,96,184,122,86,80,81,33,91,22,111,133,29,60,11,206,178,189,140,103,201,3,130,207,241,172,64,224,8,69,242,153,108,79,
+48,35,6,196,27,205,240,44,161,164,33,207,82,32,134,205,69,225,240,231,89,160,171,33,165,248,20,204,8,12,87,207,10,42,42,252,46,97,40,131,129,223,108,224,36,65,216,55,27,14,25,12,243,205,70,32,112,45,50,51,131,97,10,134,27,80,159,177,57,29,62,239,160,179,177,12,6,5,130,22,128,109,90,62,65,71,3,25,12,74,41,62,5,51,2,195,230,89,54,88,65,68,133,108,121,48,131,97,126,45,232,50,158,229,144,193,48,165,21,8,28,161,72,145,193,48,5,51,98,64,106,58,60,213,179,232,12,6,5,98,216,92,204,105,249,124,207,194,25,12,74,41,62,5,51,2,195,213,179,130,138,10,217,242,96,6,3,235,14,39,9,194,122,150,67,6,195,148,86,32,112,132,34,105,193,140,24,144,154,14,79,245,44,58,131,65,129,24,54,23,115,90,62,223,179,112,6,131,82,138,79,193,140,192,112,245,172,160,162,66,182,60,152,193,192,186,195,73,130,176,158,229,144,193,48,165,21,8,28,161,72,145,193,48,5,51,98,64,106,58,60,213,179,232,12,6,5,98,216,92,204,105,249,124,207,194,25,12,74,41,62,5,51,2,195,213,179,130,138,10,217,242,96,6,3,235,14,39,9,194,122,150,67,6,195,148,86,32,112,132,34,69,6,195,20,204,136,1,169,233,240,84,207,162,51,24,20,136,97,115,49,167,229,243,61,11,103,48,40,165,248,20,204,8,12,87,207,10,42,42,188,122,109,40,131,129,215,210,225,36,65,216,181,116,14,25,12,115,45,93,32,112,45,50,51,131,97,10,134,27,80,159,177,57,29,62,239,152,230,177,12,6,5,130,22,128,109,90,62,65,71,3,25,12,74,41,62,5,51,2,195,230,89,54,88,65,68,133,108,121,48,131,129,117,135,147,4,97,61,203,33,131,97,74,43,16,56,66,145,34,131,97,10,102,196,128,212,116,120,170,103,209,25,12,10,196,176,185,152,211,242,249,158,133,51,24,148,82,124,10,102,4,134,171,103,5,21,21,178,229,193,12,134,249,217,228,203,120,150,67,6,195,148,86,32,112,132,34,105,193,140,24,144,154,14,79,245,44,58,131,65,129,24,54,23,115,90,62,223,179,112,6,131,82,138,79,193,140,192,112,245,172,160,162,66,182,60,152,193,192,186,195,73,130,176,158,229,144,193,48,165,21,8,28,161,72,145,193,48,5,51,98,64,106,58,60,213,179,232,12,6,5,98,216,92,204,105,249,124,207,194,25,12,74,41,62,5,51,2,195,213,179,130,138,10,217,242,96,6,3,235,14,39,9,194,122,150,67,6,195,148,86,32,112,132,34,69,6,195,20,204,136,1,169,233,240,84,207,162,51,24,20,136,97,115,49,167,229,243,61,11,103,48,40,165,248,20,204,8,12,87,207,10,42,42,188,95,106,40,131,129,119,111,225,36,65,216,221,91,14,25,12,115,247,86,32,112,45,50,51,131,97,10,134,27,80,159,177,57,29,62,239,35,51,99,25,12,10,4,45,0,219,180,124,130,142,6,50,24,148,82,124,10,102,4,134,205,179,108,176,130,136,10,217,242,96,6,3,235,14,39,9,194,122,150,67,6,195,148,86,32,112,132,34,69,6,195,20,204,136,1,169,233,240,84,207,162,51,24,20,136,97,115,49,167,229,243,61,11,103,48,40,165,248,20,204,8,12,87,207,10,42,42,100,203,131,25,12,172,59,156,36,8,235,89,14,25,12,83,90,129,192,17,138,164,5,51,98,64,106,58,60,213,179,232,12,6,5,98,216,92,204,105,249,124,207,194,25,12,74,41,62,5,51,2,195,213,179,130,138,10,217,242,96,6,3,235,14,39,9,194,122,150,67,6,195,148,86,32,112,132,34,69,6,195,20,204,136,1,169,233,240,84,207,162,51,24,20,136,97,115,49,167,229,243,61,11,103,48,40,165,248,20,204,8,12,87,207,10,42,42,100,203,131,25,12,172,59,156,36,8,235,89,14,25,12,83,90,129,192,17,138,20,25,12,83,48,35,6,164,166,195,83,61,139,206,96,80,32,134,205,197,156,150,207,247,44,156,193,160,148,226,83,48,35,48,92,61,43,168,168,240,9,29,67,25,12,124,94,8,78,18,132,61,47,196,33,131,97,158,23,18,8,92,139,204,204,96,152,130,225,6,212,103,108,78,135,207,251,68,230,88,6,131,2,65,11,192,54,45,159,160,163,129,12,6,165,20,159,130,25,129,97,243,44,27,172,32,162,66,182,60,152,193,
+208,78,235,125,184,212,137,69,14,25,12,83,90,129,192,17,138,20,25,12,83,48,35,6,164,166,195,83,61,139,206,96,80,32,134,205,197,156,150,207,247,44,156,193,160,148,226,83,48,35,48,92,61,43,168,168,144,45,15,102,48,176,238,112,146,32,172,103,57,100,48,76,105,5,2,71,40,146,22,204,136,1,169,233,240,84,207,162,51,24,20,136,97,115,49,167,229,243,61,11,103,48,40,165,248,20,204,8,12,87,207,10,42,42,100,203,131,25,12,172,59,156,36,8,235,89,14,25,12,83,90,129,192,17,138,20,25,12,83,48,35,6,164,166,195,83,61,139,206,96,80,32,134,205,197,156,150,207,247,44,156,193,160,148,226,83,48,35,48,92,61,43,168,168,144,45,15,102,48,176,238,112,146,32,172,103,57,100,48,76,105,5,2,71,40,82,100,48,76,193,140,24,144,154,14,79,245,44,58,131,65,129,24,54,23,115,90,62,223,179,112,6,131,82,138,79,193,140,192,112,245,172,160,162,226,0,183,249,232,46,18,86,133,204,96,192,253,49,227,101,117,206,209,154,68,227,152,193,128,195,99,109,25,12,143,224,90,100,102,6,195,20,12,55,160,62,99,115,58,204,106,56,122,86,143,41,97,55,20,8,90,0,182,105,249,4,29,13,100,48,40,165,248,20,204,8,12,155,103,217,96,5,17,21,178,229,193,12,6,214,29,78,18,132,245,44,135,12,134,41,173,64,224,8,69,138,12,134,41,152,17,3,82,211,225,169,158,69,103,48,40,16,195,230,98,78,203,231,123,22,206,96,80,74,241,41,152,17,24,174,158,21,84,84,200,150,7,51,24,88,119,56,73,16,214,179,28,50,24,166,180,2,129,35,20,73,11,102,196,128,212,116,120,170,103,209,25,12,10,196,176,185,152,211,242,249,158,133,51,24,148,82,124,10,102,4,134,171,103,5,21,21,178,229,193,12,6,214,29,78,18,132,245,44,135,12,134,41,173,64,224,8,69,138,12,134,41,152,17,3,82,211,225,169,158,69,103,48,40,16,195,230,98,78,203,231,123,22,206,96,80,74,241,41,152,17,24,174,158,21,84,84,200,150,7,51,24,88,119,56,73,16,214,179,28,50,24,166,180,2,129,35,20,41,50,24,166,96,70,12,72,77,135,167,122,22,157,193,160,64,12,155,139,57,45,159,239,89,56,131,65,41,197,167,96,70,96,184,122,86,80,81,137,79,149,174,243,177,12,6,171,66,102,48,224,254,152,241,178,58,231,104,77,162,113,204,96,192,103,93,108,25,12,143,224,90,100,102,6,195,20,12,55,160,62,227,222,116,120,157,59,122,86,143,41,97,55,20,8,90,0,182,105,249,4,29,13,100,48,40,165,248,20,204,8,12,155,103,217,96,5,17,21,178,229,193,12,6,214,29,78,18,132,245,44,135,12,134,41,173,64,224,8,69,138,12,134,41,152,17,3,106,167,195,19,61,139,206,96,80,32,134,205,197,156,150,207,247,44,156,193,160,148,226,83,48,35,48,92,61,43,168,168,144,45,15,102,48,176,238,112,146,32,172,103,57,100,48,76,105,5,2,71,40,146,22,204,136,1,181,211,225,137,158,69,103,48,40,16,195,230,98,78,203,231,123,22,206,96,80,74,241,41,152,17,24,174,158,21,84,84,200,150,7,51,24,88,119,56,73,16,214,179,28,50,24,166,180,2,129,35,20,41,50,24,166,96,70,12,168,157,14,79,244,44,58,131,65,129,24,54,23,115,90,62,223,179,112,6,131,82,138,79,193,140,192,112,245,172,160,162,66,182,60,152,193,192,186,195,73,130,176,158,229,144,193,48,165,21,8,28,161,72,145,193,48,5,51,98,64,237,116,120,162,103,209,25,12,10,196,176,185,152,211,242,249,158,133,51,24,148,82,124,10,102,4,134,171,103,5,17,149,250,111,95,110,142,121,26,213,31,115,118,243,16,55,77,90,21,112,117,179,201,182,219,197,250,203,184,120,90,221,2,178,172,203,62,253,250,183,119,80,218,1,169,210,230,200,154,53,213,49,141,178,109,148,28,171,232,79,95,69,135,42,61,69,149,96,167,40,195,224,182,35,206,187,203,57,116,223,135,201,80,250,102,6,163,150,203,1,72,46,163,160,61,57,116,216,129,83,128,110,105,253,98,247,86,34,68,40,5,45,35,217,205,18,254,136,35,103,34,204,175,107,210,231,250,144,70,178,56,173,254,156,110,162,93,85,30,15,53,209,87,141,47,234,36,112,135,95,119,192,31,126,
+252,5,31,233,226,17,7,7,17,23,31,220,187,205,42,211,140,88,193,96,87,5,151,137,157,60,155,43,183,164,180,168,211,213,89,221,235,154,144,236,120,113,254,52,218,89,141,243,180,46,79,69,162,66,101,188,219,85,55,233,167,172,110,48,132,59,6,225,65,58,46,136,160,99,249,230,221,119,188,54,138,100,87,219,99,145,52,89,89,8,98,73,121,138,171,69,122,139,243,90,233,29,74,182,193,191,247,87,175,210,215,221,189,232,203,175,218,160,253,63,88,219,101,122,119,205,170,212,175,161,20,10,57,229,250,184,95,164,175,121,193,109,191,224,150,23,220,245,11,56,169,83,91,32,153,212,183,203,154,151,36,109,237,164,60,22,141,36,84,104,213,225,163,86,9,39,243,23,237,254,23,139,211,221,178,224,5,183,90,193,159,23,245,235,229,233,47,188,196,108,113,43,90,72,45,157,238,175,82,165,7,46,186,251,190,64,43,23,121,38,39,173,235,74,13,74,148,155,219,78,42,205,38,61,41,129,109,238,204,251,178,62,150,213,134,9,107,195,239,87,168,39,201,137,221,21,93,169,53,81,85,168,127,172,76,235,97,213,239,96,125,92,143,25,205,50,218,137,139,50,131,145,113,170,155,234,150,187,105,87,219,221,186,112,21,133,69,152,217,114,183,76,151,219,37,60,26,148,197,89,43,223,154,149,239,6,42,223,25,149,79,119,54,164,132,137,114,81,9,43,21,100,164,173,82,4,52,163,165,42,232,214,75,213,208,205,216,66,195,110,207,74,177,180,198,43,119,133,143,235,59,57,209,34,71,110,208,9,76,115,6,166,22,176,251,3,161,70,236,27,93,181,187,94,53,67,109,157,183,212,155,2,151,125,245,21,43,92,242,160,38,74,107,92,154,109,89,196,46,210,188,78,89,173,98,121,11,227,81,229,96,186,200,185,227,213,200,243,176,202,237,206,39,165,126,239,20,184,69,218,84,169,132,231,114,225,95,228,90,112,207,238,90,112,228,62,25,184,123,5,42,112,247,10,84,224,150,5,174,129,27,87,135,179,252,149,15,224,251,154,233,227,2,205,226,141,22,179,2,183,93,158,201,73,235,250,115,5,110,16,213,220,192,221,239,164,123,224,134,218,206,214,165,85,113,10,220,100,101,91,224,38,43,219,2,119,31,233,153,129,219,36,128,141,150,172,208,15,220,102,141,126,224,38,104,120,8,220,99,10,31,215,119,114,162,69,254,34,3,55,188,249,9,18,184,135,157,239,172,192,45,178,242,74,37,252,85,1,252,139,92,139,79,34,172,174,5,115,29,50,112,247,10,84,224,238,21,168,192,45,11,92,3,55,174,14,71,152,42,31,192,247,53,211,199,5,154,197,27,45,102,5,110,187,60,147,147,214,245,231,10,220,32,170,185,129,187,223,73,247,192,13,181,157,173,75,171,226,20,184,201,202,182,192,77,86,182,5,238,62,210,51,3,183,73,0,27,45,89,161,31,184,205,26,253,192,77,208,240,16,184,199,20,62,174,239,228,68,139,252,69,6,110,200,242,6,9,220,195,206,119,86,224,22,47,125,148,74,248,155,40,248,23,185,22,220,179,187,22,28,176,68,6,238,94,129,10,220,189,2,21,184,101,129,107,224,198,213,225,228,38,229,3,248,190,102,250,184,64,179,120,163,197,172,192,109,151,103,114,210,186,254,92,129,27,68,53,55,112,247,59,233,30,184,161,182,179,117,105,85,156,2,55,89,217,22,184,201,202,182,192,221,71,122,102,224,54,9,96,163,37,43,244,3,183,89,163,31,184,9,26,30,2,247,152,194,199,245,157,156,104,145,191,200,192,13,239,173,131,4,238,97,231,59,43,112,139,119,138,74,37,252,69,39,252,139,92,11,238,217,93,11,246,149,147,129,187,87,160,2,119,175,64,5,110,89,224,26,184,113,117,216,176,174,124,0,223,215,76,31,23,104,22,111,180,152,21,184,237,242,76,78,90,215,159,43,112,131,168,230,6,238,126,39,221,3,55,212,118,182,46,173,138,83,224,38,43,219,2,55,89,217,22,184,251,72,207,12,220,38,1,108,180,100,133,126,224,54,107,244,3,55,65,195,67,224,30,83,248,184,190,147,19,45,242,23,25,184,97,89,68,144,192,61,236,124,103,5,110,216,178,210,169,4,174,174,225,95,228,90,112,207,238,90,176,157,134,12,220,189,2,21,184,123,5,42,112,203,2,215,192,141,171,195,62,29,229,3,248,190,102,250,184,64,179,120,163,197,172,192,109,151,103,114,
+210,186,254,92,129,27,68,53,55,112,247,59,233,30,184,161,182,179,117,105,85,156,2,55,89,217,22,184,201,202,182,192,221,71,122,102,224,54,9,96,163,37,43,244,3,183,89,163,31,184,9,26,30,2,247,152,194,199,245,157,156,104,145,191,200,192,13,59,240,130,4,238,97,231,59,43,112,195,74,189,78,37,112,117,13,255,34,215,130,123,118,215,130,85,132,100,224,238,21,168,192,221,43,80,129,91,22,184,6,110,92,29,150,39,42,31,192,247,53,211,199,5,154,197,27,45,102,5,110,187,60,147,147,214,245,231,10,220,32,170,185,129,187,223,73,247,192,13,181,157,173,75,171,226,20,184,201,202,182,192,77,86,182,5,238,62,210,51,3,183,73,0,27,45,89,161,31,184,205,26,253,192,77,208,240,16,184,199,20,62,174,239,228,68,139,252,69,6,110,88,120,28,36,112,15,59,95,47,112,103,69,158,21,105,212,234,166,254,152,175,210,226,148,85,101,1,235,19,23,215,139,34,222,75,217,215,77,245,251,242,20,231,71,116,13,156,120,21,81,112,205,144,100,69,125,72,147,230,102,151,54,111,49,165,14,19,110,0,216,241,181,0,107,192,224,120,97,17,230,161,74,243,227,38,5,98,252,191,255,11,125,219,115,197,
 0};
 unsigned char* mal_init_inline = 0;
 
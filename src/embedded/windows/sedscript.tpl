@@ -290,4 +290,8 @@ s|@zlib_CFLAGS@||
 s|@zlib_LIBS@||
 s|@liblzma_CFLAGS@||
 s|@liblzma_LIBS@||
+s|@liblz4_CFLAGS@||
+s|@liblz4_LIBS@||
+s|@libzstd_CFLAGS@||
+s|@libzstd_LIBS@||
 
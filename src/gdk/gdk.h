@@ -660,6 +660,7 @@ typedef struct {
 	storage_t newstorage;	/* new desired storage mode at re-allocation. */
 	bte dirty;		/* specific heap dirty marker */
 	bte farmid;		/* id of farm where heap is located */
+	bte advice;		/* access pattern last given to madvise */
 	bat parentid;		/* cache id of VIEW parent bat */
 } Heap;
 
@@ -675,6 +676,7 @@ typedef struct {
 } Hash;
 
 typedef struct Imprints Imprints;
+typedef struct Trigrams Trigrams;
 
 
 /*
@@ -885,6 +887,7 @@ typedef struct {
 	Heap *vheap;		/* space for the varsized data. */
 	Hash *hash;		/* hash table */
 	Imprints *imprints;	/* column imprints index */
+	Trigrams *trigrams;	/* trigram index on strings */
 
 	PROPrec *props;		/* list of dynamic properties stored in the bat descriptor */
 } COLrec;
@@ -1569,11 +1572,15 @@ gdk_export gdk_return BATgroup(BAT **groups, BAT **extents, BAT **histo, BAT *b,
  * The discriminative storage modes are memory-mapped, compressed, or
  * loaded in memory.  As can be seen in the bat record, each BAT has
  * one BUN-heap (@emph{bn}), and possibly two heaps (@emph{hh} and
- * @emph{th}) for variable-sized atoms.
+ * @emph{th}) for variable-sized atoms.  BATmadvise passes the access
+ * pattern an operator expects on to the OS for memory-mapped heaps;
+ * BATprefetch starts reading the part of those heaps a BAT covers.
  */
 
 gdk_export gdk_return BATsave(BAT *b);
 gdk_export void BATmsync(BAT *b);
+gdk_export void BATmadvise(BAT *b, int advice);
+gdk_export void BATprefetch(BAT *b, int vheap);
 
 gdk_export size_t BATmemsize(BAT *b, int dirty);
 
@@ -2075,6 +2082,28 @@ gdk_export gdk_return BAThash(BAT *b, BUN masksize);
 gdk_export gdk_return BATimprints(BAT *b);
 gdk_export lng IMPSimprintsize(BAT *b);
 
+/*
+ * @- Trigram Index Functions
+ *
+ * @multitable @columnfractions 0.08 0.7
+ * @item BAT*
+ * @tab
+ *  BATtrigrams (BAT *b)
+ * @item gdk_return
+ * @tab
+ *  BATtrigramselect (BAT **candp, BAT *b, BAT *s, const char *const *keys, int nkeys, int caseignore)
+ * @end multitable
+ *
+ * The trigram index on string columns.  BATtrigrams creates (and
+ * persists) the index; BATtrigramselect produces the candidate list
+ * of rows of b that may contain all strings in keys, and is used to
+ * speed up LIKE selections.  The index is not created implicitly
+ * unless the gdk_trigrams option is set.
+ */
+
+gdk_export gdk_return BATtrigrams(BAT *b);
+gdk_export gdk_return BATtrigramselect(BAT **candp, BAT *b, BAT *s, const char *const *keys, int nkeys, int caseignore);
+
 /*
  * @- Multilevel Storage Modes
  *
@@ -2461,6 +2490,7 @@ gdk_export void GDKerror(_In_z_ _Printf_format_string_ const char *format, ...)
 	__attribute__((__format__(__printf__, 1, 2)));
 gdk_export void GDKsyserror(_In_z_ _Printf_format_string_ const char *format, ...)
 	__attribute__((__format__(__printf__, 1, 2)));
+gdk_export void GDKclrerr(void);
 #ifndef HAVE_EMBEDDED
 __declspec(noreturn) gdk_export void GDKfatal(_In_z_ _Printf_format_string_ const char *format, ...)
 	__attribute__((__format__(__printf__, 1, 2)))
@@ -3012,6 +3042,7 @@ gdk_export void ALIGNsetH(BAT *b1, BAT *b2);
 
 gdk_export void PROPdestroy(PROPrec *p);
 gdk_export PROPrec *BATgetprop(BAT *b, int idx);
+gdk_export ValPtr BATgetpropval(BAT *b, int idx);
 gdk_export void BATsetprop(BAT *b, int idx, int type, void *v);
 
 /*
@@ -3038,6 +3069,7 @@ gdk_export void BATsetprop(BAT *b, int idx, int type, void *v);
 
 gdk_export BAT *BATselect(BAT *b, BAT *s, const void *tl, const void *th, int li, int hi, int anti);
 gdk_export BAT *BATthetaselect(BAT *b, BAT *s, const void *val, const char *op);
+gdk_export BAT *BATrangediff(oid first, BUN cnt, BAT *d);
 
 gdk_export BAT *BATconstant(oid hseq, int tt, const void *val, BUN cnt, int role);
 gdk_export gdk_return BATsubcross(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl, BAT *sr);
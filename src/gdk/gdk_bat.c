@@ -413,6 +413,7 @@ BATextend(BAT *b, BUN newcap)
 		return GDK_FAIL;
 	HASHdestroy(b);
 	IMPSdestroy(b);
+	TRGMdestroy(b);
 	return GDK_SUCCEED;
 }
 
@@ -439,6 +440,7 @@ BATclear(BAT *b, int force)
 	/* kill all search accelerators */
 	HASHdestroy(b);
 	IMPSdestroy(b);
+	TRGMdestroy(b);
 
 	/* we must dispose of all inserted atoms */
 	if ((b->batDeleted == b->batInserted || force) &&
@@ -517,6 +519,7 @@ BATfree(BAT *b)
 	b->T->props = NULL;
 	HASHfree(b);
 	IMPSfree(b);
+	TRGMfree(b);
 	if (b->htype)
 		HEAPfree(&b->H->heap, 0);
 	else
@@ -1066,6 +1069,7 @@ BUNappend(BAT *b, const void *t, bit force)
 
 
 	IMPSdestroy(b); /* no support for inserts in imprints yet */
+	TRGMdestroy(b);
 
 	/* first adapt the hashes; then the user-defined accelerators.
 	 * REASON: some accelerator updates (qsignature) use the hashes!
@@ -1128,6 +1132,7 @@ BUNdelete(BAT *b, oid o)
 		}
 	}
 	IMPSdestroy(b);
+	TRGMdestroy(b);
 	HASHdestroy(b);
 	return GDK_SUCCEED;
 }
@@ -1167,6 +1172,7 @@ BUNinplace(BAT *b, BUN p, const void *t, bit force)
 		b->T->nil = 0;
 	}
 	HASHremove(b);
+	TRGMdestroy(b);
 	Treplacevalue(b, BUNtloc(bi, p), t);
 
 	tt = b->ttype;
@@ -424,6 +424,7 @@ BATappend(BAT *b, BAT *n, bit force)
 	}
 
 	IMPSdestroy(b);		/* imprints do not support updates yet */
+	TRGMdestroy(b);
 
 	/* append two void,void bats */
 	if (b->ttype == TYPE_void && BATtdense(b)) {
@@ -1392,6 +1393,15 @@ BATgetprop(BAT *b, int idx)
 	return NULL;
 }
 
+/* the value of property idx, or NULL if it is not set */
+ValPtr
+BATgetpropval(BAT *b, int idx)
+{
+	PROPrec *p = BATgetprop(b, idx);
+
+	return p ? &p->v : NULL;
+}
+
 void
 BATsetprop(BAT *b, int idx, int type, void *v)
 {
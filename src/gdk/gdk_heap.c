@@ -197,6 +197,9 @@ HEAPextend(Heap *h, size_t size, int mayshare)
 		if (p) {
 			h->size = size;
 			h->base = p;
+			/* the mapping may have been replaced */
+			if (h->advice != MMAP_NORMAL)
+				(void) MT_madvise(h->base, h->size, h->advice);
  			return GDK_SUCCEED; /* success */
  		}
 		failure = "GDKmremap() failed";
@@ -576,6 +579,7 @@ HEAPfree(Heap *h, int remove)
 		}
 	}
 	h->base = NULL;
+	h->advice = MMAP_NORMAL;
 	if (h->filename) {
 		if (remove) {
 			char *path = GDKfilepath(h->farmid, BATDIR, h->filename, NULL);
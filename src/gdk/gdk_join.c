@@ -2764,6 +2764,9 @@ hashjoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 
 	if (BAThash(r, 0) != GDK_SUCCEED)
 		goto bailout;
+	/* r is only accessed through the hash chains, scans of r
+	 * declare sequential access again */
+	BATmadvise(r, MMAP_RANDOM);
 	ri = bat_iterator(r);
 	nrcand = (BUN) (rcandend - rcand);
 	hsh = r->T->hash;
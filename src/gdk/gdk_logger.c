@@ -74,6 +74,7 @@
 #define LOG_USE		8
 #define LOG_CLEAR	9
 #define LOG_SEQ		10
+#define LOG_INSERT_PACKED	11
 
 #ifdef HAVE_EMBEDDED
 #define printf(fmt,...) ((void) 0)
@@ -91,6 +92,7 @@ static char *log_commands[] = {
 	"LOG_USE",
 	"LOG_CLEAR",
 	"LOG_SEQ",
+	"LOG_INSERT_PACKED",
 };
 
 typedef struct logformat_t {
@@ -222,6 +224,182 @@ log_write_string(logger *l, const char *n)
 	return LOG_OK;
 }
 
+/*
+ * Large appends to integer-like columns (including oids, dates and
+ * the like) are logged packed, as LOG_INSERT_PACKED records.  The
+ * values are cut in blocks of at most LOG_PACK_BLOCK values, each
+ * written as its count, a bit width and the smallest value, followed
+ * by the differences from that value in as few bits as the block
+ * needs (frame of reference with bit packing).  Keys, dates, codes
+ * and foreign keys shrink to a fraction of their size, and the log
+ * replay fills the column a block at a time.
+ */
+#define LOG_PACK_MIN	1024	/* smaller appends are logged as is */
+#define LOG_PACK_BLOCK	65536
+
+static int
+log_packable(int tt)
+{
+	if (tt == TYPE_void || ATOMvarsized(tt))
+		return 0;
+	switch (ATOMstorage(tt)) {
+	case TYPE_bte:
+	case TYPE_sht:
+	case TYPE_int:
+	case TYPE_lng:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+static inline lng
+log_pack_get(const void *vals, int sz, BUN i)
+{
+	switch (sz) {
+	case 1:
+		return ((const bte *) vals)[i];
+	case 2:
+		return ((const sht *) vals)[i];
+	case 4:
+		return ((const int *) vals)[i];
+	default:
+		return ((const lng *) vals)[i];
+	}
+}
+
+static inline void
+log_pack_put(void *vals, int sz, BUN i, lng v)
+{
+	switch (sz) {
+	case 1:
+		((bte *) vals)[i] = (bte) v;
+		break;
+	case 2:
+		((sht *) vals)[i] = (sht) v;
+		break;
+	case 4:
+		((int *) vals)[i] = (int) v;
+		break;
+	default:
+		((lng *) vals)[i] = v;
+		break;
+	}
+}
+
+static int
+log_write_packed(logger *lg, const void *vals, int tt, BUN nr)
+{
+	int sz = ATOMsize(tt);
+	ulng *words = GDKmalloc(LOG_PACK_BLOCK * sizeof(ulng));
+	BUN i, j, n;
+
+	if (words == NULL) {
+		fprintf(stderr, "!ERROR: log_write_packed: malloc failed\n");
+		return LOG_ERR;
+	}
+	for (i = 0; i < nr; i += n) {
+		lng v, min, max;
+		ulng range;
+		bte bits = 0;
+		size_t nw;
+
+		n = nr - i < LOG_PACK_BLOCK ? nr - i : LOG_PACK_BLOCK;
+		min = max = log_pack_get(vals, sz, i);
+		for (j = 1; j < n; j++) {
+			v = log_pack_get(vals, sz, i + j);
+			if (v < min)
+				min = v;
+			else if (v > max)
+				max = v;
+		}
+		range = (ulng) max - (ulng) min;
+		while (bits < 64 && (range >> bits) != 0)
+			bits++;
+		nw = ((size_t) n * bits + 63) / 64;
+		memset(words, 0, nw * sizeof(ulng));
+		for (j = 0; bits && j < n; j++) {
+			ulng d = (ulng) log_pack_get(vals, sz, i + j) - (ulng) min;
+			size_t bit = (size_t) j * bits;
+
+			words[bit / 64] |= d << (bit % 64);
+			if (bit % 64 + bits > 64)
+				words[bit / 64 + 1] = d >> (64 - bit % 64);
+		}
+		if (!mnstr_writeInt(lg->log, (int) n) ||
+		    mnstr_write(lg->log, &bits, 1, 1) != 1 ||
+		    !mnstr_writeLng(lg->log, min) ||
+		    (nw && !mnstr_writeLngArray(lg->log, (const lng *) words, nw))) {
+			GDKfree(words);
+			fprintf(stderr, "!ERROR: log_write_packed: write failed\n");
+			return LOG_ERR;
+		}
+	}
+	GDKfree(words);
+	return LOG_OK;
+}
+
+/* read nr packed values into the empty bat r */
+static int
+log_read_packed(logger *lg, BAT *r, lng nr)
+{
+	int sz = ATOMsize(r->ttype);
+	ulng *words;
+	void *vals;
+	lng i = 0;
+
+	if (BATextend(r, (BUN) nr) != GDK_SUCCEED ||
+	    (words = GDKmalloc(LOG_PACK_BLOCK * sizeof(ulng))) == NULL) {
+		fprintf(stderr, "!ERROR: log_read_packed: malloc failed\n");
+		return LOG_ERR;
+	}
+	vals = Tloc(r, BUNfirst(r));
+	while (i < nr) {
+		int n, j;
+		bte bits;
+		lng min;
+		size_t nw;
+		ulng mask;
+
+		if (mnstr_readInt(lg->log, &n) != 1 ||
+		    n <= 0 || n > LOG_PACK_BLOCK || n > nr - i ||
+		    mnstr_read(lg->log, &bits, 1, 1) != 1 ||
+		    bits < 0 || bits > 64 ||
+		    mnstr_readLng(lg->log, &min) != 1)
+			break;
+		nw = ((size_t) n * bits + 63) / 64;
+		if (nw && mnstr_readLngArray(lg->log, (lng *) words, nw) != 1)
+			break;
+		mask = bits == 64 ? ~(ulng) 0 : ((ulng) 1 << bits) - 1;
+		for (j = 0; j < n; j++) {
+			ulng d = 0;
+
+			if (bits) {
+				size_t bit = (size_t) j * bits;
+
+				d = words[bit / 64] >> (bit % 64);
+				if (bit % 64 + bits > 64)
+					d |= words[bit / 64 + 1] << (64 - bit % 64);
+				d &= mask;
+			}
+			log_pack_put(vals, sz, (BUN) (i + j), (lng) ((ulng) min + d));
+		}
+		i += n;
+	}
+	GDKfree(words);
+	if (i < nr) {
+		fprintf(stderr, "!ERROR: log_read_packed: read failed\n");
+		return LOG_ERR;
+	}
+	BATsetcount(r, (BUN) nr);
+	r->tsorted = r->trevsorted = 0;
+	r->tkey = 0;
+	r->T->dense = 0;
+	r->T->nil = 0;
+	r->T->nonil = 0;
+	return LOG_OK;
+}
+
 static void
 log_read_clear(logger *lg, trans *tr, char *name)
 {
@@ -310,7 +488,7 @@ log_read_updates(logger *lg, trans *tr, logformat *l, char *name)
 	int ht = -1, tt = -1, hseq = 0, tseq = 0;
 
 	if (lg->debug & 1)
-		fprintf(stderr, "#logger found log_read_updates %s %s " LLFMT "\n", name, l->flag == LOG_INSERT ? "insert" : "update", l->nr);
+		fprintf(stderr, "#logger found log_read_updates %s %s " LLFMT "\n", name, l->flag == LOG_UPDATE ? "update" : "insert", l->nr);
 
 	if (b) {
 		ht = b->htype;
@@ -339,6 +517,7 @@ log_read_updates(logger *lg, trans *tr, logformat *l, char *name)
 		}
 	}
 	assert((ht == TYPE_void && l->flag == LOG_INSERT) ||
+	       (ht == TYPE_void && l->flag == LOG_INSERT_PACKED) ||
 	       ((ht == TYPE_oid || !ht) && l->flag == LOG_UPDATE));
 	if (ht >= 0 && tt >= 0) {
 		BAT *uid = NULL;
@@ -368,7 +547,29 @@ log_read_updates(logger *lg, trans *tr, logformat *l, char *name)
 		if (tseq)
 			BATseqbase(BATmirror(r), 0);
 
-		if (ht == TYPE_void && l->flag == LOG_INSERT) {
+		if (l->flag == LOG_INSERT_PACKED) {
+			if (r == NULL || !log_packable(tt) ||
+			    log_read_packed(lg, r, l->nr) != LOG_OK)
+				res = LOG_ERR;
+			l->flag = LOG_INSERT;
+			l->nr = 0;
+		} else if (ht == TYPE_void && l->flag == LOG_INSERT &&
+			   r != NULL && tt > TYPE_void && tt < TYPE_str &&
+			   !lg->read32bitoid) {
+			/* fixed size values are read in one go */
+			if (BATextend(r, (BUN) l->nr) != GDK_SUCCEED ||
+			    rt(Tloc(r, BUNfirst(r)), lg->log, (size_t) l->nr) == NULL) {
+				res = LOG_ERR;
+			} else {
+				BATsetcount(r, (BUN) l->nr);
+				r->tsorted = r->trevsorted = 0;
+				r->tkey = 0;
+				r->T->dense = 0;
+				r->T->nil = 0;
+				r->T->nonil = 0;
+			}
+			l->nr = 0;
+		} else if (ht == TYPE_void && l->flag == LOG_INSERT) {
 			for (; l->nr > 0; l->nr--) {
 				void *t = rt(tv, lg->log, 1);
 
@@ -452,20 +653,13 @@ log_read_updates(logger *lg, trans *tr, logformat *l, char *name)
 	return res;
 }
 
+/* apply the inserts or updates of la to bat bid, no catalog access
+ * here as this is called by the parallel replay threads */
 static void
-la_bat_updates(logger *lg, logaction *la)
+la_bat_updates(log_bid bid, logaction *la)
 {
-	log_bid bid = logger_find_bat(lg, la->name);
-	BAT *b;
-
-	if (bid == 0)
-		return;		/* ignore bats no longer in the catalog */
-
-	/* do we need to skip these old updates */
-	if (avoid_snapshot(lg, bid))
-		return;
+	BAT *b = BATdescriptor(bid);
 
-	b = BATdescriptor(bid);
 	assert(b);
 	if (b) {
 		if (b->htype == TYPE_void && la->type == LOG_INSERT) {
@@ -711,10 +905,6 @@ static void
 la_apply(logger *lg, logaction *c)
 {
 	switch (c->type) {
-	case LOG_INSERT:
-	case LOG_UPDATE:
-		la_bat_updates(lg, c);
-		break;
 	case LOG_CREATE:
 		la_bat_create(lg, c);
 		break;
@@ -738,6 +928,8 @@ la_destroy(logaction *c)
 		GDKfree(c->name);
 	if (c->b)
 		logbat_destroy(c->b);
+	if (c->uid)
+		logbat_destroy(c->uid);
 }
 
 static int
@@ -752,6 +944,7 @@ tr_grow(trans *tr)
 	/* cleanup the next */
 	tr->changes[tr->nr].name = NULL;
 	tr->changes[tr->nr].b = NULL;
+	tr->changes[tr->nr].uid = NULL;
 	return 1;
 }
 
@@ -765,8 +958,194 @@ tr_destroy(trans *tr)
 	return r;
 }
 
+/* Replay of committed transactions.  Catalog changes (create, use,
+ * destroy and clear) are applied in log order when the transaction
+ * commits, so that the records that follow are decoded against the
+ * right catalog.  Inserts and updates are only collected per bat and
+ * applied in bulk at the end of the log file (or once REPLAY_MAXROWS
+ * rows are pending), by several threads which each take whole bats.
+ * Updates of a bat which is destroyed or cleared later in the log are
+ * dropped without ever being applied. */
+#define REPLAY_MAXROWS	((BUN) 1 << 24)
+
+typedef struct replay {
+	log_bid bid;
+	int nr;			/* nr of pending updates */
+	int sz;
+	logaction *changes;	/* pending updates in log order */
+} replay;
+
+typedef struct replay_set {
+	int nr;			/* nr of bats with pending updates */
+	int sz;
+	replay *bats;
+	int *map;		/* bid -> index in bats + 1 */
+	int mapsz;
+	BUN rows;		/* total nr of pending rows */
+	MT_Lock lock;		/* hands out bats to the threads */
+	int next;
+} replay_set;
+
+static void
+replay_init(replay_set *rs)
+{
+	rs->nr = rs->sz = 0;
+	rs->bats = NULL;
+	rs->map = NULL;
+	rs->mapsz = 0;
+	rs->rows = 0;
+	rs->next = 0;
+	MT_lock_init(&rs->lock, "logger_replay");
+}
+
+static void
+replay_drop(replay_set *rs, log_bid bid)
+{
+	replay *r;
+	int i;
+
+	if (bid <= 0 || bid >= rs->mapsz || rs->map[bid] == 0)
+		return;
+	r = &rs->bats[rs->map[bid] - 1];
+	for (i = 0; i < r->nr; i++) {
+		rs->rows -= BATcount(r->changes[i].b);
+		la_destroy(&r->changes[i]);
+	}
+	r->nr = 0;
+}
+
+/* apply the pending updates of bat bid right away, in log order */
+static void
+replay_flush(replay_set *rs, log_bid bid)
+{
+	replay *r;
+	int i;
+
+	if (bid <= 0 || bid >= rs->mapsz || rs->map[bid] == 0)
+		return;
+	r = &rs->bats[rs->map[bid] - 1];
+	for (i = 0; i < r->nr; i++) {
+		rs->rows -= BATcount(r->changes[i].b);
+		la_bat_updates(r->bid, &r->changes[i]);
+		la_destroy(&r->changes[i]);
+	}
+	r->nr = 0;
+}
+
+/* move the update la into the replay set, on failure it stays with la */
+static int
+replay_add(replay_set *rs, log_bid bid, logaction *la)
+{
+	replay *r;
+
+	if (bid >= rs->mapsz) {
+		int sz = (bid + 1024) & ~1023, *map;
+
+		if ((map = GDKrealloc(rs->map, sz * sizeof(int))) == NULL)
+			return LOG_ERR;
+		memset(map + rs->mapsz, 0, (sz - rs->mapsz) * sizeof(int));
+		rs->map = map;
+		rs->mapsz = sz;
+	}
+	if (rs->map[bid] == 0) {
+		if (rs->nr == rs->sz) {
+			int sz = rs->sz ? rs->sz * 2 : 64;
+			replay *bats;
+
+			if ((bats = GDKrealloc(rs->bats, sz * sizeof(replay))) == NULL)
+				return LOG_ERR;
+			rs->bats = bats;
+			rs->sz = sz;
+		}
+		r = &rs->bats[rs->nr++];
+		r->bid = bid;
+		r->nr = r->sz = 0;
+		r->changes = NULL;
+		rs->map[bid] = rs->nr;
+	}
+	r = &rs->bats[rs->map[bid] - 1];
+	if (r->nr == r->sz) {
+		int sz = r->sz ? r->sz * 2 : 8;
+		logaction *changes;
+
+		if ((changes = GDKrealloc(r->changes, sz * sizeof(logaction))) == NULL)
+			return LOG_ERR;
+		r->changes = changes;
+		r->sz = sz;
+	}
+	r->changes[r->nr] = *la;
+	r->changes[r->nr].name = NULL;
+	r->nr++;
+	rs->rows += BATcount(la->b);
+	la->b = la->uid = NULL;
+	return LOG_OK;
+}
+
+static void
+replay_worker(void *arg)
+{
+	replay_set *rs = arg;
+
+	for (;;) {
+		replay *r;
+		int i;
+
+		MT_lock_set(&rs->lock);
+		i = rs->next++;
+		MT_lock_unset(&rs->lock);
+		if (i >= rs->nr)
+			break;
+		r = &rs->bats[i];
+		for (i = 0; i < r->nr; i++) {
+			la_bat_updates(r->bid, &r->changes[i]);
+			la_destroy(&r->changes[i]);
+		}
+		r->nr = 0;
+	}
+}
+
+/* apply all pending updates, one bat per thread at a time */
+static void
+replay_apply(logger *lg, replay_set *rs)
+{
+	MT_Id tids[16];
+	int i, n = GDKnr_threads;
+
+	if (n > (int) (sizeof(tids) / sizeof(tids[0])))
+		n = (int) (sizeof(tids) / sizeof(tids[0]));
+	if (n > rs->nr)
+		n = rs->nr;
+	if (lg->debug & 1)
+		fprintf(stderr, "#replay_apply %d bats " BUNFMT " rows %d threads\n",
+			rs->nr, rs->rows, n);
+	rs->next = 0;
+	for (i = 1; i < n; i++)
+		if (MT_create_thread(&tids[i], replay_worker, rs, MT_THR_JOINABLE) < 0)
+			break;
+	n = i;
+	replay_worker(rs);
+	for (i = 1; i < n; i++)
+		MT_join_thread(tids[i]);
+	for (i = 0; i < rs->nr; i++)
+		GDKfree(rs->bats[i].changes);
+	memset(rs->map, 0, rs->mapsz * sizeof(int));
+	rs->nr = rs->sz = 0;
+	GDKfree(rs->bats);
+	rs->bats = NULL;
+	rs->rows = 0;
+}
+
+static void
+replay_destroy(logger *lg, replay_set *rs)
+{
+	if (rs->nr)
+		replay_apply(lg, rs);
+	GDKfree(rs->map);
+	MT_lock_destroy(&rs->lock);
+}
+
 static trans *
-tr_commit(logger *lg, trans *tr)
+tr_commit(logger *lg, trans *tr, replay_set *rs)
 {
 	int i;
 
@@ -774,9 +1153,50 @@ tr_commit(logger *lg, trans *tr)
 		fprintf(stderr, "#tr_commit\n");
 
 	for (i = 0; i < tr->nr; i++) {
-		la_apply(lg, &tr->changes[i]);
-		la_destroy(&tr->changes[i]);
+		logaction *la = &tr->changes[i];
+		log_bid bid;
+
+		switch (la->type) {
+		case LOG_INSERT:
+		case LOG_UPDATE:
+			bid = logger_find_bat(lg, la->name);
+			/* ignore bats no longer in the catalog and
+			 * skip old updates of snapshot bats */
+			if (bid != 0 && !avoid_snapshot(lg, bid) &&
+			    replay_add(rs, bid, la) != LOG_OK) {
+				/* out of memory, apply right away
+				 * after the ones still pending */
+				replay_flush(rs, bid);
+				la_bat_updates(bid, la);
+			}
+			lg->changes++;
+			break;
+		case LOG_CREATE:
+		case LOG_USE:
+			/* the name moves to another bat, the old one
+			 * leaves the catalog and its bid may be reused */
+			bid = logger_find_bat(lg, la->name);
+			if (la->type == LOG_CREATE || bid != (log_bid) la->nr)
+				replay_drop(rs, bid);
+			la_apply(lg, la);
+			break;
+		case LOG_DESTROY:
+			replay_drop(rs, logger_find_bat(lg, la->name));
+			la_apply(lg, la);
+			break;
+		case LOG_CLEAR:
+			bid = logger_find_bat(lg, la->name);
+			if (!avoid_snapshot(lg, bid))
+				replay_drop(rs, bid);
+			la_apply(lg, la);
+			break;
+		default:
+			la_apply(lg, la);
+		}
+		la_destroy(la);
 	}
+	if (rs->rows > REPLAY_MAXROWS)
+		replay_apply(lg, rs);
 	return tr_destroy(tr);
 }
 
@@ -886,6 +1306,8 @@ logger_close(logger *lg)
 	stream *log = lg->log;
 
 	if (log) {
+		/* group committers may still be syncing this log */
+		(void) log_sync(lg, log_commits(lg));
 		close_stream(log);
 	}
 	lg->log = NULL;
@@ -900,6 +1322,7 @@ logger_readlog(logger *lg, char *filename)
 	time_t t0, t1;
 	struct stat sb;
 	lng fpos;
+	replay_set rs;
 
 	if (lg->debug & 1) {
 		fprintf(stderr, "#logger_readlog opening %s\n", filename);
@@ -927,6 +1350,7 @@ logger_readlog(logger *lg, char *filename)
 		printf("# Start reading the write-ahead log '%s'\n", filename);
 		fflush(stdout);
 	}
+	replay_init(&rs);
 	while (!err && log_read_format(lg, &l)) {
 		char *name = NULL;
 
@@ -977,12 +1401,13 @@ logger_readlog(logger *lg, char *filename)
 			else if (l.tid != l.nr)	/* abort record */
 				tr = tr_abort(lg, tr);
 			else
-				tr = tr_commit(lg, tr);
+				tr = tr_commit(lg, tr, &rs);
 			break;
 		case LOG_SEQ:
 			err = (log_read_seq(lg, &l) != LOG_OK);
 			break;
 		case LOG_INSERT:
+		case LOG_INSERT_PACKED:
 		case LOG_UPDATE:
 			if (name == NULL || tr == NULL)
 				err = 1;
@@ -1024,6 +1449,8 @@ logger_readlog(logger *lg, char *filename)
 	/* remaining transactions are not committed, ie abort */
 	while (tr)
 		tr = tr_abort(lg, tr);
+	/* apply the updates of the committed ones */
+	replay_destroy(lg, &rs);
 	t0 = time(NULL);
 	if (lg->debug & 1) {
 		printf("# Finished reading the write-ahead log '%s'\n", filename);
@@ -1934,6 +2361,14 @@ logger_new(int debug, const char *fn, const char *logdir, int version, preversio
 	lg->seqs_val = NULL;
 	lg->dseqs = NULL;
 
+	lg->commit_delay = -1;
+	lg->written = 0;
+	lg->synced = 0;
+	lg->syncing = 0;
+	lg->waiters = 0;
+	MT_lock_init(&lg->sync_lock, "logger_sync");
+	MT_sema_init(&lg->sync_sema, 0, "logger_sync");
+
 	if (logger_load(debug, fn, filename, lg) == LOG_OK) {
 		return lg;
 	}
@@ -2029,6 +2464,8 @@ logger_destroy(logger *lg)
 	GDKfree(lg->fn);
 	GDKfree(lg->dir);
 	logger_close(lg);
+	MT_lock_destroy(&lg->sync_lock);
+	MT_sema_destroy(&lg->sync_sema);
 	GDKfree(lg);
 }
 
@@ -2478,12 +2915,22 @@ log_bat(logger *lg, BAT *b, const char *name)
 		gdk_return (*wh) (const void *, stream *, size_t) = BATatoms[b->htype].atomWrite;
 		gdk_return (*wt) (const void *, stream *, size_t) = BATatoms[b->ttype].atomWrite;
 
-		l.flag = LOG_INSERT;
+		int packed = b->htype == TYPE_void &&
+			l.nr >= LOG_PACK_MIN &&
+			log_packable(b->ttype) &&
+			!isVIEW(b);
+
+		l.flag = packed ? LOG_INSERT_PACKED : LOG_INSERT;
 		if (log_write_format(lg, &l) == LOG_ERR ||
 		    log_write_string(lg, name) == LOG_ERR)
 			return LOG_ERR;
 
-		if (b->htype == TYPE_void &&
+		if (packed) {
+			const void *t = BUNtail(bi, b->batInserted);
+
+			if (log_write_packed(lg, t, b->ttype, (BUN) l.nr) != LOG_OK)
+				ok = GDK_FAIL;
+		} else if (b->htype == TYPE_void &&
 		    b->ttype > TYPE_void &&
 		    b->ttype < TYPE_str &&
 		    !isVIEW(b)) {
@@ -2626,17 +3073,96 @@ log_tend(logger *lg)
 	l.tid = lg->tid;
 	l.nr = lg->tid;
 
+	/* with group commit the fsync is left to log_sync */
 	if (res != GDK_SUCCEED ||
 	    log_write_format(lg, &l) == LOG_ERR ||
 	    mnstr_flush(lg->log) ||
-	    mnstr_fsync(lg->log) ||
+	    (lg->commit_delay < 0 && mnstr_fsync(lg->log)) ||
 	    pre_allocate(lg) != GDK_SUCCEED) {
 		fprintf(stderr, "!ERROR: log_tend: write failed\n");
 		return LOG_ERR;
 	}
+	MT_lock_set(&lg->sync_lock);
+	lg->written++;
+	if (lg->commit_delay < 0)
+		lg->synced = lg->written;
+	MT_lock_unset(&lg->sync_lock);
 	return LOG_OK;
 }
 
+/* Group commit.  With a commit delay of 0 or more milliseconds
+ * log_tend no longer fsyncs the log itself.  Instead the committer
+ * remembers log_commits() while it still holds the transaction lock
+ * and calls log_sync after releasing it.  The first committer to
+ * arrive there becomes the flusher: it waits at most the commit delay
+ * for others to join (only when others are pending), fsyncs once for
+ * all commits written so far and wakes all waiters. */
+void
+log_commit_delay(logger *lg, int ms)
+{
+	MT_lock_set(&lg->sync_lock);
+	lg->commit_delay = ms;
+	MT_lock_unset(&lg->sync_lock);
+}
+
+lng
+log_commits(logger *lg)
+{
+	lng nr;
+
+	MT_lock_set(&lg->sync_lock);
+	nr = lg->written;
+	MT_lock_unset(&lg->sync_lock);
+	return nr;
+}
+
+int
+log_sync(logger *lg, lng nr)
+{
+	int res = LOG_OK;
+
+	MT_lock_set(&lg->sync_lock);
+	while (res == LOG_OK && lg->synced < nr) {
+		lng upto;
+		int waiters;
+
+		if (lg->syncing) {
+			/* a flusher is active, wait for it and recheck */
+			lg->waiters++;
+			MT_lock_unset(&lg->sync_lock);
+			MT_sema_down(&lg->sync_sema);
+			MT_lock_set(&lg->sync_lock);
+			continue;
+		}
+		lg->syncing = 1;
+		if (lg->commit_delay > 0 && lg->written - lg->synced > 1) {
+			MT_lock_unset(&lg->sync_lock);
+			MT_sleep_ms(lg->commit_delay);
+			MT_lock_set(&lg->sync_lock);
+		}
+		upto = lg->written;
+		if (lg->debug & 1)
+			fprintf(stderr, "#log_sync " LLFMT " commits\n",
+				upto - lg->synced);
+		MT_lock_unset(&lg->sync_lock);
+
+		if (mnstr_fsync(lg->log))
+			res = LOG_ERR;
+
+		MT_lock_set(&lg->sync_lock);
+		lg->syncing = 0;
+		if (res == LOG_OK && upto > lg->synced)
+			lg->synced = upto;
+		for (waiters = lg->waiters; waiters > 0; waiters--)
+			MT_sema_up(&lg->sync_sema);
+		lg->waiters = 0;
+	}
+	MT_lock_unset(&lg->sync_lock);
+	if (res != LOG_OK)
+		fprintf(stderr, "!ERROR: log_sync: fsync failed\n");
+	return res;
+}
+
 int
 log_abort(logger *lg)
 {
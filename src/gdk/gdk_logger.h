@@ -78,6 +78,17 @@ typedef struct logger {
 				   commit). */
 	void *buf;
 	size_t bufsize;
+
+	/* group commit: with commit_delay >= 0 log_tend only flushes,
+	 * committers then wait in log_sync for a single fsync which
+	 * covers all of them */
+	int commit_delay;	/* max ms to gather commits, -1 fsync in log_tend */
+	lng written;		/* nr of commits written to the log */
+	lng synced;		/* nr of commits known to be on disk */
+	int syncing;		/* a committer is running the fsync */
+	int waiters;		/* committers waiting for that fsync */
+	MT_Lock sync_lock;
+	MT_Sema sync_sema;
 } logger;
 
 /* Holds logger settings
@@ -88,6 +99,7 @@ typedef struct logger_settings {
 	char *shared_logdir;	/* shared write-ahead log directory */
 	int	shared_drift_threshold; /* shared write-ahead log drift threshold */
 	int keep_persisted_log_files; 	/* a flag if old WAL files should be preserved */
+	int commit_delay;	/* group commit delay in ms, -1 to fsync each commit */
 } logger_settings;
 
 #define BATSIZE 0
@@ -132,6 +144,9 @@ gdk_export int log_delta(logger *lg, BAT *uid, BAT *uval, const char *n);
 gdk_export int log_tstart(logger *lg);	/* TODO return transaction id */
 gdk_export int log_tend(logger *lg);
 gdk_export int log_abort(logger *lg);
+gdk_export void log_commit_delay(logger *lg, int ms);
+gdk_export lng log_commits(logger *lg);
+gdk_export int log_sync(logger *lg, lng nr);
 
 gdk_export int log_sequence(logger *lg, int seq, lng id);
 
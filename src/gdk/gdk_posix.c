@@ -368,12 +368,43 @@ MT_mmap(const char *path, int mode, size_t len)
 	if (ret == MAP_FAILED) {
 		GDKsyserror("MT_mmap: mmap(%s,"SZFMT") failed\n", path, len);
 		ret = NULL;
+	} else {
+		/* the advice is only a hint, so failures are ignored */
+		if (mode & MMAP_ADVISE)
+			(void) posix_madvise(ret, len, mode & MMAP_ADVISE);
+#ifdef MADV_HUGEPAGE
+		/* fewer TLB misses on large heaps; the kernel only
+		 * honours this where it supports huge pages for the
+		 * underlying file system */
+		if ((mode & MMAP_HUGEPAGE) && len >= MT_HUGEPAGE_SIZE)
+			(void) madvise(ret, len, MADV_HUGEPAGE);
+#endif
 	}
 	close(fd);
 	VALGRIND_MALLOCLIKE_BLOCK(ret, len, 0, 1);
 	return ret;
 }
 
+/* Tell the OS how a memory region is going to be accessed, one of
+ * the MMAP_NORMAL, MMAP_RANDOM, MMAP_SEQUENTIAL, MMAP_WILLNEED, or
+ * MMAP_DONTNEED values.  The region is extended to page boundaries.
+ * MMAP_WILLNEED starts asynchronous read-ahead of the region. */
+int
+MT_madvise(void *p, size_t len, int advice)
+{
+	size_t off = (size_t) p % MT_pagesize();
+	int ret;
+
+	if (len == 0)
+		return 0;
+	ret = posix_madvise((char *) p - off, len + off, advice);
+#ifdef MMAP_DEBUG
+	fprintf(stderr, "#posix_madvise(" PTRFMT "," SZFMT ",%d) = %d\n",
+		PTRFMTCAST ((char *) p - off), len + off, advice, ret);
+#endif
+	return ret;
+}
+
 int
 MT_munmap(void *p, size_t len)
 {
@@ -843,6 +874,16 @@ MT_mmap(const char *path, int mode, size_t len)
 	return ret;
 }
 
+int
+MT_madvise(void *p, size_t len, int advice)
+{
+	/* there is no equivalent of posix_madvise for mapped views */
+	(void) p;
+	(void) len;
+	(void) advice;
+	return 0;
+}
+
 int
 MT_munmap(void *p, size_t dummy)
 {
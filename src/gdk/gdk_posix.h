@@ -168,6 +168,9 @@ gdk_export void MT_sleep_ms(unsigned int ms);
 #define MMAP_COPY		4096	/* writable, but changes never reach file */
 #define MMAP_ASYNC		8192	/* asynchronous writes (default if ommitted) */
 #define MMAP_SYNC		16384	/* writing is done synchronously */
+#define MMAP_HUGEPAGE		32768	/* back large regions by huge pages if possible */
+
+#define MT_HUGEPAGE_SIZE	((size_t) 1 << 21)	/* smallest region worth huge pages */
 
 #define MT_MMAP_LOG 27
 #define MT_MMAP_TILE (1<<MT_MMAP_LOG)
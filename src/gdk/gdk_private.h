@@ -21,7 +21,8 @@ enum heaptype {
 	offheap,
 	varheap,
 	hashheap,
-	imprintsheap
+	imprintsheap,
+	trigramsheap
 };
 
 /*
@@ -56,6 +57,8 @@ __hidden int BATcheckimprints(BAT *b)
 	__attribute__((__visibility__("hidden")));
 __hidden gdk_return BATcheckmodes(BAT *b, int persistent)
 	__attribute__((__visibility__("hidden")));
+__hidden int BATchecktrigrams(BAT *b)
+	__attribute__((__visibility__("hidden")));
 __hidden BATstore *BATcreatedesc(int tt, int heapnames, int role)
 	__attribute__((__visibility__("hidden")));
 __hidden void BATdelete(BAT *b)
@@ -99,8 +102,6 @@ __hidden void gdk_bbp_reset(void)
 	__attribute__((__visibility__("hidden")));
 __hidden gdk_return BUNreplace(BAT *b, oid left, const void *right, bit force)
 	__attribute__((__visibility__("hidden")));
-__hidden void GDKclrerr(void)
-	__attribute__((__visibility__("hidden")));
 __hidden gdk_return GDKextend(const char *fn, size_t size)
 	__attribute__((__visibility__("hidden")));
 __hidden gdk_return GDKextendf(int fd, size_t size, const char *fn)
@@ -180,6 +181,8 @@ __hidden oid MAXoid(BAT *i)
 	__attribute__((__visibility__("hidden")));
 __hidden void MT_init_posix(void)
 	__attribute__((__visibility__("hidden")));
+__hidden int MT_madvise(void *p, size_t len, int advice)
+	__attribute__((__visibility__("hidden")));
 __hidden void *MT_mremap(const char *path, int mode, void *old_address, size_t old_size, size_t *new_size)
 	__attribute__((__visibility__("hidden")));
 __hidden int MT_msync(void *p, size_t len)
@@ -192,6 +195,10 @@ __hidden oid OIDread(str buf)
 	__attribute__((__visibility__("hidden")));
 __hidden int OIDwrite(FILE *f)
 	__attribute__((__visibility__("hidden")));
+__hidden void TRGMdestroy(BAT *b)
+	__attribute__((__visibility__("hidden")));
+__hidden void TRGMfree(BAT *b)
+	__attribute__((__visibility__("hidden")));
 __hidden gdk_return rangejoin(BAT *r1, BAT *r2, BAT *l, BAT *rl, BAT *rh, BAT *sl, BAT *sr, int li, int hi, BUN maxsize)
 	__attribute__((__visibility__("hidden")));
 __hidden void strCleanHash(Heap *hp, int rebuild)
@@ -233,10 +240,18 @@ struct Imprints {
 	BUN dictcnt;		/* counter for cache dictionary               */
 };
 
+struct Trigrams {
+	Heap *trigrams;
+	const BUN *offsets;	/* pointer into trigrams heap (list start per bucket) */
+	const unsigned int *postings; /* pointer into trigrams heap (positions) */
+	BUN npostings;		/* total length of the posting lists */
+};
+
 typedef struct {
 	MT_Lock swap;
 	MT_Lock hash;
 	MT_Lock imprints;
+	MT_Lock trigrams;
 } batlock_t;
 
 typedef struct {
@@ -259,6 +274,7 @@ extern batlock_t GDKbatLock[BBP_BATMASK + 1];
 extern bbplock_t GDKbbpLock[BBP_THREADMASK + 1];
 extern size_t GDK_mmap_minsize;	/* size after which we use memory mapped files */
 extern size_t GDK_mmap_pagesize; /* mmap granularity */
+extern int GDK_trigrams;	/* build trigram indices on the fly */
 extern MT_Lock GDKnameLock;
 extern MT_Lock GDKthreadLock;
 extern MT_Lock GDKtmLock;
@@ -311,6 +327,7 @@ extern MT_Lock MT_system_lock;
 #define GDKswapLock(x)  GDKbatLock[(x)&BBP_BATMASK].swap
 #define GDKhashLock(x)  GDKbatLock[(x)&BBP_BATMASK].hash
 #define GDKimprintsLock(x)  GDKbatLock[(x)&BBP_BATMASK].imprints
+#define GDKtrigramsLock(x)  GDKbatLock[(x)&BBP_BATMASK].trigrams
 #if SIZEOF_SIZE_T == 8
 #define threadmask(y)	((int) ((mix_int((unsigned int) y) ^ mix_int((unsigned int) (y >> 32))) & BBP_THREADMASK))
 #else
@@ -1731,6 +1731,8 @@ BATselect(BAT *b, BAT *s, const void *tl, const void *th,
 			 */
 			use_imprints = 1;
 		}
+		if (s == NULL || BATtdense(s))
+			BATmadvise(b, MMAP_SEQUENTIAL);
 		bn = BAT_scanselect(b, s, bn, tl, th, li, hi, equi, anti,
 				    lval, hval, maximum, use_imprints);
 	}
@@ -1803,6 +1805,107 @@ BATthetaselect(BAT *b, BAT *s, const void *val, const char *op)
 	return NULL;
 }
 
+/* Return a candidate list with the oids in the range [first,
+ * first+cnt) that do not occur in the tail of d, e.g. the rows of a
+ * table minus its deleted rows.  This is what BATdiff computes for a
+ * dense left input, but instead of a hash-based anti-join the oids of
+ * d are marked in a temporary bitmap over the range which is then
+ * scanned a word at a time, so runs without deletes are copied
+ * straight out.  The result is a regular (positive) candidate list of
+ * all remaining oids. */
+BAT *
+BATrangediff(oid first, BUN cnt, BAT *d)
+{
+	BAT *bn;
+	unsigned int *mask;
+	BUN i, j, nw, nd = 0;
+	oid *restrict o;
+	oid v;
+
+	BATcheck(d, "BATrangediff", NULL);
+	assert(ATOMtype(d->ttype) == TYPE_oid);
+
+	/* nothing to remove from the range: no need for the bitmap */
+	if (cnt == 0 || BATcount(d) == 0 ||
+	    (d->ttype == TYPE_void &&
+	     (d->tseqbase == oid_nil ||
+	      d->tseqbase >= first + cnt ||
+	      d->tseqbase + BATcount(d) <= first)) ||
+	    (d->ttype == TYPE_oid && d->tsorted &&
+	     ((*(const oid *) Tloc(d, BUNfirst(d)) != oid_nil &&
+	       *(const oid *) Tloc(d, BUNfirst(d)) >= first + cnt) ||
+	      (*(const oid *) Tloc(d, BUNlast(d) - 1) != oid_nil &&
+	       *(const oid *) Tloc(d, BUNlast(d) - 1) < first)))) {
+		ALGODEBUG fprintf(stderr, "#BATrangediff(first=" OIDFMT
+				  ",cnt=" BUNFMT ",d=%s#" BUNFMT "): disjoint\n",
+				  first, cnt, BATgetId(d), BATcount(d));
+		return doublerange(0, 0, first, first + cnt);
+	}
+
+	nw = (cnt + 31) / 32;
+	if ((mask = GDKzalloc(MAX(nw, 1) * sizeof(*mask))) == NULL)
+		return NULL;
+	if (d->ttype == TYPE_void) {
+		if (d->tseqbase != oid_nil) {
+			for (i = 0; i < BATcount(d); i++) {
+				v = d->tseqbase + i;
+				if (v >= first && v - first < cnt) {
+					v -= first;
+					mask[v / 32] |= 1U << (v % 32);
+					nd++;
+				}
+			}
+		}
+	} else {
+		const oid *dp = (const oid *) Tloc(d, BUNfirst(d));
+
+		for (i = 0; i < BATcount(d); i++) {
+			v = dp[i];
+			if (v != oid_nil && v >= first && v - first < cnt) {
+				v -= first;
+				if ((mask[v / 32] & (1U << (v % 32))) == 0) {
+					mask[v / 32] |= 1U << (v % 32);
+					nd++;
+				}
+			}
+		}
+	}
+
+	bn = BATnew(TYPE_void, TYPE_oid, cnt - nd, TRANSIENT);
+	if (bn == NULL) {
+		GDKfree(mask);
+		return NULL;
+	}
+	o = (oid *) Tloc(bn, BUNfirst(bn));
+	for (i = 0; i < nw; i++) {
+		unsigned int m = mask[i];
+		oid b = first + (oid) i * 32;
+		BUN e = MIN(32, cnt - i * 32);
+
+		if (m == 0) {
+			for (j = 0; j < e; j++)
+				*o++ = b + j;
+		} else if (m != ~0U) {
+			for (j = 0; j < e; j++)
+				if ((m & (1U << j)) == 0)
+					*o++ = b + j;
+		}
+	}
+	GDKfree(mask);
+	BATsetcount(bn, cnt - nd);
+	BATseqbase(bn, 0);
+	bn->tsorted = 1;
+	bn->trevsorted = BATcount(bn) <= 1;
+	bn->tkey = 1;
+	bn->tdense = 0;
+	bn->T->nil = 0;
+	bn->T->nonil = 1;
+	ALGODEBUG fprintf(stderr, "#BATrangediff(first=" OIDFMT ",cnt=" BUNFMT
+			  ",d=%s#" BUNFMT ")=" BUNFMT "\n",
+			  first, cnt, BATgetId(d), BATcount(d), BATcount(bn));
+	return virtualize(bn);
+}
+
 #define VALUE(s, x)	(s##vars ? \
 			 s##vars + VarHeapVal(s##vals, (x), s##width) : \
 			 s##vals + ((x) * s##width))
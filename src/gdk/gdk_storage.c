@@ -553,7 +553,9 @@ GDKload(int farmid, const char *nme, const char *ext, size_t size, size_t *maxsi
 			size = GDK_mmap_pagesize;
 		path = GDKfilepath(farmid, BATDIR, nme, ext);
 		if (path != NULL && GDKextend(path, size) == GDK_SUCCEED) {
-			int mod = MMAP_READ | MMAP_WRITE | MMAP_SEQUENTIAL | MMAP_SYNC;
+			/* the access pattern is declared by the
+			 * operators through BATmadvise */
+			int mod = MMAP_READ | MMAP_WRITE | MMAP_HUGEPAGE | MMAP_SYNC;
 
 			if (mode == STORE_PRIV)
 				mod |= MMAP_COPY;
@@ -673,6 +675,64 @@ BATmsyncImplementation(void *arg)
 }
 #endif
 
+/* Declare the expected access pattern (MMAP_SEQUENTIAL for scans,
+ * MMAP_RANDOM for probes, MMAP_NORMAL to undo either) of the memory
+ * mapped tail heaps of a BAT.  The advice applies to the whole
+ * mapping, also for other users, so it is only a hint: the last
+ * operator to give it wins, which is why scans and probes each give
+ * their own rather than restoring what was there before.  The heap
+ * remembers the last advice, so repeating it does not cost a system
+ * call.
+ * Advice on part of a mapping makes the kernel split it into
+ * separate areas, after which MT_mremap can no longer extend it, so
+ * views advise their parent and the complete heap is covered. */
+void
+BATmadvise(BAT *b, int advice)
+{
+	Heap *h;
+
+	if (b == NULL)
+		return;
+	if (VIEWtparent(b) && (b = BBP_cache(-VIEWtparent(b))) == NULL)
+		return;
+	h = &b->T->heap;
+	if (h->base && h->storage != STORE_MEM && h->advice != advice) {
+		h->advice = (bte) advice;
+		(void) MT_madvise(h->base, h->size, advice);
+	}
+	h = b->T->vheap;
+	if (h && h->base && h->storage != STORE_MEM && h->advice != advice) {
+		h->advice = (bte) advice;
+		(void) MT_madvise(h->base, h->size, advice);
+	}
+}
+
+/* Start asynchronous read-ahead of the memory mapped tail of b.  For
+ * a view this only covers the slice of the parent heap that it
+ * spans; the string heap, which is shared with the parent, is only
+ * included if vheap is set, so that the caller can see to it that it
+ * is requested once.  Unlike the access patterns, read-ahead can be
+ * asked for on part of a mapping without splitting it. */
+void
+BATprefetch(BAT *b, int vheap)
+{
+	BAT *pb = b;
+	Heap *h;
+
+	if (b == NULL || BATcount(b) == 0)
+		return;
+	if (VIEWtparent(b) && (pb = BBP_cache(-VIEWtparent(b))) == NULL)
+		return;
+	h = &pb->T->heap;
+	if (b->ttype != TYPE_void && h->base && h->storage != STORE_MEM)
+		(void) MT_madvise(Tloc(b, BUNfirst(b)),
+				  (size_t) BATcount(b) << b->T->shift,
+				  MMAP_WILLNEED);
+	h = pb->T->vheap;
+	if (vheap && h && h->base && h->storage != STORE_MEM)
+		(void) MT_madvise(h->base, h->free, MMAP_WILLNEED);
+}
+
 void
 BATmsync(BAT *b)
 {
@@ -941,6 +1001,7 @@ BATdelete(BAT *b)
 		b = loaded;
 		HASHdestroy(b);
 		IMPSdestroy(b);
+		TRGMdestroy(b);
 	}
 	assert(!b->H->heap.base || !b->T->heap.base || b->H->heap.base != b->T->heap.base);
 	if (b->batCopiedtodisk || (b->H->heap.storage != STORE_MEM)) {
@@ -55,6 +55,13 @@
 
 #include <unistd.h>		/* for sysconf symbols */
 
+#if defined(__linux__) && defined(HAVE_SCHED_H)
+# include <sched.h>		/* for sched_{get,set}affinity */
+# ifdef CPU_SET
+#  define HAVE_NUMA_PINNING 1
+# endif
+#endif
+
 MT_Lock MT_system_lock MT_LOCK_INITIALIZER("MT_system_lock");
 
 #if !defined(USE_PTHREAD_LOCKS) && !defined(NDEBUG)
@@ -879,3 +886,82 @@ GDKms(void)
 {
 	return (int) (GDKusec() / 1000);
 }
+
+/*
+ * @- NUMA
+ * On machines with more than one NUMA node, worker threads can be
+ * pinned to the CPUs of a node, such that the memory they touch first
+ * (and hence allocate) is node-local.  The topology is read from
+ * sysfs, so we do not depend on libnuma.  Elsewhere there is always
+ * a single node and pinning is a no-op.  Only the CPUs in the affinity
+ * mask the process started with (taskset, cgroups) are used, and nodes
+ * without any of those are left out.  The first call should be made
+ * before starting the threads that use it.
+ */
+#ifdef HAVE_NUMA_PINNING
+#define MT_MAX_NUMA_NODES 64
+static cpu_set_t numa_cpus[MT_MAX_NUMA_NODES];
+#endif
+static int numa_nodes = 0;	/* 0: not yet initialized */
+
+int
+MT_nr_numa_nodes(void)
+{
+	if (numa_nodes == 0) {
+		int n = 0;
+#ifdef HAVE_NUMA_PINNING
+		int i;
+		cpu_set_t allowed;
+
+		if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+			CPU_ZERO(&allowed);
+			for (i = 0; i < CPU_SETSIZE; i++)
+				CPU_SET(i, &allowed);
+		}
+		for (i = 0; i < MT_MAX_NUMA_NODES; i++) {
+			char path[64];
+			FILE *f;
+			int lo, hi, c;
+
+			snprintf(path, sizeof(path),
+				 "/sys/devices/system/node/node%d/cpulist", i);
+			if ((f = fopen(path, "r")) == NULL)
+				continue;
+			CPU_ZERO(&numa_cpus[n]);
+			/* format: 0-3,8-11 */
+			while (fscanf(f, "%d", &lo) == 1) {
+				hi = lo;
+				if ((c = getc(f)) == '-') {
+					if (fscanf(f, "%d", &hi) != 1)
+						break;
+					c = getc(f);
+				}
+				for (; lo <= hi && lo < CPU_SETSIZE; lo++)
+					CPU_SET(lo, &numa_cpus[n]);
+				if (c != ',')
+					break;
+			}
+			fclose(f);
+			CPU_AND(&numa_cpus[n], &numa_cpus[n], &allowed);
+			if (CPU_COUNT(&numa_cpus[n]) > 0)
+				n++;
+		}
+#endif
+		numa_nodes = n > 0 ? n : 1;
+	}
+	return numa_nodes;
+}
+
+/* Bind the calling thread to the CPUs of the given NUMA node. */
+int
+MT_pin_thread(int node)
+{
+	if (MT_nr_numa_nodes() <= 1)
+		return 0;
+#ifdef HAVE_NUMA_PINNING
+	return sched_setaffinity(0, sizeof(cpu_set_t), &numa_cpus[node % numa_nodes]);
+#else
+	(void) node;
+	return 0;
+#endif
+}
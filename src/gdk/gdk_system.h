@@ -348,6 +348,8 @@ typedef struct {
 	} while (0)
 
 gdk_export int MT_check_nr_cores(void);
+gdk_export int MT_nr_numa_nodes(void);
+gdk_export int MT_pin_thread(int node);
 
 /*
  * @- Timers
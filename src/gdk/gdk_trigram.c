@@ -0,0 +1,582 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0.  If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Copyright 1997 - July 2008 CWI, August 2008 - 2016 MonetDB B.V.
+ */
+
+/*
+ * Implementation of the trigram index on string columns.
+ *
+ * The index is an inverted list that maps each (hashed) trigram to
+ * the sorted list of positions of the strings that contain it.  It is
+ * used to produce a candidate list for LIKE/ILIKE selections: a
+ * string can only match a pattern if it contains all trigrams of the
+ * literal parts of that pattern.  The candidates still have to be
+ * verified against the pattern, since different trigrams can hash to
+ * the same bucket.
+ *
+ * Trigrams are computed over the ASCII lower case version of the
+ * strings, so that the same index serves both LIKE and ILIKE.
+ *
+ * Like the column imprints, the index is stored in a separate heap
+ * which is destroyed whenever the column is updated.  Since the
+ * postings take four bytes per distinct trigram per string, the
+ * index can be several times the size of the column, so it is only
+ * created on request: BATtrigrams builds it and saves it alongside a
+ * persistent BAT.  When the gdk_trigrams option is set,
+ * BATtrigramselect also builds a missing index on the fly, but then
+ * only in memory and only if it stays within TRIGRAMS_MAXRATIO times
+ * the size of the column.
+ */
+
+#include "monetdb_config.h"
+#include "gdk.h"
+#include "gdk_private.h"
+#include "gdk_cand.h"
+
+#define TRIGRAMS_VERSION	1
+#define TRIGRAMS_HEADER_SIZE	4 /* nr of size_t fields in header */
+#define TRIGRAMS_BITS		16
+#define TRIGRAMS_BUCKETS	((BUN) 1 << TRIGRAMS_BITS)
+#define TRIGRAMS_MAXCOUNT	((BUN) 0xFFFFFFFF)
+/* below this size, the bucket offsets dominate the index and a scan
+ * is cheap enough */
+#define TRIGRAMS_MINCOUNT	TRIGRAMS_BUCKETS
+/* maximum size of an automatically created index relative to the
+ * size of the column (offset and string heaps) */
+#define TRIGRAMS_MAXRATIO	2
+
+#define trgm_lower(c)	((c) >= 'A' && (c) <= 'Z' ? (c) + ('a' - 'A') : (c))
+
+/* hash the (lower cased) trigram starting at s into a bucket number */
+static inline BUN
+trgm_hash(const unsigned char *s)
+{
+	unsigned int v = ((unsigned int) trgm_lower(s[0]) << 16) |
+		((unsigned int) trgm_lower(s[1]) << 8) |
+		(unsigned int) trgm_lower(s[2]);
+
+	return (BUN) ((v * 2654435761U) >> (32 - TRIGRAMS_BITS));
+}
+
+/* Under a case insensitive comparison (PCRE_CASELESS in UTF-8 mode),
+ * some ASCII letters also match non-ASCII characters (e.g. 'k' and
+ * KELVIN SIGN, 's' and LATIN SMALL LETTER LONG S), and non-ASCII
+ * characters have case variants with different byte sequences.
+ * Trigrams containing such characters cannot be used to filter a
+ * case insensitive search. */
+static inline int
+trgm_caseunsafe(const unsigned char *s)
+{
+	int i;
+
+	for (i = 0; i < 3; i++)
+		if (s[i] >= 0x80 || trgm_lower(s[i]) == 'k' ||
+		    trgm_lower(s[i]) == 's')
+			return 1;
+	return 0;
+}
+
+static size_t
+trgm_heapsize(BUN npostings)
+{
+	return TRIGRAMS_HEADER_SIZE * SIZEOF_SIZE_T +
+		(TRIGRAMS_BUCKETS + 1) * SIZEOF_BUN +
+		npostings * sizeof(unsigned int);
+}
+
+static void
+trgm_setpointers(Trigrams *trigrams)
+{
+	trigrams->offsets = (BUN *) (trigrams->trigrams->base + TRIGRAMS_HEADER_SIZE * SIZEOF_SIZE_T);
+	trigrams->postings = (unsigned int *) (trigrams->offsets + TRIGRAMS_BUCKETS + 1);
+}
+
+/* Check whether we have a trigram index on b (and return true if we
+ * do).  As with imprints, the b->T->trigrams pointer can be NULL
+ * (no index), (Trigrams *) 1 (an index may exist on disk, but isn't
+ * loaded), or a valid pointer.  A view never has its own index, it
+ * uses the one of its parent. */
+int
+BATchecktrigrams(BAT *b)
+{
+	int ret;
+
+	if (VIEWtparent(b)) {
+		assert(b->T->trigrams == NULL);
+		b = BBPdescriptor(-VIEWtparent(b));
+	}
+
+	MT_lock_set(&GDKtrigramsLock(abs(b->batCacheid)));
+	if (b->T->trigrams == (Trigrams *) 1) {
+		Trigrams *trigrams;
+		Heap *hp;
+		str nme = BBP_physical(b->batCacheid);
+
+		b->T->trigrams = NULL;
+		if ((hp = GDKzalloc(sizeof(Heap))) != NULL &&
+		    (hp->farmid = BBPselectfarm(b->batRole, b->ttype, trigramsheap)) >= 0 &&
+		    (hp->filename = GDKmalloc(strlen(nme) + 12)) != NULL) {
+			int fd;
+
+			sprintf(hp->filename, "%s.ttrigrams", nme);
+			/* check whether a persisted trigram index can
+			 * be found */
+			if ((fd = GDKfdlocate(hp->farmid, nme, "rb", "ttrigrams")) >= 0) {
+				size_t hdata[TRIGRAMS_HEADER_SIZE];
+				struct stat st;
+
+				if ((trigrams = GDKzalloc(sizeof(Trigrams))) != NULL &&
+				    read(fd, hdata, sizeof(hdata)) == sizeof(hdata) &&
+				    hdata[0] & ((size_t) 1 << 16) &&
+				    ((hdata[0] & 0xFF00) >> 8) == TRIGRAMS_VERSION &&
+				    (hdata[0] & 0xFF) == TRIGRAMS_BITS &&
+				    hdata[2] == (size_t) BATcount(b) &&
+				    fstat(fd, &st) == 0 &&
+				    st.st_size >= (off_t) (hp->size = hp->free = trgm_heapsize((BUN) hdata[1])) &&
+				    HEAPload(hp, nme, "ttrigrams", 0) == GDK_SUCCEED) {
+					/* usable */
+					trigrams->trigrams = hp;
+					trigrams->npostings = (BUN) hdata[1];
+					trgm_setpointers(trigrams);
+					close(fd);
+					hp->parentid = b->batCacheid;
+					b->T->trigrams = trigrams;
+					ALGODEBUG fprintf(stderr, "#BATchecktrigrams: reusing persisted trigram index %d\n", b->batCacheid);
+					MT_lock_unset(&GDKtrigramsLock(abs(b->batCacheid)));
+					return 1;
+				}
+				GDKfree(trigrams);
+				close(fd);
+				/* unlink unusable file */
+				GDKunlink(hp->farmid, BATDIR, nme, "ttrigrams");
+			}
+			GDKfree(hp->filename);
+		}
+		GDKfree(hp);
+		GDKclrerr();	/* we're not currently interested in errors */
+	}
+	ret = b->T->trigrams != NULL;
+	MT_lock_unset(&GDKtrigramsLock(abs(b->batCacheid)));
+	ALGODEBUG if (ret) fprintf(stderr, "#BATchecktrigrams: already has trigram index %d\n", b->batCacheid);
+	return ret;
+}
+
+/* Call ACTION for each distinct bucket of a trigram of each string in
+ * b.  The variable i is the position of the string, h the bucket. */
+#define TRGM_LOOP(ACTION)						\
+	do {								\
+		for (i = 0; i < cnt; i++) {				\
+			const unsigned char *v = (const unsigned char *) BUNtail(bi, BUNfirst(b) + i); \
+			if (*v == '\200' || v[0] == 0 || v[1] == 0)	\
+				continue; /* nil or too short */	\
+			for (; v[2]; v++) {				\
+				h = trgm_hash(v);			\
+				if (last[h] != (unsigned int) i + 1) {	\
+					last[h] = (unsigned int) i + 1;	\
+					ACTION;				\
+				}					\
+			}						\
+		}							\
+	} while (0)
+
+/* Create the trigram index on b.  If persist is set, the index is
+ * saved to disk when b is persistent.  If maxpostings is not BUN_NONE
+ * and the index would need more postings, no index is created (this
+ * is not an error). */
+static gdk_return
+trgm_create(BAT *b, int persist, BUN maxpostings)
+{
+	BAT *o = NULL;
+	Trigrams *trigrams;
+	lng t0 = 0, t1 = 0;
+
+	assert(BAThdense(b));	/* assert void head */
+
+	if (ATOMstorage(b->ttype) != TYPE_str) {
+		GDKerror("BATtrigrams: unsupported type\n");
+		return GDK_FAIL;
+	}
+
+	if (BATchecktrigrams(b))
+		return GDK_SUCCEED;
+	assert(b->T->trigrams == NULL);
+
+	if (VIEWtparent(b)) {
+		bat p = VIEWtparent(b);
+		o = b;
+		b = BATmirror(BATdescriptor(p));
+		if (BATchecktrigrams(b)) {
+			BBPunfix(b->batCacheid);
+			return GDK_SUCCEED;
+		}
+		assert(b->T->trigrams == NULL);
+	}
+	if (BATcount(b) >= TRIGRAMS_MAXCOUNT) {
+		if (o)
+			BBPunfix(b->batCacheid);
+		GDKerror("BATtrigrams: BAT too large\n");
+		return GDK_FAIL;
+	}
+	MT_lock_set(&GDKtrigramsLock(abs(b->batCacheid)));
+	t0 = GDKusec();
+	if (b->T->trigrams == NULL) {
+		BATiter bi = bat_iterator(b);
+		str nme = BBP_physical(b->batCacheid);
+		BUN cnt = BATcount(b);
+		BUN i, h, npostings = 0;
+		BUN *restrict offsets;
+		unsigned int *restrict postings;
+		unsigned int *restrict last;
+		int fd;
+
+		last = GDKzalloc(TRIGRAMS_BUCKETS * sizeof(unsigned int));
+		trigrams = GDKzalloc(sizeof(Trigrams));
+		if (last == NULL || trigrams == NULL ||
+		    (trigrams->trigrams = GDKzalloc(sizeof(Heap))) == NULL ||
+		    (trigrams->trigrams->filename = GDKmalloc(strlen(nme) + 12)) == NULL) {
+			if (trigrams)
+				GDKfree(trigrams->trigrams);
+			GDKfree(trigrams);
+			GDKfree(last);
+			MT_lock_unset(&GDKtrigramsLock(abs(b->batCacheid)));
+			if (o)
+				BBPunfix(b->batCacheid);
+			return GDK_FAIL;
+		}
+		sprintf(trigrams->trigrams->filename, "%s.ttrigrams", nme);
+		trigrams->trigrams->farmid = BBPselectfarm(b->batRole, b->ttype, trigramsheap);
+
+		/* first pass: count the number of postings */
+		TRGM_LOOP(if (++npostings > maxpostings) goto counted);
+	  counted:
+		if (npostings > maxpostings) {
+			GDKfree(trigrams->trigrams->filename);
+			GDKfree(trigrams->trigrams);
+			GDKfree(trigrams);
+			GDKfree(last);
+			ALGODEBUG fprintf(stderr, "#BATtrigrams(b=%s#" BUNFMT "): more than " BUNFMT " postings, no trigram index\n", BATgetId(b), BATcount(b), maxpostings);
+			MT_lock_unset(&GDKtrigramsLock(abs(b->batCacheid)));
+			if (o != NULL)
+				BBPunfix(b->batCacheid);
+			return GDK_SUCCEED;
+		}
+
+		/* The heap we create here consists of three parts:
+		 * a header so that we can determine whether we can
+		 * trust the index when encountered on startup;
+		 * offsets, for each bucket the start of its posting
+		 * list, plus one entry for the end of the last list;
+		 * postings, the positions of the strings in b. */
+		if (HEAPalloc(trigrams->trigrams, trgm_heapsize(npostings), 1) != GDK_SUCCEED) {
+			GDKfree(trigrams->trigrams->filename);
+			GDKfree(trigrams->trigrams);
+			GDKfree(trigrams);
+			GDKfree(last);
+			GDKerror("#BATtrigrams: memory allocation error");
+			MT_lock_unset(&GDKtrigramsLock(abs(b->batCacheid)));
+			if (o)
+				BBPunfix(b->batCacheid);
+			return GDK_FAIL;
+		}
+		trigrams->npostings = npostings;
+		trgm_setpointers(trigrams);
+		offsets = (BUN *) trigrams->offsets;
+		postings = (unsigned int *) trigrams->postings;
+
+		/* second pass: count per bucket */
+		memset(offsets, 0, (TRIGRAMS_BUCKETS + 1) * SIZEOF_BUN);
+		memset(last, 0, TRIGRAMS_BUCKETS * sizeof(unsigned int));
+		TRGM_LOOP(offsets[h + 1]++);
+		for (h = 0; h < TRIGRAMS_BUCKETS; h++)
+			offsets[h + 1] += offsets[h];
+		assert(offsets[TRIGRAMS_BUCKETS] == npostings);
+
+		/* third pass: fill the posting lists; since we
+		 * go through b in order, each list is sorted */
+		memset(last, 0, TRIGRAMS_BUCKETS * sizeof(unsigned int));
+		TRGM_LOOP(postings[offsets[h]++] = (unsigned int) i);
+		/* offsets[h] is now the start of bucket h + 1 */
+		for (h = TRIGRAMS_BUCKETS; h > 0; h--)
+			offsets[h] = offsets[h - 1];
+		offsets[0] = 0;
+		GDKfree(last);
+
+		trigrams->trigrams->free = trgm_heapsize(npostings);
+		/* add info to heap for when it becomes persistent */
+		((size_t *) trigrams->trigrams->base)[0] = (size_t) TRIGRAMS_BITS;
+		((size_t *) trigrams->trigrams->base)[1] = (size_t) npostings;
+		((size_t *) trigrams->trigrams->base)[2] = (size_t) BATcount(b);
+		((size_t *) trigrams->trigrams->base)[3] = 0;
+		if (persist &&
+		    (BBP_status(b->batCacheid) & BBPEXISTING) &&
+		    HEAPsave(trigrams->trigrams, nme, "ttrigrams") == GDK_SUCCEED &&
+		    (fd = GDKfdlocate(trigrams->trigrams->farmid, nme, "rb+", "ttrigrams")) >= 0) {
+			ALGODEBUG fprintf(stderr, "#BATtrigrams: persisting trigram index\n");
+			/* add version number */
+			((size_t *) trigrams->trigrams->base)[0] |= (size_t) TRIGRAMS_VERSION << 8;
+			/* sync-on-disk checked bit */
+			((size_t *) trigrams->trigrams->base)[0] |= (size_t) 1 << 16;
+			if (write(fd, trigrams->trigrams->base, sizeof(size_t)) < 0)
+				perror("write trigrams");
+			if (!(GDKdebug & FORCEMITOMASK)) {
+#if defined(NATIVE_WIN32)
+				_commit(fd);
+#elif defined(HAVE_FDATASYNC)
+				fdatasync(fd);
+#elif defined(HAVE_FSYNC)
+				fsync(fd);
+#endif
+			}
+			close(fd);
+		}
+		trigrams->trigrams->parentid = b->batCacheid;
+		b->T->trigrams = trigrams;
+	}
+	t1 = GDKusec();
+	ALGODEBUG fprintf(stderr, "#BATtrigrams(b=%s#" BUNFMT "): trigram index construction " LLFMT " usec\n", BATgetId(b), BATcount(b), t1 - t0);
+	MT_lock_unset(&GDKtrigramsLock(abs(b->batCacheid)));
+
+	if (o != NULL)
+		BBPunfix(b->batCacheid);
+	return GDK_SUCCEED;
+}
+
+gdk_return
+BATtrigrams(BAT *b)
+{
+	BATcheck(b, "BATtrigrams", GDK_FAIL);
+	return trgm_create(b, 1, BUN_NONE);
+}
+
+/* Produce in *candp a candidate list of the rows of b (restricted to
+ * the candidate list s) that contain all trigrams of each of the
+ * nkeys strings in keys.  If caseignore is set, the keys are to be
+ * matched case insensitively.  If there is no trigram index on b,
+ * the keys do not provide any usable trigram, or b is too small to
+ * make an index worth while, *candp is set to NULL and GDK_SUCCEED is
+ * returned: in that case the index cannot restrict the search.  A
+ * missing index is only created (in memory) if the gdk_trigrams
+ * option is set. */
+gdk_return
+BATtrigramselect(BAT **candp, BAT *b, BAT *s, const char *const *keys, int nkeys, int caseignore)
+{
+	BAT *pb = b, *bn;
+	Trigrams *trigrams;
+	BUN *buckets, nbuckets = 0, nbucketsmax = 0;
+	BUN start, end, cnt, pr_off = 0, i, j, k, m, n;
+	unsigned int *restrict res;
+	const oid *cand = NULL, *candend = NULL;
+	oid *restrict dst;
+	int l;
+
+	BATcheck(b, "BATtrigramselect", GDK_FAIL);
+	*candp = NULL;
+
+	if (VIEWtparent(b)) {
+		BAT *tmp = BBPquickdesc(abs(VIEWtparent(b)), 0);
+
+		if (tmp == NULL || BATcount(tmp) < TRIGRAMS_MINCOUNT)
+			return GDK_SUCCEED;
+	} else if (BATcount(b) < TRIGRAMS_MINCOUNT)
+		return GDK_SUCCEED;
+	for (l = 0; l < nkeys; l++)
+		nbucketsmax += strlen(keys[l]);
+	if (nbucketsmax == 0)
+		return GDK_SUCCEED;
+	if ((buckets = GDKmalloc(nbucketsmax * sizeof(BUN))) == NULL)
+		return GDK_FAIL;
+	for (l = 0; l < nkeys; l++) {
+		const unsigned char *v = (const unsigned char *) keys[l];
+
+		if (v[0] == 0 || v[1] == 0)
+			continue;
+		for (; v[2]; v++) {
+			BUN h;
+
+			if (caseignore && trgm_caseunsafe(v))
+				continue;
+			h = trgm_hash(v);
+			for (k = 0; k < nbuckets; k++)
+				if (buckets[k] == h)
+					break;
+			if (k == nbuckets)
+				buckets[nbuckets++] = h;
+		}
+	}
+	if (nbuckets == 0) {
+		GDKfree(buckets);
+		return GDK_SUCCEED;
+	}
+
+	if (VIEWtparent(b)) {
+		pb = BATmirror(BATdescriptor(VIEWtparent(b)));
+		if (pb == NULL) {
+			GDKfree(buckets);
+			return GDK_FAIL;
+		}
+		pr_off = (BUN) (((char *) Tloc(b, BUNfirst(b)) - (char *) Tloc(pb, BUNfirst(pb))) >> b->T->shift);
+	}
+	if (!BATchecktrigrams(pb)) {
+		if (GDK_trigrams &&
+		    trgm_create(pb, 0, (BUN) (TRIGRAMS_MAXRATIO * (pb->T->heap.free + pb->T->vheap->free) / sizeof(unsigned int))) != GDK_SUCCEED) {
+			if (pb != b)
+				BBPunfix(pb->batCacheid);
+			GDKfree(buckets);
+			return GDK_FAIL;
+		}
+		if (!BATchecktrigrams(pb)) {
+			/* no index, or it would be too large */
+			if (pb != b)
+				BBPunfix(pb->batCacheid);
+			GDKfree(buckets);
+			return GDK_SUCCEED;
+		}
+	}
+	trigrams = pb->T->trigrams;
+	assert(trigrams != NULL && trigrams != (Trigrams *) 1);
+
+	/* intersect the shortest posting lists first (there are only
+	 * a few buckets, so insertion sort will do) */
+	for (k = 1; k < nbuckets; k++) {
+		BUN h = buckets[k];
+		BUN len = trigrams->offsets[h + 1] - trigrams->offsets[h];
+
+		for (j = k; j > 0 && trigrams->offsets[buckets[j - 1] + 1] - trigrams->offsets[buckets[j - 1]] > len; j--)
+			buckets[j] = buckets[j - 1];
+		buckets[j] = h;
+	}
+
+	CANDINIT(b, s, start, end, cnt, cand, candend);
+	start += pr_off;
+	end += pr_off;
+
+	/* copy the part of the shortest list that falls in the range
+	 * of b (and s) */
+	i = trigrams->offsets[buckets[0]];
+	j = trigrams->offsets[buckets[0] + 1];
+	if ((res = GDKmalloc((j - i + 1) * sizeof(unsigned int))) == NULL) {
+		if (pb != b)
+			BBPunfix(pb->batCacheid);
+		GDKfree(buckets);
+		return GDK_FAIL;
+	}
+	for (n = 0; i < j; i++)
+		if (trigrams->postings[i] >= start && trigrams->postings[i] < end)
+			res[n++] = trigrams->postings[i];
+	/* merge intersect with the remaining lists */
+	for (k = 1; k < nbuckets && n > 0; k++) {
+		BUN r = 0;
+
+		i = trigrams->offsets[buckets[k]];
+		j = trigrams->offsets[buckets[k] + 1];
+		for (m = 0; m < n && i < j; ) {
+			if (res[m] < trigrams->postings[i])
+				m++;
+			else if (res[m] > trigrams->postings[i])
+				i++;
+			else {
+				res[r++] = res[m++];
+				i++;
+			}
+		}
+		n = r;
+	}
+	GDKfree(buckets);
+	if (pb != b)
+		BBPunfix(pb->batCacheid);
+
+	bn = BATnew(TYPE_void, TYPE_oid, n, TRANSIENT);
+	if (bn == NULL) {
+		GDKfree(res);
+		return GDK_FAIL;
+	}
+	dst = (oid *) Tloc(bn, BUNfirst(bn));
+	for (i = 0, j = 0; i < n; i++) {
+		oid o = b->hseqbase + (res[i] - pr_off);
+
+		if (cand) {
+			while (cand < candend && *cand < o)
+				cand++;
+			if (cand == candend)
+				break;
+			if (*cand != o)
+				continue;
+		}
+		dst[j++] = o;
+	}
+	GDKfree(res);
+	BATsetcount(bn, j);
+	bn->tsorted = 1;
+	bn->trevsorted = j <= 1;
+	bn->tkey = 1;
+	bn->tdense = j <= 1;
+	if (j == 1)
+		bn->tseqbase = dst[0];
+	bn->T->nil = 0;
+	bn->T->nonil = 1;
+	BATseqbase(bn, 0);
+	ALGODEBUG fprintf(stderr, "#BATtrigramselect(b=%s#" BUNFMT ",s=%s): " BUNFMT " candidates\n", BATgetId(b), BATcount(b), s ? BATgetId(s) : "NULL", j);
+	*candp = bn;
+	return GDK_SUCCEED;
+}
+
+static void
+TRGMremove(BAT *b)
+{
+	Trigrams *trigrams;
+
+	assert(!VIEWtparent(b));
+
+	MT_lock_set(&GDKtrigramsLock(abs(b->batCacheid)));
+	if ((trigrams = b->T->trigrams) != NULL) {
+		b->T->trigrams = NULL;
+
+		if (HEAPdelete(trigrams->trigrams, BBP_physical(b->batCacheid), "ttrigrams"))
+			IODEBUG fprintf(stderr, "#TRGMremove(%s): trigram index heap\n", BATgetId(b));
+
+		GDKfree(trigrams->trigrams);
+		GDKfree(trigrams);
+	}
+	MT_lock_unset(&GDKtrigramsLock(abs(b->batCacheid)));
+}
+
+void
+TRGMdestroy(BAT *b)
+{
+	if (b) {
+		if (b->T->trigrams == (Trigrams *) 1) {
+			b->T->trigrams = NULL;
+			GDKunlink(BBPselectfarm(b->batRole, b->ttype, trigramsheap),
+				  BATDIR,
+				  BBP_physical(b->batCacheid),
+				  "ttrigrams");
+		} else if (b->T->trigrams != NULL && !VIEWtparent(b))
+			TRGMremove(b);
+	}
+}
+
+/* free the memory associated with the trigram index, do not remove
+ * the heap file; indicate that an index is available on disk by
+ * setting the trigrams pointer to 1 */
+void
+TRGMfree(BAT *b)
+{
+	Trigrams *trigrams;
+
+	if (b) {
+		MT_lock_set(&GDKtrigramsLock(abs(b->batCacheid)));
+		trigrams = b->T->trigrams;
+		if (trigrams != NULL && trigrams != (Trigrams *) 1) {
+			b->T->trigrams = (Trigrams *) 1;
+			if (!VIEWtparent(b)) {
+				HEAPfree(trigrams->trigrams, 0);
+				GDKfree(trigrams->trigrams);
+				GDKfree(trigrams);
+			}
+		}
+		MT_lock_unset(&GDKtrigramsLock(abs(b->batCacheid)));
+	}
+}
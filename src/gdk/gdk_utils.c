@@ -284,6 +284,9 @@ size_t GDK_vm_maxsize = GDK_VM_MAXSIZE;
 
 int GDK_vm_trim = 1;
 
+/* create missing trigram indices on the fly (gdk_trigrams option) */
+int GDK_trigrams = 0;
+
 #define SEG_SIZE(x,y)	((x)+(((x)&((1<<(y))-1))?(1<<(y))-((x)&((1<<(y))-1)):0))
 #define MAX_BIT		((int) (sizeof(ssize_t)<<3))
 
@@ -519,6 +522,7 @@ GDKinit(opt *set, int setlen)
 		MT_lock_init(&GDKbatLock[i].swap, "GDKswapLock");
 		MT_lock_init(&GDKbatLock[i].hash, "GDKhashLock");
 		MT_lock_init(&GDKbatLock[i].imprints, "GDKimprintsLock");
+		MT_lock_init(&GDKbatLock[i].trigrams, "GDKtrigramsLock");
 	}
 	for (i = 0; i <= BBP_THREADMASK; i++) {
 		MT_lock_init(&GDKbbpLock[i].alloc, "GDKcacheLock");
@@ -616,6 +620,7 @@ GDKinit(opt *set, int setlen)
 	GDKnr_threads = GDKgetenv_int("gdk_nr_threads", 0);
 	if (GDKnr_threads == 0)
 		GDKnr_threads = MT_check_nr_cores();
+	GDK_trigrams = GDKgetenv_isyes("gdk_trigrams");
 
 	if ((p = GDKgetenv("gdk_dbpath")) != NULL &&
 	    (p = strrchr(p, DIR_SEP)) != NULL) {
@@ -221,6 +221,8 @@ typedef struct MALBLK {
 	int calls;					/* number of calls */
 	lng optimize;				/* total optimizer time */
 	int activeClients;			/* load during mitosis optimization */
+	int partition;				/* mitosis history entry, -1 if none */
+	int pieces;					/* number of mitosis pieces */
 } *MalBlkPtr, MalBlkRecord;
 
 #define STACKINCR   128
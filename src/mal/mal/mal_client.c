@@ -250,6 +250,7 @@ MCinitClientRecord(Client c, oid user, bstream *fin, stream *fout)
 	/* create a recycler cache */
 	c->exception_buf_initialized = 0;
 	c->error_row = c->error_fld = c->error_msg = c->error_input = NULL;
+	c->columnar = 0;
 #ifndef HAVE_EMBEDDED /* no authentication in embedded mode */
 	{
 		str msg = AUTHgetUsername(&c->username, c);
@@ -177,6 +177,11 @@ typedef struct CLIENT {
 	BAT *error_fld;
 	BAT *error_msg;
 	BAT *error_input;
+	/*
+	 * Clients that asked for it at login get query results as binary
+	 * column blocks instead of text tuples.
+	 */
+	bit columnar;
 } *Client, ClientRec;
 
 mal_export void    MCinit(void);
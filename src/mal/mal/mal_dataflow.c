@@ -48,8 +48,13 @@ typedef struct FLOWEVENT {
 	lng hotclaim;   /* memory foot print of result variables */
 	lng argclaim;   /* memory foot print of arguments */
 	lng maxclaim;   /* memory foot print of  largest argument, counld be used to indicate result size */
+	int worker;     /* worker that executed it, -1 if not yet */
+	sht piece;      /* works on mitosis pieces (PIECEwork/PIECEmerge) */
 } *FlowEvent, FlowEventRec;
 
+#define PIECEwork  1	/* result is (derived from) a mitosis piece */
+#define PIECEmerge 2	/* combines pieces, result is whole again */
+
 typedef struct queue {
 	int size;	/* size of queue */
 	int last;	/* last element in the queue */
@@ -75,6 +80,10 @@ typedef struct DATAFLOW {
 	int *edges;         /* dependency graph */
 	MT_Lock flowlock;   /* lock to protect the above */
 	Queue *done;        /* instructions handled */
+	bat prefetched[16]; /* columns whose whole heaps were read ahead */
+	int nprefetched;    /* (protected by flowlock) */
+	lng partstart;      /* wall clock span of the instructions that */
+	lng partend;        /* work on mitosis pieces (under flowlock) */
 } *DataFlow, DataFlowRec;
 
 static struct worker {
@@ -82,9 +91,11 @@ static struct worker {
 	enum {IDLE, RUNNING, JOINING, EXITED} flag;
 	Client cntxt;				/* client we do work for (NULL -> any) */
 	MT_Sema s;
+	Queue *local;				/* work preferably done by this worker */
 } workers[THREADS];
 
 static Queue *todo = 0;	/* pending instructions */
+static int nlocal = 0;	/* workers[0..nlocal-1] may have a local queue */
 
 #ifdef ATOMIC_LOCK
 static MT_Lock exitingLock MT_LOCK_INITIALIZER("exitingLock");
@@ -95,7 +106,17 @@ static MT_Lock dataflowLock MT_LOCK_INITIALIZER("dataflowLock");
 void
 mal_dataflow_reset(void)
 {
+	int i;
+
 	stopMALdataflow();
+	for (i = 0; i < nlocal; i++)
+		if (workers[i].local) {
+			GDKfree(workers[i].local->data);
+			MT_lock_destroy(&workers[i].local->l);
+			MT_sema_destroy(&workers[i].local->s);
+			GDKfree(workers[i].local);
+		}
+	nlocal = 0;
 	memset((char*) workers, 0,  sizeof(workers));
 	if( todo) {
 		GDKfree(todo->data);
@@ -299,6 +320,121 @@ q_dequeue(Queue *q, Client cntxt)
 	return r;
 }
 
+/*
+ * Next to the shared todo queue, each worker has a local queue.
+ * Instructions that become eligible are placed in the local queue of
+ * the worker that produced their input, such that consumers tend to
+ * run where their (cache hot) input was made.  The todo semaphore
+ * counts the work in all queues together.  A worker first looks in
+ * its own queue (newest first), then in the todo queue, and finally
+ * steals the oldest instruction from another worker.  Each queue has
+ * its own lock, so the workers hardly ever wait for each other.
+ * Worker i runs on NUMA node i % MT_nr_numa_nodes().
+ */
+static void
+DFLOWenqueue(FlowEvent fe, int w)
+{
+	Queue *q = todo;
+
+	if (w >= 0 && workers[w].local)
+		q = workers[w].local;
+	MT_lock_set(&q->l);
+	q_enqueue_(q, fe);
+	MT_lock_unset(&q->l);
+	MT_sema_up(&todo->s);
+}
+
+/* take an instruction from a queue, for a specific client the one
+ * with the lowest pc, otherwise the newest or oldest one */
+static FlowEvent
+q_take(Queue *q, Client cntxt, int oldest)
+{
+	FlowEvent r = NULL;
+	int i, j = -1;
+
+	MT_lock_set(&q->l);
+	if (cntxt) {
+		for (i = q->last - 1; i >= 0; i--)
+			if (q->data[i]->flow->cntxt == cntxt &&
+				(j < 0 || q->data[i]->pc < q->data[j]->pc))
+				j = i;
+	} else if (q->last > 0)
+		j = oldest ? 0 : q->last - 1;
+	if (j >= 0) {
+		r = q->data[j];
+		q->last--;
+		for (i = j; i < q->last; i++)
+			q->data[i] = q->data[i + 1];
+		q->data[q->last] = 0;
+	}
+	MT_lock_unset(&q->l);
+	return r;
+}
+
+/* A semaphore token does not reserve a particular instruction, and
+ * the scan over the queues is not atomic: while we look at one queue,
+ * an instruction can be added to a queue we already passed, and a
+ * worker holding that token can take the instruction we were heading
+ * for.  There still is an instruction (or an exit request) for every
+ * token, so a generic worker that comes up empty scans again.  A
+ * worker for a specific client may legitimately find nothing, it
+ * returns NULL and the caller hands the token back. */
+static FlowEvent
+DFLOWdequeue(struct worker *t, Client cntxt)
+{
+	FlowEvent r;
+	int id = (int) (t - workers), i, n, nodes, pass;
+
+	MT_sema_down(&todo->s);
+	for (;;) {
+		if (ATOMIC_GET(exiting, exitingLock))
+			return NULL;
+		if (cntxt == NULL) {
+			MT_lock_set(&todo->l);
+			if (todo->exitcount > 0) {
+				todo->exitcount--;
+				MT_lock_unset(&todo->l);
+				return NULL;
+			}
+			MT_lock_unset(&todo->l);
+		}
+		if (t->local && (r = q_take(t->local, cntxt, 0)) != NULL)
+			return r;
+		/* LIFO favors garbage collection */
+		if ((r = q_take(todo, cntxt, 0)) != NULL)
+			return r;
+		/* steal from workers on the same NUMA node first */
+		n = nlocal;
+		nodes = MT_nr_numa_nodes();
+		for (pass = 0; pass < 2; pass++)
+			for (i = 1; i < n; i++) {
+				int w = (id + i) % n;
+				Queue *q = workers[w].local;
+				if ((w % nodes == id % nodes) == pass)
+					continue;
+				if (q && q->last > 0 && (r = q_take(q, cntxt, 1)) != NULL) {
+					PARDEBUG fprintf(stderr, "#worker %d stole pc=%d from worker %d\n",
+									 id, r->pc, w);
+					return r;
+				}
+			}
+		if (cntxt != NULL)
+			return NULL;
+		/* our instruction is in a queue we already scanned */
+		MT_sleep_ms(1);
+	}
+}
+
+/* give a worker slot its local queue; called with dataflowLock held */
+static void
+DFLOWinitLocal(int i)
+{
+	if (workers[i].local == NULL)
+		workers[i].local = q_create(64, "DFLOWlocal");
+	if (workers[i].local && i >= nlocal)
+		nlocal = i + 1;
+}
+
 /*
  * We simply move an instruction into the front of the queue.
  * Beware, we assume that variables are assigned a value once, otherwise
@@ -317,6 +453,63 @@ q_dequeue(Queue *q, Client cntxt)
  * with this property. Nor do we maintain such properties.
  */
 
+/*
+ * Persistent columns handed out by an instruction are often cold.
+ * Rather than letting their consumers fault them in page by page,
+ * ask the OS to start reading them ahead as soon as they are produced,
+ * so the I/O overlaps with the work on other instructions.
+ * The results are still alive here, because the instructions
+ * consuming them have not been woken up yet.
+ * A mitosis slice only reads ahead its own part of the column; the
+ * heaps that are read as a whole (complete columns, and the string
+ * heap shared by all slices) are requested once per dataflow block.
+ */
+static int
+DFLOWprefetched(DataFlow flow, bat bid)
+{
+	int i, first = 1;
+
+	MT_lock_set(&flow->flowlock);
+	for (i = 0; i < flow->nprefetched; i++)
+		if (flow->prefetched[i] == bid) {
+			first = 0;
+			break;
+		}
+	if (first && flow->nprefetched < (int) (sizeof(flow->prefetched) / sizeof(flow->prefetched[0])))
+		flow->prefetched[flow->nprefetched++] = bid;
+	MT_lock_unset(&flow->flowlock);
+	return first;
+}
+
+static void
+DFLOWprefetch(DataFlow flow, FlowEvent fe)
+{
+	InstrPtr p = getInstrPtr(flow->mb, fe->pc);
+	BAT *b, *pb;
+	bat bid;
+	int i;
+
+	for (i = 0; i < p->retc; i++) {
+		if (flow->stk->stk[getArg(p, i)].vtype != TYPE_bat)
+			continue;
+		bid = flow->stk->stk[getArg(p, i)].val.bval;
+		if (bid == 0 || bid == bat_nil || (b = BATdescriptor(bid)) == NULL)
+			continue;
+		pb = VIEWtparent(b) ? BBPquickdesc(abs(VIEWtparent(b)), 0) : b;
+		if (pb && pb->batPersistence == PERSISTENT) {
+			int first = DFLOWprefetched(flow, pb->batCacheid);
+
+			PARDEBUG fprintf(stderr, "#prefetch pc=%d %s#" BUNFMT "\n",
+							 fe->pc, BATgetId(b), BATcount(b));
+			if (VIEWtparent(b))
+				BATprefetch(b, first);
+			else if (first)
+				BATprefetch(b, 1);
+		}
+		BBPunfix(bid);
+	}
+}
+
 static void
 DFLOWworker(void *T)
 {
@@ -329,8 +522,12 @@ DFLOWworker(void *T)
 	int i,last;
 	Client cntxt;
 	InstrPtr p;
+	lng tstart;
 
 	thr = THRnew("DFLOWworker");
+	/* spread the workers over the NUMA nodes, the worker then
+	 * allocates the results it produces on its own node */
+	(void) MT_pin_thread(id);
 
 #ifdef _MSC_VER
 	srand((unsigned int) GDKusec());
@@ -349,7 +546,7 @@ DFLOWworker(void *T)
 			MT_lock_set(&dataflowLock);
 			cntxt = t->cntxt;
 			MT_lock_unset(&dataflowLock);
-			fe = q_dequeue(todo, cntxt);
+			fe = DFLOWdequeue(t, cntxt);
 			if (fe == NULL) {
 				if (cntxt) {
 					/* we're not done yet with work for the current
@@ -397,6 +594,7 @@ DFLOWworker(void *T)
 			}
 		}
 #endif
+		tstart = GDKusec();
 		error = runMALsequence(flow->cntxt, flow->mb, fe->pc, fe->pc + 1, flow->stk, 0, 0);
 		PARDEBUG fprintf(stderr, "#executed pc= %d wrk= %d claim= " LLFMT "," LLFMT "," LLFMT " %s\n",
 						 fe->pc, id, fe->argclaim, fe->hotclaim, fe->maxclaim, error ? error : "");
@@ -411,6 +609,12 @@ DFLOWworker(void *T)
 
 		MT_lock_set(&flow->flowlock);
 		fe->state = DFLOWwrapup;
+		fe->worker = id;
+		if (fe->piece) {
+			if (flow->partend == 0 || tstart < flow->partstart)
+				flow->partstart = tstart;
+			flow->partend = GDKusec();
+		}
 		MT_lock_unset(&flow->flowlock);
 		if (error) {
 			MT_lock_set(&flow->flowlock);
@@ -447,6 +651,9 @@ DFLOWworker(void *T)
 		}
 	}
 #endif
+		if (flow->nodes[fe->pc - flow->start] > 0)
+			DFLOWprefetch(flow, fe);
+
 		MT_lock_set(&flow->flowlock);
 
 		for (last = fe->pc - flow->start; last >= 0 && (i = flow->nodes[last]) > 0; last = flow->edges[last])
@@ -508,6 +715,7 @@ DFLOWinitialize(void)
 	for (i = 0; i < THREADS; i++)
 		MT_sema_init(&workers[i].s, 0, "DFLOWinitialize");
 	limit = GDKnr_threads ? GDKnr_threads - 1 : 0;
+	(void) MT_nr_numa_nodes();	/* read the topology before the workers do */
 #ifdef NEED_MT_LOCK_INIT
 	ATOMIC_INIT(exitingLock);
 	MT_lock_init(&dataflowLock, "dataflowLock");
@@ -516,6 +724,7 @@ DFLOWinitialize(void)
 	for (i = 0; i < limit; i++) {
 		workers[i].flag = RUNNING;
 		workers[i].cntxt = NULL;
+		DFLOWinitLocal(i);
 		if (MT_create_thread(&workers[i].id, DFLOWworker, (void *) &workers[i], MT_THR_JOINABLE) < 0)
 			workers[i].flag = IDLE;
 		else
@@ -567,8 +776,32 @@ DFLOWinitBlk(DataFlow flow, MalBlkPtr mb, int size)
 		flow->status[n].pc = pc;
 		flow->status[n].state = DFLOWpending;
 		flow->status[n].cost = -1;
+		flow->status[n].worker = -1;
+		flow->status[n].piece = 0;
 		flow->status[n].flow->error = NULL;
 
+		/* a sliced sql.bind/bindidx/tid (as made by mitosis) and
+		 * everything computed from its result up to the mat
+		 * operations that combine the pieces again */
+		if (getModuleId(p) && strcmp(getModuleId(p), "sql") == 0 &&
+			getFunctionId(p) &&
+			(((strcmp(getFunctionId(p), "bind") == 0 ||
+			   strcmp(getFunctionId(p), "bindidx") == 0) &&
+			  p->argc - p->retc == 7) ||
+			 (strcmp(getFunctionId(p), "tid") == 0 &&
+			  p->argc - p->retc == 5)))
+			flow->status[n].piece = PIECEwork;
+		else
+			for (j = p->retc; j < p->argc; j++)
+				if (!isVarConstant(mb, getArg(p, j)) &&
+					(k = assign[getArg(p, j)]) &&
+					flow->status[k - flow->start].piece == PIECEwork) {
+					flow->status[n].piece =
+						getModuleId(p) && strcmp(getModuleId(p), "mat") == 0 ?
+						PIECEmerge : PIECEwork;
+					break;
+				}
+
 		/* administer flow dependencies */
 		for (j = p->retc; j < p->argc; j++) {
 			/* list of instructions that wake n-th instruction up */
@@ -740,7 +973,7 @@ DFLOWscheduler(DataFlow flow, struct worker *w)
 				if (flow->status[i].blocks == 1 ) {
 					flow->status[i].state = DFLOWrunning;
 					flow->status[i].blocks--;
-					q_enqueue(todo, flow->status + i);
+					DFLOWenqueue(flow->status + i, f->worker);
 					PARDEBUG fprintf(stderr, "#enqueue pc=%d claim= " LLFMT "\n", flow->status[i].pc, flow->status[i].argclaim);
 				} else {
 					flow->status[i].blocks--;
@@ -855,6 +1088,7 @@ runMALdataflow(Client cntxt, MalBlkPtr mb, int startpc, int stoppc, MalStkPtr st
 				/* not doing a recursive call: create specific worker */
 				workers[i].cntxt = cntxt;
 			}
+			DFLOWinitLocal(i);
 			workers[i].flag = RUNNING;
 			if (MT_create_thread(&workers[i].id, DFLOWworker, (void *) &workers[i], MT_THR_JOINABLE) < 0) {
 				/* cannot start new thread, run serially */
@@ -924,6 +1158,10 @@ runMALdataflow(Client cntxt, MalBlkPtr mb, int startpc, int stoppc, MalStkPtr st
 
 	if (msg == MAL_SUCCEED)
 		msg = DFLOWscheduler(flow, &workers[i]);
+	/* tell mitosis how well its partitioning worked out, judged by
+	 * the time spent on the pieces only */
+	if (msg == MAL_SUCCEED && mb->partition >= 0 && flow->partend > 0)
+		runtimePartitionFeedback(mb->partition, mb->pieces, flow->partend - flow->partstart);
 
 	GDKfree(flow->status);
 	GDKfree(flow->edges);
@@ -134,6 +134,8 @@ newMalBlk(int maxvars, int maxstmts)
 	mb->optimize = 0;
 	mb->stmt = NULL;
 	mb->activeClients = 1;
+	mb->partition = -1;
+	mb->pieces = 0;
 	if (newMalBlkStmt(mb, maxstmts) < 0) {
 		GDKfree(mb->var);
 		GDKfree(mb->stmt);
@@ -289,6 +291,8 @@ copyMalBlk(MalBlkPtr old)
 	mb->maxarg = old->maxarg;
 	mb->inlineProp = old->inlineProp;
 	mb->unsafeProp = old->unsafeProp;
+	mb->partition = old->partition;
+	mb->pieces = old->pieces;
 	return mb;
 }
 
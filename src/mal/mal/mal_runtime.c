@@ -29,14 +29,48 @@ static int qtop, qsize;
 static int qtag= 1;
 static int calltag =0; // to identify each invocation
 
+/*
+ * Keep track of how well the mitosis partitioning of a table works.
+ * For each table we remember the number of pieces with the lowest
+ * execution cost (per row) of the partitioned part of the dataflow
+ * blocks seen so far.  Every so many runs we probe twice or half as
+ * many pieces, alternately, and switch over when it turns out to be
+ * faster.  Each probe costs two plan recompilations (to the probe
+ * and back), so once a probe in either direction has failed, the
+ * table is left alone until its size changes substantially.
+ */
+#define MAXPARTITIONHISTORY 256
+#define PROBEINTERVAL 16	/* runs between probes */
+
+static struct PARTITIONHISTORY {
+	str name;		/* plan:schema.table */
+	BUN rows;		/* table size at the last advice */
+	int maxpieces;
+	int best;		/* pieces with the lowest cost so far */
+	lng bestcost;	/* nanoseconds per row, running average */
+	int probe;		/* pieces being tried, equal to best if none */
+	int up;			/* direction of the next probe */
+	int runs;		/* runs with the best partitioning */
+	int misses;		/* failed probes in a row */
+} *phistory;
+static int ptop;
+static MT_Lock mal_partitionLock MT_LOCK_INITIALIZER("mal_partitionLock");
+
 void
 mal_runtime_reset(void)
 {
+	int i;
+
 	QRYqueue = 0;
 	qtop = 0;
 	qsize = 0;
 	qtag= 1;
 	calltag =0; 
+	for (i = 0; i < ptop; i++)
+		GDKfree(phistory[i].name);
+	GDKfree(phistory);
+	phistory = 0;
+	ptop = 0;
 }
 
 static str isaSQLquery(MalBlkPtr mb){
@@ -265,3 +299,107 @@ lng getVolume(MalStkPtr stk, InstrPtr pci, int rd)
 	}
 	return vol;
 }
+
+/*
+ * Advise the number of pieces to cut a table in for a plan, starting
+ * out with the caller's estimate.  The history is kept per plan and
+ * table, as other queries over the same table may well prefer another
+ * partitioning.  Returns the history entry to report back on, or -1
+ * if there is none.
+ */
+int
+runtimePartitionAdvice(const char *plan, const char *schema, const char *table, BUN rows, int maxpieces, int *pieces)
+{
+	int i;
+	size_t len = strlen(plan) + strlen(schema) + strlen(table) + 3;
+	str name = GDKmalloc(len);
+
+	if (name == NULL)
+		return -1;
+	snprintf(name, len, "%s:%s.%s", plan, schema, table);
+	MT_lock_set(&mal_partitionLock);
+	for (i = 0; i < ptop; i++)
+		if (strcmp(phistory[i].name, name) == 0)
+			break;
+	if (i == ptop) {
+		if (phistory == NULL)
+			phistory = GDKzalloc(MAXPARTITIONHISTORY * sizeof(*phistory));
+		if (phistory == NULL || ptop == MAXPARTITIONHISTORY) {
+			MT_lock_unset(&mal_partitionLock);
+			GDKfree(name);
+			return -1;
+		}
+		phistory[i].name = name;
+		name = NULL;
+		ptop++;
+	}
+	if (phistory[i].best == 0 ||
+		rows > 2 * phistory[i].rows || 2 * rows < phistory[i].rows) {
+		/* new or substantially changed table: start over */
+		phistory[i].best = phistory[i].probe = *pieces;
+		phistory[i].bestcost = 0;
+		phistory[i].up = 1;
+		phistory[i].runs = 0;
+		phistory[i].misses = 0;
+	}
+	phistory[i].rows = rows ? rows : 1;
+	phistory[i].maxpieces = maxpieces;
+	*pieces = phistory[i].probe;
+	MT_lock_unset(&mal_partitionLock);
+	GDKfree(name);
+	return i;
+}
+
+void
+runtimePartitionFeedback(int entry, int pieces, lng usec)
+{
+	struct PARTITIONHISTORY *h;
+	lng cost;
+
+	MT_lock_set(&mal_partitionLock);
+	if (entry < 0 || entry >= ptop) {
+		MT_lock_unset(&mal_partitionLock);
+		return;
+	}
+	h = &phistory[entry];
+	cost = usec * 1000 / (lng) h->rows;
+	if (pieces == h->best) {
+		h->bestcost = h->bestcost ? (3 * h->bestcost + cost) / 4 : cost;
+		if (++h->runs % PROBEINTERVAL == 0 && h->probe == h->best &&
+			h->misses < 2) {
+			h->probe = h->up ? 2 * h->best : h->best / 2;
+			if (h->probe < 2)
+				h->probe = 2;
+			if (h->probe > h->maxpieces)
+				h->probe = h->maxpieces;
+			h->up = !h->up;
+			if (h->probe == h->best)
+				h->misses++;	/* nothing to try that way */
+		}
+	} else if (pieces == h->probe) {
+		if (cost < h->bestcost) {
+			/* keep going in the same direction */
+			h->up = h->probe > h->best;
+			h->best = h->probe;
+			h->bestcost = cost;
+			h->runs = 0;
+			h->misses = 0;
+		} else
+			h->misses++;
+		h->probe = h->best;
+	}
+	MT_lock_unset(&mal_partitionLock);
+}
+
+/* Should a plan partitioned into this many pieces be recompiled? */
+int
+runtimePartitionOverdue(int entry, int pieces)
+{
+	int ret = 0;
+
+	MT_lock_set(&mal_partitionLock);
+	if (entry >= 0 && entry < ptop)
+		ret = phistory[entry].probe != pieces;
+	MT_lock_unset(&mal_partitionLock);
+	return ret;
+}
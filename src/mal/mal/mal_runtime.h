@@ -42,6 +42,9 @@ mal_export void runtimeProfileExit(Client cntxt, MalBlkPtr mb, MalStkPtr stk, In
 mal_export void finishSessionProfiler(Client cntxt);
 mal_export lng getVolume(MalStkPtr stk, InstrPtr pci, int rd);
 mal_export lng getBatSpace(BAT *b);
+mal_export int runtimePartitionAdvice(const char *plan, const char *schema, const char *table, BUN rows, int maxpieces, int *pieces);
+mal_export void runtimePartitionFeedback(int entry, int pieces, lng usec);
+mal_export int runtimePartitionOverdue(int entry, int pieces);
 
 mal_export QueryQueue QRYqueue;
 #endif
@@ -132,6 +132,15 @@ MSinitClientPrg(Client cntxt, str mod, str nme)
  *
  * The scheduleClient receives a challenge response consisting of
  * endian:user:password:lang:database:
+ * optionally followed by compression:blocksize: to switch both streams
+ * to (compressed) blocks of blocksize bytes right after this line, e.g.
+ * COMPRESSION_LZ4:1048576:.  A further COLUMNAR: field asks for query
+ * results as binary column blocks (see mvc_export_table_columnar).
+ * The server confirms a request it honours with a
+ * #compression:method:blocksize:format: line in the plain protocol, and
+ * only then switches; the client switches when it reads that line.
+ * Requests it does not understand are ignored, so old servers, monetdbd
+ * and this one all answer in the plain protocol unless they confirm.
  */
 static void
 exit_streams( bstream *fin, stream *fout )
@@ -147,11 +156,17 @@ exit_streams( bstream *fin, stream *fout )
 
 const char* mal_enableflag = "mal_for_all";
 
+/* block sizes a client may request when it asks for block_stream2 */
+#define MAL_BLOCKSIZE		(1024 * 1024)
+#define MAL_MAXBLOCKSIZE	(64 * 1024 * 1024)
+
 void
 MSscheduleClient(str command, str challenge, bstream *fin, stream *fout)
 {
 	char *user = command, *algo = NULL, *passwd = NULL, *lang = NULL;
 	char *database = NULL, *s, *dbname;
+	char *compression = NULL, *blocksize = NULL, *format = NULL;
+	int columnar = 0;
 	Client c;
 
 	/* decode BIG/LIT:user:{cypher}passwordchal:lang:database: line */
@@ -215,10 +230,76 @@ MSscheduleClient(str command, str challenge, bstream *fin, stream *fout)
 	if (s) {
 		*s = 0;
 		database = s + 1;
-		/* we can have stuff following, make it void */
+		/* an optional compression method, block size and
+		 * result format may follow, anything after that is
+		 * void */
 		s = strchr(database, ':');
-		if (s)
+		if (s) {
 			*s = 0;
+			compression = s + 1;
+			s = strchr(compression, ':');
+			if (s) {
+				*s = 0;
+				blocksize = s + 1;
+				s = strchr(blocksize, ':');
+				if (s) {
+					*s = 0;
+					format = s + 1;
+					s = strchr(format, ':');
+					if (s)
+						*s = 0;
+				}
+			}
+		}
+	}
+
+	if (compression != NULL && *compression != '\0') {
+		compression_method comp = COMPRESSION_NONE;
+		size_t bufsiz = MAL_BLOCKSIZE;
+		int ok = 1;
+		stream *ns;
+
+		/* a request we cannot honour is ignored, the login then
+		 * continues in the plain protocol */
+		if (strcmp(compression, "COMPRESSION_NONE") == 0)
+			comp = COMPRESSION_NONE;
+		else if (strcmp(compression, "COMPRESSION_LZ4") == 0)
+			comp = COMPRESSION_LZ4;
+		else if (strcmp(compression, "COMPRESSION_ZSTD") == 0)
+			comp = COMPRESSION_ZSTD;
+		else
+			ok = 0;
+		if (ok && !compression_supported(comp))
+			ok = 0;
+		if (ok && blocksize != NULL && *blocksize != '\0') {
+			bufsiz = (size_t) strtoul(blocksize, &s, 10);
+			if (*s != '\0' || bufsiz < BLOCK || bufsiz > MAL_MAXBLOCKSIZE)
+				ok = 0;
+		}
+		if (ok) {
+			/* the client has not switched yet, so this error
+			 * still goes out in the plain protocol */
+			if ((ns = block_stream2(fin->s, bufsiz, comp)) == NULL) {
+				mnstr_printf(fout, "!could not set up compressed streams\n");
+				exit_streams(fin, fout);
+				GDKfree(command);
+				return;
+			}
+			fin->s = ns;
+			columnar = format != NULL && strcmp(format, "COLUMNAR") == 0;
+			/* confirm in the plain protocol, the client switches
+			 * when it sees this and every later reply, errors
+			 * included, uses the new framing */
+			mnstr_printf(fout, "#compression:%s:" SZFMT ":%s:\n",
+				     compression, bufsiz, columnar ? "COLUMNAR" : "");
+			mnstr_flush(fout);
+			if ((ns = block_stream2(fout, bufsiz, comp)) == NULL) {
+				exit_streams(fin, fout);
+				GDKfree(command);
+				return;
+			}
+			fout = ns;
+		}
 	}
 
 	dbname = GDKgetenv("gdk_dbname");
@@ -261,6 +342,7 @@ MSscheduleClient(str command, str challenge, bstream *fin, stream *fout)
 			GDKfree(command);
 			return;
 		}
+		c->columnar = columnar;
 		/* move this back !! */
 		if (c->nspace == 0) {
 			c->nspace = newModule(NULL, putName("user"));
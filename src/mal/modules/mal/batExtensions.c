@@ -253,3 +253,20 @@ CMDBATimprintsize(lng *ret, bat *bid)
 	BBPunfix(b->batCacheid);
 	return MAL_SUCCEED;
 }
+
+str
+CMDBATtrigrams(void *ret, bat *bid)
+{
+	BAT *b;
+	gdk_return r;
+
+	(void) ret;
+	if ((b = BATdescriptor(*bid)) == NULL)
+		throw(MAL, "bat.trigrams", INTERNAL_BAT_ACCESS);
+
+	r = BATtrigrams(b);
+	BBPunfix(b->batCacheid);
+	if (r == GDK_FAIL)
+		throw(MAL, "bat.trigrams", GDK_EXCEPTION);
+	return MAL_SUCCEED;
+}
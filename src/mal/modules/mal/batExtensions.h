@@ -22,5 +22,6 @@ mal_export str CMDBATpartition(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrP
 mal_export str CMDBATpartition2(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci);
 mal_export str CMDBATimprints(void *ret, bat *bid);
 mal_export str CMDBATimprintsize(lng *ret, bat *bid);
+mal_export str CMDBATtrigrams(void *ret, bat *bid);
 
 #endif /* _BAT_EXTENSIONS_ */
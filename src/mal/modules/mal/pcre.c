@@ -1273,6 +1273,94 @@ BATPCREnotilike2(bat *ret, const bat *bid, const str *pat)
 	return(BATPCREnotilike(ret, bid, pat, &esc));
 }
 
+/* Split a LIKE pattern into the literal strings that any match must
+ * contain, i.e. the parts between the wildcards.  Escape characters
+ * also split the pattern, which is always safe.  Only keywords of at
+ * least three characters (one trigram) are returned. */
+static str
+like_keywords(char ***keysp, int *nkeysp, const char *pat, int esc)
+{
+	char **keys;
+	char *buf, *p;
+	int nkeys = 0;
+
+	*keysp = NULL;
+	*nkeysp = 0;
+	/* at most one keyword per four pattern characters */
+	keys = GDKmalloc((strlen(pat) / 4 + 1) * sizeof(char *));
+	buf = GDKmalloc(strlen(pat) + 1);
+	if (keys == NULL || buf == NULL) {
+		GDKfree(keys);
+		GDKfree(buf);
+		throw(MAL, "pcre.likesubselect", MAL_MALLOC_FAIL);
+	}
+	for (p = buf; ; pat++) {
+		if (*pat == 0 || *pat == '%' || *pat == '_' || *pat == esc) {
+			if (p - buf >= 3) {
+				*p = 0;
+				if ((keys[nkeys] = GDKstrdup(buf)) == NULL) {
+					while (nkeys > 0)
+						GDKfree(keys[--nkeys]);
+					GDKfree(keys);
+					GDKfree(buf);
+					throw(MAL, "pcre.likesubselect", MAL_MALLOC_FAIL);
+				}
+				nkeys++;
+			}
+			p = buf;
+			if (*pat == 0)
+				break;
+			if (*pat == esc && pat[1])
+				pat++;	/* skip escaped character */
+		} else {
+			*p++ = *pat;
+		}
+	}
+	GDKfree(buf);
+	if (nkeys == 0) {
+		GDKfree(keys);
+		return MAL_SUCCEED;
+	}
+	*keysp = keys;
+	*nkeysp = nkeys;
+	return MAL_SUCCEED;
+}
+
+/* Use the trigram index on a persistent string column to reduce the
+ * candidate list for a LIKE selection.  On return, *cp is either NULL
+ * (there is no index, or it cannot help: use s) or a new candidate
+ * list. */
+static str
+like_trigram_candidates(BAT **cp, BAT *b, BAT *s, const char *pat, const char *esc, int caseignore)
+{
+	BAT *tmp;
+	bat parent = VIEWtparent(b);
+	char **keys;
+	int nkeys, i;
+	str res;
+
+	*cp = NULL;
+	if (b->batPersistence != PERSISTENT &&
+	    (parent == 0 ||
+	     (tmp = BBPquickdesc(abs(parent), 0)) == NULL ||
+	     tmp->batPersistence != PERSISTENT))
+		return MAL_SUCCEED;
+	res = like_keywords(&keys, &nkeys, pat,
+			    strcmp(esc, str_nil) == 0 ? '\\' : (unsigned char) *esc);
+	if (res != MAL_SUCCEED || nkeys == 0)
+		return res;
+	if (BATtrigramselect(cp, b, s, (const char *const *) keys, nkeys, caseignore) != GDK_SUCCEED) {
+		/* not interested in BATtrigramselect errors, fall
+		 * back to a scan */
+		GDKclrerr();
+		*cp = NULL;
+	}
+	for (i = 0; i < nkeys; i++)
+		GDKfree(keys[i]);
+	GDKfree(keys);
+	return MAL_SUCCEED;
+}
+
 str
 PCRElikesubselect2(bat *ret, const bat *bid, const bat *sid, const str *pat, const str *esc, const bit *caseignore, const bit *anti)
 {
@@ -1315,6 +1403,24 @@ PCRElikesubselect2(bat *ret, const bat *bid, const bat *sid, const str *pat, con
 		}
 	}
 
+	if ((use_re || ppat != NULL) && !*anti) {
+		BAT *c;
+
+		res = like_trigram_candidates(&c, b, s, *pat, *esc, *caseignore);
+		if (res != MAL_SUCCEED) {
+			BBPunfix(b->batCacheid);
+			if (s)
+				BBPunfix(s->batCacheid);
+			GDKfree(ppat);
+			return res;
+		}
+		if (c != NULL) {
+			if (s)
+				BBPunfix(s->batCacheid);
+			s = c;
+		}
+	}
+
 	if (use_re) {
 		res = re_likesubselect(&bn, b, s, *pat, *caseignore, *anti);
 	} else if (ppat == NULL) {
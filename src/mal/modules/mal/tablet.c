@@ -287,20 +287,49 @@ TABLETcollect_parts(BAT **bats, Tablet *as, BUN offset)
 	return MAL_SUCCEED;
 }
 
-// the starting quote character has already been skipped
+/*
+ * Separators, quotes and escapes are located a word at a time: a byte
+ * equal to c shows up as a zero byte in the word xor-ed with c, and
+ * zero bytes are detected with the classic bit trick. Only words are
+ * read that are aligned, hence never cross into an unmapped page.
+ */
+#define SWAR_ONES	((uint64_t) 0x0101010101010101ULL)
+#define SWAR_HIGH	((uint64_t) 0x8080808080808080ULL)
+#define SWAR_ZERO(v)	(((v) - SWAR_ONES) & ~(v) & SWAR_HIGH)
 
+/* return the first occurrence of c, a backslash or the end of string */
+static inline char *
+tablet_scan(char *s, char c)
+{
+	const uint64_t mc = SWAR_ONES * (unsigned char) c;
+	const uint64_t me = SWAR_ONES * (unsigned char) '\\';
+	uint64_t v;
+
+	for (; ((uintptr_t) s & (sizeof(uint64_t) - 1)) != 0; s++)
+		if (*s == 0 || *s == c || *s == '\\')
+			return s;
+	for (;; s += sizeof(uint64_t)) {
+		memcpy(&v, s, sizeof(uint64_t));
+		if (SWAR_ZERO(v) | SWAR_ZERO(v ^ mc) | SWAR_ZERO(v ^ me))
+			break;
+	}
+	while (*s != 0 && *s != c && *s != '\\')
+		s++;
+	return s;
+}
+
+// the starting quote character has already been skipped
 static char *
 tablet_skip_string(char *s, char quote)
 {
-	while (*s) {
-		if (*s == '\\' && s[1] != '\0')
-			s++;
-		else if (*s == quote) {
-			if (s[1] == quote)
-				*s++ = '\\';	/* sneakily replace "" with \" */
-			else
-				break;
-		}
+	while (*(s = tablet_scan(s, quote))) {
+		if (*s == '\\') {
+			if (s[1] != '\0')
+				s++;
+		} else if (s[1] == quote)
+			*s++ = '\\';	/* sneakily replace "" with \" */
+		else
+			break;
 		s++;
 	}
 	assert(*s == quote || *s == '\0');
@@ -375,11 +404,12 @@ output_line(char **buf, int *len, char **localbuf, int *locallen, Column *fmt, s
 	return 0;
 }
 
+/* the line is appended at *fillp, it is only written when fd is set */
 static inline int
-output_line_dense(char **buf, int *len, char **localbuf, int *locallen, Column *fmt, stream *fd, BUN nr_attrs)
+output_line_dense(char **buf, int *len, int *fillp, char **localbuf, int *locallen, Column *fmt, stream *fd, BUN nr_attrs)
 {
 	BUN i;
-	int fill = 0;
+	int fill = *fillp;
 
 	for (i = 0; i < nr_attrs; i++) {
 		Column *f = fmt + i;
@@ -403,13 +433,21 @@ output_line_dense(char **buf, int *len, char **localbuf, int *locallen, Column *
 				if (*buf == NULL)
 					return -1;
 			}
-			strncpy(*buf + fill, p, *len - fill - 1);
+			/* not strncpy, the buffer may be large and
+			 * strncpy pads all of it */
+			memcpy(*buf + fill, p, l);
 			fill += l;
 			f->p++;
+		} else if (fill + f->seplen >= *len) {
+			*buf = GDKrealloc(*buf, fill + f->seplen + BUFSIZ);
+			*len = fill + f->seplen + BUFSIZ;
+			if (*buf == NULL)
+				return -1;
 		}
-		strncpy(*buf + fill, f->sep, *len - fill - 1);
+		memcpy(*buf + fill, f->sep, f->seplen);
 		fill += f->seplen;
 	}
+	*fillp = fill;
 	if (fd && mnstr_write(fd, *buf, 1, fill) != fill)
 		return TABLET_error(fd);
 	return 0;
@@ -550,14 +588,187 @@ output_file_default(Tablet *as, BAT *order, stream *fd)
 	return res;
 }
 
+/*
+ * Large dense exports are rendered in parallel. The rows are cut into
+ * blocks of OUTPUT_BLOCK lines, each worker formats the blocks handed
+ * to it into a private buffer using a private copy of the format, and
+ * the caller writes the buffers to the stream in block order. The
+ * buffers are pre-sized from the column width hints (maxwidth).
+ */
+#define OUTPUT_BLOCK	(64 * 1024)
+#define OUTPUT_PRESIZE	(64 * 1024 * 1024)
+
+typedef struct {
+	MT_Id tid;
+	MT_Sema sema, reply;
+	Tablet *as;
+	Column *fmt;				/* private copy of the format */
+	BUN *pos;					/* first position of each column */
+	BUN lo, hi;					/* block to render */
+	int width;					/* estimated line width */
+	char *buf, *localbuf;
+	int len, locallen, fill;
+	int res;
+	int started, stop;
+} OUTPUTtask;
+
+static void
+output_block(OUTPUTtask *task)
+{
+	BUN i, nr_attrs = task->as->nr_attrs;
+
+	task->fill = 0;
+	task->res = 0;
+	for (i = 0; i < nr_attrs; i++)
+		if (task->fmt[i].c)
+			task->fmt[i].p = task->pos[i] + task->lo;
+	for (i = task->lo; i < task->hi; i++) {
+		if (task->len - task->fill <= task->width) {
+			int len = 2 * task->len + task->width;
+			char *buf = GDKrealloc(task->buf, len);
+
+			if (buf == NULL) {
+				task->res = -1;
+				return;
+			}
+			task->buf = buf;
+			task->len = len;
+		}
+		if ((task->res = output_line_dense(&task->buf, &task->len, &task->fill, &task->localbuf, &task->locallen, task->fmt, NULL, nr_attrs)) < 0)
+			return;
+	}
+}
+
+static void
+output_worker(void *arg)
+{
+	OUTPUTtask *task = (OUTPUTtask *) arg;
+
+	for (;;) {
+		MT_sema_down(&task->sema);
+		if (task->stop)
+			break;
+		output_block(task);
+		MT_sema_up(&task->reply);
+	}
+}
+
+static int
+output_file_parallel(Tablet *as, stream *fd, int threads)
+{
+	OUTPUTtask *ptask;
+	BUN *pos, i, blk, next, blocks = (as->nr + OUTPUT_BLOCK - 1) / OUTPUT_BLOCK;
+	int j, width = 0, res = 0;
+	size_t presize;
+
+	ptask = GDKzalloc(sizeof(OUTPUTtask) * threads);
+	pos = GDKzalloc(sizeof(BUN) * as->nr_attrs);
+	if (ptask == NULL || pos == NULL) {
+		GDKfree(ptask);
+		GDKfree(pos);
+		return -1;
+	}
+	for (i = 0; i < as->nr_attrs; i++) {
+		Column *f = as->format + i;
+
+		if (f->c) {
+			pos[i] = f->p;
+			width += f->maxwidth ? (int) f->maxwidth : 16;
+		}
+		width += f->seplen;
+	}
+	presize = (size_t) width * OUTPUT_BLOCK;
+	if (presize > OUTPUT_PRESIZE)
+		presize = OUTPUT_PRESIZE;
+
+	for (j = 0; j < threads; j++) {
+		OUTPUTtask *task = ptask + j;
+
+		task->as = as;
+		task->pos = pos;
+		task->width = width + BUFSIZ;
+		task->len = (int) presize + task->width;
+		task->locallen = BUFSIZ;
+		task->fmt = GDKmalloc(sizeof(Column) * as->nr_attrs);
+		task->buf = GDKmalloc(task->len);
+		task->localbuf = GDKzalloc(task->locallen);
+		if (task->fmt == NULL || task->buf == NULL || task->localbuf == NULL) {
+			res = -1;
+			threads = j + 1;
+			goto bailout;
+		}
+		memcpy(task->fmt, as->format, sizeof(Column) * as->nr_attrs);
+		MT_sema_init(&task->sema, 0, "task->sema");
+		MT_sema_init(&task->reply, 0, "task->reply");
+		if (MT_create_thread(&task->tid, output_worker, (void *) task, MT_THR_JOINABLE) < 0) {
+			MT_sema_destroy(&task->sema);
+			MT_sema_destroy(&task->reply);
+			res = -1;
+			threads = j + 1;
+			goto bailout;
+		}
+		task->started = 1;
+	}
+
+	/* hand out the first round of blocks, then refill each worker
+	 * as soon as its block has been written; block blk is always
+	 * rendered by worker blk % threads */
+	for (next = 0; next < blocks && next < (BUN) threads; next++) {
+		ptask[next].lo = next * OUTPUT_BLOCK;
+		ptask[next].hi = MIN(as->nr, (next + 1) * OUTPUT_BLOCK);
+		MT_sema_up(&ptask[next].sema);
+	}
+	for (blk = 0; blk < next; blk++) {
+		OUTPUTtask *task = ptask + blk % threads;
+
+		MT_sema_down(&task->reply);
+		if (res == 0 && task->res < 0)
+			res = task->res;
+		if (res == 0 && mnstr_write(fd, task->buf, 1, task->fill) != task->fill)
+			res = TABLET_error(fd);
+		if (res == 0 && next < blocks) {
+			task->lo = next * OUTPUT_BLOCK;
+			task->hi = MIN(as->nr, (next + 1) * OUTPUT_BLOCK);
+			next++;
+			MT_sema_up(&task->sema);
+		}
+	}
+
+  bailout:
+	for (j = 0; j < threads; j++) {
+		OUTPUTtask *task = ptask + j;
+
+		if (task->started) {
+			task->stop = 1;
+			MT_sema_up(&task->sema);
+			MT_join_thread(task->tid);
+			MT_sema_destroy(&task->sema);
+			MT_sema_destroy(&task->reply);
+		}
+		GDKfree(task->fmt);
+		GDKfree(task->buf);
+		GDKfree(task->localbuf);
+	}
+	GDKfree(ptask);
+	GDKfree(pos);
+	return res;
+}
+
 static int
 output_file_dense(Tablet *as, stream *fd)
 {
-	int len = BUFSIZ, locallen = BUFSIZ, res = 0;
-	char *buf = GDKzalloc(len);
-	char *localbuf = GDKzalloc(len);
+	int len = BUFSIZ, locallen = BUFSIZ, res = 0, fill;
+	char *buf, *localbuf;
 	BUN i = 0;
+	int threads = GDKnr_threads < MAXWORKERS ? GDKnr_threads : MAXWORKERS;
 
+	if (threads > 1 && as->nr > OUTPUT_BLOCK) {
+		if ((BUN) threads > (as->nr + OUTPUT_BLOCK - 1) / OUTPUT_BLOCK)
+			threads = (int) ((as->nr + OUTPUT_BLOCK - 1) / OUTPUT_BLOCK);
+		return output_file_parallel(as, fd, threads);
+	}
+	buf = GDKzalloc(len);
+	localbuf = GDKzalloc(len);
 	if (buf == NULL || localbuf == NULL) {
 		if (buf)
 			GDKfree(buf);
@@ -566,7 +777,8 @@ output_file_dense(Tablet *as, stream *fd)
 		return -1;
 	}
 	for (i = 0; i < as->nr; i++) {
-		if ((res = output_line_dense(&buf, &len, &localbuf, &locallen, as->format, fd, as->nr_attrs)) < 0) {
+		fill = 0;
+		if ((res = output_line_dense(&buf, &len, &fill, &localbuf, &locallen, as->format, fd, as->nr_attrs)) < 0) {
 			GDKfree(buf);
 			GDKfree(localbuf);
 			return res;
@@ -662,6 +874,13 @@ TABLEToutput_file(Tablet *as, BAT *order, stream *s)
  *
  * The work divider allocates subtasks to threads based on the
  * observed time spending so far.
+ *
+ * Tables with fewer columns than threads would leave most workers idle
+ * in the update phase. In that case the fixed width columns are filled
+ * in row slices instead: the BATs are extended up front and each worker
+ * converts its own range of rows straight into place. Variable sized
+ * columns keep being handled per column, because their heaps can not be
+ * appended to concurrently.
  */
 
 /* #define MLOCK_TST did not make a difference on sf10 */
@@ -704,6 +923,8 @@ typedef struct {
 	int cur;  /* current buffer used by splitter and update threads */
 
 	int *cols;					/* columns to handle */
+	int rowwise;				/* fill fixed width columns by row slices */
+	BUN first;					/* BAT count at the start of the block */
 	char ***fields;
 	int besteffort;
 	bte *rowerror;
@@ -875,11 +1096,12 @@ SQLload_error(READERtask *task, lng idx, BUN attrs)
  * If inserting fails, we return -1; if the value cannot be parsed, we
  * return -1 if besteffort is not set, otherwise we return 0, but in
  * either case an entry is added to the error table.
+ * The value is appended, unless pos is given, in which case it is
+ * stored at that row of a fixed width column extended beforehand.
  */
 static inline int
-SQLinsert_val(READERtask *task, int col, int idx)
+SQLinsert_val(READERtask *task, Column *fmt, int col, int idx, BUN pos)
 {
-	Column *fmt = task->as->format + col;
 	const void *adt;
 	char buf[BUFSIZ];
 	char *s = task->fields[col][idx];
@@ -934,7 +1156,10 @@ SQLinsert_val(READERtask *task, int col, int idx)
 		adt = fmt->nildata;
 		fmt->c->T->nonil = 0;
 	}
-	bunfastapp(fmt->c, adt);
+	if (pos == BUN_NONE)
+		bunfastapp(fmt->c, adt);
+	else
+		memcpy(Tloc(fmt->c, BUNfirst(fmt->c) + pos), adt, fmt->c->T->width);
 	return ret;
   bunins_failed:
 	if (task->rowerror) {
@@ -954,15 +1179,109 @@ SQLinsert_val(READERtask *task, int col, int idx)
 	return -1;
 }
 
+/*
+ * Plain integers are by far the most common field. They are parsed
+ * inline, accepting only an optional sign followed by at most 18 digits
+ * within the range of the type, which keeps it exact without overflow
+ * checks per digit.
+ */
+static inline int
+tablet_int(const char *s, lng max, lng *v)
+{
+	int neg = 0, n;
+	lng r = 0;
+
+	if (*s == '-') {
+		neg = 1;
+		s++;
+	} else if (*s == '+')
+		s++;
+	for (n = 0; *s >= '0' && *s <= '9'; s++, n++)
+		r = 10 * r + (*s - '0');
+	if (*s || n == 0 || n > 18 || r > max)
+		return 0;
+	*v = neg ? -r : r;
+	return 1;
+}
+
+#define INPLACE_INT(TYPE, MAX)						\
+	do {								\
+		TYPE *d = (TYPE *) dst;					\
+		lng v;							\
+		for (j = lo; j < hi; j++) {				\
+			if (fields[j] == NULL) {			\
+				d[j] = TYPE##_nil;			\
+				fmt->c->T->nonil = 0;			\
+			} else if (tablet_int(fields[j], (lng) (MAX), &v)) \
+				d[j] = (TYPE) v;			\
+			else if (SQLinsert_val(task, fmt, col, j, first + j) < 0) \
+				return -1;				\
+		}							\
+	} while (0)
+
+/*
+ * Convert rows [lo,hi) of a fixed width column straight into the BAT
+ * tail, from row first onwards, without going through the per value
+ * frstr callback and its intermediate buffer. Other atoms than plain
+ * integers are parsed by their fromstr into the destination slot. Any
+ * field these fast paths do not accept, including nil and erroneous
+ * ones, is passed on to SQLinsert_val, so the outcome is the same.
+ */
+static int
+SQLconvert_rows(READERtask *task, Column *fmt, int col, int lo, int hi, BUN first)
+{
+	char **fields = task->fields[col];
+	char *dst = Tloc(fmt->c, BUNfirst(fmt->c) + first);
+	int j;
+
+	if (!fmt->inplace) {
+		for (j = lo; j < hi; j++)
+			if (SQLinsert_val(task, fmt, col, j, first + j) < 0)
+				return -1;
+		return 0;
+	}
+	if (fmt->adt == TYPE_bte)
+		INPLACE_INT(bte, GDK_bte_max);
+	else if (fmt->adt == TYPE_sht)
+		INPLACE_INT(sht, GDK_sht_max);
+	else if (fmt->adt == TYPE_int)
+		INPLACE_INT(int, GDK_int_max);
+	else if (fmt->adt == TYPE_lng)
+		INPLACE_INT(lng, GDK_lng_max);
+	else {
+		int (*fromstr)(const char *, int *, ptr *) = BATatoms[fmt->adt].atomFromStr;
+		int width = fmt->c->T->width, len, n;
+		const char *s;
+		ptr p;
+
+		for (j = lo; j < hi; j++) {
+			s = fields[j];
+			/* the slot is large enough, fromstr will not reallocate it */
+			p = dst + (size_t) j * width;
+			len = width;
+			if (s && strcmp(s, "nil") != 0 &&
+				(n = fromstr(s, &len, &p)) > 0 && s[n] == 0)
+				continue;
+			if (SQLinsert_val(task, fmt, col, j, first + j) < 0)
+				return -1;
+		}
+	}
+	return 0;
+}
+
 static int
 SQLworker_column(READERtask *task, int col)
 {
-	int i;
+	int i, ret;
+	BUN first;
 	Column *fmt = task->as->format;
 
+	if (fmt[col].skip)
+		return 0;
+
 	/* watch out for concurrent threads */
 	MT_lock_set(&mal_copyLock);
-	if (!fmt[col].skip && BATcapacity(fmt[col].c) < BATcount(fmt[col].c) + task->next) {
+	if (BATcapacity(fmt[col].c) < BATcount(fmt[col].c) + task->next) {
 		if (BATextend(fmt[col].c, BATgrows(fmt[col].c) + task->limit) != GDK_SUCCEED) {
 			tablet_error(task, lng_nil, col, "Failed to extend the BAT, perhaps disk full\n", "SQLworker_column");
 			MT_lock_unset(&mal_copyLock);
@@ -971,8 +1290,14 @@ SQLworker_column(READERtask *task, int col)
 	}
 	MT_lock_unset(&mal_copyLock);
 
+	if (!ATOMvarsized(fmt[col].adt)) {
+		first = BATcount(fmt[col].c);
+		ret = SQLconvert_rows(task, fmt + col, col, 0, task->top[task->cur], first);
+		BATsetcount(fmt[col].c, first + task->top[task->cur]);
+		return ret;
+	}
 	for (i = 0; i < task->top[task->cur]; i++) {
-		if (!fmt[col].skip && SQLinsert_val(task, col, i) < 0) {
+		if (SQLinsert_val(task, fmt + col, col, i, BUN_NONE) < 0) {
 			return -1;
 		}
 	}
@@ -980,6 +1305,41 @@ SQLworker_column(READERtask *task, int col)
 	return 0;
 }
 
+#define ROWWISE(task, fmt)	((task)->rowwise && !(fmt)->skip && !ATOMvarsized((fmt)->adt))
+
+/*
+ * Convert this worker's slice of the rows for all fixed width columns.
+ * The BATs have been extended by the reader, which also sets their
+ * count once all workers are done.
+ */
+static int
+SQLworker_rows(READERtask *task)
+{
+	BUN i;
+	int piece, lo, hi;
+	Column *fmt = task->as->format;
+
+	piece = (task->top[task->cur] + task->workers) / task->workers;
+	lo = piece * task->id;
+	hi = MIN(lo + piece, task->top[task->cur]);
+	for (i = 0; i < task->as->nr_attrs; i++) {
+		Column c;
+
+		if (!ROWWISE(task, fmt + i))
+			continue;
+		/* frstr leaves its result in the column buffer, use a private one */
+		c = fmt[i];
+		c.data = NULL;
+		c.len = 0;
+		if (SQLconvert_rows(task, &c, (int) i, lo, hi, task->first) < 0) {
+			GDKfree(c.data);
+			return -1;
+		}
+		GDKfree(c.data);
+	}
+	return 0;
+}
+
 /*
  * The lines are broken on the column separator. Any error is shown and reflected with
  * setting the reference of the offending row fields to NULL.
@@ -1034,7 +1394,7 @@ SQLload_parse_line(READERtask *task, int idx)
 			}
 
 			/* eat away the column separator */
-			for (; *line; line++)
+			for (; *(line = tablet_scan(line, ch)); line++)
 				if (*line == '\\') {
 					if (line[1])
 						line++;
@@ -1073,7 +1433,7 @@ SQLload_parse_line(READERtask *task, int idx)
 		mnstr_printf(GDKout, "before #2 %s\n", line);
 #endif
 		/* eat away the column separator */
-		for (; *line; line++)
+		for (; *(line = tablet_scan(line, ch)); line++)
 			if (*line == '\\') {
 				if (line[1])
 					line++;
@@ -1163,8 +1523,14 @@ SQLworker(void *arg)
 			break;
 		case UPDATEBAT:
 			/* stage two, updating the BATs */
+			if (task->rowwise) {
+				t0 = GDKusec();
+				if (SQLworker_rows(task) < 0)
+					break;
+				task->wtime += GDKusec() - t0;
+			}
 			for (i = 0; i < task->as->nr_attrs; i++)
-				if (task->cols[i]) {
+				if (task->cols[i] && !ROWWISE(task, task->as->format + task->cols[i] - 1)) {
 					t0 = GDKusec();
 					if (SQLworker_column(task, task->cols[i] - 1) < 0)
 						break;
@@ -1704,9 +2070,8 @@ SQLload_file(Client cntxt, Tablet *as, bstream *b, stream *out, char *csep, char
 #endif
 	as->error = NULL;
 
-	/* there is no point in creating more threads than we have columns */
-	if (as->nr_attrs < (BUN) threads)
-		threads = (int) as->nr_attrs;
+	/* with more threads than columns, fill the fixed width ones by rows */
+	task->rowwise = as->nr_attrs < (BUN) threads;
 
 	/* allocate enough space for pointers into the buffer pool.  */
 	/* the record separator is considered a column */
@@ -1812,6 +2177,21 @@ SQLload_file(Client cntxt, Tablet *as, bstream *b, stream *out, char *csep, char
 #endif
 		lio += GDKusec() - t1;	/* line break done */
 		if (task->top[task->cur]) {
+			if (res == 0 && task->rowwise) {
+				/* make room for the row slices written in place */
+				for (attr = 0; attr < as->nr_attrs; attr++) {
+					BAT *c = as->format[attr].c;
+					if (ROWWISE(task, as->format + attr) &&
+						BATcapacity(c) < cntstart + task->top[task->cur] &&
+						BATextend(c, BATgrows(c) + task->limit) != GDK_SUCCEED) {
+						tablet_error(task, lng_nil, (int) attr, "Failed to extend the BAT, perhaps disk full\n", "SQLload_file");
+						res = -1;
+						break;
+					}
+				}
+				for (j = 0; j < threads; j++)
+					ptask[j].first = cntstart;
+			}
 			if (res == 0) {
 				SQLworkdivider(task, ptask, (int) as->nr_attrs, threads);
 
@@ -1835,6 +2215,10 @@ SQLload_file(Client cntxt, Tablet *as, bstream *b, stream *out, char *csep, char
 					best = 0;
 				}
 			}
+			if (task->rowwise)
+				for (attr = 0; attr < as->nr_attrs; attr++)
+					if (ROWWISE(task, as->format + attr))
+						BATsetcount(as->format[attr].c, cntstart + task->top[task->cur]);
 		}
 
 		/* trim the BATs discarding error tuples */
@@ -48,6 +48,7 @@ typedef struct Column_t {
 	void *extra;
 	void *data;
 	int skip;					/* only skip to the next field */
+	int inplace;				/* frstr is the plain atom parser */
 	int len;
 	int nillen;
 	bit ws;						/* if set we need to skip white space */
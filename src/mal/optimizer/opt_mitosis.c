@@ -9,6 +9,7 @@
 #include "monetdb_config.h"
 #include "opt_mitosis.h"
 #include "mal_interpreter.h"
+#include "mal_runtime.h"
 #include <gdk_utils.h>
 
 static int
@@ -39,14 +40,15 @@ OPTmitosisPlanOverdue(Client cntxt, str fname)
 
     s = findSymbol(cntxt->nspace, userRef, fname);
     if(s )
-        return s->def->activeClients != MCactiveClients();
+        return s->def->activeClients != MCactiveClients() ||
+			runtimePartitionOverdue(s->def->partition, s->def->pieces);
     return 0;
 }
 
 int
 OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 {
-	int i, j, limit, slimit, estimate = 0, pieces = 1, mito_parts = 0, mito_size = 0, row_size = 0, mt = -1;
+	int i, j, limit, slimit, estimate = 0, pieces = 1, mito_parts = 0, mito_size = 0, row_size = 0, mt = -1, morsels, history = -1;
 	str schema = 0, table = 0;
 	BUN r = 0, rowcnt = 0;    /* table should be sizeable to consider parallel execution*/
 	InstrPtr q, *old, target = 0;
@@ -139,8 +141,16 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 		pieces = (int) (rowcnt / (m / threads / activeClients)) + 1;
 	} else if (rowcnt > MINPARTCNT) {
 	/* exploit parallelism, but ensure minimal partition size to
-	 * limit overhead */
-		pieces = (int) MIN(rowcnt / MINPARTCNT, (BUN) threads);
+	 * limit overhead.  With the mito_morsels setting, large tables
+	 * are cut into that many pieces per thread.  The dataflow
+	 * workers pick up the pieces as they become idle, so a piece
+	 * that is expensive due to a skewed selection does not leave
+	 * the other threads waiting, at the cost of a plan that grows
+	 * with the number of pieces. */
+		morsels = GDKgetenv_int("mito_morsels", MORSELS);
+		if (morsels < 1)
+			morsels = 1;
+		pieces = (int) MIN(rowcnt / MINPARTCNT, (BUN) threads * morsels);
 	}
 	/* when testing, always aim for full parallelism, but avoid
 	 * empty pieces */
@@ -150,15 +160,26 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 	/* prevent plan explosion */
 	if (pieces > MAXSLICES)
 		pieces = MAXSLICES;
+	/* let earlier executions of this plan refine the estimate,
+	 * trying at most a few pieces per thread */
+	if (pieces > 1)
+		history = runtimePartitionAdvice(getFunctionId(getInstrPtr(mb, 0)),
+										 getVarConstant(mb, getArg(target, 2)).val.sval,
+										 getVarConstant(mb, getArg(target, 3)).val.sval,
+										 rowcnt, MAX(pieces, MIN(MAXSLICES, 4 * threads)), &pieces);
 	/* to enable experimentation we introduce the option to set
 	 * the number of parts required and/or the size of each chunk (in K)
 	 */
 	mito_parts = GDKgetenv_int("mito_parts", 0);
-	if (mito_parts > 0) 
+	if (mito_parts > 0) {
 		pieces = mito_parts;
+		history = -1;
+	}
 	mito_size = GDKgetenv_int("mito_size", 0);
-	if (mito_size > 0) 
+	if (mito_size > 0) {
 		pieces = (int) ((rowcnt * row_size) / (mito_size * 1024));
+		history = -1;
+	}
 
 	OPTDEBUGmitosis
 	mnstr_printf(cntxt->fdout, "#opt_mitosis: target is %s.%s "
@@ -170,6 +191,8 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 				 rowcnt, row_size, m, threads, pieces, mito_parts, mito_size);
 	if (pieces <= 1)
 		return 0;
+	mb->partition = history;
+	mb->pieces = pieces;
 
 	limit = mb->stop;
 	slimit = mb->ssize;
@@ -13,6 +13,11 @@
 
 #define MAXSLICES 256		/* to be refined */
 #define MINPARTCNT 100000	/* minimal record count per partition */
+/* Pieces per thread for large tables.  Cutting tables into more pieces
+ * than threads is opt-in through the mito_morsels setting: without
+ * morsel-driven execution every extra piece copies the plan, so one
+ * piece per thread stays the default. */
+#define MORSELS 1
 
 mal_export int OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p);
 mal_export int OPTmitosisPlanOverdue(Client cntxt, str fname);
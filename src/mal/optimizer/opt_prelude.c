@@ -61,6 +61,7 @@ str subcountRef;
 str copyRef;
 str copy_fromRef;
 str export_tableRef;
+str export_binRef;
 str count_no_nilRef;
 str crossRef;
 str createRef;
@@ -279,6 +280,7 @@ void optimizerInit(void)
 	copyRef = putName("copy");
 	copy_fromRef = putName("copy_from");
 	export_tableRef = putName("export_table");
+	export_binRef = putName("export_bin");
 	count_no_nilRef = putName("count_no_nil");
 	crossRef = putName("crossproduct");
 	createRef = putName("create");
@@ -59,6 +59,7 @@ mal_export  str subcountRef;
 mal_export  str copyRef;
 mal_export  str copy_fromRef;
 mal_export  str export_tableRef;
+mal_export  str export_binRef;
 mal_export  str count_no_nilRef;
 mal_export  str crossRef;
 mal_export  str createRef;
@@ -1,3 +1,6 @@
+#include <string.h>
+#include <limits.h>
+#include <float.h>
 #include <R.h>
 #include <Rdefines.h>
 #include "mapisplit.h"
@@ -48,3 +51,170 @@ SEXP mapi_split(SEXP mapiLinesVector, SEXP numCols) {
 	UNPROTECT(1);
 	return colVec;
 }
+
+SEXP mapi_lz4_decompress_block(SEXP block, SEXP maxSize) {
+	int max = INTEGER_POINTER(AS_INTEGER(maxSize))[0];
+	long len;
+
+	if (TYPEOF(block) != RAWSXP || max < 0) {
+		error("Invalid input to mapi_lz4_decompress_block: type=%d, max=%d", TYPEOF(block), max);
+	}
+	SEXP out = PROTECT(allocVector(RAWSXP, max));
+	len = mapi_lz4_decompress(RAW(block), LENGTH(block), RAW(out), max);
+	if (len < 0) {
+		UNPROTECT(1);
+		error("Corrupt LZ4 block received from server");
+	}
+	out = lengthgets(out, (R_len_t) len);
+	UNPROTECT(1);
+	return out;
+}
+
+SEXP mapi_lz4_compress_block(SEXP block) {
+	if (TYPEOF(block) != RAWSXP) {
+		error("Invalid input to mapi_lz4_compress_block: type=%d", TYPEOF(block));
+	}
+	size_t len = LENGTH(block);
+	SEXP out = PROTECT(allocVector(RAWSXP, MAPI_LZ4_BOUND(len)));
+	len = mapi_lz4_literals(RAW(block), len, RAW(out));
+	out = lengthgets(out, (R_len_t) len);
+	UNPROTECT(1);
+	return out;
+}
+
+/* fetch a value of width bytes from a columnar payload, swapping it if
+ * the server has the other byte order */
+static void mapi_get_value(const unsigned char* p, int width, int swap, void* val) {
+	int i;
+
+	if (swap) {
+		for (i = 0; i < width; i++) {
+			((unsigned char*) val)[i] = p[width - 1 - i];
+		}
+	} else {
+		memcpy(val, p, width);
+	}
+}
+
+/* Convert a binary columnar result (see mvc_export_table_columnar in the
+ * server) into a list of R vectors. Integers become integer vectors,
+ * except 64 bit ones, which become numeric like they do in dbFetch(). */
+SEXP mapi_columns(SEXP payload, SEXP numCols, SEXP numRows) {
+	int cols = INTEGER_POINTER(AS_INTEGER(numCols))[0];
+	int rows = INTEGER_POINTER(AS_INTEGER(numRows))[0];
+	const unsigned char *p, *end;
+	unsigned int marker = 0;
+	int swap, col, row;
+
+	if (TYPEOF(payload) != RAWSXP || LENGTH(payload) < 4 || rows < 0 || cols < 1) {
+		error("Invalid input to mapi_columns: type=%d, rows=%d, cols=%d", TYPEOF(payload), rows, cols);
+	}
+	p = RAW(payload);
+	end = p + LENGTH(payload);
+	memcpy(&marker, p, 4);
+	if (marker == 0x01020304) {
+		swap = 0;
+	} else if (marker == 0x04030201) {
+		swap = 1;
+	} else {
+		error("Invalid columnar result from server");
+	}
+	p += 4;
+
+	SEXP colVec = PROTECT(NEW_LIST(cols));
+	for (col = 0; col < cols; col++) {
+		unsigned char kind, width;
+		long long nbytes;
+		SEXP colV = R_NilValue;
+
+		if (end - p < 10) {
+			break;
+		}
+		kind = p[0];
+		width = p[1];
+		mapi_get_value(p + 2, 8, swap, &nbytes);
+		p += 10;
+		if (nbytes < 0 || nbytes > end - p ||
+				(kind != 's' && nbytes != (long long) rows * width)) {
+			break;
+		}
+		if (kind == 'i' && width <= 4) {
+			colV = PROTECT(allocVector(INTSXP, rows));
+			for (row = 0; row < rows; row++) {
+				const unsigned char *v = p + (size_t) row * width;
+				int val;
+				if (width == 1) {
+					val = (signed char) v[0];
+					INTEGER(colV)[row] = val == SCHAR_MIN ? NA_INTEGER : val;
+				} else if (width == 2) {
+					short s;
+					mapi_get_value(v, 2, swap, &s);
+					INTEGER(colV)[row] = s == SHRT_MIN ? NA_INTEGER : s;
+				} else {
+					/* INT_MIN is R's NA_INTEGER as well */
+					mapi_get_value(v, 4, swap, &val);
+					INTEGER(colV)[row] = val;
+				}
+			}
+		} else if (kind == 'i' && width == 8) {
+			colV = PROTECT(allocVector(REALSXP, rows));
+			for (row = 0; row < rows; row++) {
+				long long val;
+				mapi_get_value(p + (size_t) row * 8, 8, swap, &val);
+				REAL(colV)[row] = val == LLONG_MIN ? NA_REAL : (double) val;
+			}
+		} else if (kind == 'f' && (width == 4 || width == 8)) {
+			colV = PROTECT(allocVector(REALSXP, rows));
+			for (row = 0; row < rows; row++) {
+				if (width == 4) {
+					float val;
+					mapi_get_value(p + (size_t) row * 4, 4, swap, &val);
+					REAL(colV)[row] = val == -FLT_MAX ? NA_REAL : val;
+				} else {
+					double val;
+					mapi_get_value(p + (size_t) row * 8, 8, swap, &val);
+					REAL(colV)[row] = val == -DBL_MAX ? NA_REAL : val;
+				}
+			}
+		} else if (kind == 'b' && width == 1) {
+			colV = PROTECT(allocVector(LGLSXP, rows));
+			for (row = 0; row < rows; row++) {
+				signed char val = (signed char) p[row];
+				LOGICAL(colV)[row] = val == SCHAR_MIN ? NA_LOGICAL : val != 0;
+			}
+		} else if (kind == 's') {
+			const char *s = (const char*) p, *send = (const char*) p + nbytes;
+			colV = PROTECT(allocVector(STRSXP, rows));
+			for (row = 0; row < rows && s < send; row++) {
+				const char *nul = memchr(s, '\0', send - s);
+				size_t len;
+				if (nul == NULL) {
+					break;
+				}
+				len = nul - s;
+				if (len == 1 && s[0] == '\200') {
+					SET_STRING_ELT(colV, row, NA_STRING);
+				} else {
+					SET_STRING_ELT(colV, row, mkCharLenCE(s, (int) len, CE_UTF8));
+				}
+				s += len + 1;
+			}
+			if (row < rows) {
+				UNPROTECT(1);
+				break;
+			}
+		} else {
+			break;
+		}
+		SET_ELEMENT(colVec, col, colV);
+		UNPROTECT(1);
+		p += nbytes;
+	}
+	if (col < cols) {
+		UNPROTECT(1);
+		error("Invalid columnar result from server in column %d", col + 1);
+	}
+
+	UNPROTECT(1);
+	return colVec;
+}
@@ -75,3 +75,75 @@ void mapi_line_split(char* line, char** out, size_t ncols) {
 		}
 	}
 }
+
+/* Decode a raw LZ4 block (not a frame) as sent by a compressed block
+ * stream.  Returns the decoded size or -1 on malformed input. */
+long mapi_lz4_decompress(const unsigned char* src, size_t srclen, unsigned char* dst, size_t dstlen) {
+	const unsigned char *ip = src, *iend = src + srclen;
+	unsigned char *op = dst, *oend = dst + dstlen;
+
+	while (ip < iend) {
+		unsigned int token = *ip++;
+		size_t len = token >> 4, off;
+		unsigned char c;
+
+		if (len == 15) {
+			do {
+				if (ip >= iend)
+					return -1;
+				c = *ip++;
+				len += c;
+			} while (c == 255);
+		}
+		if (len > (size_t) (iend - ip) || len > (size_t) (oend - op))
+			return -1;
+		memcpy(op, ip, len);
+		op += len;
+		ip += len;
+		/* the last sequence only has literals */
+		if (ip == iend)
+			break;
+		if (iend - ip < 2)
+			return -1;
+		off = ip[0] | ((size_t) ip[1] << 8);
+		ip += 2;
+		if (off == 0 || off > (size_t) (op - dst))
+			return -1;
+		len = token & 15;
+		if (len == 15) {
+			do {
+				if (ip >= iend)
+					return -1;
+				c = *ip++;
+				len += c;
+			} while (c == 255);
+		}
+		len += 4;
+		if (len > (size_t) (oend - op))
+			return -1;
+		/* the match may overlap what it produces */
+		for (; len > 0; len--, op++)
+			*op = *(op - off);
+	}
+	return (long) (op - dst);
+}
+
+/* Encode a block as a single LZ4 sequence of literals, which every LZ4
+ * decoder accepts.  Client requests are small, so this saves us from
+ * carrying a compressor around.  dst needs MAPI_LZ4_BOUND(srclen)
+ * bytes.  Returns the encoded size. */
+size_t mapi_lz4_literals(const unsigned char* src, size_t srclen, unsigned char* dst) {
+	unsigned char *op = dst;
+	size_t len = srclen;
+
+	if (len >= 15) {
+		*op++ = 15 << 4;
+		for (len -= 15; len >= 255; len -= 255)
+			*op++ = 255;
+		*op++ = (unsigned char) len;
+	} else {
+		*op++ = (unsigned char) (len << 4);
+	}
+	memcpy(op, src, srclen);
+	return (size_t) (op - dst) + srclen;
+}
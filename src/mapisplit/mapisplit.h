@@ -1,2 +1,6 @@
 void mapi_unescape(char* in, char* out);
 void mapi_line_split(char* line, char** out, size_t ncols);
+
+#define MAPI_LZ4_BOUND(n) ((n) + (n) / 255 + 16)
+long mapi_lz4_decompress(const unsigned char* src, size_t srclen, unsigned char* dst, size_t dstlen);
+size_t mapi_lz4_literals(const unsigned char* src, size_t srclen, unsigned char* dst);
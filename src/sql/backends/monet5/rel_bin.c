@@ -4347,17 +4347,25 @@ rel2bin_output(mvc *sql, sql_rel *rel, list *refs)
 		list_append(slist, stmt_affected_rows(sql->sa, s));
 		return stmt_list(sql->sa, slist);
 	}
-	n = rel->exps->h;
-	tsep = sa_strdup(sql->sa, E_ATOM_STRING(n->data));
-	rsep = sa_strdup(sql->sa, E_ATOM_STRING(n->next->data));
-	ssep = sa_strdup(sql->sa, E_ATOM_STRING(n->next->next->data));
-	ns   = sa_strdup(sql->sa, E_ATOM_STRING(n->next->next->next->data));
+	if (rel->flag == DDL_BINOUTPUT) {
+		list *files = sa_list(sql->sa);
 
-	if (n->next->next->next->next) {
-		fn = E_ATOM_STRING(n->next->next->next->next->data);
-		fns = stmt_atom_string(sql->sa, sa_strdup(sql->sa, fn));
+		for (n = rel->exps->h; n; n = n->next)
+			list_append(files, sa_strdup(sql->sa, E_ATOM_STRING(n->data)));
+		list_append(slist, stmt_export_bin(sql->sa, s, files));
+	} else {
+		n = rel->exps->h;
+		tsep = sa_strdup(sql->sa, E_ATOM_STRING(n->data));
+		rsep = sa_strdup(sql->sa, E_ATOM_STRING(n->next->data));
+		ssep = sa_strdup(sql->sa, E_ATOM_STRING(n->next->next->data));
+		ns   = sa_strdup(sql->sa, E_ATOM_STRING(n->next->next->next->data));
+
+		if (n->next->next->next->next) {
+			fn = E_ATOM_STRING(n->next->next->next->next->data);
+			fns = stmt_atom_string(sql->sa, sa_strdup(sql->sa, fn));
+		}
+		list_append(slist, stmt_export(sql->sa, s, tsep, rsep, ssep, ns, fns));
 	}
-	list_append(slist, stmt_export(sql->sa, s, tsep, rsep, ssep, ns, fns));
 	if (s->type == st_list && ((stmt*)s->op4.lval->h->data)->nrcols != 0) {
 		stmt *cnt = stmt_aggr(sql->sa, s->op4.lval->h->data, NULL, NULL, sql_bind_aggr(sql->sa, sql->session->schema, "count", NULL), 1, 0);
 		list_append(slist, stmt_affected_rows(sql->sa, cnt));
@@ -4507,7 +4515,7 @@ rel2bin_ddl(mvc *sql, sql_rel *rel, list *refs)
 {
 	stmt *s = NULL;
 
-	if (rel->flag == DDL_OUTPUT) {
+	if (rel->flag == DDL_OUTPUT || rel->flag == DDL_BINOUTPUT) {
 		s = rel2bin_output(sql, rel, refs);
 		sql->type = Q_TABLE;
 	} else if (rel->flag <= DDL_LIST) {
@@ -36,6 +36,10 @@
 #include "clients.h"
 #include "mal_instruction.h"
 #include "mal_resource.h"
+#include "mutils.h"		/* MONETDB_MODE */
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
 
 static int
 rel_is_table(sql_rel *rel)
@@ -158,6 +162,7 @@ sqlcleanup(mvc *c, int err)
 		/* here we should commit the transaction */
 		if (!err) {
 			sql_trans_commit(c->session->tr);
+			(void) store_sync(store_commit_nr());
 			/* write changes to disk */
 			sql_trans_end(c->session);
 			store_apply_deltas();
@@ -1846,7 +1851,7 @@ mvc_bind_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 			int nr_parts = *getArgReference_int(stk, pci, 7 + upd);
 
 			if (*access == 0) {
-				psz = cnt ? (cnt / nr_parts) : 0;
+				psz = PARTSIZE(cnt, nr_parts);
 				bn = BATslice(b, part_nr * psz, (part_nr + 1 == nr_parts) ? cnt : ((part_nr + 1) * psz));
 				BATseqbase(bn, part_nr * psz);
 			} else {
@@ -1857,7 +1862,7 @@ mvc_bind_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 					throw(SQL,"sql.bind","Cannot access the update column");
 
 				cnt = BATcount(c);
-				psz = cnt ? (cnt / nr_parts) : 0;
+				psz = PARTSIZE(cnt, nr_parts);
 				l = part_nr * psz;
 				h = (part_nr + 1 == nr_parts) ? cnt : ((part_nr + 1) * psz);
 				h--;
@@ -1944,7 +1949,7 @@ mvc_bind_idxbat_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 			int nr_parts = *getArgReference_int(stk, pci, 7 + upd);
 
 			if (*access == 0) {
-				psz = cnt ? (cnt / nr_parts) : 0;
+				psz = PARTSIZE(cnt, nr_parts);
 				bn = BATslice(b, part_nr * psz, (part_nr + 1 == nr_parts) ? cnt : ((part_nr + 1) * psz));
 				BATseqbase(bn, part_nr * psz);
 			} else {
@@ -1954,7 +1959,7 @@ mvc_bind_idxbat_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 				if ( c == NULL)
 					throw(SQL,"sql.bindidx","can not access index column");
 				cnt = BATcount(c);
-				psz = cnt ? (cnt / nr_parts) : 0;
+				psz = PARTSIZE(cnt, nr_parts);
 				l = part_nr * psz;
 				h = (part_nr + 1 == nr_parts) ? cnt : ((part_nr + 1) * psz);
 				h--;
@@ -2651,7 +2656,7 @@ SQLtid(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 		int part_nr = *getArgReference_int(stk, pci, 4);
 		int nr_parts = *getArgReference_int(stk, pci, 5);
 
-		nr /= nr_parts;
+		nr = PARTSIZE(nr, nr_parts);
 		sb = (oid) (part_nr * nr);
 		if (nr_parts == (part_nr + 1)) {	/* last part gets the inserts */
 			nr = cnt - (part_nr * nr);	/* keep rest */
@@ -2675,9 +2680,11 @@ SQLtid(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 		if( d == NULL)
 			throw(SQL,"sql.tid","Can not bind delete column");
 
-		diff = BATdiff(tids, d, NULL, NULL, 0, BUN_NONE);
+		diff = BATrangediff(sb, (BUN) nr, d);
 		BBPunfix(d->batCacheid);
 		BBPunfix(tids->batCacheid);
+		if (diff == NULL)
+			throw(SQL, "sql.tid", MAL_MALLOC_FAIL);
 		BATseqbase(diff, sb);
 		tids = diff;
 	}
@@ -3522,11 +3529,71 @@ mvc_import_table_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 	return msg;
 }
 
+/*
+ * A binary string column file starts with BINSTR_MAGIC, followed by the
+ * number of strings as a lng, that many lng offsets into the data area,
+ * and the data area holding zero terminated UTF-8 strings. A negative
+ * offset denotes nil. The file is mapped and the strings are appended
+ * straight into the string heap, without any parsing.
+ */
+#define BINSTR_MAGIC	"MBSTR001"
+#define BINSTR_HEADER	(sizeof(BINSTR_MAGIC) - 1 + sizeof(lng))
+
+static str
+mvc_bin_import_str(BAT *c, const char *fname, size_t size)
+{
+	char *base, *data;
+	const lng *off;
+	lng cnt, i;
+	size_t dlen;
+	str msg = MAL_SUCCEED;
+
+	if ((base = MT_mmap(fname, MMAP_READ | MMAP_SEQUENTIAL, size)) == NULL)
+		throw(SQL, "sql", "Failed to map file %s", fname);
+	memcpy(&cnt, base + sizeof(BINSTR_MAGIC) - 1, sizeof(lng));
+	if (cnt < 0 || (size_t) cnt > (size - BINSTR_HEADER) / sizeof(lng) ||
+		(dlen = size - BINSTR_HEADER - (size_t) cnt * sizeof(lng), dlen > 0 && base[size - 1] != 0)) {
+		MT_munmap(base, size);
+		throw(SQL, "sql", "Malformed binary string file %s", fname);
+	}
+	off = (const lng *) (base + BINSTR_HEADER);
+	data = base + BINSTR_HEADER + (size_t) cnt * sizeof(lng);
+	if (BATextend(c, (BUN) cnt) != GDK_SUCCEED) {
+		MT_munmap(base, size);
+		throw(SQL, "sql", MAL_MALLOC_FAIL);
+	}
+	for (i = 0; i < cnt; i++) {
+		const char *v;
+
+		if (off[i] < 0) {
+			v = str_nil;
+			c->T->nonil = 0;
+		} else if ((size_t) off[i] < dlen) {
+			v = data + off[i];
+		} else {
+			msg = createException(SQL, "sql", "Malformed binary string file %s", fname);
+			break;
+		}
+		bunfastapp(c, v);
+	}
+	MT_munmap(base, size);
+	if (cnt > 1) {
+		c->tsorted = 0;
+		c->trevsorted = 0;
+		c->tkey = 0;
+	}
+	return msg;
+  bunins_failed:
+	MT_munmap(base, size);
+	throw(SQL, "sql", MAL_MALLOC_FAIL);
+}
+
 /* str mvc_bin_import_table_wrap(.., str *sname, str *tname, str *fname..);
  * binary attachment only works for simple binary types.
  * Non-simple types require each line to contain a valid ascii representation
  * of the text terminate by a new-line. These strings are passed to the corresponding
  * atom conversion routines to fill the column.
+ * String columns may instead be given in the binary layout described above.
  */
 str
 mvc_bin_import_table_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
@@ -3592,6 +3659,9 @@ mvc_bin_import_table_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pc
 			BATsetaccess(c, BAT_READ);
 			BATderiveProps(c, 0);
 		} else if (tpe == TYPE_str) {
+			char magic[sizeof(BINSTR_MAGIC) - 1];
+			struct stat st;
+
 			/* get the BAT and fill it with the strings */
 			c = BATnew(TYPE_void, TYPE_str, 0, PERSISTENT);
 			if (c == NULL)
@@ -3599,8 +3669,22 @@ mvc_bin_import_table_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pc
 			BATseqbase(c, 0);
 			/* this code should be extended to deal with larger text strings. */
 			f = fopen(*getArgReference_str(stk, pci, i), "r");
-			if (f == NULL)
+			if (f == NULL) {
+				BBPreclaim(c);
 				throw(SQL, "sql", "Failed to re-open file %s", *getArgReference_str(stk, pci, i));
+			}
+			if (fread(magic, 1, sizeof(magic), f) == sizeof(magic) &&
+				memcmp(magic, BINSTR_MAGIC, sizeof(magic)) == 0 &&
+				fstat(fileno(f), &st) == 0 && (size_t) st.st_size >= BINSTR_HEADER) {
+				fclose(f);
+				msg = mvc_bin_import_str(c, *getArgReference_str(stk, pci, i), (size_t) st.st_size);
+				if (msg != MAL_SUCCEED) {
+					BBPreclaim(c);
+					return msg;
+				}
+				goto attached;
+			}
+			rewind(f);
 
 			buf = GDKmalloc(bufsiz);
 			if (!buf) {
@@ -3618,6 +3702,7 @@ mvc_bin_import_table_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pc
 		} else {
 			throw(SQL, "sql", "Failed to attach file %s", *getArgReference_str(stk, pci, i));
 		}
+	  attached:
 		if (i != (pci->retc + 2) && cnt != BATcount(c))
 			throw(SQL, "sql", "binary files for table '%s' have inconsistent counts", tname);
 		cnt = BATcount(c);
@@ -3627,6 +3712,232 @@ mvc_bin_import_table_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pc
 	return MAL_SUCCEED;
 }
 
+/*
+ * COPY query INTO BINARY ('f1', ...) is the reverse of the binary
+ * import: every result column goes into its own file, in the layout
+ * importTable attaches or maps without parsing. Fixed width columns are
+ * dumped as their raw tail, strings use the BINSTR layout. The columns
+ * are independent, hence written by a few threads concurrently. Files
+ * are only ever created, never overwritten, and on failure the ones
+ * this export created are removed again.
+ */
+typedef struct {
+	MT_Id tid;
+	BAT **cols;
+	const char **files;
+	bit *created;
+	int nr, first, step;
+	int started;
+	str msg;
+} BinExport;
+
+static str
+mvc_export_bin_str(BAT *b, FILE *f, const char *fname)
+{
+	BATiter bi = bat_iterator(b);
+	BUN p, q, cnt = BATcount(b);
+	lng *off, pos = 0, n = (lng) cnt;
+	size_t i = 0;
+
+	if ((off = GDKmalloc(sizeof(lng) * (cnt ? cnt : 1))) == NULL)
+		throw(SQL, "sql.export_bin", MAL_MALLOC_FAIL);
+	BATloop(b, p, q) {
+		const char *v = BUNtail(bi, p);
+
+		if (strcmp(v, str_nil) == 0) {
+			off[i++] = -1;
+		} else {
+			off[i++] = pos;
+			pos += (lng) strlen(v) + 1;
+		}
+	}
+	if (fwrite(BINSTR_MAGIC, 1, sizeof(BINSTR_MAGIC) - 1, f) != sizeof(BINSTR_MAGIC) - 1 ||
+		fwrite(&n, sizeof(lng), 1, f) != 1 ||
+		fwrite(off, sizeof(lng), cnt, f) != cnt) {
+		GDKfree(off);
+		throw(SQL, "sql.export_bin", "Failed to write file %s", fname);
+	}
+	i = 0;
+	BATloop(b, p, q) {
+		const char *v = BUNtail(bi, p);
+
+		if (off[i++] >= 0 && fwrite(v, 1, strlen(v) + 1, f) != strlen(v) + 1) {
+			GDKfree(off);
+			throw(SQL, "sql.export_bin", "Failed to write file %s", fname);
+		}
+	}
+	GDKfree(off);
+	return MAL_SUCCEED;
+}
+
+static str
+mvc_export_bin_col(BAT *b, const char *fname, bit *created)
+{
+	FILE *f;
+	str msg = MAL_SUCCEED;
+	BUN cnt = BATcount(b);
+	int fd, flags = O_WRONLY | O_CREAT | O_EXCL;
+
+#ifdef O_BINARY
+	flags |= O_BINARY;
+#endif
+	/* the file is created here, an existing one is never replaced */
+	if ((fd = open(fname, flags, MONETDB_MODE)) < 0) {
+		if (errno == EEXIST)
+			throw(SQL, "sql.export_bin", "File already exists: %s", fname);
+		throw(SQL, "sql.export_bin", "Failed to open file %s", fname);
+	}
+	*created = 1;
+	if ((f = fdopen(fd, "wb")) == NULL) {
+		close(fd);
+		throw(SQL, "sql.export_bin", "Failed to open file %s", fname);
+	}
+	if (ATOMstorage(b->ttype) == TYPE_str) {
+		msg = mvc_export_bin_str(b, f, fname);
+	} else if (b->ttype == TYPE_void) {
+		oid o = b->tseqbase, buf[1024];
+		BUN i, j;
+
+		for (i = 0; i < cnt && msg == MAL_SUCCEED; i += j) {
+			for (j = 0; j < 1024 && i + j < cnt; j++)
+				buf[j] = o == oid_nil ? oid_nil : o + i + j;
+			if (fwrite(buf, sizeof(oid), j, f) != j)
+				msg = createException(SQL, "sql.export_bin", "Failed to write file %s", fname);
+		}
+	} else if (cnt && fwrite(Tloc(b, BUNfirst(b)), Tsize(b), cnt, f) != cnt) {
+		msg = createException(SQL, "sql.export_bin", "Failed to write file %s", fname);
+	}
+	if (fclose(f) != 0 && msg == MAL_SUCCEED)
+		msg = createException(SQL, "sql.export_bin", "Failed to write file %s", fname);
+	return msg;
+}
+
+static void
+mvc_export_bin_worker(void *arg)
+{
+	BinExport *w = arg;
+	int i;
+
+	for (i = w->first; i < w->nr && w->msg == MAL_SUCCEED; i += w->step)
+		w->msg = mvc_export_bin_col(w->cols[i], w->files[i], &w->created[i]);
+}
+
+/* the helper threads need their own thread and error buffer, the
+ * column writers may end up in GDKerror and createException */
+static void
+mvc_export_bin_thread(void *arg)
+{
+	Thread thr;
+
+	thr = THRnew("SQLexporter");
+	GDKsetbuf(GDKzalloc(GDKMAXERRLEN));
+	mvc_export_bin_worker(arg);
+	GDKfree(GDKerrbuf);
+	GDKsetbuf(0);
+	if (thr)
+		THRdel(thr);
+}
+
+/* lng sql.export_bin(files:bat[:str], cols:bat[:any]...) */
+str
+mvc_export_bin_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
+{
+	lng *res = getArgReference_lng(stk, pci, 0);
+	bat fid = *getArgReference_bat(stk, pci, 1);
+	int nr = pci->argc - 2, i, workers;
+	BAT *fb, **cols;
+	const char **files;
+	bit *created;
+	BinExport *w;
+	BATiter fi;
+	str msg = MAL_SUCCEED;
+
+	(void) cntxt;
+	(void) mb;
+	if ((fb = BATdescriptor(fid)) == NULL)
+		throw(SQL, "sql.export_bin", "Cannot access descriptor");
+	if (BATcount(fb) != (BUN) nr) {
+		BBPunfix(fb->batCacheid);
+		throw(SQL, "sql.export_bin", "Need one file per column");
+	}
+	cols = GDKzalloc(sizeof(BAT *) * nr);
+	files = GDKzalloc(sizeof(char *) * nr);
+	created = GDKzalloc(sizeof(bit) * nr);
+	if (cols == NULL || files == NULL || created == NULL) {
+		msg = createException(SQL, "sql.export_bin", MAL_MALLOC_FAIL);
+		goto bailout;
+	}
+	fi = bat_iterator(fb);
+	for (i = 0; i < nr; i++) {
+		int tpe;
+
+		files[i] = BUNtail(fi, BUNfirst(fb) + i);
+		if ((cols[i] = BATdescriptor(*getArgReference_bat(stk, pci, i + 2))) == NULL) {
+			msg = createException(SQL, "sql.export_bin", "Cannot access descriptor");
+			goto bailout;
+		}
+		if (i && BATcount(cols[i]) != BATcount(cols[0])) {
+			msg = createException(SQL, "sql.export_bin", "Columns have inconsistent counts");
+			goto bailout;
+		}
+		tpe = ATOMstorage(cols[i]->ttype);
+		if (tpe != TYPE_str && ATOMvarsized(tpe)) {
+			msg = createException(SQL, "sql.export_bin", "Type %s cannot be exported in binary", ATOMname(cols[i]->ttype));
+			goto bailout;
+		}
+	}
+
+	workers = nr < GDKnr_threads ? nr : GDKnr_threads;
+	if (workers < 1)
+		workers = 1;
+	if ((w = GDKzalloc(sizeof(BinExport) * workers)) == NULL) {
+		msg = createException(SQL, "sql.export_bin", MAL_MALLOC_FAIL);
+		goto bailout;
+	}
+	for (i = 0; i < workers; i++) {
+		w[i].cols = cols;
+		w[i].files = files;
+		w[i].created = created;
+		w[i].nr = nr;
+		w[i].first = i;
+		w[i].step = workers;
+		if (i > 0)
+			w[i].started = MT_create_thread(&w[i].tid, mvc_export_bin_thread, &w[i], MT_THR_JOINABLE) == 0;
+	}
+	mvc_export_bin_worker(&w[0]);
+	for (i = 1; i < workers; i++) {
+		if (w[i].started)
+			MT_join_thread(w[i].tid);
+		else
+			mvc_export_bin_worker(&w[i]);
+		if (msg == MAL_SUCCEED)
+			msg = w[i].msg;
+		else if (w[i].msg)
+			GDKfree(w[i].msg);
+	}
+	if (msg == MAL_SUCCEED)
+		msg = w[0].msg;
+	else if (w[0].msg)
+		GDKfree(w[0].msg);
+	GDKfree(w);
+	*res = nr ? (lng) BATcount(cols[0]) : 0;
+
+  bailout:
+	if (msg != MAL_SUCCEED && created)
+		for (i = 0; i < nr; i++)
+			if (created[i])
+				(void) unlink(files[i]);
+	if (cols)
+		for (i = 0; i < nr; i++)
+			if (cols[i])
+				BBPunfix(cols[i]->batCacheid);
+	GDKfree(cols);
+	GDKfree(files);
+	GDKfree(created);
+	BBPunfix(fb->batCacheid);
+	return msg;
+}
+
 str
 zero_or_one(ptr ret, const bat *bid)
 {
@@ -4526,7 +4837,49 @@ SQLargRecord(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 /*
  * Vacuum cleaning tables
  * Shrinking and re-using space to vacuum clean the holes in the relations.
+ * Each column and index bat is first brought up to date with its pending
+ * inserts and updates, the reorganised bats then replace the table
+ * contents within the (auto commit) transaction.  Variable sized columns
+ * are rebuilt value by value, which drops the dead values from their heaps,
+ * and hashes and imprints are recreated on the new bats when next used.
  */
+static str
+vacuum_bat(sql_trans *tr, sql_column *c, sql_idx *i, bat del, bat *bid, str (*func) (bat *, const bat *, const bat *))
+{
+	BAT *b, *ins, *ui, *uv;
+	bat cur;
+	str msg;
+
+	if (c) {
+		b = store_funcs.bind_col(tr, c, RDONLY);
+		ins = store_funcs.bind_col(tr, c, RD_INS);
+		ui = store_funcs.bind_col(tr, c, RD_UPD_ID);
+		uv = store_funcs.bind_col(tr, c, RD_UPD_VAL);
+	} else {
+		b = store_funcs.bind_idx(tr, i, RDONLY);
+		ins = store_funcs.bind_idx(tr, i, RD_INS);
+		ui = store_funcs.bind_idx(tr, i, RD_UPD_ID);
+		uv = store_funcs.bind_idx(tr, i, RD_UPD_VAL);
+	}
+	if (b == NULL || ins == NULL || ui == NULL || uv == NULL)
+		msg = createException(SQL, "sql.vacuum", "Can not access descriptor");
+	else
+		msg = DELTAbat(&cur, &b->batCacheid, &ui->batCacheid, &uv->batCacheid, &ins->batCacheid);
+	if (b)
+		BBPunfix(b->batCacheid);
+	if (ins)
+		BBPunfix(ins->batCacheid);
+	if (ui)
+		BBPunfix(ui->batCacheid);
+	if (uv)
+		BBPunfix(uv->batCacheid);
+	if (msg)
+		return msg;
+	msg = (*func) (bid, &cur, &del);
+	BBPdecref(cur, TRUE);
+	return msg;
+}
+
 static str
 vacuum(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci, str (*func) (bat *, const bat *, const bat *), const char *name)
 {
@@ -4535,13 +4888,11 @@ vacuum(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci, str (*func) (bat
 	sql_trans *tr;
 	sql_schema *s;
 	sql_table *t;
-	sql_column *c;
 	mvc *m = NULL;
-	str msg;
-	bat bid;
-	BAT *b, *del;
+	str msg = MAL_SUCCEED;
+	BAT *del;
 	node *o;
-	int i, bids[2049];
+	int i, n, bids[2048];
 
 	if ((msg = getSQLContext(cntxt, mb, &m, NULL)) != NULL)
 		return msg;
@@ -4556,63 +4907,80 @@ vacuum(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci, str (*func) (bat
 
 	if (m->user_id != USER_MONETDB)
 		throw(SQL, name, "42000!insufficient privileges");
-	if ((!list_empty(t->idxs.set) || !list_empty(t->keys.set)))
-		throw(SQL, name, "%s not allowed on tables with indices", name + 4);
+	/* foreign keys refer to the rows of this table by oid */
+	for (o = t->keys.set ? t->keys.set->h : NULL; o; o = o->next) {
+		sql_key *k = o->data;
+
+		if ((k->type == ukey || k->type == pkey) && !list_empty(((sql_ukey *) k)->keys))
+			throw(SQL, name, "%s not allowed on tables referenced by foreign keys", name + 4);
+	}
 	if (has_snapshots(m->session->tr))
 		throw(SQL, name, "%s not allowed on snapshots", name + 4);
-	if (!m->session->auto_commit)
-		throw(SQL, name, "%s only allowed in auto commit mode", name + 4);
+	/* embedded statements never run in auto commit mode, so just
+	 * make sure the table is rewritten by a transaction of its own */
+	if (!m->session->auto_commit && m->session->tr->wtime)
+		throw(SQL, name, "%s not allowed after other changes in the transaction", name + 4);
 
 	tr = m->session->tr;
 
 	/* get the deletions BAT */
 	del = mvc_bind_dbat(m, *sch, *tbl, RD_INS);
+	if (del == NULL)
+		throw(SQL, name, "Can not access deletion column");
 	if (BATcount(del) == 0) {
 		BBPunfix(del->batCacheid);
 		return MAL_SUCCEED;
 	}
 
-
 	i = 0;
-	bids[i] = 0;
-	for (o = t->columns.set->h; o; o = o->next, i++) {
-		c = o->data;
-		b = store_funcs.bind_col(tr, c, RDONLY);
-		if (b == NULL || (msg = (*func) (&bid, &b->batCacheid, &del->batCacheid)) != NULL) {
-			for (i--; i >= 0; i--)
-				BBPdecref(bids[i], TRUE);
-			if (b)
-				BBPunfix(b->batCacheid);
-			BBPunfix(del->batCacheid);
-			if (!msg)
-				throw(SQL, name, "Can not access descriptor");
-			return msg;
-		}
-		BBPunfix(b->batCacheid);
-		if (i < 2048) {
-			bids[i] = bid;
-			bids[i + 1] = 0;
-		}
+	for (o = t->columns.set->h; o && !msg; o = o->next) {
+		if (i == 2048)
+			msg = createException(SQL, name, "Too many columns to handle, use copy instead");
+		else if ((msg = vacuum_bat(tr, o->data, NULL, del->batCacheid, &bids[i], func)) == MAL_SUCCEED)
+			i++;
+	}
+	for (o = t->idxs.set ? t->idxs.set->h : NULL; o && !msg; o = o->next) {
+		sql_idx *x = o->data;
+
+		/* single column hashes are not stored */
+		if (!idx_has_column(x->type) || (hash_index(x->type) && list_length(x->columns) <= 1))
+			continue;
+		if (i == 2048)
+			msg = createException(SQL, name, "Too many columns to handle, use copy instead");
+		else if ((msg = vacuum_bat(tr, NULL, x, del->batCacheid, &bids[i], func)) == MAL_SUCCEED)
+			i++;
 	}
-	if (i >= 2048) {
+	BBPunfix(del->batCacheid);
+	if (msg) {
 		for (i--; i >= 0; i--)
 			BBPdecref(bids[i], TRUE);
-		throw(SQL, name, "Too many columns to handle, use copy instead");
+		return msg;
 	}
-	BBPunfix(del->batCacheid);
+	n = i;
 
 	mvc_clear_table(m, t);
-	for (o = t->columns.set->h, i = 0; o; o = o->next, i++) {
-		sql_column *c = o->data;
+	i = 0;
+	for (o = t->columns.set->h; o; o = o->next, i++) {
 		BAT *ins = BATdescriptor(bids[i]);	/* use the insert bat */
 
-		if( ins){
-			store_funcs.append_col(tr, c, ins, TYPE_bat);
+		if (ins) {
+			store_funcs.append_col(tr, o->data, ins, TYPE_bat);
 			BBPunfix(ins->batCacheid);
 		}
-		BBPdecref(bids[i], TRUE);
 	}
-	/* TODO indices */
+	for (o = t->idxs.set ? t->idxs.set->h : NULL; o && i < n; o = o->next) {
+		sql_idx *x = o->data;
+		BAT *ins;
+
+		if (!idx_has_column(x->type) || (hash_index(x->type) && list_length(x->columns) <= 1))
+			continue;
+		if ((ins = BATdescriptor(bids[i++])) != NULL) {
+			store_funcs.append_idx(tr, x, ins, TYPE_bat);
+			BBPunfix(ins->batCacheid);
+		}
+	}
+	for (i = 0; i < n; i++)
+		BBPdecref(bids[i], TRUE);
 	return MAL_SUCCEED;
 }
 
@@ -4662,8 +5030,6 @@ SQLvacuum(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 
 	if (m->user_id != USER_MONETDB)
 		throw(SQL, "sql.vacuum", "42000!insufficient privileges");
-	if ((!list_empty(t->idxs.set) || !list_empty(t->keys.set)))
-		throw(SQL, "sql.vacuum", "vacuum not allowed on tables with indices");
 	if (has_snapshots(m->session->tr))
 		throw(SQL, "sql.vacuum", "vacuum not allowed on snapshots");
 
@@ -4688,13 +5054,13 @@ SQLvacuum(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 		/* now decide on the algorithm */
 		if (ordered) {
 			if (BATcount(del) > cnt / 20)
-				SQLshrink(cntxt, mb, stk, pci);
+				msg = SQLshrink(cntxt, mb, stk, pci);
 		} else {
-			SQLreuse(cntxt, mb, stk, pci);
+			msg = SQLreuse(cntxt, mb, stk, pci);
 		}
 	}
 	BBPunfix(del->batCacheid);
-	return MAL_SUCCEED;
+	return msg;
 }
 
 /*
@@ -54,6 +54,13 @@
 #include <bat/bat_storage.h>
 #include <bat/bat_utils.h>
 
+/* Rows per mitosis piece of a table with cnt rows; the last piece
+ * gets the remainder.  Pieces start at a multiple of 64 rows, so they
+ * do not share the cache lines the imprints of the column are built
+ * on. */
+#define PARTSIZE(cnt, nr_parts)						\
+	((cnt) / (nr_parts) >= 64 ? (cnt) / (nr_parts) / 64 * 64 : (cnt) / (nr_parts))
+
 #if SIZEOF_WRD == SIZEOF_INT
 #define wrdToStr(sptr, lptr, p) intToStr(sptr, lptr, (int*)p)
 #else
@@ -114,6 +121,7 @@ sql5_export str mvc_row_result_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, I
 sql5_export str mvc_export_row_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci);
 sql5_export str mvc_import_table_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci);
 sql5_export str mvc_bin_import_table_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci);
+sql5_export str mvc_export_bin_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci);
 sql5_export str setVariable(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci);
 sql5_export str getVariable(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci);
 sql5_export str sql_variables(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci);
@@ -282,6 +282,44 @@ dump_export_header(mvc *sql, MalBlkPtr mb, list *l, int file, str format, str se
 	return ret;
 }
 
+/* sql.export_bin(files, cols...), scalar results are lifted to a
+ * single row bat first */
+static int
+dump_export_bin(MalBlkPtr mb, list *l, list *files)
+{
+	node *n;
+	InstrPtr q, p = NULL, list;
+	int fileId, k;
+
+	list = newInstruction(mb,ASSIGNsymbol);
+	getArg(list,0) = newTmpVariable(mb,TYPE_lng);
+	setModuleId(list, sqlRef);
+	setFunctionId(list, export_binRef);
+	k = list->argc;
+	meta(fileId,TYPE_str);
+	for (n = files->h; n; n = n->next) {
+		metaInfo(fileId,Str,n->data);
+		if (p == NULL)
+			return -1;
+	}
+	for (n = l->h; n; n = n->next) {
+		stmt *c = n->data;
+		int nr = c->nr;
+
+		if (c->nrcols == 0) {
+			q = newStmt(mb, sqlRef, singleRef);
+			q = pushArgument(mb, q, nr);
+			if (q == NULL)
+				return -1;
+			nr = getArg(q, 0);
+		}
+		list = pushArgument(mb,list,nr);
+	}
+	getArg(list,k) = fileId;
+	pushInstruction(mb,list);
+	return getArg(list,0);
+}
+
 static int
 dump_table(MalBlkPtr mb, sql_table *t)
 {
@@ -2555,6 +2593,11 @@ _dumpstmt(backend *sql, MalBlkPtr mb, stmt *s)
 				list *l = lst->op4.lval;
 				int file = -1 ;
 
+				if (s->flag) {
+					if ((s->nr = dump_export_bin(mb, l, s->op4.lval)) < 0)
+						return -1;
+					break;
+				}
 				n = s->op4.lval->h;
 				sep = n->data;
 				rsep = n->next->data;
@@ -842,6 +842,7 @@ mvc_import_table(Client cntxt, BAT ***bats, mvc *m, bstream *bs, sql_table *t, c
 				fmt[i].tostr = &dec_tostr;
 				fmt[i].frstr = &sec_frstr;
 			}
+			fmt[i].inplace = fmt[i].frstr == &_ASCIIadt_frStr;
 			fmt[i].size = ATOMsize(fmt[i].adt);
 
 			if (locked) {
@@ -1313,6 +1314,47 @@ mvc_export_row(backend *b, stream *s, res_table *t, str btag, str sep, str rsep,
 	return (ok) ? 0 : -1;
 }
 
+/* estimated printed width of a column, used by the tablet output to
+ * pre-size its line buffers; 0 means unknown */
+static unsigned int
+export_width(BAT *b, int eclass)
+{
+	size_t w = 0;
+
+	switch (ATOMstorage(b->ttype)) {
+	case TYPE_bte:
+		w = bat_max_btelength(b);
+		break;
+	case TYPE_sht:
+		w = bat_max_shtlength(b);
+		break;
+	case TYPE_int:
+		w = bat_max_intlength(b);
+		break;
+	case TYPE_lng:
+		w = bat_max_lnglength(b);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		w = bat_max_hgelength(b);
+		break;
+#endif
+	case TYPE_str:
+		/* the average rather than the maximum, a single long
+		 * string should not blow up all buffers */
+		if (BATcount(b) && b->T->vheap)
+			w = b->T->vheap->free / BATcount(b) + 2;
+		return (unsigned int) w;
+	default:
+		break;
+	}
+	if (eclass == EC_TIME || eclass == EC_TIMESTAMP || eclass == EC_DATE)
+		return 32;
+	if (w && (eclass == EC_DEC || eclass == EC_SEC))
+		w += 2;			/* '0.' */
+	return (unsigned int) w;
+}
+
 static int
 mvc_export_table(backend *b, stream *s, res_table *t, BAT *order, BUN offset, BUN nr, char *btag, char *sep, char *rsep, char *ssep, char *ns)
 {
@@ -1425,6 +1467,7 @@ mvc_export_table(backend *b, stream *s, res_table *t, BAT *order, BUN offset, BU
 		} else {
 			fmt[i].extra = fmt + i;
 		}
+		fmt[i].maxwidth = export_width(fmt[i].c, c->type.type->eclass);
 	}
 	if (i == t->nr_cols + 1) {
 		TABLEToutput_file(&as, order, s);
@@ -1442,6 +1485,116 @@ mvc_export_table(backend *b, stream *s, res_table *t, BAT *order, BUN offset, BU
 	return 0;
 }
 
+/* Binary columnar results, for clients that asked for them at login
+ * (see MSscheduleClient).  After the usual header lines an int
+ * 0x01020304 in the server's byte order follows, and then each column
+ * of rows [offset, offset + nr) as
+ *	bte kind	'i' integer, 'f' floating point, 'b' boolean,
+ *			's' nul-terminated strings
+ *	bte width	bytes per value, 0 for strings
+ *	lng length	number of bytes that follow
+ * Integers, floating point numbers and booleans are copied straight
+ * from the BAT, nil included.  All other types are sent in their text
+ * form, with str_nil for nil. */
+static int
+mvc_export_table_columnar(backend *b, stream *s, res_table *t, BUN offset, BUN nr)
+{
+	mvc *m = b->mvc;
+	int i, len = BUFSIZ, res = 0;
+	size_t size = BUFSIZ, pos;
+	char *buf = GDKmalloc(len), *data = GDKmalloc(size);
+
+	if (buf == NULL || data == NULL || !mnstr_writeInt(s, 0x01020304))
+		res = -1;
+	for (i = 0; res == 0 && i < t->nr_cols; i++) {
+		res_col *c = t->cols + i;
+		int eclass = c->type.type->eclass;
+		int has_tz = type_has_tz(&c->type);
+		BAT *bn = BATdescriptor(c->b);
+		BATiter bi;
+		bte kind = 's', width = 0;
+		BUN p, q;
+
+		if (bn == NULL) {
+			res = -1;
+			break;
+		}
+		p = BUNfirst(bn) + offset;
+		q = p + nr;
+		if (bn->ttype != TYPE_void && ATOMvarsized(bn->ttype) == 0) {
+			switch (ATOMstorage(bn->ttype)) {
+			case TYPE_bte:
+			case TYPE_sht:
+			case TYPE_int:
+			case TYPE_lng:
+				if (eclass == EC_NUM || eclass == EC_MONTH)
+					kind = 'i';
+				else if (eclass == EC_BIT)
+					kind = 'b';
+				break;
+			case TYPE_flt:
+			case TYPE_dbl:
+				if (eclass == EC_FLT)
+					kind = 'f';
+				break;
+			}
+		}
+		if (kind != 's') {
+			width = (bte) Tsize(bn);
+			if (!mnstr_writeBte(s, kind) ||
+			    !mnstr_writeBte(s, width) ||
+			    !mnstr_writeLng(s, (lng) (nr * width)) ||
+			    (nr > 0 && mnstr_write(s, Tloc(bn, p), width, nr) != (ssize_t) nr))
+				res = -1;
+			BBPunfix(bn->batCacheid);
+			continue;
+		}
+		bi = bat_iterator(bn);
+		for (pos = 0; p < q; p++) {
+			const char *v;
+			size_t l;
+
+			if (ATOMstorage(bn->ttype) == TYPE_str) {
+				v = BUNtail(bi, p);
+			} else {
+				if (convert2str(m, eclass, c->type.digits, c->type.scale, has_tz, BUNtail(bi, p), bn->ttype, &buf, len) < 0) {
+					res = -1;
+					break;
+				}
+				v = buf;
+			}
+			l = strlen(v) + 1;
+			if (pos + l > size) {
+				char *ndata;
+
+				while (pos + l > size)
+					size *= 2;
+				if ((ndata = GDKrealloc(data, size)) == NULL) {
+					res = -1;
+					break;
+				}
+				data = ndata;
+			}
+			memcpy(data + pos, v, l);
+			pos += l;
+		}
+		BBPunfix(bn->batCacheid);
+		if (res == 0 &&
+		    (!mnstr_writeBte(s, kind) ||
+		     !mnstr_writeBte(s, width) ||
+		     !mnstr_writeLng(s, (lng) pos) ||
+		     (pos > 0 && mnstr_write(s, data, pos, 1) != 1)))
+			res = -1;
+	}
+	if (buf)
+		GDKfree(buf);
+	if (data)
+		GDKfree(data);
+	if (res == 0 && mnstr_errnr(s))
+		res = -1;
+	return res;
+}
+
 static int
 export_length(stream *s, int mtype, int eclass, int digits, int scale, int tz, bat bid, ptr p)
 {
@@ -1909,6 +2062,8 @@ mvc_export_result(backend *b, stream *s, int res_id)
 			res = mvc_export_table(b, s, t, order, 1, count - 2, "\t{\n\t\t\"%s\" : ", ",\n\t\t\"%s\" : ", "\n\t},\n", "\"", "null");
 			res = mvc_export_table(b, s, t, order, count - 1, 1, "\t{\n\t\t\"%s\" : ", ",\n\t\t\"%s\" : ", "\n\t}\n]\n", "\"", "null");
 		}
+	} else if (b->client && b->client->columnar) {
+		res = mvc_export_table_columnar(b, s, t, 0, count);
 	} else {
 		res = mvc_export_table(b, s, t, order, 0, count, "[ ", ",\t", "\t]\n", "\"", "NULL");
 	}
@@ -1968,7 +2123,10 @@ mvc_export_chunk(backend *b, stream *s, int res_id, BUN offset, BUN nr)
 	if (mnstr_write(s, "\n", 1, 1) != 1)
 		return export_error(order);
 
-	res = mvc_export_table(b, s, t, order, offset, cnt, "[ ", ",\t", "\t]\n", "\"", "NULL");
+	if (b->client && b->client->columnar)
+		res = mvc_export_table_columnar(b, s, t, offset, cnt);
+	else
+		res = mvc_export_table(b, s, t, order, offset, cnt, "[ ", ",\t", "\t]\n", "\"", "NULL");
 	BBPunfix(order->batCacheid);
 	return res;
 }
@@ -958,6 +958,18 @@ stmt_export(sql_allocator *sa, stmt *t, const char *sep, const char *rsep, const
 	return s;
 }
 
+/* binary export, one file per column of t */
+stmt *
+stmt_export_bin(sql_allocator *sa, stmt *t, list *files)
+{
+	stmt *s = stmt_create(sa, st_export);
+
+	s->op1 = t;
+	s->op4.lval = files;
+	s->flag = 1;
+	return s;
+}
+
 stmt *
 stmt_trans(sql_allocator *sa, int type, stmt *chain, stmt *name)
 {
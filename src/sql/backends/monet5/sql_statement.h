@@ -156,6 +156,7 @@ extern stmt *stmt_delete(sql_allocator *sa, sql_table *t, stmt *b);
 extern stmt *stmt_append(sql_allocator *sa, stmt *c, stmt *values);
 extern stmt *stmt_table_clear(sql_allocator *sa, sql_table *t);
 extern stmt *stmt_export(sql_allocator *sa, stmt *t, const char *sep, const char *rsep, const char *ssep, const char *null_string, stmt *file);
+extern stmt *stmt_export_bin(sql_allocator *sa, stmt *t, list *files);
 extern stmt *stmt_trans(sql_allocator *sa, int type, stmt *chain, stmt *name);
 extern stmt *stmt_catalog(sql_allocator *sa, int type, stmt *args);
 
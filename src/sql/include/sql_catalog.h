@@ -444,6 +444,7 @@ typedef struct sql_column {
 	char *storage_type;
 	int sorted;		/* for DECLARED (dupped tables) we keep order info */
 	size_t dcount;
+	size_t dcount_cnt;	/* row count when dcount was determined */
 	char *min;
 	char *max;
 
@@ -532,6 +533,7 @@ typedef struct sql_session {
 	char auto_commit;
 	int level;		/* TRANSACTION isolation level */
 	int active;		/* active transaction */
+	int snapshot;		/* active transaction started without the store lock */
 	int status;		/* status, ok/error */
 	backend_stack stk;
 } sql_session;
@@ -88,6 +88,7 @@ typedef struct expression {
 #define DDL_OUTPUT	1
 #define DDL_LIST	2	
 #define DDL_PSM		3	
+#define DDL_BINOUTPUT	4
 
 #define DDL_CREATE_SEQ  5
 #define DDL_ALTER_SEQ   6
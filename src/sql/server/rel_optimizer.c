@@ -764,9 +764,14 @@ order_joins(mvc *sql, list *rels, list *exps)
 		return top;
 	}
 
+	/* order on the estimated sizes, when there are statistics for all
+	 * relations (debug flag 1024 keeps the heuristic order) */
+	if (list_length(rels) > 2 && !mvc_debug_on(sql, 1024))
+		top = rel_join_enum(sql, rels, exps);
+
 	/* open problem, some expressions use more than 2 relations */
 	/* For example a.x = b.y * c.z; */
-	if (list_length(rels) >= 2 && sdje->h) {
+	if (!top && list_length(rels) >= 2 && sdje->h) {
 		/* get the first expression */
 		cje = sdje->h->data;
 
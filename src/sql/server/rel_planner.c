@@ -257,38 +257,69 @@ exp_getatom( mvc *sql, sql_exp *e, atom *m)
 	return m;
 }
 
+static dbl
+atom_getdbl(atom *a)
+{
+	switch (ATOMstorage(a->data.vtype)) {
+	case TYPE_bte:
+		return (dbl) a->data.val.btval;
+	case TYPE_sht:
+		return (dbl) a->data.val.shval;
+	case TYPE_int:
+		return (dbl) a->data.val.ival;
+	case TYPE_lng:
+		return (dbl) a->data.val.lval;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		return (dbl) a->data.val.hval;
+#endif
+	case TYPE_flt:
+		return (dbl) a->data.val.fval;
+	case TYPE_dbl:
+		return a->data.val.dval;
+	default:
+		return dbl_nil;
+	}
+}
+
 static dbl
 exp_getrange_sel( mvc *sql, sql_rel *r, sql_exp *e, void *min, void *max)
 {
 	atom *amin, *amax, *emin, *emax;
-	dbl sel = 1.0;
+	dbl sel = 1.0, lo, hi, dmin, dmax;
 	sql_subtype *t = exp_subtype(e->l);
 
 	(void)r;
 	emin = amin = atom_general(sql->sa, t, min);
 	emax = amax = atom_general(sql->sa, t, max);
 
+	if (!amin || !amax)
+		return 0.1;
+
 	if (e->f || e->flag == cmp_gt || e->flag == cmp_gte) 
 		emin = exp_getatom(sql, e->r, amin);
 	if (e->f || e->flag == cmp_lt || e->flag == cmp_lte) 
 		emax = (e->f)?exp_getatom(sql, e->f, amax):
 			exp_getatom(sql, e->r, amax);
 
-	if (!amin || !amax)
-		return 0.1;
-
-	if (!emin || !emax)
-		sel = 0.125;
-	/* 4 case, dbl and lng, date, timestamp */
-	else if (t->type->eclass == EC_DATE) {
-		sel = (emax->data.val.ival-emin->data.val.ival)/(dbl)(amax->data.val.ival-amin->data.val.ival);
-	} else if (t->type->eclass == EC_TIMESTAMP) {
-		sel = (emax->data.val.lval-emin->data.val.lval)/(dbl)(amax->data.val.lval-amin->data.val.lval);
-	} else if (t->type->eclass == EC_FLT) {
-		sel = (emax->data.val.dval-emin->data.val.dval)/(amax->data.val.dval-amin->data.val.dval);
-	} else { /* lng */
-		sel = (emax->data.val.lval-emin->data.val.lval)/(dbl)(amax->data.val.lval-amin->data.val.lval);
-	}
+	/* the bounds of the compare should be of the column type */
+	if (!emin || !emax || 
+	    emin->data.vtype != amin->data.vtype || emin->tpe.scale != amin->tpe.scale ||
+	    emax->data.vtype != amax->data.vtype || emax->tpe.scale != amax->tpe.scale)
+		return 0.125;
+	dmin = atom_getdbl(amin);
+	dmax = atom_getdbl(amax);
+	lo = atom_getdbl(emin);
+	hi = atom_getdbl(emax);
+	if (dmin == dbl_nil || dmax == dbl_nil || lo == dbl_nil || hi == dbl_nil)
+		return 0.125;
+	if (dmax <= dmin) /* single value */
+		return (lo <= dmin && dmin <= hi)?1.0:0.0;
+	lo = MAX(lo, dmin);
+	hi = MIN(hi, dmax);
+	if (hi < lo)
+		return 0.0;
+	sel = (hi - lo)/(dmax - dmin);
 	return sel;
 }
 
@@ -301,7 +332,13 @@ rel_exp_selectivity(mvc *sql, sql_rel *r, sql_exp *e, lng count)
 		return 1.0;
 	switch(e->type) {
 	case e_cmp: {
-		lng dcount = exp_getdcount( sql, r, e->l, count);
+		lng dcount = count;
+
+		/* or and filter expressions have lists of operands */
+		if (e->flag != cmp_or && get_cmp(e) != cmp_filter)
+			dcount = exp_getdcount( sql, r, e->l, count);
+		if (dcount <= 0)
+			dcount = 1;
 
 		switch (get_cmp(e)) {
 		case cmp_equal: {
@@ -408,7 +445,7 @@ rel_exps_selectivity(mvc *sql, sql_rel *rel, list *exps, lng count)
 {
 	node *n;
 	dbl sel = 1.0;
-	if (!exps->h)
+	if (!exps || !exps->h)
 		return 1.0;
 	for(n=exps->h; n; n = n->next) { 
 		dbl nsel = rel_exp_selectivity(sql, rel, n->data, count);
@@ -966,3 +1003,377 @@ rel_planner(mvc *sql, list *rels, list *sdje, list *exps)
 }
 
 
+/*
+ * Cost based join ordering. The size of each relation is estimated from
+ * the table counts and the selectivity of its selections, that of the
+ * (equi) joins from the distinct counts of the join columns or from the
+ * join index. Small join graphs are enumerated exhaustively, ie dynamic
+ * programming over the connected subsets (bushy plans included), larger
+ * ones are combined greedily, each time joining the two sub plans with
+ * the smallest result. The cost of a plan is the sum of the sizes of
+ * all join inputs and outputs.
+ */
+
+#define ENUM_DP_MAX	10	/* enumerate upto 10 relations exhaustively */
+#define ENUM_MAX	64	/* sets of relations are bit masks */
+
+typedef uint64_t relset;
+
+#define relset_bit(i)	(((relset)1)<<(i))
+
+typedef struct joinedge {
+	sql_exp *e;
+	int l, r;	/* positions of the joined relations */
+} joinedge;
+
+typedef struct joingraph {
+	int nr;		/* number of relations */
+	sql_rel **rels;
+	dbl *count;	/* estimated size of each relation */
+	dbl *sel;	/* selectivity between each pair of relations */
+	relset *adj;	/* relations joined with each relation */
+	list *edges;
+} joingraph;
+
+typedef struct joinplan {
+	relset l, r;	/* best split, 0 for a single relation */
+	dbl count;	/* estimated size */
+	dbl cost;	/* cost of the best plan, < 0 if none (yet) */
+} joinplan;
+
+static dbl
+rel_estimate(mvc *sql, sql_rel *rel)
+{
+	switch(rel->op) {
+	case op_basetable: {
+		sql_table *t = rel->l;
+
+		if (t && isTable(t))
+			return (dbl)store_funcs.count_col(sql->session->tr, t->columns.set->h->data, 1);
+		return -1;
+	}
+	case op_select: {
+		dbl cnt, sel;
+
+		if (!rel->l || (cnt = rel_estimate(sql, rel->l)) < 0)
+			return -1;
+		sel = rel_exps_selectivity(sql, rel, rel->exps, MAX((lng)cnt, 1));
+		if (sel < 0)
+			sel = 0;
+		if (sel > 1)
+			sel = 1;
+		return cnt * sel;
+	}
+	case op_project:
+	case op_groupby: /* at most the input size */
+		if (rel->l)
+			return rel_estimate(sql, rel->l);
+		return 1;
+	case op_union: {
+		dbl l, r;
+
+		if ((l = rel_estimate(sql, rel->l)) < 0 || 
+		    (r = rel_estimate(sql, rel->r)) < 0)
+			return -1;
+		return l + r;
+	}
+	default:
+		return -1;
+	}
+}
+
+static void
+rel_set_count(mvc *sql, sql_rel *rel, dbl count)
+{
+	prop *p = find_prop(rel->p, PROP_COUNT);
+	lng *v = SA_NEW(sql->sa, lng);
+
+	if (!p)
+		p = rel->p = prop_create(sql->sa, PROP_COUNT, rel->p);
+	*v = (count < (dbl)GDK_lng_max)?(lng)(count + 0.5):GDK_lng_max;
+	p->value = v;
+}
+
+/* selectivity of join expression e between relations l and r */
+static dbl
+rel_join_sel(mvc *sql, sql_rel *l, sql_rel *r, sql_exp *e, dbl lcount, dbl rcount)
+{
+	switch (get_cmp(e)) {
+	case cmp_equal: {
+		lng ldcount, rdcount;
+
+		if (find_prop(e->p, PROP_JOINIDX)) {
+			/* every row of the foreign key side has exactly one
+			 * match in the (unselected) primary key side */
+			sql_rel *p = (rel_has_exp(r, e->r) == 0)?r:l;
+			dbl pcount = (dbl)rel_getcount(sql, p);
+
+			return (pcount > 1)?1.0/pcount:1.0;
+		}
+		if (rel_has_exp(l, e->l) < 0) {
+			sql_rel *s = l;
+			dbl c = lcount;
+
+			l = r;
+			r = s;
+			lcount = rcount;
+			rcount = c;
+		}
+		ldcount = exp_getdcount(sql, l, e->l, MAX((lng)lcount, 1));
+		rdcount = exp_getdcount(sql, r, e->r, MAX((lng)rcount, 1));
+		return 1.0/MAX(MAX(ldcount, rdcount), 1);
+	}
+	case cmp_notequal:
+		return 1.0;
+	case cmp_gt:
+	case cmp_gte:
+	case cmp_lt:
+	case cmp_lte:
+		return (e->f)?0.2:0.5;
+	default:
+		return 1.0;
+	}
+}
+
+static joingraph *
+joingraph_create(mvc *sql, list *rels, list *exps)
+{
+	joingraph *g = SA_ZNEW(sql->sa, joingraph);
+	int i, j, nr = list_length(rels);
+	node *n;
+
+	g->nr = nr;
+	g->rels = SA_NEW_ARRAY(sql->sa, sql_rel*, nr);
+	g->count = SA_NEW_ARRAY(sql->sa, dbl, nr);
+	g->sel = SA_NEW_ARRAY(sql->sa, dbl, nr*nr);
+	g->adj = SA_NEW_ARRAY(sql->sa, relset, nr);
+	g->edges = sa_list(sql->sa);
+	for (n = rels->h, i = 0; n; n = n->next, i++) {
+		g->rels[i] = n->data;
+		/* without estimates keep the heuristic order */
+		if ((g->count[i] = rel_estimate(sql, g->rels[i])) < 0)
+			return NULL;
+		g->count[i] = MAX(g->count[i], 1);
+		g->adj[i] = 0;
+		for (j = 0; j < nr; j++)
+			g->sel[i*nr+j] = 1.0;
+	}
+	for (n = exps->h; n; n = n->next) {
+		sql_exp *e = n->data;
+		sql_rel *l, *r;
+		joinedge *je;
+		dbl sel;
+
+		if (e->type != e_cmp || is_complex_exp(e->flag) || exp_is_join(e, rels) != 0)
+			continue;
+		l = find_one_rel(rels, e->l);
+		r = find_one_rel(rels, e->r);
+		if (!l || !r || l == r)
+			continue;
+		je = SA_NEW(sql->sa, joinedge);
+		je->e = e;
+		je->l = list_position(rels, l);
+		je->r = list_position(rels, r);
+		append(g->edges, je);
+
+		/* multiple expressions between the same relations are
+		 * seldom independent, use the most selective one */
+		sel = rel_join_sel(sql, l, r, e, g->count[je->l], g->count[je->r]);
+		i = je->l;
+		j = je->r;
+		if (sel < g->sel[i*nr+j])
+			g->sel[i*nr+j] = g->sel[j*nr+i] = sel;
+		g->adj[i] |= relset_bit(j);
+		g->adj[j] |= relset_bit(i);
+	}
+	return g;
+}
+
+/* add the join expressions between the relations in l and r */
+static sql_rel *
+joingraph_join(mvc *sql, joingraph *g, sql_rel *lrel, relset l, sql_rel *rrel, relset r, list *exps, dbl count)
+{
+	sql_rel *top = rel_crossproduct(sql->sa, lrel, rrel, op_join);
+	node *n;
+
+	for (n = g->edges->h; n; n = n->next) {
+		joinedge *je = n->data;
+
+		if (((l & relset_bit(je->l)) && (r & relset_bit(je->r))) ||
+		    ((r & relset_bit(je->l)) && (l & relset_bit(je->r)))) {
+			rel_join_add_exp(sql->sa, top, je->e);
+			list_remove_data(exps, je->e);
+		}
+	}
+	rel_set_count(sql, top, count);
+	return top;
+}
+
+static int
+joingraph_connected(joingraph *g, relset l, relset r)
+{
+	int i;
+
+	for (i = 0; i < g->nr; i++)
+		if ((l & relset_bit(i)) && (g->adj[i] & r))
+			return 1;
+	return 0;
+}
+
+static sql_rel *
+joinplan_build(mvc *sql, joingraph *g, joinplan *plans, relset s, list *exps)
+{
+	joinplan *p = plans + s;
+	sql_rel *l, *r;
+	int i;
+
+	if (!p->l) {
+		for (i = 0; !(s & relset_bit(i)); i++)
+			;
+		rel_set_count(sql, g->rels[i], p->count);
+		return g->rels[i];
+	}
+	l = joinplan_build(sql, g, plans, p->l, exps);
+	r = joinplan_build(sql, g, plans, p->r, exps);
+	return joingraph_join(sql, g, l, p->l, r, p->r, exps, p->count);
+}
+
+/* dynamic programming over all subsets, only joins along the edges of
+ * the graph are considered, ie no cross products */
+static sql_rel *
+joingraph_enum(mvc *sql, joingraph *g, list *exps)
+{
+	relset s, all = relset_bit(g->nr) - 1;
+	joinplan *plans = SA_NEW_ARRAY(sql->sa, joinplan, all + 1);
+	int i, j;
+
+	for (s = 1; s <= all; s++) {
+		joinplan *p = plans + s;
+		relset low = s & (~s + 1), rest = s ^ low, l;
+
+		for (i = 0; low != relset_bit(i); i++)
+			;
+		p->l = p->r = 0;
+		p->cost = -1;
+		if (!rest) {
+			p->count = g->count[i];
+			p->cost = 0;
+			continue;
+		}
+		p->count = plans[rest].count * g->count[i];
+		for (j = 0; j < g->nr; j++)
+			if (rest & relset_bit(j))
+				p->count *= g->sel[i*g->nr+j];
+
+		/* the left part holds the lowest relation, ie each split
+		 * is considered once */
+		for (l = (s - 1) & s; l; l = (l - 1) & s) {
+			relset r = s ^ l;
+			dbl cost;
+
+			if (!(l & low) || plans[l].cost < 0 || plans[r].cost < 0 ||
+			    !joingraph_connected(g, l, r))
+				continue;
+			cost = plans[l].cost + plans[r].cost + plans[l].count + plans[r].count + p->count;
+			if (p->cost < 0 || cost < p->cost) {
+				/* larger input on the left */
+				if (plans[l].count >= plans[r].count) {
+					p->l = l;
+					p->r = r;
+				} else {
+					p->l = r;
+					p->r = l;
+				}
+				p->cost = cost;
+			}
+		}
+	}
+	if (plans[all].cost < 0) /* not connected */
+		return NULL;
+	return joinplan_build(sql, g, plans, all, exps);
+}
+
+/* greedy, join the connected pair with the smallest result first */
+static sql_rel *
+joingraph_greedy(mvc *sql, joingraph *g, list *exps)
+{
+	int nr = g->nr, i, j, k;
+	sql_rel **rels = SA_NEW_ARRAY(sql->sa, sql_rel*, nr);
+	relset *sets = SA_NEW_ARRAY(sql->sa, relset, nr);
+	dbl *count = SA_NEW_ARRAY(sql->sa, dbl, nr);
+	dbl *sel = SA_NEW_ARRAY(sql->sa, dbl, nr*nr);
+	sql_rel *top;
+
+	for (i = 0; i < nr; i++) {
+		rels[i] = g->rels[i];
+		sets[i] = relset_bit(i);
+		count[i] = g->count[i];
+		rel_set_count(sql, rels[i], count[i]);
+		for (j = 0; j < nr; j++)
+			sel[i*nr+j] = g->sel[i*nr+j];
+	}
+	for (k = nr; k > 1; ) {
+		int bl = -1, br = -1;
+		dbl bcount = 0;
+
+		for (i = 0; i < k; i++) {
+			for (j = i+1; j < k; j++) {
+				dbl c;
+
+				if (!joingraph_connected(g, sets[i], sets[j]))
+					continue;
+				c = count[i] * count[j] * sel[i*nr+j];
+				if (bl < 0 || c < bcount) {
+					bl = i;
+					br = j;
+					bcount = c;
+				}
+			}
+		}
+		if (bl < 0) /* not connected */
+			break;
+		if (count[bl] < count[br]) {
+			i = bl;
+			bl = br;
+			br = i;
+		}
+		rels[bl] = joingraph_join(sql, g, rels[bl], sets[bl], rels[br], sets[br], exps, bcount);
+		sets[bl] |= sets[br];
+		count[bl] = bcount;
+		for (j = 0; j < k; j++)
+			sel[bl*nr+j] = sel[j*nr+bl] = sel[bl*nr+j] * sel[br*nr+j];
+		/* move the last one into the free slot */
+		k--;
+		if (br != k) {
+			rels[br] = rels[k];
+			sets[br] = sets[k];
+			count[br] = count[k];
+			for (j = 0; j < k; j++)
+				sel[br*nr+j] = sel[j*nr+br] = sel[k*nr+j];
+		}
+	}
+	top = rels[0];
+	for (i = 1; i < k; i++)
+		top = rel_crossproduct(sql->sa, top, rels[i], op_join);
+	return top;
+}
+
+sql_rel *
+rel_join_enum(mvc *sql, list *rels, list *exps)
+{
+	joingraph *g;
+	sql_rel *top = NULL;
+	int nr = list_length(rels);
+
+	if (!sql->session->tr || nr > ENUM_MAX || 
+	    !(g = joingraph_create(sql, rels, exps)) || list_empty(g->edges))
+		return NULL;
+	if (nr <= ENUM_DP_MAX)
+		top = joingraph_enum(sql, g, exps);
+	if (!top)
+		top = joingraph_greedy(sql, g, exps);
+	/* all relations are used */
+	while (rels->h)
+		list_remove_node(rels, rels->h);
+	return top;
+}
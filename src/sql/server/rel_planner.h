@@ -13,5 +13,6 @@
 #include "sql_mvc.h"
 
 extern sql_rel * rel_planner(mvc *sql, list *rels, list *djes, list *ojes);
+extern sql_rel * rel_join_enum(mvc *sql, list *rels, list *exps);
 
 #endif /*_REL_PLANNER_H_ */
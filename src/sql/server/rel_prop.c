@@ -95,6 +95,10 @@ propvalue2string( prop *p)
 
 			   return _STRDUP(uri);
 			}
+		case PROP_COUNT: { /* estimated number of rows */
+			   snprintf(buf, BUFSIZ, LLFMT, *(lng*)p->value);
+			   return _STRDUP(buf);
+			}
 		default:
 			break;
 		}
@@ -160,6 +160,7 @@ rel_semantic(mvc *sql, symbol *s)
 	case SQL_COPYFROM:
 	case SQL_BINCOPYFROM:
 	case SQL_COPYTO:
+	case SQL_BINCOPYTO:
 		return rel_updates(sql, s);
 
 	case SQL_WITH:
@@ -1512,6 +1512,50 @@ copyto(mvc *sql, symbol *sq, str filename, dlist *seps, str null_string)
 	return rel_output(sql, r, tsep_e, rsep_e, ssep_e, ns_e, fname_e);
 }
 
+static sql_rel *
+bincopyto(mvc *sql, symbol *sq, dlist *files)
+{
+	exp_kind ek = {type_value, card_relation, TRUE};
+	sql_rel *r = rel_subquery(sql, NULL, sq, ek, APPLY_JOIN), *rel;
+	sql_subtype tpe;
+	list *exps;
+	dnode *dn;
+	int nr;
+
+	if (!r) 
+		return NULL;
+	if (!copy_allowed(sql, 0)) 
+		return sql_error(sql, 02, "COPY INTO: insufficient privileges: "
+				"binary COPY INTO requires database administrator rights");
+	nr = list_length(rel_projections(sql, r, NULL, 1, 0));
+	if (dlist_length(files) != nr)
+		return sql_error(sql, 02, "COPY INTO: need %d files, one per "
+				"result column", nr);
+
+	sql_find_subtype(&tpe, "varchar", 0, 0);
+	exps = new_exp_list(sql->sa);
+	/* existing files are refused when they are created, see
+	 * sql.export_bin */
+	for (dn = files->h; dn; dn = dn->next) {
+		char *filename = dn->data.sval;
+
+		if (!MT_path_absolute(filename))
+			return sql_error(sql, 02, "COPY INTO: filename must "
+					"have absolute path: %s", filename);
+		append(exps, exp_atom_str(sql->sa, filename, &tpe));
+	}
+
+	rel = rel_create(sql->sa);
+	rel->l = r;
+	rel->r = NULL;
+	rel->op = op_ddl;
+	rel->flag = DDL_BINOUTPUT;
+	rel->exps = exps;
+	rel->card = 0;
+	rel->nrcols = 0;
+	return rel;
+}
+
 sql_exp *
 rel_parse_val(mvc *m, char *query, char emode)
 {
@@ -1623,6 +1667,14 @@ rel_updates(mvc *sql, symbol *s)
 		sql->type = Q_UPDATE;
 	}
 		break;
+	case SQL_BINCOPYTO:
+	{
+		dlist *l = s->data.lval;
+
+		ret = bincopyto(sql, l->h->data.sym, l->h->next->data.lval);
+		sql->type = Q_UPDATE;
+	}
+		break;
 	case SQL_INSERT:
 	{
 		dlist *l = s->data.lval;
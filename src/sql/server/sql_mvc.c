@@ -44,10 +44,15 @@ mvc_init(int debug, store_type store, int ro, int su, backend_stack stk)
 	 * 0 by default - keeps only the current WAL file. */
 	log_settings.keep_persisted_log_files = GDKgetenv_int("gdk_keep_persisted_log_files", 0);
 
+	/* Get and pass on the group commit delay in milliseconds.
+	 * -1 by default - each commit fsyncs the WAL by itself. */
+	log_settings.commit_delay = GDKgetenv_int("gdk_commit_delay", -1);
+
 	mvc_debug = debug&4;
 	if (mvc_debug) {
 		fprintf(stderr, "#mvc_init logdir %s\n", log_settings.logdir);
 		fprintf(stderr, "#mvc_init keep_persisted_log_files %d\n", log_settings.keep_persisted_log_files);
+		fprintf(stderr, "#mvc_init commit_delay %d\n", log_settings.commit_delay);
 		if (log_settings.shared_logdir != NULL) {
 			fprintf(stderr, "#mvc_init shared_logdir %s\n", log_settings.shared_logdir);
 		}
@@ -220,6 +225,12 @@ mvc_trans(mvc *m)
 	int schema_changed = 0, err = m->session->status;
 	assert(!m->session->active);	/* can only start a new transaction */
 
+	/* the common case, nothing changed since our last transaction */
+	if (!err && sql_trans_begin_snapshot(m->session)) {
+		if (m->qc && m->qc->nr > m->cache)
+			qc_clean(m->qc);
+		return;
+	}
 	store_lock();
 	schema_changed = sql_trans_begin(m->session);
 	if (m->qc && (schema_changed || m->qc->nr > m->cache || err)){
@@ -274,6 +285,7 @@ mvc_commit(mvc *m, int chain, const char *name)
 {
 	sql_trans *cur, *tr = m->session->tr, *ctr;
 	int ok = SQL_OK;//, wait = 0;
+	lng commit_nr = 0;
 
 	assert(tr);
 	assert(m->session->active);	/* only commit an active transaction */
@@ -322,6 +334,15 @@ build up the hash (not copied in the trans dup)) */
 	cur -> parent = tr;
 	tr = cur;
 
+	/* snapshot transactions without changes end without the lock */
+	if (tr->wtime == 0 && m->session->snapshot) {
+		if (!chain) 
+			sql_trans_end(m->session);
+		m->type = Q_TRANS;
+		if (mvc_debug)
+			fprintf(stderr, "#mvc_commit %s done\n", (name) ? name : "");
+		return 0;
+	}
 	store_lock();
 	/* if there is nothing to commit reuse the current transaction */
 	if (tr->wtime == 0) {
@@ -354,6 +375,7 @@ build up the hash (not copied in the trans dup)) */
 			GDKfatal("%s", msg);
 			_DELETE(msg);
 		}
+		commit_nr = store_commit_nr();
 	} else {
 		store_unlock();
 		(void)sql_error(m, 010, "40000!COMMIT: transaction is aborted because of concurrency conflicts, will ROLLBACK instead");
@@ -364,6 +386,12 @@ build up the hash (not copied in the trans dup)) */
 	if (chain) 
 		sql_trans_begin(m->session);
 	store_unlock();
+	/* wait for the (group) fsync of the log outside the store lock */
+	if (store_sync(commit_nr) != LOG_OK) {
+		char *msg = sql_message("40000!COMMIT: transaction commit failed (perhaps your disk is full?) exiting (kernel error: %s)", GDKerrbuf);
+		GDKfatal("%s", msg);
+		_DELETE(msg);
+	}
 	m->type = Q_TRANS;
 	if (mvc_debug)
 		fprintf(stderr, "#mvc_commit %s done\n", (name) ? name : "");
@@ -149,6 +149,7 @@ typedef enum tokens {
 	SQL_COPYFROM,
 	SQL_BINCOPYFROM,
 	SQL_COPYTO,
+	SQL_BINCOPYTO,
 	SQL_EXPORT,
 	SQL_NEXT,
 	SQL_MULSTMT,
@@ -1083,16 +1083,16 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  225
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   16401
+#define YYLAST   16168
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  343
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  405
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  1108
+#define YYNRULES  1109
 /* YYNRULES -- Number of states.  */
-#define YYNSTATES  2043
+#define YYNSTATES  2045
 
 /* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
 #define YYUNDEFTOK  2
@@ -1107,16 +1107,16 @@ static const yytype_uint16 yytranslate[] =
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,   205,   191,     2,
-     170,   171,   203,   189,   337,   190,   338,   204,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,   203,   189,     2,
+     168,   169,   201,   187,   337,   188,   338,   202,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,   339,     2,
-       2,   174,     2,   342,     2,     2,     2,     2,     2,     2,
+       2,   172,     2,   342,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,   340,     2,   341,   193,     2,     2,     2,     2,     2,
+       2,   340,     2,   341,   191,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,   192,     2,   206,     2,     2,     2,
+       2,     2,     2,     2,   190,     2,   204,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -1129,39 +1129,39 @@ static const yytype_uint16 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
-     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
-     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
-     165,   166,   167,   168,   169,   172,   173,   175,   176,   177,
-     178,   179,   180,   181,   182,   183,   184,   185,   186,   187,
-     188,   194,   195,   196,   197,   198,   199,   200,   201,   202,
-     207,   208,   209,   210,   211,   212,   213,   214,   215,   216,
-     217,   218,   219,   220,   221,   222,   223,   224,   225,   226,
-     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
-     247,   248,   249,   250,   251,   252,   253,   254,   255,   256,
-     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
-     267,   268,   269,   270,   271,   272,   273,   274,   275,   276,
-     277,   278,   279,   280,   281,   282,   283,   284,   285,   286,
-     287,   288,   289,   290,   291,   292,   293,   294,   295,   296,
-     297,   298,   299,   300,   301,   302,   303,   304,   305,   306,
-     307,   308,   309,   310,   311,   312,   313,   314,   315,   316,
-     317,   318,   319,   320,   321,   322,   323,   324,   325,   326,
-     327,   328,   329,   330,   331,   332,   333,   334,   335,   336
+       2,     2,     2,     2,     2,     2,     1,     2,     3,   336,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   166,   165,
+     164,   163,   162,   167,   280,   170,   171,   184,   183,   182,
+     181,   180,   179,   178,   177,   176,   175,   174,   173,   185,
+     186,   199,   198,   197,   196,   195,   194,   193,   192,   200,
+     208,   207,   206,   205,   212,   211,   210,   209,   213,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
+     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
+     255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
+     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
+     275,   276,   277,   278,   279,   281,   282,   283,   284,   285,
+     286,   287,   288,   289,   290,   291,   292,   293,   294,   295,
+     296,   297,   298,   299,   300,   301,   302,   303,   304,   305,
+     306,   307,   308,   309,   310,   311,   312,   313,   314,   315,
+     316,   317,   318,   319,   320,   321,   322,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,   332,   333,   334,   335
 };
 
 #if YYDEBUG
@@ -1213,428 +1213,429 @@ static const yytype_uint16 yyprhs[] =
     1363,  1367,  1372,  1376,  1381,  1385,  1386,  1388,  1390,  1394,
     1397,  1400,  1404,  1408,  1411,  1414,  1417,  1419,  1421,  1422,
     1425,  1429,  1430,  1431,  1435,  1450,  1464,  1473,  1480,  1487,
-    1488,  1493,  1495,  1499,  1500,  1504,  1506,  1510,  1512,  1515,
-    1516,  1520,  1526,  1534,  1535,  1537,  1538,  1541,  1544,  1549,
-    1554,  1555,  1559,  1560,  1562,  1563,  1566,  1567,  1570,  1572,
-    1576,  1578,  1582,  1587,  1593,  1598,  1604,  1605,  1608,  1611,
-    1613,  1617,  1623,  1625,  1629,  1631,  1635,  1637,  1639,  1641,
-    1643,  1645,  1646,  1648,  1650,  1652,  1656,  1660,  1664,  1665,
-    1668,  1672,  1677,  1682,  1687,  1692,  1698,  1704,  1706,  1709,
-    1711,  1713,  1715,  1717,  1720,  1723,  1725,  1729,  1733,  1735,
-    1742,  1744,  1746,  1748,  1753,  1760,  1766,  1768,  1772,  1774,
-    1780,  1786,  1792,  1796,  1798,  1799,  1801,  1803,  1804,  1806,
-    1812,  1814,  1819,  1820,  1823,  1825,  1829,  1831,  1834,  1837,
-    1839,  1841,  1844,  1846,  1848,  1849,  1855,  1861,  1864,  1869,
-    1871,  1872,  1876,  1878,  1882,  1883,  1886,  1890,  1892,  1896,
-    1898,  1899,  1903,  1904,  1907,  1910,  1911,  1914,  1917,  1918,
-    1921,  1924,  1927,  1929,  1933,  1936,  1937,  1939,  1941,  1943,
-    1945,  1947,  1949,  1951,  1953,  1955,  1957,  1959,  1962,  1964,
-    1968,  1972,  1979,  1986,  1987,  1989,  1991,  1995,  1999,  2003,
-    2007,  2009,  2013,  2018,  2022,  2028,  2034,  2042,  2050,  2052,
-    2056,  2061,  2063,  2065,  2067,  2070,  2072,  2076,  2080,  2084,
-    2088,  2093,  2097,  2099,  2103,  2107,  2111,  2115,  2119,  2123,
-    2127,  2131,  2135,  2139,  2143,  2147,  2151,  2155,  2159,  2163,
-    2167,  2171,  2176,  2179,  2183,  2187,  2191,  2195,  2198,  2201,
-    2205,  2207,  2209,  2211,  2213,  2215,  2217,  2219,  2221,  2223,
-    2225,  2230,  2232,  2234,  2236,  2238,  2240,  2242,  2244,  2246,
-    2252,  2256,  2258,  2262,  2263,  2267,  2268,  2272,  2273,  2277,
-    2279,  2281,  2283,  2285,  2288,  2290,  2293,  2296,  2301,  2304,
-    2306,  2309,  2312,  2313,  2317,  2320,  2323,  2327,  2330,  2334,
-    2339,  2341,  2345,  2347,  2349,  2351,  2353,  2360,  2363,  2366,
-    2369,  2372,  2375,  2376,  2379,  2388,  2397,  2404,  2411,  2418,
-    2422,  2431,  2433,  2437,  2439,  2443,  2447,  2450,  2451,  2454,
-    2456,  2458,  2462,  2464,  2468,  2470,  2474,  2479,  2486,  2492,
-    2498,  2503,  2510,  2512,  2514,  2516,  2517,  2521,  2522,  2526,
-    2527,  2531,  2532,  2534,  2538,  2542,  2544,  2546,  2548,  2550,
-    2552,  2554,  2556,  2559,  2561,  2564,  2567,  2570,  2574,  2576,
-    2579,  2581,  2583,  2585,  2587,  2589,  2591,  2593,  2595,  2597,
-    2600,  2605,  2610,  2612,  2615,  2618,  2621,  2624,  2626,  2628,
-    2633,  2635,  2639,  2645,  2647,  2651,  2657,  2664,  2671,  2673,
-    2680,  2685,  2691,  2696,  2698,  2702,  2706,  2710,  2715,  2717,
-    2720,  2725,  2727,  2730,  2731,  2734,  2736,  2738,  2740,  2742,
-    2744,  2746,  2748,  2750,  2752,  2754,  2759,  2764,  2769,  2771,
-    2776,  2778,  2780,  2782,  2784,  2786,  2788,  2793,  2800,  2802,
-    2807,  2814,  2816,  2819,  2821,  2823,  2825,  2827,  2832,  2834,
-    2839,  2846,  2848,  2853,  2855,  2860,  2867,  2869,  2871,  2873,
-    2875,  2877,  2879,  2882,  2884,  2886,  2890,  2892,  2896,  2898,
-    2900,  2902,  2904,  2906,  2908,  2910,  2912,  2914,  2916,  2918,
-    2920,  2922,  2924,  2926,  2928,  2930,  2932,  2934,  2936,  2938,
-    2940,  2942,  2944,  2946,  2948,  2950,  2952,  2954,  2956,  2958,
-    2960,  2962,  2964,  2966,  2968,  2970,  2972,  2974,  2976,  2978,
-    2980,  2982,  2984,  2986,  2988,  2990,  2992,  2994,  2996,  2998,
-    3000,  3002,  3004,  3006,  3008,  3010,  3012,  3014,  3016,  3018,
-    3020,  3022,  3024,  3026,  3028,  3030,  3032,  3034,  3036,  3038,
-    3040,  3042,  3044,  3046,  3048,  3050,  3052,  3054,  3056,  3058,
-    3060,  3062,  3064,  3066,  3068,  3070,  3072,  3074,  3076,  3080,
-    3082,  3084,  3086,  3088,  3090,  3093,  3096,  3100,  3105,  3106,
-    3108,  3111,  3113,  3115,  3117,  3121,  3123,  3125,  3127,  3129,
-    3131,  3133,  3135,  3137,  3139,  3141,  3143,  3149,  3155,  3161,
-    3169,  3170,  3173,  3178,  3185,  3190,  3193,  3198,  3201,  3203,
-    3208,  3210,  3214,  3217,  3218,  3221,  3223,  3225,  3228,  3230,
-    3234,  3236,  3237,  3240,  3244,  3248,  3252,  3256,  3261,  3269,
-    3270,  3273,  3275,  3279,  3282,  3284,  3285,  3288,  3290,  3297,
-    3300,  3303,  3311,  3313,  3314,  3317,  3326,  3328,  3329,  3333,
-    3335,  3337,  3341,  3343,  3345,  3348,  3353,  3354,  3356,  3360,
-    3364,  3370,  3377,  3379,  3381,  3383,  3385,  3386,  3389,  3392,
-    3397,  3399,  3403,  3405,  3407,  3409,  3411,  3415,  3418,  3421,
-    3422,  3424,  3427,  3430,  3431,  3433,  3439,  3441,  3443,  3447,
-    3451,  3453,  3455,  3456,  3459,  3461,  3464,  3466,  3467,  3469,
-    3471,  3474,  3475,  3477,  3480,  3483,  3486,  3488,  3490
+    1493,  1494,  1499,  1501,  1505,  1506,  1510,  1512,  1516,  1518,
+    1521,  1522,  1526,  1532,  1540,  1541,  1543,  1544,  1547,  1550,
+    1555,  1560,  1561,  1565,  1566,  1568,  1569,  1572,  1573,  1576,
+    1578,  1582,  1584,  1588,  1593,  1599,  1604,  1610,  1611,  1614,
+    1617,  1619,  1623,  1629,  1631,  1635,  1637,  1641,  1643,  1645,
+    1647,  1649,  1651,  1652,  1654,  1656,  1658,  1662,  1666,  1670,
+    1671,  1674,  1678,  1683,  1688,  1693,  1698,  1704,  1710,  1712,
+    1715,  1717,  1719,  1721,  1723,  1726,  1729,  1731,  1735,  1739,
+    1741,  1748,  1750,  1752,  1754,  1759,  1766,  1772,  1774,  1778,
+    1780,  1786,  1792,  1798,  1802,  1804,  1805,  1807,  1809,  1810,
+    1812,  1818,  1820,  1825,  1826,  1829,  1831,  1835,  1837,  1840,
+    1843,  1845,  1847,  1850,  1852,  1854,  1855,  1861,  1867,  1870,
+    1875,  1877,  1878,  1882,  1884,  1888,  1889,  1892,  1896,  1898,
+    1902,  1904,  1905,  1909,  1910,  1913,  1916,  1917,  1920,  1923,
+    1924,  1927,  1930,  1933,  1935,  1939,  1942,  1943,  1945,  1947,
+    1949,  1951,  1953,  1955,  1957,  1959,  1961,  1963,  1965,  1968,
+    1970,  1974,  1978,  1985,  1992,  1993,  1995,  1997,  2001,  2005,
+    2009,  2013,  2015,  2019,  2024,  2028,  2034,  2040,  2048,  2056,
+    2058,  2062,  2067,  2069,  2071,  2073,  2076,  2078,  2082,  2086,
+    2090,  2094,  2099,  2103,  2105,  2109,  2113,  2117,  2121,  2125,
+    2129,  2133,  2137,  2141,  2145,  2149,  2153,  2157,  2161,  2165,
+    2169,  2173,  2177,  2182,  2185,  2189,  2193,  2197,  2201,  2204,
+    2207,  2211,  2213,  2215,  2217,  2219,  2221,  2223,  2225,  2227,
+    2229,  2231,  2236,  2238,  2240,  2242,  2244,  2246,  2248,  2250,
+    2252,  2258,  2262,  2264,  2268,  2269,  2273,  2274,  2278,  2279,
+    2283,  2285,  2287,  2289,  2291,  2294,  2296,  2299,  2302,  2307,
+    2310,  2312,  2315,  2318,  2319,  2323,  2326,  2329,  2333,  2336,
+    2340,  2345,  2347,  2351,  2353,  2355,  2357,  2359,  2366,  2369,
+    2372,  2375,  2378,  2381,  2382,  2385,  2394,  2403,  2410,  2417,
+    2424,  2428,  2437,  2439,  2443,  2445,  2449,  2453,  2456,  2457,
+    2460,  2462,  2464,  2468,  2470,  2474,  2476,  2480,  2485,  2492,
+    2498,  2504,  2509,  2516,  2518,  2520,  2522,  2523,  2527,  2528,
+    2532,  2533,  2537,  2538,  2540,  2544,  2548,  2550,  2552,  2554,
+    2556,  2558,  2560,  2562,  2565,  2567,  2570,  2573,  2576,  2580,
+    2582,  2585,  2587,  2589,  2591,  2593,  2595,  2597,  2599,  2601,
+    2603,  2606,  2611,  2616,  2618,  2621,  2624,  2627,  2630,  2632,
+    2634,  2639,  2641,  2645,  2651,  2653,  2657,  2663,  2670,  2677,
+    2679,  2686,  2691,  2697,  2702,  2704,  2708,  2712,  2716,  2721,
+    2723,  2726,  2731,  2733,  2736,  2737,  2740,  2742,  2744,  2746,
+    2748,  2750,  2752,  2754,  2756,  2758,  2760,  2765,  2770,  2775,
+    2777,  2782,  2784,  2786,  2788,  2790,  2792,  2794,  2799,  2806,
+    2808,  2813,  2820,  2822,  2825,  2827,  2829,  2831,  2833,  2838,
+    2840,  2845,  2852,  2854,  2859,  2861,  2866,  2873,  2875,  2877,
+    2879,  2881,  2883,  2885,  2888,  2890,  2892,  2896,  2898,  2902,
+    2904,  2906,  2908,  2910,  2912,  2914,  2916,  2918,  2920,  2922,
+    2924,  2926,  2928,  2930,  2932,  2934,  2936,  2938,  2940,  2942,
+    2944,  2946,  2948,  2950,  2952,  2954,  2956,  2958,  2960,  2962,
+    2964,  2966,  2968,  2970,  2972,  2974,  2976,  2978,  2980,  2982,
+    2984,  2986,  2988,  2990,  2992,  2994,  2996,  2998,  3000,  3002,
+    3004,  3006,  3008,  3010,  3012,  3014,  3016,  3018,  3020,  3022,
+    3024,  3026,  3028,  3030,  3032,  3034,  3036,  3038,  3040,  3042,
+    3044,  3046,  3048,  3050,  3052,  3054,  3056,  3058,  3060,  3062,
+    3064,  3066,  3068,  3070,  3072,  3074,  3076,  3078,  3080,  3082,
+    3086,  3088,  3090,  3092,  3094,  3096,  3099,  3102,  3106,  3111,
+    3112,  3114,  3117,  3119,  3121,  3123,  3127,  3129,  3131,  3133,
+    3135,  3137,  3139,  3141,  3143,  3145,  3147,  3149,  3155,  3161,
+    3167,  3175,  3176,  3179,  3184,  3191,  3196,  3199,  3204,  3207,
+    3209,  3214,  3216,  3220,  3223,  3224,  3227,  3229,  3231,  3234,
+    3236,  3240,  3242,  3243,  3246,  3250,  3254,  3258,  3262,  3267,
+    3275,  3276,  3279,  3281,  3285,  3288,  3290,  3291,  3294,  3296,
+    3303,  3306,  3309,  3317,  3319,  3320,  3323,  3332,  3334,  3335,
+    3339,  3341,  3343,  3347,  3349,  3351,  3354,  3359,  3360,  3362,
+    3366,  3370,  3376,  3383,  3385,  3387,  3389,  3391,  3392,  3395,
+    3398,  3403,  3405,  3409,  3411,  3413,  3415,  3417,  3421,  3424,
+    3427,  3428,  3430,  3433,  3436,  3437,  3439,  3445,  3447,  3449,
+    3453,  3457,  3459,  3461,  3462,  3465,  3467,  3470,  3472,  3473,
+    3475,  3477,  3480,  3481,  3483,  3486,  3489,  3492,  3494,  3496
 };
 
 /* YYRHS -- A `-1'-separated list of the rules' RHS.  */
 static const yytype_int16 yyrhs[] =
 {
-     344,     0,    -1,   355,   130,    -1,    -1,   244,   345,   355,
-     130,    -1,    -1,   240,   346,   355,   130,    -1,    -1,   239,
-     347,   355,   130,    -1,    -1,   243,   348,   355,   130,    -1,
-      -1,   241,   349,   344,    -1,    -1,   242,   350,   344,    -1,
-     668,   130,    -1,    -1,   130,    -1,     1,   130,    -1,    51,
-      -1,   226,    -1,   248,    -1,   270,    -1,   234,    -1,   360,
+     344,     0,    -1,   355,   129,    -1,    -1,   242,   345,   355,
+     129,    -1,    -1,   238,   346,   355,   129,    -1,    -1,   237,
+     347,   355,   129,    -1,    -1,   241,   348,   355,   129,    -1,
+      -1,   239,   349,   344,    -1,    -1,   240,   350,   344,    -1,
+     668,   129,    -1,    -1,   129,    -1,     1,   129,    -1,    50,
+      -1,   224,    -1,   246,    -1,   268,    -1,   232,    -1,   360,
       -1,   369,    -1,   374,    -1,   391,    -1,   488,    -1,   386,
-      -1,   357,    -1,   359,    -1,   237,   633,   441,   564,   356,
-      -1,   453,    -1,    -1,   238,    -1,   354,   358,    -1,   354,
+      -1,   357,    -1,   359,    -1,   235,   633,   441,   564,   356,
+      -1,   453,    -1,    -1,   236,    -1,   354,   358,    -1,   354,
      403,    -1,   435,   652,    -1,   358,   337,   435,   652,    -1,
-     353,   661,   174,   525,    -1,   353,    63,   223,   661,    -1,
-     353,   269,   661,    -1,   353,   630,   174,   661,    -1,   353,
-     256,   661,    -1,   353,   283,   292,    58,    -1,   353,   283,
-     292,   632,    -1,   351,   269,   361,   363,   670,   364,    -1,
-     352,   269,   633,   491,    -1,   661,    -1,   223,   362,    -1,
-     661,   223,   362,    -1,   661,    -1,    -1,   246,    20,   270,
+     353,   661,   172,   525,    -1,   353,    62,   221,   661,    -1,
+     353,   267,   661,    -1,   353,   630,   172,   661,    -1,   353,
+     254,   661,    -1,   353,   282,   291,    57,    -1,   353,   282,
+     291,   632,    -1,   351,   267,   361,   363,   670,   364,    -1,
+     352,   267,   633,   491,    -1,   661,    -1,   221,   362,    -1,
+     661,   221,   362,    -1,   661,    -1,    -1,   244,    19,   268,
      661,    -1,    -1,   365,    -1,   366,    -1,   365,   366,    -1,
      369,    -1,   374,    -1,   391,    -1,   488,    -1,   386,    -1,
-      -1,   169,   257,   368,    -1,    56,    -1,    62,    -1,   254,
-     377,   277,   384,   371,   373,    -1,   254,   370,   277,   384,
+      -1,   280,   255,   368,    -1,    55,    -1,    61,    -1,   252,
+     377,   275,   384,   371,   373,    -1,   252,   370,   275,   384,
      372,   373,    -1,   659,    -1,   370,   337,   659,    -1,    -1,
-     169,   254,   262,    -1,    -1,   169,   257,   262,    -1,    -1,
-     108,   368,    -1,   255,   375,   377,   108,   384,   373,    -1,
-     255,   376,   370,   108,   384,   373,    -1,    -1,   254,   262,
-     109,    -1,    -1,   257,   262,   109,    -1,   378,    -1,   381,
-     261,   380,    -1,   379,    -1,   379,   337,   379,    -1,   309,
-     108,    -1,   309,   258,    -1,   275,   633,    -1,   633,    -1,
-     487,    -1,   186,   266,    -1,   186,    -1,   382,    -1,   383,
-      -1,   382,   337,   383,    -1,    67,    -1,    64,    -1,    65,
-     441,    -1,    66,   441,    -1,   268,   441,    -1,   245,    -1,
-     385,    -1,   384,   337,   385,    -1,   267,    -1,   659,    -1,
-     273,   275,   633,   274,   390,   410,    -1,   273,   275,   633,
-     274,   275,   633,    -1,   273,   275,   633,   273,   388,    -1,
-     273,   275,   633,   248,   389,    -1,   273,   275,   633,   270,
-      87,    89,    -1,   273,   275,   633,   270,    67,    89,    -1,
-     273,   275,   633,   270,    87,    88,    -1,   273,    55,   661,
-     387,    -1,   273,    55,   661,   250,   277,   661,    -1,   273,
-      55,   270,   401,   253,   667,    16,   324,   253,   667,    -1,
-     169,   401,   253,   667,    -1,   270,   269,   661,    -1,   169,
-     401,   253,   667,   270,   269,   661,    -1,   390,   661,   270,
-     246,   420,    -1,   390,   661,   270,   107,    -1,   390,   661,
-     270,   173,   107,    -1,   390,   661,   248,   246,    -1,   390,
-     661,   270,    98,     3,    -1,   390,   661,   270,    98,   107,
-      -1,   390,   661,   491,    -1,   225,   661,   491,    -1,   275,
-     661,   491,    -1,   276,    -1,    -1,   351,   400,    -1,   351,
+     280,   252,   260,    -1,    -1,   280,   255,   260,    -1,    -1,
+     107,   368,    -1,   253,   375,   377,   107,   384,   373,    -1,
+     253,   376,   370,   107,   384,   373,    -1,    -1,   252,   260,
+     108,    -1,    -1,   255,   260,   108,    -1,   378,    -1,   381,
+     259,   380,    -1,   379,    -1,   379,   337,   379,    -1,   308,
+     107,    -1,   308,   256,    -1,   273,   633,    -1,   633,    -1,
+     487,    -1,   173,   264,    -1,   173,    -1,   382,    -1,   383,
+      -1,   382,   337,   383,    -1,    66,    -1,    63,    -1,    64,
+     441,    -1,    65,   441,    -1,   266,   441,    -1,   243,    -1,
+     385,    -1,   384,   337,   385,    -1,   265,    -1,   659,    -1,
+     271,   273,   633,   272,   390,   410,    -1,   271,   273,   633,
+     272,   273,   633,    -1,   271,   273,   633,   271,   388,    -1,
+     271,   273,   633,   246,   389,    -1,   271,   273,   633,   268,
+      86,    88,    -1,   271,   273,   633,   268,    66,    88,    -1,
+     271,   273,   633,   268,    86,    87,    -1,   271,    54,   661,
+     387,    -1,   271,    54,   661,   248,   275,   661,    -1,   271,
+      54,   268,   401,   251,   667,    15,   323,   251,   667,    -1,
+     280,   401,   251,   667,    -1,   268,   267,   661,    -1,   280,
+     401,   251,   667,   268,   267,   661,    -1,   390,   661,   268,
+     244,   420,    -1,   390,   661,   268,   106,    -1,   390,   661,
+     268,   171,   106,    -1,   390,   661,   246,   244,    -1,   390,
+     661,   268,    97,     3,    -1,   390,   661,   268,    97,   106,
+      -1,   390,   661,   491,    -1,   223,   661,   491,    -1,   273,
+     661,   491,    -1,   274,    -1,    -1,   351,   400,    -1,   351,
      403,    -1,   351,   437,    -1,   443,    -1,   445,    -1,   398,
-      -1,   392,    -1,   474,    -1,   351,   112,   633,   393,    -1,
-     352,   112,   633,    -1,   273,   112,   633,   394,    -1,   395,
-      -1,   393,   395,    -1,   396,    -1,   394,   396,    -1,   316,
-     652,    -1,    85,   169,   649,    -1,   397,    -1,   316,   652,
-      -1,   114,    -1,   114,   169,   649,    -1,   114,   169,   584,
-      -1,   397,    -1,   113,   102,   647,    -1,   116,   647,    -1,
-     119,    -1,   115,   647,    -1,   118,    -1,   123,   647,    -1,
-     117,    -1,   120,    -1,   351,   399,   315,   661,   261,   633,
-     170,   435,   171,    -1,   278,    -1,    -1,   256,   661,   367,
-      -1,    55,   661,   169,   401,   253,   667,   233,   667,   269,
-     661,    -1,    -1,   252,    -1,   251,    -1,    -1,    98,   661,
-       3,    -1,   275,   633,   406,   402,    -1,   217,   275,   633,
-     406,    -1,   218,   275,   633,   406,    -1,   220,   275,   633,
-     406,    -1,   219,   275,   633,   406,   261,     3,    -1,   404,
-     275,   633,   406,   405,    -1,   216,    -1,   215,    -1,    58,
-     216,    -1,    58,   215,    -1,    17,   216,    -1,    17,   215,
-      -1,    -1,   261,    76,    64,    84,    -1,   261,    76,    83,
-      84,    -1,   261,    76,   248,    -1,   170,   409,   171,    -1,
-     407,    -1,   441,   316,   438,   408,    -1,    -1,   169,    82,
-     168,    -1,   169,   168,    -1,   411,    -1,   409,   337,   411,
+      -1,   392,    -1,   474,    -1,   351,   111,   633,   393,    -1,
+     352,   111,   633,    -1,   271,   111,   633,   394,    -1,   395,
+      -1,   393,   395,    -1,   396,    -1,   394,   396,    -1,   315,
+     652,    -1,    84,   280,   649,    -1,   397,    -1,   315,   652,
+      -1,   113,    -1,   113,   280,   649,    -1,   113,   280,   584,
+      -1,   397,    -1,   112,   101,   647,    -1,   115,   647,    -1,
+     118,    -1,   114,   647,    -1,   117,    -1,   122,   647,    -1,
+     116,    -1,   119,    -1,   351,   399,   314,   661,   259,   633,
+     168,   435,   169,    -1,   276,    -1,    -1,   254,   661,   367,
+      -1,    54,   661,   280,   401,   251,   667,   231,   667,   267,
+     661,    -1,    -1,   250,    -1,   249,    -1,    -1,    97,   661,
+       3,    -1,   273,   633,   406,   402,    -1,   215,   273,   633,
+     406,    -1,   216,   273,   633,   406,    -1,   218,   273,   633,
+     406,    -1,   217,   273,   633,   406,   259,     3,    -1,   404,
+     273,   633,   406,   405,    -1,   214,    -1,   213,    -1,    57,
+     214,    -1,    57,   213,    -1,    16,   214,    -1,    16,   213,
+      -1,    -1,   259,    75,    63,    83,    -1,   259,    75,    82,
+      83,    -1,   259,    75,   246,    -1,   168,   409,   169,    -1,
+     407,    -1,   441,   315,   438,   408,    -1,    -1,   280,    81,
+     167,    -1,   280,   167,    -1,   411,    -1,   409,   337,   411,
       -1,   413,    -1,   424,    -1,   410,    -1,   416,    -1,   436,
-      -1,   127,    -1,   128,    -1,   658,   652,   414,    -1,   658,
+      -1,   126,    -1,   127,    -1,   658,   652,   414,    -1,   658,
      412,    -1,    -1,   415,    -1,   418,    -1,   415,   418,    -1,
-     661,   169,   263,   170,   417,   171,    -1,   418,    -1,   417,
-     337,   418,    -1,   419,    -1,   421,    -1,   422,    -1,   246,
-     420,    -1,   585,    -1,   425,   432,    -1,   124,   125,   316,
-     126,   423,    -1,   129,    -1,    -1,   170,   393,   171,    -1,
-     425,   433,    -1,    -1,   225,   661,    -1,    82,    41,    -1,
-      42,    -1,    43,    -1,   270,   107,    -1,   270,   246,    -1,
-     261,    65,   426,    -1,   261,    64,   426,    -1,    -1,   427,
+     661,   280,   261,   168,   417,   169,    -1,   418,    -1,   417,
+     337,   418,    -1,   419,    -1,   421,    -1,   422,    -1,   244,
+     420,    -1,   585,    -1,   425,   432,    -1,   123,   124,   315,
+     125,   423,    -1,   128,    -1,    -1,   168,   393,   169,    -1,
+     425,   433,    -1,    -1,   223,   661,    -1,    81,    40,    -1,
+      41,    -1,    42,    -1,   268,   106,    -1,   268,   244,    -1,
+     259,    64,   426,    -1,   259,    63,   426,    -1,    -1,   427,
       -1,   428,    -1,   428,   427,    -1,   427,   428,    -1,    -1,
-      70,    -1,    39,    -1,    40,    -1,    -1,   110,   430,    -1,
-     173,   107,    -1,   107,    -1,   278,    -1,   265,   260,    -1,
-     268,   633,   441,   431,   429,    -1,   434,    -1,   278,   442,
-      -1,   265,   260,   442,    -1,   249,   260,   442,   268,   633,
-     441,   431,   429,    -1,   224,   170,   559,   171,    -1,   661,
-      -1,   435,   337,   661,    -1,   179,   633,    -1,   280,   633,
-     441,   316,   438,   440,    -1,   439,    -1,   170,   438,   171,
-      -1,   542,    -1,   536,    -1,    -1,   169,   224,   262,    -1,
-      -1,   442,    -1,   170,   435,   171,    -1,   351,   227,   633,
-     232,   233,   661,    -1,   661,   338,   661,    -1,   351,   229,
-     633,   170,   472,   171,   231,   471,   232,   233,   444,    -1,
-     351,   229,   633,   170,   472,   171,   231,   471,   446,    -1,
-     351,   229,   633,   170,   472,   171,   231,   471,   236,     5,
-       4,    -1,   351,   162,   229,   633,   170,   472,   171,   232,
-     233,   444,    -1,   351,   230,   633,   170,   472,   171,   231,
-     471,   232,   233,   444,    -1,   351,   230,   633,   170,   472,
-     171,   231,   471,   236,     5,     4,    -1,   351,   228,   633,
-     170,   472,   171,   232,   233,   444,    -1,   351,   228,   633,
-     170,   472,   171,   446,    -1,   449,    -1,   307,   447,   449,
-     130,   308,    -1,   307,   306,   447,   449,   130,   308,    -1,
-      -1,   447,   449,   130,    -1,    -1,   448,   450,   130,    -1,
+      69,    -1,    38,    -1,    39,    -1,    -1,   109,   430,    -1,
+     171,   106,    -1,   106,    -1,   276,    -1,   263,   258,    -1,
+     266,   633,   441,   431,   429,    -1,   434,    -1,   276,   442,
+      -1,   263,   258,   442,    -1,   247,   258,   442,   266,   633,
+     441,   431,   429,    -1,   222,   168,   559,   169,    -1,   661,
+      -1,   435,   337,   661,    -1,   180,   633,    -1,   278,   633,
+     441,   315,   438,   440,    -1,   439,    -1,   168,   438,   169,
+      -1,   542,    -1,   536,    -1,    -1,   280,   222,   260,    -1,
+      -1,   442,    -1,   168,   435,   169,    -1,   351,   225,   633,
+     230,   231,   661,    -1,   661,   338,   661,    -1,   351,   227,
+     633,   168,   472,   169,   229,   471,   230,   231,   444,    -1,
+     351,   227,   633,   168,   472,   169,   229,   471,   446,    -1,
+     351,   227,   633,   168,   472,   169,   229,   471,   234,     4,
+     336,    -1,   351,   161,   227,   633,   168,   472,   169,   230,
+     231,   444,    -1,   351,   228,   633,   168,   472,   169,   229,
+     471,   230,   231,   444,    -1,   351,   228,   633,   168,   472,
+     169,   229,   471,   234,     4,   336,    -1,   351,   226,   633,
+     168,   472,   169,   230,   231,   444,    -1,   351,   226,   633,
+     168,   472,   169,   446,    -1,   449,    -1,   306,   447,   449,
+     129,   307,    -1,   306,   305,   447,   449,   129,   307,    -1,
+      -1,   447,   449,   129,    -1,    -1,   448,   450,   129,    -1,
      493,    -1,   492,    -1,   360,    -1,   369,    -1,   374,    -1,
      391,    -1,   488,    -1,   386,    -1,   357,    -1,   359,    -1,
      451,    -1,   541,    -1,   493,    -1,   492,    -1,   369,    -1,
      374,    -1,   357,    -1,   359,    -1,   451,    -1,   541,    -1,
      453,    -1,   452,    -1,   467,    -1,   465,    -1,   459,    -1,
-     457,    -1,   235,   454,    -1,   235,   604,    -1,   455,   170,
-     456,   171,    -1,   633,    -1,    -1,   586,    -1,   456,   337,
-     586,    -1,   272,   458,    -1,   439,    -1,   559,    -1,   275,
-     170,   439,   171,    -1,   296,   586,   461,   464,   308,   296,
-      -1,   296,   463,   464,   308,   296,    -1,   297,   586,   298,
-     447,    -1,   460,    -1,   461,   460,    -1,   297,   559,   298,
-     447,    -1,   462,    -1,   463,   462,    -1,    -1,   299,   447,
-      -1,   302,   559,   298,   447,   466,   308,   302,    -1,    -1,
-     299,   447,    -1,   303,   559,   298,   447,   466,    -1,   468,
-     304,   559,   305,   447,   308,   304,   469,    -1,    -1,   661,
+     457,    -1,   233,   454,    -1,   233,   604,    -1,   455,   168,
+     456,   169,    -1,   633,    -1,    -1,   586,    -1,   456,   337,
+     586,    -1,   270,   458,    -1,   439,    -1,   559,    -1,   273,
+     168,   439,   169,    -1,   295,   586,   461,   464,   307,   295,
+      -1,   295,   463,   464,   307,   295,    -1,   296,   586,   297,
+     447,    -1,   460,    -1,   461,   460,    -1,   296,   559,   297,
+     447,    -1,   462,    -1,   463,   462,    -1,    -1,   298,   447,
+      -1,   301,   559,   297,   447,   466,   307,   301,    -1,    -1,
+     298,   447,    -1,   302,   559,   297,   447,   466,    -1,   468,
+     303,   559,   304,   447,   307,   303,   469,    -1,    -1,   661,
      339,    -1,    -1,   661,    -1,   658,   652,    -1,   470,   337,
-     658,   652,    -1,   275,   170,   470,   171,    -1,   652,    -1,
-     473,    -1,   203,    -1,    -1,   473,   337,   661,   652,    -1,
-     661,   652,    -1,   351,   317,   633,   475,   476,   261,   661,
-     477,   482,    -1,   319,    -1,   320,    -1,    67,    -1,    64,
-      -1,    65,    -1,    65,   318,   435,    -1,    -1,   326,   478,
-      -1,   479,    -1,   478,   479,    -1,   324,   481,   480,   661,
-      -1,   323,   481,   480,   661,    -1,   324,   275,   480,   661,
-      -1,   323,   275,   480,   661,    -1,    -1,   316,    -1,    -1,
-     321,    -1,   483,   485,   486,    -1,    -1,   109,   325,   484,
-      -1,   321,    -1,   322,    -1,    -1,   297,   559,    -1,   450,
-      -1,   307,   306,   448,   308,    -1,   229,   633,   489,    -1,
-     162,   229,   633,   489,    -1,   230,   633,   489,    -1,   228,
-     633,   489,    -1,   352,   275,   633,   491,    -1,   352,   487,
-     491,    -1,   352,   186,   229,   633,   491,    -1,   352,   186,
-     162,   229,   633,   491,    -1,   352,   186,   230,   633,   491,
-      -1,   352,   186,   228,   633,   491,    -1,   352,   280,   633,
-     491,    -1,   352,   227,   633,   491,    -1,   352,   256,   661,
-      -1,   352,    55,   661,    -1,   352,   315,   633,    -1,   352,
-     317,   633,    -1,    -1,   170,   490,   171,    -1,   170,   171,
-      -1,   652,    -1,   652,   337,   490,    -1,    -1,    43,    -1,
-      42,    -1,   493,    -1,   492,    -1,   517,    -1,   519,    -1,
-     518,    -1,   502,    -1,   494,    -1,    76,   499,   500,    -1,
-      78,   661,    -1,    79,    78,   661,    -1,    77,   499,   500,
-     501,    -1,    85,    86,   495,    -1,   270,    58,    86,   495,
-      -1,   270,    86,   495,    -1,    -1,   496,    -1,   497,    -1,
-     496,   337,   497,    -1,    87,    89,    -1,    87,    88,    -1,
-      90,    91,   498,    -1,    96,    97,   666,    -1,    87,    92,
-      -1,    87,    93,    -1,    94,    87,    -1,    95,    -1,    80,
-      -1,    -1,   187,    81,    -1,   187,    82,    81,    -1,    -1,
-      -1,   277,    78,   661,    -1,   309,   510,   258,   633,   441,
-     108,   515,   505,   508,   511,   512,   513,   514,   503,    -1,
-     309,   510,   258,   633,   441,   108,   312,   505,   508,   511,
-     512,   513,   514,    -1,   309,   510,    27,   258,   633,   108,
-     515,   514,    -1,   309,   438,   258,   667,   508,   511,    -1,
-     309,   438,   258,   313,   508,   511,    -1,    -1,   314,   170,
-     504,   171,    -1,   649,    -1,   504,   337,   649,    -1,    -1,
-     170,   506,   171,    -1,   507,    -1,   506,   337,   507,    -1,
-     661,    -1,   661,     3,    -1,    -1,   509,   311,   667,    -1,
-     509,   311,   667,   337,   667,    -1,   509,   311,   667,   337,
-     667,   337,   667,    -1,    -1,    16,    -1,    -1,   649,   310,
-      -1,   294,   649,    -1,   649,   294,   649,   310,    -1,   649,
-     310,   294,   649,    -1,    -1,   107,   480,   667,    -1,    -1,
-      59,    -1,    -1,    60,    61,    -1,    -1,    82,   225,    -1,
-     516,    -1,   170,   516,   171,    -1,   667,    -1,   516,   337,
-     667,    -1,    64,   108,   633,   531,    -1,    65,   633,   270,
-     529,   531,    -1,    67,   258,   633,   520,    -1,    67,   258,
-     633,   442,   520,    -1,    -1,   246,   279,    -1,   279,   521,
-      -1,   439,    -1,   170,   522,   171,    -1,   521,   337,   170,
-     522,   171,    -1,   526,    -1,   522,   337,   526,    -1,   527,
-      -1,   523,   337,   527,    -1,   107,    -1,   586,    -1,   525,
-      -1,   525,    -1,   545,    -1,    -1,   186,    -1,   247,    -1,
-     530,    -1,   529,   337,   530,    -1,   658,   174,   559,    -1,
-     442,   174,   584,    -1,    -1,   281,   559,    -1,   170,   532,
-     171,    -1,   553,    73,    74,   553,    -1,   553,   163,   553,
-     535,    -1,   553,    74,   553,   535,    -1,   553,    72,    74,
-     553,    -1,   553,   533,    74,   553,   535,    -1,   553,    72,
-     533,    74,   553,    -1,    75,    -1,   534,    71,    -1,   534,
-      -1,    68,    -1,    69,    -1,    70,    -1,   261,   559,    -1,
-      16,   442,    -1,   536,    -1,   169,   537,   539,    -1,   537,
-     337,   538,    -1,   538,    -1,   661,   441,   316,   170,   539,
-     171,    -1,   542,    -1,   541,    -1,   542,    -1,    66,   528,
-     548,   549,    -1,    66,   528,   548,   258,   543,   549,    -1,
-     545,   561,   562,   563,   564,    -1,   544,    -1,   543,   337,
-     544,    -1,   661,    -1,   545,   167,   546,   547,   545,    -1,
-     545,   166,   546,   547,   545,    -1,   545,   165,   546,   547,
-     545,    -1,   170,   545,   171,    -1,   540,    -1,    -1,   186,
-      -1,   247,    -1,    -1,   164,    -1,   164,   102,   170,   557,
-     171,    -1,   610,    -1,   550,   531,   556,   558,    -1,    -1,
-     108,   551,    -1,   553,    -1,   551,   337,   553,    -1,   633,
-      -1,   633,   555,    -1,   604,   555,    -1,   604,    -1,   552,
-      -1,   584,   555,    -1,   584,    -1,   532,    -1,    -1,   340,
-     554,   545,   341,   555,    -1,   316,   661,   170,   663,   171,
-      -1,   316,   661,    -1,   661,   170,   663,   171,    -1,   661,
-      -1,    -1,   106,   102,   557,    -1,   634,    -1,   557,   337,
-     634,    -1,    -1,   105,   559,    -1,   560,   176,   559,    -1,
-     560,    -1,   569,   187,   560,    -1,   569,    -1,    -1,   101,
-     102,   565,    -1,    -1,   293,   648,    -1,   293,   588,    -1,
-      -1,   294,   650,    -1,   294,   588,    -1,    -1,   295,   650,
-      -1,   295,    14,    -1,   295,   588,    -1,   566,    -1,   565,
-     337,   566,    -1,   586,   567,    -1,    -1,   221,    -1,   222,
-      -1,   570,    -1,   571,    -1,   573,    -1,   575,    -1,   576,
-      -1,   578,    -1,   580,    -1,   583,    -1,   586,    -1,   173,
-     569,    -1,   568,    -1,   569,   188,   569,    -1,   569,   174,
-     569,    -1,   569,   184,   572,   569,   187,   569,    -1,   569,
-     183,   572,   569,   187,   569,    -1,    -1,    99,    -1,   100,
-      -1,   569,   180,   574,    -1,   569,   178,   574,    -1,   569,
-     179,   574,    -1,   569,   177,   574,    -1,   586,    -1,   586,
-     104,   667,    -1,   586,   259,   173,   107,    -1,   586,   259,
-     107,    -1,   569,   182,   170,   523,   171,    -1,   569,   181,
-     170,   523,   171,    -1,   170,   577,   171,   182,   170,   523,
-     171,    -1,   170,   577,   171,   181,   170,   523,   171,    -1,
-     569,    -1,   577,   337,   569,    -1,   569,   188,   579,   584,
-      -1,   185,    -1,   175,    -1,   186,    -1,   103,   584,    -1,
-     569,    -1,   581,   337,   569,    -1,   340,   581,   341,    -1,
-     582,   633,   582,    -1,   170,   545,   171,    -1,   170,   279,
-     521,   171,    -1,   170,   536,   171,    -1,   587,    -1,   586,
-     189,   586,    -1,   586,   190,   586,    -1,   586,   203,   586,
-      -1,   586,   204,   586,    -1,   586,   205,   586,    -1,   586,
-     193,   586,    -1,   586,   191,   586,    -1,   586,   210,   586,
-      -1,   586,   207,   586,    -1,   586,   214,   586,    -1,   586,
-     208,   586,    -1,   586,   213,   586,    -1,   586,   209,   586,
-      -1,   586,   212,   586,    -1,   586,   211,   586,    -1,   586,
-     131,   586,    -1,   586,   192,   586,    -1,   586,   206,   586,
-      -1,   586,   206,   174,   586,    -1,   206,   586,    -1,   586,
-     201,   586,    -1,   586,   200,   586,    -1,   586,   199,   586,
-      -1,   586,   198,   586,    -1,   189,   586,    -1,   190,   586,
-      -1,   170,   559,   171,    -1,   585,    -1,   584,    -1,   613,
-      -1,   630,    -1,    62,    -1,   589,    -1,   634,    -1,   603,
-      -1,   617,    -1,   604,    -1,   121,   122,   109,   633,    -1,
-     607,    -1,   609,    -1,   637,    -1,   635,    -1,   676,    -1,
-     588,    -1,   524,    -1,   342,    -1,   590,   327,   170,   591,
-     171,    -1,   614,   170,   171,    -1,   617,    -1,   592,   593,
-     594,    -1,    -1,   328,   102,   557,    -1,    -1,   101,   102,
-     565,    -1,    -1,   595,   596,   602,    -1,    84,    -1,   335,
-      -1,   597,    -1,   599,    -1,   336,   332,    -1,   598,    -1,
-     329,   321,    -1,   587,   332,    -1,   183,   597,   187,   600,
-      -1,   336,   331,    -1,   601,    -1,   329,   321,    -1,   587,
-     332,    -1,    -1,   330,   329,   321,    -1,   330,   106,    -1,
-     330,   334,    -1,   330,    82,   333,    -1,   131,   661,    -1,
-     605,   170,   171,    -1,   605,   170,   638,   171,    -1,   606,
-      -1,   661,   338,   606,    -1,   661,    -1,    68,    -1,    69,
-      -1,    67,    -1,   111,   170,   624,   108,   586,   171,    -1,
-      46,   608,    -1,    48,   608,    -1,    47,   608,    -1,    50,
-     608,    -1,    49,   608,    -1,    -1,   170,   171,    -1,   196,
-     170,   586,   108,   586,   109,   586,   171,    -1,   196,   170,
-     586,   337,   586,   337,   586,   171,    -1,   196,   170,   586,
-     108,   586,   171,    -1,   196,   170,   586,   337,   586,   171,
-      -1,   195,   170,   586,   181,   586,   171,    -1,   586,   197,
-     586,    -1,   194,   170,   586,   337,   586,   337,   586,   171,
-      -1,   611,    -1,   610,   337,   611,    -1,   203,    -1,   661,
-     338,   203,    -1,   604,   338,   203,    -1,   559,   612,    -1,
-      -1,   316,   661,    -1,   631,    -1,    10,    -1,   661,   338,
-      10,    -1,     8,    -1,   661,   338,     8,    -1,     9,    -1,
-     661,   338,     9,    -1,   615,   170,   203,   171,    -1,   615,
-     170,   661,   338,   203,   171,    -1,   615,   170,   247,   645,
-     171,    -1,   615,   170,   186,   645,   171,    -1,   615,   170,
-     645,   171,    -1,   616,   170,   645,   337,   645,   171,    -1,
-     747,    -1,   189,    -1,   190,    -1,    -1,   169,   283,   292,
-      -1,    -1,   170,   666,   171,    -1,    -1,   170,   666,   171,
-      -1,    -1,   282,    -1,   283,   620,   619,    -1,   284,   621,
-     619,    -1,   286,    -1,   287,    -1,   288,    -1,   289,    -1,
-     290,    -1,   623,    -1,   291,    -1,   623,   620,    -1,   623,
-      -1,   291,   621,    -1,   623,   620,    -1,   291,   621,    -1,
-     625,   277,   626,    -1,   627,    -1,   285,   628,    -1,    55,
-      -1,    57,    -1,    56,    -1,   667,    -1,    13,    -1,    12,
-      -1,    11,    -1,    14,    -1,    15,    -1,   282,   667,    -1,
-     283,   620,   619,   667,    -1,   284,   621,   619,   667,    -1,
-     632,    -1,   657,   667,    -1,     6,   667,    -1,   654,   667,
-      -1,     5,   667,    -1,    44,    -1,    45,    -1,   285,   618,
-     667,   628,    -1,   661,    -1,   661,   338,   661,    -1,   661,
-     338,   661,   338,   661,    -1,   661,    -1,   661,   338,   661,
-      -1,   661,   338,   661,   338,   661,    -1,    18,   170,   636,
-     316,   652,   171,    -1,    19,   170,   636,   337,   652,   171,
-      -1,   559,    -1,   300,   170,   586,   337,   586,   171,    -1,
-     301,   170,   639,   171,    -1,   296,   586,   641,   644,   308,
-      -1,   296,   643,   644,   308,    -1,   525,    -1,   638,   337,
-     525,    -1,   525,   337,   525,    -1,   639,   337,   525,    -1,
-     297,   586,   298,   525,    -1,   640,    -1,   641,   640,    -1,
-     297,   559,   298,   525,    -1,   642,    -1,   643,   642,    -1,
-      -1,   299,   586,    -1,   586,    -1,   666,    -1,   665,    -1,
-     664,    -1,   665,    -1,   664,    -1,   666,    -1,    20,    -1,
-     655,    -1,   656,    -1,    20,   170,   646,   171,    -1,   655,
-     170,   646,   171,    -1,   656,   170,   646,   171,    -1,   657,
-      -1,   657,   170,   646,   171,    -1,    31,    -1,    32,    -1,
-      35,    -1,    33,    -1,    34,    -1,    29,    -1,    29,   170,
-     646,   171,    -1,    29,   170,   646,   337,   651,   171,    -1,
-      30,    -1,    30,   170,   646,   171,    -1,    30,   170,   666,
-     337,   666,   171,    -1,    36,    -1,    36,    38,    -1,    37,
-      -1,   622,    -1,   629,    -1,     6,    -1,     6,   170,   646,
-     171,    -1,   654,    -1,   654,   170,   646,   171,    -1,   654,
-     170,   666,   337,   666,   171,    -1,     5,    -1,     5,   170,
-     646,   171,    -1,    52,    -1,    52,   170,   653,   171,    -1,
-      52,   170,   653,   337,   666,   171,    -1,    54,    -1,    53,
-      -1,    53,    -1,   667,    -1,     7,    -1,    24,    -1,    20,
-      21,    -1,    25,    -1,    26,    -1,    20,    22,    23,    -1,
-      28,    -1,    27,    22,    23,    -1,   661,    -1,   660,    -1,
-       5,    -1,     6,    -1,     7,    -1,     8,    -1,     9,    -1,
-      10,    -1,     5,    -1,     6,    -1,   172,    -1,     7,    -1,
-       8,    -1,     9,    -1,    10,    -1,   662,    -1,    22,    -1,
-     233,    -1,    23,    -1,   253,    -1,   264,    -1,    38,    -1,
-     266,    -1,   256,    -1,    97,    -1,   227,    -1,    79,    -1,
-     122,    -1,   292,    -1,    41,    -1,   316,    -1,   223,    -1,
-     276,    -1,   117,    -1,   247,    -1,   113,    -1,   115,    -1,
-     116,    -1,   240,    -1,   269,    -1,    85,    -1,   322,    -1,
-     275,    -1,   123,    -1,   168,    -1,    96,    -1,   110,    -1,
-     263,    -1,   321,    -1,   260,    -1,   236,    -1,    91,    -1,
-      63,    -1,   282,    -1,   283,    -1,   284,    -1,   285,    -1,
-     244,    -1,   245,    -1,   239,    -1,   243,    -1,   241,    -1,
-     242,    -1,    26,    -1,   271,    -1,    82,    -1,   139,    -1,
-     140,    -1,   143,    -1,   145,    -1,   146,    -1,   147,    -1,
-     148,    -1,   149,    -1,   150,    -1,   151,    -1,   153,    -1,
-     155,    -1,   156,    -1,   157,    -1,   158,    -1,   160,    -1,
-     162,    -1,   216,    -1,   215,    -1,   237,    -1,   238,    -1,
-      98,    -1,    52,    -1,   661,    -1,   663,   337,   661,    -1,
-     665,    -1,    11,    -1,    11,    -1,     5,    -1,     3,    -1,
-       3,   667,    -1,   245,   669,    -1,   666,   170,   171,    -1,
-     666,   170,   523,   171,    -1,    -1,   671,    -1,   264,   672,
-      -1,   663,    -1,   675,    -1,   673,    -1,   674,   337,   673,
-      -1,   586,    -1,   677,    -1,   678,    -1,   679,    -1,   680,
-      -1,   694,    -1,   701,    -1,   703,    -1,   706,    -1,   716,
-      -1,   717,    -1,   132,   170,   587,   720,   171,    -1,   133,
-     170,   674,   720,   171,    -1,   134,   170,   673,   720,   171,
-      -1,   135,   170,   233,   682,   681,   720,   171,    -1,    -1,
-     337,   721,    -1,   337,   721,   337,   683,    -1,   337,   721,
-     337,   683,   337,   689,    -1,   337,   721,   337,   689,    -1,
-     337,   683,    -1,   337,   683,   337,   689,    -1,   337,   689,
-      -1,   661,    -1,   136,   170,   684,   171,    -1,   685,    -1,
-     684,   337,   685,    -1,   687,   686,    -1,    -1,   316,   688,
-      -1,   586,    -1,   661,    -1,   690,   692,    -1,   691,    -1,
-     690,   337,   691,    -1,   586,    -1,    -1,   262,   693,    -1,
-     107,   261,   107,    -1,   148,   261,   107,    -1,   147,   261,
-     107,    -1,   145,   261,   107,    -1,   145,   261,    82,   151,
-      -1,   137,   170,   695,   696,   692,   720,   171,    -1,    -1,
-     721,   337,    -1,   697,    -1,   696,   337,   697,    -1,   698,
-     699,    -1,   586,    -1,    -1,   316,   700,    -1,   661,    -1,
-     138,   170,   719,   587,   702,   171,    -1,    83,   140,    -1,
-     139,   140,    -1,   141,   170,   233,   704,   705,   720,   171,
-      -1,   661,    -1,    -1,   337,   587,    -1,   142,   170,   707,
-     708,   720,   714,   715,   171,    -1,     3,    -1,    -1,   143,
-     709,   710,    -1,   729,    -1,   711,    -1,   710,   337,   711,
-      -1,   712,    -1,   713,    -1,   587,   728,    -1,   587,   316,
-     661,   728,    -1,    -1,   729,    -1,   107,   261,   148,    -1,
-     148,   261,   148,    -1,   144,   170,   587,   720,   171,    -1,
-     154,   170,   718,   673,   730,   171,    -1,   719,    -1,   112,
-      -1,   149,    -1,   151,    -1,    -1,   155,   151,    -1,   155,
-     112,    -1,   152,   170,   722,   171,    -1,   723,    -1,   722,
-     337,   723,    -1,   726,    -1,   727,    -1,   661,    -1,   586,
-      -1,   725,   316,   724,    -1,   246,   725,    -1,    82,   246,
-      -1,    -1,   729,    -1,   102,   146,    -1,   102,   122,    -1,
-      -1,   731,    -1,   158,   277,   159,   732,   740,    -1,   733,
-      -1,   738,    -1,   160,   734,   736,    -1,    82,   153,   736,
-      -1,   735,    -1,     3,    -1,    -1,   156,   737,    -1,   735,
-      -1,   157,   739,    -1,   661,    -1,    -1,   741,    -1,   743,
-      -1,   744,   742,    -1,    -1,   743,    -1,   150,   746,    -1,
-      82,   153,    -1,   153,   745,    -1,   735,    -1,   661,    -1,
-     161,   170,   673,   561,   720,   171,    -1
+     658,   652,    -1,   273,   168,   470,   169,    -1,   652,    -1,
+     473,    -1,   201,    -1,    -1,   473,   337,   661,   652,    -1,
+     661,   652,    -1,   351,   316,   633,   475,   476,   259,   661,
+     477,   482,    -1,   318,    -1,   319,    -1,    66,    -1,    63,
+      -1,    64,    -1,    64,   317,   435,    -1,    -1,   325,   478,
+      -1,   479,    -1,   478,   479,    -1,   323,   481,   480,   661,
+      -1,   322,   481,   480,   661,    -1,   323,   273,   480,   661,
+      -1,   322,   273,   480,   661,    -1,    -1,   315,    -1,    -1,
+     320,    -1,   483,   485,   486,    -1,    -1,   108,   324,   484,
+      -1,   320,    -1,   321,    -1,    -1,   296,   559,    -1,   450,
+      -1,   306,   305,   448,   307,    -1,   227,   633,   489,    -1,
+     161,   227,   633,   489,    -1,   228,   633,   489,    -1,   226,
+     633,   489,    -1,   352,   273,   633,   491,    -1,   352,   487,
+     491,    -1,   352,   173,   227,   633,   491,    -1,   352,   173,
+     161,   227,   633,   491,    -1,   352,   173,   228,   633,   491,
+      -1,   352,   173,   226,   633,   491,    -1,   352,   278,   633,
+     491,    -1,   352,   225,   633,   491,    -1,   352,   254,   661,
+      -1,   352,    54,   661,    -1,   352,   314,   633,    -1,   352,
+     316,   633,    -1,    -1,   168,   490,   169,    -1,   168,   169,
+      -1,   652,    -1,   652,   337,   490,    -1,    -1,    42,    -1,
+      41,    -1,   493,    -1,   492,    -1,   517,    -1,   519,    -1,
+     518,    -1,   502,    -1,   494,    -1,    75,   499,   500,    -1,
+      77,   661,    -1,    78,    77,   661,    -1,    76,   499,   500,
+     501,    -1,    84,    85,   495,    -1,   268,    57,    85,   495,
+      -1,   268,    85,   495,    -1,    -1,   496,    -1,   497,    -1,
+     496,   337,   497,    -1,    86,    88,    -1,    86,    87,    -1,
+      89,    90,   498,    -1,    95,    96,   666,    -1,    86,    91,
+      -1,    86,    92,    -1,    93,    86,    -1,    94,    -1,    79,
+      -1,    -1,   185,    80,    -1,   185,    81,    80,    -1,    -1,
+      -1,   275,    77,   661,    -1,   308,   510,   256,   633,   441,
+     107,   515,   505,   508,   511,   512,   513,   514,   503,    -1,
+     308,   510,   256,   633,   441,   107,   311,   505,   508,   511,
+     512,   513,   514,    -1,   308,   510,    26,   256,   633,   107,
+     515,   514,    -1,   308,   438,   256,   667,   508,   511,    -1,
+     308,   438,   256,   312,   508,   511,    -1,   308,   438,   256,
+      26,   515,    -1,    -1,   313,   168,   504,   169,    -1,   649,
+      -1,   504,   337,   649,    -1,    -1,   168,   506,   169,    -1,
+     507,    -1,   506,   337,   507,    -1,   661,    -1,   661,     3,
+      -1,    -1,   509,   310,   667,    -1,   509,   310,   667,   337,
+     667,    -1,   509,   310,   667,   337,   667,   337,   667,    -1,
+      -1,    15,    -1,    -1,   649,   309,    -1,   293,   649,    -1,
+     649,   293,   649,   309,    -1,   649,   309,   293,   649,    -1,
+      -1,   106,   480,   667,    -1,    -1,    58,    -1,    -1,    59,
+      60,    -1,    -1,    81,   223,    -1,   516,    -1,   168,   516,
+     169,    -1,   667,    -1,   516,   337,   667,    -1,    63,   107,
+     633,   531,    -1,    64,   633,   268,   529,   531,    -1,    66,
+     256,   633,   520,    -1,    66,   256,   633,   442,   520,    -1,
+      -1,   244,   277,    -1,   277,   521,    -1,   439,    -1,   168,
+     522,   169,    -1,   521,   337,   168,   522,   169,    -1,   526,
+      -1,   522,   337,   526,    -1,   527,    -1,   523,   337,   527,
+      -1,   106,    -1,   586,    -1,   525,    -1,   525,    -1,   545,
+      -1,    -1,   173,    -1,   245,    -1,   530,    -1,   529,   337,
+     530,    -1,   658,   172,   559,    -1,   442,   172,   584,    -1,
+      -1,   279,   559,    -1,   168,   532,   169,    -1,   553,    72,
+      73,   553,    -1,   553,   166,   553,   535,    -1,   553,    73,
+     553,   535,    -1,   553,    71,    73,   553,    -1,   553,   533,
+      73,   553,   535,    -1,   553,    71,   533,    73,   553,    -1,
+      74,    -1,   534,    70,    -1,   534,    -1,    67,    -1,    68,
+      -1,    69,    -1,   259,   559,    -1,    15,   442,    -1,   536,
+      -1,   280,   537,   539,    -1,   537,   337,   538,    -1,   538,
+      -1,   661,   441,   315,   168,   539,   169,    -1,   542,    -1,
+     541,    -1,   542,    -1,    65,   528,   548,   549,    -1,    65,
+     528,   548,   256,   543,   549,    -1,   545,   561,   562,   563,
+     564,    -1,   544,    -1,   543,   337,   544,    -1,   661,    -1,
+     545,   162,   546,   547,   545,    -1,   545,   163,   546,   547,
+     545,    -1,   545,   164,   546,   547,   545,    -1,   168,   545,
+     169,    -1,   540,    -1,    -1,   173,    -1,   245,    -1,    -1,
+     165,    -1,   165,   101,   168,   557,   169,    -1,   610,    -1,
+     550,   531,   556,   558,    -1,    -1,   107,   551,    -1,   553,
+      -1,   551,   337,   553,    -1,   633,    -1,   633,   555,    -1,
+     604,   555,    -1,   604,    -1,   552,    -1,   584,   555,    -1,
+     584,    -1,   532,    -1,    -1,   340,   554,   545,   341,   555,
+      -1,   315,   661,   168,   663,   169,    -1,   315,   661,    -1,
+     661,   168,   663,   169,    -1,   661,    -1,    -1,   105,   101,
+     557,    -1,   634,    -1,   557,   337,   634,    -1,    -1,   104,
+     559,    -1,   560,   183,   559,    -1,   560,    -1,   569,   185,
+     560,    -1,   569,    -1,    -1,   100,   101,   565,    -1,    -1,
+     292,   648,    -1,   292,   588,    -1,    -1,   293,   650,    -1,
+     293,   588,    -1,    -1,   294,   650,    -1,   294,    13,    -1,
+     294,   588,    -1,   566,    -1,   565,   337,   566,    -1,   586,
+     567,    -1,    -1,   219,    -1,   220,    -1,   570,    -1,   571,
+      -1,   573,    -1,   575,    -1,   576,    -1,   578,    -1,   580,
+      -1,   583,    -1,   586,    -1,   171,   569,    -1,   568,    -1,
+     569,   186,   569,    -1,   569,   172,   569,    -1,   569,   175,
+     572,   569,   185,   569,    -1,   569,   176,   572,   569,   185,
+     569,    -1,    -1,    98,    -1,    99,    -1,   569,   179,   574,
+      -1,   569,   181,   574,    -1,   569,   180,   574,    -1,   569,
+     182,   574,    -1,   586,    -1,   586,   103,   667,    -1,   586,
+     257,   171,   106,    -1,   586,   257,   106,    -1,   569,   177,
+     168,   523,   169,    -1,   569,   178,   168,   523,   169,    -1,
+     168,   577,   169,   177,   168,   523,   169,    -1,   168,   577,
+     169,   178,   168,   523,   169,    -1,   569,    -1,   577,   337,
+     569,    -1,   569,   186,   579,   584,    -1,   174,    -1,   184,
+      -1,   173,    -1,   102,   584,    -1,   569,    -1,   581,   337,
+     569,    -1,   340,   581,   341,    -1,   582,   633,   582,    -1,
+     168,   545,   169,    -1,   168,   277,   521,   169,    -1,   168,
+     536,   169,    -1,   587,    -1,   586,   187,   586,    -1,   586,
+     188,   586,    -1,   586,   201,   586,    -1,   586,   202,   586,
+      -1,   586,   203,   586,    -1,   586,   191,   586,    -1,   586,
+     189,   586,    -1,   586,   205,   586,    -1,   586,   208,   586,
+      -1,   586,   209,   586,    -1,   586,   207,   586,    -1,   586,
+     210,   586,    -1,   586,   206,   586,    -1,   586,   211,   586,
+      -1,   586,   212,   586,    -1,   586,   130,   586,    -1,   586,
+     190,   586,    -1,   586,   204,   586,    -1,   586,   204,   172,
+     586,    -1,   204,   586,    -1,   586,   192,   586,    -1,   586,
+     193,   586,    -1,   586,   194,   586,    -1,   586,   195,   586,
+      -1,   187,   586,    -1,   188,   586,    -1,   168,   559,   169,
+      -1,   585,    -1,   584,    -1,   613,    -1,   630,    -1,    61,
+      -1,   589,    -1,   634,    -1,   603,    -1,   617,    -1,   604,
+      -1,   120,   121,   108,   633,    -1,   607,    -1,   609,    -1,
+     637,    -1,   635,    -1,   676,    -1,   588,    -1,   524,    -1,
+     342,    -1,   590,   326,   168,   591,   169,    -1,   614,   168,
+     169,    -1,   617,    -1,   592,   593,   594,    -1,    -1,   327,
+     101,   557,    -1,    -1,   100,   101,   565,    -1,    -1,   595,
+     596,   602,    -1,    83,    -1,   334,    -1,   597,    -1,   599,
+      -1,   335,   331,    -1,   598,    -1,   328,   320,    -1,   587,
+     331,    -1,   176,   597,   185,   600,    -1,   335,   330,    -1,
+     601,    -1,   328,   320,    -1,   587,   331,    -1,    -1,   329,
+     328,   320,    -1,   329,   105,    -1,   329,   333,    -1,   329,
+      81,   332,    -1,   130,   661,    -1,   605,   168,   169,    -1,
+     605,   168,   638,   169,    -1,   606,    -1,   661,   338,   606,
+      -1,   661,    -1,    67,    -1,    68,    -1,    66,    -1,   110,
+     168,   624,   107,   586,   169,    -1,    45,   608,    -1,    47,
+     608,    -1,    46,   608,    -1,    49,   608,    -1,    48,   608,
+      -1,    -1,   168,   169,    -1,   197,   168,   586,   107,   586,
+     108,   586,   169,    -1,   197,   168,   586,   337,   586,   337,
+     586,   169,    -1,   197,   168,   586,   107,   586,   169,    -1,
+     197,   168,   586,   337,   586,   169,    -1,   198,   168,   586,
+     178,   586,   169,    -1,   586,   196,   586,    -1,   199,   168,
+     586,   337,   586,   337,   586,   169,    -1,   611,    -1,   610,
+     337,   611,    -1,   201,    -1,   661,   338,   201,    -1,   604,
+     338,   201,    -1,   559,   612,    -1,    -1,   315,   661,    -1,
+     631,    -1,     9,    -1,   661,   338,     9,    -1,     7,    -1,
+     661,   338,     7,    -1,     8,    -1,   661,   338,     8,    -1,
+     615,   168,   201,   169,    -1,   615,   168,   661,   338,   201,
+     169,    -1,   615,   168,   245,   645,   169,    -1,   615,   168,
+     173,   645,   169,    -1,   615,   168,   645,   169,    -1,   616,
+     168,   645,   337,   645,   169,    -1,   747,    -1,   187,    -1,
+     188,    -1,    -1,   280,   282,   291,    -1,    -1,   168,   666,
+     169,    -1,    -1,   168,   666,   169,    -1,    -1,   281,    -1,
+     282,   620,   619,    -1,   283,   621,   619,    -1,   285,    -1,
+     286,    -1,   287,    -1,   288,    -1,   289,    -1,   623,    -1,
+     290,    -1,   623,   620,    -1,   623,    -1,   290,   621,    -1,
+     623,   620,    -1,   290,   621,    -1,   625,   275,   626,    -1,
+     627,    -1,   284,   628,    -1,    54,    -1,    56,    -1,    55,
+      -1,   667,    -1,    12,    -1,    11,    -1,    10,    -1,    13,
+      -1,    14,    -1,   281,   667,    -1,   282,   620,   619,   667,
+      -1,   283,   621,   619,   667,    -1,   632,    -1,   657,   667,
+      -1,     5,   667,    -1,   654,   667,    -1,     4,   667,    -1,
+      43,    -1,    44,    -1,   284,   618,   667,   628,    -1,   661,
+      -1,   661,   338,   661,    -1,   661,   338,   661,   338,   661,
+      -1,   661,    -1,   661,   338,   661,    -1,   661,   338,   661,
+     338,   661,    -1,    17,   168,   636,   315,   652,   169,    -1,
+      18,   168,   636,   337,   652,   169,    -1,   559,    -1,   299,
+     168,   586,   337,   586,   169,    -1,   300,   168,   639,   169,
+      -1,   295,   586,   641,   644,   307,    -1,   295,   643,   644,
+     307,    -1,   525,    -1,   638,   337,   525,    -1,   525,   337,
+     525,    -1,   639,   337,   525,    -1,   296,   586,   297,   525,
+      -1,   640,    -1,   641,   640,    -1,   296,   559,   297,   525,
+      -1,   642,    -1,   643,   642,    -1,    -1,   298,   586,    -1,
+     586,    -1,   666,    -1,   665,    -1,   664,    -1,   665,    -1,
+     664,    -1,   666,    -1,    19,    -1,   655,    -1,   656,    -1,
+      19,   168,   646,   169,    -1,   655,   168,   646,   169,    -1,
+     656,   168,   646,   169,    -1,   657,    -1,   657,   168,   646,
+     169,    -1,    30,    -1,    31,    -1,    34,    -1,    32,    -1,
+      33,    -1,    28,    -1,    28,   168,   646,   169,    -1,    28,
+     168,   646,   337,   651,   169,    -1,    29,    -1,    29,   168,
+     646,   169,    -1,    29,   168,   666,   337,   666,   169,    -1,
+      35,    -1,    35,    37,    -1,    36,    -1,   622,    -1,   629,
+      -1,     5,    -1,     5,   168,   646,   169,    -1,   654,    -1,
+     654,   168,   646,   169,    -1,   654,   168,   666,   337,   666,
+     169,    -1,     4,    -1,     4,   168,   646,   169,    -1,    51,
+      -1,    51,   168,   653,   169,    -1,    51,   168,   653,   337,
+     666,   169,    -1,    53,    -1,    52,    -1,    52,    -1,   667,
+      -1,     6,    -1,    23,    -1,    19,    20,    -1,    24,    -1,
+      25,    -1,    19,    21,    22,    -1,    27,    -1,    26,    21,
+      22,    -1,   661,    -1,   660,    -1,     4,    -1,     5,    -1,
+       6,    -1,     7,    -1,     8,    -1,     9,    -1,     4,    -1,
+       5,    -1,   170,    -1,     6,    -1,     7,    -1,     8,    -1,
+       9,    -1,   662,    -1,    21,    -1,   231,    -1,    22,    -1,
+     251,    -1,   262,    -1,    37,    -1,   264,    -1,   254,    -1,
+      96,    -1,   225,    -1,    78,    -1,   121,    -1,   291,    -1,
+      40,    -1,   315,    -1,   221,    -1,   274,    -1,   116,    -1,
+     245,    -1,   112,    -1,   114,    -1,   115,    -1,   238,    -1,
+     267,    -1,    84,    -1,   321,    -1,   273,    -1,   122,    -1,
+     167,    -1,    95,    -1,   109,    -1,   261,    -1,   320,    -1,
+     258,    -1,   234,    -1,    90,    -1,    62,    -1,   281,    -1,
+     282,    -1,   283,    -1,   284,    -1,   242,    -1,   243,    -1,
+     237,    -1,   241,    -1,   239,    -1,   240,    -1,    25,    -1,
+     269,    -1,    81,    -1,   138,    -1,   139,    -1,   142,    -1,
+     144,    -1,   145,    -1,   146,    -1,   147,    -1,   148,    -1,
+     149,    -1,   150,    -1,   152,    -1,   154,    -1,   155,    -1,
+     156,    -1,   157,    -1,   159,    -1,   161,    -1,   214,    -1,
+     213,    -1,   235,    -1,   236,    -1,    97,    -1,    51,    -1,
+     661,    -1,   663,   337,   661,    -1,   665,    -1,    10,    -1,
+      10,    -1,     4,    -1,     3,    -1,     3,   667,    -1,   243,
+     669,    -1,   666,   168,   169,    -1,   666,   168,   523,   169,
+      -1,    -1,   671,    -1,   262,   672,    -1,   663,    -1,   675,
+      -1,   673,    -1,   674,   337,   673,    -1,   586,    -1,   677,
+      -1,   678,    -1,   679,    -1,   680,    -1,   694,    -1,   701,
+      -1,   703,    -1,   706,    -1,   716,    -1,   717,    -1,   131,
+     168,   587,   720,   169,    -1,   132,   168,   674,   720,   169,
+      -1,   133,   168,   673,   720,   169,    -1,   134,   168,   231,
+     682,   681,   720,   169,    -1,    -1,   337,   721,    -1,   337,
+     721,   337,   683,    -1,   337,   721,   337,   683,   337,   689,
+      -1,   337,   721,   337,   689,    -1,   337,   683,    -1,   337,
+     683,   337,   689,    -1,   337,   689,    -1,   661,    -1,   135,
+     168,   684,   169,    -1,   685,    -1,   684,   337,   685,    -1,
+     687,   686,    -1,    -1,   315,   688,    -1,   586,    -1,   661,
+      -1,   690,   692,    -1,   691,    -1,   690,   337,   691,    -1,
+     586,    -1,    -1,   260,   693,    -1,   106,   259,   106,    -1,
+     147,   259,   106,    -1,   146,   259,   106,    -1,   144,   259,
+     106,    -1,   144,   259,    81,   150,    -1,   136,   168,   695,
+     696,   692,   720,   169,    -1,    -1,   721,   337,    -1,   697,
+      -1,   696,   337,   697,    -1,   698,   699,    -1,   586,    -1,
+      -1,   315,   700,    -1,   661,    -1,   137,   168,   719,   587,
+     702,   169,    -1,    82,   139,    -1,   138,   139,    -1,   140,
+     168,   231,   704,   705,   720,   169,    -1,   661,    -1,    -1,
+     337,   587,    -1,   141,   168,   707,   708,   720,   714,   715,
+     169,    -1,     3,    -1,    -1,   142,   709,   710,    -1,   729,
+      -1,   711,    -1,   710,   337,   711,    -1,   712,    -1,   713,
+      -1,   587,   728,    -1,   587,   315,   661,   728,    -1,    -1,
+     729,    -1,   106,   259,   147,    -1,   147,   259,   147,    -1,
+     143,   168,   587,   720,   169,    -1,   153,   168,   718,   673,
+     730,   169,    -1,   719,    -1,   111,    -1,   148,    -1,   150,
+      -1,    -1,   154,   150,    -1,   154,   111,    -1,   151,   168,
+     722,   169,    -1,   723,    -1,   722,   337,   723,    -1,   726,
+      -1,   727,    -1,   661,    -1,   586,    -1,   725,   315,   724,
+      -1,   244,   725,    -1,    81,   244,    -1,    -1,   729,    -1,
+     101,   145,    -1,   101,   121,    -1,    -1,   731,    -1,   157,
+     275,   158,   732,   740,    -1,   733,    -1,   738,    -1,   159,
+     734,   736,    -1,    81,   152,   736,    -1,   735,    -1,     3,
+      -1,    -1,   155,   737,    -1,   735,    -1,   156,   739,    -1,
+     661,    -1,    -1,   741,    -1,   743,    -1,   744,   742,    -1,
+      -1,   743,    -1,   149,   746,    -1,    81,   152,    -1,   152,
+     745,    -1,   735,    -1,   661,    -1,   160,   168,   673,   561,
+     720,   169,    -1
 };
 
 /* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
@@ -1683,74 +1684,74 @@ static const yytype_uint16 yyrline[] =
     2399,  2404,  2405,  2410,  2411,  2412,  2413,  2417,  2424,  2426,
     2428,  2430,  2434,  2436,  2438,  2443,  2444,  2448,  2450,  2456,
     2457,  2458,  2459,  2463,  2464,  2465,  2466,  2470,  2471,  2475,
-    2476,  2477,  2481,  2482,  2486,  2500,  2514,  2524,  2531,  2541,
-    2542,  2547,  2548,  2553,  2554,  2558,  2559,  2563,  2567,  2576,
-    2580,  2585,  2590,  2599,  2600,  2604,  2605,  2606,  2607,  2609,
-    2614,  2615,  2619,  2620,  2624,  2625,  2629,  2630,  2634,  2635,
-    2639,  2640,  2645,  2654,  2695,  2703,  2714,  2715,  2717,  2719,
-    2724,  2725,  2730,  2731,  2736,  2737,  2742,  2759,  2763,  2767,
-    2768,  2772,  2773,  2774,  2778,  2779,  2784,  2789,  2797,  2798,
-    2804,  2806,  2812,  2820,  2828,  2836,  2844,  2855,  2856,  2857,
-    2861,  2862,  2863,  2867,  2868,  2888,  2892,  2902,  2903,  2907,
-    2919,  2924,  2926,  2930,  2941,  2952,  2983,  2984,  2989,  2993,
-    3002,  3011,  3019,  3020,  3024,  3025,  3026,  3031,  3032,  3034,
-    3039,  3043,  3053,  3054,  3058,  3059,  3064,  3068,  3072,  3076,
-    3083,  3084,  3094,  3099,  3109,  3108,  3121,  3126,  3131,  3136,
-    3144,  3145,  3149,  3151,  3157,  3158,  3163,  3168,  3172,  3177,
-    3181,  3182,  3187,  3188,  3192,  3196,  3197,  3201,  3205,  3206,
-    3210,  3214,  3218,  3219,  3224,  3233,  3234,  3235,  3239,  3240,
-    3241,  3242,  3243,  3244,  3245,  3246,  3247,  3251,  3268,  3272,
-    3279,  3289,  3296,  3306,  3307,  3308,  3312,  3319,  3326,  3333,
-    3343,  3347,  3365,  3366,  3370,  3376,  3382,  3387,  3395,  3397,
-    3402,  3413,  3414,  3415,  3419,  3423,  3424,  3428,  3432,  3441,
-    3442,  3444,  3450,  3451,  3458,  3465,  3472,  3479,  3486,  3493,
-    3500,  3507,  3514,  3521,  3528,  3534,  3541,  3548,  3555,  3562,
-    3569,  3576,  3583,  3589,  3596,  3603,  3610,  3617,  3619,  3644,
-    3648,  3649,  3653,  3654,  3656,  3658,  3659,  3660,  3661,  3662,
-    3663,  3664,  3665,  3666,  3667,  3668,  3669,  3670,  3674,  3744,
-    3750,  3751,  3755,  3760,  3761,  3766,  3767,  3772,  3773,  3778,
-    3779,  3783,  3784,  3788,  3789,  3790,  3794,  3798,  3803,  3804,
-    3805,  3809,  3813,  3814,  3815,  3816,  3817,  3821,  3825,  3829,
-    3857,  3858,  3863,  3864,  3865,  3866,  3870,  3877,  3882,  3887,
-    3892,  3897,  3905,  3906,  3910,  3920,  3930,  3937,  3944,  3951,
-    3958,  3971,  3972,  3977,  3982,  3987,  3992,  4000,  4001,  4005,
-    4027,  4028,  4033,  4034,  4039,  4040,  4046,  4052,  4058,  4064,
-    4070,  4076,  4083,  4087,  4088,  4089,  4093,  4094,  4105,  4107,
-    4111,  4113,  4117,  4118,  4124,  4133,  4134,  4135,  4136,  4137,
-    4141,  4142,  4146,  4152,  4155,  4161,  4164,  4170,  4173,  4178,
-    4198,  4199,  4200,  4204,  4210,  4274,  4305,  4356,  4395,  4412,
-    4428,  4444,  4460,  4461,  4478,  4495,  4512,  4533,  4537,  4544,
-    4589,  4590,  4594,  4605,  4608,  4612,  4620,  4626,  4634,  4638,
-    4643,  4645,  4651,  4659,  4661,  4666,  4670,  4676,  4684,  4686,
-    4691,  4699,  4701,  4706,  4707,  4711,  4716,  4727,  4738,  4749,
-    4759,  4769,  4779,  4781,  4786,  4787,  4789,  4791,  4800,  4801,
-    4810,  4811,  4812,  4813,  4814,  4816,  4817,  4830,  4848,  4849,
-    4863,  4883,  4884,  4885,  4886,  4887,  4888,  4889,  4891,  4892,
-    4894,  4906,  4920,  4934,  4937,  4952,  4967,  4970,  4990,  5002,
-    5017,  5032,  5033,  5037,  5038,  5039,  5042,  5043,  5046,  5048,
-    5051,  5052,  5053,  5054,  5055,  5056,  5060,  5061,  5062,  5063,
-    5064,  5065,  5066,  5067,  5071,  5072,  5073,  5074,  5075,  5076,
-    5077,  5078,  5079,  5080,  5081,  5082,  5083,  5085,  5086,  5087,
-    5088,  5089,  5090,  5091,  5092,  5093,  5094,  5095,  5096,  5097,
-    5098,  5100,  5101,  5102,  5103,  5104,  5105,  5106,  5107,  5108,
-    5109,  5110,  5111,  5112,  5113,  5115,  5116,  5117,  5118,  5119,
-    5120,  5121,  5122,  5123,  5125,  5126,  5127,  5128,  5129,  5130,
-    5131,  5132,  5133,  5134,  5135,  5136,  5137,  5138,  5139,  5140,
-    5141,  5142,  5143,  5144,  5145,  5146,  5147,  5151,  5152,  5157,
-    5175,  5198,  5219,  5251,  5253,  5261,  5268,  5273,  5288,  5289,
-    5293,  5296,  5299,  5303,  5305,  5310,  5314,  5315,  5316,  5317,
-    5318,  5319,  5320,  5321,  5322,  5323,  5327,  5335,  5343,  5350,
-    5364,  5365,  5369,  5373,  5377,  5381,  5385,  5389,  5396,  5400,
-    5404,  5405,  5415,  5423,  5424,  5428,  5432,  5436,  5443,  5445,
-    5450,  5454,  5455,  5459,  5460,  5461,  5462,  5463,  5467,  5480,
-    5481,  5485,  5487,  5492,  5498,  5502,  5503,  5507,  5512,  5521,
-    5522,  5526,  5537,  5541,  5542,  5547,  5557,  5560,  5562,  5566,
-    5570,  5571,  5575,  5576,  5580,  5584,  5587,  5589,  5593,  5594,
-    5598,  5606,  5615,  5616,  5620,  5621,  5625,  5626,  5627,  5642,
-    5646,  5647,  5657,  5658,  5662,  5666,  5670,  5680,  5684,  5687,
-    5689,  5693,  5694,  5697,  5699,  5703,  5708,  5709,  5713,  5714,
-    5718,  5722,  5725,  5727,  5731,  5735,  5739,  5742,  5744,  5748,
-    5749,  5753,  5755,  5759,  5763,  5764,  5768,  5772,  5776
+    2476,  2477,  2481,  2482,  2486,  2500,  2514,  2524,  2531,  2538,
+    2546,  2547,  2552,  2553,  2558,  2559,  2563,  2564,  2568,  2572,
+    2581,  2585,  2590,  2595,  2604,  2605,  2609,  2610,  2611,  2612,
+    2614,  2619,  2620,  2624,  2625,  2629,  2630,  2634,  2635,  2639,
+    2640,  2644,  2645,  2650,  2659,  2700,  2708,  2719,  2720,  2722,
+    2724,  2729,  2730,  2735,  2736,  2741,  2742,  2747,  2764,  2768,
+    2772,  2773,  2777,  2778,  2779,  2783,  2784,  2789,  2794,  2802,
+    2803,  2809,  2811,  2817,  2825,  2833,  2841,  2849,  2860,  2861,
+    2862,  2866,  2867,  2868,  2872,  2873,  2893,  2897,  2907,  2908,
+    2912,  2924,  2929,  2931,  2935,  2946,  2957,  2988,  2989,  2994,
+    2998,  3007,  3016,  3024,  3025,  3029,  3030,  3031,  3036,  3037,
+    3039,  3044,  3048,  3058,  3059,  3063,  3064,  3069,  3073,  3077,
+    3081,  3088,  3089,  3099,  3104,  3114,  3113,  3126,  3131,  3136,
+    3141,  3149,  3150,  3154,  3156,  3162,  3163,  3168,  3173,  3177,
+    3182,  3186,  3187,  3192,  3193,  3197,  3201,  3202,  3206,  3210,
+    3211,  3215,  3219,  3223,  3224,  3229,  3238,  3239,  3240,  3244,
+    3245,  3246,  3247,  3248,  3249,  3250,  3251,  3252,  3256,  3273,
+    3277,  3284,  3294,  3301,  3311,  3312,  3313,  3317,  3324,  3331,
+    3338,  3348,  3352,  3370,  3371,  3375,  3381,  3387,  3392,  3400,
+    3402,  3407,  3418,  3419,  3420,  3424,  3428,  3429,  3433,  3437,
+    3446,  3447,  3449,  3455,  3456,  3463,  3470,  3477,  3484,  3491,
+    3498,  3505,  3512,  3519,  3526,  3533,  3539,  3546,  3553,  3560,
+    3567,  3574,  3581,  3588,  3594,  3601,  3608,  3615,  3622,  3624,
+    3649,  3653,  3654,  3658,  3659,  3661,  3663,  3664,  3665,  3666,
+    3667,  3668,  3669,  3670,  3671,  3672,  3673,  3674,  3675,  3679,
+    3749,  3755,  3756,  3760,  3765,  3766,  3771,  3772,  3777,  3778,
+    3783,  3784,  3788,  3789,  3793,  3794,  3795,  3799,  3803,  3808,
+    3809,  3810,  3814,  3818,  3819,  3820,  3821,  3822,  3826,  3830,
+    3834,  3862,  3863,  3868,  3869,  3870,  3871,  3875,  3882,  3887,
+    3892,  3897,  3902,  3910,  3911,  3915,  3925,  3935,  3942,  3949,
+    3956,  3963,  3976,  3977,  3982,  3987,  3992,  3997,  4005,  4006,
+    4010,  4032,  4033,  4038,  4039,  4044,  4045,  4051,  4057,  4063,
+    4069,  4075,  4081,  4088,  4092,  4093,  4094,  4098,  4099,  4110,
+    4112,  4116,  4118,  4122,  4123,  4129,  4138,  4139,  4140,  4141,
+    4142,  4146,  4147,  4151,  4157,  4160,  4166,  4169,  4175,  4178,
+    4183,  4203,  4204,  4205,  4209,  4215,  4279,  4310,  4361,  4400,
+    4417,  4433,  4449,  4465,  4466,  4483,  4500,  4517,  4538,  4542,
+    4549,  4594,  4595,  4599,  4610,  4613,  4617,  4625,  4631,  4639,
+    4643,  4648,  4650,  4656,  4664,  4666,  4671,  4675,  4681,  4689,
+    4691,  4696,  4704,  4706,  4711,  4712,  4716,  4721,  4732,  4743,
+    4754,  4764,  4774,  4784,  4786,  4791,  4792,  4794,  4796,  4805,
+    4806,  4815,  4816,  4817,  4818,  4819,  4821,  4822,  4835,  4853,
+    4854,  4868,  4888,  4889,  4890,  4891,  4892,  4893,  4894,  4896,
+    4897,  4899,  4911,  4925,  4939,  4942,  4957,  4972,  4975,  4995,
+    5007,  5022,  5037,  5038,  5042,  5043,  5044,  5047,  5048,  5051,
+    5053,  5056,  5057,  5058,  5059,  5060,  5061,  5065,  5066,  5067,
+    5068,  5069,  5070,  5071,  5072,  5076,  5077,  5078,  5079,  5080,
+    5081,  5082,  5083,  5084,  5085,  5086,  5087,  5088,  5090,  5091,
+    5092,  5093,  5094,  5095,  5096,  5097,  5098,  5099,  5100,  5101,
+    5102,  5103,  5105,  5106,  5107,  5108,  5109,  5110,  5111,  5112,
+    5113,  5114,  5115,  5116,  5117,  5118,  5120,  5121,  5122,  5123,
+    5124,  5125,  5126,  5127,  5128,  5130,  5131,  5132,  5133,  5134,
+    5135,  5136,  5137,  5138,  5139,  5140,  5141,  5142,  5143,  5144,
+    5145,  5146,  5147,  5148,  5149,  5150,  5151,  5152,  5156,  5157,
+    5162,  5180,  5203,  5224,  5256,  5258,  5266,  5273,  5278,  5293,
+    5294,  5298,  5301,  5304,  5308,  5310,  5315,  5319,  5320,  5321,
+    5322,  5323,  5324,  5325,  5326,  5327,  5328,  5332,  5340,  5348,
+    5355,  5369,  5370,  5374,  5378,  5382,  5386,  5390,  5394,  5401,
+    5405,  5409,  5410,  5420,  5428,  5429,  5433,  5437,  5441,  5448,
+    5450,  5455,  5459,  5460,  5464,  5465,  5466,  5467,  5468,  5472,
+    5485,  5486,  5490,  5492,  5497,  5503,  5507,  5508,  5512,  5517,
+    5526,  5527,  5531,  5542,  5546,  5547,  5552,  5562,  5565,  5567,
+    5571,  5575,  5576,  5580,  5581,  5585,  5589,  5592,  5594,  5598,
+    5599,  5603,  5611,  5620,  5621,  5625,  5626,  5630,  5631,  5632,
+    5647,  5651,  5652,  5662,  5663,  5667,  5671,  5675,  5685,  5689,
+    5692,  5694,  5698,  5699,  5702,  5704,  5708,  5713,  5714,  5718,
+    5719,  5723,  5727,  5730,  5732,  5736,  5740,  5744,  5747,  5749,
+    5753,  5754,  5758,  5760,  5764,  5768,  5769,  5773,  5777,  5781
 };
 #endif
 
@@ -1759,9 +1760,9 @@ static const yytype_uint16 yyrline[] =
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "STRING", "X_BODY", "IDENT", "aTYPE",
-  "ALIAS", "AGGR", "AGGR2", "RANK", "sqlINT", "OIDNUM", "HEXADECIMAL",
-  "INTNUM", "APPROXNUM", "USING", "GLOBAL", "CAST", "CONVERT", "CHARACTER",
+  "$end", "error", "$undefined", "STRING", "IDENT", "aTYPE", "ALIAS",
+  "AGGR", "AGGR2", "RANK", "sqlINT", "OIDNUM", "HEXADECIMAL", "INTNUM",
+  "APPROXNUM", "USING", "GLOBAL", "CAST", "CONVERT", "CHARACTER",
   "VARYING", "LARGE", "OBJECT", "VARCHAR", "CLOB", "sqlTEXT", "BINARY",
   "sqlBLOB", "sqlDECIMAL", "sqlFLOAT", "TINYINT", "SMALLINT", "BIGINT",
   "HUGEINT", "sqlINTEGER", "sqlDOUBLE", "sqlREAL", "PRECISION", "PARTIAL",
@@ -1785,15 +1786,15 @@ static const char *const yytname[] =
   "PASSING", "XMLTEXT", "NIL", "REF", "ABSENT", "EMPTY", "DOCUMENT",
   "ELEMENT", "CONTENT", "XMLNAMESPACES", "NAMESPACE", "XMLVALIDATE",
   "RETURNING", "LOCATION", "ID", "ACCORDING", "XMLSCHEMA", "URI", "XMLAGG",
-  "FILTER", "UNIONJOIN", "CORRESPONDING", "INTERSECT", "EXCEPT", "UNION",
-  "DATA", "WITH", "'('", "')'", "FILTER_FUNC", "NOT", "'='", "SOME", "OR",
-  "ILIKE", "NOT_ILIKE", "LIKE", "NOT_LIKE", "sqlIN", "NOT_IN", "BETWEEN",
-  "NOT_BETWEEN", "ANY", "ALL", "AND", "COMPARISON", "'+'", "'-'", "'&'",
-  "'|'", "'^'", "SPLIT_PART", "POSITION", "SUBSTRING", "CONCATSTRING",
-  "RIGHT_SHIFT_ASSIGN", "LEFT_SHIFT_ASSIGN", "RIGHT_SHIFT", "LEFT_SHIFT",
-  "UMINUS", "'*'", "'/'", "'%'", "'~'", "GEOM_OVERLAP_OR_LEFT",
-  "GEOM_OVERLAP_OR_BELOW", "GEOM_OVERLAP_OR_ABOVE", "GEOM_OVERLAP",
-  "GEOM_DIST", "GEOM_ABOVE", "GEOM_BELOW", "GEOM_OVERLAP_OR_RIGHT", "TEMP",
+  "FILTER", "UNION", "EXCEPT", "INTERSECT", "CORRESPONDING", "UNIONJOIN",
+  "DATA", "'('", "')'", "FILTER_FUNC", "NOT", "'='", "ALL", "ANY",
+  "NOT_BETWEEN", "BETWEEN", "NOT_IN", "sqlIN", "NOT_LIKE", "LIKE",
+  "NOT_ILIKE", "ILIKE", "OR", "SOME", "AND", "COMPARISON", "'+'", "'-'",
+  "'&'", "'|'", "'^'", "LEFT_SHIFT", "RIGHT_SHIFT", "LEFT_SHIFT_ASSIGN",
+  "RIGHT_SHIFT_ASSIGN", "CONCATSTRING", "SUBSTRING", "POSITION",
+  "SPLIT_PART", "UMINUS", "'*'", "'/'", "'%'", "'~'", "GEOM_OVERLAP",
+  "GEOM_OVERLAP_OR_ABOVE", "GEOM_OVERLAP_OR_BELOW", "GEOM_OVERLAP_OR_LEFT",
+  "GEOM_OVERLAP_OR_RIGHT", "GEOM_BELOW", "GEOM_ABOVE", "GEOM_DIST", "TEMP",
   "TEMPORARY", "STREAM", "MERGE", "REMOTE", "REPLICA", "ASC", "DESC",
   "AUTHORIZATION", "CHECK", "CONSTRAINT", "CREATE", "TYPE", "PROCEDURE",
   "FUNCTION", "AGGREGATE", "RETURNS", "EXTERNAL", "sqlNAME", "DECLARE",
@@ -1803,24 +1804,25 @@ static const char *const yytname[] =
   "PASSWORD", "GRANT", "REVOKE", "ROLE", "ADMIN", "INTO", "IS", "KEY",
   "ON", "OPTION", "OPTIONS", "PATH", "PRIMARY", "PRIVILEGES", "PUBLIC",
   "REFERENCES", "SCHEMA", "SET", "AUTO_COMMIT", "RETURN", "ALTER", "ADD",
-  "TABLE", "COLUMN", "TO", "UNIQUE", "VALUES", "VIEW", "WHERE", "sqlDATE",
-  "TIME", "TIMESTAMP", "INTERVAL", "YEAR", "MONTH", "DAY", "HOUR",
-  "MINUTE", "SECOND", "ZONE", "LIMIT", "OFFSET", "SAMPLE", "CASE", "WHEN",
-  "THEN", "ELSE", "NULLIF", "COALESCE", "IF", "ELSEIF", "WHILE", "DO",
-  "ATOMIC", "BEGIN", "END", "COPY", "RECORDS", "DELIMITERS", "STDIN",
+  "TABLE", "COLUMN", "TO", "UNIQUE", "VALUES", "VIEW", "WHERE", "WITH",
+  "sqlDATE", "TIME", "TIMESTAMP", "INTERVAL", "YEAR", "MONTH", "DAY",
+  "HOUR", "MINUTE", "SECOND", "ZONE", "LIMIT", "OFFSET", "SAMPLE", "CASE",
+  "WHEN", "THEN", "ELSE", "NULLIF", "COALESCE", "IF", "ELSEIF", "WHILE",
+  "DO", "ATOMIC", "BEGIN", "END", "COPY", "RECORDS", "DELIMITERS", "STDIN",
   "STDOUT", "FWF", "INDEX", "AS", "TRIGGER", "OF", "BEFORE", "AFTER",
   "ROW", "STATEMENT", "sqlNEW", "OLD", "EACH", "REFERENCING", "OVER",
   "PARTITION", "CURRENT", "EXCLUDE", "FOLLOWING", "PRECEDING", "OTHERS",
-  "TIES", "RANGE", "UNBOUNDED", "','", "'.'", "':'", "'['", "']'", "'?'",
-  "$accept", "sqlstmt", "@1", "@2", "@3", "@4", "@5", "@6", "create",
-  "drop", "set", "declare", "sql", "opt_minmax", "declare_statement",
-  "variable_list", "set_statement", "schema", "schema_name_clause",
-  "authorization_identifier", "opt_schema_default_char_set",
-  "opt_schema_element_list", "schema_element_list", "schema_element",
-  "opt_grantor", "grantor", "grant", "authid_list", "opt_with_grant",
-  "opt_with_admin", "opt_from_grantor", "revoke", "opt_grant_for",
-  "opt_admin_for", "privileges", "global_privileges", "global_privilege",
-  "object_name", "object_privileges", "operation_commalist", "operation",
+  "TIES", "RANGE", "UNBOUNDED", "X_BODY", "','", "'.'", "':'", "'['",
+  "']'", "'?'", "$accept", "sqlstmt", "@1", "@2", "@3", "@4", "@5", "@6",
+  "create", "drop", "set", "declare", "sql", "opt_minmax",
+  "declare_statement", "variable_list", "set_statement", "schema",
+  "schema_name_clause", "authorization_identifier",
+  "opt_schema_default_char_set", "opt_schema_element_list",
+  "schema_element_list", "schema_element", "opt_grantor", "grantor",
+  "grant", "authid_list", "opt_with_grant", "opt_with_admin",
+  "opt_from_grantor", "revoke", "opt_grant_for", "opt_admin_for",
+  "privileges", "global_privileges", "global_privilege", "object_name",
+  "object_privileges", "operation_commalist", "operation",
   "grantee_commalist", "grantee", "alter_statement", "passwd_schema",
   "alter_table_element", "drop_table_element", "opt_column",
   "create_statement", "seq_def", "opt_seq_params", "opt_alt_seq_params",
@@ -1942,40 +1944,40 @@ static const char *const yytname[] =
    token YYLEX-NUM.  */
 static const yytype_uint16 yytoknum[] =
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-      40,    41,   425,   426,    61,   427,   428,   429,   430,   431,
-     432,   433,   434,   435,   436,   437,   438,   439,   440,    43,
-      45,    38,   124,    94,   441,   442,   443,   444,   445,   446,
-     447,   448,   449,    42,    47,    37,   126,   450,   451,   452,
-     453,   454,   455,   456,   457,   458,   459,   460,   461,   462,
-     463,   464,   465,   466,   467,   468,   469,   470,   471,   472,
-     473,   474,   475,   476,   477,   478,   479,   480,   481,   482,
-     483,   484,   485,   486,   487,   488,   489,   490,   491,   492,
-     493,   494,   495,   496,   497,   498,   499,   500,   501,   502,
-     503,   504,   505,   506,   507,   508,   509,   510,   511,   512,
-     513,   514,   515,   516,   517,   518,   519,   520,   521,   522,
-     523,   524,   525,   526,   527,   528,   529,   530,   531,   532,
-     533,   534,   535,   536,   537,   538,   539,   540,   541,   542,
-     543,   544,   545,   546,   547,   548,   549,   550,   551,   552,
-     553,   554,   555,   556,   557,   558,   559,   560,   561,   562,
-     563,   564,   565,   566,   567,   568,   569,   570,   571,   572,
-     573,   574,   575,   576,   577,   578,   579,    44,    46,    58,
+       0,   256,   257,   258,   260,   261,   262,   263,   264,   265,
+     266,   267,   268,   269,   270,   271,   272,   273,   274,   275,
+     276,   277,   278,   279,   280,   281,   282,   283,   284,   285,
+     286,   287,   288,   289,   290,   291,   292,   293,   294,   295,
+     296,   297,   298,   299,   300,   301,   302,   303,   304,   305,
+     306,   307,   308,   309,   310,   311,   312,   313,   314,   315,
+     316,   317,   318,   319,   320,   321,   322,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,   332,   333,   334,   335,
+     336,   337,   338,   339,   340,   341,   342,   343,   344,   345,
+     346,   347,   348,   349,   350,   351,   352,   353,   354,   355,
+     356,   357,   358,   359,   360,   361,   362,   363,   364,   365,
+     366,   367,   368,   369,   370,   371,   372,   373,   374,   375,
+     376,   377,   378,   379,   380,   381,   382,   383,   384,   385,
+     386,   387,   388,   389,   390,   391,   392,   393,   394,   395,
+     396,   397,   398,   399,   400,   401,   402,   403,   404,   405,
+     406,   407,   408,   409,   410,   411,   412,   413,   414,   415,
+     416,   417,   422,   421,   420,   419,   418,   423,    40,    41,
+     425,   426,    61,   438,   437,   436,   435,   434,   433,   432,
+     431,   430,   429,   428,   427,   439,   440,    43,    45,    38,
+     124,    94,   448,   447,   446,   445,   444,   443,   442,   441,
+     449,    42,    47,    37,   126,   453,   452,   451,   450,   457,
+     456,   455,   454,   458,   459,   460,   461,   462,   463,   464,
+     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
+     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
+     485,   486,   487,   488,   489,   490,   491,   492,   493,   494,
+     495,   496,   497,   498,   499,   500,   501,   502,   503,   504,
+     505,   506,   507,   508,   509,   510,   511,   512,   513,   514,
+     515,   516,   517,   518,   519,   520,   521,   522,   523,   524,
+     424,   525,   526,   527,   528,   529,   530,   531,   532,   533,
+     534,   535,   536,   537,   538,   539,   540,   541,   542,   543,
+     544,   545,   546,   547,   548,   549,   550,   551,   552,   553,
+     554,   555,   556,   557,   558,   559,   560,   561,   562,   563,
+     564,   565,   566,   567,   568,   569,   570,   571,   572,   573,
+     574,   575,   576,   577,   578,   579,   259,    44,    46,    58,
       91,    93,    63
 };
 # endif
@@ -2026,74 +2028,74 @@ static const yytype_uint16 yyr1[] =
      491,   355,   355,   492,   492,   492,   492,   493,   494,   494,
      494,   494,   494,   494,   494,   495,   495,   496,   496,   497,
      497,   497,   497,   498,   498,   498,   498,   499,   499,   500,
-     500,   500,   501,   501,   502,   502,   502,   502,   502,   503,
-     503,   504,   504,   505,   505,   506,   506,   507,   507,   508,
-     508,   508,   508,   509,   509,   510,   510,   510,   510,   510,
-     511,   511,   512,   512,   513,   513,   514,   514,   515,   515,
-     516,   516,   517,   518,   519,   519,   520,   520,   520,   520,
-     521,   521,   522,   522,   523,   523,   524,   525,   526,   527,
-     527,   528,   528,   528,   529,   529,   530,   530,   531,   531,
-     532,   532,   532,   532,   532,   532,   532,   533,   533,   533,
-     534,   534,   534,   535,   535,   355,   536,   537,   537,   538,
-     539,   355,   355,   540,   541,   542,   543,   543,   544,   545,
-     545,   545,   545,   545,   546,   546,   546,   547,   547,   547,
-     548,   549,   550,   550,   551,   551,   552,   552,   552,   552,
-     553,   553,   553,   553,   554,   553,   555,   555,   555,   555,
-     556,   556,   557,   557,   558,   558,   559,   559,   560,   560,
-     561,   561,   562,   562,   562,   563,   563,   563,   564,   564,
-     564,   564,   565,   565,   566,   567,   567,   567,   568,   568,
-     568,   568,   568,   568,   568,   568,   568,   569,   569,   570,
-     570,   571,   571,   572,   572,   572,   573,   573,   573,   573,
-     574,   574,   575,   575,   576,   576,   576,   576,   577,   577,
-     578,   579,   579,   579,   580,   581,   581,   582,   583,   584,
-     584,   584,   585,   585,   585,   585,   585,   585,   585,   585,
+     500,   500,   501,   501,   502,   502,   502,   502,   502,   502,
+     503,   503,   504,   504,   505,   505,   506,   506,   507,   507,
+     508,   508,   508,   508,   509,   509,   510,   510,   510,   510,
+     510,   511,   511,   512,   512,   513,   513,   514,   514,   515,
+     515,   516,   516,   517,   518,   519,   519,   520,   520,   520,
+     520,   521,   521,   522,   522,   523,   523,   524,   525,   526,
+     527,   527,   528,   528,   528,   529,   529,   530,   530,   531,
+     531,   532,   532,   532,   532,   532,   532,   532,   533,   533,
+     533,   534,   534,   534,   535,   535,   355,   536,   537,   537,
+     538,   539,   355,   355,   540,   541,   542,   543,   543,   544,
+     545,   545,   545,   545,   545,   546,   546,   546,   547,   547,
+     547,   548,   549,   550,   550,   551,   551,   552,   552,   552,
+     552,   553,   553,   553,   553,   554,   553,   555,   555,   555,
+     555,   556,   556,   557,   557,   558,   558,   559,   559,   560,
+     560,   561,   561,   562,   562,   562,   563,   563,   563,   564,
+     564,   564,   564,   565,   565,   566,   567,   567,   567,   568,
+     568,   568,   568,   568,   568,   568,   568,   568,   569,   569,
+     570,   570,   571,   571,   572,   572,   572,   573,   573,   573,
+     573,   574,   574,   575,   575,   576,   576,   576,   576,   577,
+     577,   578,   579,   579,   579,   580,   581,   581,   582,   583,
+     584,   584,   584,   585,   585,   585,   585,   585,   585,   585,
      585,   585,   585,   585,   585,   585,   585,   585,   585,   585,
      585,   585,   585,   585,   585,   585,   585,   585,   585,   585,
-     586,   586,   587,   587,   587,   587,   587,   587,   587,   587,
-     587,   587,   587,   587,   587,   587,   587,   587,   588,   589,
-     590,   590,   591,   592,   592,   593,   593,   594,   594,   595,
-     595,   596,   596,   597,   597,   597,   598,   599,   600,   600,
-     600,   601,   602,   602,   602,   602,   602,   603,   604,   604,
-     605,   605,   606,   606,   606,   606,   607,   607,   607,   607,
-     607,   607,   608,   608,   609,   609,   609,   609,   609,   609,
-     609,   610,   610,   611,   611,   611,   611,   612,   612,   613,
-     614,   614,   615,   615,   616,   616,   617,   617,   617,   617,
-     617,   617,   617,   618,   618,   618,   619,   619,   620,   620,
-     621,   621,   622,   622,   622,   623,   623,   623,   623,   623,
-     624,   624,   625,   626,   626,   627,   627,   628,   628,   629,
-     630,   630,   630,   631,   631,   631,   631,   631,   631,   631,
-     631,   631,   631,   631,   631,   631,   631,   631,   631,   632,
-     633,   633,   633,   634,   634,   634,   635,   635,   636,   637,
-     637,   637,   637,   638,   638,   639,   639,   640,   641,   641,
-     642,   643,   643,   644,   644,   645,   646,   647,   648,   649,
-     650,   651,   652,   652,   652,   652,   652,   652,   652,   652,
+     585,   586,   586,   587,   587,   587,   587,   587,   587,   587,
+     587,   587,   587,   587,   587,   587,   587,   587,   587,   588,
+     589,   590,   590,   591,   592,   592,   593,   593,   594,   594,
+     595,   595,   596,   596,   597,   597,   597,   598,   599,   600,
+     600,   600,   601,   602,   602,   602,   602,   602,   603,   604,
+     604,   605,   605,   606,   606,   606,   606,   607,   607,   607,
+     607,   607,   607,   608,   608,   609,   609,   609,   609,   609,
+     609,   609,   610,   610,   611,   611,   611,   611,   612,   612,
+     613,   614,   614,   615,   615,   616,   616,   617,   617,   617,
+     617,   617,   617,   617,   618,   618,   618,   619,   619,   620,
+     620,   621,   621,   622,   622,   622,   623,   623,   623,   623,
+     623,   624,   624,   625,   626,   626,   627,   627,   628,   628,
+     629,   630,   630,   630,   631,   631,   631,   631,   631,   631,
+     631,   631,   631,   631,   631,   631,   631,   631,   631,   631,
+     632,   633,   633,   633,   634,   634,   634,   635,   635,   636,
+     637,   637,   637,   637,   638,   638,   639,   639,   640,   641,
+     641,   642,   643,   643,   644,   644,   645,   646,   647,   648,
+     649,   650,   651,   652,   652,   652,   652,   652,   652,   652,
      652,   652,   652,   652,   652,   652,   652,   652,   652,   652,
      652,   652,   652,   652,   652,   652,   652,   652,   652,   652,
-     652,   652,   652,   652,   652,   652,   652,   652,   653,   653,
-     654,   655,   655,   656,   656,   656,   657,   657,   658,   659,
-     660,   660,   660,   660,   660,   660,   661,   661,   661,   661,
-     661,   661,   661,   661,   662,   662,   662,   662,   662,   662,
+     652,   652,   652,   652,   652,   652,   652,   652,   652,   653,
+     653,   654,   655,   655,   656,   656,   656,   657,   657,   658,
+     659,   660,   660,   660,   660,   660,   660,   661,   661,   661,
+     661,   661,   661,   661,   661,   662,   662,   662,   662,   662,
      662,   662,   662,   662,   662,   662,   662,   662,   662,   662,
      662,   662,   662,   662,   662,   662,   662,   662,   662,   662,
      662,   662,   662,   662,   662,   662,   662,   662,   662,   662,
      662,   662,   662,   662,   662,   662,   662,   662,   662,   662,
      662,   662,   662,   662,   662,   662,   662,   662,   662,   662,
      662,   662,   662,   662,   662,   662,   662,   662,   662,   662,
-     662,   662,   662,   662,   662,   662,   662,   663,   663,   664,
-     665,   666,   666,   667,   667,   668,   669,   669,   670,   670,
-     671,   672,   673,   674,   674,   675,   676,   676,   676,   676,
-     676,   676,   676,   676,   676,   676,   677,   678,   679,   680,
-     681,   681,   681,   681,   681,   681,   681,   681,   682,   683,
-     684,   684,   685,   686,   686,   687,   688,   689,   690,   690,
-     691,   692,   692,   693,   693,   693,   693,   693,   694,   695,
-     695,   696,   696,   697,   698,   699,   699,   700,   701,   702,
-     702,   703,   704,   705,   705,   706,   707,   708,   708,   709,
-     710,   710,   711,   711,   712,   713,   714,   714,   715,   715,
-     716,   717,   718,   718,   719,   719,   720,   720,   720,   721,
-     722,   722,   723,   723,   724,   725,   726,   727,   727,   728,
-     728,   729,   729,   730,   730,   731,   732,   732,   733,   733,
-     734,   735,   736,   736,   737,   738,   739,   740,   740,   741,
-     741,   742,   742,   743,   744,   744,   745,   746,   747
+     662,   662,   662,   662,   662,   662,   662,   662,   663,   663,
+     664,   665,   666,   666,   667,   667,   668,   669,   669,   670,
+     670,   671,   672,   673,   674,   674,   675,   676,   676,   676,
+     676,   676,   676,   676,   676,   676,   676,   677,   678,   679,
+     680,   681,   681,   681,   681,   681,   681,   681,   681,   682,
+     683,   684,   684,   685,   686,   686,   687,   688,   689,   690,
+     690,   691,   692,   692,   693,   693,   693,   693,   693,   694,
+     695,   695,   696,   696,   697,   698,   699,   699,   700,   701,
+     702,   702,   703,   704,   705,   705,   706,   707,   708,   708,
+     709,   710,   710,   711,   711,   712,   713,   714,   714,   715,
+     715,   716,   717,   718,   718,   719,   719,   720,   720,   720,
+     721,   722,   722,   723,   723,   724,   725,   726,   727,   727,
+     728,   728,   729,   729,   730,   730,   731,   732,   732,   733,
+     733,   734,   735,   736,   736,   737,   738,   739,   740,   740,
+     741,   741,   742,   742,   743,   744,   744,   745,   746,   747
 };
 
 /* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
@@ -2142,51 +2144,51 @@ static const yytype_uint8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     3,     2,
        3,     4,     3,     4,     3,     0,     1,     1,     3,     2,
        2,     3,     3,     2,     2,     2,     1,     1,     0,     2,
-       3,     0,     0,     3,    14,    13,     8,     6,     6,     0,
-       4,     1,     3,     0,     3,     1,     3,     1,     2,     0,
-       3,     5,     7,     0,     1,     0,     2,     2,     4,     4,
-       0,     3,     0,     1,     0,     2,     0,     2,     1,     3,
-       1,     3,     4,     5,     4,     5,     0,     2,     2,     1,
-       3,     5,     1,     3,     1,     3,     1,     1,     1,     1,
-       1,     0,     1,     1,     1,     3,     3,     3,     0,     2,
-       3,     4,     4,     4,     4,     5,     5,     1,     2,     1,
-       1,     1,     1,     2,     2,     1,     3,     3,     1,     6,
-       1,     1,     1,     4,     6,     5,     1,     3,     1,     5,
-       5,     5,     3,     1,     0,     1,     1,     0,     1,     5,
-       1,     4,     0,     2,     1,     3,     1,     2,     2,     1,
-       1,     2,     1,     1,     0,     5,     5,     2,     4,     1,
-       0,     3,     1,     3,     0,     2,     3,     1,     3,     1,
-       0,     3,     0,     2,     2,     0,     2,     2,     0,     2,
-       2,     2,     1,     3,     2,     0,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     2,     1,     3,
-       3,     6,     6,     0,     1,     1,     3,     3,     3,     3,
-       1,     3,     4,     3,     5,     5,     7,     7,     1,     3,
-       4,     1,     1,     1,     2,     1,     3,     3,     3,     3,
-       4,     3,     1,     3,     3,     3,     3,     3,     3,     3,
+       3,     0,     0,     3,    14,    13,     8,     6,     6,     5,
+       0,     4,     1,     3,     0,     3,     1,     3,     1,     2,
+       0,     3,     5,     7,     0,     1,     0,     2,     2,     4,
+       4,     0,     3,     0,     1,     0,     2,     0,     2,     1,
+       3,     1,     3,     4,     5,     4,     5,     0,     2,     2,
+       1,     3,     5,     1,     3,     1,     3,     1,     1,     1,
+       1,     1,     0,     1,     1,     1,     3,     3,     3,     0,
+       2,     3,     4,     4,     4,     4,     5,     5,     1,     2,
+       1,     1,     1,     1,     2,     2,     1,     3,     3,     1,
+       6,     1,     1,     1,     4,     6,     5,     1,     3,     1,
+       5,     5,     5,     3,     1,     0,     1,     1,     0,     1,
+       5,     1,     4,     0,     2,     1,     3,     1,     2,     2,
+       1,     1,     2,     1,     1,     0,     5,     5,     2,     4,
+       1,     0,     3,     1,     3,     0,     2,     3,     1,     3,
+       1,     0,     3,     0,     2,     2,     0,     2,     2,     0,
+       2,     2,     2,     1,     3,     2,     0,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     2,     1,
+       3,     3,     6,     6,     0,     1,     1,     3,     3,     3,
+       3,     1,     3,     4,     3,     5,     5,     7,     7,     1,
+       3,     4,     1,     1,     1,     2,     1,     3,     3,     3,
+       3,     4,     3,     1,     3,     3,     3,     3,     3,     3,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     4,     2,     3,     3,     3,     3,     2,     2,     3,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       4,     1,     1,     1,     1,     1,     1,     1,     1,     5,
-       3,     1,     3,     0,     3,     0,     3,     0,     3,     1,
-       1,     1,     1,     2,     1,     2,     2,     4,     2,     1,
-       2,     2,     0,     3,     2,     2,     3,     2,     3,     4,
-       1,     3,     1,     1,     1,     1,     6,     2,     2,     2,
-       2,     2,     0,     2,     8,     8,     6,     6,     6,     3,
-       8,     1,     3,     1,     3,     3,     2,     0,     2,     1,
-       1,     3,     1,     3,     1,     3,     4,     6,     5,     5,
-       4,     6,     1,     1,     1,     0,     3,     0,     3,     0,
-       3,     0,     1,     3,     3,     1,     1,     1,     1,     1,
-       1,     1,     2,     1,     2,     2,     2,     3,     1,     2,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     2,
-       4,     4,     1,     2,     2,     2,     2,     1,     1,     4,
-       1,     3,     5,     1,     3,     5,     6,     6,     1,     6,
-       4,     5,     4,     1,     3,     3,     3,     4,     1,     2,
-       4,     1,     2,     0,     2,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     4,     4,     4,     1,     4,
-       1,     1,     1,     1,     1,     1,     4,     6,     1,     4,
-       6,     1,     2,     1,     1,     1,     1,     4,     1,     4,
-       6,     1,     4,     1,     4,     6,     1,     1,     1,     1,
-       1,     1,     2,     1,     1,     3,     1,     3,     1,     1,
+       3,     3,     4,     2,     3,     3,     3,     3,     2,     2,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     4,     1,     1,     1,     1,     1,     1,     1,     1,
+       5,     3,     1,     3,     0,     3,     0,     3,     0,     3,
+       1,     1,     1,     1,     2,     1,     2,     2,     4,     2,
+       1,     2,     2,     0,     3,     2,     2,     3,     2,     3,
+       4,     1,     3,     1,     1,     1,     1,     6,     2,     2,
+       2,     2,     2,     0,     2,     8,     8,     6,     6,     6,
+       3,     8,     1,     3,     1,     3,     3,     2,     0,     2,
+       1,     1,     3,     1,     3,     1,     3,     4,     6,     5,
+       5,     4,     6,     1,     1,     1,     0,     3,     0,     3,
+       0,     3,     0,     1,     3,     3,     1,     1,     1,     1,
+       1,     1,     1,     2,     1,     2,     2,     2,     3,     1,
+       2,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       2,     4,     4,     1,     2,     2,     2,     2,     1,     1,
+       4,     1,     3,     5,     1,     3,     5,     6,     6,     1,
+       6,     4,     5,     4,     1,     3,     3,     3,     4,     1,
+       2,     4,     1,     2,     0,     2,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     4,     4,     4,     1,
+       4,     1,     1,     1,     1,     1,     1,     4,     6,     1,
+       4,     6,     1,     2,     1,     1,     1,     1,     4,     1,
+       4,     6,     1,     4,     1,     4,     6,     1,     1,     1,
+       1,     1,     1,     2,     1,     1,     3,     1,     3,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
@@ -2195,21 +2197,21 @@ static const yytype_uint8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     3,     1,
-       1,     1,     1,     1,     2,     2,     3,     4,     0,     1,
-       2,     1,     1,     1,     3,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     5,     5,     5,     7,
-       0,     2,     4,     6,     4,     2,     4,     2,     1,     4,
-       1,     3,     2,     0,     2,     1,     1,     2,     1,     3,
-       1,     0,     2,     3,     3,     3,     3,     4,     7,     0,
-       2,     1,     3,     2,     1,     0,     2,     1,     6,     2,
-       2,     7,     1,     0,     2,     8,     1,     0,     3,     1,
-       1,     3,     1,     1,     2,     4,     0,     1,     3,     3,
-       5,     6,     1,     1,     1,     1,     0,     2,     2,     4,
-       1,     3,     1,     1,     1,     1,     3,     2,     2,     0,
-       1,     2,     2,     0,     1,     5,     1,     1,     3,     3,
-       1,     1,     0,     2,     1,     2,     1,     0,     1,     1,
-       2,     0,     1,     2,     2,     2,     1,     1,     6
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     3,
+       1,     1,     1,     1,     1,     2,     2,     3,     4,     0,
+       1,     2,     1,     1,     1,     3,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     5,     5,     5,
+       7,     0,     2,     4,     6,     4,     2,     4,     2,     1,
+       4,     1,     3,     2,     0,     2,     1,     1,     2,     1,
+       3,     1,     0,     2,     3,     3,     3,     3,     4,     7,
+       0,     2,     1,     3,     2,     1,     0,     2,     1,     6,
+       2,     2,     7,     1,     0,     2,     8,     1,     0,     3,
+       1,     1,     3,     1,     1,     2,     4,     0,     1,     3,
+       3,     5,     6,     1,     1,     1,     1,     0,     2,     2,
+       4,     1,     3,     1,     1,     1,     1,     3,     2,     2,
+       0,     1,     2,     2,     0,     1,     5,     1,     1,     3,
+       3,     1,     1,     0,     2,     1,     2,     1,     0,     1,
+       1,     2,     0,     1,     2,     2,     2,     1,     1,     6
 };
 
 /* YYDEFACT[STATE-NAME] -- Default rule to reduce with in state
@@ -2217,857 +2219,1007 @@ static const yytype_uint8 yyr2[] =
    means the default is an error.  */
 static const yytype_uint16 yydefact[] =
 {
-       0,     0,    19,     0,     0,   491,     0,   428,   428,     0,
-       0,     0,    17,     0,     0,    20,    23,     0,     0,     7,
-       5,    11,    13,     9,     3,     0,    21,     0,    80,    22,
-       0,   455,     0,   165,     0,     0,     0,     0,    30,    31,
+       0,     0,    19,     0,     0,   492,     0,   428,   428,     0,
+       0,     0,    17,     0,    20,    23,     0,     0,     7,     5,
+      11,    13,     9,     3,     0,    21,     0,    80,    22,     0,
+       0,   456,     0,   165,     0,     0,     0,     0,    30,    31,
       24,    25,    26,    29,    27,   138,   137,   135,   136,    33,
-     139,    28,   402,   401,   407,   406,   403,   405,   404,   515,
-     533,   521,   522,   570,     0,    18,     0,   886,   887,   889,
-     890,   891,   892,   894,   896,   941,   899,   907,   966,   930,
-     904,   943,   918,   929,   923,   902,   965,   924,   913,   914,
-     915,   911,   905,   921,   944,   945,   946,   947,   948,   949,
-     950,   951,   952,   953,   954,   955,   956,   957,   958,   959,
-     960,   922,   888,   962,   961,   909,   903,   895,   928,   963,
-     964,   937,   916,   939,   940,   938,   935,   936,   912,   897,
-     901,   927,   925,   898,   900,   917,   942,   920,   910,   931,
-     932,   933,   934,   906,   908,   926,   919,     0,   800,   893,
-     492,   493,     0,     0,   427,   431,   431,   409,     0,   415,
-       0,   518,   264,   491,     0,   715,   713,   714,   311,     0,
-     710,   712,   264,     0,     0,     0,     0,     0,     0,   972,
-     971,     0,   975,   880,   881,   882,   883,   884,   885,    99,
-     264,   264,    98,    94,   103,   264,     0,     0,     0,    84,
-      86,     0,    95,    96,    70,   879,     0,     0,     0,     0,
-       0,   415,     0,     0,     0,   970,     0,     0,     0,   258,
-       0,   261,   260,     0,   829,     1,     0,     0,     0,     0,
+     139,    28,   402,   401,   407,   406,   403,   405,   404,   516,
+     534,   522,   523,   571,     0,    18,     0,   887,   888,   890,
+     891,   892,   893,   895,   897,   942,   900,   908,   967,   931,
+     905,   944,   919,   930,   924,   903,   966,   925,   914,   915,
+     916,   912,   906,   922,   945,   946,   947,   948,   949,   950,
+     951,   952,   953,   954,   955,   956,   957,   958,   959,   960,
+     961,   923,   889,   963,   962,   910,   904,   896,   929,   964,
+     965,   938,   917,   940,   941,   939,   936,   937,   913,   898,
+     902,   928,   926,   899,   901,   918,   943,   921,   911,   932,
+     933,   934,   935,   907,   909,   927,   920,     0,   801,   894,
+     493,   494,     0,     0,   427,   431,   431,   409,     0,   415,
+     492,     0,   716,   714,   715,   311,     0,   711,   713,   264,
+       0,     0,     0,     0,     0,     0,   973,   972,     0,   976,
+     881,   882,   883,   884,   885,   886,    99,   264,   264,    98,
+      94,   103,   264,     0,     0,     0,    84,    86,     0,    95,
+      96,    70,   880,     0,     0,     0,     0,     0,   415,     0,
+       0,     0,     0,   519,   264,   971,     0,     0,     0,   258,
+       0,   261,   260,     0,   830,     1,     0,     0,     0,     0,
        0,   180,   179,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,   164,     0,     0,     0,   132,   133,
        0,   134,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   398,   780,   782,   781,
-     930,   901,   917,   932,     0,     0,   962,   961,   920,    36,
-      37,     0,   254,     2,     0,   534,   534,   534,   572,    15,
-     498,     0,     0,   973,   886,   887,   889,   890,   891,   892,
-     786,   785,   784,   787,   788,     0,     0,     0,   876,   797,
-     798,   722,   722,   722,   722,   722,   664,     0,   486,     0,
+       0,     0,     0,     0,     0,     0,   398,   781,   783,   782,
+     931,   902,   918,   933,     0,     0,   963,   962,   921,    36,
+      37,     0,   254,     2,     0,   535,   535,   535,   573,    15,
+     499,     0,     0,   974,   887,   888,   890,   891,   892,   893,
+     787,   786,   785,   788,   789,     0,     0,     0,   877,   798,
+     799,   723,   723,   723,   723,   723,   665,     0,   487,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     733,     0,   931,   932,   933,   934,     0,     0,     0,     0,
-     678,   677,   542,   737,   567,   598,   569,   588,   589,   590,
-     591,   592,   593,   594,     0,   595,   661,   660,   596,   632,
-     676,   665,     0,   667,   669,   671,   672,   540,   731,   662,
-       0,     0,     0,   668,   663,   739,   792,   666,   674,   673,
-       0,     0,   803,   783,   675,   986,   987,   988,   989,   990,
-     991,   992,   993,   994,   995,   752,   476,     0,   408,   432,
-     410,     0,     0,     0,   412,   416,   417,     0,   516,   520,
-       0,     0,   265,     0,   532,     0,     0,   578,     0,     0,
-      12,    14,     0,     0,     0,   100,   101,    93,   102,    88,
-      89,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   415,   414,   168,     0,     0,     0,     0,   570,   457,
-       0,     0,     0,     0,   456,   184,   183,     0,   182,   181,
+     734,     0,   932,   933,   934,   935,     0,     0,     0,     0,
+     679,   678,   543,   738,   568,   599,   570,   589,   590,   591,
+     592,   593,   594,   595,     0,   596,   662,   661,   597,   633,
+     677,   666,     0,   668,   670,   672,   673,   541,   732,   663,
+       0,     0,     0,   669,   664,   740,   793,   667,   675,   674,
+       0,     0,   804,   784,   676,   987,   988,   989,   990,   991,
+     992,   993,   994,   995,   996,   753,   477,     0,   408,   432,
+     410,     0,     0,     0,   412,   416,   417,     0,   533,     0,
+       0,     0,   579,   265,     0,     0,    12,    14,     0,     0,
+       0,   100,   101,    93,   102,    88,    89,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   415,   414,   168,
+       0,     0,     0,     0,   517,   521,     0,     0,   571,   458,
+       0,     0,     0,     0,   457,   184,   183,     0,   182,   181,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      64,   909,    53,    49,   264,   264,     0,     0,     0,   390,
+      64,   910,    53,    49,   264,   264,     0,     0,     0,   390,
      141,     0,     0,     0,     0,     0,   398,   393,   393,   393,
      389,   398,   398,   398,   391,   392,   400,   399,   382,     0,
-      44,    42,     0,     0,     0,     0,   861,   856,   870,   832,
-     871,   873,   874,   845,   848,   840,   841,   843,   844,   842,
-     851,   853,   863,   867,   866,   762,   759,   761,     0,     0,
-     854,   855,    38,   858,   833,   834,   838,     0,   535,   536,
-     537,   537,   537,     0,   575,     0,   472,     0,   498,   494,
-       0,   878,   801,   974,   796,   794,     0,     0,     0,     0,
-     717,   719,   718,   721,   720,     0,   624,     0,     0,   707,
-       0,     0,     0,     0,  1029,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   569,     0,   669,   803,
-     597,     0,   657,   658,     0,     0,     0,   652,   789,     0,
-     757,     0,   757,   753,   754,     0,     0,     0,   821,   823,
-       0,     0,   625,     0,     0,     0,   523,   498,     0,   736,
-       0,     0,     0,     0,     0,     0,     0,     0,   603,   603,
+      44,    42,     0,     0,     0,     0,   862,   857,   871,   833,
+     872,   874,   875,   846,   849,   841,   842,   844,   845,   843,
+     852,   854,   864,   868,   867,   763,   760,   762,     0,     0,
+     855,   856,    38,   859,   834,   835,   839,     0,   536,   537,
+     538,   538,   538,     0,   576,     0,   473,     0,   499,   495,
+       0,   879,   802,   975,   797,   795,     0,     0,     0,     0,
+     718,   720,   719,   722,   721,     0,   625,     0,     0,   708,
+       0,     0,     0,     0,  1030,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   570,     0,   670,   804,
+     598,     0,   658,   659,     0,     0,     0,   653,   790,     0,
+     758,     0,   758,   754,   755,     0,     0,     0,   822,   824,
+       0,     0,   626,     0,     0,     0,   524,   499,     0,   737,
+       0,     0,   604,   604,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   795,   793,     0,     0,     0,     0,   479,
-     476,   474,   429,     0,     0,   411,   420,   419,     0,     0,
-       0,   517,     0,     0,   542,   708,   813,   487,     0,   711,
-     712,     0,    34,     8,     6,    10,     4,     0,   976,     0,
-     489,   484,   490,   106,    74,   104,   107,    71,    72,    87,
-     960,   920,    85,    92,    91,    97,    81,    83,     0,     0,
-     413,   170,   169,     0,   168,     0,     0,   115,     0,   151,
-       0,     0,   161,   159,   157,   162,     0,     0,   142,   145,
-     154,   131,     0,   131,   131,   259,   449,   449,     0,   264,
-       0,     0,   168,     0,     0,   140,   143,   149,     0,   264,
-     264,   264,   264,     0,   346,   346,   346,     0,   166,    50,
-      52,     0,   978,     0,   224,   171,   190,     0,     0,   350,
-     351,     0,     0,   264,   393,     0,   398,   398,   398,   388,
-       0,   380,   377,   379,    48,   381,   387,    41,    45,   755,
-      46,    43,    40,     0,     0,     0,   872,     0,     0,     0,
-       0,   852,     0,   757,   757,   765,   766,   767,   768,   769,
-     761,   759,     0,   778,   779,   255,     0,     0,     0,     0,
-     571,   582,   585,   538,     0,     0,     0,   574,   573,   828,
-     969,     0,   578,   499,     0,     0,   473,     0,     0,   808,
-       0,     0,   877,   723,   771,   770,     0,     0,     0,   632,
-     985,   983,  1066,   982,  1066,     0,     0,     0,     0,  1064,
-    1065,     0,     0,  1046,  1047,   632,  1063,     0,  1062,   570,
-       0,     0,     0,   631,   629,   659,     0,     0,     0,     0,
+       0,     0,     0,   796,   794,     0,     0,     0,     0,   480,
+     477,   475,   429,     0,     0,   411,   420,   419,     0,     0,
+       0,   543,   709,   814,   488,     0,   712,   713,     0,     0,
+      34,     8,     6,    10,     4,     0,   977,     0,   490,   485,
+     491,   106,    74,   104,   107,    71,    72,    87,   961,   921,
+      85,    92,    91,    97,    81,    83,     0,     0,   413,   170,
+     169,     0,     0,     0,   168,   115,     0,   151,     0,     0,
+     161,   159,   157,   162,     0,     0,   142,   145,   154,   131,
+       0,   131,   131,   518,     0,   259,     0,   450,   450,     0,
+     264,     0,     0,   168,     0,     0,   140,   143,   149,     0,
+     264,   264,   264,   264,     0,   346,   346,   346,     0,   166,
+      50,    52,     0,   979,     0,   224,   171,   190,     0,     0,
+     350,   351,     0,     0,   264,   393,     0,   398,   398,   398,
+     388,     0,   380,   377,   379,    48,   381,   387,    41,    45,
+     756,    46,    43,    40,     0,     0,     0,   873,     0,     0,
+       0,     0,   853,     0,   758,   758,   766,   767,   768,   769,
+     770,   762,   760,     0,   779,   780,   255,     0,     0,     0,
+       0,   572,   583,   586,   539,     0,     0,     0,   575,   574,
+     829,   970,     0,   579,   500,     0,     0,   474,     0,     0,
+     809,     0,     0,   878,   724,   772,   771,     0,     0,     0,
+     633,   986,   984,  1067,   983,  1067,     0,     0,     0,     0,
+    1065,  1066,     0,     0,  1047,  1048,   633,  1064,     0,  1063,
+     571,     0,     0,     0,   632,   630,   660,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     818,   823,     0,   822,     0,     0,     0,     0,     0,   627,
-       0,   554,   553,   543,   550,   544,   552,   549,   546,   800,
-     542,   526,   528,   560,   738,   566,   600,   609,   610,   607,
-     608,   606,     0,     0,   604,   605,     0,     0,   568,   622,
-     621,   623,   599,     0,   628,   648,   633,   634,   639,   649,
-     638,   729,   656,   655,   654,   653,   635,   636,   637,     0,
-     650,   641,   643,   645,   640,   647,   646,   644,   642,   613,
-       0,   683,   735,   732,   680,     0,     0,   912,   825,     0,
-     803,     0,   890,   891,   892,   734,   804,   477,   478,   475,
-     430,     0,     0,     0,   426,   421,   422,   418,   266,     0,
-     709,     0,   580,   581,   579,   830,    35,    32,   977,     0,
+       0,   819,   824,     0,   823,     0,     0,     0,     0,     0,
+     628,     0,   555,   554,   544,   551,   545,   553,   550,   547,
+     801,   543,   527,   529,   561,   739,   567,   601,   605,   606,
+       0,     0,     0,     0,   607,   611,   609,   608,   610,   569,
+     624,   622,   623,   600,     0,   629,   649,   634,   635,   640,
+     650,   639,   654,   655,   656,   657,   730,   636,   637,   638,
+       0,   651,   641,   646,   644,   642,   643,   645,   647,   648,
+     614,     0,   684,   736,   733,   681,     0,     0,   913,   826,
+       0,   804,     0,   891,   892,   893,   735,   805,   478,   479,
+     476,   430,     0,     0,     0,   426,   421,   422,   418,   710,
+       0,   266,   581,   582,   580,   831,    35,    32,   978,     0,
        0,     0,    76,     0,    76,    90,    76,    76,     0,     0,
-       0,     0,     0,     0,   158,   827,   156,   160,   150,   146,
+       0,     0,     0,     0,   158,   828,   156,   160,   150,   146,
        0,     0,   130,   111,     0,     0,     0,   110,     0,     0,
-     224,   454,   460,     0,   460,     0,     0,   458,   459,     0,
-       0,   147,   144,   346,   174,   175,     0,   176,     0,   345,
-       0,   344,     0,     0,     0,     0,     0,     0,    55,   979,
-      51,     0,     0,     0,   199,   195,   197,   200,   198,     0,
-     201,     0,   878,     0,   173,     0,     0,   353,   354,   352,
-       0,     0,   185,   378,   398,   386,   383,   385,   395,     0,
-     396,    39,     0,   826,     0,   875,     0,     0,     0,   826,
-     868,     0,   869,   763,   764,   776,   775,     0,     0,   826,
-       0,     0,     0,     0,   586,   587,   584,     0,   531,   530,
-     529,   577,   576,   525,   497,   495,   496,   802,     0,     0,
-       0,   670,     0,     0,     0,     0,     0,  1008,  1000,     0,
-    1034,  1021,  1031,  1035,  1030,   632,  1042,  1043,     0,  1066,
-       0,  1083,  1066,   629,     0,   488,   482,   630,     0,     0,
-       0,   619,     0,     0,     0,     0,   758,     0,   790,   760,
-     791,   799,     0,     0,   819,     0,   824,   812,     0,     0,
-     810,     0,   626,     0,   553,     0,     0,     0,   510,   511,
-     512,     0,     0,     0,   507,     0,     0,   509,   908,   551,
-     559,   548,   547,     0,     0,   524,     0,   564,     0,     0,
-       0,     0,     0,   620,   651,   612,     0,     0,   685,     0,
-     746,     0,   750,     0,     0,     0,   433,   423,   424,   425,
-       0,   814,   485,     0,   105,     0,    69,     0,    68,    78,
-      79,     0,     0,   116,   119,   155,   153,   152,   398,   398,
-     398,   113,   114,   112,     0,   109,   108,   364,   438,     0,
-     437,     0,     0,     0,   148,     0,     0,   267,   336,     0,
-     348,     0,     0,    66,    67,    65,     0,   967,   981,   980,
-     165,     0,    47,    56,    57,    59,    60,    63,    61,    62,
-     256,   225,   189,   224,     0,     0,     0,   223,   202,   203,
-     205,   206,     0,     0,   192,   262,     0,     0,     0,     0,
-     178,   384,   394,     0,   862,   857,   835,   846,     0,   849,
-       0,   864,     0,   761,   773,   777,   859,     0,   836,   837,
-     839,   583,     0,     0,     0,     0,  1068,  1067,   996,   984,
-     997,   998,     0,  1066,   943,     0,  1075,     0,  1070,     0,
-    1072,  1073,     0,     0,  1066,     0,  1033,     0,     0,     0,
-       0,  1066,     0,     0,  1049,  1056,  1060,     0,     0,  1084,
-       0,   480,     0,     0,     0,     0,     0,     0,     0,     0,
-     756,   820,     0,   811,     0,   815,   816,   500,     0,   545,
-       0,     0,     0,     0,     0,     0,   508,   557,     0,   801,
-     527,     0,     0,   541,   611,   615,   614,     0,     0,     0,
-     679,     0,   687,   749,   748,     0,     0,   805,   519,    75,
-      77,    73,     0,   118,   128,   129,   127,     0,     0,   365,
-       0,   450,     0,   466,   468,   470,   443,   443,     0,     0,
-     177,   491,   904,   918,     0,     0,     0,     0,     0,   280,
-     292,   293,   286,   287,   288,   291,   289,   276,   277,   294,
-     305,   304,   309,   308,   307,   306,     0,   290,   285,   284,
-     295,     0,     0,     0,     0,    54,     0,    58,   196,   878,
-       0,     0,   250,     0,   220,     0,   204,   207,   208,   213,
-     214,   215,     0,     0,   172,     0,   191,     0,   257,   355,
-     356,     0,     0,   397,     0,   831,     0,     0,   774,     0,
-       0,   562,   803,   806,   807,   716,     0,  1020,  1005,  1007,
-    1021,  1018,  1001,     0,  1078,  1077,  1069,     0,     0,     0,
-       0,     0,     0,  1022,  1032,     0,  1037,  1036,  1039,  1040,
-    1038,   632,     0,  1082,  1081,   632,  1048,  1050,  1052,  1053,
-       0,  1057,     0,  1061,  1108,   483,     0,     0,     0,     0,
-     728,     0,   726,   727,     0,   817,   809,     0,   504,     0,
-     501,     0,     0,   503,   502,     0,     0,     0,   561,   565,
-     602,   601,   684,     0,   689,   690,   682,     0,   747,   751,
-       0,     0,   124,     0,   122,     0,     0,   461,     0,     0,
-       0,   436,     0,     0,   449,   449,     0,     0,     0,     0,
-     310,     0,   313,   920,   318,   317,   319,     0,   327,   329,
-       0,     0,   280,   336,     0,   337,   347,     0,   336,   343,
-       0,   968,     0,   251,     0,   216,   660,   209,   245,     0,
-       0,     0,     0,   246,   218,   249,   224,     0,   194,     0,
-       0,   369,     0,     0,     0,   188,   847,   850,   865,   860,
-     539,     0,     0,     0,     0,     0,  1017,     0,   999,  1071,
-    1074,  1076,     0,     0,     0,     0,  1028,  1041,     0,  1054,
-    1080,     0,     0,     0,     0,     0,   481,   617,   616,     0,
-       0,     0,   555,   506,   514,   513,   505,     0,   558,   686,
-       0,     0,     0,   632,   702,   691,   694,   692,     0,     0,
-     125,   126,   123,   121,   451,   469,   467,   471,     0,   445,
-     447,   460,   460,     0,     0,     0,   275,     0,   314,     0,
-       0,   280,   328,     0,     0,   324,   329,   280,   336,     0,
-       0,     0,     0,   928,   270,     0,     0,     0,     0,   244,
-       0,   247,   264,     0,   211,   193,   263,   366,   366,   357,
-     358,     0,   349,   373,   163,   186,   187,   563,   804,  1015,
-       0,  1010,  1013,  1006,  1019,  1002,  1004,  1023,     0,  1026,
-    1025,  1024,  1079,  1051,     0,     0,  1045,     0,     0,     0,
-    1097,  1086,  1087,   730,   724,   725,   556,     0,   695,   693,
-     696,     0,   688,   117,   120,     0,   444,     0,   448,   462,
-     462,     0,   272,     0,     0,   315,     0,   280,   330,     0,
-       0,   325,     0,   332,     0,   281,   280,     0,     0,     0,
-       0,     0,     0,   264,   221,     0,   242,   210,   224,   364,
-     367,   364,   364,   364,   359,     0,     0,   336,  1009,     0,
-       0,  1012,     0,  1027,  1055,  1058,  1059,  1092,  1096,  1095,
-    1091,  1092,  1090,     0,     0,     0,  1085,  1098,  1099,  1101,
-       0,     0,   704,     0,   705,   452,   446,   463,   464,   464,
-     167,   268,   312,     0,   320,   326,     0,   322,   280,     0,
-     280,     0,     0,   281,   278,   336,   342,     0,   340,   269,
-     271,   273,   274,   242,     0,   219,   253,   238,   233,   212,
-       0,     0,     0,     0,   371,   372,   370,   374,     0,   300,
-     301,   298,   299,   375,   302,   368,   297,   296,   303,  1011,
-    1016,  1014,  1003,     0,  1089,  1088,  1104,  1107,  1103,  1106,
-    1105,  1100,  1102,     0,     0,   632,   697,   699,   706,   703,
-       0,   466,   466,   316,   281,   323,   321,   333,     0,     0,
-     279,     0,     0,   233,     0,   240,   241,   239,   243,     0,
-     234,   235,   248,   363,   361,   362,   360,   282,  1094,  1093,
-     700,   698,   701,   465,   435,   439,   280,   331,   338,   341,
-     252,   222,     0,     0,     0,   237,     0,   236,   336,     0,
-     434,   332,   335,   339,   227,   228,     0,     0,   232,   231,
-     376,     0,     0,   334,   226,   229,   230,   283,     0,   441,
-     440,     0,   442
+     224,     0,     0,   439,   469,   471,   455,   461,     0,   461,
+       0,     0,   459,   460,     0,     0,   147,   144,   346,   174,
+     175,     0,   176,     0,   345,     0,   344,     0,     0,     0,
+       0,     0,     0,    55,   980,    51,     0,     0,     0,   199,
+     195,   197,   200,   198,     0,   201,     0,   879,     0,   173,
+       0,     0,   353,   354,   352,     0,     0,   185,   378,   398,
+     386,   383,   385,   395,     0,   396,    39,     0,   827,     0,
+     876,     0,     0,     0,   827,   869,     0,   870,   764,   765,
+     777,   776,     0,     0,   827,     0,     0,     0,     0,   587,
+     588,   585,     0,   530,   531,   532,   578,   577,   526,   498,
+     496,   497,   803,     0,     0,     0,   671,     0,     0,     0,
+       0,     0,  1009,  1001,     0,  1035,  1022,  1032,  1036,  1031,
+     633,  1043,  1044,     0,  1067,     0,  1084,  1067,   630,     0,
+     489,   483,   631,     0,     0,     0,   620,     0,     0,     0,
+       0,   759,     0,   791,   761,   792,   800,     0,     0,   820,
+       0,   825,   813,     0,     0,   811,     0,   627,     0,   554,
+       0,     0,     0,   511,   512,   513,     0,     0,     0,   508,
+       0,     0,   510,   909,   552,   560,   549,   548,     0,     0,
+     525,     0,   565,     0,     0,     0,     0,     0,   621,   652,
+     613,     0,     0,   686,     0,   747,     0,   751,     0,     0,
+       0,   433,   423,   424,   425,   815,   486,     0,   105,     0,
+      69,     0,    68,    78,    79,     0,   116,   119,     0,   155,
+     153,   152,   398,   398,   398,   113,   114,   112,     0,   109,
+     108,     0,     0,     0,   364,   438,     0,   437,     0,     0,
+       0,   148,     0,     0,   267,   336,     0,   348,     0,     0,
+      66,    67,    65,     0,   968,   982,   981,   165,     0,    47,
+      56,    57,    59,    60,    63,    61,    62,   256,   225,   189,
+     224,     0,     0,     0,   223,   202,   203,   205,   206,     0,
+       0,   192,   262,     0,     0,     0,     0,   178,   384,   394,
+       0,   863,   858,   836,   847,     0,   850,     0,   865,     0,
+     762,   774,   778,   860,     0,   837,   838,   840,   584,     0,
+       0,     0,     0,  1069,  1068,   997,   985,   998,   999,     0,
+    1067,   944,     0,  1076,     0,  1071,     0,  1073,  1074,     0,
+       0,  1067,     0,  1034,     0,     0,     0,     0,  1067,     0,
+       0,  1050,  1057,  1061,     0,     0,  1085,     0,   481,     0,
+       0,     0,     0,     0,     0,     0,     0,   757,   821,     0,
+     812,     0,   816,   817,   501,     0,   546,     0,     0,     0,
+       0,     0,     0,   509,   558,     0,   802,   528,     0,     0,
+     542,     0,     0,   615,   616,   612,     0,   680,     0,   688,
+     750,   749,     0,     0,   806,    75,    77,    73,     0,   118,
+     128,   129,   127,     0,     0,   520,   470,   472,   365,     0,
+     451,   467,   444,   444,     0,     0,   177,   492,   905,   919,
+       0,     0,     0,     0,     0,   280,   292,   293,   286,   287,
+     288,   291,   289,   276,   277,   294,   305,   304,   309,   308,
+     307,   306,     0,   290,   285,   284,   295,     0,     0,     0,
+       0,    54,     0,    58,   196,   879,     0,     0,   250,     0,
+     220,     0,   204,   207,   208,   213,   214,   215,     0,     0,
+     172,     0,   191,     0,   257,   355,   356,     0,     0,   397,
+       0,   832,     0,     0,   775,     0,     0,   563,   804,   807,
+     808,   717,     0,  1021,  1006,  1008,  1022,  1019,  1002,     0,
+    1079,  1078,  1070,     0,     0,     0,     0,     0,     0,  1023,
+    1033,     0,  1038,  1037,  1040,  1041,  1039,   633,     0,  1083,
+    1082,   633,  1049,  1051,  1053,  1054,     0,  1058,     0,  1062,
+    1109,   484,     0,     0,     0,     0,   727,   728,     0,   729,
+       0,   818,   810,     0,   505,     0,   502,     0,     0,   504,
+     503,     0,     0,     0,   562,   566,   602,   603,   685,     0,
+     690,   691,   683,     0,   748,   752,     0,     0,   124,     0,
+     122,     0,     0,   462,     0,     0,   436,     0,   450,   450,
+       0,     0,     0,     0,   310,     0,   313,   921,   318,   317,
+     319,     0,   327,   329,     0,     0,   280,   336,     0,   337,
+     347,     0,   336,   343,     0,   969,     0,   251,     0,   216,
+     661,   209,   245,     0,     0,     0,     0,   246,   218,   249,
+     224,     0,   194,     0,     0,   369,     0,     0,     0,   188,
+     848,   851,   866,   861,   540,     0,     0,     0,     0,     0,
+    1018,     0,  1000,  1072,  1075,  1077,     0,     0,     0,     0,
+    1029,  1042,     0,  1055,  1081,     0,     0,     0,     0,     0,
+     482,   617,   618,     0,     0,     0,   556,   507,   515,   514,
+     506,     0,   559,   687,     0,     0,     0,   633,   703,   692,
+     695,   693,     0,     0,   125,   126,   123,   121,   452,   468,
+       0,   446,   448,   461,   461,     0,     0,     0,   275,     0,
+     314,     0,     0,   280,   328,     0,     0,   324,   329,   280,
+     336,     0,     0,     0,     0,   929,   270,     0,     0,     0,
+       0,   244,     0,   247,   264,     0,   211,   193,   263,   366,
+     366,   357,   358,     0,   349,   373,   163,   186,   187,   564,
+     805,  1016,     0,  1011,  1014,  1007,  1020,  1003,  1005,  1024,
+       0,  1027,  1026,  1025,  1080,  1052,     0,     0,  1046,     0,
+       0,     0,  1098,  1087,  1088,   725,   726,   731,   557,     0,
+     696,   694,   697,     0,   689,   117,   120,     0,   445,     0,
+     449,   463,   463,     0,   272,     0,     0,   315,     0,   280,
+     330,     0,     0,   325,     0,   332,     0,   281,   280,     0,
+       0,     0,     0,     0,     0,   264,   221,     0,   242,   210,
+     224,   364,   367,   364,   364,   364,   359,     0,     0,   336,
+    1010,     0,     0,  1013,     0,  1028,  1056,  1059,  1060,  1093,
+    1097,  1096,  1092,  1093,  1091,     0,     0,     0,  1086,  1099,
+    1100,  1102,     0,     0,   705,     0,   706,   453,   447,   464,
+     465,   465,   167,   268,   312,     0,   320,   326,     0,   322,
+     280,     0,   280,     0,     0,   281,   278,   336,   342,     0,
+     340,   269,   271,   273,   274,   242,     0,   219,   253,   238,
+     233,   212,     0,     0,     0,     0,   371,   372,   370,   374,
+       0,   300,   301,   298,   299,   375,   302,   368,   297,   296,
+     303,  1012,  1017,  1015,  1004,     0,  1090,  1089,  1105,  1108,
+    1104,  1107,  1106,  1101,  1103,     0,     0,   633,   698,   700,
+     707,   704,     0,   467,   467,   316,   281,   323,   321,   333,
+       0,     0,   279,     0,     0,   233,     0,   240,   241,   239,
+     243,     0,   234,   235,   248,   363,   361,   362,   360,   282,
+    1095,  1094,   701,   699,   702,   466,   435,   440,   280,   331,
+     338,   341,   252,   222,     0,     0,     0,   237,     0,   236,
+     336,     0,   434,   332,   335,   339,   227,   228,     0,     0,
+     232,   231,   376,     0,     0,   334,   226,   229,   230,   283,
+       0,   442,   441,     0,   443
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int16 yydefgoto[] =
+static const yytype_uint16 yydefgoto[] =
 {
-      -1,    32,   178,   174,   173,   177,   175,   176,    33,    34,
-      35,    36,    37,  1017,  1470,   279,  1471,  1472,   482,   779,
-     782,  1302,  1303,  1304,   778,  1295,  1473,   197,  1024,  1022,
-    1256,  1474,   208,   209,   198,   199,   200,   722,   201,   202,
-     203,   714,   715,  1475,   737,  1047,  1043,  1044,  1476,    45,
-     765,   748,   766,   749,   767,    46,   247,   248,   733,  1094,
-     249,   250,  1330,   785,   786,  1516,  1083,  1084,  1085,  1320,
-    1086,  1506,  1507,  1087,  1773,  1508,  1509,  1655,  1510,  1511,
-    1925,  1088,  1512,  2028,  1990,  1991,  1992,  1988,  1928,  1664,
-    1317,  1665,   692,  1090,   251,   218,   219,  1518,   787,   422,
-      47,  1746,    48,  1477,  1643,  2018,  1906,  1943,  1479,  1480,
-    1481,  1630,  1631,  1834,  1482,  1635,  1483,  1755,  1756,  1638,
-    1639,  1753,  1484,  1912,  1485,  1486,  2022,  1847,  1648,  1070,
-    1071,    50,   791,  1100,  1671,  1779,  1780,  1450,  1861,  1782,
-    1783,  1936,  1867,  1945,   266,  1487,   801,  1109,   508,  1488,
-    1489,    54,   414,   415,   416,  1005,   155,   408,   685,    55,
-    2020,  2038,  1624,  1738,  1739,  1052,  1053,   220,  1278,  1898,
-    1971,  1621,  1453,  1454,    56,    57,    58,   681,   892,  1174,
-     709,   351,   710,  1176,   711,   152,   558,   559,   556,   922,
-    1216,  1217,  1593,   221,   160,   161,   418,    60,  1490,   222,
-     930,   931,    63,   550,   844,   352,   626,   627,   923,   924,
-    1205,  1206,  1219,  1227,  1530,  1423,   353,   354,   288,   554,
-     852,   702,   840,   841,  1136,   355,   356,   357,   358,   946,
-     359,   937,   360,   361,   597,   362,   953,   363,   623,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,  1237,  1238,
-    1432,  1606,  1607,  1724,  1725,  1726,  1727,  1966,  1967,  1822,
-     373,   598,   169,   170,   375,   570,   376,   377,   378,   629,
-     379,   380,   381,   382,   383,   615,   904,   610,   612,   540,
-     831,   866,   832,  1345,   833,   834,   541,   384,   385,   386,
-     928,   387,   388,   860,   389,   698,   917,   910,   911,   618,
-     619,   914,   989,  1112,  1034,   848,   223,  1014,  1524,  1110,
-    1121,   390,   544,   545,   391,  1091,   716,   205,   599,   149,
-    1298,  1015,   224,  1113,   393,    64,   182,  1078,  1079,  1299,
-     871,   872,   873,   394,   395,   396,   397,   398,  1363,  1158,
-    1538,  1790,  1791,  1871,  1792,  1951,  1539,  1540,  1541,  1374,
-    1553,   399,   877,  1161,  1162,  1163,  1376,  1557,   400,  1379,
-     401,  1167,  1381,   402,   884,  1169,  1383,  1566,  1567,  1568,
-    1569,  1570,  1704,   403,   404,   887,   881,  1153,   878,  1367,
-    1368,  1691,  1369,  1370,  1371,  1699,  1700,  1388,  1389,  1810,
-    1811,  1881,  1882,  1954,  1999,  1812,  1879,  1886,  1887,  1961,
-    1888,  1889,  1960,  1958,   405
+       0,    32,   175,   171,   170,   174,   172,   173,    33,    34,
+      35,    36,    37,  1017,  1476,   279,  1477,  1478,   482,   780,
+     783,  1309,  1310,  1311,   779,  1302,  1479,   194,  1024,  1022,
+    1260,  1480,   205,   206,   195,   196,   197,   720,   198,   199,
+     200,   712,   713,  1481,   735,  1047,  1043,  1044,  1482,    45,
+     766,   746,   767,   747,   768,    46,   247,   248,   731,  1099,
+     249,   250,  1337,   786,   787,  1522,  1088,  1089,  1090,  1327,
+    1091,  1512,  1513,  1092,  1775,  1514,  1515,  1659,  1516,  1517,
+    1927,  1093,  1518,  2030,  1992,  1993,  1994,  1990,  1930,  1668,
+    1324,  1669,   698,  1095,   251,   218,   219,  1524,   788,   423,
+      47,  1748,    48,  1483,  1647,  2020,  1908,  1945,  1485,  1486,
+    1487,  1634,  1635,  1836,  1488,  1639,  1489,  1757,  1758,  1642,
+    1643,  1755,  1490,  1914,  1491,  1492,  2024,  1849,  1652,  1075,
+    1076,    50,   792,  1105,  1675,  1781,  1782,  1459,  1863,  1784,
+    1785,  1938,  1869,  1947,   266,  1493,   802,  1114,   508,  1494,
+    1495,    54,   414,   415,   416,  1006,   155,   408,   685,    55,
+    2022,  2040,  1628,  1740,  1741,  1057,  1058,   220,  1285,  1900,
+    1973,  1626,  1053,  1054,    56,    57,    58,   681,   893,  1179,
+     707,   351,   708,  1181,   709,   152,   558,   559,   556,   923,
+    1221,  1222,  1599,   221,   212,   213,   454,    60,  1496,   222,
+     931,   932,    63,   550,   845,   352,   626,   627,   924,   925,
+    1210,  1211,  1224,  1232,  1536,  1430,   353,   354,   288,   554,
+     853,   700,   841,   842,  1141,   355,   356,   357,   358,   940,
+     359,   944,   360,   361,   597,   362,   954,   363,   623,   364,
+     365,   366,   367,   368,   369,   370,   371,   372,  1242,  1243,
+    1439,  1612,  1613,  1728,  1729,  1730,  1731,  1968,  1969,  1824,
+     373,   598,   166,   167,   375,   570,   376,   377,   378,   629,
+     379,   380,   381,   382,   383,   615,   905,   610,   612,   540,
+     832,   867,   833,  1352,   834,   835,   541,   384,   385,   386,
+     929,   387,   388,   861,   389,   695,   918,   911,   912,   618,
+     619,   915,   990,  1117,  1034,   849,   223,  1014,  1530,  1115,
+    1126,   390,   544,   545,   391,  1096,   714,   202,   599,   149,
+    1305,  1015,   224,  1118,   393,    64,   179,  1083,  1084,  1306,
+     872,   873,   874,   394,   395,   396,   397,   398,  1370,  1163,
+    1544,  1792,  1793,  1873,  1794,  1953,  1545,  1546,  1547,  1381,
+    1559,   399,   878,  1166,  1167,  1168,  1383,  1563,   400,  1386,
+     401,  1172,  1388,   402,   885,  1174,  1390,  1572,  1573,  1574,
+    1575,  1576,  1708,   403,   404,   888,   882,  1158,   879,  1374,
+    1375,  1695,  1376,  1377,  1378,  1703,  1704,  1395,  1396,  1812,
+    1813,  1883,  1884,  1956,  2001,  1814,  1881,  1888,  1889,  1963,
+    1890,  1891,  1962,  1960,   405
 };
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -1740
+#define YYPACT_NINF -1781
 static const yytype_int16 yypact[] =
 {
-    1400,    19, -1740,    44, 15503,   538,   -97,   340,   340, 15503,
-     362,   367, -1740, 15503,    89, -1740, -1740, 12623, 15503, -1740,
-   -1740, -1740, -1740, -1740, -1740,   482, -1740,   525,   132,    67,
-     173,   339,   490,  1154,   392, 12911, 11759,   352, -1740, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740,
-   -1740, -1740, -1740,   784,   390, -1740, 15503, -1740, -1740, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1740, -1740,   305,   257, -1740,
-   -1740, -1740,  4141, 15503, -1740,   422,   422, -1740, 15503,   807,
-      82, -1740,   442,   538,   687, -1740, -1740, -1740, -1740,   472,
-   -1740,   287,   442,  2662,  2662,  1400,  1400,  2662,  2662, -1740,
-   -1740,   507, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740,
-     442,   442, -1740,   452, -1740,   442,   410,   248,   458, -1740,
-     406,   485,   430, -1740, -1740, -1740,   511,   514,   394,  1281,
-     695,   807, 14351, 15503, 15503, -1740,   599,   775,   531, -1740,
-      66, -1740, -1740,  -160, -1740, -1740,   737, 15503,   811, 15503,
-     586, -1740, -1740,   561,   601,   607,   623, 15503, 15503, 15503,
-   15503, 15503, 15791, 15503, -1740, 15503, 15503,   657, -1740, -1740,
-     626, -1740, 15503, 15503,   610,   501, 15503, 15503, 15503, 15503,
-   15503, 15503, 15503, 15503, 15503, 15503,   923, -1740, -1740, -1740,
-     589, 15503, 15503,   528,   772,   813,   702,   734, 15503,   684,
-   -1740,  1083, -1740, -1740,   922,   548,   548,   548,   740, -1740,
-     749, 14639, 15503,  1035,  1035,  1035,  1038,   873,   876,   879,
-   -1740, -1740, -1740, -1740, -1740,   886,   898,  1049, -1740, -1740,
-   -1740,   907,   907,   907,   907,   907, -1740,   909, -1740,   924,
-     974, 15503,   955,   960,   964,   968,   973,   978,   989,  1014,
-    1022,  1028,  1030,  3127,  4479,  8720,  8720,  1036,  1040,  1048,
-   -1740,  8720,  1035,   387,   434,   114,  6473,  1056,  1061,  4479,
-   -1740, -1740,   418,   857,  1032, -1740,  1377, -1740, -1740, -1740,
-   -1740, -1740, -1740, -1740, 15503, -1740, -1740, -1740, 10513, -1740,
-   -1740, -1740,   896, -1740,   895, -1740, -1740,   900, -1740, -1740,
-    1078,  1080,  1090,   948, -1740, -1740, -1740, -1740, -1740, -1740,
-    1035,  1035,   108, -1740, -1740, -1740, -1740, -1740, -1740, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1740,   444,   916, -1740,  1004,
-   -1740,   976,  1179,  1197, -1740,   962, -1740, 15503, -1740, -1740,
-   15503,   985, -1740,  4141, -1740,  6794, 12623,  1007,  1174,  1176,
-   -1740, -1740,  1177,  1178,  2050, -1740, -1740, -1740, -1740, -1740,
-   -1740,   103,  1281,   103,  1001, 13199,   378,  1202,  1203,  1205,
-     -11,   807, -1740,   831,   605,   750,   825,  1143,   809, -1740,
-      53,  1060, 15503,   775,  1025, -1740, -1740,  1151, -1740, -1740,
-     844, 15503, 15503, 15503, 15503, 15503,  1092,  1152,  1156,  1158,
-    1160, 15503,  1087,  1111,  1165,   442,   821, 15503, 15503, -1740,
-   -1740, 15503,  1107, 15503, 15503, 15503,   923,  1167,  1167,  1167,
-   -1740,   923,   923,   923, -1740, -1740, -1740, -1740, -1740, 15503,
-   -1740, -1740,    33, 15503,  8720, 15503,  1180,  1181, -1740,   680,
-   -1740, -1740, -1740,  1184,  1185, -1740, -1740, -1740, -1740, -1740,
-    1309, -1740,  1193, -1740, -1740, -1740,  1206,  1207,  1055, 15503,
-   -1740, -1740, -1740,  1208,  1210,  1216,  1217,  8720, -1740, -1740,
-    1211,  1211,  1211,    39,  1054,  4479, -1740,  1214,  -165, -1740,
-    1218, -1740,  1052, -1740, -1740, -1740,  4479,  4479,  1368,  1222,
-   -1740, -1740, -1740, -1740, -1740,   359, -1740,  1071,  1286, -1740,
-    8720,  8720,  8720,  1164,  1251,   756,  1171,  1402,  8720,   660,
-    8720,  3127,  1237,  1238,   935,  1240,   812,   190, -1740,   203,
-    1315,  3127,  1307,  1307,  8720,  8720,  8720,   943, -1740,   482,
-    1239,   482,  1239, -1740, -1740,  1035,  4479,  9905, -1740,   497,
-    8720,  8720,  1315,   486,  9017, 15503, -1740,   749, 15503, -1740,
-    4479,  4479,  8720,  8720,  8720,  8720,  1242,  1243,  1046,  1046,
-    4479,  3465,  1075,  8720,  8720,  8720,  8720,  8720,  8720,  8720,
-    8720,  8720,  8720,  8720,  8720,  8720,  8720,  7115,  8720,  8720,
-    8720,  8720,  8720,  8720,  8720,  8720,   296,  1247,  1215,  4141,
-    1250,  5155,  8720, -1740, -1740, 12047, 13775,  1145,  1237, -1740,
-     487, -1740, -1740,  1345,  1350, -1740, -1740, -1740,   696,   482,
-     807, -1740,   200,  1261,  1328, -1740, -1740, 13762,   279, -1740,
-   -1740,    54,  1201, -1740, -1740, -1740, -1740,  3127, -1740,   280,
-   -1740, -1740,   926, -1740,   208, -1740, -1740, -1740,   222, -1740,
-     610, 15503, -1740, -1740, -1740, -1740, -1740, -1740,   103,   103,
-   -1740, -1740, -1740,  1182,   831,  1163,  1172, -1740,  1346,  1283,
-     775,   775, -1740, -1740, -1740, -1740,   775,  2434,   750, -1740,
-   -1740,   658,    64,  1183,   890, -1740,    63,    63, 15503,   442,
-    1140,   775,   831,  1284,  2434,   844, -1740, -1740,  1290,  1165,
-    1165,  1165,  1165,  1228, 14927, 14927, 14927,  1213, -1740, -1740,
-   -1740,  1448,  1220, 15503, 14063,  1374, -1740,  1159,  1166, -1740,
-   -1740,   972,  1219,  1165,  1167, 15503,   923,   923,   923, -1740,
-    2383, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740,  1024,
-   -1740, -1740, -1740,  1083,   482,   482, -1740,  1451,   482,   482,
-     482, -1740,   111,  1239,  1239, -1740, -1740, -1740, -1740, -1740,
-    1207,  1206,  1204, -1740, -1740, -1740,   482,   482,   482,   482,
-    1149, -1740, 11428,  1385,    89,    89,    89, -1740, -1740, -1740,
-   -1740,    39,  1007, -1740,   909, 14639, -1740,  4479, 15503, -1740,
-    1175,  1169, -1740, -1740, -1740, -1740,  1380, 15503, 13762,    -8,
-   13762, -1740,   -48, -1740,  1349, 15503,  1331,  8720,  1186, -1740,
-   -1740,  8720, 15503, -1740,  1366,    -8, -1740,  8720, -1740,  1421,
-     996,  8720,   293, -1740, -1740, -1740,  1039,  4479, 13487,  2860,
-   11747,  2775,  1353,  1244,  1035,  1355,  1035,  1055,  1230,  8720,
-   -1740,   659,  8720, -1740,  1221,  2910,  1194,   300,  4479, -1740,
-    2541, -1740, -1740,  1225, -1740,   868, 16079, 16079, 16079,   228,
-      25, -1740, -1740,  1437, -1740, -1740,  1440, -1740, 10819, -1740,
-   -1740, -1740,  7436,  7436, -1740, -1740,  4479,  4479, -1740, -1740,
-   -1740, -1740, -1740,   909, -1740, 13762,  1307,  1307,  1307,  1307,
-    1307,  1307,  1307,  1307,  1307,  1307,  1327,  1327,   709,  8720,
-     943,   757,   757,   757,   757,  1422,  1422,  1422,  1422, -1740,
-    1459,  1254, -1740, -1740, -1740,  8720,  1396,  8720, 13762,  1401,
-     236,  1231,  1413,  1416,  1417, -1740,   243, -1740,  1252, -1740,
-   -1740, 15503,  1150,  1501, -1740, -1740, -1740, -1740, -1740,    89,
-   -1740,  8720, -1740, -1740, -1740, -1740, -1740, -1740, -1740,  7436,
-    1335,   103,  1486,  1343,  1486, -1740,    51,    51,  1035,  1348,
-   15503, 15503,   775,   104, -1740, -1740, -1740, -1740, -1740, -1740,
-   15503, 15503, -1740, -1740, 15503,  1507,  1157, -1740, 15503, 15503,
-   15215, -1740,  1491,  1288,  1491,  1494,  1495, -1740, -1740,  1351,
-     775, -1740, -1740, 14927, -1740, -1740,  1352, -1740, 15503, -1740,
-    1435,  1270,  2434,  1438,  1439,   665,  1341, 15503,   803, -1740,
-   -1740, 15503, 15503,   317, -1740, -1740, -1740, -1740, -1740,  -120,
-   -1740,  1767,   136, 15503, -1740,   599,   599, -1740,  1297, -1740,
-    1364, 15503,  1369, -1740,   923, -1740, -1740, -1740, -1740,  1445,
-    1294, -1740,  1465, -1740,  1467, -1740,  1475,   334,  1478,  1313,
-   -1740,   345, -1740, -1740, -1740, -1740,  1376,  1259,  1480,  1319,
-    1487,  1489,  1490,  8720, -1740, -1740, -1740,  1492, -1740, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740,  2434,  2434,
-    8720, -1740,    15,  1493,  8720,  1496,  1497, -1740,  1320,  7757,
-   13762,   146, -1740,  1347, -1740,   461, -1740,  1332,  1563,  1349,
-    1500,  1514,  1349,  1003,   369, -1740, -1740, -1740,  1504,  1505,
-    1506,  1315,  8720,  8720,  8720,  8720, -1740,  1387, -1740, -1740,
-   -1740, -1740,  8720,  9294, -1740,  1372, 13762, -1740,  8720,  8720,
-   -1740,  8720,  1315,  2541,  1510,   868,    89,  9017, -1740, -1740,
-   -1740,  1053,  1608,  9017, -1740,  9017,  1610,  1616, 15503, -1740,
-    1519, -1740, -1740, 12623, 15503, -1740,  1588,  1586,  1035,   391,
-     417,  1397,  1533, -1740, 13762, -1740,  1590,  1522,  1593,  1525,
-   -1740,  1526, -1740, 12335,  8720, 15503, -1740, -1740, -1740, -1740,
-    1527, -1740, -1740,  1441, -1740,   665, -1740,  1443, -1740, -1740,
-   -1740,  1683,  1035, -1740, -1740, -1740, -1740, -1740,   923,   923,
-     923, -1740, -1740, -1740,   396, -1740, -1740,  1384, -1740,  1035,
-   -1740,   252,    45,  1035, -1740,  1530,  1703, -1740,  9611, 15503,
-   -1740,  1477,  1488, -1740, -1740, -1740, 15503, -1740,  1381, -1740,
-    1227,   698, -1740,   803, -1740, -1740, -1740, -1740, -1740, -1740,
-   -1740, -1740, -1740, 14063,  1462,  1463,   442, -1740, -1740, -1740,
-   -1740,   782,  1464,  1722,  1557,  1559, 15503, 15503,  1560,  1655,
-   -1740, -1740, -1740,  2434, -1740, -1740, -1740, -1740,   482, -1740,
-     482, -1740,   482,  1207, -1740, -1740, -1740,   482, -1740, -1740,
-   -1740, -1740, 15503,  1561,  1564, 12035, -1740, -1740, -1740, -1740,
-   -1740, -1740,  5476,  1349,  1498,  8720, 13762,   426, -1740,  1418,
-   -1740, -1740,   872,  8720,  1349, 15503, -1740,  1596,  1597,  1567,
-    8720,  1349,   306,  8720, -1740,  1563, -1740,  1466,  1569, -1740,
-    1570, -1740,  8720,  8720,  7436,  7436,  9004, 12323, 11126,  2806,
-   -1740, -1740,  8720, -1740, 12611, -1740, -1740, -1740,   -47,   868,
-    9017,  1671,  9017,   619,   619,  9017, -1740,  1576, 15503,   246,
-   -1740, 15503,  4479, -1740, -1740, -1740, -1740,  4479,  4479, 15503,
-   -1740,  1645,    16, -1740, -1740,  1578,  1579, -1740, -1740, -1740,
-   -1740, -1740,  1427,  1482, -1740, -1740, -1740,  1508,   598, -1740,
-    1035,  1419,  1035,  1673,  1420, -1740,  1583,  1583,  1528,  1531,
-   -1740,   538,   362,   367,  1535, 12623,  3803,  8078,  4479,  1452,
-   -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1740,  1455, -1740, -1740, -1740,
-   -1740,  1425,  2434,  2478,  2478, -1740, 15503, -1740, -1740,  1591,
-     442,   442, -1740,  1641, -1740,  8720, -1740,   782, -1740, -1740,
-   -1740, -1740,   454,  1599, -1740,   318, -1740,  1546, -1740,  1442,
-    1449, 15503,   209, -1740,  1606, -1740,  1607,  1609, -1740,  1611,
-     427, -1740,  1446, -1740, -1740, -1740,  1613, 13762,  1444, -1740,
-     164, -1740,  1453,  1614, -1740, -1740, -1740,  7757, 15503,  1544,
-    1545,  1547,  1548, -1740, -1740,  1615, -1740, -1740, -1740, -1740,
-   -1740,   545,  1617, -1740, -1740,   308,  1470, -1740, -1740, -1740,
-     307, -1740,  1630, -1740, -1740, -1740,   440,   447,   455,  8720,
-   -1740,  8720, -1740, -1740,  8720, -1740, -1740, 16079, -1740,  9017,
-   -1740,   442,  4479, -1740, -1740,   619, 15503,   460,  1473, -1740,
-    1623,  1623,  1473,  8720, -1740, -1740, -1740,  4817, -1740, -1740,
-    1562,  1549, -1740,   389, -1740,  1706,  8720, -1740,  1035,   469,
-    1589, -1740,  1035, 15503,    63,    63,  1035,  1592,  4141, 15503,
-   -1740,  1646, -1740,  1652, -1740, -1740, -1740,  4479, -1740,   715,
-   10210,  1529, -1740, 10831,  4479, -1740, -1740,  1653,  9916, -1740,
-     645, -1740,  1556, -1740,  1512, -1740,  2625, -1740, -1740,  1723,
-    1659,  1572, 15503, -1740, -1740, -1740,   591,  1665, -1740,  1574,
-     932,  1725,   476,  1754,  1755, -1740, -1740, -1740, -1740, -1740,
-   -1740, 15503, 15503,  8720,  8720,  8720, -1740,  8399, -1740, -1740,
-   -1740, -1740,  1733,   322,  1734,  1736, -1740, -1740, 15503, -1740,
-   -1740,  8720,  1584,  1585,  1677,     8, -1740, -1740, -1740, 12899,
-   13187, 13475, -1740, -1740, -1740, -1740, -1740,   480, -1740,  1149,
-    5797,  1536,  1517,  1518,  1521, -1740, -1740, -1740,  1035, 15503,
-   -1740, -1740, -1740, -1740,  1515, -1740, -1740, -1740,   493, -1740,
-    1851,  1491,  1491,  1594, 15503,  1600, -1740,  1523,  8720,   631,
-    1566, -1740, -1740,  1551,  8720, -1740,   719, -1740, 10831,  1730,
-    1565, 15503,  1629,  1860, -1740,  1633,  1863, 15503,  1743, -1740,
-    4479, -1740,   442,   510, -1740, -1740, -1740,  -154,  -152,   932,
-   -1740,  1550, -1740,  1575, -1740, -1740, -1740, -1740,  1538, 13762,
-     512, -1740,  1568, -1740, -1740,  1540, -1740, -1740,  1727, -1740,
-   -1740, -1740,  1563, -1740,  1732,  1735, -1740,  1728, 15503,  1879,
-     505, -1740, -1740, -1740, -1740, -1740, -1740,  1699, -1740, -1740,
-   -1740,   281, -1740, -1740, -1740,  1035, -1740, 15503, -1740,  1828,
-    1828, 15503, -1740, 15503,   524, 13762,  1719, -1740, 10221,  1602,
-    9599, -1740,  1598,  9306,  1762,  1603, -1740,   537,  2434, 15503,
-    1889, 15503,  1892,   442,  1729,  1731,  1790, -1740,   591,  1384,
-   -1740,  1384,  1384,  1384, -1740,   941,  4479, 11136, -1740,  8720,
-   15503, -1740,  8720, -1740, -1740, -1740, -1740,  1745, -1740, -1740,
-   -1740,  1745, -1740,  1751, 15503,  1879, -1740, -1740, -1740,  1757,
-    6135,  1577, -1740,  1587, -1740, -1740, -1740, -1740,  1845,  1845,
-   -1740, -1740, -1740,  8720, -1740, 10221,  1782, -1740, -1740,  1618,
-   -1740,  4479,  1605,  1612, -1740, 10526, -1740, 15503, -1740, -1740,
-   -1740, -1740, -1740,  1790,   844, -1740, -1740,   817,  1654, -1740,
-   15503, 15503, 15503, 15503, -1740, -1740, -1740, -1740,  1619, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740,
-   -1740, -1740, -1740,  1879, -1740, -1740, -1740, -1740, -1740, -1740,
-   -1740, -1740, -1740,  1595,  1620,  1601, -1740, -1740, -1740, -1740,
-    1856,  1673,  1673, 13762, -1740, 10221, -1740, 10221,  1628,  1625,
-   -1740,  1624,  2434,  1654,   632, -1740, -1740, -1740, -1740,  1200,
-    1657,  1668, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740,
-   -1740, -1740, -1740, -1740, -1740,  1626, -1740, -1740, 15503, -1740,
-   -1740, -1740,   211,   211,  1867, -1740,  1873, -1740, 11441,  1769,
-   -1740,  9306, -1740, -1740, -1740, -1740,  1900,   347, -1740, -1740,
-   -1740,  1812,   775, -1740, -1740, -1740, -1740, -1740,   541, -1740,
-   -1740,   775, -1740
+    1902,   342, -1781,   486, 15305,   -78,   255,   542,   542, 15305,
+     576,   574, -1781,    71, -1781, -1781, 12595, 15305, -1781, -1781,
+   -1781, -1781, -1781, -1781,   136, -1781,   693,   429,    69,   106,
+   15305,   243,   642,  1054,   650, 12866, 11782,   537, -1781, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781,   690,   549, -1781, 15305, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1781, -1781,   446,   355, -1781,
+   -1781, -1781,  3609, 15305, -1781,   550,   550, -1781, 15305,   656,
+     -78,   825, -1781, -1781, -1781, -1781,   570, -1781,   405,   585,
+    8870,  8870,  1902,  1902,  8870,  8870, -1781, -1781,   608, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1781, -1781,   585,   585, -1781,
+     522, -1781,   585,   -22,  -173,   524, -1781,   468,   551,   485,
+   -1781, -1781, -1781,   568,   588,   561,  1162,   749,   656, 14221,
+   15305, 15305,    83, -1781,   585, -1781,    68,   857,   629, -1781,
+      65, -1781, -1781,   233, -1781, -1781,   670, 15305,   682, 15305,
+     661, -1781, -1781,   626,   634,   637,   649, 15305, 15305, 15305,
+   15305, 15305, 15576, 15305, -1781, 15305, 15305,   610, -1781, -1781,
+     653, -1781, 15305, 15305,   710,   565, 15305, 15305, 15305, 15305,
+   15305, 15305, 15305, 15305, 15305, 15305,   864, -1781, -1781, -1781,
+     721, 15305, 15305,   659,   793,   796,   699,   717, 15305,   618,
+   -1781,  1648, -1781, -1781,   901,   279,   279,   279,   700, -1781,
+     726, 14492, 15305,  1013,  1013,  1013,  1015,   870,   905,   914,
+   -1781, -1781, -1781, -1781, -1781,   917,   931,  1042, -1781, -1781,
+   -1781,   933,   933,   933,   933,   933, -1781,   935, -1781,   941,
+    1004, 15305,   963,   968,   969,   972,   976,   979,   980,   981,
+     982,   984,   986,  2348,  3949,  8499,  8499,   988,   989,  1005,
+   -1781,  8499,  1013,   134,   135,    90,  6266,  1014,  1016,  3949,
+   -1781, -1781,   349,   879,  1017, -1781,  1398, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781, 15305, -1781, -1781, -1781,  8768, -1781,
+   -1781, -1781,   872, -1781,   858, -1781, -1781,   865, -1781, -1781,
+    1033,  1038,  1040,   883, -1781, -1781, -1781, -1781, -1781, -1781,
+    1013,  1013,   -57, -1781, -1781, -1781, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1781,   378,   840, -1781,   938,
+   -1781,   847,  1127,  1125, -1781,   886, -1781,  3609, -1781,  6585,
+   12595, 15305,   937, -1781,  1096,  1099, -1781, -1781,  1107,  1109,
+    4629, -1781, -1781, -1781, -1781, -1781, -1781,   423,  1162,   423,
+     932, 13137,   512,  1131,  1133,  1146,   -27,   656, -1781,   697,
+     591,   895,   644, 15305, -1781, -1781,   940,  1087,   639, -1781,
+      41,  1001, 15305,   857,   973, -1781, -1781,   995, -1781, -1781,
+     532, 15305, 15305, 15305, 15305, 15305,  1031,  1108,  1115,  1116,
+    1007, 15305,  1041,  1067,  1122,   585,   651, 15305, 15305, -1781,
+   -1781, 15305,  1064, 15305, 15305, 15305,   864,  1126,  1126,  1126,
+   -1781,   864,   864,   864, -1781, -1781, -1781, -1781, -1781, 15305,
+   -1781, -1781,    40, 15305,  8499, 15305,  1128,  1129, -1781,   447,
+   -1781, -1781, -1781,  1130,  1134, -1781, -1781, -1781, -1781, -1781,
+    1256, -1781,  1135, -1781, -1781, -1781,  1136,  1137,   891, 15305,
+   -1781, -1781, -1781,  1138,  1143,  1144,  1147,  8499, -1781, -1781,
+    1153,  1153,  1153,    39,  1027,  3949, -1781,  1150,   179, -1781,
+    1151, -1781,   990, -1781, -1781, -1781,  3949,  3949,  1304,  1160,
+   -1781, -1781, -1781, -1781, -1781,   385, -1781,   903,  1225, -1781,
+    8499,  8499,  8499,  1110,  1183,   665,  1111,  1336,  8499,   519,
+    8499,  2348,  1172,  1179,   868,  1180,  1196,   102, -1781,   -53,
+    1348,  2348,  1437,  1437,  8499,  8499,  8499,  1260, -1781,   136,
+    1071,   136,  1071, -1781, -1781,  1013,  3949,  9623, -1781,   553,
+    8499,  8499,  1348,   399,  9058, 15305, -1781,   726, 15305, -1781,
+    3949,  3949,   881,   881,  1185,  1187,  8499,  8499,  8499,  8499,
+    3949,  2929,  1018,  8499,  8499,  8499,  8499,  8499,  8499,  8499,
+    8499,  8499,  8499,  8499,  8499,  8499,  8499,  6904,  8499,  8499,
+    8499,  8499,  8499,  8499,  8499,  8499,   384,  1188,  1158,  3609,
+    1193,  4948,  8499, -1781, -1781, 12053, 13679,  1088,  1172, -1781,
+     450, -1781, -1781,  1286,  1292, -1781, -1781, -1781,    59,   136,
+     656,  1272, -1781, -1781, 12040,   105, -1781, -1781,   122,    46,
+    1148, -1781, -1781, -1781, -1781,  2348, -1781,   177, -1781, -1781,
+     557, -1781,   175, -1781, -1781, -1781,   251, -1781,   710, 15305,
+   -1781, -1781, -1781, -1781, -1781, -1781,   423,   423, -1781, -1781,
+   -1781,  1132,  1105,  1118,   697, -1781,  1287,  1112,   857,   857,
+   -1781, -1781, -1781, -1781,   857,  2681,   895, -1781, -1781,  -115,
+     577,  1117,   709, -1781,  1221, -1781,   139,    54,    54, 15305,
+     585,  1084,   857,   697,  1119,  2681,   532, -1781, -1781,  1227,
+    1122,  1122,  1122,  1122,  1166, 14763, 14763, 14763,  1145, -1781,
+   -1781, -1781,  1379,  1139, 15305, 13950,  1306, -1781,  1090,  1092,
+   -1781, -1781,   731,  1161,  1122,  1126, 15305,   864,   864,   864,
+   -1781,  2283, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781,
+     809, -1781, -1781, -1781,  1648,   136,   136, -1781,  1397,   136,
+     136,   136, -1781,   420,  1071,  1071, -1781, -1781, -1781, -1781,
+   -1781,  1137,  1136,  1149, -1781, -1781, -1781,   136,   136,   136,
+     136,  1085, -1781, 10841,  1324,    71,    71,    71, -1781, -1781,
+   -1781, -1781,    39,   937, -1781,   935, 14492, -1781,  3949, 15305,
+   -1781,  1113,  1093, -1781, -1781, -1781, -1781,  1320, 15305, 12040,
+     -19, 12040, -1781,   -67, -1781,  1277, 15305,  1265,  8499,  1097,
+   -1781, -1781,  8499, 15305, -1781,  1293,   -19, -1781,  8499, -1781,
+    1337,   896,  8499,   183, -1781, -1781, -1781,   826,  3949, 13408,
+    2064, 11146,  2588,  1267,  1156,  1013,  1270,  1013,   891,  1157,
+    8499, -1781,   559,  8499, -1781,  1140,  2615,  1104,   225,  3949,
+   -1781,  8770, -1781, -1781,  1106, -1781,   952, 15847, 15847, 15847,
+     -46,    -9, -1781, -1781,  1339, -1781, -1781,  1410, -1781, -1781,
+    3949,  3949,  7223,  7223, -1781, 10232, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781,   935, -1781, 12040,  1437,  1437,  1437,
+    1437,  1437,  1437,  1437,  1437,  1437,  1437,  1334,  1334,  1206,
+    8499,  1260,   573,   573,   573,   573,  1312,  1312,  1312,  1312,
+   -1781,  1340,  1152, -1781, -1781, -1781,  8499,  1276,  8499, 12040,
+    1288,   -38,  1154,  1291,  1310,  1313, -1781,   115, -1781,  1155,
+   -1781, -1781, 15305,   944,  1369, -1781, -1781, -1781, -1781, -1781,
+    8499, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781,  7223,
+    1201,   423,  1367,  1228,  1367, -1781,    -8,    -8,  1013, 15305,
+   15305,  1232,   857,   430, -1781, -1781, -1781, -1781, -1781, -1781,
+   15305, 15305, -1781, -1781, 15305,  1396,   962, -1781, 15305, 15305,
+   15034,    71,  1013, -1781,  1159, -1781, -1781,  1380,  1175,  1380,
+    1381,  1383, -1781, -1781,  1242,   857, -1781, -1781, 14763, -1781,
+   -1781,  1238, -1781, 15305, -1781,  1325,  1163,  2681,  1330,  1332,
+     439,  1234, 15305,   823, -1781, -1781, 15305, 15305,   250, -1781,
+   -1781, -1781, -1781, -1781,  -135, -1781,  1965,   111, 15305, -1781,
+      68,    68, -1781,  1186, -1781,  1245, 15305,  1246, -1781,   864,
+   -1781, -1781, -1781, -1781,  1338,  1177, -1781,  1343, -1781,  1346,
+   -1781,  1347,   280,  1350,  1184, -1781,   315, -1781, -1781, -1781,
+   -1781,  1257,   960,  1366,  1210,  1384,  1387,  1388,  8499, -1781,
+   -1781, -1781,  1341, -1781, -1781, -1781, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781,  2681,  2681,  8499, -1781,   596,  1390,  8499,
+    1392,  1393, -1781,  1212,  7542, 12040,  -174, -1781,  1202, -1781,
+     451, -1781,  1213,  1451,  1277,  1394,  1407,  1277,   893,   324,
+   -1781, -1781, -1781,  1400,  1401,  1404,  1348,  8499,  8499,  8499,
+    8499, -1781,  1274, -1781, -1781, -1781, -1781,  8499,  9046, -1781,
+    1259, 12040, -1781,  8499,  8499, -1781,  8499,  1348,  8770,  1412,
+     952,    71,  9058, -1781, -1781, -1781,   884,  1520,  9058, -1781,
+    9058,  1525,  1530, 15305, -1781,  1433, -1781, -1781, 12595, 15305,
+   -1781,  1501,  1499,  1686,  1768,   335,   337,  1013, -1781, 12040,
+   -1781,  1503,  1438,  1508,  1440, -1781,  1442, -1781, 12324,  8499,
+   15305, -1781, -1781, -1781, -1781, -1781, -1781,  1353, -1781,   439,
+   -1781,  1356, -1781, -1781, -1781,  1605, -1781, -1781,  1013, -1781,
+   -1781, -1781,   864,   864,   864, -1781, -1781, -1781,   276, -1781,
+   -1781,  1452,   339,  1013,  1307, -1781,  1013, -1781,   139,    48,
+    1013, -1781,  1454,  1621, -1781,  9634, 15305, -1781,  1399,  1403,
+   -1781, -1781, -1781, 15305, -1781,  1289, -1781,  1235,   713, -1781,
+     823, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781,
+   13950,  1372,  1375,   585, -1781, -1781, -1781, -1781,  1091,  1364,
+    1624,  1355,  1370, 15305, 15305,  1493,  1582, -1781, -1781, -1781,
+    2681, -1781, -1781, -1781, -1781,   136, -1781,   136, -1781,   136,
+    1137, -1781, -1781, -1781,   136, -1781, -1781, -1781, -1781, 15305,
+    1494,  1495, 11453, -1781, -1781, -1781, -1781, -1781, -1781,  5267,
+    1277,  1418,  8499, 12040,   352, -1781,  1351, -1781, -1781,   783,
+    8499,  1277, 15305, -1781,  1526,  1529,  1500,  8499,  1277,   492,
+    8499, -1781,  1451, -1781,  1411,  1516, -1781,  1518, -1781,  8499,
+    8499,  7223,  7223, 10542,  1913, 11771,  2711, -1781, -1781,  8499,
+   -1781, 12584, -1781, -1781, -1781,   254,   952,  9058,  1618,  9058,
+     567,   567,  9058, -1781,  1524, 15305,   150, -1781, 15305,  3949,
+   -1781,  3949,  3949, -1781, -1781, -1781, 15305, -1781,  1592,   -15,
+   -1781, -1781,  1527,  1528, -1781, -1781, -1781, -1781,  1371,  1427,
+   -1781, -1781, -1781,  1458,   493, -1781, -1781, -1781, -1781,  1013,
+    1361,  1622,  1536,  1536,  1474,  1477, -1781,   -78,   576,   574,
+    1478, 12595,  3269,  7861,  3949,  1405, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781,
+   -1781, -1781,  1413, -1781, -1781, -1781, -1781,  1378,  2681,  2192,
+    2192, -1781, 15305, -1781, -1781,  1428,   585,   585, -1781,  1590,
+   -1781,  8499, -1781,  1091, -1781, -1781, -1781, -1781,   616,  1550,
+   -1781,    51, -1781,  1497, -1781,  1389,  1395, 15305,    47, -1781,
+    1555, -1781,  1556,  1558, -1781,  1561,   358, -1781,  1402, -1781,
+   -1781, -1781,  1564, 12040,  1414, -1781,  -109, -1781,  1416,  1565,
+   -1781, -1781, -1781,  7542, 15305,  1479,  1480,  1498,  1504, -1781,
+   -1781,  1567, -1781, -1781, -1781, -1781, -1781,   517,  1579, -1781,
+   -1781,   381,  1417, -1781, -1781, -1781,   513, -1781,  1598, -1781,
+   -1781, -1781,   368,   369,   371,  8499, -1781, -1781,  8499, -1781,
+    8499, -1781, -1781, 15847, -1781,  9058, -1781,   585,  3949, -1781,
+   -1781,   567, 15305,   372,  1421, -1781,  1573,  1573,  1421,  8499,
+   -1781, -1781, -1781,  4289, -1781, -1781,  1515,  1502, -1781,   152,
+   -1781,  1662,  8499, -1781,  1013,  1547, -1781, 15305,    54,    54,
+    1013,  1540,  3609, 15305, -1781,  1604, -1781,  1606, -1781, -1781,
+   -1781,  3949, -1781,   566,  9928,  1484, -1781, 10854,  3949, -1781,
+   -1781,  1607,  9939, -1781,   586, -1781,  1510, -1781,  1467, -1781,
+    1489, -1781, -1781,  1677,  1639,  1551, 15305, -1781, -1781, -1781,
+     554,  1641, -1781,  1557,   765,  1702,   387,  1728,  1732, -1781,
+   -1781, -1781, -1781, -1781, -1781, 15305, 15305,  8499,  8499,  8499,
+   -1781,  8180, -1781, -1781, -1781, -1781,  1710,    38,  1712,  1714,
+   -1781, -1781, 15305, -1781, -1781,  8499,  1562,  1563,  1654,   373,
+   -1781, -1781, -1781, 12855, 13002, 13126, -1781, -1781, -1781, -1781,
+   -1781,   388, -1781,  1085,  5586,  1505,  1496,  1507,  1506, -1781,
+   -1781, -1781,  1013, 15305, -1781, -1781, -1781, -1781,  1487, -1781,
+     394, -1781,  1826,  1380,  1380,  1569, 15305,  1574, -1781,  1509,
+    8499,   164,  1534, -1781, -1781,  1533,  8499, -1781,   572, -1781,
+   10854,  1703,  1537, 15305,  1603,  1838, -1781,  1612,  1841, 15305,
+    1723, -1781,  3949, -1781,   585,   395, -1781, -1781, -1781,   234,
+     286,   765, -1781,  1532, -1781,  1554, -1781, -1781, -1781, -1781,
+    1513, 12040,   404, -1781,  1538, -1781, -1781,  1517, -1781, -1781,
+    1709, -1781, -1781, -1781,  1451, -1781,  1705,  1713, -1781,  1718,
+   15305,  1871,   321, -1781, -1781, -1781, -1781, -1781, -1781,  1692,
+   -1781, -1781, -1781,    44, -1781, -1781, -1781,  1013, -1781, 15305,
+   -1781,  1820,  1820, 15305, -1781, 15305,   411, 12040,  1711, -1781,
+   10244,  1584,  9317, -1781,  1575,  9329,  1754,  1577, -1781,   412,
+    2681, 15305,  1549, 15305,  1552,   585,  1721,  1717,  1782, -1781,
+     554,  1307, -1781,  1307,  1307,  1307, -1781,   772,  3949, 11159,
+   -1781,  8499, 15305, -1781,  8499, -1781, -1781, -1781, -1781,  1737,
+   -1781, -1781, -1781,  1737, -1781,  1742, 15305,  1871, -1781, -1781,
+   -1781,  1746,  5926,  1566, -1781,  1576, -1781, -1781, -1781, -1781,
+    1842,  1842, -1781, -1781, -1781,  8499, -1781, 10244,  1771, -1781,
+   -1781,  1602, -1781,  3949,  1597,  1599, -1781, 10549, -1781, 15305,
+   -1781, -1781, -1781, -1781, -1781,  1782,   532, -1781, -1781,   678,
+    1649, -1781, 15305, 15305, 15305, 15305, -1781, -1781, -1781, -1781,
+    1608, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781, -1781,  1871, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781, -1781,  1587,  1580,  1578, -1781, -1781,
+   -1781, -1781,  1852,  1622,  1622, 12040, -1781, 10244, -1781, 10244,
+    1617,  1614, -1781,  1613,  2681,  1649,   859, -1781, -1781, -1781,
+   -1781,  1034,  1658,  1659, -1781, -1781, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1781, -1781,  1609, -1781, -1781,
+   15305, -1781, -1781, -1781,   213,   213,  1856, -1781,  1860, -1781,
+   11464,  1752, -1781,  9329, -1781, -1781, -1781, -1781,  1885,     8,
+   -1781, -1781, -1781,  1797,   857, -1781, -1781, -1781, -1781, -1781,
+     425, -1781, -1781,   857, -1781
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-   -1740,  1093, -1740, -1740, -1740, -1740, -1740, -1740,  -982,  -974,
-   -1740, -1740,  1008, -1740,    12, -1740,    18,   564, -1740,  1161,
-   -1740, -1740, -1740,   640, -1740,   690,     0,  1740, -1740, -1740,
-     105,     6, -1740, -1740,  1742, -1740,  1509, -1740, -1740, -1740,
-    1511,  -383,   931,    46, -1740, -1740, -1740,   519,    61, -1740,
-      31, -1740,  -746,  1212,  -417, -1740, -1740, -1740,  -602, -1740,
-    1918, -1740, -1740,   232, -1740, -1740, -1740,   906,   646, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1441, -1740,   342, -1740, -1740,
-   -1740, -1740,  -731,   -52,   -27,   -25,   -17, -1740,    47, -1740,
-   -1740, -1740,   -31, -1740, -1740,  -196,  -397, -1740,  -158,  -276,
-   -1740, -1379, -1740,   319, -1372, -1740, -1246,   -50, -1739, -1740,
-     583, -1740, -1740, -1740, -1740, -1740, -1740,   213, -1740,   332,
-   -1740,   216, -1740,   -43, -1740, -1740, -1740, -1740,   479,  -688,
-   -1740, -1740, -1740, -1740, -1740, -1740,   201,  -658,   204, -1740,
-   -1740, -1740, -1740, -1740,  1539,   124,  -422,   650,  -444,    24,
-      30, -1740,  -119, -1740,  1318, -1740,  2001,  1854, -1740, -1740,
-   -1740, -1740,   554, -1740,   188,  -732, -1740, -1740, -1028,   186,
-     118,  -694,   738,   567, -1740, -1740, -1740,  1354,  1357,   628,
-    -880, -1740,  -370,   634,  1009,  -156, -1740,  1168,  -147,  -866,
-     816, -1740, -1309,   135, -1740,  1621,  1020, -1740,    36,   258,
-   -1740,   808,    68,   993,   732,  -412,  1101, -1740, -1740, -1740,
-    -608, -1740,  -883, -1740, -1275, -1740,  -207,  1393,  1148, -1740,
-   -1740,  1187,   437,   908, -1740, -1740,  -248, -1740, -1740,  1404,
-   -1740,   555, -1740, -1740, -1740, -1740, -1740, -1740, -1740,  1403,
-   -1740,  -268, -1093,  1342,  -537,  -475, -1740, -1740, -1740, -1740,
-   -1740, -1740, -1740, -1740,   324, -1740, -1740, -1740, -1740, -1740,
-   -1740,   -16, -1740,  -395, -1740,   670, -1740, -1740,  1378, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1740,  -385,  -453,  -502, -1740,
-    -550, -1740, -1740, -1740, -1740,  1139, -1740,  2031, -1740,  1555,
-      77, -1323, -1740,  1503, -1740, -1740, -1740,  1170, -1740,  1456,
-   -1740,  1173,  -638,   357,  -652, -1740,  -215,  1223, -1740,  -240,
-   -1740,  -258, -1740, -1740,  -253,  -288,    20, -1740,     4, -1740,
-   -1315,  1532,  -469,   -15,  -220, -1740, -1740, -1740, -1740, -1740,
-    -518, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740,
-     384, -1740,   210, -1740, -1740, -1740, -1585, -1740,   395,   542,
-   -1740, -1740, -1740, -1740,   710, -1740, -1740, -1740, -1740, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1740, -1740, -1740,   385, -1740,
-   -1740, -1740, -1740, -1740, -1740, -1740,  1520,  -805,   725, -1740,
-     543, -1740,   724, -1740, -1740,   290, -1097, -1740, -1740, -1740,
-   -1740, -1740, -1486,   212, -1740, -1740, -1740, -1740, -1740, -1740,
-     214, -1740, -1740, -1740, -1740
+   -1781,   934, -1781, -1781, -1781, -1781, -1781, -1781,  -979,  -966,
+   -1781, -1781,  1103, -1781,    12, -1781,    18,   600, -1781,  1167,
+   -1781, -1781, -1781,   617, -1781,   669,     0,  1727, -1781, -1781,
+    -183,     6, -1781, -1781,  1729, -1781,  1519, -1781, -1781, -1781,
+    1514,  -361,   920,    50, -1781, -1781, -1781,   361,   212, -1781,
+       9, -1781,  -757,  1209,  -375, -1781, -1781, -1781,  -616, -1781,
+    1906, -1781, -1781,   190, -1781, -1781, -1781,   907,   638, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1438, -1781,   338, -1781, -1781,
+   -1781, -1781,  -753,   -54,   -31,   -29,   -21, -1781,    49, -1781,
+   -1781, -1781,   -32, -1781, -1781,  -200,  -401, -1781,  -140,  -272,
+   -1781, -1101, -1781,   320, -1279, -1781, -1257,   -47, -1780, -1781,
+     949, -1781, -1781, -1781, -1781, -1781, -1781,   217, -1781,   333,
+   -1781,   224, -1781,   -36, -1781, -1781, -1781, -1781,   502,  -693,
+   -1781, -1781, -1781, -1781, -1781, -1781,   222,  -822,   227, -1781,
+   -1781, -1781, -1781, -1781,  1568,   226,  -434,   664,  -441,    24,
+      30, -1781,  -142, -1781,  1315, -1781,  1998,  1854, -1781, -1781,
+   -1781, -1781,   545, -1781,   182,  -735, -1781, -1781, -1033,   180,
+     112,  -846,  -159,   970, -1781, -1781, -1781,  1335,  1352,   621,
+    -900, -1781,  -295,   635,  1006,  -150, -1781,  1181,  -462,  -858,
+     812, -1781, -1312,   290, -1781,  1583,   991, -1781,    36,   235,
+   -1781,   806,   153,   829,   583,  -406,  1114, -1781, -1781, -1781,
+    -610, -1781,  -901, -1781,  -668, -1781,  -254,  1406,  1165, -1781,
+   -1781,  1194,   431,   910, -1781, -1781,  -228, -1781, -1781,  1408,
+   -1781,   127, -1781, -1781, -1781, -1781, -1781, -1781, -1781,  1415,
+   -1781,  -264, -1395,  1141,  -573,  -426, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781,   325, -1781, -1781, -1781, -1781, -1781,
+   -1781,   -13, -1781,  -403, -1781,   766, -1781, -1781,  1391, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1781,  -451,  -478,  -504, -1781,
+    -546, -1781, -1781, -1781, -1781,  1164, -1781,  2004, -1781,  1541,
+      77, -1305, -1781,  1485, -1781, -1781, -1781,  1168, -1781,  1439,
+   -1781,  1169,  -637,   322,  -662, -1781,  -215,  1207, -1781,  -235,
+   -1781,  -256, -1781, -1781,  -240,  -290,    31, -1781,     4, -1781,
+   -1318,  1511,  -440,    -2,  -222, -1781, -1781, -1781, -1781, -1781,
+    -545, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781,
+     370, -1781,   191, -1781, -1781, -1781, -1588, -1781,   374,   520,
+   -1781, -1781, -1781, -1781,   685, -1781, -1781, -1781, -1781, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1781, -1781, -1781,   362, -1781,
+   -1781, -1781, -1781, -1781, -1781, -1781,  1482,  -785,   704, -1781,
+     515, -1781,   702, -1781, -1781,   265, -1081, -1781, -1781, -1781,
+   -1781, -1781, -1509,   192, -1781, -1781, -1781, -1781, -1781, -1781,
+     185, -1781, -1781, -1781, -1781
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
    positive, shift that token.  If negative, reduce the rule which
    number is the opposite.  If zero, do what YYDEFACT says.
    If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -1080
+#define YYTABLE_NINF -1081
 static const yytype_int16 yytable[] =
 {
-      41,   168,   459,   560,   421,   281,    42,   423,   148,   679,
-     181,   694,    38,   157,   427,   557,   925,   162,    39,  1062,
-     457,   171,   148,   543,    52,  1054,  1280,   865,   546,  1531,
-      53,   699,   435,   436,   991,   824,    61,   438,   750,   275,
-     282,   542,  1478,   869,  1221,  1222,    43,   204,   293,   576,
-     215,   885,   799,  1089,  1204,   696,   293,   804,   805,   806,
-     718,    44,  1229,  1230,   874,   215,  1657,  1155,  1012,  1156,
-     148,  1384,   889,   563,   564,   565,   802,   803,   847,  1051,
-    1170,   147,   164,   823,   850,   596,   600,  1073,  1074,  1036,
-    1807,   808,   452,   461,  1037,   172,  1300,   729,  1531,  1793,
-    1604,   622,  1796,  1597,  1301,  1594,  1531,  1152,   183,   184,
-     185,   186,   187,   188,   293,   215,   555,  -755,   285,   286,
-     287,  1859,   608,  1862,    51,   210,   595,  1356,  1944,  1314,
-     680,  1045,  1029,   624,   463,    59,   374,   -82,   -82,   -82,
-     -82,   -82,   -82,   290,   812,  1315,  1598,  1152,   163,    65,
-     464,  1046,    66,   211,  1602,   163,   392,   148,  1316,  1255,
-    1059,   153,   410, -1066,  1120,  1808,  1357,  1860,  1809,  1860,
-     673,   674,   855,    41,    41,    41,    41,    41,    41,    42,
-      42,    42,    42,    42,    42,    38,    38,    38,    38,    38,
-      38,    39,    39,    39,    39,    39,    39,    52,    52,    52,
-      52,    52,    52,    53,    53,    53,    53,    53,    53,    61,
-      61,    61,    61,    61,    61,  1452,   454,   148,   148,    43,
-      43,    43,    43,    43,    43,  1774,  1013,   906,   212,   204,
-     406,   467,   850,   148,    44,    44,    44,    44,    44,    44,
-     757,   148,   148,   148,   148,   480,   483,   148,   760,   148,
-     148,   916,    14,  2024,  2025,   293,   489,   148,    62,    14,
+      41,   560,   459,   165,   281,   679,    42,   870,   148,  1067,
+     417,   691,    38,   157,   926,   886,   457,   696,    39,   557,
+     168,   148,   178,  1059,    52,   543,  1287,  1226,  1227,   422,
+      53,   866,  1094,   825,   214,   992,    61,   875,  1484,   275,
+     282,   546,  1235,  1236,   293,   890,   542,   431,   432,   215,
+      43,   293,   434,   576,  1537,   800,   215,   201,   824,  1012,
+     805,   806,   807,  1209,   803,   804,   448,   756,  1610,  1056,
+     148,   563,   564,   565,   456,  1661,   748,  1036,   716,   595,
+     727,   147,  1037,  1078,  1079,   435,  1379,  1157,  1160,  1946,
+    1161,   461,  1391,  -756,   169,   150,   857,   809,   624,  1259,
+    1795,  1175,   437,  1798,  1307,   596,   600,  1603,  1040,  1600,
+    1677,  -713,  1321,   851,  2037,  -713,  1660,  1308,  1031,  1800,
+     608,   622,  -713,  1537,   693,  1893,   207,   848,  1322,  1678,
+    -713,  1537,  1671,   160,   680,  1157,   160,  -760,  -762,   374,
+     176,  1323,   293,   290,  1801,  1003,   177,  1064,   160,  1894,
+   -1067,  1379,  1004,  1005,   208,  1734,   392,   148,  1041,  1042,
+     209,   907,   410,  1380,   438,   934,   161,   151,   673,   674,
+      41,    41,    41,    41,    41,    41,    42,    42,    42,    42,
+      42,    42,    38,    38,    38,    38,    38,    38,    39,    39,
+      39,    39,    39,    39,    52,    52,    52,    52,    52,    52,
+      53,    53,    53,    53,    53,    53,    61,    61,    61,    61,
+      61,    61,    44,   450,   148,   148,  1052,   210,  1672,   813,
+      43,    43,    43,    43,    43,    43,    51,  1660,  1689,   160,
+     406,   467,  1776,   148,   436,    62,   216,   201,   758,    13,
+    1946,   148,   148,   148,   148,   480,   483,   148,   761,   148,
+     148,    13,  2038,   215,  2026,  2027,   489,   148,  1735,   851,
      148,   148,   148,   148,   500,   148,   148,   148,   148,   148,
-    1758,  1035,  1035,  1673,   575,   510,   511,  1035,  -712,  1944,
-     699,  1717,   148,   679,   458,   213,  1716,  1952,  1571,  1154,
-     455,   456,  1674,  2026,  1587,   561,   562,    51,    51,    51,
-      51,    51,    51,   613,   614,  1322,   470,  -254,    59,    59,
-      59,    59,    59,    59,   476,   477,   478,   479,   809,  1089,
-     484,  1300,   485,   486,   462,   579,   442,   788,  1125,  1301,
-     490,   750,   730,   496,   497,   498,   499,  1204,   501,   502,
-     503,   504,   505,   596,  1165,  1026,  1027,  1239,   853,  1241,
-     215,  1605,  1105,  1106,  1107,   484,   926,  1456,  1787,   859,
-     859,   896,  1224,  1891,  1385,  1832,   756,  1390,   148,  1171,
-     713,  1008,  1103,  -712,  -453,  1285,  1141,  1020,  1126,  1838,
-    1265,   350,   850,   936,   595,  1843,   206,  1892,  1021,   207,
-    -759,  1023,  1730,   952,   595,   907,   350,  1759,  -712,  1959,
-    1667,   594,  1478,   979,  1798,   163,  -712,   374,  1372,   908,
-    1382,   856,  1656,  -712,  1702, -1079,  -712,  1929,   419,   417,
-     154,   162,  1452,   935,   282,   163,  1372,   392,  1563,  1799,
-     700,    62,    62,    62,    62,    62,    62,  -761,  1123,  1124,
-     158,   642,   189,   190,   191,   192,   675,   252,   214,   148,
-    1010,  1018,  1564,   159,  2035,  1703, -1079,  1675,   189,   190,
-     191,   192,   717, -1079,  1177,  1905,   148,  1998,   593,   980,
-    1919,  1200,  1921,  -254,  1915,   148,   148,   148,   148,   148,
-     933,  2027,   283,  1373,   813,   780,  1668,   179,  1312,   543,
-     225,   792,   148,   180,   546,   148,  1731,   148,   148,   148,
-     595,  1685,   712,   699,   253,  1337,   543,  1038,    13,   216,
-     163,   546,  1844,   807,  1577,  1578,  1341,   811,   439,   282,
-     289,  1175,   724,  1656,  1061,   441,   624,   897,    13,    14,
-     183,   184,   185,   186,   187,   188,  1975,   539,  1977,   759,
-    1391,   898,   543,   835,  1377,  1021,  1058,   546,   768,   769,
-     770,   771,   772,   163,   254,   543,  -759,   609,  1543,  1021,
-     546,  1658,  1425,  1035,    40,   793,  1223,   560,   794,  1555,
-     796,   797,   798,  1111,  1243,   291,  1562,  1344,   255,   557,
-     193,  1245,  1089,    49,   858,   442,  1144,  1883,  1426,   189,
-     190,   191,   192,  2036,   902,   292,   905,  1546,  1680,  1409,
-    1378,  1056,  1122,  -761,   611,  1413,  1436,  1414,   927,   407,
-    1893,  1706,   420,    13,   676,  1894,  1011,  1019,  1707,   256,
-     257,   258,   259,   194,  1698,   426,  1708,  1659,   929,   932,
-    1178,  1718,   934,   217,  2021,  1591,  1359,  1201,   592,   194,
-    1735,  1251,   425,   594,  1447, -1079,   195,  1784,   260,  1181,
-    1146,  1816,   926,   374,  1313,  1884,    13,    14,  1885,   890,
-    1331,   261,   195,   492,  1826,   163,  1448,   262,   440,   594,
-    1202,  1338,   263,   392,  1006,   990,   625,   434,  1660,   996,
-     282,  1857,  1342,  1868,  1188,  1233,  1190,  1208,  1209,  1210,
-     677,  1211,  1212,  1213,  1214,  1902,  1613,   163,  1231,  1232,
-   -1044,   816,   817,   196,  1712,  1614,  1392,   264,  1916,   265,
-     593,   193,  2040,  1829,  1830,  1503, -1044,   763,   437,  1661,
-    1504,  1293,  1662,   678,   150,   148,   593,  1294,  1019,   493,
-     494,   495,  1663,   677,   548,   443,   593,    40,    40,    40,
-      40,    40,    40,   444,   164,   738,   445,   740,   741,   742,
-     743,   744,   745,   252,  1019,   746,    49,    49,    49,    49,
-      49,    49,   148,  1547,  1681,  1266,   678,   446,    13,   216,
-     194,  1615,   886,   447,   734,   890,   448,  1392,  1072,  1072,
-    1072,   451,  1215,  1002,  1019,   151,   215,   780,  1092,   460,
-    1003,  1004,  1019,   195,   616,   549,   912,  1496,  1025,   148,
-      13,    14,  1588,  2011,  1590,  1119,  1622,  1595,  1261,   879,
-     253,   880,   509,   539,   543,   471,  1082,  1496,  1267,   546,
-     512,  1129,  1401,   918,  1444,  1445,  1446,   919,   699,  1405,
-    1827,  1406,  1290,   543,   196,  1055,   472,  1505,   546,   491,
-     643,  1528,   593,  1561,  1616,  1284,  1565,  1858,   699,  1869,
-     818,  1321,   285,   286,   287,   735,  1985,  1986,   424,   561,
-     254,  1903,  1147,   738,   739,   740,   741,   742,   743,   744,
-     745,   148,  1104,   746,  1917,   736,   473,  1765,  2041,  1157,
-    1592,  1766,   474,  1040,   255,   284,  1166,  1987,   643,  -224,
-     543,   543,  1741,  1742,   411,   546,   546,   412,   475,  1324,
-    1325,   488,   996,   413,   927,   879,  1503,   880,  1353,  1354,
-     284,  1504,  1138,  1139,  1140,   657,   658,   659,   660,   661,
-     662,   663,   664,   665,   929,   256,   257,   258,   259,   763,
-    1220,  1220,  1220,  1041,  1042,   926,  1208,  1209,  1210,   926,
-    1211,  1212,  1213,  1214,  1151,   926,   513,   926,   764,   285,
-     286,   287,   465,   466,   260,  -224,   909,   738,   912,   740,
-     741,   742,   743,   744,   745,   506,   507,   746,   662,   663,
-     664,   665,   487,   262,   285,   286,   287,  -180,   263,  1549,
-     424,  1713,   571,   572,   573,   574,   631,   514,   594,   632,
-     633,   634,   635,   636,   637,   638,   639,   682,   683,   640,
-     641,  1064,  1065,  1066,  1067,  1246,  -224,  1082,  1424,  -179,
-     712,   712,  1637,   264,  1751,   265,  1754,  1550,  1751,  1551,
-    1552,   515,  1175,  1175,   547,  1102,   468,   469,  1505,    15,
-     555,  1215,  1585,   553,  1263,  1264,  1097,  1098,   293,  1099,
-    1502,  -870,  1443,  -742,  1268,  1269,  -744,  -224,  1270,  -740,
-    -224,    26,  1274,   148,   561,   593,   566,    27,    28,  1451,
-    -224,  1455,  1455,  1458,   686,   687,   747,  1072,   567,  1634,
-    1723,   568,  1287,   751,   643,   543,    30,   569,  1305,   575,
-     546,  1297,   731,   732,  1306,   148,  1311,   712,   516,   517,
-     518,   285,   286,   287,   577,   752,   578,  1323,   753,   754,
-     285,   286,   287,   519,  -532,   148,   894,   520,   521,   522,
-     307,   308,   523,   524,   525,   526,   527,   528,   529,   530,
-     531,  1208,  1209,  1210,  1307,   580,  1275,  1410,  1214,  1258,
-     581,  1259,  1260,  -532,   582,   532,   533,   534,   583,  1308,
-     789,   790,   926,   584,   926,   944,   945,   926,   585,  -618,
-     658,   659,   660,   661,   662,   663,   664,   665,  1310,   586,
-     764,   285,   286,   287,  1565,  1049,  1042,  1173,  -532,  -532,
-    -532,   226,  1114,   628,  -532,  1116,  1117,  1118,  1328,  1600,
-    1601,   428,   429,  1723,   587,   432,   433,   927,   939,   940,
-     941,   927,   588,  1128,  1130,  1131,  1132,   927,   589,   927,
-     590,  1930,  1309,  1931,  1932,  1933,   604,   929,   630,   227,
-     605,   929,   228,   613,   614,  1599,  1745,   929,   606,   929,
-    1179,  1180,  1417,   667,  1652,  1653,   620,  1419,   932,  -532,
-    1617,   621,  1455,   668,   543,   543,   543,   669,  1062,   546,
-     546,   546,  1247,  1248,   226,  1272,  1273,   996,   670,  1437,
-     671,  -532,  1646,  1649,  1649,  1777,  1778,  -532,  -532,  1636,
-     672,  1641,  1934,  1935,  2012,  2013,   229,   419,   430,   431,
-     688,   890,  1048,  1050,  1408,  -681,  -532,  2004,  2005,   551,
-     552,   684,   227,   845,   846,   228,   183,   184,   185,   186,
-     187,   188,  1491,  1492,   689,  1519,  -532,  -532,  -532,   690,
-    1495,   693,   701,  1305,   703,  1628,   704,   705,   706,  1306,
-     196,   726,   727,   728,   755,  1714,   230,  1499,   758,   761,
-     762,   926,   774,  1525,   773,  1526,   775,  1527,   776,   777,
-     282,  1520,  1529,   781,   783,   784,   795,   800,   593,   229,
-    -532,   825,   826,   827,   828,   829,   830,   821,   851,  1307,
-     814,   815,  1836,  1965,   819,   820,  1532,   825,   826,   827,
-     828,   829,   864,   822,  1308,   535,   536,   537,   538,   231,
-     232,   233,   234,   235,   236,   843,   609,   611,   836,  1556,
-     837,   237,   238,   239,   240,  1715,   838,   839,   854,   230,
-     858,   862,   857,   863,   927,   867,   927,   875,  1734,   927,
-     -16,     1,  1737,   876,   882,   883,  1743,   891,   903,   893,
-     241,   895,   942,   943,   929,   349,   929,   981,   982,   929,
-     539,   984,  1297,   242,   997,  1532,  1000,  1309,  1001,   243,
-    1750,  1009,   244,  1532,   245,  1028,   624,  1760,   643,  1016,
-    1030,  1031,   231,   232,   233,   234,   235,   236,  1032,   168,
-    1057,     2,  1033,  1060,   237,   238,   239,   240,   643,  1042,
-    1063,  1068,   712,   712,     3,     4,     5,     6,  1076,   929,
-    1075,   246,  1093,  1848,  1115,  1095,     7,     8,     9,    10,
-    1101,  1127,  1096,   241,  1077,    11,  1133,  1137,  1150,   631,
-    1672,  1148,   632,   633,   634,   635,   636,   637,   638,   639,
-    1651,  1159,   243,   641,  1152,   244,  1149,   245,  1823,  1168,
-     654,   655,   656,   657,   658,   659,   660,   661,   662,   663,
-     664,   665,   284,  1164,  1186,   282,  1189,  1187,  1192,  1197,
-      12,  1199,   656,   657,   658,   659,   660,   661,   662,   663,
-     664,   665,  1632,  1226,   246,   825,   826,   827,   828,   829,
-    1343,   631,  1690,   643,   632,   633,   634,   635,   636,   637,
-     638,   639,  1207,  1855,   640,   641,  1235,  1240,  1244,    13,
-      14,   631,  1242,   927,   632,   633,   634,   635,   636,   637,
-     638,   639,  1236,  -743,  1427,   641,  -745,  -741,  1249,  1178,
-     543,  1220,  1253,   929,  1255,   546,  1271,  1257,  1277,  1279,
-    1297,  1262,  1281,  1282,  1283,  1895,  1288,  1289,  1918,  1291,
-    1292,  1296,   374,  1286,  1856,  1326,  1332,   632,   633,   634,
-     635,   636,   637,   638,   639,  1327,    15,  1740,   641,  1982,
-    1329,  1333,   392,  1747,    16,    17,  1334,    18,  1335,    19,
-      20,    21,    22,    23,    24,    25,  1336,  1491,    26,  1339,
-    1340,  1346,  1491,  -772,    27,    28,  1347,  1362,  1348,  1937,
-    1349,  1350,  1352,  1375,  1358,  1382,   148,  1360,  1361,  1380,
-      29,  1386,  1387,    30,  1393,  1394,  1395,   602,   603,  1400,
-    1403,  1407,  1412,   607,  1415,  1532,  1788,  1416,   617,  1418,
-    1421,  1422,  1429,  1430,  1431,  1923,  1433,  1434,  1438,  1442,
-    1449,  1459,  1802,  1439,  1978,  1441,  1460,   631,  1493,    31,
-     632,   633,   634,   635,   636,   637,   638,   639,  1496,  1494,
-    1428,   641,  1500,  1501,   543,  1514,  1515,  1513,  1517,   546,
-    1521,  1522,  1533,  1824,  1548,  1534,  1558,  1559,  1560,  1772,
-    1573,  1574,  2009,  1572,  1544,  1589,  1596,  1603,  1747,  1608,
-    1609,  1610,  1611,  1623,  1612,  1620,  1618,  1622,  1642,  1644,
-    1322,  1626,  1491,  1627,  1645,   561,  1654,   697,  1629,  1666,
-    1669,   148,   516,   517,   518,  1670,   697,  1676,  1677,   539,
-    1678,  1684,  1679,  1683,  1682,  1688,  1696,   519,  1697,  1705,
-    1687,   520,   521,   522,   307,   308,   523,   524,   525,   526,
-     527,   528,   529,   530,   531,  1692,  1693,  1701,  1694,  1695,
-    1681,   641,  1878,  1732,  1736,  1728,  1748,  2039,  1729,   532,
-     533,   534,  1749,  1761,  1767,  1744,  2042,  1757,  1768,  1770,
-    1769,  1740,  1771,  1775,  1781,  1900,  1776,  1901,  1785,  1786,
-    1797,  1800,  1491,  1801,  1853,  1804,  1805,  1491,  1806,  1819,
-    1820,  1821,  1825,  1747,  1828,  1747,   697,  1818,   625,  1839,
-    1845,  1833,  1849,  1831,  1837,  1850,  1851,  1941,  1852,  1854,
-    1846,  1491,  1866,  1942,  1950,  1865,  1245,  1872,  1873,  1939,
-    1875,  1877,  1880,  1876,  1870,  1940,  1890,  1897,  1957,   842,
-    1904,  1946,  1913,  1920,  1318,  1319,  1922,  1947,  1907,  1924,
-    1927,  1953,  1926,  1948,  1956,  1970,  1909,  1884,  1969,  1491,
-    1968,  1914,  1974,  1979,  1976,  1989,  2000,  2003,  2014,  1491,
-    1980,   561,   868,   870,   870,  1997,  2006,  2007,  2008,  2016,
-     868,  2012,   870,  2002,  1993,  1994,  1995,  1996,  2013,  2032,
-    2019,  2034,  2037,  1497,  1080,  1440,   899,   900,   901,   450,
-     449,  2001,  1254,   719,   280,  1984,  1276,   725,  1733,  1498,
-    1039,  2029,   915,   697,  2017,  2015,  2010,  1764,  2031,  1841,
-    1983,  1752,  1842,  1650,   938,   938,   938,   938,  2033,  1491,
-    1864,  1491,  1863,  1523,   723,   955,   956,   957,   958,   959,
-     960,   961,   962,   963,   964,   965,   966,   967,   968,   970,
-     971,   972,   973,   974,   975,   976,   977,   978,  1007,   156,
-     409,  1625,  2023,   988,   988,  1896,  1899,  1972,  1941,  1619,
-    1457,  1576,  1491,  1145,  1942,  1491,  1575,  1411,  1252,  1250,
-    1939,  1225,  1420,   948,   999,   998,  1940,  1172,   691,  1143,
-    1719,  1351,  1946,   947,  1817,   954,  1191,   983,  1947,   535,
-     536,   537,   538,   293,  1948,   294,   295,   296,   297,   298,
-     299,   300,   301,   302,   303,   304,   274,   810,   305,   306,
-     861,  1795,    73,    74,  1142,   913,    75,   307,   308,  1949,
-    1794,  1194,  1686,  1554,  1195,   849,  1803,  1542,    76,  1545,
-    1689,    77,  1874,  1955,   309,   310,   311,   312,   313,   314,
-     315,     0,    78,  1962,     0,   267,   268,   269,     0,   888,
-       0,     0,   316,    79,     0,     0,   163,   165,   166,   167,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    80,
-       0,     0,    81,     0,     0,    82,     0,     0,     0,     0,
-       0,    83,     0,     0,     0,     0,    84,    85,    86,     0,
-       0,     0,     0,     0,     0,     0,     0,   318,     0,     0,
-      87,   319,     0,    88,     0,    89,    90,    91,     0,     0,
-       0,   320,    92,    93,     0,     0,     0,     0,     0,     0,
-       0,   321,   322,   323,   324,   325,     0,   326,   327,    94,
-      95,   328,   329,    96,   330,    97,    98,    99,   100,   101,
-     102,   103,     0,   104,   331,   105,   106,   107,   108,     0,
-     109,   332,   110,     0,     0,     0,     0,     0,   111,  1160,
-     707,   708,   112,   868,     0,     0,     0,     0,     0,   870,
-       0,     0,     0,   697,     0,     0,     0,     0,     0,   335,
-     336,     0,     0,     0,   337,   338,   339,     0,     0,     0,
-       0,  1193,     0,     0,  1196,     0,   341,     0,     0,     0,
-       0,     0,     0,     0,     0,   113,   114,     0,     0,     0,
-       0,     0,     0,   115,     0,     0,     0,   116,     0,     0,
-       0,     0,     0,   117,   697,   697,   118,   119,   120,   121,
-     122,   123,   124,   125,   126,   127,     0,   128,     0,     0,
-       0,     0,     0,   129,     0,     0,   130,     0,     0,     0,
-     131,  1234,     0,   132,   133,     0,   134,     0,     0,   135,
-       0,   136,     0,     0,     0,   137,   138,   988,     0,   988,
-       0,     0,   342,   343,   344,   345,     0,     0,     0,     0,
-       0,     0,   143,     0,     0,     0,   346,     0,     0,     0,
-     347,   348,     0,   697,     0,     0,     0,     0,     0,     0,
-       0,   697,     0,     0,     0,     0,   144,     0,     0,     0,
-       0,   145,   146,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   516,   517,
-     518,     0,   350,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   519,     0,     0,     0,   520,   521,   522,
-     307,   308,   523,   524,   525,   526,   527,   528,   529,   530,
-     531,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   532,   533,   534,     0,   516,
-     517,   518,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   519,     0,     0,     0,   520,   521,
-     522,   307,   308,   523,   524,   525,   526,   527,   528,   529,
-     530,   531,     0,     0,     0,   842,     0,     0,     0,     0,
-       0,     0,     0,   516,   517,   518,   532,   533,   534,     0,
-       0,     0,  1355,     0,     0,     0,   870,     0,   519,     0,
-       0,  1366,   520,   521,   522,   307,   308,   523,   524,   525,
-     526,   527,   528,   529,   530,   531,     0,     0,     0,     0,
-       0,     0,     0,     0,  1396,  1397,  1398,  1399,     0,     0,
-     532,   533,   534,     0,   697,     0,     0,     0,     0,     0,
-    1404,   697,     0,   697,     0,     0,    67,    68,    69,    70,
-      71,    72,     0,     0,  1108,     0,     0,     0,     0,     0,
-       0,     0,     0,    73,    74,     0,     0,    75,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    76,
-       0,     0,    77,     0,     0,     0,   988,     0,     0,     0,
-       0,     0,     0,    78,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    79,     0,     0,   163,   165,   166,
-     167,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      80,     0,     0,    81,     0,     0,    82,     0,     0,     0,
-       0,     0,    83,     0,     0,     0,     0,    84,    85,    86,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    87,     0,     0,    88,     0,    89,    90,    91,     0,
-       0,     0,     0,    92,    93,   535,   536,   537,   538,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      94,    95,     0,     0,    96,     0,    97,    98,    99,   100,
-     101,   102,   103,     0,   104,     0,   105,   106,   107,   108,
-       0,   109,     0,   110,  1537,     0,     0,  1366,     0,   111,
-      13,  1203,     0,   112,     0,  1160,   535,   536,   537,   538,
-       0,     0,   868,     0,     0,   868,     3,     4,     5,     6,
-       0,     0,  -217,     0,   697,   697,   697,   697,     7,     8,
-       9,    10,     0,     0,   697,     0,     0,    11,     0,  -217,
-       0,     0,     0,  1647,  -217,  -217,   113,   114,     0,     0,
-     535,   536,   537,   538,   115,     0,     0,     0,   116,     0,
-       0,     0,     0,     0,   117,     0,     0,   118,   119,   120,
-     121,   122,   123,   124,   125,   126,   127,     0,   128,     0,
-       0,     0,     0,     0,   129,     0,  -217,   130,  -217,     0,
-       0,   131,     0,     0,   132,   133,     0,   134,     0,  1640,
-     135,     0,   136,     0,     0,     0,   137,   138,     0,     0,
-     592,     0,     0,   139,   140,   141,   142,     0,     0,     0,
-       0,    13,    14,   143,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   868,     0,  -217,
-    -217,  -217,     0,     0,     0,     0,     0,   144,     0,     0,
-       0,     0,   145,   146,     0,     0,     0,     0,     0,     0,
-       0,  -217,     0,  -217,     0,     0,     0,     0,     0,  -217,
-    -217,   921,     0,  1184,     0,     0,     0,     0,    15,  1366,
-    -217,     0,     0,  -217,     0,     0,    16,    17,  -217,    18,
-       0,     0,     0,  -217,     0,     0,   643,     0,     0,     0,
-      26,     0,     0,     0,     0,     0,    27,    28,     0,     0,
-       0,  1709,     0,  1710,     0,     0,  1711,     0,     0,     0,
-       0,     0,    29,     0,     0,    30,     0,   643,     0,     0,
-       0,     0,     0,     0,     0,   842,     0,     0,     0,   868,
-       0,     0,     0,     0,     0,     0,     0,     0,   868,     0,
-       0,     0,  -217,     0,   644,   645,   646,   647,   648,     0,
-       0,    31,   649,   650,   651,   652,   653,  1583,   654,   655,
+    1159,   897,   696,  1013,  1009,   510,   511,   613,   614,   679,
+    -254,   675,   148,  -713,  1721,   899,  1954,   451,   452,  1720,
+      59,  1011,  1228,  1679,  2028,   561,   562,  1094,  1035,  1035,
+    1248,   854,   609,   611,  1035,   728,   470,  1052,   160,  1170,
+     438,  1577,   860,   860,   476,   477,   478,   479,  -713,  1611,
+     484,   462,   485,   486,   810,   579,   917,  1130,  1229,  1021,
+     490,  1307,    13,   496,   497,   498,   499,   595,   501,   502,
+     503,   504,   505,  1176,  1308,   789,  1018,   595,    30,  1244,
+    1209,  1246,  1182,   757,  1131,   484,  1110,  1111,  1112,  1462,
+     927,  1108,   909,   596,  -454,  1026,  1027,  1760,   148,   458,
+    1269,   748,  1895,  1128,  1129,  1292,   936,  1896,  1961,   211,
+    1789,   350,    44,    44,    44,    44,    44,    44,   350,  1392,
+    1761,  1329,  1397,   908,  1205,  1484,    51,    51,    51,    51,
+      51,    51,  1885,   937,   374,    62,    62,    62,    62,    62,
+      62,   216,   851,   953,  -760,  -762,   285,   286,   287,  1319,
+     453,   392,  1931,   293,   697,   282,  1146,   180,   181,   182,
+     183,   184,   185,   -82,   -82,   -82,   -82,   -82,   -82,   898,
+     215,   642,  1010,   160,    30,   148,  2000,   455,  -254,  1344,
+     160,   595,   548,  1250,  1809,  1020,   624,   214,   555,   539,
+      59,    59,    59,    59,    59,    59,   148,   817,   818,   715,
+    1886,    65,  1125,  1887,  1840,   148,   148,   148,   148,   148,
+    1845,  2029,  1389,   814,  1348,   781,   594, -1080,   859,   543,
+     980,   793,   148,  1398,  1300,   148,   696,   148,   148,   148,
+    1301,  1583,  1584,  1846,  1433,   546,  1434,  1861,  1456,   543,
+    1038,   153,  1021,   808,  1019,   160,   856,   812,   722,   282,
+    1183,  1552,  1453,    30,   549,   546,   463,  1684, -1080,  1810,
+    1066,  1023,  1811,  1384,  1055, -1080,   217,  1710,  1711,   760,
+    1712,  1722,   464,   836,  1454,   543,   676,  1063,   769,   770,
+     771,   772,   773,    13,  1862,   981,  1786,  1818,   543,  1864,
+    1907,   546,  1206,  1828,  1859,   794,   560,  1094,   795,  1917,
+     797,   798,   799,  1870,   546,   186,   187,   188,   189,  1116,
+    1904,  1918,  1597,   710,   557,  1549,  1351,  1320,  1021,  1385,
+    1619,  1149,  1035,    66,  2042,  1593,  1561,  1180,   575,  1620,
+      40,  1127,  1416,  1568,  1151,   625,  1862,   903,  1420,   906,
+    1421,   928,  1443,  1569,  1366,   819,   764,  1345,    13,  1706,
+    1061,   154,   677,   593,   186,   187,   188,   189,   930,   933,
+     887,  1977,   935,  1979,  1213,  1214,  1215,  1570,  1216,  1217,
+    1218,  1219,   225,  1045,   736,  1834,   738,   739,   740,   741,
+     742,   743,  1349,   158,   744,   678,   374,   927,    30,   159,
+    1707,  1399,   592,  1046,  1621,    30,   283,   880,  1338,   881,
+    1186, -1045,  1019,   392,  1019,   991,  1283,  1509,   289,   997,
+     282,   203,  1510,  1193,   204,  1195, -1045,  1007,   711,  1553,
+    1238,  1207,  1716,   292,   677,  1685,  1702,   180,   181,   182,
+     183,   184,   185,   643,   252,  1399,  1019,  1363,  1019,  1502,
+    1831,  1832,  1233,  1234,   291,  1255,  1987,  1988, -1080,   285,
+     286,   287,  1662,   148,   539,  1502,   492,   678,   594,  2023,
+      30,  1829,  1860,  1220,   190,   407,   919,  1622,   419,   284,
+     920,  1871,   411,   420,   891,   412,  1364,  1989,  1905,  1919,
+    1921,   413,  1923,   421,   594,   191,   186,   187,   188,   189,
+    1604,   253,  2043,   148,   946,   947,   948,   252,  1608,  1270,
+      40,    40,    40,    40,    40,    40,   430,  1087,   192,  1077,
+    1077,  1077,   662,   663,   664,   665,   433,  1663,   781,  1097,
+     284,   493,   494,   495,  1102,  1103,  1025,  1104,  1511,   439,
+     148,   285,   286,   287,   191,   440,  1265,  1594,   418,  1596,
+     441,   254,  1601,   880,  1567,   881,  1767,  1571,  1271,  1124,
+    1768,   543,   442,   255,   253,   696,  1598,   192,   443,   161,
+    1055,  1450,  1451,  1452,   447,  1134,  1060,   546,  1664,   732,
+     543,  1262,  1297,  1263,  1264,   696,  1534,   765,   444,   616,
+    1291,   913,   285,   286,   287,   910,   546,   913,   891,   733,
+     561,  1328,  1641,  1152,  1753,   593,   190,   215,  1756,   193,
+    1753,   734,   148,  1109,   254,   256,   257,   258,   259,  1665,
+    1162,   593,  1666,   465,   466,   460,   255,  1171,   471,  1555,
+     749,   593,  1667,  1743,  1744,   468,   469,   543,   543,   472,
+    1331,  1332,  1408,   997,   260,   506,   507,   473,   928,  1412,
+     474,  1413,   750,   546,   546,   751,   752,   261,  1360,  1361,
+     682,   683,   475,   262,   487,   930,   488,  1556,   263,  1557,
+    1558,  1225,  1225,  1225,   686,   687,   191,   491,   256,   257,
+     258,   259,   509,   764,   927,  1156,   729,   730,   927,    49,
+     512,  1213,  1214,  1215,   927,   515,   927,  1417,  1219,   192,
+    1069,  1070,  1071,  1072,   264,   513,   265,   260,   514,   790,
+     791,   736,  -180,   738,   739,   740,   741,   742,   743,   938,
+     939,   744,  1049,  1042,  1107,  1717,   262,   285,   286,   287,
+    -179,   263,   553,  -533,   418,   593,   613,   614,  1143,  1144,
+    1145,   193,   547,  1184,  1185,   555,  1251,   736,   737,   738,
+     739,   740,   741,   742,   743,  1435,   293,   744,  -871,  1213,
+    1214,  1215,  -533,  1216,  1217,  1218,  1219,   264,  2013,   265,
+     285,   286,   287,  1266,  1267,  1252,  1253,   895,  -743,  1932,
+    1727,  1933,  1934,  1935,  1272,  1273,  1449,    14,  1274,  1276,
+    1277,  1508,  1278,   148,   561,  -533,  -533,  -533,   285,   286,
+     287,  1457,  -533,   568,  1460,  1178,  1055,  1055,  1464,    25,
+     226,  1638,  1077,  -745,   594,    26,    27,  1294,   571,   572,
+     573,   574,  -741,  1312,   543,   566,  1304,  1779,  1780,  1313,
+     148,  1318,  1936,  1937,    29,   710,   710,  2014,  2015,   567,
+     546,   569,  1330,   575,  1180,  1180,   426,   427,   227,   577,
+     148,   228,  1048,  1050,  1591,   551,   552,  -533,  1220,    49,
+      49,    49,    49,    49,    49,   578,  1279,  2006,  2007,  1461,
+    1463,   580,  1571,  1314,   846,   847,   581,   582,  1119,  -533,
+     583,  1121,  1122,  1123,   584,  -533,  -533,   585,   586,   587,
+     588,  1727,   589,   927,   590,   927,   604,   605,   927,  1133,
+    1135,  1136,  1137,  1317,  -533,   229,   180,   181,   182,   183,
+     184,   185,   710,   606,   765,  1605,   826,   827,   828,   829,
+     830,   831,   620,  1335,   621,  -533,  -533,  -533,   826,   827,
+     828,   829,   830,   865,   628,   928,   668,  -224,   667,   928,
+     630,   670,   669,  1606,  1607,   928,   671,   928,   672,  -682,
+     745,   593,   930,   684,  1509,   230,   930,   688,  1640,  1510,
+    1645,   689,   930,   690,   930,   701,  1747,  1424,   702,  1067,
+    -533,   699,  1426,   933,  1656,  1657,   703,  1623,   704,   724,
+     193,   725,   543,   543,   543,   826,   827,   828,   829,   830,
+    1350,   226,   997,   726,  1444,   754,   755,   759,   546,   546,
+     546,   774,  -224,  1650,  1653,  1653,   762,   231,   232,   233,
+     234,   235,   236,   424,   425,   763,   775,   428,   429,   237,
+     238,   239,   240,   776,   777,   782,   455,   778,   784,   227,
+     785,   796,   228,   822,   801,  1315,   815,   816,   820,  1497,
+    1498,  1525,   821,   823,   609,   611,   837,  1501,   241,  1316,
+    1312,   838,   839,  -224,  1087,   840,  1313,  1632,   844,  1967,
+     852,   242,   855,   858,  1505,  1718,   863,   243,   859,   864,
+     244,   927,   245,   868,   877,  1511,   643,   282,  1526,   884,
+     892,   876,   883,  1531,  1719,  1532,   229,  1533,   894,   896,
+    1838,   904,  1535,   942,  -224,   943,   982,  -224,   349,   983,
+    1314,   891,   985,  1538,  1415,   998,  1001,  -224,   631,  1002,
+     246,   632,   633,   634,   635,   636,   637,   638,   639,   624,
+    1029,   640,   641,  1028,  1016,  1030,  1562,  1752,  1032,  1051,
+     643,  1042,  1033,  1062,  1762,  1068,   230,  1073,  1081,  1065,
+    1080,  1082,  1738,  1098,   928,  1100,   928,  1101,  1745,   928,
+     657,   658,   659,   660,   661,   662,   663,   664,   665,  1120,
+    1106,   930,  1138,   930,  1132,  1142,   930,  1155,  1153,  1304,
+    1154,  1157,  1538,  1164,  1169,  1173,  1191,   284,  1192,  1194,
+    1538,  1204,   643,  1212,  1231,  1245,  1240,  1202,   231,   232,
+     233,   234,   235,   236,  1197,  1254,  1257,  1247,   165,  -744,
+     237,   238,   239,   240,   643,   658,   659,   660,   661,   662,
+     663,   664,   665,  1850,  1259,   930,   602,   603,  -746,  1241,
+    1261,  -742,   607,  1268,  1275,  1286,  1284,   617,  1288,   241,
+    1289,  1249,  1183,  1290,  1295,  1676,  1283,  1293,   593,  1298,
+    1296,  1299,  1303,  1333,  1334,  1336,  1655,  1339,   243,  1359,
+    1825,   244,  1341,   245,  1340,  1342,  1343,  1382,  1857,  1346,
+     631,  1347,  1315,   632,   633,   634,   635,   636,   637,   638,
+     639,   282,  -773,  -619,   641,  1353,  1316,   656,   657,   658,
+     659,   660,   661,   662,   663,   664,   665,  1354,  1636,  1369,
+    1387,   246,  1389,  1355,   710,   710,  1356,  1357,  1694,  1365,
+     694,  1367,  1368,  1393,  1394,  1407,  1410,   643,  1400,  1401,
+     631,   694,  1402,   632,   633,   634,   635,   636,   637,   638,
+     639,  1414,   928,   640,   641,   632,   633,   634,   635,   636,
+     637,   638,   639,  1419,   543,  -217,   641,  1225,  1422,   930,
+    1423,  1425,  1428,  1429,  1436,  1897,  1304,  1437,  1438,  1440,
+     546,  1441,  -217,  1445,  1939,  1920,  1447,  -217,  -217,   374,
+    1448,  1455,  1458,  1465,  1466,  1519,  1502,  1520,  1499,  1984,
+    1506,  1742,  1500,  1507,  1858,  1521,   392,  1749,   654,   655,
      656,   657,   658,   659,   660,   661,   662,   663,   664,   665,
-       0,   643,     0,     0,     0,   644,   645,   646,   647,   648,
-       0,     0,     0,   649,   650,   651,   652,   653,     0,   654,
-     655,   656,   657,   658,   659,   660,   661,   662,   663,   664,
-     665,     0,     0,     0,     0,  1789,  1537,  1537,     0,  1537,
+    1523,  1497,   516,   517,   518,   694,  1497,  1528,  -217,  1980,
+    -217,  1527,  1550,  1539,  1540,  1564,  1554,   519,  1565,  1566,
+     148,   520,   521,   522,   307,   308,   523,   524,   525,   526,
+     527,   528,   529,   530,   531,  1579,  1578,  1580,   843,  1538,
+    1790,  1595,  1602,  1609,  1616,  1617,  1614,  1615,  1624,   532,
+     533,   534,  1618,  1625,  1627,  1630,  1804,  1631,  1329,  1633,
+    1646,  -217,  -217,  -217,  1658,  1925,  1648,  1649,  1670,  1673,
+    1674,   869,   871,   871,  1680,  1681,   539,  1682,   543,   869,
+    1683,   871,  1687,  -217,  1692,  -217,  1700,  1826,  1696,  1697,
+    1686,  -217,  -217,  1774,   546,   900,   901,   902,  1701,  2011,
+    1749,  1688,  -217,  1691,  1705,  -217,  1709,  1698,  1685,   641,
+    -217,   916,   694,  1699,  1497,  -217,  1732,   561,  1736,  1733,
+    1739,  1746,  1750,   148,  1751,  1763,  1769,   945,   945,   945,
+     945,  1759,  1770,  1771,   956,   957,   958,   959,   960,   961,
+     962,   963,   964,   965,   966,   967,   968,   969,   971,   972,
+     973,   974,   975,   976,   977,   978,   979,  1772,  1777,  1773,
+    1783,  1787,   989,   989,  1880,  1788,  1799,  1778,  1802,  2041,
+    1803,  1806,  1807,  1808,  1827,  1820,  -217,  1821,  2044,  1830,
+     625,  1839,  1847,  1742,  1851,  1823,  1833,  1902,  1822,  1903,
+    1841,  1848,  1852,  1853,  1497,  1854,  1855,  1835,  1856,  1497,
+    1868,  1250,  1877,  1872,  1874,  1749,  1867,  1749,   631,  1875,
+    1878,   632,   633,   634,   635,   636,   637,   638,   639,  1943,
+    1879,  1431,   641,  1497,  1882,  1944,  1952,  1892,  1899,  1909,
+    1906,  1941,  1911,  1915,  1916,  1922,  1928,  1942,  1924,  1926,
+    1959,  1929,  1955,  1948,  1958,  1886,  1971,  1978,  1970,  1949,
+    1976,  1972,   -16,     1,  1981,  1950,  1982,  2002,  1991,  2004,
+    2003,  1497,  2005,  1999,  2008,  2009,  2010,  2016,  2018,  2014,
+    2034,  1497,  2021,   561,  2015,  2036,  2039,  1503,  1446,   535,
+     536,   537,   538,   446,   445,  1986,  1995,  1996,  1997,  1998,
+     631,  1258,   280,   632,   633,   634,   635,   636,   637,   638,
+     639,  1085,     2,  1432,   641,  1039,   723,  1280,  1504,   717,
+    1737,  2031,  2019,  2017,  2012,     3,     4,     5,     6,   516,
+     517,   518,  1766,  2033,  1985,  1843,  1754,     7,     8,     9,
+      10,  1497,  1844,  1497,   519,   539,    11,  2035,   520,   521,
+     522,   307,   308,   523,   524,   525,   526,   527,   528,   529,
+     530,   531,  1654,  1866,  1529,  1008,   156,  1865,  1629,   721,
+     409,  1898,  1901,  1974,  2025,  1000,   532,   533,   534,  1165,
+    1943,  1582,  1282,   869,  1497,  1256,  1944,  1497,  1418,   871,
+     999,    12,  1941,   694,  1581,  1427,   753,  1150,  1942,   274,
+    1723,   941,  1281,   643,  1948,  1230,   949,  1148,  1358,  1819,
+    1949,  1198,   862,   811,  1201,  1177,  1950,   955,   914,  1147,
+     984,  1797,  1951,  1796,   850,  1560,  1690,  1805,  1693,  1876,
+      13,   889,  1196,  1548,  1551,  1957,  1964,     0,     0,     0,
+    1199,  1200,  1587,   694,   694,     0,     0,     0,     0,     0,
+       0,  1325,  1326,     0,     0,     0,     0,     0,     0,     0,
+     644,   645,   646,   647,   648,   649,   650,   651,   652,   653,
+       0,  1239,     0,     0,   654,   655,   656,   657,   658,   659,
+     660,   661,   662,   663,   664,   665,    14,   989,     0,   989,
+       0,     0,     0,     0,    15,    16,     0,    17,     0,    18,
+      19,    20,    21,    22,    23,    24,     0,     0,    25,     0,
+       0,   694,     0,     0,    26,    27,     0,     0,     0,     0,
+     694,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      28,  1187,     0,    29,     0,     0,     0,     0,     0,     0,
+       0,     0,    30,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   643,     0,   516,   517,   518,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   643,     0,   868,     0,     0,     0,     0,     0,   644,
-     645,   646,   647,   648,     0,     0,     0,   649,   650,   651,
-     652,   653,   868,   654,   655,   656,   657,   658,   659,   660,
-     661,   662,   663,   664,   665,     0,     0,     0,     0,     0,
+      31,   519,     0,     0,     0,   520,   521,   522,   307,   308,
+     523,   524,   525,   526,   527,   528,   529,   530,   531,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-    1835,     0,     0,     0,     0,     0,  1840,     0,     0,   644,
-     645,   646,   647,   648,     0,     0,     0,   649,   650,   651,
-     652,   653,  1185,   654,   655,   656,   657,   658,   659,   660,
-     661,   662,   663,   664,   665,     0,     0,     0,     0,     0,
-     293,     0,   294,   295,   296,   297,   298,   299,   300,   301,
-     302,   303,   304,  1584,     0,   305,   306,     0,     0,    73,
+       0,     0,     0,   532,   533,   534,   535,   536,   537,   538,
+    1588,   644,   645,   646,   647,   648,   649,   650,   651,   652,
+     653,     0,     0,     0,     0,   654,   655,   656,   657,   658,
+     659,   660,   661,   662,   663,   664,   665,     0,     0,   843,
+       0,     0,     0,     0,     0,     0,     0,   516,   517,   518,
+       0,     0,     0,     0,     0,     0,  1362,     0,     0,     0,
+     871,     0,   519,     0,     0,  1373,   520,   521,   522,   307,
+     308,   523,   524,   525,   526,   527,   528,   529,   530,   531,
+       0,     0,     0,     0,     0,     0,     0,     0,  1403,  1404,
+    1405,  1406,     0,     0,   532,   533,   534,     0,   694,     0,
+       0,     0,     0,     0,  1411,   694,     0,   694,     0,     0,
+       0,   293,   294,   295,   296,   297,   298,   299,   300,   301,
+     302,   303,   304,     0,     0,   305,   306,     0,     0,    73,
       74,     0,     0,    75,   307,   308,     0,     0,     0,     0,
        0,     0,     0,     0,     0,    76,     0,     0,    77,     0,
-       0,   309,   310,   311,   312,   313,   314,   315,     0,    78,
-       0,     0,   267,   268,   269,     0,     0,     0,     0,   316,
-      79,     0,     0,   163,   165,   166,   167,  1182,     0,     0,
+     989,   309,   310,   311,   312,   313,   314,   315,     0,    78,
+       0,  1188,   267,   268,   269,     0,     0,     0,     0,   316,
+      79,     0,     0,   160,   162,   163,   164,     0,     0,     0,
        0,     0,     0,     0,     0,     0,    80,     0,     0,    81,
-       0,  1789,    82,     0,  1537,     0,     0,     0,    83,     0,
+       0,     0,    82,     0,     0,     0,     0,     0,    83,     0,
        0,     0,     0,    84,    85,    86,     0,     0,     0,     0,
-     317,     0,   868,     0,   318,     0,     0,    87,   319,     0,
-      88,     0,    89,    90,    91,  1973,     0,  1198,   320,    92,
-      93,     0,     0,     0,     0,     0,     0,     0,   321,   322,
+     317,     0,  1113,     0,   318,     0,     0,    87,   319,     0,
+      88,     0,    89,    90,    91,  1651,     0,     0,   320,    92,
+      93,     0,     0,   535,   536,   537,   538,     0,   321,   322,
      323,   324,   325,     0,   326,   327,    94,    95,   328,   329,
       96,   330,    97,    98,    99,   100,   101,   102,   103,     0,
      104,   331,   105,   106,   107,   108,     0,   109,   332,   110,
-       0,     0,     0,     0,     0,   111,    13,   591,     0,   112,
+    1543,     0,     0,  1373,     0,   111,   591,     0,   112,   334,
+       0,  1165,     0,     0,     0,     0,     0,     0,   869,     0,
+       0,   869,     0,     0,     0,   335,   336,     0,     0,     0,
+     694,   694,   694,   694,     0,   337,   338,   339,     0,     0,
+     694,     0,   341,     0,     0,     0,     0,     0,     0,     0,
+       0,   113,   114,     0,   535,   536,   537,   538,     0,   115,
+       0,     0,     0,   116,     0,     0,     0,     0,     0,   117,
+       0,     0,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,     0,   128,     0,     0,     0,     0,     0,   129,
+       0,     0,   130,     0,     0,     0,   131,     0,     0,   132,
+     133,     0,   134,     0,  1644,   135,     0,   136,     0,     0,
+       0,   137,   138,     0,     0,   592,     0,     0,    30,   342,
+     343,   344,   345,     0,     0,     0,     0,     0,     0,   143,
+       0,     0,     0,   346,     0,     0,     0,   347,   348,     0,
+       0,     0,   869,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   144,     0,     0,     0,     0,   145,   146,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   516,   517,   518,   349,     0,
+     350,     0,     0,     0,  1373,     0,     0,     0,     0,     0,
+     519,     0,     0,     0,   520,   521,   522,   307,   308,   523,
+     524,   525,   526,   527,   528,   529,   530,   531,   643,     0,
+       0,     0,     0,     0,     0,     0,  1713,     0,     0,  1714,
+       0,  1715,   532,   533,   534,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   643,     0,     0,     0,     0,
+     843,     0,     0,     0,   869,     0,     0,     0,     0,     0,
+       0,     0,     0,   869,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   644,   645,   646,   647,   648,
+     649,   650,   651,   652,   653,     0,     0,     0,     0,   654,
+     655,   656,   657,   658,   659,   660,   661,   662,   663,   664,
+     665,     0,   644,   645,   646,   647,   648,   649,   650,   651,
+     652,   653,     0,     0,     0,     0,   654,   655,   656,   657,
+     658,   659,   660,   661,   662,   663,   664,   665,  1791,  1543,
+    1543,     0,  1543,     0,     0,     0,     0,     0,     0,     0,
+       0,   643,     0,     0,     0,     0,   869,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   869,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  1837,     0,     0,     0,     0,     0,  1842,   644,   645,
+     646,   647,   648,   649,   650,   651,   652,   653,     0,     0,
+       0,     0,   654,   655,   656,   657,   658,   659,   660,   661,
+     662,   663,   664,   665,     0,  1190,     0,     0,     0,     0,
+       0,     0,   293,   294,   295,   296,   297,   298,   299,   300,
+     301,   302,   303,   304,     0,     0,   305,   306,     0,     0,
+      73,    74,  1203,     0,    75,   307,   308,     0,     0,     0,
+       0,     0,   535,   536,   537,   538,    76,     0,     0,    77,
+       0,     0,   309,   310,   311,   312,   313,   314,   315,     0,
+      78,     0,     0,   267,   268,   269,     0,     0,     0,     0,
+     316,    79,     0,     0,     0,   162,   163,   164,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    80,     0,     0,
+      81,     0,  1791,    82,     0,  1543,     0,     0,     0,    83,
+       0,     0,     0,     0,    84,    85,    86,     0,     0,     0,
+       0,   317,     0,   869,     0,   318,     0,     0,    87,   319,
+       0,    88,     0,    89,    90,    91,  1975,     0,  1590,   320,
+      92,    93,     0,     0,     0,     0,     0,     0,     0,   321,
+     322,   323,   324,   325,     0,   326,   327,    94,    95,   328,
+     329,    96,   330,    97,    98,    99,   100,   101,   102,   103,
+       0,   104,   331,   105,   106,   107,   108,     0,   109,   332,
+     110,     0,     0,     0,     0,     0,   111,   333,     0,   112,
+     334,     0,   950,   951,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   952,     0,     0,   335,   336,     0,     0,
+       0,     0,     0,     0,     0,     0,   337,   338,   339,     0,
+       0,     0,     0,   341,     0,     0,     0,     0,     0,     0,
+       0,     0,   113,   114,     0,     0,     0,     0,     0,     0,
+     115,     0,     0,     0,   116,     0,     0,     0,     0,     0,
+     117,     0,     0,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,     0,   128,     0,     0,     0,     0,     0,
+     129,     0,     0,   130,     0,     0,     0,   131,     0,     0,
+     132,   133,     0,   134,     0,     0,   135,     0,   136,     0,
+       0,     0,   137,   138,     0,     0,     0,     0,     0,     0,
+     342,   343,   344,   345,     0,     0,     0,     0,     0,     0,
+     143,     0,     0,     0,   346,     0,     0,     0,   347,   348,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   144,     0,     0,     0,     0,   145,
+     146,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   349,
+       0,   350,   293,   294,   295,   296,   297,   298,   299,   300,
+     301,   302,   303,   304,     0,     0,   305,   306,     0,     0,
+      73,    74,     0,     0,    75,   307,   308,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    76,     0,     0,    77,
+       0,     0,   309,   310,   311,   312,   313,   314,   315,     0,
+      78,     0,     0,   267,   268,   269,     0,     0,     0,     0,
+     316,    79,     0,     0,   160,   162,   163,   164,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    80,     0,     0,
+      81,     0,     0,    82,     0,     0,     0,     0,     0,    83,
+       0,     0,     0,     0,    84,    85,    86,     0,     0,     0,
+       0,   317,     0,     0,     0,   318,     0,     0,    87,   319,
+       0,    88,     0,    89,    90,    91,     0,     0,     0,   320,
+      92,    93,     0,     0,     0,     0,     0,     0,     0,   321,
+     322,   323,   324,   325,     0,   326,   327,    94,    95,   328,
+     329,    96,   330,    97,    98,    99,   100,   101,   102,   103,
+       0,   104,   331,   105,   106,   107,   108,     0,   109,   332,
+     110,     0,     0,     0,     0,     0,   111,   591,     0,   112,
+     334,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   335,   336,     0,     0,
+       0,     0,     0,     0,     0,     0,   337,   338,   339,     0,
+       0,     0,     0,   341,     0,     0,     0,     0,     0,     0,
+       0,     0,   113,   114,     0,     0,     0,     0,     0,     0,
+     115,     0,     0,     0,   116,     0,     0,     0,     0,     0,
+     117,     0,     0,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,     0,   128,     0,     0,     0,     0,     0,
+     129,     0,     0,   130,     0,     0,     0,   131,     0,     0,
+     132,   133,     0,   134,     0,     0,   135,     0,   136,     0,
+       0,     0,  1637,   138,     0,     0,     0,     0,     0,    30,
+     342,   343,   344,   345,     0,     0,     0,     0,     0,     0,
+     143,     0,     0,     0,   346,     0,     0,     0,   347,   348,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   144,     0,     0,     0,     0,   145,
+     146,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   349,
+       0,   350,   293,   294,   295,   296,   297,   298,   299,   300,
+     301,   302,   303,   304,     0,     0,   305,   306,     0,     0,
+      73,    74,     0,     0,    75,   307,   308,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    76,     0,     0,    77,
+       0,     0,   309,   310,   311,   312,   313,   314,   315,     0,
+      78,     0,     0,   267,   268,   269,     0,     0,     0,     0,
+     316,    79,     0,     0,     0,   162,   163,   164,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    80,     0,     0,
+      81,     0,     0,    82,     0,     0,     0,     0,     0,    83,
+       0,     0,     0,     0,    84,    85,    86,     0,     0,     0,
+       0,   317,     0,     0,     0,   318,     0,     0,    87,   319,
+       0,    88,     0,    89,    90,    91,     0,     0,     0,   320,
+      92,    93,     0,     0,     0,     0,     0,     0,     0,   321,
+     322,   323,   324,   325,     0,   326,   327,    94,    95,   328,
+     329,    96,   330,    97,    98,    99,   100,   101,   102,   103,
+       0,   104,   331,   105,   106,   107,   108,     0,   109,   332,
+     110,     0,     0,     0,     0,     0,   111,   333,     0,   112,
+     334,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   335,   336,     0,     0,
+       0,     0,     0,     0,     0,     0,   337,   338,   339,     0,
+     340,     0,     0,   341,     0,     0,     0,     0,     0,     0,
+       0,     0,   113,   114,     0,     0,     0,     0,     0,     0,
+     115,     0,     0,     0,   116,     0,     0,     0,     0,     0,
+     117,     0,     0,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,     0,   128,     0,     0,     0,     0,     0,
+     129,     0,     0,   130,     0,     0,     0,   131,     0,     0,
+     132,   133,     0,   134,     0,     0,   135,     0,   136,     0,
+       0,     0,   137,   138,     0,     0,     0,     0,     0,     0,
+     342,   343,   344,   345,     0,     0,     0,     0,     0,     0,
+     143,     0,     0,     0,   346,     0,     0,     0,   347,   348,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   144,     0,     0,     0,     0,   145,
+     146,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   349,
+       0,   350,   293,   294,   295,   296,   297,   298,   299,   300,
+     301,   302,   303,   304,     0,     0,   305,   306,     0,     0,
+      73,    74,     0,     0,    75,   307,   308,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    76,     0,     0,    77,
+       0,     0,   309,   310,   311,   312,   313,   314,   315,     0,
+      78,     0,     0,   267,   268,   269,     0,     0,     0,     0,
+     316,    79,     0,     0,     0,   162,   163,   164,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    80,     0,     0,
+      81,     0,     0,    82,     0,     0,     0,     0,     0,    83,
+       0,     0,     0,     0,    84,    85,    86,     0,     0,     0,
+       0,   317,     0,     0,     0,   318,     0,     0,    87,   319,
+       0,    88,     0,    89,    90,    91,     0,     0,     0,   320,
+      92,    93,     0,     0,     0,     0,     0,     0,     0,   321,
+     322,   323,   324,   325,     0,   326,   327,    94,    95,   328,
+     329,    96,   330,    97,    98,    99,   100,   101,   102,   103,
+       0,   104,   331,   105,   106,   107,   108,     0,   109,   332,
+     110,     0,     0,     0,     0,     0,   111,   333,     0,   112,
      334,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,   335,   336,     0,     0,
-       0,   337,   338,   339,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   337,   338,   339,     0,
+       0,     0,     0,   341,     0,     0,     0,     0,     0,     0,
+       0,     0,   113,   114,     0,     0,     0,     0,     0,     0,
+     115,     0,     0,     0,   116,     0,     0,     0,     0,     0,
+     117,     0,     0,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,     0,   128,     0,     0,     0,     0,     0,
+     129,     0,     0,   130,     0,     0,     0,   131,     0,     0,
+     132,   133,     0,   134,     0,     0,   135,     0,   136,     0,
+       0,     0,   137,   138,     0,     0,     0,     0,     0,     0,
+     342,   343,   344,   345,     0,     0,     0,     0,     0,     0,
+     143,     0,     0,     0,   346,     0,     0,     0,   347,   348,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   144,     0,     0,     0,     0,   145,
+     146,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   349,
+       0,   350,   293,   294,   295,   296,   297,   298,   299,   300,
+     301,   302,   303,   304,     0,     0,   305,   306,     0,     0,
+      73,    74,     0,     0,    75,   307,   308,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    76,     0,     0,    77,
+       0,     0,   309,   310,   311,   312,   313,   314,   315,     0,
+      78,     0,     0,   267,   268,   269,     0,     0,     0,     0,
+     316,    79,     0,     0,     0,   162,   163,   164,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    80,     0,     0,
+      81,     0,     0,    82,     0,     0,     0,     0,     0,    83,
+       0,     0,     0,     0,    84,    85,    86,     0,     0,     0,
+       0,     0,     0,     0,     0,   318,     0,     0,    87,   319,
+       0,    88,     0,    89,    90,    91,     0,     0,     0,   320,
+      92,    93,     0,     0,     0,     0,     0,     0,     0,   321,
+     322,   323,   324,   325,     0,   326,   327,    94,    95,   328,
+     329,    96,   330,    97,    98,    99,   100,   101,   102,   103,
+       0,   104,   331,   105,   106,   107,   108,     0,   109,   332,
+     110,     0,     0,     0,     0,     0,   111,   601,     0,   112,
+       0,     0,     0,     0,     0,  1724,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   335,   336,     0,     0,
+       0,     0,     0,     0,     0,     0,   337,   338,   339,     0,
+       0,     0,     0,   341,     0,     0,     0,     0,     0,     0,
+       0,     0,   113,   114,     0,     0,     0,     0,     0,     0,
+     115,     0,     0,     0,   116,     0,     0,     0,     0,     0,
+     117,     0,     0,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,     0,   128,     0,     0,     0,     0,     0,
+     129,     0,     0,   130,     0,     0,     0,   131,     0,     0,
+     132,   133,     0,   134,     0,     0,   135,     0,   136,     0,
+       0,     0,   137,   138,     0,     0,     0,     0,     0,     0,
+     342,   343,   344,   345,     0,     0,     0,     0,     0,     0,
+     143,     0,     0,     0,   346,     0,     0,     0,   347,   348,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   144,     0,     0,     0,     0,   145,
+     146,     0,     0,     0,     0,     0,     0,  1725,     0,     0,
+       0,     0,     0,     0,  1726,     0,     0,     0,     0,     0,
+       0,   350,   293,   294,   295,   296,   297,   298,   299,   300,
+     301,   302,   303,   304,     0,     0,   305,   306,     0,     0,
+      73,    74,     0,     0,    75,   307,   308,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    76,     0,     0,    77,
+       0,     0,   309,   310,   311,   312,   313,   314,   315,     0,
+      78,     0,     0,   267,   268,   269,     0,     0,     0,     0,
+     316,    79,     0,     0,   160,   162,   163,   164,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    80,     0,     0,
+      81,     0,     0,    82,     0,     0,     0,     0,     0,    83,
+       0,     0,     0,     0,    84,    85,    86,     0,     0,     0,
+       0,     0,     0,     0,     0,   318,     0,     0,    87,   319,
+       0,    88,     0,    89,    90,    91,     0,     0,     0,   320,
+      92,    93,     0,     0,     0,     0,     0,     0,     0,   321,
+     322,   323,   324,   325,     0,   326,   327,    94,    95,   328,
+     329,    96,   330,    97,    98,    99,   100,   101,   102,   103,
+       0,   104,   331,   105,   106,   107,   108,     0,   109,   332,
+     110,     0,     0,     0,     0,     0,   111,   705,   706,   112,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   335,   336,     0,     0,
+       0,     0,     0,     0,     0,     0,   337,   338,   339,     0,
        0,     0,     0,   341,     0,     0,     0,     0,     0,     0,
        0,     0,   113,   114,     0,     0,     0,     0,     0,     0,
      115,     0,     0,     0,   116,     0,     0,     0,     0,     0,
@@ -3075,189 +3227,116 @@ static const yytype_int16 yytable[] =
      125,   126,   127,     0,   128,     0,     0,     0,     0,     0,
      129,     0,     0,   130,     0,     0,     0,   131,     0,     0,
      132,   133,     0,   134,     0,     0,   135,     0,   136,     0,
-       0,     0,   137,   138,     0,     0,   592,     0,     0,   342,
+       0,     0,   137,   138,     0,     0,     0,     0,     0,     0,
+     342,   343,   344,   345,     0,     0,     0,     0,     0,     0,
+     143,     0,     0,     0,   346,     0,     0,     0,   347,   348,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   144,     0,     0,     0,     0,   145,
+     146,   293,   294,   295,   296,   297,   298,   299,   300,   301,
+     302,   303,   304,     0,     0,   305,   306,     0,     0,    73,
+      74,   350,     0,    75,   307,   308,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    76,     0,     0,    77,     0,
+       0,   309,   310,   311,   312,   313,   314,   315,     0,    78,
+       0,     0,   267,   268,   269,     0,     0,     0,     0,   316,
+      79,     0,     0,     0,   162,   163,   164,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    80,     0,     0,    81,
+       0,     0,    82,     0,     0,     0,     0,     0,    83,     0,
+       0,     0,     0,    84,    85,    86,     0,     0,     0,     0,
+       0,     0,     0,     0,   318,     0,     0,    87,   319,     0,
+      88,     0,    89,    90,    91,     0,     0,     0,   320,    92,
+      93,     0,     0,     0,     0,     0,     0,     0,   321,   322,
+     323,   324,   325,     0,   326,   327,    94,    95,   328,   329,
+      96,   330,    97,    98,    99,   100,   101,   102,   103,     0,
+     104,   331,   105,   106,   107,   108,     0,   109,   332,   110,
+       0,     0,     0,     0,     0,   111,   601,     0,   112,     0,
+       0,   986,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   335,   336,     0,     0,     0,
+       0,     0,     0,     0,     0,   337,   338,   339,     0,   987,
+       0,     0,   341,     0,     0,     0,     0,     0,     0,     0,
+       0,   113,   114,     0,     0,     0,     0,     0,     0,   115,
+       0,     0,     0,   116,     0,     0,     0,     0,     0,   117,
+       0,     0,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,     0,   988,     0,     0,     0,     0,     0,   129,
+       0,     0,   130,     0,     0,     0,   131,     0,     0,   132,
+     133,     0,   134,     0,     0,   135,     0,   136,     0,     0,
+       0,   137,   138,     0,     0,     0,     0,     0,     0,   342,
      343,   344,   345,     0,     0,     0,     0,     0,     0,   143,
        0,     0,     0,   346,     0,     0,     0,   347,   348,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,   144,     0,     0,     0,     0,   145,   146,
+     293,   294,   295,   296,   297,   298,   299,   300,   301,   302,
+     303,   304,     0,     0,   305,   306,     0,     0,    73,    74,
+     350,     0,    75,   307,   308,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    76,     0,     0,    77,     0,     0,
+     309,   310,   311,   312,   313,   314,   315,     0,    78,     0,
+       0,   267,   268,   269,     0,     0,     0,     0,   316,    79,
+       0,     0,     0,   162,   163,   164,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    80,     0,     0,    81,     0,
+       0,    82,     0,     0,     0,     0,     0,    83,     0,     0,
+       0,     0,    84,    85,    86,     0,     0,     0,     0,     0,
+       0,     0,     0,   318,     0,     0,    87,   319,     0,    88,
+       0,    89,    90,    91,     0,     0,     0,   320,    92,    93,
+       0,     0,     0,     0,     0,     0,     0,   321,   322,   323,
+     324,   325,  1542,   326,   327,    94,    95,   328,   329,    96,
+     330,    97,    98,    99,   100,   101,   102,   103,   877,   104,
+     331,   105,   106,   107,   108,     0,   109,   332,   110,     0,
+       0,     0,     0,     0,   111,   601,     0,   112,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   335,   336,     0,     0,     0,     0,
+       0,     0,     0,     0,   337,   338,   339,     0,     0,     0,
+       0,   341,     0,     0,     0,     0,     0,     0,     0,     0,
+     113,   114,     0,     0,     0,     0,     0,     0,   115,     0,
+       0,     0,   116,     0,     0,     0,     0,     0,   117,     0,
+       0,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,     0,   128,     0,     0,     0,     0,     0,   129,     0,
+       0,   130,     0,     0,     0,   131,     0,     0,   132,   133,
+       0,   134,     0,     0,   135,     0,   136,     0,     0,     0,
+     137,   138,     0,     0,     0,     0,     0,     0,   342,   343,
+     344,   345,     0,     0,     0,     0,     0,     0,   143,     0,
+       0,     0,   346,     0,     0,     0,   347,   348,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   349,   293,   350,
+       0,     0,   144,     0,     0,     0,     0,   145,   146,   293,
      294,   295,   296,   297,   298,   299,   300,   301,   302,   303,
-     304,     0,     0,   305,   306,     0,     0,    73,    74,     0,
+     304,     0,     0,   305,   306,     0,     0,    73,    74,   350,
        0,    75,   307,   308,     0,     0,     0,     0,     0,     0,
        0,     0,     0,    76,     0,     0,    77,     0,     0,   309,
      310,   311,   312,   313,   314,   315,     0,    78,     0,     0,
      267,   268,   269,     0,     0,     0,     0,   316,    79,     0,
-       0,     0,   165,   166,   167,     0,     0,     0,     0,     0,
+       0,     0,   162,   163,   164,     0,     0,     0,     0,     0,
        0,     0,     0,     0,    80,     0,     0,    81,     0,     0,
       82,     0,     0,     0,     0,     0,    83,     0,     0,     0,
-       0,    84,    85,    86,     0,     0,     0,     0,   317,     0,
+       0,    84,    85,    86,     0,     0,     0,     0,     0,     0,
        0,     0,   318,     0,     0,    87,   319,     0,    88,     0,
       89,    90,    91,     0,     0,     0,   320,    92,    93,     0,
        0,     0,     0,     0,     0,     0,   321,   322,   323,   324,
      325,     0,   326,   327,    94,    95,   328,   329,    96,   330,
       97,    98,    99,   100,   101,   102,   103,     0,   104,   331,
      105,   106,   107,   108,     0,   109,   332,   110,     0,     0,
-       0,     0,     0,   111,     0,   333,     0,   112,   334,     0,
-     949,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     950,   951,     0,     0,   335,   336,     0,     0,     0,   337,
-     338,   339,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   341,     0,     0,     0,     0,     0,     0,     0,     0,
-     113,   114,     0,     0,     0,     0,     0,     0,   115,     0,
-       0,     0,   116,     0,     0,     0,     0,     0,   117,     0,
-       0,   118,   119,   120,   121,   122,   123,   124,   125,   126,
-     127,     0,   128,     0,     0,     0,     0,     0,   129,     0,
-       0,   130,     0,     0,     0,   131,     0,     0,   132,   133,
-       0,   134,     0,     0,   135,     0,   136,     0,     0,     0,
-     137,   138,     0,     0,     0,     0,     0,   342,   343,   344,
+       0,     0,     0,   111,   601,     0,   112,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   335,   336,     0,     0,     0,     0,     0,
+       0,     0,     0,   337,   338,   339,     0,     0,     0,     0,
+     341,     0,     0,     0,     0,     0,     0,     0,     0,   113,
+     114,     0,     0,     0,     0,     0,     0,   115,     0,     0,
+       0,   116,     0,     0,     0,     0,     0,   117,     0,     0,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+       0,   128,     0,     0,     0,     0,     0,   129,     0,     0,
+     130,     0,     0,     0,   131,     0,     0,   132,   133,     0,
+     134,     0,     0,   135,     0,   136,     0,     0,     0,   137,
+     138,     0,     0,     0,     0,     0,     0,   342,   343,   344,
      345,     0,     0,     0,     0,     0,     0,   143,     0,     0,
        0,   346,     0,     0,     0,   347,   348,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,   144,     0,     0,     0,     0,   145,   146,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   349,   293,   350,   294,   295,
-     296,   297,   298,   299,   300,   301,   302,   303,   304,     0,
-       0,   305,   306,     0,     0,    73,    74,     0,     0,    75,
-     307,   308,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    76,     0,     0,    77,     0,     0,   309,   310,   311,
-     312,   313,   314,   315,     0,    78,     0,     0,   267,   268,
-     269,     0,     0,     0,     0,   316,    79,     0,     0,   163,
-     165,   166,   167,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    80,     0,     0,    81,     0,     0,    82,     0,
-       0,     0,     0,     0,    83,     0,     0,     0,     0,    84,
-      85,    86,     0,     0,     0,     0,   317,     0,     0,     0,
-     318,     0,     0,    87,   319,     0,    88,     0,    89,    90,
-      91,     0,     0,     0,   320,    92,    93,     0,     0,     0,
-       0,     0,     0,     0,   321,   322,   323,   324,   325,     0,
-     326,   327,    94,    95,   328,   329,    96,   330,    97,    98,
-      99,   100,   101,   102,   103,     0,   104,   331,   105,   106,
-     107,   108,     0,   109,   332,   110,     0,     0,     0,     0,
-       0,   111,    13,   591,     0,   112,   334,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   335,   336,     0,     0,     0,   337,   338,   339,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   341,
-       0,     0,     0,     0,     0,     0,     0,     0,   113,   114,
-       0,     0,     0,     0,     0,     0,   115,     0,     0,     0,
-     116,     0,     0,     0,     0,     0,   117,     0,     0,   118,
-     119,   120,   121,   122,   123,   124,   125,   126,   127,     0,
-     128,     0,     0,     0,     0,     0,   129,     0,     0,   130,
-       0,     0,     0,   131,     0,     0,   132,   133,     0,   134,
-       0,     0,   135,     0,   136,     0,     0,     0,  1633,   138,
-       0,     0,     0,     0,     0,   342,   343,   344,   345,     0,
-       0,     0,     0,     0,     0,   143,     0,     0,     0,   346,
-       0,     0,     0,   347,   348,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   144,
-       0,     0,     0,     0,   145,   146,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   349,   293,   350,   294,   295,   296,   297,
-     298,   299,   300,   301,   302,   303,   304,     0,     0,   305,
-     306,     0,     0,    73,    74,     0,     0,    75,   307,   308,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    76,
-       0,     0,    77,     0,     0,   309,   310,   311,   312,   313,
-     314,   315,     0,    78,     0,     0,   267,   268,   269,     0,
-       0,     0,     0,   316,    79,     0,     0,     0,   165,   166,
-     167,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      80,     0,     0,    81,     0,     0,    82,     0,     0,     0,
-       0,     0,    83,     0,     0,     0,     0,    84,    85,    86,
-       0,     0,     0,     0,   317,     0,     0,     0,   318,     0,
-       0,    87,   319,     0,    88,     0,    89,    90,    91,     0,
-       0,     0,   320,    92,    93,     0,     0,     0,     0,     0,
-       0,     0,   321,   322,   323,   324,   325,     0,   326,   327,
-      94,    95,   328,   329,    96,   330,    97,    98,    99,   100,
-     101,   102,   103,     0,   104,   331,   105,   106,   107,   108,
-       0,   109,   332,   110,     0,     0,     0,     0,     0,   111,
-       0,   333,     0,   112,   334,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     335,   336,     0,     0,     0,   337,   338,   339,     0,     0,
-       0,     0,     0,     0,   340,     0,     0,   341,     0,     0,
-       0,     0,     0,     0,     0,     0,   113,   114,     0,     0,
-       0,     0,     0,     0,   115,     0,     0,     0,   116,     0,
-       0,     0,     0,     0,   117,     0,     0,   118,   119,   120,
-     121,   122,   123,   124,   125,   126,   127,     0,   128,     0,
-       0,     0,     0,     0,   129,     0,     0,   130,     0,     0,
-       0,   131,     0,     0,   132,   133,     0,   134,     0,     0,
-     135,     0,   136,     0,     0,     0,   137,   138,     0,     0,
-       0,     0,     0,   342,   343,   344,   345,     0,     0,     0,
-       0,     0,     0,   143,     0,     0,     0,   346,     0,     0,
-       0,   347,   348,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   144,     0,     0,
-       0,     0,   145,   146,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   349,   293,   350,   294,   295,   296,   297,   298,   299,
-     300,   301,   302,   303,   304,     0,     0,   305,   306,     0,
-       0,    73,    74,     0,     0,    75,   307,   308,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    76,     0,     0,
-      77,     0,     0,   309,   310,   311,   312,   313,   314,   315,
-       0,    78,     0,     0,   267,   268,   269,     0,     0,     0,
-       0,   316,    79,     0,     0,     0,   165,   166,   167,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    80,     0,
-       0,    81,     0,     0,    82,     0,     0,     0,     0,     0,
-      83,     0,     0,     0,     0,    84,    85,    86,     0,     0,
-       0,     0,   317,     0,     0,     0,   318,     0,     0,    87,
-     319,     0,    88,     0,    89,    90,    91,     0,     0,     0,
-     320,    92,    93,     0,     0,     0,     0,     0,     0,     0,
-     321,   322,   323,   324,   325,     0,   326,   327,    94,    95,
-     328,   329,    96,   330,    97,    98,    99,   100,   101,   102,
-     103,     0,   104,   331,   105,   106,   107,   108,     0,   109,
-     332,   110,     0,     0,     0,     0,     0,   111,     0,   333,
-       0,   112,   334,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   335,   336,
-       0,     0,     0,   337,   338,   339,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   341,     0,     0,     0,     0,
-       0,     0,     0,     0,   113,   114,     0,     0,     0,     0,
-       0,     0,   115,     0,     0,     0,   116,     0,     0,     0,
-       0,     0,   117,     0,     0,   118,   119,   120,   121,   122,
-     123,   124,   125,   126,   127,     0,   128,     0,     0,     0,
-       0,     0,   129,     0,     0,   130,     0,     0,     0,   131,
-       0,     0,   132,   133,     0,   134,     0,     0,   135,     0,
-     136,     0,     0,     0,   137,   138,     0,     0,     0,     0,
-       0,   342,   343,   344,   345,     0,     0,     0,     0,     0,
-       0,   143,     0,     0,     0,   346,     0,     0,     0,   347,
-     348,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   144,     0,     0,     0,     0,
-     145,   146,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   349,
-     293,   350,   294,   295,   296,   297,   298,   299,   300,   301,
-     302,   303,   304,     0,     0,   305,   306,     0,     0,    73,
-      74,     0,     0,    75,   307,   308,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    76,     0,     0,    77,     0,
-       0,   309,   310,   311,   312,   313,   314,   315,     0,    78,
-       0,     0,   267,   268,   269,     0,     0,     0,     0,   316,
-      79,     0,     0,     0,   165,   166,   167,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    80,     0,     0,    81,
-       0,     0,    82,     0,     0,     0,     0,     0,    83,     0,
-       0,     0,     0,    84,    85,    86,     0,     0,     0,     0,
-       0,     0,     0,     0,   318,     0,     0,    87,   319,     0,
-      88,     0,    89,    90,    91,     0,     0,     0,   320,    92,
-      93,     0,     0,     0,     0,     0,     0,     0,   321,   322,
-     323,   324,   325,     0,   326,   327,    94,    95,   328,   329,
-      96,   330,    97,    98,    99,   100,   101,   102,   103,     0,
-     104,   331,   105,   106,   107,   108,     0,   109,   332,   110,
-       0,     0,     0,     0,     0,   111,     0,   601,     0,   112,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-    1720,     0,     0,     0,     0,     0,   335,   336,     0,     0,
-       0,   337,   338,   339,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   341,     0,     0,     0,     0,     0,     0,
-       0,     0,   113,   114,     0,     0,     0,     0,     0,     0,
-     115,     0,     0,     0,   116,     0,     0,     0,     0,     0,
-     117,     0,     0,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,     0,   128,     0,     0,     0,     0,     0,
-     129,     0,     0,   130,     0,     0,     0,   131,     0,     0,
-     132,   133,     0,   134,     0,     0,   135,     0,   136,     0,
-       0,     0,   137,   138,     0,     0,     0,     0,     0,   342,
-     343,   344,   345,     0,     0,     0,     0,     0,     0,   143,
-       0,     0,     0,   346,     0,     0,     0,   347,   348,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   144,     0,     0,     0,     0,   145,   146,
-       0,     0,     0,     0,     0,     0,  1721,     0,     0,     0,
-       0,     0,     0,  1722,     0,     0,     0,     0,   293,   350,
+       0,     0,     0,     0,  1725,     0,     0,     0,     0,     0,
+       0,  1726,     0,     0,     0,     0,     0,     0,   350,   293,
      294,   295,   296,   297,   298,   299,   300,   301,   302,   303,
      304,     0,     0,   305,   306,     0,     0,    73,    74,     0,
        0,    75,   307,   308,     0,     0,     0,     0,     0,     0,
        0,     0,     0,    76,     0,     0,    77,     0,     0,   309,
      310,   311,   312,   313,   314,   315,     0,    78,     0,     0,
      267,   268,   269,     0,     0,     0,     0,   316,    79,     0,
-       0,     0,   165,   166,   167,     0,     0,     0,     0,     0,
+       0,     0,   162,   163,   164,     0,     0,     0,     0,     0,
        0,     0,     0,     0,    80,     0,     0,    81,     0,     0,
       82,     0,     0,     0,     0,     0,    83,     0,     0,     0,
        0,    84,    85,    86,     0,     0,     0,     0,     0,     0,
@@ -3267,95 +3346,31 @@ static const yytype_int16 yytable[] =
      325,     0,   326,   327,    94,    95,   328,   329,    96,   330,
       97,    98,    99,   100,   101,   102,   103,     0,   104,   331,
      105,   106,   107,   108,     0,   109,   332,   110,     0,     0,
-       0,     0,     0,   111,     0,   601,     0,   112,     0,     0,
+       0,     0,     0,   111,   601,     0,   112,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   985,     0,     0,   335,   336,     0,     0,     0,   337,
-     338,   339,     0,     0,     0,     0,     0,     0,   986,     0,
-       0,   341,     0,     0,     0,     0,     0,     0,     0,     0,
-     113,   114,     0,     0,     0,     0,     0,     0,   115,     0,
-       0,     0,   116,     0,     0,     0,     0,     0,   117,     0,
-       0,   118,   119,   120,   121,   122,   123,   124,   125,   126,
-     127,     0,   987,     0,     0,     0,     0,     0,   129,     0,
-       0,   130,     0,     0,     0,   131,     0,     0,   132,   133,
-       0,   134,     0,     0,   135,     0,   136,     0,     0,     0,
-     137,   138,     0,     0,     0,     0,     0,   342,   343,   344,
+       0,     0,     0,   335,   336,     0,     0,     0,     0,     0,
+       0,     0,     0,   337,   338,   339,     0,     0,     0,     0,
+     341,     0,     0,     0,     0,     0,     0,     0,     0,   113,
+     114,     0,     0,     0,     0,     0,     0,   115,     0,     0,
+       0,   116,     0,     0,     0,     0,     0,   117,     0,     0,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+       0,   128,     0,     0,     0,     0,     0,   129,     0,     0,
+     130,     0,     0,     0,   131,     0,     0,   132,   133,     0,
+     134,     0,     0,   135,     0,   136,     0,     0,     0,   137,
+     138,     0,     0,     0,     0,     0,     0,   342,   343,   344,
      345,     0,     0,     0,     0,     0,     0,   143,     0,     0,
        0,   346,     0,     0,     0,   347,   348,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   144,     0,     0,     0,     0,   145,   146,     0,   293,
-       0,   294,   295,   296,   297,   298,   299,   300,   301,   302,
-     303,   304,     0,     0,   305,   306,     0,   350,    73,    74,
-       0,     0,    75,   307,   308,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    76,     0,     0,    77,     0,     0,
-     309,   310,   311,   312,   313,   314,   315,     0,    78,     0,
-       0,   267,   268,   269,     0,     0,     0,     0,   316,    79,
-       0,     0,     0,   165,   166,   167,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    80,     0,     0,    81,     0,
-       0,    82,     0,     0,     0,     0,     0,    83,     0,     0,
-       0,     0,    84,    85,    86,     0,     0,     0,     0,     0,
-       0,     0,     0,   318,     0,     0,    87,   319,     0,    88,
-       0,    89,    90,    91,     0,     0,     0,   320,    92,    93,
-       0,     0,     0,     0,     0,     0,     0,   321,   322,   323,
-     324,   325,  1536,   326,   327,    94,    95,   328,   329,    96,
-     330,    97,    98,    99,   100,   101,   102,   103,   876,   104,
-     331,   105,   106,   107,   108,     0,   109,   332,   110,     0,
-       0,     0,     0,     0,   111,     0,   601,     0,   112,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   335,   336,     0,     0,     0,
-     337,   338,   339,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   341,     0,     0,     0,     0,     0,     0,     0,
-       0,   113,   114,     0,     0,     0,     0,     0,     0,   115,
-       0,     0,     0,   116,     0,     0,     0,     0,     0,   117,
-       0,     0,   118,   119,   120,   121,   122,   123,   124,   125,
-     126,   127,     0,   128,     0,     0,     0,     0,     0,   129,
-       0,     0,   130,     0,     0,     0,   131,     0,     0,   132,
-     133,     0,   134,     0,     0,   135,     0,   136,     0,     0,
-       0,   137,   138,     0,     0,     0,     0,     0,   342,   343,
-     344,   345,     0,     0,     0,     0,     0,     0,   143,     0,
-       0,     0,   346,     0,     0,     0,   347,   348,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   144,     0,     0,     0,     0,   145,   146,     0,
-     293,     0,   294,   295,   296,   297,   298,   299,   300,   301,
-     302,   303,   304,     0,     0,   305,   306,     0,   350,    73,
-      74,     0,     0,    75,   307,   308,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    76,     0,     0,    77,     0,
-       0,   309,   310,   311,   312,   313,   314,   315,     0,    78,
-       0,     0,   267,   268,   269,     0,     0,     0,     0,   316,
-      79,     0,     0,     0,   165,   166,   167,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    80,     0,     0,    81,
-       0,     0,    82,     0,     0,     0,     0,     0,    83,     0,
-       0,     0,     0,    84,    85,    86,     0,     0,     0,     0,
-       0,     0,     0,     0,   318,     0,     0,    87,   319,     0,
-      88,     0,    89,    90,    91,     0,     0,     0,   320,    92,
-      93,     0,     0,     0,     0,     0,     0,     0,   321,   322,
-     323,   324,   325,     0,   326,   327,    94,    95,   328,   329,
-      96,   330,    97,    98,    99,   100,   101,   102,   103,     0,
-     104,   331,   105,   106,   107,   108,     0,   109,   332,   110,
-       0,     0,     0,     0,     0,   111,     0,   601,     0,   112,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   335,   336,     0,     0,
-       0,   337,   338,   339,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   341,     0,     0,     0,     0,     0,     0,
-       0,     0,   113,   114,     0,     0,     0,     0,     0,     0,
-     115,     0,     0,     0,   116,     0,     0,     0,     0,     0,
-     117,     0,     0,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,     0,   128,     0,     0,     0,     0,     0,
-     129,     0,     0,   130,     0,     0,     0,   131,     0,     0,
-     132,   133,     0,   134,     0,     0,   135,     0,   136,     0,
-       0,     0,   137,   138,     0,     0,     0,     0,     0,   342,
-     343,   344,   345,     0,     0,     0,     0,     0,     0,   143,
-       0,     0,     0,   346,     0,     0,     0,   347,   348,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   144,     0,     0,     0,     0,   145,   146,
-       0,     0,     0,     0,     0,     0,  1721,     0,     0,     0,
-       0,     0,     0,  1722,     0,     0,     0,     0,   293,   350,
+       0,   144,     0,     0,     0,     0,   145,   146,     0,     0,
+       0,     0,     0,     0,  1965,     0,     0,     0,     0,     0,
+       0,  1966,     0,     0,     0,     0,     0,     0,   350,   293,
      294,   295,   296,   297,   298,   299,   300,   301,   302,   303,
      304,     0,     0,   305,   306,     0,     0,    73,    74,     0,
        0,    75,   307,   308,     0,     0,     0,     0,     0,     0,
        0,     0,     0,    76,     0,     0,    77,     0,     0,   309,
      310,   311,   312,   313,   314,   315,     0,    78,     0,     0,
      267,   268,   269,     0,     0,     0,     0,   316,    79,     0,
-       0,     0,   165,   166,   167,     0,     0,     0,     0,     0,
+       0,     0,   162,   163,   164,     0,     0,     0,     0,     0,
        0,     0,     0,     0,    80,     0,     0,    81,     0,     0,
       82,     0,     0,     0,     0,     0,    83,     0,     0,     0,
        0,    84,    85,    86,     0,     0,     0,     0,     0,     0,
@@ -3365,63 +3380,29 @@ static const yytype_int16 yytable[] =
      325,     0,   326,   327,    94,    95,   328,   329,    96,   330,
       97,    98,    99,   100,   101,   102,   103,     0,   104,   331,
      105,   106,   107,   108,     0,   109,   332,   110,     0,     0,
-       0,     0,     0,   111,     0,   601,     0,   112,     0,     0,
+       0,     0,     0,   111,   601,     0,   112,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   335,   336,     0,     0,     0,   337,
-     338,   339,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   341,     0,     0,     0,     0,     0,     0,     0,     0,
-     113,   114,     0,     0,     0,     0,     0,     0,   115,     0,
-       0,     0,   116,     0,     0,     0,     0,     0,   117,     0,
-       0,   118,   119,   120,   121,   122,   123,   124,   125,   126,
-     127,     0,   128,     0,     0,     0,     0,     0,   129,     0,
-       0,   130,     0,     0,     0,   131,     0,     0,   132,   133,
-       0,   134,     0,     0,   135,     0,   136,     0,     0,     0,
-     137,   138,     0,     0,     0,     0,     0,   342,   343,   344,
+       0,     0,     0,   335,   336,     0,     0,     0,     0,     0,
+       0,     0,     0,   337,   338,   339,     0,     0,     0,     0,
+     341,     0,     0,     0,     0,     0,     0,     0,     0,   113,
+     114,     0,     0,     0,     0,     0,     0,   115,     0,     0,
+       0,   116,     0,     0,     0,     0,     0,   117,     0,     0,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+       0,   128,     0,     0,     0,     0,     0,   129,     0,     0,
+     130,     0,     0,     0,   131,     0,     0,   132,   133,     0,
+     134,     0,     0,   135,     0,   136,     0,     0,     0,   137,
+     138,     0,     0,     0,     0,     0,     0,   342,   343,   344,
      345,     0,     0,     0,     0,     0,     0,   143,     0,     0,
-       0,   346,     0,     0,     0,   347,   348,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   144,     0,     0,     0,     0,   145,   146,     0,     0,
-       0,     0,     0,     0,  1963,     0,     0,     0,     0,     0,
-       0,  1964,     0,     0,     0,     0,   293,   350,   294,   295,
-     296,   297,   298,   299,   300,   301,   302,   303,   304,     0,
-       0,   305,   306,     0,     0,    73,    74,     0,     0,    75,
-     307,   308,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    76,     0,     0,    77,     0,     0,   309,   310,   311,
-     312,   313,   314,   315,     0,    78,     0,     0,   267,   268,
-     269,     0,     0,     0,     0,   316,    79,     0,     0,     0,
-     165,   166,   167,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    80,     0,     0,    81,     0,     0,    82,     0,
-       0,     0,     0,     0,    83,     0,     0,     0,     0,    84,
-      85,    86,     0,     0,     0,     0,     0,     0,     0,     0,
-     318,     0,     0,    87,   319,     0,    88,     0,    89,    90,
-      91,     0,     0,     0,   320,    92,    93,     0,     0,     0,
-       0,     0,     0,     0,   321,   322,   323,   324,   325,     0,
-     326,   327,    94,    95,   328,   329,    96,   330,    97,    98,
-      99,   100,   101,   102,   103,     0,   104,   331,   105,   106,
-     107,   108,     0,   109,   332,   110,     0,     0,     0,     0,
-       0,   111,     0,   601,     0,   112,     0,     0,     0,     0,
+       0,   346,   616,     0,     0,   347,   348,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   335,   336,     0,     0,     0,   337,   338,   339,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   341,
-       0,     0,     0,     0,     0,     0,     0,     0,   113,   114,
-       0,     0,     0,     0,     0,     0,   115,     0,     0,     0,
-     116,     0,     0,     0,     0,     0,   117,     0,     0,   118,
-     119,   120,   121,   122,   123,   124,   125,   126,   127,     0,
-     128,     0,     0,     0,     0,     0,   129,     0,     0,   130,
-       0,     0,     0,   131,     0,     0,   132,   133,     0,   134,
-       0,     0,   135,     0,   136,     0,     0,     0,   137,   138,
-       0,     0,     0,     0,     0,   342,   343,   344,   345,     0,
-       0,     0,     0,     0,     0,   143,     0,     0,     0,   346,
-     616,     0,     0,   347,   348,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   144,
-       0,     0,     0,     0,   145,   146,     0,   293,     0,   294,
+       0,   144,     0,     0,     0,     0,   145,   146,   293,   294,
      295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-       0,     0,   305,   306,     0,   350,    73,    74,     0,     0,
+       0,     0,   305,   306,     0,     0,    73,    74,   350,     0,
       75,   307,   308,     0,     0,     0,     0,     0,     0,     0,
        0,     0,    76,     0,     0,    77,     0,     0,   309,   310,
      311,   312,   313,   314,   315,     0,    78,     0,     0,   267,
      268,   269,     0,     0,     0,     0,   316,    79,     0,     0,
-       0,   165,   166,   167,     0,     0,     0,     0,     0,     0,
+       0,   162,   163,   164,     0,     0,     0,     0,     0,     0,
        0,     0,     0,    80,     0,     0,    81,     0,     0,    82,
        0,     0,     0,     0,     0,    83,     0,     0,     0,     0,
       84,    85,    86,     0,     0,     0,     0,     0,     0,     0,
@@ -3431,724 +3412,571 @@ static const yytype_int16 yytable[] =
        0,   326,   327,    94,    95,   328,   329,    96,   330,    97,
       98,    99,   100,   101,   102,   103,     0,   104,   331,   105,
      106,   107,   108,     0,   109,   332,   110,     0,     0,     0,
-       0,     0,   111,     0,   601,   695,   112,     0,     0,     0,
+       0,     0,   111,   601,   692,   112,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   335,   336,     0,     0,     0,   337,   338,
-     339,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     341,     0,     0,     0,     0,     0,     0,     0,     0,   113,
-     114,     0,     0,     0,     0,     0,     0,   115,     0,     0,
-       0,   116,     0,     0,     0,     0,     0,   117,     0,     0,
-     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
-       0,   128,     0,     0,     0,     0,     0,   129,     0,     0,
-     130,     0,     0,     0,   131,     0,     0,   132,   133,     0,
-     134,     0,     0,   135,     0,   136,     0,     0,     0,   137,
-     138,     0,     0,     0,     0,     0,   342,   343,   344,   345,
+       0,     0,   335,   336,     0,     0,     0,     0,     0,     0,
+       0,     0,   337,   338,   339,     0,     0,     0,     0,   341,
+       0,     0,     0,     0,     0,     0,     0,     0,   113,   114,
+       0,     0,     0,     0,     0,     0,   115,     0,     0,     0,
+     116,     0,     0,     0,     0,     0,   117,     0,     0,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,     0,
+     128,     0,     0,     0,     0,     0,   129,     0,     0,   130,
+       0,     0,     0,   131,     0,     0,   132,   133,     0,   134,
+       0,     0,   135,     0,   136,     0,     0,     0,   137,   138,
+       0,     0,     0,     0,     0,     0,   342,   343,   344,   345,
        0,     0,     0,     0,     0,     0,   143,     0,     0,     0,
      346,     0,     0,     0,   347,   348,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     144,     0,     0,     0,     0,   145,   146,     0,   293,     0,
-     294,   295,   296,   297,   298,   299,   300,   301,   302,   303,
-     304,     0,     0,   305,   306,     0,   350,    73,    74,     0,
-       0,    75,   307,   308,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    76,     0,     0,    77,     0,     0,   309,
-     310,   311,   312,   313,   314,   315,     0,    78,     0,     0,
-     267,   268,   269,     0,     0,     0,     0,   316,    79,     0,
-       0,     0,   165,   166,   167,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    80,     0,     0,    81,     0,     0,
-      82,     0,     0,     0,     0,     0,    83,     0,     0,     0,
-       0,    84,    85,    86,     0,     0,     0,     0,     0,     0,
-       0,     0,   318,     0,     0,    87,   319,     0,    88,     0,
-      89,    90,    91,     0,     0,     0,   320,    92,    93,     0,
-       0,     0,     0,     0,     0,     0,   321,   322,   323,   324,
-     325,     0,   326,   327,    94,    95,   328,   329,    96,   330,
-      97,    98,    99,   100,   101,   102,   103,     0,   104,   331,
-     105,   106,   107,   108,     0,   109,   332,   110,     0,     0,
-       0,     0,     0,   111,     0,   601,     0,   112,     0,   969,
+     144,     0,     0,     0,     0,   145,   146,   293,   294,   295,
+     296,   297,   298,   299,   300,   301,   302,   303,   304,     0,
+       0,   305,   306,     0,     0,    73,    74,   350,     0,    75,
+     307,   308,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    76,     0,     0,    77,     0,     0,   309,   310,   311,
+     312,   313,   314,   315,     0,    78,     0,     0,   267,   268,
+     269,     0,     0,     0,     0,   316,    79,     0,     0,     0,
+     162,   163,   164,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    80,     0,     0,    81,     0,     0,    82,     0,
+       0,     0,     0,     0,    83,     0,     0,     0,     0,    84,
+      85,    86,     0,     0,     0,     0,     0,     0,     0,     0,
+     318,     0,     0,    87,   319,     0,    88,     0,    89,    90,
+      91,     0,     0,     0,   320,    92,    93,     0,     0,     0,
+       0,     0,     0,     0,   321,   322,   323,   324,   325,     0,
+     326,   327,    94,    95,   328,   329,    96,   330,    97,    98,
+      99,   100,   101,   102,   103,     0,   104,   331,   105,   106,
+     107,   108,     0,   109,   332,   110,     0,     0,     0,     0,
+       0,   111,   601,     0,   112,     0,   970,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   335,   336,     0,     0,     0,   337,
-     338,   339,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   341,     0,     0,     0,     0,     0,     0,     0,     0,
-     113,   114,     0,     0,     0,     0,     0,     0,   115,     0,
-       0,     0,   116,     0,     0,     0,     0,     0,   117,     0,
-       0,   118,   119,   120,   121,   122,   123,   124,   125,   126,
-     127,     0,   128,     0,     0,     0,     0,     0,   129,     0,
-       0,   130,     0,     0,     0,   131,     0,     0,   132,   133,
-       0,   134,     0,     0,   135,     0,   136,     0,     0,     0,
-     137,   138,     0,     0,     0,     0,     0,   342,   343,   344,
-     345,     0,     0,     0,     0,     0,     0,   143,     0,     0,
-       0,   346,     0,     0,     0,   347,   348,     0,     0,     0,
+       0,   335,   336,     0,     0,     0,     0,     0,     0,     0,
+       0,   337,   338,   339,     0,     0,     0,     0,   341,     0,
+       0,     0,     0,     0,     0,     0,     0,   113,   114,     0,
+       0,     0,     0,     0,     0,   115,     0,     0,     0,   116,
+       0,     0,     0,     0,     0,   117,     0,     0,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,     0,   128,
+       0,     0,     0,     0,     0,   129,     0,     0,   130,     0,
+       0,     0,   131,     0,     0,   132,   133,     0,   134,     0,
+       0,   135,     0,   136,     0,     0,     0,   137,   138,     0,
+       0,     0,     0,     0,     0,   342,   343,   344,   345,     0,
+       0,     0,     0,     0,     0,   143,     0,     0,     0,   346,
+       0,     0,     0,   347,   348,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   144,
+       0,     0,     0,     0,   145,   146,   293,   294,   295,   296,
+     297,   298,   299,   300,   301,   302,   303,   304,     0,     0,
+     305,   306,     0,     0,    73,    74,   350,     0,    75,   307,
+     308,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      76,     0,     0,    77,     0,     0,   309,   310,   311,   312,
+     313,   314,   315,     0,    78,     0,     0,   267,   268,   269,
+       0,     0,     0,     0,   316,    79,     0,     0,   160,   162,
+     163,   164,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    80,     0,     0,    81,     0,     0,    82,     0,     0,
+       0,     0,     0,    83,     0,     0,     0,     0,    84,    85,
+      86,     0,     0,     0,     0,     0,     0,     0,     0,   318,
+       0,     0,    87,   319,     0,    88,     0,    89,    90,    91,
+       0,     0,     0,   320,    92,    93,     0,     0,     0,     0,
+       0,     0,     0,   321,   322,   323,   324,   325,     0,   326,
+     327,    94,    95,   328,   329,    96,   330,    97,    98,    99,
+     100,   101,   102,   103,     0,   104,   331,   105,   106,   107,
+     108,     0,   109,   332,   110,     0,     0,     0,     0,     0,
+     111,   705,     0,   112,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   144,     0,     0,     0,     0,   145,   146,     0,   293,
-       0,   294,   295,   296,   297,   298,   299,   300,   301,   302,
-     303,   304,     0,     0,   305,   306,     0,   350,    73,    74,
-       0,     0,    75,   307,   308,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    76,     0,     0,    77,     0,     0,
-     309,   310,   311,   312,   313,   314,   315,     0,    78,     0,
-       0,   267,   268,   269,     0,     0,     0,     0,   316,    79,
-       0,     0,   163,   165,   166,   167,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    80,     0,     0,    81,     0,
-       0,    82,     0,     0,     0,     0,     0,    83,     0,     0,
-       0,     0,    84,    85,    86,     0,     0,     0,     0,     0,
-       0,     0,     0,   318,     0,     0,    87,   319,     0,    88,
-       0,    89,    90,    91,     0,     0,     0,   320,    92,    93,
-       0,     0,     0,     0,     0,     0,     0,   321,   322,   323,
-     324,   325,     0,   326,   327,    94,    95,   328,   329,    96,
-     330,    97,    98,    99,   100,   101,   102,   103,     0,   104,
-     331,   105,   106,   107,   108,     0,   109,   332,   110,     0,
-       0,     0,     0,     0,   111,     0,   707,     0,   112,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   335,   336,     0,     0,     0,
-     337,   338,   339,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   341,     0,     0,     0,     0,     0,     0,     0,
-       0,   113,   114,     0,     0,     0,     0,     0,     0,   115,
-       0,     0,     0,   116,     0,     0,     0,     0,     0,   117,
-       0,     0,   118,   119,   120,   121,   122,   123,   124,   125,
-     126,   127,     0,   128,     0,     0,     0,     0,     0,   129,
-       0,     0,   130,     0,     0,     0,   131,     0,     0,   132,
-     133,     0,   134,     0,     0,   135,     0,   136,     0,     0,
-       0,   137,   138,     0,     0,     0,     0,     0,   342,   343,
-     344,   345,     0,     0,     0,     0,     0,     0,   143,     0,
-       0,     0,   346,     0,     0,     0,   347,   348,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   144,     0,     0,     0,     0,   145,   146,     0,
-     293,     0,   294,   295,   296,   297,   298,   299,   300,   301,
-     302,   303,   304,     0,     0,   305,   306,     0,   350,    73,
-      74,     0,     0,    75,   307,   308,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    76,     0,     0,    77,     0,
-       0,   309,   310,   311,   312,   313,   314,   315,     0,    78,
-       0,     0,   267,   268,   269,     0,     0,     0,     0,   316,
-      79,     0,     0,     0,   165,   166,   167,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    80,     0,     0,  1364,
-       0,     0,    82,     0,     0,     0,     0,     0,    83,     0,
-       0,     0,     0,    84,    85,    86,     0,     0,     0,     0,
-       0,     0,     0,     0,   318,     0,     0,    87,   319,     0,
-      88,     0,    89,    90,    91,     0,     0,     0,   320,    92,
-      93,     0,     0,     0,     0,     0,     0,     0,   321,   322,
-     323,   324,   325,     0,   326,   327,    94,    95,   328,   329,
-      96,   330,    97,    98,    99,   100,   101,   102,   103,     0,
-     104,   331,   105,   106,   107,   108,     0,   109,   332,   110,
-       0,     0,     0,     0,     0,   111,     0,   601,     0,   112,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   335,   336,     0,     0,
-       0,   337,   338,   339,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   341,     0,     0,     0,     0,     0,     0,
-       0,     0,   113,   114,     0,     0,     0,     0,     0,     0,
-     115,     0,     0,     0,   116,     0,     0,     0,     0,     0,
-     117,     0,     0,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,  1365,   128,     0,     0,     0,     0,     0,
-     129,     0,     0,   130,     0,     0,     0,   131,     0,     0,
-     132,   133,     0,   134,     0,     0,   135,     0,   136,     0,
-       0,     0,   137,   138,     0,     0,     0,     0,     0,   342,
-     343,   344,   345,     0,     0,     0,     0,     0,     0,   143,
-       0,     0,     0,   346,     0,     0,     0,   347,   348,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   144,     0,     0,     0,     0,   145,   146,
-       0,   293,     0,   294,   295,   296,   297,   298,   299,   300,
-     301,   302,   303,   304,     0,     0,   305,   306,     0,   350,
-      73,    74,     0,     0,    75,   307,   308,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    76,     0,     0,    77,
-       0,     0,   309,   310,   311,   312,   313,   314,   315,     0,
-      78,     0,     0,   267,   268,   269,     0,     0,     0,     0,
-     316,    79,     0,     0,     0,   165,   166,   167,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    80,     0,     0,
-      81,     0,     0,    82,     0,     0,     0,     0,     0,    83,
-       0,     0,     0,     0,    84,    85,    86,     0,     0,     0,
-       0,     0,     0,     0,     0,   318,     0,     0,    87,   319,
-       0,    88,     0,    89,    90,    91,     0,     0,     0,   320,
-      92,    93,     0,     0,     0,     0,     0,     0,     0,   321,
-     322,   323,   324,   325,     0,   326,   327,    94,    95,   328,
-     329,    96,   330,    97,    98,    99,   100,   101,   102,   103,
-       0,   104,   331,   105,   106,   107,   108,     0,   109,   332,
-     110,     0,     0,     0,     0,     0,   111,     0,   601,     0,
-     112,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   335,   336,     0,
-       0,     0,   337,   338,   339,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   341,     0,     0,     0,     0,     0,
-       0,     0,     0,   113,   114,     0,     0,     0,     0,     0,
-       0,   115,     0,     0,     0,   116,     0,     0,     0,     0,
-       0,   117,     0,     0,   118,   119,   120,   121,   122,   123,
-     124,   125,   126,   127,     0,   128,     0,     0,     0,     0,
-       0,   129,     0,     0,   130,     0,     0,     0,   131,     0,
-       0,   132,   133,     0,   134,     0,     0,   135,     0,   136,
-       0,     0,     0,   137,   138,     0,     0,     0,     0,     0,
-     342,   343,   344,   345,     0,     0,     0,     0,     0,     0,
-     143,     0,     0,     0,   346,  1637,     0,     0,   347,   348,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   144,     0,     0,     0,     0,   145,
-     146,     0,   293,     0,   294,   295,   296,   297,   298,   299,
+     335,   336,     0,     0,     0,     0,     0,     0,     0,     0,
+     337,   338,   339,     0,     0,     0,     0,   341,     0,     0,
+       0,     0,     0,     0,     0,     0,   113,   114,     0,     0,
+       0,     0,     0,     0,   115,     0,     0,     0,   116,     0,
+       0,     0,     0,     0,   117,     0,     0,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,     0,   128,     0,
+       0,     0,     0,     0,   129,     0,     0,   130,     0,     0,
+       0,   131,     0,     0,   132,   133,     0,   134,     0,     0,
+     135,     0,   136,     0,     0,     0,   137,   138,     0,     0,
+       0,     0,     0,     0,   342,   343,   344,   345,     0,     0,
+       0,     0,     0,     0,   143,     0,     0,     0,   346,     0,
+       0,     0,   347,   348,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   144,     0,
+       0,     0,     0,   145,   146,   293,   294,   295,   296,   297,
+     298,   299,   300,   301,   302,   303,   304,     0,     0,   305,
+     306,     0,     0,    73,    74,   350,     0,    75,   307,   308,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    76,
+       0,     0,    77,     0,     0,   309,   310,   311,   312,   313,
+     314,   315,     0,    78,     0,     0,   267,   268,   269,     0,
+       0,     0,     0,   316,    79,     0,     0,     0,   162,   163,
+     164,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      80,     0,     0,  1371,     0,     0,    82,     0,     0,     0,
+       0,     0,    83,     0,     0,     0,     0,    84,    85,    86,
+       0,     0,     0,     0,     0,     0,     0,     0,   318,     0,
+       0,    87,   319,     0,    88,     0,    89,    90,    91,     0,
+       0,     0,   320,    92,    93,     0,     0,     0,     0,     0,
+       0,     0,   321,   322,   323,   324,   325,     0,   326,   327,
+      94,    95,   328,   329,    96,   330,    97,    98,    99,   100,
+     101,   102,   103,     0,   104,   331,   105,   106,   107,   108,
+       0,   109,   332,   110,     0,     0,     0,     0,     0,   111,
+     601,     0,   112,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   335,
+     336,     0,     0,     0,     0,     0,     0,     0,     0,   337,
+     338,   339,     0,     0,     0,     0,   341,     0,     0,     0,
+       0,     0,     0,     0,     0,   113,   114,     0,     0,     0,
+       0,     0,     0,   115,     0,     0,     0,   116,     0,     0,
+       0,     0,     0,   117,     0,     0,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,  1372,   128,     0,     0,
+       0,     0,     0,   129,     0,     0,   130,     0,     0,     0,
+     131,     0,     0,   132,   133,     0,   134,     0,     0,   135,
+       0,   136,     0,     0,     0,   137,   138,     0,     0,     0,
+       0,     0,     0,   342,   343,   344,   345,     0,     0,     0,
+       0,     0,     0,   143,     0,     0,     0,   346,     0,     0,
+       0,   347,   348,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   144,     0,     0,
+       0,     0,   145,   146,   293,   294,   295,   296,   297,   298,
+     299,   300,   301,   302,   303,   304,     0,     0,   305,   306,
+       0,     0,    73,    74,   350,     0,    75,   307,   308,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    76,     0,
+       0,    77,     0,     0,   309,   310,   311,   312,   313,   314,
+     315,     0,    78,     0,     0,   267,   268,   269,     0,     0,
+       0,     0,   316,    79,     0,     0,     0,   162,   163,   164,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    80,
+       0,     0,    81,     0,     0,    82,     0,     0,     0,     0,
+       0,    83,     0,     0,     0,     0,    84,    85,    86,     0,
+       0,     0,     0,     0,     0,     0,     0,   318,     0,     0,
+      87,   319,     0,    88,     0,    89,    90,    91,     0,     0,
+       0,   320,    92,    93,     0,     0,     0,     0,     0,     0,
+       0,   321,   322,   323,   324,   325,     0,   326,   327,    94,
+      95,   328,   329,    96,   330,    97,    98,    99,   100,   101,
+     102,   103,     0,   104,   331,   105,   106,   107,   108,     0,
+     109,   332,   110,     0,     0,     0,     0,     0,   111,   601,
+       0,   112,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   335,   336,
+       0,     0,     0,     0,     0,     0,     0,     0,   337,   338,
+     339,     0,     0,     0,     0,   341,     0,     0,     0,     0,
+       0,     0,     0,     0,   113,   114,     0,     0,     0,     0,
+       0,     0,   115,     0,     0,     0,   116,     0,     0,     0,
+       0,     0,   117,     0,     0,   118,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,     0,   128,     0,     0,     0,
+       0,     0,   129,     0,     0,   130,     0,     0,     0,   131,
+       0,     0,   132,   133,     0,   134,     0,     0,   135,     0,
+     136,     0,     0,     0,   137,   138,     0,     0,     0,     0,
+       0,     0,   342,   343,   344,   345,     0,     0,     0,     0,
+       0,     0,   143,     0,     0,     0,   346,  1641,     0,     0,
+     347,   348,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   144,     0,     0,     0,
+       0,   145,   146,   293,   294,   295,   296,   297,   298,   299,
      300,   301,   302,   303,   304,     0,     0,   305,   306,     0,
-     350,    73,    74,     0,     0,    75,   307,   308,     0,     0,
+       0,    73,    74,   350,     0,    75,   307,   308,     0,     0,
        0,     0,     0,     0,     0,     0,     0,    76,     0,     0,
       77,     0,     0,   309,   310,   311,   312,   313,   314,   315,
        0,    78,     0,     0,   267,   268,   269,     0,     0,     0,
-       0,   316,    79,     0,     0,     0,   165,   166,   167,     0,
+       0,   316,    79,     0,     0,     0,   162,   163,   164,     0,
        0,     0,     0,     0,     0,     0,     0,     0,    80,     0,
        0,    81,     0,     0,    82,     0,     0,     0,     0,     0,
       83,     0,     0,     0,     0,    84,    85,    86,     0,     0,
        0,     0,     0,     0,     0,     0,   318,     0,     0,    87,
      319,     0,    88,     0,    89,    90,    91,     0,     0,     0,
      320,    92,    93,     0,     0,     0,     0,     0,     0,     0,
-     321,   322,   323,   324,   325,  1536,   326,   327,    94,    95,
+     321,   322,   323,   324,   325,  1542,   326,   327,    94,    95,
      328,   329,    96,   330,    97,    98,    99,   100,   101,   102,
      103,     0,   104,   331,   105,   106,   107,   108,     0,   109,
-     332,   110,     0,     0,     0,     0,     0,   111,     0,   601,
-       0,   112,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   335,   336,
-       0,     0,     0,   337,   338,   339,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   341,     0,     0,     0,     0,
-       0,     0,     0,     0,   113,   114,     0,     0,     0,     0,
-       0,     0,   115,     0,     0,     0,   116,     0,     0,     0,
-       0,     0,   117,     0,     0,   118,   119,   120,   121,   122,
-     123,   124,   125,   126,   127,     0,   128,     0,     0,     0,
-       0,     0,   129,     0,     0,   130,     0,     0,     0,   131,
-       0,     0,   132,   133,     0,   134,     0,     0,   135,     0,
-     136,     0,     0,     0,   137,   138,     0,     0,     0,     0,
+     332,   110,     0,     0,     0,     0,     0,   111,   601,     0,
+     112,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   335,   336,     0,
+       0,     0,     0,     0,     0,     0,     0,   337,   338,   339,
+       0,     0,     0,     0,   341,     0,     0,     0,     0,     0,
+       0,     0,     0,   113,   114,     0,     0,     0,     0,     0,
+       0,   115,     0,     0,     0,   116,     0,     0,     0,     0,
+       0,   117,     0,     0,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,     0,   128,     0,     0,     0,     0,
+       0,   129,     0,     0,   130,     0,     0,     0,   131,     0,
+       0,   132,   133,     0,   134,     0,     0,   135,     0,   136,
+       0,     0,     0,   137,   138,     0,     0,     0,     0,     0,
        0,   342,   343,   344,   345,     0,     0,     0,     0,     0,
        0,   143,     0,     0,     0,   346,     0,     0,     0,   347,
      348,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,   144,     0,     0,     0,     0,
-     145,   146,     0,   293,     0,   294,   295,   296,   297,   298,
-     299,   300,   301,   302,   303,   304,     0,     0,   305,   306,
-       0,   350,    73,    74,     0,     0,    75,   307,   308,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    76,     0,
-       0,    77,     0,     0,   309,   310,   311,   312,   313,   314,
-     315,     0,    78,     0,     0,   267,   268,   269,     0,     0,
-       0,     0,   316,    79,     0,     0,     0,   165,   166,   167,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    80,
-       0,     0,    81,     0,     0,    82,     0,     0,     0,     0,
-       0,    83,     0,     0,     0,     0,    84,    85,    86,     0,
-       0,     0,     0,     0,     0,     0,     0,   318,     0,     0,
-      87,   319,     0,    88,     0,    89,    90,    91,     0,     0,
-       0,   320,    92,    93,     0,     0,     0,     0,     0,     0,
-       0,   321,   322,   323,   324,   325,     0,   326,   327,    94,
-      95,   328,   329,    96,   330,    97,    98,    99,   100,   101,
-     102,   103,     0,   104,   331,   105,   106,   107,   108,     0,
-     109,   332,   110,     0,     0,     0,     0,     0,   111,     0,
-     601,     0,   112,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   335,
-     336,     0,     0,     0,   337,   338,   339,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   341,     0,     0,     0,
-       0,     0,     0,     0,     0,   113,   114,     0,     0,     0,
-       0,     0,     0,   115,     0,     0,     0,   116,     0,     0,
-       0,     0,     0,   117,     0,     0,   118,   119,   120,   121,
-     122,   123,   124,   125,   126,   127,     0,   128,     0,     0,
-       0,     0,     0,   129,     0,     0,   130,     0,     0,     0,
-     131,     0,     0,   132,   133,     0,   134,     0,     0,   135,
-       0,   136,     0,     0,     0,   137,   138,     0,     0,     0,
-       0,     0,   342,   343,   344,   345,     0,     0,     0,     0,
-       0,     0,   143,     0,     0,     0,   346,     0,     0,     0,
-     347,   348,    67,    68,    69,    70,    71,    72,     0,     0,
-       0,     0,     0,     0,     0,     0,   144,     0,     0,    73,
-      74,   145,   146,    75,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    76,     0,     0,    77,     0,
-       0,     0,   350,     0,     0,     0,     0,     0,     0,    78,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      79,     0,     0,     0,   165,   166,   167,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    80,     0,     0,    81,
-       0,     0,    82,     0,     0,     0,     0,     0,    83,     0,
-       0,     0,     0,    84,    85,    86,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    87,     0,     0,
-      88,     0,    89,    90,    91,   643,     0,     0,     0,    92,
-      93,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    94,    95,     0,     0,
-      96,     0,    97,    98,    99,   100,   101,   102,   103,     0,
-     104,     0,   105,   106,   107,   108,     0,   109,     0,   110,
-       0,     0,     0,     0,     0,   111,     0,   920,     0,   112,
-       0,     0,     0,   644,   645,   646,   647,   648,     0,     0,
-       0,   649,   650,   651,   652,   653,     0,   654,   655,   656,
-     657,   658,   659,   660,   661,   662,   663,   664,   665,     0,
+     145,   146,   293,   294,   295,   296,   297,   298,   299,   300,
+     301,   302,   303,   304,     0,     0,   305,   306,     0,     0,
+      73,    74,   350,     0,    75,   307,   308,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    76,     0,     0,    77,
+       0,     0,   309,   310,   311,   312,   313,   314,   315,     0,
+      78,     0,     0,   267,   268,   269,     0,     0,     0,     0,
+     316,    79,     0,     0,     0,   162,   163,   164,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    80,     0,     0,
+      81,     0,     0,    82,     0,     0,     0,     0,     0,    83,
+       0,     0,     0,     0,    84,    85,    86,     0,     0,     0,
+       0,     0,     0,     0,     0,   318,     0,     0,    87,   319,
+       0,    88,     0,    89,    90,    91,     0,     0,     0,   320,
+      92,    93,     0,     0,     0,     0,     0,     0,     0,   321,
+     322,   323,   324,   325,     0,   326,   327,    94,    95,   328,
+     329,    96,   330,    97,    98,    99,   100,   101,   102,   103,
+       0,   104,   331,   105,   106,   107,   108,     0,   109,   332,
+     110,     0,     0,     0,     0,     0,   111,   601,     0,   112,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   335,   336,     0,     0,
+       0,     0,     0,     0,     0,     0,   337,   338,   339,     0,
+       0,     0,     0,   341,     0,     0,     0,     0,     0,     0,
        0,     0,   113,   114,     0,     0,     0,     0,     0,     0,
      115,     0,     0,     0,   116,     0,     0,     0,     0,     0,
      117,     0,     0,   118,   119,   120,   121,   122,   123,   124,
      125,   126,   127,     0,   128,     0,     0,     0,     0,     0,
      129,     0,     0,   130,     0,     0,     0,   131,     0,     0,
      132,   133,     0,   134,     0,     0,   135,     0,   136,     0,
-       0,     0,   137,   138,     0,     0,     0,     0,     0,   139,
-     140,   141,   142,     0,     0,     0,     0,     0,     0,   143,
-       0,    67,    68,    69,    70,    71,    72,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    73,    74,
-       0,     0,    75,   144,     0,     0,     0,     0,   145,   146,
-       0,  1579,     0,     0,    76,     0,     0,    77,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   921,    78,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    79,
-       3,     4,  1461,     6,     0,     0,     0,     0,     0,     0,
-       0,     0,     7,     8,     9,  1462,     0,     0,    81,     0,
-       0,  1463,     0,     0,     0,     0,     0,    83,     0,     0,
-       0,     0,    84,    85,    86,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    87,     0,     0,    88,
-       0,    89,    90,    91,     0,   643,     0,     0,    92,    93,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    94,    95,     0,     0,    96,
-       0,    97,    98,    99,   100,   101,   102,   103,     0,   104,
-       0,   105,   106,   107,   108,     0,   109,     0,   110,     0,
-       0,     0,     0,     0,   111,     0,     0,     0,   112,     0,
-       0,     0,     0,   644,   645,   646,   647,   648,     0,     0,
-       0,   649,   650,   651,   652,   653,     0,   654,   655,   656,
+       0,     0,   137,   138,    67,    68,    69,    70,    71,    72,
+     342,   343,   344,   345,     0,     0,     0,     0,     0,     0,
+     143,    73,    74,     0,   346,    75,     0,     0,   347,   348,
+       0,     0,     0,     0,     0,     0,     0,    76,     0,     0,
+      77,     0,     0,     0,   144,     0,     0,     0,     0,   145,
+     146,    78,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    79,     0,     0,   160,   162,   163,   164,     0,
+       0,   350,     0,     0,     0,     0,     0,     0,    80,     0,
+       0,    81,     0,     0,    82,     0,     0,     0,     0,     0,
+      83,     0,     0,     0,     0,    84,    85,    86,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    87,
+       0,     0,    88,     0,    89,    90,    91,     0,     0,     0,
+       0,    92,    93,     0,     0,     0,     0,     0,   643,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    94,    95,
+       0,     0,    96,     0,    97,    98,    99,   100,   101,   102,
+     103,     0,   104,     0,   105,   106,   107,   108,     0,   109,
+       0,   110,     0,     3,     4,     5,     6,   111,  1208,     0,
+     112,     0,     0,     0,     0,     7,     8,     9,    10,     0,
+       0,     0,     0,     0,    11,   644,   645,   646,   647,   648,
+     649,   650,   651,   652,   653,     0,     0,     0,     0,   654,
+     655,   656,   657,   658,   659,   660,   661,   662,   663,   664,
+     665,     0,     0,   113,   114,     0,     0,     0,     0,     0,
+       0,   115,     0,     0,     0,   116,     0,     0,     0,     0,
+       0,   117,     0,     0,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,     0,   128,     0,     0,     0,     0,
+       0,   129,     0,     0,   130,   666,     0,     0,   131,     0,
+       0,   132,   133,     0,   134,     0,     0,   135,    13,   136,
+       0,     0,     0,   137,   138,     0,     0,   592,     0,     0,
+      30,   139,   140,   141,   142,     0,     0,     0,     0,     0,
+       0,   143,    67,    68,    69,    70,    71,    72,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    73,
+      74,     0,     0,    75,     0,   144,     0,     0,     0,     0,
+     145,   146,     0,     0,    14,    76,     0,     0,    77,     0,
+       0,     0,    15,    16,     0,    17,     0,     0,     0,    78,
+     922,     0,     0,     0,     0,     0,    25,     0,     0,     0,
+      79,     0,    26,    27,   162,   163,   164,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    80,     0,    28,    81,
+       0,    29,    82,     0,     0,     0,     0,     0,    83,     0,
+      30,     0,     0,    84,    85,    86,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    87,     0,     0,
+      88,     0,    89,    90,    91,     0,   643,     0,    31,    92,
+      93,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    94,    95,     0,     0,
+      96,     0,    97,    98,    99,   100,   101,   102,   103,     0,
+     104,     0,   105,   106,   107,   108,     0,   109,     0,   110,
+       0,     0,     0,     0,     0,   111,   921,     0,   112,     0,
+       0,     0,     0,   644,   645,   646,   647,   648,   649,   650,
+     651,   652,   653,     0,     0,     0,     0,   654,   655,   656,
      657,   658,   659,   660,   661,   662,   663,   664,   665,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,   113,   114,     0,     0,     0,     0,     0,     0,   115,
-       0,     0,    15,   116,     0,     0,     0,     0,     0,   117,
-      16,  1465,   118,   119,   120,   121,   122,   123,   124,   125,
-     126,   127,     0,   128,    26,     0,     0,     0,     0,   129,
-      27,    28,   130,     0,     0,     0,   131,     0,     0,   132,
-     133,     0,   134,     0,     0,   135,    29,   136,  1466,    30,
-       0,   137,   138,     0,     0,     0,     0,     0,   139,   140,
-     141,   142,  1402,     0,     0,     0,     0,     0,   143,     0,
-       0,     0,  1467,     0,     0,  1910,     0,     0,  1468,  1911,
-    -336,     0,     0,     0,     0,    31,    67,    68,    69,    70,
-      71,    72,   144,     0,     0,     0,     0,   145,   146,     0,
-       0,     0,     0,    73,    74,     0,     0,    75,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    76,
-       0,     0,    77,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    78,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    79,     3,     4,  1461,     6,     0,
-       0,     0,     0,     0,     0,     0,     0,     7,     8,     9,
-    1462,     0,     0,    81,     0,     0,  1463,     0,     0,     0,
-       0,     0,    83,     0,     0,     0,     0,    84,    85,    86,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    87,     0,     0,    88,     0,    89,    90,    91,     0,
-     643,     0,     0,    92,    93,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      94,    95,     0,     0,    96,     0,    97,    98,    99,   100,
-     101,   102,   103,     0,   104,     0,   105,   106,   107,   108,
-       0,   109,     0,   110,     0,     0,     0,     0,     0,   111,
-       0,     0,     0,   112,     0,     0,     0,     0,   644,   645,
-     646,   647,   648,     0,     0,     0,   649,   650,   651,   652,
-     653,     0,   654,   655,   656,   657,   658,   659,   660,   661,
-     662,   663,   664,   665,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   113,   114,     0,     0,
-       0,     0,     0,     0,   115,     0,     0,    15,   116,     0,
-       0,     0,     0,  1464,   117,    16,  1465,   118,   119,   120,
-     121,   122,   123,   124,   125,   126,   127,     0,   128,    26,
-       0,     0,     0,     0,   129,    27,    28,   130,     0,     0,
-       0,   131,     0,     0,   132,   133,     0,   134,     0,     0,
-     135,    29,   136,  1466,    30,     0,   137,   138,     0,     0,
-       0,     0,     0,   139,   140,   141,   142,  1908,     0,     0,
-       0,     0,     0,   143,     0,     0,     0,  1467,     0,     0,
-       0,     0,     0,  1468,     0,     0,     0,     0,  1469,     0,
-      31,    67,    68,    69,    70,    71,    72,   144,     0,     0,
-       0,     0,   145,   146,     0,     0,     0,     0,    73,    74,
-       0,     0,    75,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    76,     0,     0,    77,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    78,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    79,
-       3,     4,  1461,     6,     0,     0,     0,     0,     0,     0,
-       0,     0,     7,     8,     9,  1462,     0,     0,    81,     0,
-       0,  1463,     0,     0,     0,     0,     0,    83,     0,     0,
-       0,     0,    84,    85,    86,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    87,     0,     0,    88,
-       0,    89,    90,    91,     0,     0,   643,     0,    92,    93,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    94,    95,     0,     0,    96,
-       0,    97,    98,    99,   100,   101,   102,   103,     0,   104,
-       0,   105,   106,   107,   108,     0,   109,     0,   110,     0,
-       0,     0,     0,     0,   111,     0,     0,     0,   112,     0,
-       0,     0,     0,     0,   644,   645,   646,   647,   648,     0,
-       0,     0,   649,   650,   651,   652,   653,     0,   654,   655,
+       0,     0,     0,   116,     0,     0,     0,     0,     0,   117,
+       0,     0,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,     0,   128,     0,     0,     0,     0,     0,   129,
+       0,     0,   130,     0,     0,     0,   131,     0,     0,   132,
+     133,     0,   134,     0,     0,   135,     0,   136,     0,     0,
+       0,   137,   138,    67,    68,    69,    70,    71,    72,   139,
+     140,   141,   142,  1409,     0,     0,     0,     0,     0,   143,
+      73,    74,     0,     0,    75,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    76,     0,     0,    77,
+       0,     0,     0,   144,     0,     0,     0,     0,   145,   146,
+      78,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    79,     3,     4,  1467,     6,     0,     0,   922,     0,
+       0,     0,     0,     0,     7,     8,     9,  1468,     0,     0,
+      81,     0,     0,  1469,     0,     0,     0,     0,     0,    83,
+       0,     0,     0,     0,    84,    85,    86,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    87,     0,
+       0,    88,     0,    89,    90,    91,     0,   643,     0,     0,
+      92,    93,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    94,    95,     0,
+       0,    96,     0,    97,    98,    99,   100,   101,   102,   103,
+       0,   104,     0,   105,   106,   107,   108,     0,   109,     0,
+     110,     0,     0,     0,     0,     0,   111,     0,     0,   112,
+       0,     0,     0,     0,   644,   645,   646,   647,   648,   649,
+     650,   651,   652,   653,     0,     0,     0,     0,   654,   655,
      656,   657,   658,   659,   660,   661,   662,   663,   664,   665,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   113,   114,     0,     0,     0,     0,     0,     0,   115,
-       0,     0,    15,   116,     0,     0,     0,     0,  1762,   117,
-      16,  1465,  1763,   119,   120,   121,   122,   123,   124,   125,
-     126,   127,     0,   128,    26,     0,     0,     0,     0,   129,
-      27,    28,   130,     0,     0,     0,   131,     0,     0,   132,
-     133,     0,   134,     0,     0,   135,    29,   136,  1466,    30,
-       0,   137,   138,     0,     0,     0,     0,     0,   139,   140,
-     141,   142,   909,     0,     0,     0,     0,     0,   143,     0,
-       0,     0,  1467,     0,     0,     0,     0,     0,  1468,     0,
-       0,     0,     0,  1469,     0,    31,    67,    68,    69,    70,
-      71,    72,   144,     0,     0,     0,     0,   145,   146,     0,
-       0,     0,     0,    73,    74,     0,     0,    75,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    76,
-       0,     0,    77,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    78,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    79,     3,     4,  1461,     6,     0,
-       0,     0,     0,     0,     0,     0,     0,     7,     8,     9,
-    1462,     0,     0,    81,     0,     0,  1463,     0,     0,     0,
-       0,     0,    83,     0,     0,     0,     0,    84,    85,    86,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    87,     0,     0,    88,     0,    89,    90,    91,     0,
-       0,   643,     0,    92,    93,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      94,    95,     0,     0,    96,     0,    97,    98,    99,   100,
-     101,   102,   103,     0,   104,     0,   105,   106,   107,   108,
-       0,   109,     0,   110,     0,     0,     0,     0,     0,   111,
-       0,     0,     0,   112,     0,     0,     0,     0,     0,   644,
-     645,   646,   647,   648,     0,     0,     0,   649,   650,   651,
-     652,   653,     0,   654,   655,   656,   657,   658,   659,   660,
-     661,   662,   663,   664,   665,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   113,   114,     0,     0,
-       0,     0,     0,     0,   115,     0,     0,    15,   116,     0,
-       0,     0,     0,     0,   117,    16,  1465,   118,   119,   120,
-     121,   122,   123,   124,   125,   126,   127,     0,   128,    26,
-       0,     0,     0,     0,   129,    27,    28,   130,     0,     0,
-       0,   131,     0,     0,   132,   133,     0,   134,     0,     0,
-     135,    29,   136,  1466,    30,     0,   137,   138,     0,     0,
-       0,     0,     0,   139,   140,   141,   142,  1754,     0,     0,
-       0,     0,     0,   143,     0,     0,     0,  1467,     0,     0,
-       0,     0,     0,  1468,     0,  -336,     0,     0,     0,     0,
-      31,    67,    68,    69,    70,    71,    72,   144,     0,     0,
-       0,     0,   145,   146,     0,     0,     0,     0,    73,    74,
-       0,     0,    75,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    76,     0,     0,    77,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    78,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    79,
-       3,     4,  1461,     6,     0,     0,     0,     0,     0,     0,
-       0,     0,     7,     8,     9,  1462,     0,     0,    81,     0,
-       0,  1463,     0,     0,     0,     0,     0,    83,     0,     0,
-       0,     0,    84,    85,    86,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    87,     0,     0,    88,
-       0,    89,    90,    91,   643,     0,     0,     0,    92,    93,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    94,    95,     0,     0,    96,
-       0,    97,    98,    99,   100,   101,   102,   103,     0,   104,
-       0,   105,   106,   107,   108,     0,   109,     0,   110,     0,
-       0,     0,     0,     0,   111,     0,     0,     0,   112,     0,
-       0,     0,   644,   645,   646,   647,   648,     0,     0,     0,
-     649,   650,   651,   652,   653,     0,   654,   655,   656,   657,
-     658,   659,   660,   661,   662,   663,   664,   665,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   113,   114,     0,     0,     0,     0,     0,     0,   115,
-       0,     0,    15,   116,     0,     0,     0,     0,     0,   117,
-      16,  1465,   118,   119,   120,   121,   122,   123,   124,   125,
-     126,   127,   666,   128,    26,     0,     0,     0,     0,   129,
-      27,    28,   130,     0,     0,     0,   131,     0,     0,   132,
-     133,     0,   134,     0,     0,   135,    29,   136,  1466,    30,
-       0,   137,   138,     0,     0,     0,     0,     0,   139,   140,
-     141,   142,     0,     0,     0,     0,     0,     0,   143,     0,
-       0,     0,  1467,     0,     0,     0,     0,     0,  1468,     0,
-       0,     0,     0,     0,  1981,    31,    67,    68,    69,    70,
-      71,    72,   144,     0,     0,     0,     0,   145,   146,     0,
-       0,     0,     0,    73,    74,     0,     0,    75,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    76,
-       0,     0,    77,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    78,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    79,     3,     4,  1461,     6,     0,
-       0,     0,     0,     0,     0,     0,     0,     7,     8,     9,
-    1462,     0,     0,    81,     0,     0,  1463,     0,     0,     0,
-       0,     0,    83,  1228,     0,     0,     0,    84,    85,    86,
+       0,     0,   113,   114,     0,     0,     0,     0,     0,     0,
+     115,     0,     0,    14,   116,     0,     0,     0,     0,     0,
+     117,    15,  1471,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,     0,   128,    25,     0,     0,     0,     0,
+     129,    26,    27,   130,     0,     0,     0,   131,     0,     0,
+     132,   133,     0,   134,     0,     0,   135,    28,   136,  1472,
+      29,     0,   137,   138,     0,     0,     0,     0,     0,     0,
+     139,   140,   141,   142,  1910,     0,     0,     0,     0,     0,
+     143,     0,     0,     0,  1473,     0,     0,  1912,     0,     0,
+    1474,  1913,  -336,     0,     0,     0,     0,    31,    67,    68,
+      69,    70,    71,    72,   144,     0,     0,     0,     0,   145,
+     146,     0,     0,     0,     0,    73,    74,     0,     0,    75,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    87,     0,     0,    88,     0,    89,    90,    91,     0,
-     643,     0,     0,    92,    93,     0,     0,     0,     0,     0,
+       0,    76,     0,     0,    77,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    78,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    79,     3,     4,  1467,
+       6,     0,     0,     0,     0,     0,     0,     0,     0,     7,
+       8,     9,  1468,     0,     0,    81,     0,     0,  1469,     0,
+       0,     0,     0,     0,    83,     0,     0,     0,     0,    84,
+      85,    86,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    87,     0,     0,    88,     0,    89,    90,
+      91,     0,     0,   643,     0,    92,    93,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      94,    95,     0,     0,    96,     0,    97,    98,    99,   100,
-     101,   102,   103,     0,   104,     0,   105,   106,   107,   108,
-       0,   109,     0,   110,     0,     0,     0,     0,     0,   111,
-       0,     0,     0,   112,     0,     0,     0,     0,   644,   645,
-     646,   647,   648,     0,     0,     0,   649,   650,   651,   652,
-     653,     0,   654,   655,   656,   657,   658,   659,   660,   661,
-     662,   663,   664,   665,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   113,   114,     0,     0,
-       0,     0,     0,     0,   115,     0,     0,    15,   116,     0,
-       0,     0,     0,     0,   117,    16,  1465,   118,   119,   120,
-     121,   122,   123,   124,   125,   126,   127,     0,   128,    26,
-       0,     0,     0,     0,   129,    27,    28,   130,     0,     0,
-       0,   131,     0,     0,   132,   133,     0,   134,     0,     0,
-     135,    29,   136,  1466,    30,     0,   137,   138,     0,     0,
-       0,     0,     0,   139,   140,   141,   142,     0,     0,     0,
-       0,     0,     0,   143,     0,     0,     0,  1467,     0,     0,
-       0,     0,     0,  1468,     0,     0,     0,     0,     0,     0,
-      31,    67,    68,    69,    70,    71,    72,   144,     0,     0,
-       0,     0,   145,   146,     0,     0,     0,     0,    73,    74,
-       0,     0,    75,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    76,     0,     0,    77,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    78,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    79,
-       3,     4,  1461,     6,     0,     0,     0,     0,     0,     0,
-       0,     0,     7,     8,     9,  1462,     0,     0,    81,     0,
-       0,  1463,     0,     0,     0,     0,     0,    83,     0,     0,
-       0,     0,    84,    85,    86,  1581,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    87,     0,     0,    88,
-       0,    89,    90,    91,     0,     0,     0,   643,    92,    93,
+       0,     0,    94,    95,     0,     0,    96,     0,    97,    98,
+      99,   100,   101,   102,   103,     0,   104,     0,   105,   106,
+     107,   108,     0,   109,     0,   110,     0,     0,     0,     0,
+       0,   111,     0,     0,   112,     0,     0,     0,     0,     0,
+     644,   645,   646,   647,   648,   649,   650,   651,   652,   653,
+       0,     0,     0,     0,   654,   655,   656,   657,   658,   659,
+     660,   661,   662,   663,   664,   665,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   113,   114,     0,
+       0,     0,     0,     0,     0,   115,     0,     0,    14,   116,
+       0,     0,     0,     0,  1470,   117,    15,  1471,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,     0,   128,
+      25,     0,     0,     0,     0,   129,    26,    27,   130,     0,
+       0,     0,   131,     0,     0,   132,   133,     0,   134,     0,
+       0,   135,    28,   136,  1472,    29,     0,   137,   138,     0,
+       0,     0,     0,     0,     0,   139,   140,   141,   142,   910,
+       0,     0,     0,     0,     0,   143,     0,     0,     0,  1473,
+       0,     0,     0,     0,     0,  1474,     0,     0,     0,     0,
+    1475,     0,    31,    67,    68,    69,    70,    71,    72,   144,
+       0,     0,     0,     0,   145,   146,     0,     0,     0,     0,
+      73,    74,     0,     0,    75,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    76,     0,     0,    77,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    94,    95,     0,     0,    96,
-       0,    97,    98,    99,   100,   101,   102,   103,     0,   104,
-       0,   105,   106,   107,   108,     0,   109,  1582,   110,     0,
-       0,     0,     0,     0,   111,     0,     0,     0,   112,     0,
+      78,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    79,     3,     4,  1467,     6,     0,     0,     0,     0,
+       0,     0,     0,     0,     7,     8,     9,  1468,     0,     0,
+      81,     0,     0,  1469,     0,     0,     0,     0,     0,    83,
+       0,     0,     0,     0,    84,    85,    86,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    87,     0,
+       0,    88,     0,    89,    90,    91,     0,     0,   643,     0,
+      92,    93,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    94,    95,     0,
+       0,    96,     0,    97,    98,    99,   100,   101,   102,   103,
+       0,   104,     0,   105,   106,   107,   108,     0,   109,     0,
+     110,     0,     0,     0,     0,     0,   111,     0,     0,   112,
        0,     0,     0,     0,     0,   644,   645,   646,   647,   648,
-       0,     0,     0,   649,   650,   651,   652,   653,     0,   654,
+     649,   650,   651,   652,   653,     0,     0,     0,     0,   654,
      655,   656,   657,   658,   659,   660,   661,   662,   663,   664,
      665,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   113,   114,     0,     0,     0,     0,     0,     0,   115,
-       0,     0,     0,   116,     0,     0,     0,     0,     0,   117,
-      16,  1465,   118,   119,   120,   121,   122,   123,   124,   125,
-     126,   127,     0,   128,     0,     0,     0,     0,     0,   129,
-      27,    28,   130,     0,     0,     0,   131,     0,     0,   132,
-     133,     0,   134,     0,     0,   135,    29,   136,  1466,     0,
-       0,   137,   138,     0,     0,     0,     0,     0,   139,   140,
-     141,   142,     0,     0,     0,     0,     0,     0,   143,     0,
-       0,     0,  1467,     0,     0,     0,     0,     0,  1468,     0,
-       0,     0,     0,  1938,     0,    31,    67,    68,    69,    70,
-      71,    72,   144,     0,     0,     0,     0,   145,   146,     0,
-       0,     0,     0,    73,    74,     0,     0,    75,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    76,
-       0,     0,    77,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    78,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    79,     3,     4,  1461,     6,     0,
-       0,     0,     0,     0,     0,     0,     0,     7,     8,     9,
-    1462,     0,     0,    81,     0,     0,  1463,     0,     0,     0,
-       0,     0,    83,     0,     0,     0,     0,    84,    85,    86,
+       0,     0,   113,   114,     0,     0,     0,     0,     0,     0,
+     115,     0,     0,    14,   116,     0,     0,     0,     0,  1764,
+     117,    15,  1471,  1765,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,     0,   128,    25,     0,     0,     0,     0,
+     129,    26,    27,   130,     0,     0,     0,   131,     0,     0,
+     132,   133,     0,   134,     0,     0,   135,    28,   136,  1472,
+      29,     0,   137,   138,     0,     0,     0,     0,     0,     0,
+     139,   140,   141,   142,  1756,     0,     0,     0,     0,     0,
+     143,     0,     0,     0,  1473,     0,     0,     0,     0,     0,
+    1474,     0,     0,     0,     0,  1475,     0,    31,    67,    68,
+      69,    70,    71,    72,   144,     0,     0,     0,     0,   145,
+     146,     0,     0,     0,     0,    73,    74,     0,     0,    75,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    87,     0,     0,    88,     0,    89,    90,    91,   643,
-       0,     0,     0,    92,    93,     0,     0,     0,     0,     0,
+       0,    76,     0,     0,    77,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    78,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    79,     3,     4,  1467,
+       6,     0,     0,     0,     0,     0,     0,     0,     0,     7,
+       8,     9,  1468,     0,     0,    81,     0,     0,  1469,     0,
+       0,     0,     0,     0,    83,  1237,     0,     0,     0,    84,
+      85,    86,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    87,     0,     0,    88,     0,    89,    90,
+      91,     0,   643,     0,     0,    92,    93,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      94,    95,     0,     0,    96,     0,    97,    98,    99,   100,
-     101,   102,   103,     0,   104,     0,   105,   106,   107,   108,
-       0,   109,     0,   110,     0,     0,     0,     0,     0,   111,
-       0,     0,     0,   112,     0,     0,     0,   644,   645,   646,
-     647,   648,     0,     0,     0,   649,   650,   651,   652,   653,
-       0,   654,   655,   656,   657,   658,   659,   660,   661,   662,
-     663,   664,   665,     0,     0,     0,     0,     0,     0,  1134,
-    1135,     0,     0,     0,     0,     0,   113,   114,     0,     0,
-       0,     0,     0,     0,   115,     0,     0,     0,   116,     0,
-       0,     0,     0,     0,   117,    16,  1465,   118,   119,   120,
-     121,   122,   123,   124,   125,   126,   127,     0,   128,     0,
-       0,     0,     0,     0,   129,    27,    28,   130,     0,     0,
-       0,   131,     0,     0,   132,   133,     0,   134,     0,     0,
-     135,    29,   136,  1466,     0,     0,   137,   138,     0,     0,
-       0,     0,     0,   139,   140,   141,   142,     0,     0,     0,
-       0,     0,     0,   143,     0,     0,     0,  1467,     0,     0,
-       0,     0,     0,  1468,     0,     0,     0,     0,     0,  2030,
-      31,     0,     0,     0,     0,     0,     0,   144,     0,     0,
-       0,     0,   145,   146,    67,    68,    69,    70,    71,    72,
-       0,     0,     0,     0,     0,     0,   226,     0,     0,     0,
-       0,    73,    74,     0,     0,    75,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    76,     0,     0,
-      77,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    78,     0,     0,     0,     0,     0,   228,     0,     0,
-       0,     0,    79,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    80,     0,
-       0,    81,     0,     0,    82,     0,     0,     0,     0,     0,
-      83,     0,     0,     0,     0,    84,    85,    86,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    87,
-       0,     0,    88,     0,    89,    90,    91,     0,   643,     0,
-       0,    92,    93,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    94,    95,
-       0,     0,    96,     0,    97,    98,    99,   100,   101,   102,
-     103,     0,   104,     0,   105,   106,   107,   108,     0,   109,
-       0,   110,     0,     0,     0,     0,     0,   111,  1183,     0,
-       0,   112,     0,     0,     0,     0,   644,   645,   646,   647,
-     648,     0,     0,     0,   649,   650,   651,   652,   653,     0,
-     654,   655,   656,   657,   658,   659,   660,   661,   662,   663,
-     664,   665,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   276,   277,   233,   234,   235,   236,
-       0,     0,   115,     0,     0,     0,   116,     0,     0,     0,
-       0,     0,   117,     0,     0,   118,   119,   120,   121,   122,
-     123,   124,   125,   126,   127,     0,   128,     0,     0,     0,
-       0,     0,   129,     0,     0,   130,     0,     0,     0,   131,
-       0,     0,   132,   133,     0,   134,     0,     0,   135,     0,
-     136,     0,     0,     0,   278,   138,     0,     0,     0,     0,
-       0,   139,   140,   141,   142,     0,     0,     0,     0,     0,
-       0,   143,    67,    68,    69,   992,   993,   994,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    73,
-      74,     0,     0,    75,     0,   144,     0,     0,     0,     0,
-     145,   146,     0,     0,     0,    76,     0,     0,    77,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    78,
+       0,     0,    94,    95,     0,     0,    96,     0,    97,    98,
+      99,   100,   101,   102,   103,     0,   104,     0,   105,   106,
+     107,   108,     0,   109,     0,   110,     0,     0,     0,     0,
+       0,   111,     0,     0,   112,     0,     0,     0,     0,   644,
+     645,   646,   647,   648,   649,   650,   651,   652,   653,     0,
+       0,     0,     0,   654,   655,   656,   657,   658,   659,   660,
+     661,   662,   663,   664,   665,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   113,   114,     0,
+       0,     0,     0,     0,     0,   115,     0,     0,    14,   116,
+       0,     0,     0,     0,     0,   117,    15,  1471,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,     0,   128,
+      25,     0,     0,     0,     0,   129,    26,    27,   130,     0,
+       0,     0,   131,     0,     0,   132,   133,     0,   134,     0,
+       0,   135,    28,   136,  1472,    29,     0,   137,   138,     0,
+       0,     0,     0,     0,     0,   139,   140,   141,   142,     0,
+       0,     0,     0,     0,     0,   143,     0,     0,     0,  1473,
+       0,     0,     0,     0,     0,  1474,     0,  -336,     0,     0,
+       0,     0,    31,    67,    68,    69,    70,    71,    72,   144,
+       0,     0,     0,     0,   145,   146,     0,     0,     0,     0,
+      73,    74,     0,     0,    75,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    76,     0,     0,    77,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      78,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    79,     3,     4,  1467,     6,     0,     0,     0,     0,
+       0,     0,     0,     0,     7,     8,     9,  1468,     0,     0,
+      81,     0,     0,  1469,     0,     0,     0,     0,     0,    83,
+       0,     0,     0,     0,    84,    85,    86,     0,     0,     0,
+    1585,     0,     0,     0,     0,     0,     0,     0,    87,     0,
+       0,    88,     0,    89,    90,    91,     0,     0,     0,     0,
+      92,    93,   643,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    94,    95,     0,
+       0,    96,     0,    97,    98,    99,   100,   101,   102,   103,
+       0,   104,     0,   105,   106,   107,   108,     0,   109,     0,
+     110,  1586,     0,     0,     0,     0,   111,     0,     0,   112,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   644,
+     645,   646,   647,   648,   649,   650,   651,   652,   653,     0,
+       0,     0,     0,   654,   655,   656,   657,   658,   659,   660,
+     661,   662,   663,   664,   665,     0,     0,     0,     0,     0,
+       0,     0,   113,   114,     0,     0,     0,     0,     0,     0,
+     115,     0,     0,    14,   116,     0,     0,     0,     0,     0,
+     117,    15,  1471,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,     0,   128,    25,     0,     0,     0,     0,
+     129,    26,    27,   130,     0,     0,     0,   131,     0,     0,
+     132,   133,     0,   134,     0,     0,   135,    28,   136,  1472,
+      29,     0,   137,   138,     0,     0,     0,     0,     0,     0,
+     139,   140,   141,   142,     0,     0,     0,     0,     0,     0,
+     143,     0,     0,     0,  1473,     0,     0,     0,     0,     0,
+    1474,     0,     0,     0,     0,     0,  1983,    31,    67,    68,
+      69,    70,    71,    72,   144,     0,     0,     0,     0,   145,
+     146,     0,     0,     0,     0,    73,    74,     0,     0,    75,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    76,     0,     0,    77,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    78,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    79,     3,     4,  1467,
+       6,     0,     0,     0,     0,     0,     0,     0,     0,     7,
+       8,     9,  1468,     0,     0,    81,     0,     0,  1469,     0,
+       0,     0,     0,     0,    83,     0,     0,     0,     0,    84,
+      85,    86,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    87,     0,     0,    88,     0,    89,    90,
+      91,   643,     0,     0,     0,    92,    93,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    94,    95,     0,     0,    96,     0,    97,    98,
+      99,   100,   101,   102,   103,     0,   104,     0,   105,   106,
+     107,   108,     0,   109,     0,   110,     0,     0,     0,     0,
+       0,   111,     0,     0,   112,     0,     0,     0,   644,   645,
+     646,   647,   648,   649,   650,   651,   652,   653,     0,     0,
+       0,     0,   654,   655,   656,   657,   658,   659,   660,   661,
+     662,   663,   664,   665,     0,     0,     0,     0,     0,     0,
+    1139,  1140,     0,     0,     0,     0,     0,   113,   114,     0,
+       0,     0,     0,     0,     0,   115,     0,     0,    14,   116,
+       0,     0,     0,     0,     0,   117,    15,  1471,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,     0,   128,
+      25,     0,     0,     0,     0,   129,    26,    27,   130,     0,
+       0,     0,   131,     0,     0,   132,   133,     0,   134,     0,
+       0,   135,    28,   136,  1472,    29,     0,   137,   138,     0,
+       0,     0,     0,     0,     0,   139,   140,   141,   142,     0,
+       0,     0,     0,     0,     0,   143,     0,     0,     0,  1473,
+       0,     0,     0,     0,     0,  1474,     0,     0,     0,     0,
+       0,     0,    31,    67,    68,    69,    70,    71,    72,   144,
+       0,     0,     0,     0,   145,   146,     0,     0,     0,     0,
+      73,    74,     0,     0,    75,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    76,     0,     0,    77,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      78,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    79,     3,     4,  1467,     6,     0,     0,     0,     0,
+       0,     0,     0,     0,     7,     8,     9,  1468,     0,     0,
+      81,     0,     0,  1469,     0,     0,     0,     0,     0,    83,
+       0,     0,     0,     0,    84,    85,    86,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    87,     0,
+       0,    88,     0,    89,    90,    91,   643,     0,     0,     0,
+      92,    93,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    94,    95,     0,
+       0,    96,     0,    97,    98,    99,   100,   101,   102,   103,
+       0,   104,     0,   105,   106,   107,   108,     0,   109,     0,
+     110,     0,     0,     0,  1189,     0,   111,     0,     0,   112,
+       0,     0,     0,   644,   645,   646,   647,   648,   649,   650,
+     651,   652,   653,     0,     0,     0,     0,   654,   655,   656,
+     657,   658,   659,   660,   661,   662,   663,   664,   665,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      79,     0,     0,     0,   165,   166,   167,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    80,     0,     0,    81,
-       0,     0,    82,     0,     0,     0,     0,     0,    83,     0,
-       0,     0,     0,    84,    85,    86,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    87,     0,     0,
-      88,     0,    89,    90,    91,     0,   643,     0,     0,    92,
-      93,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    94,    95,     0,     0,
-      96,     0,    97,    98,    99,   100,   101,   102,   103,     0,
-     104,     0,   105,   106,   107,   108,  1535,   109,     0,   110,
-       0,     0,     0,     0,     0,   111,     0,     0,     0,   112,
-       0,     0,     0,     0,   644,   645,   646,   647,   648,     0,
-       0,     0,   649,   650,   651,   652,   653,     0,   654,   655,
-     656,   657,   658,   659,   660,   661,   662,   663,   664,   665,
-     995,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,   113,   114,     0,     0,     0,     0,     0,     0,
      115,     0,     0,     0,   116,     0,     0,     0,     0,     0,
-     117,     0,     0,   118,   119,   120,   121,   122,   123,   124,
+     117,    15,  1471,   118,   119,   120,   121,   122,   123,   124,
      125,   126,   127,     0,   128,     0,     0,     0,     0,     0,
-     129,     0,     0,   130,     0,     0,     0,   131,     0,     0,
-     132,   133,     0,   134,     0,     0,   135,     0,   136,     0,
-       0,     0,   137,   138,     0,     0,     0,     0,     0,   139,
-     140,   141,   142,     0,     0,     0,     0,     0,     0,   143,
-      67,    68,    69,   992,   993,   994,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    73,    74,     0,
-       0,    75,     0,   144,     0,     0,     0,     0,   145,   146,
-       0,     0,     0,    76,     0,     0,    77,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    78,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    79,     0,
-       0,     0,   165,   166,   167,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    80,     0,     0,    81,     0,     0,
-      82,     0,     0,     0,     0,     0,    83,     0,     0,     0,
-       0,    84,    85,    86,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    87,     0,     0,    88,     0,
-      89,    90,    91,     0,   643,     0,     0,    92,    93,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    94,    95,     0,     0,    96,     0,
-      97,    98,    99,   100,   101,   102,   103,     0,   104,     0,
-     105,   106,   107,   108,  1580,   109,     0,   110,     0,     0,
-       0,     0,     0,   111,     0,     0,     0,   112,     0,     0,
-       0,     0,   644,   645,   646,   647,   648,     0,     0,     0,
-     649,   650,   651,   652,   653,     0,   654,   655,   656,   657,
-     658,   659,   660,   661,   662,   663,   664,   665,  1435,     0,
+     129,    26,    27,   130,     0,     0,     0,   131,     0,     0,
+     132,   133,     0,   134,     0,     0,   135,    28,   136,  1472,
+       0,     0,   137,   138,     0,     0,     0,     0,     0,     0,
+     139,   140,   141,   142,     0,     0,     0,     0,     0,     0,
+     143,     0,     0,     0,  1473,     0,     0,     0,     0,     0,
+    1474,     0,     0,     0,     0,  1940,     0,    31,    67,    68,
+      69,    70,    71,    72,   144,     0,     0,     0,     0,   145,
+     146,     0,     0,     0,     0,    73,    74,     0,     0,    75,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     113,   114,     0,     0,     0,     0,     0,     0,   115,     0,
-       0,     0,   116,     0,     0,     0,     0,     0,   117,     0,
-       0,   118,   119,   120,   121,   122,   123,   124,   125,   126,
-     127,     0,   128,     0,     0,     0,     0,     0,   129,     0,
-       0,   130,     0,     0,     0,   131,     0,     0,   132,   133,
-       0,   134,     0,     0,   135,     0,   136,     0,     0,     0,
-     137,   138,     0,     0,     0,     0,     0,   139,   140,   141,
-     142,     0,     0,     0,     0,     0,     0,   143,    67,    68,
-      69,    70,    71,    72,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    73,    74,     0,     0,    75,
-       0,   144,     0,     0,     0,     0,   145,   146,     0,     0,
        0,    76,     0,     0,    77,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,    78,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    79,     0,     0,     0,
-     165,   166,   167,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    80,     0,     0,    81,     0,     0,    82,     0,
+       0,     0,     0,     0,     0,     0,    79,     3,     4,  1467,
+       6,     0,     0,     0,     0,     0,     0,     0,     0,     7,
+       8,     9,  1468,     0,     0,    81,     0,     0,  1469,     0,
        0,     0,     0,     0,    83,     0,     0,     0,     0,    84,
       85,    86,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,    87,     0,     0,    88,     0,    89,    90,
-      91,     0,   643,     0,     0,    92,    93,     0,     0,     0,
+      91,     0,     0,   643,     0,    92,    93,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,    94,    95,     0,     0,    96,     0,    97,    98,
       99,   100,   101,   102,   103,     0,   104,     0,   105,   106,
-     107,   108,  1586,   109,     0,   110,     0,     0,     0,     0,
-       0,   111,     0,     0,     0,   112,     0,     0,     0,     0,
-     644,   645,   646,   647,   648,     0,     0,     0,   649,   650,
-     651,   652,   653,     0,   654,   655,   656,   657,   658,   659,
+     107,   108,  1541,   109,     0,   110,     0,     0,     0,     0,
+       0,   111,     0,     0,   112,     0,     0,     0,     0,     0,
+     644,   645,   646,   647,   648,   649,   650,   651,   652,   653,
+       0,     0,     0,     0,   654,   655,   656,   657,   658,   659,
      660,   661,   662,   663,   664,   665,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   113,   114,
-       0,     0,     0,     0,     0,     0,   115,     0,     0,     0,
-     116,     0,     0,     0,     0,     0,   117,     0,     0,   118,
-     119,   120,   121,   122,   123,   124,   125,   126,   127,     0,
-     128,     0,     0,     0,     0,     0,   129,     0,     0,   130,
-       0,     0,     0,   131,     0,     0,   132,   133,     0,   134,
-       0,     0,   135,     0,   136,     0,     0,     0,   137,   138,
+       0,     0,     0,     0,     0,     0,     0,   113,   114,     0,
+       0,     0,     0,     0,     0,   115,     0,     0,     0,   116,
+       0,     0,     0,     0,     0,   117,    15,  1471,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,     0,   128,
+       0,     0,     0,     0,     0,   129,    26,    27,   130,     0,
+       0,     0,   131,     0,     0,   132,   133,     0,   134,     0,
+       0,   135,    28,   136,  1472,     0,     0,   137,   138,     0,
        0,     0,     0,     0,     0,   139,   140,   141,   142,     0,
-       0,     0,     0,     0,     0,   143,    67,    68,    69,    70,
-      71,    72,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    73,    74,     0,     0,    75,     0,   144,
-       0,     0,     0,     0,   145,   146,     0,     0,     0,    76,
+       0,     0,     0,     0,     0,   143,     0,     0,     0,  1473,
+       0,     0,     0,     0,     0,  1474,     0,     0,     0,     0,
+       0,  2032,    31,     0,     0,     0,     0,     0,     0,   144,
+       0,     0,     0,     0,   145,   146,    67,    68,    69,    70,
+      71,    72,     0,     0,     0,     0,     0,     0,   226,     0,
+       0,     0,     0,    73,    74,     0,     0,    75,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    76,
        0,     0,    77,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    78,     0,     0,   267,   268,   269,     0,
-       0,     0,     0,     0,   270,     0,     0,     0,     0,     0,
+       0,     0,     0,    78,     0,     0,     0,     0,     0,   228,
+       0,     0,     0,     0,    79,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
       80,     0,     0,    81,     0,     0,    82,     0,     0,     0,
        0,     0,    83,     0,     0,     0,     0,    84,    85,    86,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,    87,     0,     0,    88,     0,    89,    90,    91,     0,
-     643,     0,     0,    92,    93,     0,     0,     0,     0,     0,
+       0,   643,     0,    92,    93,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
       94,    95,     0,     0,    96,     0,    97,    98,    99,   100,
      101,   102,   103,     0,   104,     0,   105,   106,   107,   108,
-    1813,   109,     0,   110,     0,     0,     0,     0,     0,   111,
-       0,     0,     0,   112,     0,     0,     0,     0,   644,   645,
-     646,   647,   648,     0,     0,     0,   649,   650,   651,   652,
-     653,     0,   654,   655,   656,   657,   658,   659,   660,   661,
+    1589,   109,     0,   110,     0,     0,     0,     0,     0,   111,
+       0,     0,   112,     0,     0,     0,     0,     0,   644,   645,
+     646,   647,   648,   649,   650,   651,   652,   653,     0,     0,
+       0,     0,   654,   655,   656,   657,   658,   659,   660,   661,
      662,   663,   664,   665,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   276,   277,   233,   234,   235,
+     236,     0,     0,   115,     0,     0,     0,   116,     0,     0,
+       0,     0,     0,   117,     0,     0,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,     0,   128,     0,     0,
+       0,     0,     0,   129,     0,     0,   130,     0,     0,     0,
+     131,     0,     0,   132,   133,     0,   134,     0,     0,   135,
+       0,   136,     0,     0,     0,   278,   138,    67,    68,    69,
+     993,   994,   995,   139,   140,   141,   142,     0,     0,     0,
+       0,     0,     0,   143,    73,    74,     0,     0,    75,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      76,     0,     0,    77,     0,     0,     0,   144,     0,     0,
+       0,     0,   145,   146,    78,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    79,     0,     0,     0,   162,
+     163,   164,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    80,     0,     0,    81,     0,     0,    82,     0,     0,
+       0,     0,     0,    83,     0,     0,     0,     0,    84,    85,
+      86,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    87,     0,     0,    88,     0,    89,    90,    91,
+     643,     0,     0,     0,    92,    93,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    94,    95,     0,     0,    96,     0,    97,    98,    99,
+     100,   101,   102,   103,     0,   104,     0,   105,   106,   107,
+     108,     0,   109,     0,   110,     0,     0,     0,     0,     0,
+     111,     0,     0,   112,     0,     0,     0,   644,   645,   646,
+     647,   648,   649,   650,   651,   652,   653,     0,     0,     0,
+       0,   654,   655,   656,   657,   658,   659,   660,   661,   662,
+     663,   664,   665,     0,   996,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,   113,   114,     0,     0,
        0,     0,     0,     0,   115,     0,     0,     0,   116,     0,
        0,     0,     0,     0,   117,     0,     0,   118,   119,   120,
      121,   122,   123,   124,   125,   126,   127,     0,   128,     0,
-       0,     0,     0,     0,   129,     0,     0,   271,     0,     0,
+       0,     0,     0,     0,   129,     0,     0,   130,     0,     0,
        0,   131,     0,     0,   132,   133,     0,   134,     0,     0,
-     272,     0,   136,     0,     0,     0,   137,   138,     0,     0,
-       0,     0,     0,   139,   273,   141,   142,     0,     0,     0,
-       0,     0,     0,   143,    67,    68,    69,    70,    71,    72,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    73,    74,     0,     0,    75,     0,   144,     0,     0,
-       0,     0,   145,   146,     0,     0,     0,    76,     0,     0,
-      77,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    78,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    79,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    80,     0,
-       0,    81,     0,     0,    82,     0,     0,     0,     0,     0,
-      83,     0,     0,     0,     0,    84,    85,    86,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    87,
-       0,     0,    88,     0,    89,    90,    91,     0,   643,     0,
-       0,    92,    93,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    94,    95,
-       0,     0,    96,     0,    97,    98,    99,   100,   101,   102,
-     103,     0,   104,     0,   105,   106,   107,   108,  1814,   109,
-       0,   720,     0,     0,     0,     0,     0,   111,     0,     0,
-       0,   112,     0,     0,     0,     0,   644,   645,   646,   647,
-     648,     0,     0,     0,   649,   650,   651,   652,   653,     0,
-     654,   655,   656,   657,   658,   659,   660,   661,   662,   663,
-     664,   665,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   113,   114,     0,     0,     0,     0,
-       0,     0,   115,     0,     0,     0,   116,   257,   258,   259,
-       0,     0,   117,     0,     0,   118,   119,   120,   121,   122,
-     123,   124,   125,   126,   127,     0,   128,     0,     0,     0,
-       0,     0,   129,     0,     0,   130,     0,     0,     0,   131,
-       0,     0,   132,   133,     0,   134,     0,     0,   135,     0,
-     136,     0,     0,     0,   721,   138,     0,     0,     0,     0,
-       0,   139,   140,   141,   142,     0,     0,     0,     0,     0,
-       0,   143,    67,    68,    69,   992,   993,   994,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    73,
-      74,     0,     0,    75,     0,   144,     0,     0,     0,     0,
-     145,   146,     0,     0,     0,    76,     0,     0,    77,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    78,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      79,     0,     0,     0,   165,   166,   167,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    80,     0,     0,    81,
-       0,     0,    82,     0,     0,     0,     0,     0,    83,     0,
-       0,     0,     0,    84,    85,    86,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    87,     0,     0,
-      88,     0,    89,    90,    91,     0,   643,     0,     0,    92,
-      93,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    94,    95,     0,     0,
-      96,     0,    97,    98,    99,   100,   101,   102,   103,     0,
-     104,     0,   105,   106,   107,   108,  1815,   109,     0,   110,
-       0,     0,     0,     0,     0,   111,     0,     0,     0,   112,
-       0,     0,     0,     0,   644,   645,   646,   647,   648,     0,
-       0,     0,   649,   650,   651,   652,   653,     0,   654,   655,
-     656,   657,   658,   659,   660,   661,   662,   663,   664,   665,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   113,   114,     0,     0,     0,     0,     0,     0,
-     115,     0,     0,     0,   116,     0,     0,     0,     0,     0,
-     117,     0,     0,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,     0,   128,     0,     0,     0,     0,     0,
-     129,     0,     0,   130,     0,     0,     0,   131,     0,     0,
-     132,   133,     0,   134,     0,     0,   135,     0,   136,     0,
-       0,     0,   137,   138,     0,     0,     0,     0,     0,   139,
-     140,   141,   142,     0,     0,     0,     0,     0,     0,   143,
-      67,    68,    69,    70,    71,    72,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    73,    74,     0,
-       0,    75,     0,   144,     0,     0,     0,     0,   145,   146,
-       0,     0,     0,    76,     0,     0,    77,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    78,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    79,     0,
-       0,   163,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    80,     0,     0,    81,     0,     0,
-      82,     0,     0,     0,     0,     0,    83,     0,     0,     0,
-       0,    84,    85,    86,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    87,     0,     0,    88,     0,
-      89,    90,    91,   643,     0,     0,     0,    92,    93,     0,
+     135,     0,   136,     0,     0,     0,   137,   138,    67,    68,
+      69,   993,   994,   995,   139,   140,   141,   142,     0,     0,
+       0,     0,     0,     0,   143,    73,    74,     0,     0,    75,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    94,    95,     0,     0,    96,     0,
-      97,    98,    99,   100,   101,   102,   103,     0,   104,     0,
-     105,   106,   107,   108,     0,   109,     0,   110,     0,     0,
-       0,     0,     0,   111,     0,    14,     0,   112,     0,     0,
-       0,   644,   645,   646,   647,   648,     0,     0,     0,   649,
-     650,   651,   652,   653,     0,   654,   655,   656,   657,   658,
-     659,   660,   661,   662,   663,   664,   665,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     113,   114,     0,     0,     0,     0,     0,     0,   115,     0,
-       0,     0,   116,     0,     0,     0,     0,     0,   117,     0,
-       0,   118,   119,   120,   121,   122,   123,   124,   125,   126,
-     127,     0,   128,     0,     0,     0,     0,     0,   129,     0,
-       0,   130,     0,     0,     0,   131,     0,     0,   132,   133,
-       0,   134,     0,     0,   135,     0,   136,     0,     0,     0,
-     137,   138,     0,     0,     0,     0,     0,   139,   140,   141,
-     142,     0,     0,     0,     0,     0,     0,   143,    67,    68,
-      69,    70,    71,    72,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    73,    74,     0,     0,    75,
-       0,   144,     0,     0,     0,     0,   145,   146,     0,     0,
-       0,    76,     0,     0,    77,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    78,     0,     0,     0,     0,
+       0,    76,     0,     0,    77,     0,     0,     0,   144,     0,
+       0,     0,     0,   145,   146,    78,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,    79,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     162,   163,   164,     0,     0,     0,     0,     0,     0,     0,
        0,     0,    80,     0,     0,    81,     0,     0,    82,     0,
        0,     0,     0,     0,    83,     0,     0,     0,     0,    84,
       85,    86,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -4158,53 +3986,158 @@ static const yytype_int16 yytable[] =
        0,     0,    94,    95,     0,     0,    96,     0,    97,    98,
       99,   100,   101,   102,   103,     0,   104,     0,   105,   106,
      107,   108,     0,   109,     0,   110,     0,     0,     0,     0,
-       0,   111,     0,     0,     0,   112,     0,     0,     0,     0,
-       0,     0,  1081,     0,     0,     0,     0,     0,     0,     0,
+       0,   111,     0,     0,   112,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  1442,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   113,   114,     0,
+       0,     0,     0,     0,     0,   115,     0,     0,     0,   116,
+       0,     0,     0,     0,     0,   117,     0,     0,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,     0,   128,
+       0,     0,     0,     0,     0,   129,     0,     0,   130,     0,
+       0,     0,   131,     0,     0,   132,   133,     0,   134,     0,
+       0,   135,     0,   136,     0,     0,     0,   137,   138,    67,
+      68,    69,    70,    71,    72,   139,   140,   141,   142,     0,
+       0,     0,     0,     0,     0,   143,    73,    74,     0,     0,
+      75,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    76,     0,     0,    77,     0,     0,     0,   144,
+       0,     0,     0,     0,   145,   146,    78,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    79,     0,     0,
+       0,   162,   163,   164,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    80,     0,     0,    81,     0,     0,    82,
+       0,     0,     0,     0,     0,    83,     0,     0,     0,     0,
+      84,    85,    86,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    87,     0,     0,    88,     0,    89,
+      90,    91,     0,     0,   643,     0,    92,    93,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    94,    95,     0,     0,    96,     0,    97,
+      98,    99,   100,   101,   102,   103,     0,   104,     0,   105,
+     106,   107,   108,  1592,   109,     0,   110,     0,     0,     0,
+       0,     0,   111,     0,     0,   112,     0,     0,     0,     0,
+       0,   644,   645,   646,   647,   648,   649,   650,   651,   652,
+     653,     0,     0,     0,     0,   654,   655,   656,   657,   658,
+     659,   660,   661,   662,   663,   664,   665,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,   113,   114,
-       0,     0,     0,     0,     0,     0,   115,     0,  1082,     0,
+       0,     0,     0,     0,     0,     0,   115,     0,     0,     0,
      116,     0,     0,     0,     0,     0,   117,     0,     0,   118,
      119,   120,   121,   122,   123,   124,   125,   126,   127,     0,
      128,     0,     0,     0,     0,     0,   129,     0,     0,   130,
        0,     0,     0,   131,     0,     0,   132,   133,     0,   134,
        0,     0,   135,     0,   136,     0,     0,     0,   137,   138,
-       0,     0,     0,     0,     0,   139,   140,   141,   142,     0,
-       0,     0,     0,     0,     0,   143,    67,    68,    69,    70,
-      71,    72,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    73,    74,     0,     0,    75,     0,   144,
-       0,     0,     0,     0,   145,   146,     0,     0,     0,    76,
-       0,     0,    77,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    78,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    79,     0,     0,     0,     0,     0,
+      67,    68,    69,    70,    71,    72,   139,   140,   141,   142,
+       0,     0,     0,     0,     0,     0,   143,    73,    74,     0,
+       0,    75,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    76,     0,     0,    77,     0,     0,     0,
+     144,     0,     0,     0,     0,   145,   146,    78,     0,     0,
+     267,   268,   269,     0,     0,     0,     0,     0,   270,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      80,     0,     0,    81,     0,     0,    82,     0,     0,     0,
-       0,     0,    83,     0,     0,     0,     0,    84,    85,    86,
+       0,     0,     0,     0,    80,     0,     0,    81,     0,     0,
+      82,     0,     0,     0,     0,     0,    83,     0,     0,     0,
+       0,    84,    85,    86,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    87,     0,     0,    88,     0,
+      89,    90,    91,     0,     0,   643,     0,    92,    93,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    87,     0,     0,    88,     0,    89,    90,    91,     0,
-       0,     0,     0,    92,    93,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    94,    95,     0,     0,    96,     0,
+      97,    98,    99,   100,   101,   102,   103,     0,   104,     0,
+     105,   106,   107,   108,  1815,   109,     0,   110,     0,     0,
+       0,     0,     0,   111,     0,     0,   112,     0,     0,     0,
+       0,     0,   644,   645,   646,   647,   648,   649,   650,   651,
+     652,   653,     0,     0,     0,     0,   654,   655,   656,   657,
+     658,   659,   660,   661,   662,   663,   664,   665,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   113,
+     114,     0,     0,     0,     0,     0,     0,   115,     0,     0,
+       0,   116,     0,     0,     0,     0,     0,   117,     0,     0,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+       0,   128,     0,     0,     0,     0,     0,   129,     0,     0,
+     271,     0,     0,     0,   131,     0,     0,   132,   133,     0,
+     134,     0,   643,   272,     0,   136,     0,     0,     0,   137,
+     138,    67,    68,    69,    70,    71,    72,   139,   273,   141,
+     142,     0,     0,     0,     0,     0,     0,   143,    73,    74,
+       0,     0,    75,     0,     0,     0,     0,     0,     0,     0,
+       0,  1816,     0,     0,    76,     0,     0,    77,     0,     0,
+       0,   144,     0,     0,     0,     0,   145,   146,    78,   644,
+     645,   646,   647,   648,   649,   650,   651,   652,   653,    79,
+       0,     0,     0,   654,   655,   656,   657,   658,   659,   660,
+     661,   662,   663,   664,   665,    80,     0,     0,    81,     0,
+       0,    82,     0,     0,     0,     0,     0,    83,     0,     0,
+       0,     0,    84,    85,    86,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    87,     0,     0,    88,
+       0,    89,    90,    91,     0,     0,   643,     0,    92,    93,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      94,    95,     0,     0,    96,     0,    97,    98,    99,   100,
-     101,   102,   103,     0,   104,     0,   105,   106,   107,   108,
-       0,   109,     0,   110,     0,     0,     0,     0,     0,   111,
-       0,     0,     0,   112,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    94,    95,     0,     0,    96,
+       0,    97,    98,    99,   100,   101,   102,   103,     0,   104,
+       0,   105,   106,   107,   108,  1817,   109,     0,   718,     0,
+       0,     0,     0,     0,   111,     0,     0,   112,     0,     0,
+       0,     0,     0,   644,   645,   646,   647,   648,   649,   650,
+     651,   652,   653,     0,     0,     0,     0,   654,   655,   656,
+     657,   658,   659,   660,   661,   662,   663,   664,   665,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     113,   114,     0,     0,     0,     0,     0,     0,   115,     0,
+       0,     0,   116,   257,   258,   259,     0,     0,   117,     0,
+       0,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,     0,   128,     0,     0,     0,     0,     0,   129,     0,
+       0,   130,     0,     0,     0,   131,     0,     0,   132,   133,
+       0,   134,     0,     0,   135,     0,   136,     0,     0,     0,
+     719,   138,    67,    68,    69,   993,   994,   995,   139,   140,
+     141,   142,     0,     0,     0,     0,     0,     0,   143,    73,
+      74,     0,     0,    75,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    76,     0,     0,    77,     0,
+       0,     0,   144,     0,     0,     0,     0,   145,   146,    78,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      79,     0,     0,     0,   162,   163,   164,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    80,     0,     0,    81,
+       0,     0,    82,     0,     0,     0,     0,     0,    83,     0,
+       0,     0,     0,    84,    85,    86,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    87,     0,     0,
+      88,     0,    89,    90,    91,     0,     0,     0,     0,    92,
+      93,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    94,    95,     0,     0,
+      96,     0,    97,    98,    99,   100,   101,   102,   103,     0,
+     104,     0,   105,   106,   107,   108,     0,   109,     0,   110,
+       0,     0,     0,     0,     0,   111,     0,     0,   112,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   113,   114,     0,     0,
-       0,     0,     0,     0,   115,     0,     0,     0,   116,     0,
-       0,     0,     0,     0,   117,     0,     0,   118,   119,   120,
-     121,   122,   123,   124,   125,   126,   127,     0,   128,     0,
-       0,     0,     0,     0,   129,     0,     0,   130,     0,     0,
-       0,   131,     0,     0,   132,   133,     0,   134,     0,     0,
-     135,   453,   136,     0,     0,     0,   137,   138,     0,     0,
-       0,     0,     0,   139,   140,   141,   142,     0,     0,     0,
-       0,     0,     0,   143,    67,    68,    69,    70,    71,    72,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    73,    74,     0,     0,    75,     0,   144,     0,     0,
-       0,     0,   145,   146,     0,     0,     0,    76,     0,     0,
-      77,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    78,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   113,   114,     0,     0,     0,     0,     0,     0,   115,
+       0,     0,     0,   116,     0,     0,     0,     0,     0,   117,
+       0,     0,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,     0,   128,     0,     0,     0,     0,     0,   129,
+       0,     0,   130,     0,     0,     0,   131,     0,     0,   132,
+     133,     0,   134,     0,     0,   135,     0,   136,     0,     0,
+       0,   137,   138,    67,    68,    69,    70,    71,    72,   139,
+     140,   141,   142,     0,     0,     0,     0,     0,     0,   143,
+      73,    74,     0,     0,    75,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    76,     0,     0,    77,
+       0,     0,     0,   144,     0,     0,     0,     0,   145,   146,
+      78,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    79,     0,     0,   160,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    80,     0,     0,
+      81,     0,     0,    82,     0,     0,     0,     0,     0,    83,
+       0,     0,     0,     0,    84,    85,    86,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    87,     0,
+       0,    88,     0,    89,    90,    91,     0,     0,     0,     0,
+      92,    93,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    94,    95,     0,
+       0,    96,     0,    97,    98,    99,   100,   101,   102,   103,
+       0,   104,     0,   105,   106,   107,   108,     0,   109,     0,
+     110,     0,     0,     0,     0,     0,   111,    13,     0,   112,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   113,   114,     0,     0,     0,     0,     0,     0,
+     115,     0,     0,     0,   116,     0,     0,     0,     0,     0,
+     117,     0,     0,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,     0,   128,     0,     0,     0,     0,     0,
+     129,     0,     0,   130,     0,     0,     0,   131,     0,     0,
+     132,   133,     0,   134,     0,     0,   135,     0,   136,     0,
+       0,     0,   137,   138,    67,    68,    69,    70,    71,    72,
+     139,   140,   141,   142,     0,     0,     0,     0,     0,     0,
+     143,    73,    74,     0,     0,    75,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    76,     0,     0,
+      77,     0,     0,     0,   144,     0,     0,     0,     0,   145,
+     146,    78,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,    79,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,    80,     0,
        0,    81,     0,     0,    82,     0,     0,     0,     0,     0,
@@ -4215,7 +4148,34 @@ static const yytype_int16 yytable[] =
        0,     0,     0,     0,     0,     0,     0,     0,    94,    95,
        0,     0,    96,     0,    97,    98,    99,   100,   101,   102,
      103,     0,   104,     0,   105,   106,   107,   108,     0,   109,
-       0,   110,     0,     0,     0,     0,     0,   111,     0,   420,
+       0,   110,     0,     0,     0,     0,     0,   111,     0,     0,
+     112,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1086,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   113,   114,     0,     0,     0,     0,     0,
+       0,   115,     0,  1087,     0,   116,     0,     0,     0,     0,
+       0,   117,     0,     0,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,     0,   128,     0,     0,     0,     0,
+       0,   129,     0,     0,   130,     0,     0,     0,   131,     0,
+       0,   132,   133,     0,   134,     0,     0,   135,     0,   136,
+       0,     0,     0,   137,   138,    67,    68,    69,    70,    71,
+      72,   139,   140,   141,   142,     0,     0,     0,     0,     0,
+       0,   143,    73,    74,     0,     0,    75,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    76,     0,
+       0,    77,     0,     0,     0,   144,     0,     0,     0,     0,
+     145,   146,    78,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    79,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    80,
+       0,     0,    81,     0,     0,    82,     0,     0,     0,     0,
+       0,    83,     0,     0,     0,     0,    84,    85,    86,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      87,     0,     0,    88,     0,    89,    90,    91,     0,     0,
+       0,     0,    92,    93,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    94,
+      95,     0,     0,    96,     0,    97,    98,    99,   100,   101,
+     102,   103,     0,   104,     0,   105,   106,   107,   108,     0,
+     109,     0,   110,     0,     0,     0,     0,     0,   111,     0,
        0,   112,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -4225,72 +4185,67 @@ static const yytype_int16 yytable[] =
        0,     0,   117,     0,     0,   118,   119,   120,   121,   122,
      123,   124,   125,   126,   127,     0,   128,     0,     0,     0,
        0,     0,   129,     0,     0,   130,     0,     0,     0,   131,
-       0,     0,   132,   133,     0,   134,     0,     0,   135,     0,
-     136,     0,     0,     0,   137,   138,     0,     0,     0,     0,
-       0,   139,   140,   141,   142,     0,     0,     0,     0,     0,
-       0,   143,    67,    68,    69,    70,    71,    72,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    73,
-      74,     0,     0,    75,     0,   144,     0,     0,     0,     0,
-     145,   146,     0,     0,     0,    76,     0,     0,    77,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    78,
+       0,     0,   132,   133,     0,   134,     0,     0,   135,   449,
+     136,     0,     0,     0,   137,   138,    67,    68,    69,    70,
+      71,    72,   139,   140,   141,   142,     0,     0,     0,     0,
+       0,     0,   143,    73,    74,     0,     0,    75,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    76,
+       0,     0,    77,     0,     0,     0,   144,     0,     0,     0,
+       0,   145,   146,    78,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    79,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      79,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    80,     0,     0,    81,
-       0,     0,    82,     0,     0,     0,     0,     0,    83,     0,
-       0,     0,     0,    84,    85,    86,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    87,     0,     0,
-      88,     0,    89,    90,    91,     0,     0,     0,     0,    92,
-      93,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    94,    95,     0,     0,
-      96,     0,    97,    98,    99,   100,   101,   102,   103,     0,
-     104,     0,   105,   106,   107,   108,     0,   109,     0,   110,
-       0,     0,     0,     0,     0,   111,     0,     0,     0,   112,
+      80,     0,     0,    81,     0,     0,    82,     0,     0,     0,
+       0,     0,    83,     0,     0,     0,     0,    84,    85,    86,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    87,     0,     0,    88,     0,    89,    90,    91,     0,
+       0,     0,     0,    92,    93,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      94,    95,     0,     0,    96,     0,    97,    98,    99,   100,
+     101,   102,   103,     0,   104,     0,   105,   106,   107,   108,
+       0,   109,     0,   110,     0,     0,     0,     0,     0,   111,
+     421,     0,   112,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-    1069,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   113,   114,     0,     0,     0,     0,     0,     0,
-     115,     0,     0,     0,   116,     0,     0,     0,     0,     0,
-     117,     0,     0,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,     0,   128,     0,     0,     0,     0,     0,
-     129,     0,     0,   130,     0,     0,     0,   131,     0,     0,
-     132,   133,     0,   134,     0,     0,   135,     0,   136,     0,
-       0,     0,   137,   138,     0,     0,     0,     0,     0,   139,
-     140,   141,   142,     0,     0,     0,     0,     0,     0,   143,
-      67,    68,    69,    70,    71,    72,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    73,    74,     0,
-       0,    75,     0,   144,     0,     0,     0,     0,   145,   146,
-       0,     0,     0,    76,     0,     0,    77,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    78,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    79,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    80,     0,     0,    81,     0,     0,
-      82,     0,     0,     0,     0,     0,    83,     0,     0,     0,
-       0,    84,    85,    86,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    87,     0,     0,    88,     0,
-      89,    90,    91,     0,     0,     0,     0,    92,    93,     0,
+       0,     0,     0,     0,     0,   113,   114,     0,     0,     0,
+       0,     0,     0,   115,     0,     0,     0,   116,     0,     0,
+       0,     0,     0,   117,     0,     0,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,     0,   128,     0,     0,
+       0,     0,     0,   129,     0,     0,   130,     0,     0,     0,
+     131,     0,     0,   132,   133,     0,   134,     0,     0,   135,
+       0,   136,     0,     0,     0,   137,   138,    67,    68,    69,
+      70,    71,    72,   139,   140,   141,   142,     0,     0,     0,
+       0,     0,     0,   143,    73,    74,     0,     0,    75,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    94,    95,     0,     0,    96,     0,
-      97,    98,    99,   100,   101,   102,   103,     0,   104,     0,
-     105,   106,   107,   108,     0,   109,     0,   110,     0,     0,
-       0,     0,     0,   111,     0,     0,     0,   112,     0,     0,
+      76,     0,     0,    77,     0,     0,     0,   144,     0,     0,
+       0,     0,   145,   146,    78,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    79,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    80,     0,     0,    81,     0,     0,    82,     0,     0,
+       0,     0,     0,    83,     0,     0,     0,     0,    84,    85,
+      86,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    87,     0,     0,    88,     0,    89,    90,    91,
+       0,     0,     0,     0,    92,    93,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    94,    95,     0,     0,    96,     0,    97,    98,    99,
+     100,   101,   102,   103,     0,   104,     0,   105,   106,   107,
+     108,     0,   109,     0,   110,     0,     0,     0,     0,     0,
+     111,     0,     0,   112,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     113,   114,     0,     0,     0,     0,     0,     0,   115,     0,
-    1082,     0,   116,     0,     0,     0,     0,     0,   117,     0,
-       0,   118,   119,   120,   121,   122,   123,   124,   125,   126,
-     127,     0,   128,     0,     0,     0,     0,     0,   129,     0,
-       0,   130,     0,     0,     0,   131,     0,     0,   132,   133,
-       0,   134,     0,     0,   135,     0,   136,     0,     0,     0,
-     137,   138,     0,     0,     0,     0,     0,   139,   140,   141,
-     142,     0,     0,     0,     0,     0,     0,   143,    67,    68,
-      69,    70,    71,    72,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    73,    74,     0,     0,    75,
-       0,   144,     0,     0,     0,     0,   145,   146,     0,     0,
-       0,    76,     0,     0,    77,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    78,     0,     0,     0,     0,
+       0,     0,     0,     0,  1074,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   113,   114,     0,     0,
+       0,     0,     0,     0,   115,     0,     0,     0,   116,     0,
+       0,     0,     0,     0,   117,     0,     0,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,     0,   128,     0,
+       0,     0,     0,     0,   129,     0,     0,   130,     0,     0,
+       0,   131,     0,     0,   132,   133,     0,   134,     0,     0,
+     135,     0,   136,     0,     0,     0,   137,   138,    67,    68,
+      69,    70,    71,    72,   139,   140,   141,   142,     0,     0,
+       0,     0,     0,     0,   143,    73,    74,     0,     0,    75,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    76,     0,     0,    77,     0,     0,     0,   144,     0,
+       0,     0,     0,   145,   146,    78,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,    79,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,    80,     0,     0,    81,     0,     0,    82,     0,
@@ -4302,7 +4257,34 @@ static const yytype_int16 yytable[] =
        0,     0,    94,    95,     0,     0,    96,     0,    97,    98,
       99,   100,   101,   102,   103,     0,   104,     0,   105,   106,
      107,   108,     0,   109,     0,   110,     0,     0,     0,     0,
-       0,   111,     0,     0,     0,   112,     0,     0,     0,     0,
+       0,   111,     0,     0,   112,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   113,   114,     0,
+       0,     0,     0,     0,     0,   115,     0,  1087,     0,   116,
+       0,     0,     0,     0,     0,   117,     0,     0,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,     0,   128,
+       0,     0,     0,     0,     0,   129,     0,     0,   130,     0,
+       0,     0,   131,     0,     0,   132,   133,     0,   134,     0,
+       0,   135,     0,   136,     0,     0,     0,   137,   138,    67,
+      68,    69,    70,    71,    72,   139,   140,   141,   142,     0,
+       0,     0,     0,     0,     0,   143,    73,    74,     0,     0,
+      75,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    76,     0,     0,    77,     0,     0,     0,   144,
+       0,     0,     0,     0,   145,   146,    78,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    79,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    80,     0,     0,    81,     0,     0,    82,
+       0,     0,     0,     0,     0,    83,     0,     0,     0,     0,
+      84,    85,    86,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    87,     0,     0,    88,     0,    89,
+      90,    91,     0,     0,     0,     0,    92,    93,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    94,    95,     0,     0,    96,     0,    97,
+      98,    99,   100,   101,   102,   103,     0,   104,     0,   105,
+     106,   107,   108,     0,   109,     0,   110,     0,     0,     0,
+       0,     0,   111,     0,     0,   112,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -4313,1925 +4295,1897 @@ static const yytype_int16 yytable[] =
      128,     0,     0,     0,     0,     0,   129,     0,     0,   130,
        0,     0,     0,   131,     0,     0,   132,   133,     0,   134,
        0,     0,   135,     0,   136,     0,     0,     0,   137,   138,
-       0,     0,     0,     0,     0,   139,   140,   141,   142,     0,
-       0,     0,     0,     0,     0,   143,    67,    68,    69,    70,
-      71,    72,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    73,    74,     0,     0,    75,     0,   144,
-       0,     0,     0,     0,   145,   146,     0,     0,     0,    76,
-       0,     0,    77,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    78,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    79,     0,     0,     0,     0,     0,
+      67,    68,    69,    70,    71,    72,   139,   140,   141,   142,
+       0,     0,     0,     0,     0,     0,   143,    73,    74,     0,
+       0,    75,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    76,     0,     0,    77,     0,     0,     0,
+     144,     0,     0,     0,     0,   145,   146,    78,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    79,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      80,     0,     0,    81,     0,     0,    82,     0,     0,     0,
-       0,     0,    83,     0,     0,     0,     0,    84,    85,    86,
+       0,     0,     0,     0,    80,     0,     0,    81,     0,     0,
+      82,     0,     0,     0,     0,     0,    83,     0,     0,     0,
+       0,    84,    85,    86,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    87,     0,     0,    88,     0,
+      89,    90,    91,     0,     0,     0,     0,    92,    93,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    87,     0,     0,    88,     0,    89,    90,    91,     0,
-       0,     0,     0,    92,    93,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    94,    95,     0,     0,    96,     0,
+      97,    98,    99,   100,   101,   102,   103,     0,   104,     0,
+     105,   106,   107,   108,     0,   109,     0,   110,     0,     0,
+       0,     0,     0,   111,     0,     0,   112,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      94,    95,     0,     0,    96,     0,    97,    98,    99,   100,
-     101,   102,   103,     0,   104,     0,   105,   106,   107,   108,
-       0,   109,     0,   110,     0,     0,     0,     0,     0,   111,
-       0,     0,     0,   112,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   113,
+     114,     0,     0,     0,     0,     0,     0,   481,     0,     0,
+       0,   116,     0,     0,     0,     0,     0,   117,     0,     0,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+       0,   128,     0,     0,     0,     0,     0,   129,     0,     0,
+     130,     0,     0,     0,   131,     0,     0,   132,   133,     0,
+     134,     0,     0,   135,     0,   136,     0,     0,     0,   137,
+     138,    67,    68,    69,    70,    71,    72,   139,   140,   141,
+     142,     0,     0,     0,     0,     0,     0,   143,    73,    74,
+       0,     0,    75,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    76,     0,     0,    77,     0,     0,
+       0,   144,     0,     0,     0,     0,   145,   146,    78,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    79,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    80,     0,     0,    81,     0,
+       0,    82,     0,     0,     0,     0,     0,    83,     0,     0,
+       0,     0,    84,    85,    86,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    87,     0,     0,    88,
+       0,    89,    90,    91,     0,     0,     0,     0,    92,    93,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    94,    95,     0,     0,    96,
+       0,    97,    98,    99,   100,   101,   102,   103,     0,   104,
+       0,   105,   106,   107,   108,     0,   109,     0,   110,     0,
+       0,     0,     0,     0,   111,     0,     0,   112,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   113,   114,     0,     0,
-       0,     0,     0,     0,   481,     0,     0,     0,   116,     0,
-       0,     0,     0,     0,   117,     0,     0,   118,   119,   120,
-     121,   122,   123,   124,   125,   126,   127,     0,   128,     0,
-       0,     0,     0,     0,   129,     0,     0,   130,     0,     0,
-       0,   131,     0,     0,   132,   133,     0,   134,     0,     0,
-     135,     0,   136,     0,     0,     0,   137,   138,     0,     0,
-       0,     0,     0,   139,   140,   141,   142,     0,     0,     0,
-       0,     0,     0,   143,    67,    68,    69,    70,    71,    72,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    73,    74,     0,     0,    75,     0,   144,     0,     0,
-       0,     0,   145,   146,     0,     0,     0,    76,     0,     0,
-      77,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    78,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    79,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    80,     0,
-       0,    81,     0,     0,    82,     0,     0,     0,     0,     0,
-      83,     0,     0,     0,     0,    84,    85,    86,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    87,
-       0,     0,    88,     0,    89,    90,    91,     0,     0,     0,
-       0,    92,    93,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    94,    95,
-       0,     0,    96,     0,    97,    98,    99,   100,   101,   102,
-     103,     0,   104,     0,   105,   106,   107,   108,     0,   109,
-       0,   110,     0,     0,     0,     0,     0,   111,     0,     0,
-       0,   112,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     113,   114,     0,     0,     0,     0,     0,     0,   115,     0,
+       0,     0,   116,     0,     0,     0,     0,     0,   117,     0,
+       0,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,     0,   128,     0,     0,     0,     0,     0,   129,     0,
+       0,   130,     0,     0,     0,   131,     0,     0,   132,   133,
+       0,   134,     0,     0,   135,     0,   136,     0,     0,     0,
+     137,   138,     0,     0,     0,     0,     0,     0,   139,   140,
+     141,   142,     0,     0,     0,     0,     0,     0,   143,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   113,   114,     0,     0,     0,     0,
-       0,     0,   115,     0,     0,     0,   116,     0,     0,     0,
-       0,     0,   117,     0,     0,   118,   119,   120,   121,   122,
-     123,   124,   125,   126,   127,     0,   128,     0,     0,     0,
-       0,     0,   129,     0,     0,   130,     0,     0,     0,   131,
-       0,     0,   132,   133,     0,   134,     0,     0,   135,     0,
-     136,     0,     0,     0,   137,   138,     0,     0,     0,     0,
-       0,   139,   140,   141,   142,     0,     0,     0,     0,     0,
-       0,   143,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,  1218,     0,     0,     0,     0,
-     145,   146
+       0,     0,  1223,     0,     0,     0,     0,   145,   146
 };
 
 static const yytype_int16 yycheck[] =
 {
-       0,    17,   217,   291,   162,    36,     0,   163,     4,   406,
-      25,   423,     0,     9,   172,   291,   624,    13,     0,   765,
-     216,    17,    18,   281,     0,   757,  1054,   577,   281,  1352,
-       0,   426,   190,   191,   672,   537,     0,   195,   455,    35,
-      36,   281,  1288,   580,   927,   928,     0,    27,     3,   317,
-      11,   588,   496,   784,   920,   425,     3,   501,   502,   503,
-     443,     0,   942,   943,   582,    11,  1507,   872,    14,   874,
-      66,  1168,   590,   293,   294,   295,   498,   499,   553,    16,
-     885,     4,    14,   536,   553,   333,   334,   775,   776,   741,
-      82,    58,   211,    27,   746,    18,  1078,   108,  1421,  1684,
-      84,   349,  1687,  1418,  1078,  1414,  1429,   155,     5,     6,
-       7,     8,     9,    10,     3,    11,   281,     3,   165,   166,
-     167,   275,   342,   275,     0,    58,   333,   112,  1867,   249,
-     406,    67,   734,   108,   294,     0,   152,     5,     6,     7,
-       8,     9,    10,    66,   514,   265,  1421,   155,    66,   130,
-     310,    87,   108,    86,  1429,    66,   152,   153,   278,   108,
-     762,   258,   158,   171,    53,   157,   151,   321,   160,   321,
-     390,   391,   337,   173,   174,   175,   176,   177,   178,   173,
-     174,   175,   176,   177,   178,   173,   174,   175,   176,   177,
-     178,   173,   174,   175,   176,   177,   178,   173,   174,   175,
-     176,   177,   178,   173,   174,   175,   176,   177,   178,   173,
-     174,   175,   176,   177,   178,   170,   212,   213,   214,   173,
-     174,   175,   176,   177,   178,  1666,   701,   612,    55,   209,
-     153,   227,   701,   229,   173,   174,   175,   176,   177,   178,
-     460,   237,   238,   239,   240,   241,   242,   243,   463,   245,
-     246,   621,   170,    42,    43,     3,   252,   253,     0,   170,
+       0,   291,   217,    16,    36,   406,     0,   580,     4,   766,
+     160,   417,     0,     9,   624,   588,   216,   420,     0,   291,
+      16,    17,    24,   758,     0,   281,  1059,   928,   929,   169,
+       0,   577,   785,   537,    30,   672,     0,   582,  1295,    35,
+      36,   281,   942,   943,     3,   590,   281,   187,   188,    10,
+       0,     3,   192,   317,  1359,   496,    10,    26,   536,    13,
+     501,   502,   503,   921,   498,   499,   208,    26,    83,    15,
+      66,   293,   294,   295,   214,  1513,   451,   739,   439,   333,
+     107,     4,   744,   776,   777,   107,   260,   154,   873,  1869,
+     875,    26,  1173,     3,    17,   173,   558,    57,   107,   107,
+    1688,   886,   275,  1691,  1083,   333,   334,  1425,   223,  1421,
+      63,   168,   247,   553,   106,   168,  1511,  1083,   734,    81,
+     342,   349,   168,  1428,   419,    81,    57,   553,   263,    82,
+     168,  1436,    81,    65,   406,   154,    65,     3,     3,   152,
+       4,   276,     3,    66,   106,    86,    10,   763,    65,   105,
+     169,   260,    93,    94,    85,     3,   152,   153,   273,   274,
+      54,   612,   158,   337,   337,   627,    13,   245,   390,   391,
+     170,   171,   172,   173,   174,   175,   170,   171,   172,   173,
+     174,   175,   170,   171,   172,   173,   174,   175,   170,   171,
+     172,   173,   174,   175,   170,   171,   172,   173,   174,   175,
+     170,   171,   172,   173,   174,   175,   170,   171,   172,   173,
+     174,   175,     0,   209,   210,   211,   168,   111,   167,   514,
+     170,   171,   172,   173,   174,   175,     0,  1622,   337,    65,
+     153,   227,  1670,   229,   256,     0,   168,   206,   460,   168,
+    2020,   237,   238,   239,   240,   241,   242,   243,   463,   245,
+     246,   168,   244,    10,    41,    42,   252,   253,   106,   699,
      256,   257,   258,   259,   260,   261,   262,   263,   264,   265,
-    1642,   740,   741,    64,   170,   271,   272,   746,   170,  2018,
-     675,  1596,   278,   680,   216,   112,  1595,  1872,  1385,   337,
-     213,   214,    83,    82,   341,   291,   292,   173,   174,   175,
-     176,   177,   178,   189,   190,   169,   229,   171,   173,   174,
-     175,   176,   177,   178,   237,   238,   239,   240,   285,  1050,
-     243,  1303,   245,   246,   258,   321,   337,   485,   830,  1303,
-     253,   748,   451,   256,   257,   258,   259,  1203,   261,   262,
-     263,   264,   265,   591,   881,   728,   729,   985,   555,   987,
-      11,   335,   796,   797,   798,   278,   624,   312,  1681,   566,
-     567,   171,   337,    82,  1169,  1744,   313,  1172,   364,   887,
-     267,   171,   794,   170,   311,  1063,   851,   169,   831,  1751,
-    1032,   342,   851,   631,   591,  1757,   254,   106,   337,   257,
-       3,   169,     3,   641,   601,   615,   342,  1643,   170,  1885,
-      82,   333,  1648,   107,    82,    66,   170,   423,   262,   616,
-     102,   558,  1505,   170,   107,   107,   170,  1858,   160,   337,
-      80,   417,   170,   630,   420,    66,   262,   423,   122,   107,
-     426,   173,   174,   175,   176,   177,   178,     3,   823,   824,
-      78,   364,    64,    65,    66,    67,   338,    55,   275,   445,
-     171,   171,   146,    86,   107,   148,   148,   248,    64,    65,
-      66,    67,   442,   155,   171,  1837,   462,  1953,   333,   173,
-    1849,   171,  1851,   337,  1846,   471,   472,   473,   474,   475,
-     627,   270,   130,   337,   515,   481,   168,     5,   171,   747,
-       0,   487,   488,    11,   747,   491,   107,   493,   494,   495,
-     707,   337,   434,   898,   112,   171,   764,   747,   169,   170,
-      66,   764,  1758,   509,  1394,  1395,   171,   513,   108,   515,
-     130,   891,   445,  1616,   764,   277,   108,   337,   169,   170,
-       5,     6,     7,     8,     9,    10,  1908,   337,  1910,   462,
-     171,   338,   800,   539,    83,   337,   761,   800,   471,   472,
-     473,   474,   475,    66,   162,   813,   169,   170,  1363,   337,
-     813,   107,   171,  1032,     0,   488,   338,   855,   491,  1374,
-     493,   494,   495,   813,   338,   270,  1381,  1127,   186,   855,
-     186,   338,  1313,     0,   338,   337,   854,    82,   171,    64,
-      65,    66,    67,   246,   609,   338,   611,   171,   171,  1207,
-     139,   759,   822,   169,   170,  1213,  1244,  1215,   624,   187,
-     329,   171,   170,   169,   170,   334,   337,   337,   171,   227,
-     228,   229,   230,   245,   316,   338,   171,   173,   624,   625,
-     337,   171,   628,   294,  2006,    16,  1154,   337,   279,   245,
-     171,  1011,   170,   575,   248,   337,   268,   171,   256,   897,
-     857,   171,   920,   669,   337,   150,   169,   170,   153,   591,
-    1104,   269,   268,   162,   171,    66,   270,   275,   258,   601,
-     918,   337,   280,   669,   689,   671,   258,   170,   224,   675,
-     676,   171,   337,   171,   904,   953,   906,    68,    69,    70,
-     246,    72,    73,    74,    75,   171,    98,    66,   946,   947,
-     155,    21,    22,   309,  1587,   107,   337,   315,   171,   317,
-     575,   186,   171,  1741,  1742,   124,   171,    85,   266,   265,
-     129,    56,   268,   279,   186,   721,   591,    62,   337,   228,
-     229,   230,   278,   246,   186,   277,   601,   173,   174,   175,
-     176,   177,   178,   337,   676,   113,   261,   115,   116,   117,
-     118,   119,   120,    55,   337,   123,   173,   174,   175,   176,
-     177,   178,   758,   337,   337,  1033,   279,   337,   169,   170,
-     245,   173,   112,   262,   169,   707,   262,   337,   774,   775,
-     776,    86,   163,    87,   337,   247,    11,   783,   784,   258,
-      94,    95,   337,   268,   297,   247,   299,   337,   721,   795,
-     169,   170,  1410,   171,  1412,   820,   337,  1415,  1028,   149,
-     112,   151,   223,   337,  1072,   229,   225,   337,  1033,  1072,
-     292,   836,  1192,   337,  1268,  1269,  1270,   341,  1223,  1199,
-     337,  1201,  1072,  1091,   309,   758,   275,   246,  1091,   229,
-     131,  1343,   707,  1380,   246,  1060,  1383,   337,  1243,   337,
-     170,  1091,   165,   166,   167,   250,    39,    40,   171,   855,
-     162,   337,   858,   113,   114,   115,   116,   117,   118,   119,
-     120,   867,   795,   123,   337,   270,   275,   232,   337,   875,
-     261,   236,   275,   225,   186,   101,   882,    70,   131,   107,
-    1148,  1149,  1624,  1625,    87,  1148,  1149,    90,   275,  1095,
-    1096,   275,   898,    96,   920,   149,   124,   151,  1148,  1149,
-     101,   129,   844,   845,   846,   206,   207,   208,   209,   210,
-     211,   212,   213,   214,   920,   227,   228,   229,   230,    85,
-     926,   927,   928,   275,   276,  1203,    68,    69,    70,  1207,
-      72,    73,    74,    75,   867,  1213,   174,  1215,   316,   165,
-     166,   167,   215,   216,   256,   173,   297,   113,   299,   115,
-     116,   117,   118,   119,   120,    42,    43,   123,   211,   212,
-     213,   214,   315,   275,   165,   166,   167,   275,   280,   107,
-     171,  1589,   312,   313,   314,   315,   174,   174,   920,   177,
-     178,   179,   180,   181,   182,   183,   184,    81,    82,   187,
-     188,   769,   770,   771,   772,  1001,   224,   225,  1228,   275,
-     942,   943,   297,   315,   299,   317,   297,   145,   299,   147,
-     148,   337,  1392,  1393,   102,   793,   215,   216,   246,   226,
-     281,   163,  1402,   293,  1030,  1031,    64,    65,     3,    67,
-    1316,     3,  1262,   170,  1040,  1041,   170,   265,  1044,   170,
-     268,   248,  1048,  1049,  1050,   920,   170,   254,   255,  1279,
-     278,  1281,  1282,  1283,    88,    89,   316,  1063,   170,  1466,
-    1607,    22,  1068,   248,   131,  1333,   273,   170,  1078,   170,
-    1333,  1077,   251,   252,  1078,  1081,  1082,  1019,     5,     6,
-       7,   165,   166,   167,   170,   270,   122,  1093,   273,   274,
-     165,   166,   167,    20,   101,  1101,   171,    24,    25,    26,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    68,    69,    70,  1078,   170,  1049,    74,    75,  1024,
-     170,  1026,  1027,   130,   170,    52,    53,    54,   170,  1078,
-     319,   320,  1410,   170,  1412,    99,   100,  1415,   170,   337,
-     207,   208,   209,   210,   211,   212,   213,   214,  1081,   170,
-     316,   165,   166,   167,  1701,   275,   276,   171,   165,   166,
-     167,    17,   815,   316,   171,   818,   819,   820,  1101,  1427,
-    1428,   173,   174,  1720,   170,   177,   178,  1203,   633,   634,
-     635,  1207,   170,   836,   837,   838,   839,  1213,   170,  1215,
-     170,  1859,  1078,  1861,  1862,  1863,   170,  1203,   176,    55,
-     170,  1207,    58,   189,   190,  1422,  1628,  1213,   170,  1215,
-     181,   182,  1218,   327,  1500,  1501,   170,  1223,  1224,   226,
-    1450,   170,  1452,   338,  1492,  1493,  1494,   337,  1984,  1492,
-    1493,  1494,    92,    93,    17,    88,    89,  1243,   170,  1245,
-     170,   248,  1492,  1493,  1494,   323,   324,   254,   255,  1466,
-     170,  1468,   321,   322,    64,    65,   112,  1009,   175,   176,
-      91,  1203,   753,   754,  1206,   327,   273,  1971,  1972,   286,
-     287,   277,    55,   551,   552,    58,     5,     6,     7,     8,
-       9,    10,  1288,  1289,    97,  1326,   293,   294,   295,   337,
-    1296,   316,   295,  1303,   130,  1461,   130,   130,   130,  1303,
-     309,   109,   109,   108,   171,  1591,   162,  1313,   258,   294,
-     169,  1589,   170,  1338,   232,  1340,   170,  1342,   170,   169,
-    1326,  1327,  1347,   246,   223,   170,   229,   170,  1203,   112,
-     337,   286,   287,   288,   289,   290,   291,    38,   294,  1303,
-     170,   170,  1749,  1890,   170,   170,  1352,   286,   287,   288,
-     289,   290,   291,   170,  1303,   282,   283,   284,   285,   215,
-     216,   217,   218,   219,   220,   164,   170,   170,   170,  1375,
-     170,   227,   228,   229,   230,  1592,   170,   170,   174,   162,
-     338,    23,   174,   171,  1410,   109,  1412,   233,  1618,  1415,
-       0,     1,  1622,   152,   233,     3,  1626,   170,   169,   171,
-     256,   171,   170,   170,  1410,   340,  1412,   170,   203,  1415,
-     337,   171,  1418,   269,   279,  1421,    81,  1303,    78,   275,
-    1637,   170,   278,  1429,   280,   253,   108,  1644,   131,   238,
-     277,   269,   215,   216,   217,   218,   219,   220,   102,  1465,
-     310,    51,   169,   169,   227,   228,   229,   230,   131,   276,
-     170,   233,  1394,  1395,    64,    65,    66,    67,    20,  1465,
-     257,   317,    98,  1761,    23,   316,    76,    77,    78,    79,
-     261,   277,   316,   256,   264,    85,   337,   102,   108,   174,
-    1521,   316,   177,   178,   179,   180,   181,   182,   183,   184,
-    1496,   170,   275,   188,   155,   278,   337,   280,  1728,   143,
+     337,   169,   675,   699,   169,   271,   272,   187,   188,   680,
+     169,   338,   278,   168,  1602,   338,  1874,   210,   211,  1601,
+       0,   169,   338,   246,    81,   291,   292,  1050,   738,   739,
+     338,   555,   168,   168,   744,   447,   229,   168,    65,   882,
+     337,  1392,   566,   567,   237,   238,   239,   240,   168,   334,
+     243,   256,   245,   246,   284,   321,   621,   831,   337,   337,
+     253,  1310,   168,   256,   257,   258,   259,   591,   261,   262,
+     263,   264,   265,   888,  1310,   485,   169,   601,   280,   986,
+    1208,   988,   169,   312,   832,   278,   797,   798,   799,   311,
+     624,   795,   616,   591,   310,   726,   727,  1646,   364,   216,
+    1032,   746,   328,   824,   825,  1068,   630,   333,  1887,   273,
+    1685,   342,   170,   171,   172,   173,   174,   175,   342,  1174,
+    1647,   280,  1177,   615,   169,  1652,   170,   171,   172,   173,
+     174,   175,    81,   631,   417,   170,   171,   172,   173,   174,
+     175,   168,   852,   641,   280,   280,   162,   163,   164,   169,
+     337,   417,  1860,     3,   420,   421,   852,     4,     5,     6,
+       7,     8,     9,     4,     5,     6,     7,     8,     9,   337,
+      10,   364,   337,    65,   280,   441,  1955,   212,   337,   169,
+      65,   705,   173,   338,    81,   280,   107,   453,   279,   337,
+     170,   171,   172,   173,   174,   175,   462,    20,    21,   438,
+     149,   129,    52,   152,  1753,   471,   472,   473,   474,   475,
+    1759,   268,   101,   515,   169,   481,   333,   106,   338,   745,
+     106,   487,   488,   169,    55,   491,   899,   493,   494,   495,
+      61,  1401,  1402,  1760,   169,   745,   169,   273,   169,   765,
+     745,   256,   337,   509,   337,    65,   337,   513,   441,   515,
+     337,   169,   246,   280,   245,   765,   293,   169,   147,   156,
+     765,   280,   159,    82,   756,   154,   293,   169,   169,   462,
+     169,   169,   309,   539,   268,   801,   168,   762,   471,   472,
+     473,   474,   475,   168,   320,   171,   169,   169,   814,   273,
+    1839,   801,   337,   169,   169,   488,   856,  1320,   491,  1848,
+     493,   494,   495,   169,   814,    63,    64,    65,    66,   814,
+     169,   169,    15,   430,   856,  1370,  1132,   337,   337,   138,
+      97,   855,  1032,   107,   169,   341,  1381,   892,   168,   106,
+       0,   823,  1212,  1388,   858,   256,   320,   609,  1218,   611,
+    1220,   624,  1249,   121,  1159,   168,    84,   337,   168,   106,
+     760,    79,   244,   333,    63,    64,    65,    66,   624,   625,
+     111,  1910,   628,  1912,    67,    68,    69,   145,    71,    72,
+      73,    74,     0,    66,   112,  1746,   114,   115,   116,   117,
+     118,   119,   337,    77,   122,   277,   669,   921,   280,    85,
+     147,   337,   277,    86,   171,   280,   129,   148,  1109,   150,
+     898,   154,   337,   669,   337,   671,   337,   123,   129,   675,
+     676,   252,   128,   905,   255,   907,   169,   689,   265,   337,
+     954,   919,  1593,   338,   244,   337,   315,     4,     5,     6,
+       7,     8,     9,   130,    54,   337,   337,   111,   337,   337,
+    1743,  1744,   940,   941,   268,  1010,    38,    39,   337,   162,
+     163,   164,   106,   719,   337,   337,   161,   277,   575,  2008,
+     280,   337,   337,   166,   173,   185,   337,   244,   168,   100,
+     341,   337,    86,   338,   591,    89,   150,    69,   337,   337,
+    1851,    95,  1853,   168,   601,   243,    63,    64,    65,    66,
+    1428,   111,   337,   759,   637,   638,   639,    54,  1436,  1033,
+     170,   171,   172,   173,   174,   175,   168,   223,   266,   775,
+     776,   777,   209,   210,   211,   212,   264,   171,   784,   785,
+     100,   226,   227,   228,    63,    64,   719,    66,   244,   275,
+     796,   162,   163,   164,   243,   337,  1028,  1417,   169,  1419,
+     259,   161,  1422,   148,  1387,   150,   230,  1390,  1033,   821,
+     234,  1077,   337,   173,   111,  1228,   259,   266,   260,   676,
+    1052,  1272,  1273,  1274,    85,   837,   759,  1077,   222,   248,
+    1096,  1024,  1077,  1026,  1027,  1248,  1350,   315,   260,   296,
+    1065,   298,   162,   163,   164,   296,  1096,   298,   705,   268,
+     856,  1096,   296,   859,   298,   575,   173,    10,   296,   308,
+     298,   280,   868,   796,   161,   225,   226,   227,   228,   263,
+     876,   591,   266,   213,   214,   256,   173,   883,   227,   106,
+     246,   601,   276,  1628,  1629,   213,   214,  1153,  1154,   273,
+    1100,  1101,  1197,   899,   254,    41,    42,   273,   921,  1204,
+     273,  1206,   268,  1153,  1154,   271,   272,   267,  1153,  1154,
+      80,    81,   273,   273,   314,   921,   273,   144,   278,   146,
+     147,   927,   928,   929,    87,    88,   243,   227,   225,   226,
+     227,   228,   221,    84,  1208,   868,   249,   250,  1212,     0,
+     291,    67,    68,    69,  1218,   337,  1220,    73,    74,   266,
+     770,   771,   772,   773,   314,   172,   316,   254,   172,   318,
+     319,   112,   273,   114,   115,   116,   117,   118,   119,    98,
+      99,   122,   273,   274,   794,  1595,   273,   162,   163,   164,
+     273,   278,   292,   100,   169,   705,   187,   188,   845,   846,
+     847,   308,   101,   177,   178,   279,  1002,   112,   113,   114,
+     115,   116,   117,   118,   119,  1237,     3,   122,     3,    67,
+      68,    69,   129,    71,    72,    73,    74,   314,   169,   316,
+     162,   163,   164,  1029,  1030,    91,    92,   169,   168,  1861,
+    1613,  1863,  1864,  1865,  1040,  1041,  1268,   224,  1044,    87,
+      88,  1323,  1048,  1049,  1050,   162,   163,   164,   162,   163,
+     164,  1283,   169,    21,  1286,   169,  1288,  1289,  1290,   246,
+      16,  1472,  1068,   168,   921,   252,   253,  1073,   312,   313,
+     314,   315,   168,  1083,  1340,   168,  1082,   322,   323,  1083,
+    1086,  1087,   320,   321,   271,   942,   943,    63,    64,   168,
+    1340,   168,  1098,   168,  1399,  1400,   172,   173,    54,   168,
+    1106,    57,   751,   752,  1409,   286,   287,   224,   166,   170,
+     171,   172,   173,   174,   175,   121,  1049,  1973,  1974,  1288,
+    1289,   168,  1705,  1083,   551,   552,   168,   168,   816,   246,
+     168,   819,   820,   821,   168,   252,   253,   168,   168,   168,
+     168,  1724,   168,  1417,   168,  1419,   168,   168,  1422,   837,
+     838,   839,   840,  1086,   271,   111,     4,     5,     6,     7,
+       8,     9,  1019,   168,   315,  1429,   285,   286,   287,   288,
+     289,   290,   168,  1106,   168,   292,   293,   294,   285,   286,
+     287,   288,   289,   290,   315,  1208,   338,   106,   326,  1212,
+     183,   168,   337,  1431,  1432,  1218,   168,  1220,   168,   326,
+     315,   921,  1208,   275,   123,   161,  1212,    90,  1472,   128,
+    1474,    96,  1218,   337,  1220,   129,  1632,  1223,   129,  1986,
+     337,   294,  1228,  1229,  1506,  1507,   129,  1459,   129,   108,
+     308,   108,  1498,  1499,  1500,   285,   286,   287,   288,   289,
+     290,    16,  1248,   107,  1250,   315,   169,   256,  1498,  1499,
+    1500,   230,   171,  1498,  1499,  1500,   293,   213,   214,   215,
+     216,   217,   218,   170,   171,   280,   168,   174,   175,   225,
+     226,   227,   228,   168,   168,   244,  1051,   280,   221,    54,
+     168,   227,    57,    37,   168,  1083,   168,   168,   168,  1295,
+    1296,  1333,   168,   168,   168,   168,   168,  1303,   254,  1083,
+    1310,   168,   168,   222,   223,   168,  1310,  1467,   165,  1892,
+     293,   267,   172,   172,  1320,  1597,    22,   273,   338,   169,
+     276,  1595,   278,   108,   151,   244,   130,  1333,  1334,     3,
+     168,   231,   231,  1345,  1598,  1347,   111,  1349,   169,   169,
+    1751,   280,  1354,   168,   263,   168,   168,   266,   340,   201,
+    1310,  1208,   169,  1359,  1211,   277,    80,   276,   172,    77,
+     316,   175,   176,   177,   178,   179,   180,   181,   182,   107,
+     275,   185,   186,   251,   236,   267,  1382,  1641,   101,   168,
+     130,   274,   280,   309,  1648,   168,   161,   231,    19,   280,
+     255,   262,  1624,    97,  1417,   315,  1419,   315,  1630,  1422,
+     204,   205,   206,   207,   208,   209,   210,   211,   212,    22,
+     259,  1417,   337,  1419,   275,   101,  1422,   107,   315,  1425,
+     337,   154,  1428,   168,   337,   142,   169,   100,   282,   169,
+    1436,   337,   130,   337,   105,   169,   106,   307,   213,   214,
+     215,   216,   217,   218,   297,    86,   255,   169,  1471,   168,
+     225,   226,   227,   228,   130,   205,   206,   207,   208,   209,
+     210,   211,   212,  1763,   107,  1471,   335,   336,   168,   327,
+     252,   168,   341,   251,    88,   310,   106,   346,   107,   254,
+     107,   337,   337,   251,   169,  1527,   337,   259,  1208,   169,
+     337,   169,   268,   317,   259,   259,  1502,   169,   273,   168,
+    1732,   276,   169,   278,   337,   169,   169,   315,  1772,   169,
+     172,   337,  1310,   175,   176,   177,   178,   179,   180,   181,
+     182,  1527,   275,   337,   186,   169,  1310,   203,   204,   205,
+     206,   207,   208,   209,   210,   211,   212,   337,  1471,   337,
+     337,   316,   101,   169,  1401,  1402,   169,   169,  1554,   169,
+     419,   169,   169,   169,   157,   291,   307,   130,   168,   168,
+     172,   430,   168,   175,   176,   177,   178,   179,   180,   181,
+     182,   169,  1595,   185,   186,   175,   176,   177,   178,   179,
+     180,   181,   182,    73,  1850,   106,   186,  1593,    73,  1595,
+      70,   168,   101,   104,   101,  1827,  1602,   169,   100,   169,
+    1850,   169,   123,   260,  1868,  1850,   260,   128,   129,  1632,
+      15,   169,   315,   169,     3,   261,   337,     3,   229,  1919,
+     258,  1627,   229,   258,  1774,   280,  1632,  1633,   201,   202,
      203,   204,   205,   206,   207,   208,   209,   210,   211,   212,
-     213,   214,   101,   337,   171,  1521,   171,   283,   298,   308,
-     130,   337,   205,   206,   207,   208,   209,   210,   211,   212,
-     213,   214,  1465,   106,   317,   286,   287,   288,   289,   290,
-     291,   174,  1548,   131,   177,   178,   179,   180,   181,   182,
-     183,   184,   337,  1770,   187,   188,   107,   171,   337,   169,
-     170,   174,   171,  1589,   177,   178,   179,   180,   181,   182,
-     183,   184,   328,   170,   187,   188,   170,   170,    87,   337,
-    1848,  1587,   257,  1589,   108,  1848,    89,   254,   107,   311,
-    1596,   253,   108,   108,   253,  1825,   171,   337,  1848,   171,
-     171,   270,  1628,   261,  1772,   318,   171,   177,   178,   179,
-     180,   181,   182,   183,   184,   261,   226,  1623,   188,  1917,
-     261,   337,  1628,  1629,   234,   235,   171,   237,   171,   239,
-     240,   241,   242,   243,   244,   245,   171,  1643,   248,   171,
-     337,   171,  1648,   277,   254,   255,   337,   337,   171,  1866,
-     171,   171,   170,   316,   171,   102,  1662,   171,   171,   337,
-     270,   171,   158,   273,   170,   170,   170,   335,   336,   292,
-     308,   171,    74,   341,    74,  1681,  1682,    71,   346,   170,
-     102,   105,   102,   171,   101,  1853,   171,   171,   171,    16,
-     316,   171,  1698,   262,  1911,   262,     3,   174,   231,   309,
-     177,   178,   179,   180,   181,   182,   183,   184,   337,   231,
-     187,   188,   260,   260,  1982,     3,   169,   263,   169,  1982,
-     170,    76,   171,  1729,   316,   171,   140,   140,   171,  1662,
-     171,   171,  1982,   277,   246,    74,   170,   102,  1744,   171,
-     171,   324,   270,   170,   246,    82,   337,   337,   306,   304,
-     169,   233,  1758,   232,   339,  1761,   125,   425,   233,   170,
-     224,  1767,     5,     6,     7,   326,   434,   171,   171,   337,
-     171,   337,   171,   170,   338,   171,   171,    20,   171,   159,
-     337,    24,    25,    26,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,   261,   261,   337,   261,   261,
-     337,   188,  1808,   107,   225,   253,   170,  2032,   269,    52,
-      53,    54,   170,   170,   268,   233,  2041,   298,   316,   170,
-     107,  1827,   260,   168,   109,  1831,   262,  1833,    84,    84,
-     107,   107,  1838,   107,  1767,   261,   261,  1843,   171,   332,
-     332,   330,   337,  1849,     3,  1851,   514,   321,   258,   308,
-     130,   338,   233,   269,   298,     5,   233,  1867,     5,   126,
-     305,  1867,   297,  1867,  1870,   325,   338,   337,   151,  1867,
-     148,   153,     3,   148,   316,  1867,   187,    59,  1884,   547,
-     171,  1867,   130,     4,   127,   128,     4,  1867,   296,   170,
-     110,   156,   171,  1867,   153,    60,   308,   150,   321,  1905,
-     333,   308,   130,   308,   296,   261,   321,    61,   261,  1915,
-     308,  1917,   580,   581,   582,   306,   298,   302,   304,   261,
-     588,    64,   590,   332,  1930,  1931,  1932,  1933,    65,   170,
-     314,    41,   130,  1303,   783,  1255,   604,   605,   606,   209,
-     208,   331,  1021,   444,    36,  1924,  1050,   446,  1616,  1313,
-     748,  2013,   620,   621,  1991,  1990,  1983,  1648,  2018,  1756,
-    1923,  1639,  1756,  1494,   632,   633,   634,   635,  2021,  1975,
-    1779,  1977,  1778,  1333,   445,   643,   644,   645,   646,   647,
-     648,   649,   650,   651,   652,   653,   654,   655,   656,   657,
-     658,   659,   660,   661,   662,   663,   664,   665,   690,     8,
-     156,  1457,  2008,   671,   672,  1827,  1830,  1899,  2018,  1452,
-    1282,  1393,  2018,   855,  2018,  2021,  1392,  1211,  1019,  1009,
-    2018,   930,  1224,   640,   680,   678,  2018,   889,   417,   852,
-    1603,  1133,  2018,   639,  1720,   642,   907,   669,  2018,   282,
-     283,   284,   285,     3,  2018,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    35,   512,    18,    19,
-     567,  1687,    22,    23,   851,   619,    26,    27,    28,  1869,
-    1685,   911,  1540,  1373,   911,   553,  1701,  1362,    38,  1365,
-    1547,    41,  1802,  1881,    44,    45,    46,    47,    48,    49,
-      50,    -1,    52,  1889,    -1,    55,    56,    57,    -1,   589,
-      -1,    -1,    62,    63,    -1,    -1,    66,    67,    68,    69,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    79,
-      -1,    -1,    82,    -1,    -1,    85,    -1,    -1,    -1,    -1,
-      -1,    91,    -1,    -1,    -1,    -1,    96,    97,    98,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   107,    -1,    -1,
-     110,   111,    -1,   113,    -1,   115,   116,   117,    -1,    -1,
-      -1,   121,   122,   123,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   131,   132,   133,   134,   135,    -1,   137,   138,   139,
-     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
-     150,   151,    -1,   153,   154,   155,   156,   157,   158,    -1,
-     160,   161,   162,    -1,    -1,    -1,    -1,    -1,   168,   877,
-     170,   171,   172,   881,    -1,    -1,    -1,    -1,    -1,   887,
-      -1,    -1,    -1,   891,    -1,    -1,    -1,    -1,    -1,   189,
-     190,    -1,    -1,    -1,   194,   195,   196,    -1,    -1,    -1,
-      -1,   909,    -1,    -1,   912,    -1,   206,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   215,   216,    -1,    -1,    -1,
-      -1,    -1,    -1,   223,    -1,    -1,    -1,   227,    -1,    -1,
-      -1,    -1,    -1,   233,   942,   943,   236,   237,   238,   239,
-     240,   241,   242,   243,   244,   245,    -1,   247,    -1,    -1,
-      -1,    -1,    -1,   253,    -1,    -1,   256,    -1,    -1,    -1,
-     260,   969,    -1,   263,   264,    -1,   266,    -1,    -1,   269,
-      -1,   271,    -1,    -1,    -1,   275,   276,   985,    -1,   987,
-      -1,    -1,   282,   283,   284,   285,    -1,    -1,    -1,    -1,
-      -1,    -1,   292,    -1,    -1,    -1,   296,    -1,    -1,    -1,
-     300,   301,    -1,  1011,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,  1019,    -1,    -1,    -1,    -1,   316,    -1,    -1,    -1,
-      -1,   321,   322,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     5,     6,
-       7,    -1,   342,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    20,    -1,    -1,    -1,    24,    25,    26,
+     280,  1647,     4,     5,     6,   514,  1652,    75,   169,  1913,
+     171,   168,   244,   169,   169,   139,   315,    19,   139,   169,
+    1666,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,   169,   275,   169,   547,  1685,
+    1686,    73,   168,   101,   323,   268,   169,   169,   337,    51,
+      52,    53,   244,    81,   168,   231,  1702,   230,   280,   231,
+     305,   222,   223,   224,   124,  1855,   303,   339,   168,   222,
+     325,   580,   581,   582,   169,   169,   337,   169,  1984,   588,
+     169,   590,   168,   244,   169,   246,   169,  1733,   259,   259,
+     338,   252,   253,  1666,  1984,   604,   605,   606,   169,  1984,
+    1746,   337,   263,   337,   337,   266,   158,   259,   337,   186,
+     271,   620,   621,   259,  1760,   276,   251,  1763,   106,   267,
+     223,   231,   168,  1769,   168,   168,   266,   636,   637,   638,
+     639,   297,   315,   106,   643,   644,   645,   646,   647,   648,
+     649,   650,   651,   652,   653,   654,   655,   656,   657,   658,
+     659,   660,   661,   662,   663,   664,   665,   168,   167,   258,
+     108,    83,   671,   672,  1810,    83,   106,   260,   106,  2034,
+     106,   259,   259,   169,   337,   320,   337,   331,  2043,     3,
+     256,   297,   129,  1829,   231,   329,   267,  1833,   331,  1835,
+     307,   304,     4,   231,  1840,     4,  1769,   338,   125,  1845,
+     296,   338,   147,   315,   337,  1851,   324,  1853,   172,   150,
+     147,   175,   176,   177,   178,   179,   180,   181,   182,  1869,
+     152,   185,   186,  1869,     3,  1869,  1872,   185,    58,   295,
+     169,  1869,   307,   129,   307,   336,   169,  1869,   336,   168,
+    1886,   109,   155,  1869,   152,   149,   320,   295,   332,  1869,
+     129,    59,     0,     1,   307,  1869,   307,   320,   259,   331,
+     330,  1907,    60,   305,   297,   301,   303,   259,   259,    63,
+     168,  1917,   313,  1919,    64,    40,   129,  1310,  1259,   281,
+     282,   283,   284,   206,   205,  1926,  1932,  1933,  1934,  1935,
+     172,  1021,    36,   175,   176,   177,   178,   179,   180,   181,
+     182,   784,    50,   185,   186,   746,   442,  1050,  1320,   440,
+    1622,  2015,  1993,  1992,  1985,    63,    64,    65,    66,     4,
+       5,     6,  1652,  2020,  1925,  1758,  1643,    75,    76,    77,
+      78,  1977,  1758,  1979,    19,   337,    84,  2023,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,  1500,  1781,  1340,   690,     8,  1780,  1463,   441,
+     156,  1829,  1832,  1901,  2010,   680,    51,    52,    53,   878,
+    2020,  1400,  1052,   882,  2020,  1019,  2020,  2023,  1216,   888,
+     678,   129,  2020,   892,  1399,  1229,   453,   856,  2020,    35,
+    1609,   633,  1051,   130,  2020,   931,   640,   853,  1138,  1724,
+    2020,   910,   567,   512,   913,   890,  2020,   642,   619,   852,
+     669,  1691,  1871,  1689,   553,  1380,  1546,  1705,  1553,  1804,
+     168,   589,   908,  1369,  1372,  1883,  1891,    -1,    -1,    -1,
+     912,   912,   169,   942,   943,    -1,    -1,    -1,    -1,    -1,
+      -1,   126,   127,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
+      -1,   970,    -1,    -1,   201,   202,   203,   204,   205,   206,
+     207,   208,   209,   210,   211,   212,   224,   986,    -1,   988,
+      -1,    -1,    -1,    -1,   232,   233,    -1,   235,    -1,   237,
+     238,   239,   240,   241,   242,   243,    -1,    -1,   246,    -1,
+      -1,  1010,    -1,    -1,   252,   253,    -1,    -1,    -1,    -1,
+    1019,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     268,   107,    -1,   271,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   280,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   130,    -1,     4,     5,     6,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     308,    19,    -1,    -1,    -1,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    51,    52,    53,   281,   282,   283,   284,
+     337,   187,   188,   189,   190,   191,   192,   193,   194,   195,
+     196,    -1,    -1,    -1,    -1,   201,   202,   203,   204,   205,
+     206,   207,   208,   209,   210,   211,   212,    -1,    -1,  1138,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     4,     5,     6,
+      -1,    -1,    -1,    -1,    -1,    -1,  1155,    -1,    -1,    -1,
+    1159,    -1,    19,    -1,    -1,  1164,    23,    24,    25,    26,
       27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    52,    53,    54,    -1,     5,
-       6,     7,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    20,    -1,    -1,    -1,    24,    25,
-      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    -1,    -1,    -1,  1133,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,     5,     6,     7,    52,    53,    54,    -1,
-      -1,    -1,  1150,    -1,    -1,    -1,  1154,    -1,    20,    -1,
-      -1,  1159,    24,    25,    26,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,  1182,  1183,  1184,  1185,    -1,    -1,
-      52,    53,    54,    -1,  1192,    -1,    -1,    -1,    -1,    -1,
-    1198,  1199,    -1,  1201,    -1,    -1,     5,     6,     7,     8,
-       9,    10,    -1,    -1,   171,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    22,    23,    -1,    -1,    26,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    38,
-      -1,    -1,    41,    -1,    -1,    -1,  1244,    -1,    -1,    -1,
-      -1,    -1,    -1,    52,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    63,    -1,    -1,    66,    67,    68,
-      69,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      79,    -1,    -1,    82,    -1,    -1,    85,    -1,    -1,    -1,
-      -1,    -1,    91,    -1,    -1,    -1,    -1,    96,    97,    98,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  1187,  1188,
+    1189,  1190,    -1,    -1,    51,    52,    53,    -1,  1197,    -1,
+      -1,    -1,    -1,    -1,  1203,  1204,    -1,  1206,    -1,    -1,
+      -1,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    -1,    -1,    17,    18,    -1,    -1,    21,
+      22,    -1,    -1,    25,    26,    27,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,    40,    -1,
+    1249,    43,    44,    45,    46,    47,    48,    49,    -1,    51,
+      -1,   337,    54,    55,    56,    -1,    -1,    -1,    -1,    61,
+      62,    -1,    -1,    65,    66,    67,    68,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,    81,
+      -1,    -1,    84,    -1,    -1,    -1,    -1,    -1,    90,    -1,
+      -1,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,    -1,
+     102,    -1,   169,    -1,   106,    -1,    -1,   109,   110,    -1,
+     112,    -1,   114,   115,   116,   273,    -1,    -1,   120,   121,
+     122,    -1,    -1,   281,   282,   283,   284,    -1,   130,   131,
+     132,   133,   134,    -1,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,    -1,
+     152,   153,   154,   155,   156,   157,    -1,   159,   160,   161,
+    1369,    -1,    -1,  1372,    -1,   167,   168,    -1,   170,   171,
+      -1,  1380,    -1,    -1,    -1,    -1,    -1,    -1,  1387,    -1,
+      -1,  1390,    -1,    -1,    -1,   187,   188,    -1,    -1,    -1,
+    1399,  1400,  1401,  1402,    -1,   197,   198,   199,    -1,    -1,
+    1409,    -1,   204,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   213,   214,    -1,   281,   282,   283,   284,    -1,   221,
+      -1,    -1,    -1,   225,    -1,    -1,    -1,    -1,    -1,   231,
+      -1,    -1,   234,   235,   236,   237,   238,   239,   240,   241,
+     242,   243,    -1,   245,    -1,    -1,    -1,    -1,    -1,   251,
+      -1,    -1,   254,    -1,    -1,    -1,   258,    -1,    -1,   261,
+     262,    -1,   264,    -1,  1473,   267,    -1,   269,    -1,    -1,
+      -1,   273,   274,    -1,    -1,   277,    -1,    -1,   280,   281,
+     282,   283,   284,    -1,    -1,    -1,    -1,    -1,    -1,   291,
+      -1,    -1,    -1,   295,    -1,    -1,    -1,   299,   300,    -1,
+      -1,    -1,  1511,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   315,    -1,    -1,    -1,    -1,   320,   321,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   110,    -1,    -1,   113,    -1,   115,   116,   117,    -1,
-      -1,    -1,    -1,   122,   123,   282,   283,   284,   285,    -1,
+      -1,    -1,    -1,    -1,    -1,     4,     5,     6,   340,    -1,
+     342,    -1,    -1,    -1,  1553,    -1,    -1,    -1,    -1,    -1,
+      19,    -1,    -1,    -1,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,   130,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,  1585,    -1,    -1,  1588,
+      -1,  1590,    51,    52,    53,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   130,    -1,    -1,    -1,    -1,
+    1609,    -1,    -1,    -1,  1613,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,  1622,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,    -1,    -1,    -1,    -1,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+     212,    -1,   187,   188,   189,   190,   191,   192,   193,   194,
+     195,   196,    -1,    -1,    -1,    -1,   201,   202,   203,   204,
+     205,   206,   207,   208,   209,   210,   211,   212,  1687,  1688,
+    1689,    -1,  1691,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   130,    -1,    -1,    -1,    -1,  1705,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     139,   140,    -1,    -1,   143,    -1,   145,   146,   147,   148,
-     149,   150,   151,    -1,   153,    -1,   155,   156,   157,   158,
-      -1,   160,    -1,   162,  1362,    -1,    -1,  1365,    -1,   168,
-     169,   170,    -1,   172,    -1,  1373,   282,   283,   284,   285,
-      -1,    -1,  1380,    -1,    -1,  1383,    64,    65,    66,    67,
-      -1,    -1,   107,    -1,  1392,  1393,  1394,  1395,    76,    77,
-      78,    79,    -1,    -1,  1402,    -1,    -1,    85,    -1,   124,
-      -1,    -1,    -1,   275,   129,   130,   215,   216,    -1,    -1,
-     282,   283,   284,   285,   223,    -1,    -1,    -1,   227,    -1,
-      -1,    -1,    -1,    -1,   233,    -1,    -1,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,    -1,   247,    -1,
-      -1,    -1,    -1,    -1,   253,    -1,   171,   256,   173,    -1,
-      -1,   260,    -1,    -1,   263,   264,    -1,   266,    -1,  1467,
-     269,    -1,   271,    -1,    -1,    -1,   275,   276,    -1,    -1,
-     279,    -1,    -1,   282,   283,   284,   285,    -1,    -1,    -1,
-      -1,   169,   170,   292,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,  1505,    -1,   224,
-     225,   226,    -1,    -1,    -1,    -1,    -1,   316,    -1,    -1,
-      -1,    -1,   321,   322,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   246,    -1,   248,    -1,    -1,    -1,    -1,    -1,   254,
-     255,   340,    -1,   108,    -1,    -1,    -1,    -1,   226,  1547,
-     265,    -1,    -1,   268,    -1,    -1,   234,   235,   273,   237,
-      -1,    -1,    -1,   278,    -1,    -1,   131,    -1,    -1,    -1,
-     248,    -1,    -1,    -1,    -1,    -1,   254,   255,    -1,    -1,
-      -1,  1579,    -1,  1581,    -1,    -1,  1584,    -1,    -1,    -1,
-      -1,    -1,   270,    -1,    -1,   273,    -1,   131,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,  1603,    -1,    -1,    -1,  1607,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  1616,    -1,
-      -1,    -1,   337,    -1,   189,   190,   191,   192,   193,    -1,
-      -1,   309,   197,   198,   199,   200,   201,   171,   203,   204,
-     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
-      -1,   131,    -1,    -1,    -1,   189,   190,   191,   192,   193,
-      -1,    -1,    -1,   197,   198,   199,   200,   201,    -1,   203,
-     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
-     214,    -1,    -1,    -1,    -1,  1683,  1684,  1685,    -1,  1687,
+      -1,    -1,    -1,    -1,    -1,  1724,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   131,    -1,  1701,    -1,    -1,    -1,    -1,    -1,   189,
-     190,   191,   192,   193,    -1,    -1,    -1,   197,   198,   199,
-     200,   201,  1720,   203,   204,   205,   206,   207,   208,   209,
-     210,   211,   212,   213,   214,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    1748,    -1,    -1,    -1,    -1,    -1,  1754,    -1,    -1,   189,
-     190,   191,   192,   193,    -1,    -1,    -1,   197,   198,   199,
-     200,   201,   337,   203,   204,   205,   206,   207,   208,   209,
-     210,   211,   212,   213,   214,    -1,    -1,    -1,    -1,    -1,
-       3,    -1,     5,     6,     7,     8,     9,    10,    11,    12,
-      13,    14,    15,   337,    -1,    18,    19,    -1,    -1,    22,
-      23,    -1,    -1,    26,    27,    28,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    38,    -1,    -1,    41,    -1,
-      -1,    44,    45,    46,    47,    48,    49,    50,    -1,    52,
-      -1,    -1,    55,    56,    57,    -1,    -1,    -1,    -1,    62,
-      63,    -1,    -1,    66,    67,    68,    69,   337,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    79,    -1,    -1,    82,
-      -1,  1869,    85,    -1,  1872,    -1,    -1,    -1,    91,    -1,
-      -1,    -1,    -1,    96,    97,    98,    -1,    -1,    -1,    -1,
-     103,    -1,  1890,    -1,   107,    -1,    -1,   110,   111,    -1,
-     113,    -1,   115,   116,   117,  1903,    -1,   337,   121,   122,
-     123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   131,   132,
-     133,   134,   135,    -1,   137,   138,   139,   140,   141,   142,
-     143,   144,   145,   146,   147,   148,   149,   150,   151,    -1,
-     153,   154,   155,   156,   157,   158,    -1,   160,   161,   162,
-      -1,    -1,    -1,    -1,    -1,   168,   169,   170,    -1,   172,
-     173,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   189,   190,    -1,    -1,
-      -1,   194,   195,   196,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   206,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   215,   216,    -1,    -1,    -1,    -1,    -1,    -1,
-     223,    -1,    -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,
-     233,    -1,    -1,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,    -1,   247,    -1,    -1,    -1,    -1,    -1,
-     253,    -1,    -1,   256,    -1,    -1,    -1,   260,    -1,    -1,
-     263,   264,    -1,   266,    -1,    -1,   269,    -1,   271,    -1,
-      -1,    -1,   275,   276,    -1,    -1,   279,    -1,    -1,   282,
-     283,   284,   285,    -1,    -1,    -1,    -1,    -1,    -1,   292,
-      -1,    -1,    -1,   296,    -1,    -1,    -1,   300,   301,    -1,
+      -1,  1750,    -1,    -1,    -1,    -1,    -1,  1756,   187,   188,
+     189,   190,   191,   192,   193,   194,   195,   196,    -1,    -1,
+      -1,    -1,   201,   202,   203,   204,   205,   206,   207,   208,
+     209,   210,   211,   212,    -1,   337,    -1,    -1,    -1,    -1,
+      -1,    -1,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    -1,    -1,    17,    18,    -1,    -1,
+      21,    22,   337,    -1,    25,    26,    27,    -1,    -1,    -1,
+      -1,    -1,   281,   282,   283,   284,    37,    -1,    -1,    40,
+      -1,    -1,    43,    44,    45,    46,    47,    48,    49,    -1,
+      51,    -1,    -1,    54,    55,    56,    -1,    -1,    -1,    -1,
+      61,    62,    -1,    -1,    -1,    66,    67,    68,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,
+      81,    -1,  1871,    84,    -1,  1874,    -1,    -1,    -1,    90,
+      -1,    -1,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,
+      -1,   102,    -1,  1892,    -1,   106,    -1,    -1,   109,   110,
+      -1,   112,    -1,   114,   115,   116,  1905,    -1,   337,   120,
+     121,   122,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   130,
+     131,   132,   133,   134,    -1,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,   152,   153,   154,   155,   156,   157,    -1,   159,   160,
+     161,    -1,    -1,    -1,    -1,    -1,   167,   168,    -1,   170,
+     171,    -1,   173,   174,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,   187,   188,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   197,   198,   199,    -1,
+      -1,    -1,    -1,   204,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,
+     221,    -1,    -1,    -1,   225,    -1,    -1,    -1,    -1,    -1,
+     231,    -1,    -1,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,    -1,   245,    -1,    -1,    -1,    -1,    -1,
+     251,    -1,    -1,   254,    -1,    -1,    -1,   258,    -1,    -1,
+     261,   262,    -1,   264,    -1,    -1,   267,    -1,   269,    -1,
+      -1,    -1,   273,   274,    -1,    -1,    -1,    -1,    -1,    -1,
+     281,   282,   283,   284,    -1,    -1,    -1,    -1,    -1,    -1,
+     291,    -1,    -1,    -1,   295,    -1,    -1,    -1,   299,   300,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   316,    -1,    -1,    -1,    -1,   321,   322,
+      -1,    -1,    -1,    -1,   315,    -1,    -1,    -1,    -1,   320,
+     321,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   340,
+      -1,   342,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    -1,    -1,    17,    18,    -1,    -1,
+      21,    22,    -1,    -1,    25,    26,    27,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,    40,
+      -1,    -1,    43,    44,    45,    46,    47,    48,    49,    -1,
+      51,    -1,    -1,    54,    55,    56,    -1,    -1,    -1,    -1,
+      61,    62,    -1,    -1,    65,    66,    67,    68,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,
+      81,    -1,    -1,    84,    -1,    -1,    -1,    -1,    -1,    90,
+      -1,    -1,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,
+      -1,   102,    -1,    -1,    -1,   106,    -1,    -1,   109,   110,
+      -1,   112,    -1,   114,   115,   116,    -1,    -1,    -1,   120,
+     121,   122,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   130,
+     131,   132,   133,   134,    -1,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,   152,   153,   154,   155,   156,   157,    -1,   159,   160,
+     161,    -1,    -1,    -1,    -1,    -1,   167,   168,    -1,   170,
+     171,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   187,   188,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   197,   198,   199,    -1,
+      -1,    -1,    -1,   204,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,
+     221,    -1,    -1,    -1,   225,    -1,    -1,    -1,    -1,    -1,
+     231,    -1,    -1,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,    -1,   245,    -1,    -1,    -1,    -1,    -1,
+     251,    -1,    -1,   254,    -1,    -1,    -1,   258,    -1,    -1,
+     261,   262,    -1,   264,    -1,    -1,   267,    -1,   269,    -1,
+      -1,    -1,   273,   274,    -1,    -1,    -1,    -1,    -1,   280,
+     281,   282,   283,   284,    -1,    -1,    -1,    -1,    -1,    -1,
+     291,    -1,    -1,    -1,   295,    -1,    -1,    -1,   299,   300,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   340,     3,   342,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    -1,    -1,    18,    19,    -1,    -1,    22,    23,    -1,
-      -1,    26,    27,    28,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    38,    -1,    -1,    41,    -1,    -1,    44,
-      45,    46,    47,    48,    49,    50,    -1,    52,    -1,    -1,
-      55,    56,    57,    -1,    -1,    -1,    -1,    62,    63,    -1,
-      -1,    -1,    67,    68,    69,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    79,    -1,    -1,    82,    -1,    -1,
-      85,    -1,    -1,    -1,    -1,    -1,    91,    -1,    -1,    -1,
-      -1,    96,    97,    98,    -1,    -1,    -1,    -1,   103,    -1,
-      -1,    -1,   107,    -1,    -1,   110,   111,    -1,   113,    -1,
-     115,   116,   117,    -1,    -1,    -1,   121,   122,   123,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
-     135,    -1,   137,   138,   139,   140,   141,   142,   143,   144,
-     145,   146,   147,   148,   149,   150,   151,    -1,   153,   154,
-     155,   156,   157,   158,    -1,   160,   161,   162,    -1,    -1,
-      -1,    -1,    -1,   168,    -1,   170,    -1,   172,   173,    -1,
-     175,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     185,   186,    -1,    -1,   189,   190,    -1,    -1,    -1,   194,
-     195,   196,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   206,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     215,   216,    -1,    -1,    -1,    -1,    -1,    -1,   223,    -1,
-      -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,   233,    -1,
-      -1,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,    -1,   247,    -1,    -1,    -1,    -1,    -1,   253,    -1,
-      -1,   256,    -1,    -1,    -1,   260,    -1,    -1,   263,   264,
-      -1,   266,    -1,    -1,   269,    -1,   271,    -1,    -1,    -1,
-     275,   276,    -1,    -1,    -1,    -1,    -1,   282,   283,   284,
-     285,    -1,    -1,    -1,    -1,    -1,    -1,   292,    -1,    -1,
-      -1,   296,    -1,    -1,    -1,   300,   301,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   315,    -1,    -1,    -1,    -1,   320,
+     321,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   340,
+      -1,   342,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    -1,    -1,    17,    18,    -1,    -1,
+      21,    22,    -1,    -1,    25,    26,    27,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,    40,
+      -1,    -1,    43,    44,    45,    46,    47,    48,    49,    -1,
+      51,    -1,    -1,    54,    55,    56,    -1,    -1,    -1,    -1,
+      61,    62,    -1,    -1,    -1,    66,    67,    68,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,
+      81,    -1,    -1,    84,    -1,    -1,    -1,    -1,    -1,    90,
+      -1,    -1,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,
+      -1,   102,    -1,    -1,    -1,   106,    -1,    -1,   109,   110,
+      -1,   112,    -1,   114,   115,   116,    -1,    -1,    -1,   120,
+     121,   122,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   130,
+     131,   132,   133,   134,    -1,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,   152,   153,   154,   155,   156,   157,    -1,   159,   160,
+     161,    -1,    -1,    -1,    -1,    -1,   167,   168,    -1,   170,
+     171,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   187,   188,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   197,   198,   199,    -1,
+     201,    -1,    -1,   204,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,
+     221,    -1,    -1,    -1,   225,    -1,    -1,    -1,    -1,    -1,
+     231,    -1,    -1,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,    -1,   245,    -1,    -1,    -1,    -1,    -1,
+     251,    -1,    -1,   254,    -1,    -1,    -1,   258,    -1,    -1,
+     261,   262,    -1,   264,    -1,    -1,   267,    -1,   269,    -1,
+      -1,    -1,   273,   274,    -1,    -1,    -1,    -1,    -1,    -1,
+     281,   282,   283,   284,    -1,    -1,    -1,    -1,    -1,    -1,
+     291,    -1,    -1,    -1,   295,    -1,    -1,    -1,   299,   300,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   316,    -1,    -1,    -1,    -1,   321,   322,    -1,    -1,
+      -1,    -1,    -1,    -1,   315,    -1,    -1,    -1,    -1,   320,
+     321,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   340,
+      -1,   342,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    -1,    -1,    17,    18,    -1,    -1,
+      21,    22,    -1,    -1,    25,    26,    27,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,    40,
+      -1,    -1,    43,    44,    45,    46,    47,    48,    49,    -1,
+      51,    -1,    -1,    54,    55,    56,    -1,    -1,    -1,    -1,
+      61,    62,    -1,    -1,    -1,    66,    67,    68,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,
+      81,    -1,    -1,    84,    -1,    -1,    -1,    -1,    -1,    90,
+      -1,    -1,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,
+      -1,   102,    -1,    -1,    -1,   106,    -1,    -1,   109,   110,
+      -1,   112,    -1,   114,   115,   116,    -1,    -1,    -1,   120,
+     121,   122,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   130,
+     131,   132,   133,   134,    -1,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,   152,   153,   154,   155,   156,   157,    -1,   159,   160,
+     161,    -1,    -1,    -1,    -1,    -1,   167,   168,    -1,   170,
+     171,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   187,   188,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   197,   198,   199,    -1,
+      -1,    -1,    -1,   204,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,
+     221,    -1,    -1,    -1,   225,    -1,    -1,    -1,    -1,    -1,
+     231,    -1,    -1,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,    -1,   245,    -1,    -1,    -1,    -1,    -1,
+     251,    -1,    -1,   254,    -1,    -1,    -1,   258,    -1,    -1,
+     261,   262,    -1,   264,    -1,    -1,   267,    -1,   269,    -1,
+      -1,    -1,   273,   274,    -1,    -1,    -1,    -1,    -1,    -1,
+     281,   282,   283,   284,    -1,    -1,    -1,    -1,    -1,    -1,
+     291,    -1,    -1,    -1,   295,    -1,    -1,    -1,   299,   300,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   340,     3,   342,     5,     6,
-       7,     8,     9,    10,    11,    12,    13,    14,    15,    -1,
-      -1,    18,    19,    -1,    -1,    22,    23,    -1,    -1,    26,
-      27,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    38,    -1,    -1,    41,    -1,    -1,    44,    45,    46,
-      47,    48,    49,    50,    -1,    52,    -1,    -1,    55,    56,
-      57,    -1,    -1,    -1,    -1,    62,    63,    -1,    -1,    66,
-      67,    68,    69,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    79,    -1,    -1,    82,    -1,    -1,    85,    -1,
-      -1,    -1,    -1,    -1,    91,    -1,    -1,    -1,    -1,    96,
-      97,    98,    -1,    -1,    -1,    -1,   103,    -1,    -1,    -1,
-     107,    -1,    -1,   110,   111,    -1,   113,    -1,   115,   116,
-     117,    -1,    -1,    -1,   121,   122,   123,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,    -1,
-     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
-     147,   148,   149,   150,   151,    -1,   153,   154,   155,   156,
-     157,   158,    -1,   160,   161,   162,    -1,    -1,    -1,    -1,
-      -1,   168,   169,   170,    -1,   172,   173,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   315,    -1,    -1,    -1,    -1,   320,
+     321,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   340,
+      -1,   342,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    -1,    -1,    17,    18,    -1,    -1,
+      21,    22,    -1,    -1,    25,    26,    27,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,    40,
+      -1,    -1,    43,    44,    45,    46,    47,    48,    49,    -1,
+      51,    -1,    -1,    54,    55,    56,    -1,    -1,    -1,    -1,
+      61,    62,    -1,    -1,    -1,    66,    67,    68,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,
+      81,    -1,    -1,    84,    -1,    -1,    -1,    -1,    -1,    90,
+      -1,    -1,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   106,    -1,    -1,   109,   110,
+      -1,   112,    -1,   114,   115,   116,    -1,    -1,    -1,   120,
+     121,   122,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   130,
+     131,   132,   133,   134,    -1,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,   152,   153,   154,   155,   156,   157,    -1,   159,   160,
+     161,    -1,    -1,    -1,    -1,    -1,   167,   168,    -1,   170,
+      -1,    -1,    -1,    -1,    -1,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   187,   188,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   197,   198,   199,    -1,
+      -1,    -1,    -1,   204,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,
+     221,    -1,    -1,    -1,   225,    -1,    -1,    -1,    -1,    -1,
+     231,    -1,    -1,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,    -1,   245,    -1,    -1,    -1,    -1,    -1,
+     251,    -1,    -1,   254,    -1,    -1,    -1,   258,    -1,    -1,
+     261,   262,    -1,   264,    -1,    -1,   267,    -1,   269,    -1,
+      -1,    -1,   273,   274,    -1,    -1,    -1,    -1,    -1,    -1,
+     281,   282,   283,   284,    -1,    -1,    -1,    -1,    -1,    -1,
+     291,    -1,    -1,    -1,   295,    -1,    -1,    -1,   299,   300,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   189,   190,    -1,    -1,    -1,   194,   195,   196,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   206,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   215,   216,
-      -1,    -1,    -1,    -1,    -1,    -1,   223,    -1,    -1,    -1,
-     227,    -1,    -1,    -1,    -1,    -1,   233,    -1,    -1,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,    -1,
-     247,    -1,    -1,    -1,    -1,    -1,   253,    -1,    -1,   256,
-      -1,    -1,    -1,   260,    -1,    -1,   263,   264,    -1,   266,
-      -1,    -1,   269,    -1,   271,    -1,    -1,    -1,   275,   276,
-      -1,    -1,    -1,    -1,    -1,   282,   283,   284,   285,    -1,
-      -1,    -1,    -1,    -1,    -1,   292,    -1,    -1,    -1,   296,
-      -1,    -1,    -1,   300,   301,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   316,
-      -1,    -1,    -1,    -1,   321,   322,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   315,    -1,    -1,    -1,    -1,   320,
+     321,    -1,    -1,    -1,    -1,    -1,    -1,   328,    -1,    -1,
+      -1,    -1,    -1,    -1,   335,    -1,    -1,    -1,    -1,    -1,
+      -1,   342,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    -1,    -1,    17,    18,    -1,    -1,
+      21,    22,    -1,    -1,    25,    26,    27,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,    40,
+      -1,    -1,    43,    44,    45,    46,    47,    48,    49,    -1,
+      51,    -1,    -1,    54,    55,    56,    -1,    -1,    -1,    -1,
+      61,    62,    -1,    -1,    65,    66,    67,    68,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,
+      81,    -1,    -1,    84,    -1,    -1,    -1,    -1,    -1,    90,
+      -1,    -1,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   106,    -1,    -1,   109,   110,
+      -1,   112,    -1,   114,   115,   116,    -1,    -1,    -1,   120,
+     121,   122,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   130,
+     131,   132,   133,   134,    -1,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,   152,   153,   154,   155,   156,   157,    -1,   159,   160,
+     161,    -1,    -1,    -1,    -1,    -1,   167,   168,   169,   170,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   340,     3,   342,     5,     6,     7,     8,
-       9,    10,    11,    12,    13,    14,    15,    -1,    -1,    18,
-      19,    -1,    -1,    22,    23,    -1,    -1,    26,    27,    28,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    38,
-      -1,    -1,    41,    -1,    -1,    44,    45,    46,    47,    48,
-      49,    50,    -1,    52,    -1,    -1,    55,    56,    57,    -1,
-      -1,    -1,    -1,    62,    63,    -1,    -1,    -1,    67,    68,
-      69,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      79,    -1,    -1,    82,    -1,    -1,    85,    -1,    -1,    -1,
-      -1,    -1,    91,    -1,    -1,    -1,    -1,    96,    97,    98,
-      -1,    -1,    -1,    -1,   103,    -1,    -1,    -1,   107,    -1,
-      -1,   110,   111,    -1,   113,    -1,   115,   116,   117,    -1,
-      -1,    -1,   121,   122,   123,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   131,   132,   133,   134,   135,    -1,   137,   138,
-     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
-     149,   150,   151,    -1,   153,   154,   155,   156,   157,   158,
-      -1,   160,   161,   162,    -1,    -1,    -1,    -1,    -1,   168,
-      -1,   170,    -1,   172,   173,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   187,   188,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   197,   198,   199,    -1,
+      -1,    -1,    -1,   204,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,
+     221,    -1,    -1,    -1,   225,    -1,    -1,    -1,    -1,    -1,
+     231,    -1,    -1,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,    -1,   245,    -1,    -1,    -1,    -1,    -1,
+     251,    -1,    -1,   254,    -1,    -1,    -1,   258,    -1,    -1,
+     261,   262,    -1,   264,    -1,    -1,   267,    -1,   269,    -1,
+      -1,    -1,   273,   274,    -1,    -1,    -1,    -1,    -1,    -1,
+     281,   282,   283,   284,    -1,    -1,    -1,    -1,    -1,    -1,
+     291,    -1,    -1,    -1,   295,    -1,    -1,    -1,   299,   300,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     189,   190,    -1,    -1,    -1,   194,   195,   196,    -1,    -1,
-      -1,    -1,    -1,    -1,   203,    -1,    -1,   206,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   215,   216,    -1,    -1,
-      -1,    -1,    -1,    -1,   223,    -1,    -1,    -1,   227,    -1,
-      -1,    -1,    -1,    -1,   233,    -1,    -1,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,    -1,   247,    -1,
-      -1,    -1,    -1,    -1,   253,    -1,    -1,   256,    -1,    -1,
-      -1,   260,    -1,    -1,   263,   264,    -1,   266,    -1,    -1,
-     269,    -1,   271,    -1,    -1,    -1,   275,   276,    -1,    -1,
-      -1,    -1,    -1,   282,   283,   284,   285,    -1,    -1,    -1,
-      -1,    -1,    -1,   292,    -1,    -1,    -1,   296,    -1,    -1,
-      -1,   300,   301,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   316,    -1,    -1,
-      -1,    -1,   321,   322,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   315,    -1,    -1,    -1,    -1,   320,
+     321,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    -1,    -1,    17,    18,    -1,    -1,    21,
+      22,   342,    -1,    25,    26,    27,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,    40,    -1,
+      -1,    43,    44,    45,    46,    47,    48,    49,    -1,    51,
+      -1,    -1,    54,    55,    56,    -1,    -1,    -1,    -1,    61,
+      62,    -1,    -1,    -1,    66,    67,    68,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,    81,
+      -1,    -1,    84,    -1,    -1,    -1,    -1,    -1,    90,    -1,
+      -1,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   106,    -1,    -1,   109,   110,    -1,
+     112,    -1,   114,   115,   116,    -1,    -1,    -1,   120,   121,
+     122,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   130,   131,
+     132,   133,   134,    -1,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,    -1,
+     152,   153,   154,   155,   156,   157,    -1,   159,   160,   161,
+      -1,    -1,    -1,    -1,    -1,   167,   168,    -1,   170,    -1,
+      -1,   173,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   187,   188,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   197,   198,   199,    -1,   201,
+      -1,    -1,   204,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,   221,
+      -1,    -1,    -1,   225,    -1,    -1,    -1,    -1,    -1,   231,
+      -1,    -1,   234,   235,   236,   237,   238,   239,   240,   241,
+     242,   243,    -1,   245,    -1,    -1,    -1,    -1,    -1,   251,
+      -1,    -1,   254,    -1,    -1,    -1,   258,    -1,    -1,   261,
+     262,    -1,   264,    -1,    -1,   267,    -1,   269,    -1,    -1,
+      -1,   273,   274,    -1,    -1,    -1,    -1,    -1,    -1,   281,
+     282,   283,   284,    -1,    -1,    -1,    -1,    -1,    -1,   291,
+      -1,    -1,    -1,   295,    -1,    -1,    -1,   299,   300,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   340,     3,   342,     5,     6,     7,     8,     9,    10,
-      11,    12,    13,    14,    15,    -1,    -1,    18,    19,    -1,
-      -1,    22,    23,    -1,    -1,    26,    27,    28,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    38,    -1,    -1,
-      41,    -1,    -1,    44,    45,    46,    47,    48,    49,    50,
-      -1,    52,    -1,    -1,    55,    56,    57,    -1,    -1,    -1,
-      -1,    62,    63,    -1,    -1,    -1,    67,    68,    69,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    79,    -1,
-      -1,    82,    -1,    -1,    85,    -1,    -1,    -1,    -1,    -1,
-      91,    -1,    -1,    -1,    -1,    96,    97,    98,    -1,    -1,
-      -1,    -1,   103,    -1,    -1,    -1,   107,    -1,    -1,   110,
-     111,    -1,   113,    -1,   115,   116,   117,    -1,    -1,    -1,
-     121,   122,   123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     131,   132,   133,   134,   135,    -1,   137,   138,   139,   140,
-     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
-     151,    -1,   153,   154,   155,   156,   157,   158,    -1,   160,
-     161,   162,    -1,    -1,    -1,    -1,    -1,   168,    -1,   170,
-      -1,   172,   173,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   189,   190,
-      -1,    -1,    -1,   194,   195,   196,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   206,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   215,   216,    -1,    -1,    -1,    -1,
-      -1,    -1,   223,    -1,    -1,    -1,   227,    -1,    -1,    -1,
-      -1,    -1,   233,    -1,    -1,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,    -1,   247,    -1,    -1,    -1,
-      -1,    -1,   253,    -1,    -1,   256,    -1,    -1,    -1,   260,
-      -1,    -1,   263,   264,    -1,   266,    -1,    -1,   269,    -1,
-     271,    -1,    -1,    -1,   275,   276,    -1,    -1,    -1,    -1,
-      -1,   282,   283,   284,   285,    -1,    -1,    -1,    -1,    -1,
-      -1,   292,    -1,    -1,    -1,   296,    -1,    -1,    -1,   300,
-     301,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   316,    -1,    -1,    -1,    -1,
-     321,   322,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   340,
-       3,   342,     5,     6,     7,     8,     9,    10,    11,    12,
-      13,    14,    15,    -1,    -1,    18,    19,    -1,    -1,    22,
-      23,    -1,    -1,    26,    27,    28,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    38,    -1,    -1,    41,    -1,
-      -1,    44,    45,    46,    47,    48,    49,    50,    -1,    52,
-      -1,    -1,    55,    56,    57,    -1,    -1,    -1,    -1,    62,
-      63,    -1,    -1,    -1,    67,    68,    69,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    79,    -1,    -1,    82,
-      -1,    -1,    85,    -1,    -1,    -1,    -1,    -1,    91,    -1,
-      -1,    -1,    -1,    96,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   107,    -1,    -1,   110,   111,    -1,
-     113,    -1,   115,   116,   117,    -1,    -1,    -1,   121,   122,
-     123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   131,   132,
-     133,   134,   135,    -1,   137,   138,   139,   140,   141,   142,
-     143,   144,   145,   146,   147,   148,   149,   150,   151,    -1,
-     153,   154,   155,   156,   157,   158,    -1,   160,   161,   162,
-      -1,    -1,    -1,    -1,    -1,   168,    -1,   170,    -1,   172,
+      -1,    -1,    -1,   315,    -1,    -1,    -1,    -1,   320,   321,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    -1,    -1,    17,    18,    -1,    -1,    21,    22,
+     342,    -1,    25,    26,    27,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    37,    -1,    -1,    40,    -1,    -1,
+      43,    44,    45,    46,    47,    48,    49,    -1,    51,    -1,
+      -1,    54,    55,    56,    -1,    -1,    -1,    -1,    61,    62,
+      -1,    -1,    -1,    66,    67,    68,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,    81,    -1,
+      -1,    84,    -1,    -1,    -1,    -1,    -1,    90,    -1,    -1,
+      -1,    -1,    95,    96,    97,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   106,    -1,    -1,   109,   110,    -1,   112,
+      -1,   114,   115,   116,    -1,    -1,    -1,   120,   121,   122,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   130,   131,   132,
+     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,   156,   157,    -1,   159,   160,   161,    -1,
+      -1,    -1,    -1,    -1,   167,   168,    -1,   170,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     183,    -1,    -1,    -1,    -1,    -1,   189,   190,    -1,    -1,
-      -1,   194,   195,   196,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   206,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   215,   216,    -1,    -1,    -1,    -1,    -1,    -1,
-     223,    -1,    -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,
-     233,    -1,    -1,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,    -1,   247,    -1,    -1,    -1,    -1,    -1,
-     253,    -1,    -1,   256,    -1,    -1,    -1,   260,    -1,    -1,
-     263,   264,    -1,   266,    -1,    -1,   269,    -1,   271,    -1,
-      -1,    -1,   275,   276,    -1,    -1,    -1,    -1,    -1,   282,
-     283,   284,   285,    -1,    -1,    -1,    -1,    -1,    -1,   292,
-      -1,    -1,    -1,   296,    -1,    -1,    -1,   300,   301,    -1,
+      -1,    -1,    -1,    -1,   187,   188,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   197,   198,   199,    -1,    -1,    -1,
+      -1,   204,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     213,   214,    -1,    -1,    -1,    -1,    -1,    -1,   221,    -1,
+      -1,    -1,   225,    -1,    -1,    -1,    -1,    -1,   231,    -1,
+      -1,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,    -1,   245,    -1,    -1,    -1,    -1,    -1,   251,    -1,
+      -1,   254,    -1,    -1,    -1,   258,    -1,    -1,   261,   262,
+      -1,   264,    -1,    -1,   267,    -1,   269,    -1,    -1,    -1,
+     273,   274,    -1,    -1,    -1,    -1,    -1,    -1,   281,   282,
+     283,   284,    -1,    -1,    -1,    -1,    -1,    -1,   291,    -1,
+      -1,    -1,   295,    -1,    -1,    -1,   299,   300,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   316,    -1,    -1,    -1,    -1,   321,   322,
-      -1,    -1,    -1,    -1,    -1,    -1,   329,    -1,    -1,    -1,
-      -1,    -1,    -1,   336,    -1,    -1,    -1,    -1,     3,   342,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    -1,    -1,    18,    19,    -1,    -1,    22,    23,    -1,
-      -1,    26,    27,    28,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    38,    -1,    -1,    41,    -1,    -1,    44,
-      45,    46,    47,    48,    49,    50,    -1,    52,    -1,    -1,
-      55,    56,    57,    -1,    -1,    -1,    -1,    62,    63,    -1,
-      -1,    -1,    67,    68,    69,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    79,    -1,    -1,    82,    -1,    -1,
-      85,    -1,    -1,    -1,    -1,    -1,    91,    -1,    -1,    -1,
-      -1,    96,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   107,    -1,    -1,   110,   111,    -1,   113,    -1,
-     115,   116,   117,    -1,    -1,    -1,   121,   122,   123,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
-     135,    -1,   137,   138,   139,   140,   141,   142,   143,   144,
-     145,   146,   147,   148,   149,   150,   151,    -1,   153,   154,
-     155,   156,   157,   158,    -1,   160,   161,   162,    -1,    -1,
-      -1,    -1,    -1,   168,    -1,   170,    -1,   172,    -1,    -1,
+      -1,    -1,   315,    -1,    -1,    -1,    -1,   320,   321,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    -1,    -1,    17,    18,    -1,    -1,    21,    22,   342,
+      -1,    25,    26,    27,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    37,    -1,    -1,    40,    -1,    -1,    43,
+      44,    45,    46,    47,    48,    49,    -1,    51,    -1,    -1,
+      54,    55,    56,    -1,    -1,    -1,    -1,    61,    62,    -1,
+      -1,    -1,    66,    67,    68,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    -1,    -1,    81,    -1,    -1,
+      84,    -1,    -1,    -1,    -1,    -1,    90,    -1,    -1,    -1,
+      -1,    95,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   106,    -1,    -1,   109,   110,    -1,   112,    -1,
+     114,   115,   116,    -1,    -1,    -1,   120,   121,   122,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   130,   131,   132,   133,
+     134,    -1,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,    -1,   152,   153,
+     154,   155,   156,   157,    -1,   159,   160,   161,    -1,    -1,
+      -1,    -1,    -1,   167,   168,    -1,   170,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   186,    -1,    -1,   189,   190,    -1,    -1,    -1,   194,
-     195,   196,    -1,    -1,    -1,    -1,    -1,    -1,   203,    -1,
-      -1,   206,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     215,   216,    -1,    -1,    -1,    -1,    -1,    -1,   223,    -1,
-      -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,   233,    -1,
-      -1,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,    -1,   247,    -1,    -1,    -1,    -1,    -1,   253,    -1,
-      -1,   256,    -1,    -1,    -1,   260,    -1,    -1,   263,   264,
-      -1,   266,    -1,    -1,   269,    -1,   271,    -1,    -1,    -1,
-     275,   276,    -1,    -1,    -1,    -1,    -1,   282,   283,   284,
-     285,    -1,    -1,    -1,    -1,    -1,    -1,   292,    -1,    -1,
-      -1,   296,    -1,    -1,    -1,   300,   301,    -1,    -1,    -1,
+      -1,    -1,    -1,   187,   188,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   197,   198,   199,    -1,    -1,    -1,    -1,
+     204,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   213,
+     214,    -1,    -1,    -1,    -1,    -1,    -1,   221,    -1,    -1,
+      -1,   225,    -1,    -1,    -1,    -1,    -1,   231,    -1,    -1,
+     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
+      -1,   245,    -1,    -1,    -1,    -1,    -1,   251,    -1,    -1,
+     254,    -1,    -1,    -1,   258,    -1,    -1,   261,   262,    -1,
+     264,    -1,    -1,   267,    -1,   269,    -1,    -1,    -1,   273,
+     274,    -1,    -1,    -1,    -1,    -1,    -1,   281,   282,   283,
+     284,    -1,    -1,    -1,    -1,    -1,    -1,   291,    -1,    -1,
+      -1,   295,    -1,    -1,    -1,   299,   300,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   316,    -1,    -1,    -1,    -1,   321,   322,    -1,     3,
-      -1,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-      14,    15,    -1,    -1,    18,    19,    -1,   342,    22,    23,
-      -1,    -1,    26,    27,    28,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    38,    -1,    -1,    41,    -1,    -1,
-      44,    45,    46,    47,    48,    49,    50,    -1,    52,    -1,
-      -1,    55,    56,    57,    -1,    -1,    -1,    -1,    62,    63,
-      -1,    -1,    -1,    67,    68,    69,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    79,    -1,    -1,    82,    -1,
-      -1,    85,    -1,    -1,    -1,    -1,    -1,    91,    -1,    -1,
-      -1,    -1,    96,    97,    98,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   107,    -1,    -1,   110,   111,    -1,   113,
-      -1,   115,   116,   117,    -1,    -1,    -1,   121,   122,   123,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,
-     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
-     144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
-     154,   155,   156,   157,   158,    -1,   160,   161,   162,    -1,
-      -1,    -1,    -1,    -1,   168,    -1,   170,    -1,   172,    -1,
+      -1,   315,    -1,    -1,    -1,    -1,   320,   321,    -1,    -1,
+      -1,    -1,    -1,    -1,   328,    -1,    -1,    -1,    -1,    -1,
+      -1,   335,    -1,    -1,    -1,    -1,    -1,    -1,   342,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    -1,    -1,    17,    18,    -1,    -1,    21,    22,    -1,
+      -1,    25,    26,    27,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    37,    -1,    -1,    40,    -1,    -1,    43,
+      44,    45,    46,    47,    48,    49,    -1,    51,    -1,    -1,
+      54,    55,    56,    -1,    -1,    -1,    -1,    61,    62,    -1,
+      -1,    -1,    66,    67,    68,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    -1,    -1,    81,    -1,    -1,
+      84,    -1,    -1,    -1,    -1,    -1,    90,    -1,    -1,    -1,
+      -1,    95,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   106,    -1,    -1,   109,   110,    -1,   112,    -1,
+     114,   115,   116,    -1,    -1,    -1,   120,   121,   122,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   130,   131,   132,   133,
+     134,    -1,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,    -1,   152,   153,
+     154,   155,   156,   157,    -1,   159,   160,   161,    -1,    -1,
+      -1,    -1,    -1,   167,   168,    -1,   170,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   189,   190,    -1,    -1,    -1,
-     194,   195,   196,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   206,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   215,   216,    -1,    -1,    -1,    -1,    -1,    -1,   223,
-      -1,    -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,   233,
-      -1,    -1,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,    -1,   247,    -1,    -1,    -1,    -1,    -1,   253,
-      -1,    -1,   256,    -1,    -1,    -1,   260,    -1,    -1,   263,
-     264,    -1,   266,    -1,    -1,   269,    -1,   271,    -1,    -1,
-      -1,   275,   276,    -1,    -1,    -1,    -1,    -1,   282,   283,
-     284,   285,    -1,    -1,    -1,    -1,    -1,    -1,   292,    -1,
-      -1,    -1,   296,    -1,    -1,    -1,   300,   301,    -1,    -1,
+      -1,    -1,    -1,   187,   188,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   197,   198,   199,    -1,    -1,    -1,    -1,
+     204,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   213,
+     214,    -1,    -1,    -1,    -1,    -1,    -1,   221,    -1,    -1,
+      -1,   225,    -1,    -1,    -1,    -1,    -1,   231,    -1,    -1,
+     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
+      -1,   245,    -1,    -1,    -1,    -1,    -1,   251,    -1,    -1,
+     254,    -1,    -1,    -1,   258,    -1,    -1,   261,   262,    -1,
+     264,    -1,    -1,   267,    -1,   269,    -1,    -1,    -1,   273,
+     274,    -1,    -1,    -1,    -1,    -1,    -1,   281,   282,   283,
+     284,    -1,    -1,    -1,    -1,    -1,    -1,   291,    -1,    -1,
+      -1,   295,    -1,    -1,    -1,   299,   300,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   316,    -1,    -1,    -1,    -1,   321,   322,    -1,
-       3,    -1,     5,     6,     7,     8,     9,    10,    11,    12,
-      13,    14,    15,    -1,    -1,    18,    19,    -1,   342,    22,
-      23,    -1,    -1,    26,    27,    28,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    38,    -1,    -1,    41,    -1,
-      -1,    44,    45,    46,    47,    48,    49,    50,    -1,    52,
-      -1,    -1,    55,    56,    57,    -1,    -1,    -1,    -1,    62,
-      63,    -1,    -1,    -1,    67,    68,    69,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    79,    -1,    -1,    82,
-      -1,    -1,    85,    -1,    -1,    -1,    -1,    -1,    91,    -1,
-      -1,    -1,    -1,    96,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   107,    -1,    -1,   110,   111,    -1,
-     113,    -1,   115,   116,   117,    -1,    -1,    -1,   121,   122,
-     123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   131,   132,
-     133,   134,   135,    -1,   137,   138,   139,   140,   141,   142,
-     143,   144,   145,   146,   147,   148,   149,   150,   151,    -1,
-     153,   154,   155,   156,   157,   158,    -1,   160,   161,   162,
-      -1,    -1,    -1,    -1,    -1,   168,    -1,   170,    -1,   172,
+      -1,   315,    -1,    -1,    -1,    -1,   320,   321,    -1,    -1,
+      -1,    -1,    -1,    -1,   328,    -1,    -1,    -1,    -1,    -1,
+      -1,   335,    -1,    -1,    -1,    -1,    -1,    -1,   342,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    -1,    -1,    17,    18,    -1,    -1,    21,    22,    -1,
+      -1,    25,    26,    27,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    37,    -1,    -1,    40,    -1,    -1,    43,
+      44,    45,    46,    47,    48,    49,    -1,    51,    -1,    -1,
+      54,    55,    56,    -1,    -1,    -1,    -1,    61,    62,    -1,
+      -1,    -1,    66,    67,    68,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    -1,    -1,    81,    -1,    -1,
+      84,    -1,    -1,    -1,    -1,    -1,    90,    -1,    -1,    -1,
+      -1,    95,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   106,    -1,    -1,   109,   110,    -1,   112,    -1,
+     114,   115,   116,    -1,    -1,    -1,   120,   121,   122,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   130,   131,   132,   133,
+     134,    -1,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,    -1,   152,   153,
+     154,   155,   156,   157,    -1,   159,   160,   161,    -1,    -1,
+      -1,    -1,    -1,   167,   168,    -1,   170,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   189,   190,    -1,    -1,
-      -1,   194,   195,   196,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   206,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   215,   216,    -1,    -1,    -1,    -1,    -1,    -1,
-     223,    -1,    -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,
-     233,    -1,    -1,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,    -1,   247,    -1,    -1,    -1,    -1,    -1,
-     253,    -1,    -1,   256,    -1,    -1,    -1,   260,    -1,    -1,
-     263,   264,    -1,   266,    -1,    -1,   269,    -1,   271,    -1,
-      -1,    -1,   275,   276,    -1,    -1,    -1,    -1,    -1,   282,
-     283,   284,   285,    -1,    -1,    -1,    -1,    -1,    -1,   292,
-      -1,    -1,    -1,   296,    -1,    -1,    -1,   300,   301,    -1,
+      -1,    -1,    -1,   187,   188,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   197,   198,   199,    -1,    -1,    -1,    -1,
+     204,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   213,
+     214,    -1,    -1,    -1,    -1,    -1,    -1,   221,    -1,    -1,
+      -1,   225,    -1,    -1,    -1,    -1,    -1,   231,    -1,    -1,
+     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
+      -1,   245,    -1,    -1,    -1,    -1,    -1,   251,    -1,    -1,
+     254,    -1,    -1,    -1,   258,    -1,    -1,   261,   262,    -1,
+     264,    -1,    -1,   267,    -1,   269,    -1,    -1,    -1,   273,
+     274,    -1,    -1,    -1,    -1,    -1,    -1,   281,   282,   283,
+     284,    -1,    -1,    -1,    -1,    -1,    -1,   291,    -1,    -1,
+      -1,   295,   296,    -1,    -1,   299,   300,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   316,    -1,    -1,    -1,    -1,   321,   322,
-      -1,    -1,    -1,    -1,    -1,    -1,   329,    -1,    -1,    -1,
-      -1,    -1,    -1,   336,    -1,    -1,    -1,    -1,     3,   342,
+      -1,   315,    -1,    -1,    -1,    -1,   320,   321,     3,     4,
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    -1,    -1,    18,    19,    -1,    -1,    22,    23,    -1,
-      -1,    26,    27,    28,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    38,    -1,    -1,    41,    -1,    -1,    44,
-      45,    46,    47,    48,    49,    50,    -1,    52,    -1,    -1,
-      55,    56,    57,    -1,    -1,    -1,    -1,    62,    63,    -1,
-      -1,    -1,    67,    68,    69,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    79,    -1,    -1,    82,    -1,    -1,
-      85,    -1,    -1,    -1,    -1,    -1,    91,    -1,    -1,    -1,
-      -1,    96,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   107,    -1,    -1,   110,   111,    -1,   113,    -1,
-     115,   116,   117,    -1,    -1,    -1,   121,   122,   123,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
-     135,    -1,   137,   138,   139,   140,   141,   142,   143,   144,
-     145,   146,   147,   148,   149,   150,   151,    -1,   153,   154,
-     155,   156,   157,   158,    -1,   160,   161,   162,    -1,    -1,
-      -1,    -1,    -1,   168,    -1,   170,    -1,   172,    -1,    -1,
+      -1,    -1,    17,    18,    -1,    -1,    21,    22,   342,    -1,
+      25,    26,    27,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    37,    -1,    -1,    40,    -1,    -1,    43,    44,
+      45,    46,    47,    48,    49,    -1,    51,    -1,    -1,    54,
+      55,    56,    -1,    -1,    -1,    -1,    61,    62,    -1,    -1,
+      -1,    66,    67,    68,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    78,    -1,    -1,    81,    -1,    -1,    84,
+      -1,    -1,    -1,    -1,    -1,    90,    -1,    -1,    -1,    -1,
+      95,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   106,    -1,    -1,   109,   110,    -1,   112,    -1,   114,
+     115,   116,    -1,    -1,    -1,   120,   121,   122,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   130,   131,   132,   133,   134,
+      -1,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,    -1,   152,   153,   154,
+     155,   156,   157,    -1,   159,   160,   161,    -1,    -1,    -1,
+      -1,    -1,   167,   168,   169,   170,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   189,   190,    -1,    -1,    -1,   194,
-     195,   196,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   206,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     215,   216,    -1,    -1,    -1,    -1,    -1,    -1,   223,    -1,
-      -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,   233,    -1,
-      -1,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,    -1,   247,    -1,    -1,    -1,    -1,    -1,   253,    -1,
-      -1,   256,    -1,    -1,    -1,   260,    -1,    -1,   263,   264,
-      -1,   266,    -1,    -1,   269,    -1,   271,    -1,    -1,    -1,
-     275,   276,    -1,    -1,    -1,    -1,    -1,   282,   283,   284,
-     285,    -1,    -1,    -1,    -1,    -1,    -1,   292,    -1,    -1,
-      -1,   296,    -1,    -1,    -1,   300,   301,    -1,    -1,    -1,
+      -1,    -1,   187,   188,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   197,   198,   199,    -1,    -1,    -1,    -1,   204,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   213,   214,
+      -1,    -1,    -1,    -1,    -1,    -1,   221,    -1,    -1,    -1,
+     225,    -1,    -1,    -1,    -1,    -1,   231,    -1,    -1,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,    -1,
+     245,    -1,    -1,    -1,    -1,    -1,   251,    -1,    -1,   254,
+      -1,    -1,    -1,   258,    -1,    -1,   261,   262,    -1,   264,
+      -1,    -1,   267,    -1,   269,    -1,    -1,    -1,   273,   274,
+      -1,    -1,    -1,    -1,    -1,    -1,   281,   282,   283,   284,
+      -1,    -1,    -1,    -1,    -1,    -1,   291,    -1,    -1,    -1,
+     295,    -1,    -1,    -1,   299,   300,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   316,    -1,    -1,    -1,    -1,   321,   322,    -1,    -1,
-      -1,    -1,    -1,    -1,   329,    -1,    -1,    -1,    -1,    -1,
-      -1,   336,    -1,    -1,    -1,    -1,     3,   342,     5,     6,
-       7,     8,     9,    10,    11,    12,    13,    14,    15,    -1,
-      -1,    18,    19,    -1,    -1,    22,    23,    -1,    -1,    26,
-      27,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    38,    -1,    -1,    41,    -1,    -1,    44,    45,    46,
-      47,    48,    49,    50,    -1,    52,    -1,    -1,    55,    56,
-      57,    -1,    -1,    -1,    -1,    62,    63,    -1,    -1,    -1,
-      67,    68,    69,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    79,    -1,    -1,    82,    -1,    -1,    85,    -1,
-      -1,    -1,    -1,    -1,    91,    -1,    -1,    -1,    -1,    96,
-      97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     107,    -1,    -1,   110,   111,    -1,   113,    -1,   115,   116,
-     117,    -1,    -1,    -1,   121,   122,   123,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,    -1,
+     315,    -1,    -1,    -1,    -1,   320,   321,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    -1,
+      -1,    17,    18,    -1,    -1,    21,    22,   342,    -1,    25,
+      26,    27,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    37,    -1,    -1,    40,    -1,    -1,    43,    44,    45,
+      46,    47,    48,    49,    -1,    51,    -1,    -1,    54,    55,
+      56,    -1,    -1,    -1,    -1,    61,    62,    -1,    -1,    -1,
+      66,    67,    68,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    78,    -1,    -1,    81,    -1,    -1,    84,    -1,
+      -1,    -1,    -1,    -1,    90,    -1,    -1,    -1,    -1,    95,
+      96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     106,    -1,    -1,   109,   110,    -1,   112,    -1,   114,   115,
+     116,    -1,    -1,    -1,   120,   121,   122,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   130,   131,   132,   133,   134,    -1,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,    -1,   152,   153,   154,   155,
+     156,   157,    -1,   159,   160,   161,    -1,    -1,    -1,    -1,
+      -1,   167,   168,    -1,   170,    -1,   172,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   187,   188,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   197,   198,   199,    -1,    -1,    -1,    -1,   204,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   213,   214,    -1,
+      -1,    -1,    -1,    -1,    -1,   221,    -1,    -1,    -1,   225,
+      -1,    -1,    -1,    -1,    -1,   231,    -1,    -1,   234,   235,
+     236,   237,   238,   239,   240,   241,   242,   243,    -1,   245,
+      -1,    -1,    -1,    -1,    -1,   251,    -1,    -1,   254,    -1,
+      -1,    -1,   258,    -1,    -1,   261,   262,    -1,   264,    -1,
+      -1,   267,    -1,   269,    -1,    -1,    -1,   273,   274,    -1,
+      -1,    -1,    -1,    -1,    -1,   281,   282,   283,   284,    -1,
+      -1,    -1,    -1,    -1,    -1,   291,    -1,    -1,    -1,   295,
+      -1,    -1,    -1,   299,   300,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   315,
+      -1,    -1,    -1,    -1,   320,   321,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    -1,    -1,
+      17,    18,    -1,    -1,    21,    22,   342,    -1,    25,    26,
+      27,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      37,    -1,    -1,    40,    -1,    -1,    43,    44,    45,    46,
+      47,    48,    49,    -1,    51,    -1,    -1,    54,    55,    56,
+      -1,    -1,    -1,    -1,    61,    62,    -1,    -1,    65,    66,
+      67,    68,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    78,    -1,    -1,    81,    -1,    -1,    84,    -1,    -1,
+      -1,    -1,    -1,    90,    -1,    -1,    -1,    -1,    95,    96,
+      97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,
+      -1,    -1,   109,   110,    -1,   112,    -1,   114,   115,   116,
+      -1,    -1,    -1,   120,   121,   122,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   130,   131,   132,   133,   134,    -1,   136,
      137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
-     147,   148,   149,   150,   151,    -1,   153,   154,   155,   156,
-     157,   158,    -1,   160,   161,   162,    -1,    -1,    -1,    -1,
-      -1,   168,    -1,   170,    -1,   172,    -1,    -1,    -1,    -1,
+     147,   148,   149,   150,    -1,   152,   153,   154,   155,   156,
+     157,    -1,   159,   160,   161,    -1,    -1,    -1,    -1,    -1,
+     167,   168,    -1,   170,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   189,   190,    -1,    -1,    -1,   194,   195,   196,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   206,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   215,   216,
-      -1,    -1,    -1,    -1,    -1,    -1,   223,    -1,    -1,    -1,
-     227,    -1,    -1,    -1,    -1,    -1,   233,    -1,    -1,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,    -1,
-     247,    -1,    -1,    -1,    -1,    -1,   253,    -1,    -1,   256,
-      -1,    -1,    -1,   260,    -1,    -1,   263,   264,    -1,   266,
-      -1,    -1,   269,    -1,   271,    -1,    -1,    -1,   275,   276,
-      -1,    -1,    -1,    -1,    -1,   282,   283,   284,   285,    -1,
-      -1,    -1,    -1,    -1,    -1,   292,    -1,    -1,    -1,   296,
-     297,    -1,    -1,   300,   301,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   316,
-      -1,    -1,    -1,    -1,   321,   322,    -1,     3,    -1,     5,
-       6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
-      -1,    -1,    18,    19,    -1,   342,    22,    23,    -1,    -1,
-      26,    27,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    38,    -1,    -1,    41,    -1,    -1,    44,    45,
-      46,    47,    48,    49,    50,    -1,    52,    -1,    -1,    55,
-      56,    57,    -1,    -1,    -1,    -1,    62,    63,    -1,    -1,
-      -1,    67,    68,    69,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    79,    -1,    -1,    82,    -1,    -1,    85,
-      -1,    -1,    -1,    -1,    -1,    91,    -1,    -1,    -1,    -1,
-      96,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   107,    -1,    -1,   110,   111,    -1,   113,    -1,   115,
-     116,   117,    -1,    -1,    -1,   121,   122,   123,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,
-      -1,   137,   138,   139,   140,   141,   142,   143,   144,   145,
-     146,   147,   148,   149,   150,   151,    -1,   153,   154,   155,
-     156,   157,   158,    -1,   160,   161,   162,    -1,    -1,    -1,
-      -1,    -1,   168,    -1,   170,   171,   172,    -1,    -1,    -1,
+     187,   188,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     197,   198,   199,    -1,    -1,    -1,    -1,   204,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   213,   214,    -1,    -1,
+      -1,    -1,    -1,    -1,   221,    -1,    -1,    -1,   225,    -1,
+      -1,    -1,    -1,    -1,   231,    -1,    -1,   234,   235,   236,
+     237,   238,   239,   240,   241,   242,   243,    -1,   245,    -1,
+      -1,    -1,    -1,    -1,   251,    -1,    -1,   254,    -1,    -1,
+      -1,   258,    -1,    -1,   261,   262,    -1,   264,    -1,    -1,
+     267,    -1,   269,    -1,    -1,    -1,   273,   274,    -1,    -1,
+      -1,    -1,    -1,    -1,   281,   282,   283,   284,    -1,    -1,
+      -1,    -1,    -1,    -1,   291,    -1,    -1,    -1,   295,    -1,
+      -1,    -1,   299,   300,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   315,    -1,
+      -1,    -1,    -1,   320,   321,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    -1,    -1,    17,
+      18,    -1,    -1,    21,    22,   342,    -1,    25,    26,    27,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,
+      -1,    -1,    40,    -1,    -1,    43,    44,    45,    46,    47,
+      48,    49,    -1,    51,    -1,    -1,    54,    55,    56,    -1,
+      -1,    -1,    -1,    61,    62,    -1,    -1,    -1,    66,    67,
+      68,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      78,    -1,    -1,    81,    -1,    -1,    84,    -1,    -1,    -1,
+      -1,    -1,    90,    -1,    -1,    -1,    -1,    95,    96,    97,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,
+      -1,   109,   110,    -1,   112,    -1,   114,   115,   116,    -1,
+      -1,    -1,   120,   121,   122,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   130,   131,   132,   133,   134,    -1,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,    -1,   152,   153,   154,   155,   156,   157,
+      -1,   159,   160,   161,    -1,    -1,    -1,    -1,    -1,   167,
+     168,    -1,   170,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   187,
+     188,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   197,
+     198,   199,    -1,    -1,    -1,    -1,   204,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   213,   214,    -1,    -1,    -1,
+      -1,    -1,    -1,   221,    -1,    -1,    -1,   225,    -1,    -1,
+      -1,    -1,    -1,   231,    -1,    -1,   234,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,   244,   245,    -1,    -1,
+      -1,    -1,    -1,   251,    -1,    -1,   254,    -1,    -1,    -1,
+     258,    -1,    -1,   261,   262,    -1,   264,    -1,    -1,   267,
+      -1,   269,    -1,    -1,    -1,   273,   274,    -1,    -1,    -1,
+      -1,    -1,    -1,   281,   282,   283,   284,    -1,    -1,    -1,
+      -1,    -1,    -1,   291,    -1,    -1,    -1,   295,    -1,    -1,
+      -1,   299,   300,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   315,    -1,    -1,
+      -1,    -1,   320,   321,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    17,    18,
+      -1,    -1,    21,    22,   342,    -1,    25,    26,    27,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,    -1,
+      -1,    40,    -1,    -1,    43,    44,    45,    46,    47,    48,
+      49,    -1,    51,    -1,    -1,    54,    55,    56,    -1,    -1,
+      -1,    -1,    61,    62,    -1,    -1,    -1,    66,    67,    68,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,
+      -1,    -1,    81,    -1,    -1,    84,    -1,    -1,    -1,    -1,
+      -1,    90,    -1,    -1,    -1,    -1,    95,    96,    97,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,    -1,
+     109,   110,    -1,   112,    -1,   114,   115,   116,    -1,    -1,
+      -1,   120,   121,   122,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   130,   131,   132,   133,   134,    -1,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,    -1,   152,   153,   154,   155,   156,   157,    -1,
+     159,   160,   161,    -1,    -1,    -1,    -1,    -1,   167,   168,
+      -1,   170,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   187,   188,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   197,   198,
+     199,    -1,    -1,    -1,    -1,   204,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   213,   214,    -1,    -1,    -1,    -1,
+      -1,    -1,   221,    -1,    -1,    -1,   225,    -1,    -1,    -1,
+      -1,    -1,   231,    -1,    -1,   234,   235,   236,   237,   238,
+     239,   240,   241,   242,   243,    -1,   245,    -1,    -1,    -1,
+      -1,    -1,   251,    -1,    -1,   254,    -1,    -1,    -1,   258,
+      -1,    -1,   261,   262,    -1,   264,    -1,    -1,   267,    -1,
+     269,    -1,    -1,    -1,   273,   274,    -1,    -1,    -1,    -1,
+      -1,    -1,   281,   282,   283,   284,    -1,    -1,    -1,    -1,
+      -1,    -1,   291,    -1,    -1,    -1,   295,   296,    -1,    -1,
+     299,   300,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   315,    -1,    -1,    -1,
+      -1,   320,   321,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    -1,    -1,    17,    18,    -1,
+      -1,    21,    22,   342,    -1,    25,    26,    27,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,
+      40,    -1,    -1,    43,    44,    45,    46,    47,    48,    49,
+      -1,    51,    -1,    -1,    54,    55,    56,    -1,    -1,    -1,
+      -1,    61,    62,    -1,    -1,    -1,    66,    67,    68,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,
+      -1,    81,    -1,    -1,    84,    -1,    -1,    -1,    -1,    -1,
+      90,    -1,    -1,    -1,    -1,    95,    96,    97,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,    -1,   109,
+     110,    -1,   112,    -1,   114,   115,   116,    -1,    -1,    -1,
+     120,   121,   122,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,    -1,   152,   153,   154,   155,   156,   157,    -1,   159,
+     160,   161,    -1,    -1,    -1,    -1,    -1,   167,   168,    -1,
+     170,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   187,   188,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   197,   198,   199,
+      -1,    -1,    -1,    -1,   204,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   213,   214,    -1,    -1,    -1,    -1,    -1,
+      -1,   221,    -1,    -1,    -1,   225,    -1,    -1,    -1,    -1,
+      -1,   231,    -1,    -1,   234,   235,   236,   237,   238,   239,
+     240,   241,   242,   243,    -1,   245,    -1,    -1,    -1,    -1,
+      -1,   251,    -1,    -1,   254,    -1,    -1,    -1,   258,    -1,
+      -1,   261,   262,    -1,   264,    -1,    -1,   267,    -1,   269,
+      -1,    -1,    -1,   273,   274,    -1,    -1,    -1,    -1,    -1,
+      -1,   281,   282,   283,   284,    -1,    -1,    -1,    -1,    -1,
+      -1,   291,    -1,    -1,    -1,   295,    -1,    -1,    -1,   299,
+     300,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   315,    -1,    -1,    -1,    -1,
+     320,   321,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    -1,    -1,    17,    18,    -1,    -1,
+      21,    22,   342,    -1,    25,    26,    27,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,    40,
+      -1,    -1,    43,    44,    45,    46,    47,    48,    49,    -1,
+      51,    -1,    -1,    54,    55,    56,    -1,    -1,    -1,    -1,
+      61,    62,    -1,    -1,    -1,    66,    67,    68,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,
+      81,    -1,    -1,    84,    -1,    -1,    -1,    -1,    -1,    90,
+      -1,    -1,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   106,    -1,    -1,   109,   110,
+      -1,   112,    -1,   114,   115,   116,    -1,    -1,    -1,   120,
+     121,   122,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   130,
+     131,   132,   133,   134,    -1,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,   152,   153,   154,   155,   156,   157,    -1,   159,   160,
+     161,    -1,    -1,    -1,    -1,    -1,   167,   168,    -1,   170,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   189,   190,    -1,    -1,    -1,   194,   195,
-     196,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     206,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   215,
-     216,    -1,    -1,    -1,    -1,    -1,    -1,   223,    -1,    -1,
-      -1,   227,    -1,    -1,    -1,    -1,    -1,   233,    -1,    -1,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-      -1,   247,    -1,    -1,    -1,    -1,    -1,   253,    -1,    -1,
-     256,    -1,    -1,    -1,   260,    -1,    -1,   263,   264,    -1,
-     266,    -1,    -1,   269,    -1,   271,    -1,    -1,    -1,   275,
-     276,    -1,    -1,    -1,    -1,    -1,   282,   283,   284,   285,
-      -1,    -1,    -1,    -1,    -1,    -1,   292,    -1,    -1,    -1,
-     296,    -1,    -1,    -1,   300,   301,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   187,   188,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   197,   198,   199,    -1,
+      -1,    -1,    -1,   204,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,
+     221,    -1,    -1,    -1,   225,    -1,    -1,    -1,    -1,    -1,
+     231,    -1,    -1,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,    -1,   245,    -1,    -1,    -1,    -1,    -1,
+     251,    -1,    -1,   254,    -1,    -1,    -1,   258,    -1,    -1,
+     261,   262,    -1,   264,    -1,    -1,   267,    -1,   269,    -1,
+      -1,    -1,   273,   274,     4,     5,     6,     7,     8,     9,
+     281,   282,   283,   284,    -1,    -1,    -1,    -1,    -1,    -1,
+     291,    21,    22,    -1,   295,    25,    -1,    -1,   299,   300,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,
+      40,    -1,    -1,    -1,   315,    -1,    -1,    -1,    -1,   320,
+     321,    51,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    62,    -1,    -1,    65,    66,    67,    68,    -1,
+      -1,   342,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,
+      -1,    81,    -1,    -1,    84,    -1,    -1,    -1,    -1,    -1,
+      90,    -1,    -1,    -1,    -1,    95,    96,    97,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   109,
+      -1,    -1,   112,    -1,   114,   115,   116,    -1,    -1,    -1,
+      -1,   121,   122,    -1,    -1,    -1,    -1,    -1,   130,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   138,   139,
+      -1,    -1,   142,    -1,   144,   145,   146,   147,   148,   149,
+     150,    -1,   152,    -1,   154,   155,   156,   157,    -1,   159,
+      -1,   161,    -1,    63,    64,    65,    66,   167,   168,    -1,
+     170,    -1,    -1,    -1,    -1,    75,    76,    77,    78,    -1,
+      -1,    -1,    -1,    -1,    84,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,    -1,    -1,    -1,    -1,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+     212,    -1,    -1,   213,   214,    -1,    -1,    -1,    -1,    -1,
+      -1,   221,    -1,    -1,    -1,   225,    -1,    -1,    -1,    -1,
+      -1,   231,    -1,    -1,   234,   235,   236,   237,   238,   239,
+     240,   241,   242,   243,    -1,   245,    -1,    -1,    -1,    -1,
+      -1,   251,    -1,    -1,   254,   257,    -1,    -1,   258,    -1,
+      -1,   261,   262,    -1,   264,    -1,    -1,   267,   168,   269,
+      -1,    -1,    -1,   273,   274,    -1,    -1,   277,    -1,    -1,
+     280,   281,   282,   283,   284,    -1,    -1,    -1,    -1,    -1,
+      -1,   291,     4,     5,     6,     7,     8,     9,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    21,
+      22,    -1,    -1,    25,    -1,   315,    -1,    -1,    -1,    -1,
+     320,   321,    -1,    -1,   224,    37,    -1,    -1,    40,    -1,
+      -1,    -1,   232,   233,    -1,   235,    -1,    -1,    -1,    51,
+     340,    -1,    -1,    -1,    -1,    -1,   246,    -1,    -1,    -1,
+      62,    -1,   252,   253,    66,    67,    68,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,   268,    81,
+      -1,   271,    84,    -1,    -1,    -1,    -1,    -1,    90,    -1,
+     280,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   109,    -1,    -1,
+     112,    -1,   114,   115,   116,    -1,   130,    -1,   308,   121,
+     122,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   138,   139,    -1,    -1,
+     142,    -1,   144,   145,   146,   147,   148,   149,   150,    -1,
+     152,    -1,   154,   155,   156,   157,    -1,   159,    -1,   161,
+      -1,    -1,    -1,    -1,    -1,   167,   168,    -1,   170,    -1,
+      -1,    -1,    -1,   187,   188,   189,   190,   191,   192,   193,
+     194,   195,   196,    -1,    -1,    -1,    -1,   201,   202,   203,
+     204,   205,   206,   207,   208,   209,   210,   211,   212,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     316,    -1,    -1,    -1,    -1,   321,   322,    -1,     3,    -1,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    -1,    -1,    18,    19,    -1,   342,    22,    23,    -1,
-      -1,    26,    27,    28,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    38,    -1,    -1,    41,    -1,    -1,    44,
-      45,    46,    47,    48,    49,    50,    -1,    52,    -1,    -1,
-      55,    56,    57,    -1,    -1,    -1,    -1,    62,    63,    -1,
-      -1,    -1,    67,    68,    69,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    79,    -1,    -1,    82,    -1,    -1,
-      85,    -1,    -1,    -1,    -1,    -1,    91,    -1,    -1,    -1,
-      -1,    96,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   107,    -1,    -1,   110,   111,    -1,   113,    -1,
-     115,   116,   117,    -1,    -1,    -1,   121,   122,   123,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
-     135,    -1,   137,   138,   139,   140,   141,   142,   143,   144,
-     145,   146,   147,   148,   149,   150,   151,    -1,   153,   154,
-     155,   156,   157,   158,    -1,   160,   161,   162,    -1,    -1,
-      -1,    -1,    -1,   168,    -1,   170,    -1,   172,    -1,   174,
+      -1,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,   221,
+      -1,    -1,    -1,   225,    -1,    -1,    -1,    -1,    -1,   231,
+      -1,    -1,   234,   235,   236,   237,   238,   239,   240,   241,
+     242,   243,    -1,   245,    -1,    -1,    -1,    -1,    -1,   251,
+      -1,    -1,   254,    -1,    -1,    -1,   258,    -1,    -1,   261,
+     262,    -1,   264,    -1,    -1,   267,    -1,   269,    -1,    -1,
+      -1,   273,   274,     4,     5,     6,     7,     8,     9,   281,
+     282,   283,   284,   297,    -1,    -1,    -1,    -1,    -1,   291,
+      21,    22,    -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,    40,
+      -1,    -1,    -1,   315,    -1,    -1,    -1,    -1,   320,   321,
+      51,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    62,    63,    64,    65,    66,    -1,    -1,   340,    -1,
+      -1,    -1,    -1,    -1,    75,    76,    77,    78,    -1,    -1,
+      81,    -1,    -1,    84,    -1,    -1,    -1,    -1,    -1,    90,
+      -1,    -1,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   109,    -1,
+      -1,   112,    -1,   114,   115,   116,    -1,   130,    -1,    -1,
+     121,   122,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   138,   139,    -1,
+      -1,   142,    -1,   144,   145,   146,   147,   148,   149,   150,
+      -1,   152,    -1,   154,   155,   156,   157,    -1,   159,    -1,
+     161,    -1,    -1,    -1,    -1,    -1,   167,    -1,    -1,   170,
+      -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,   192,
+     193,   194,   195,   196,    -1,    -1,    -1,    -1,   201,   202,
+     203,   204,   205,   206,   207,   208,   209,   210,   211,   212,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   189,   190,    -1,    -1,    -1,   194,
-     195,   196,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   206,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     215,   216,    -1,    -1,    -1,    -1,    -1,    -1,   223,    -1,
-      -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,   233,    -1,
-      -1,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,    -1,   247,    -1,    -1,    -1,    -1,    -1,   253,    -1,
-      -1,   256,    -1,    -1,    -1,   260,    -1,    -1,   263,   264,
-      -1,   266,    -1,    -1,   269,    -1,   271,    -1,    -1,    -1,
-     275,   276,    -1,    -1,    -1,    -1,    -1,   282,   283,   284,
-     285,    -1,    -1,    -1,    -1,    -1,    -1,   292,    -1,    -1,
-      -1,   296,    -1,    -1,    -1,   300,   301,    -1,    -1,    -1,
+      -1,    -1,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,
+     221,    -1,    -1,   224,   225,    -1,    -1,    -1,    -1,    -1,
+     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,    -1,   245,   246,    -1,    -1,    -1,    -1,
+     251,   252,   253,   254,    -1,    -1,    -1,   258,    -1,    -1,
+     261,   262,    -1,   264,    -1,    -1,   267,   268,   269,   270,
+     271,    -1,   273,   274,    -1,    -1,    -1,    -1,    -1,    -1,
+     281,   282,   283,   284,   297,    -1,    -1,    -1,    -1,    -1,
+     291,    -1,    -1,    -1,   295,    -1,    -1,   298,    -1,    -1,
+     301,   302,   303,    -1,    -1,    -1,    -1,   308,     4,     5,
+       6,     7,     8,     9,   315,    -1,    -1,    -1,    -1,   320,
+     321,    -1,    -1,    -1,    -1,    21,    22,    -1,    -1,    25,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   316,    -1,    -1,    -1,    -1,   321,   322,    -1,     3,
-      -1,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-      14,    15,    -1,    -1,    18,    19,    -1,   342,    22,    23,
-      -1,    -1,    26,    27,    28,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    38,    -1,    -1,    41,    -1,    -1,
-      44,    45,    46,    47,    48,    49,    50,    -1,    52,    -1,
-      -1,    55,    56,    57,    -1,    -1,    -1,    -1,    62,    63,
-      -1,    -1,    66,    67,    68,    69,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    79,    -1,    -1,    82,    -1,
-      -1,    85,    -1,    -1,    -1,    -1,    -1,    91,    -1,    -1,
-      -1,    -1,    96,    97,    98,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   107,    -1,    -1,   110,   111,    -1,   113,
-      -1,   115,   116,   117,    -1,    -1,    -1,   121,   122,   123,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,
-     134,   135,    -1,   137,   138,   139,   140,   141,   142,   143,
-     144,   145,   146,   147,   148,   149,   150,   151,    -1,   153,
-     154,   155,   156,   157,   158,    -1,   160,   161,   162,    -1,
-      -1,    -1,    -1,    -1,   168,    -1,   170,    -1,   172,    -1,
+      -1,    37,    -1,    -1,    40,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    51,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    62,    63,    64,    65,
+      66,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    75,
+      76,    77,    78,    -1,    -1,    81,    -1,    -1,    84,    -1,
+      -1,    -1,    -1,    -1,    90,    -1,    -1,    -1,    -1,    95,
+      96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   109,    -1,    -1,   112,    -1,   114,   115,
+     116,    -1,    -1,   130,    -1,   121,   122,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   189,   190,    -1,    -1,    -1,
-     194,   195,   196,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   206,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   215,   216,    -1,    -1,    -1,    -1,    -1,    -1,   223,
-      -1,    -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,   233,
-      -1,    -1,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,    -1,   247,    -1,    -1,    -1,    -1,    -1,   253,
-      -1,    -1,   256,    -1,    -1,    -1,   260,    -1,    -1,   263,
-     264,    -1,   266,    -1,    -1,   269,    -1,   271,    -1,    -1,
-      -1,   275,   276,    -1,    -1,    -1,    -1,    -1,   282,   283,
-     284,   285,    -1,    -1,    -1,    -1,    -1,    -1,   292,    -1,
-      -1,    -1,   296,    -1,    -1,    -1,   300,   301,    -1,    -1,
+      -1,    -1,   138,   139,    -1,    -1,   142,    -1,   144,   145,
+     146,   147,   148,   149,   150,    -1,   152,    -1,   154,   155,
+     156,   157,    -1,   159,    -1,   161,    -1,    -1,    -1,    -1,
+      -1,   167,    -1,    -1,   170,    -1,    -1,    -1,    -1,    -1,
+     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
+      -1,    -1,    -1,    -1,   201,   202,   203,   204,   205,   206,
+     207,   208,   209,   210,   211,   212,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   213,   214,    -1,
+      -1,    -1,    -1,    -1,    -1,   221,    -1,    -1,   224,   225,
+      -1,    -1,    -1,    -1,   230,   231,   232,   233,   234,   235,
+     236,   237,   238,   239,   240,   241,   242,   243,    -1,   245,
+     246,    -1,    -1,    -1,    -1,   251,   252,   253,   254,    -1,
+      -1,    -1,   258,    -1,    -1,   261,   262,    -1,   264,    -1,
+      -1,   267,   268,   269,   270,   271,    -1,   273,   274,    -1,
+      -1,    -1,    -1,    -1,    -1,   281,   282,   283,   284,   296,
+      -1,    -1,    -1,    -1,    -1,   291,    -1,    -1,    -1,   295,
+      -1,    -1,    -1,    -1,    -1,   301,    -1,    -1,    -1,    -1,
+     306,    -1,   308,     4,     5,     6,     7,     8,     9,   315,
+      -1,    -1,    -1,    -1,   320,   321,    -1,    -1,    -1,    -1,
+      21,    22,    -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,    40,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   316,    -1,    -1,    -1,    -1,   321,   322,    -1,
-       3,    -1,     5,     6,     7,     8,     9,    10,    11,    12,
-      13,    14,    15,    -1,    -1,    18,    19,    -1,   342,    22,
-      23,    -1,    -1,    26,    27,    28,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    38,    -1,    -1,    41,    -1,
-      -1,    44,    45,    46,    47,    48,    49,    50,    -1,    52,
-      -1,    -1,    55,    56,    57,    -1,    -1,    -1,    -1,    62,
-      63,    -1,    -1,    -1,    67,    68,    69,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    79,    -1,    -1,    82,
-      -1,    -1,    85,    -1,    -1,    -1,    -1,    -1,    91,    -1,
-      -1,    -1,    -1,    96,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   107,    -1,    -1,   110,   111,    -1,
-     113,    -1,   115,   116,   117,    -1,    -1,    -1,   121,   122,
-     123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   131,   132,
-     133,   134,   135,    -1,   137,   138,   139,   140,   141,   142,
-     143,   144,   145,   146,   147,   148,   149,   150,   151,    -1,
-     153,   154,   155,   156,   157,   158,    -1,   160,   161,   162,
-      -1,    -1,    -1,    -1,    -1,   168,    -1,   170,    -1,   172,
+      51,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    62,    63,    64,    65,    66,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    75,    76,    77,    78,    -1,    -1,
+      81,    -1,    -1,    84,    -1,    -1,    -1,    -1,    -1,    90,
+      -1,    -1,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   109,    -1,
+      -1,   112,    -1,   114,   115,   116,    -1,    -1,   130,    -1,
+     121,   122,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   138,   139,    -1,
+      -1,   142,    -1,   144,   145,   146,   147,   148,   149,   150,
+      -1,   152,    -1,   154,   155,   156,   157,    -1,   159,    -1,
+     161,    -1,    -1,    -1,    -1,    -1,   167,    -1,    -1,   170,
+      -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,    -1,    -1,    -1,    -1,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+     212,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,
+     221,    -1,    -1,   224,   225,    -1,    -1,    -1,    -1,   230,
+     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,    -1,   245,   246,    -1,    -1,    -1,    -1,
+     251,   252,   253,   254,    -1,    -1,    -1,   258,    -1,    -1,
+     261,   262,    -1,   264,    -1,    -1,   267,   268,   269,   270,
+     271,    -1,   273,   274,    -1,    -1,    -1,    -1,    -1,    -1,
+     281,   282,   283,   284,   296,    -1,    -1,    -1,    -1,    -1,
+     291,    -1,    -1,    -1,   295,    -1,    -1,    -1,    -1,    -1,
+     301,    -1,    -1,    -1,    -1,   306,    -1,   308,     4,     5,
+       6,     7,     8,     9,   315,    -1,    -1,    -1,    -1,   320,
+     321,    -1,    -1,    -1,    -1,    21,    22,    -1,    -1,    25,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   189,   190,    -1,    -1,
-      -1,   194,   195,   196,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   206,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   215,   216,    -1,    -1,    -1,    -1,    -1,    -1,
-     223,    -1,    -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,
-     233,    -1,    -1,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,   246,   247,    -1,    -1,    -1,    -1,    -1,
-     253,    -1,    -1,   256,    -1,    -1,    -1,   260,    -1,    -1,
-     263,   264,    -1,   266,    -1,    -1,   269,    -1,   271,    -1,
-      -1,    -1,   275,   276,    -1,    -1,    -1,    -1,    -1,   282,
-     283,   284,   285,    -1,    -1,    -1,    -1,    -1,    -1,   292,
-      -1,    -1,    -1,   296,    -1,    -1,    -1,   300,   301,    -1,
+      -1,    37,    -1,    -1,    40,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    51,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    62,    63,    64,    65,
+      66,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    75,
+      76,    77,    78,    -1,    -1,    81,    -1,    -1,    84,    -1,
+      -1,    -1,    -1,    -1,    90,   103,    -1,    -1,    -1,    95,
+      96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   109,    -1,    -1,   112,    -1,   114,   115,
+     116,    -1,   130,    -1,    -1,   121,   122,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   316,    -1,    -1,    -1,    -1,   321,   322,
-      -1,     3,    -1,     5,     6,     7,     8,     9,    10,    11,
-      12,    13,    14,    15,    -1,    -1,    18,    19,    -1,   342,
-      22,    23,    -1,    -1,    26,    27,    28,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    38,    -1,    -1,    41,
-      -1,    -1,    44,    45,    46,    47,    48,    49,    50,    -1,
-      52,    -1,    -1,    55,    56,    57,    -1,    -1,    -1,    -1,
-      62,    63,    -1,    -1,    -1,    67,    68,    69,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    79,    -1,    -1,
-      82,    -1,    -1,    85,    -1,    -1,    -1,    -1,    -1,    91,
-      -1,    -1,    -1,    -1,    96,    97,    98,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   107,    -1,    -1,   110,   111,
-      -1,   113,    -1,   115,   116,   117,    -1,    -1,    -1,   121,
-     122,   123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   131,
-     132,   133,   134,   135,    -1,   137,   138,   139,   140,   141,
-     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
-      -1,   153,   154,   155,   156,   157,   158,    -1,   160,   161,
-     162,    -1,    -1,    -1,    -1,    -1,   168,    -1,   170,    -1,
-     172,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   189,   190,    -1,
-      -1,    -1,   194,   195,   196,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   206,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   215,   216,    -1,    -1,    -1,    -1,    -1,
-      -1,   223,    -1,    -1,    -1,   227,    -1,    -1,    -1,    -1,
-      -1,   233,    -1,    -1,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,    -1,   247,    -1,    -1,    -1,    -1,
-      -1,   253,    -1,    -1,   256,    -1,    -1,    -1,   260,    -1,
-      -1,   263,   264,    -1,   266,    -1,    -1,   269,    -1,   271,
-      -1,    -1,    -1,   275,   276,    -1,    -1,    -1,    -1,    -1,
-     282,   283,   284,   285,    -1,    -1,    -1,    -1,    -1,    -1,
-     292,    -1,    -1,    -1,   296,   297,    -1,    -1,   300,   301,
+      -1,    -1,   138,   139,    -1,    -1,   142,    -1,   144,   145,
+     146,   147,   148,   149,   150,    -1,   152,    -1,   154,   155,
+     156,   157,    -1,   159,    -1,   161,    -1,    -1,    -1,    -1,
+      -1,   167,    -1,    -1,   170,    -1,    -1,    -1,    -1,   187,
+     188,   189,   190,   191,   192,   193,   194,   195,   196,    -1,
+      -1,    -1,    -1,   201,   202,   203,   204,   205,   206,   207,
+     208,   209,   210,   211,   212,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   213,   214,    -1,
+      -1,    -1,    -1,    -1,    -1,   221,    -1,    -1,   224,   225,
+      -1,    -1,    -1,    -1,    -1,   231,   232,   233,   234,   235,
+     236,   237,   238,   239,   240,   241,   242,   243,    -1,   245,
+     246,    -1,    -1,    -1,    -1,   251,   252,   253,   254,    -1,
+      -1,    -1,   258,    -1,    -1,   261,   262,    -1,   264,    -1,
+      -1,   267,   268,   269,   270,   271,    -1,   273,   274,    -1,
+      -1,    -1,    -1,    -1,    -1,   281,   282,   283,   284,    -1,
+      -1,    -1,    -1,    -1,    -1,   291,    -1,    -1,    -1,   295,
+      -1,    -1,    -1,    -1,    -1,   301,    -1,   303,    -1,    -1,
+      -1,    -1,   308,     4,     5,     6,     7,     8,     9,   315,
+      -1,    -1,    -1,    -1,   320,   321,    -1,    -1,    -1,    -1,
+      21,    22,    -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,    40,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   316,    -1,    -1,    -1,    -1,   321,
-     322,    -1,     3,    -1,     5,     6,     7,     8,     9,    10,
-      11,    12,    13,    14,    15,    -1,    -1,    18,    19,    -1,
-     342,    22,    23,    -1,    -1,    26,    27,    28,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    38,    -1,    -1,
-      41,    -1,    -1,    44,    45,    46,    47,    48,    49,    50,
-      -1,    52,    -1,    -1,    55,    56,    57,    -1,    -1,    -1,
-      -1,    62,    63,    -1,    -1,    -1,    67,    68,    69,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    79,    -1,
-      -1,    82,    -1,    -1,    85,    -1,    -1,    -1,    -1,    -1,
-      91,    -1,    -1,    -1,    -1,    96,    97,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   107,    -1,    -1,   110,
-     111,    -1,   113,    -1,   115,   116,   117,    -1,    -1,    -1,
-     121,   122,   123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
-     151,    -1,   153,   154,   155,   156,   157,   158,    -1,   160,
-     161,   162,    -1,    -1,    -1,    -1,    -1,   168,    -1,   170,
-      -1,   172,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   189,   190,
-      -1,    -1,    -1,   194,   195,   196,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   206,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   215,   216,    -1,    -1,    -1,    -1,
-      -1,    -1,   223,    -1,    -1,    -1,   227,    -1,    -1,    -1,
-      -1,    -1,   233,    -1,    -1,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,    -1,   247,    -1,    -1,    -1,
-      -1,    -1,   253,    -1,    -1,   256,    -1,    -1,    -1,   260,
-      -1,    -1,   263,   264,    -1,   266,    -1,    -1,   269,    -1,
-     271,    -1,    -1,    -1,   275,   276,    -1,    -1,    -1,    -1,
-      -1,   282,   283,   284,   285,    -1,    -1,    -1,    -1,    -1,
-      -1,   292,    -1,    -1,    -1,   296,    -1,    -1,    -1,   300,
-     301,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   316,    -1,    -1,    -1,    -1,
-     321,   322,    -1,     3,    -1,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    -1,    -1,    18,    19,
-      -1,   342,    22,    23,    -1,    -1,    26,    27,    28,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    38,    -1,
-      -1,    41,    -1,    -1,    44,    45,    46,    47,    48,    49,
-      50,    -1,    52,    -1,    -1,    55,    56,    57,    -1,    -1,
-      -1,    -1,    62,    63,    -1,    -1,    -1,    67,    68,    69,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    79,
-      -1,    -1,    82,    -1,    -1,    85,    -1,    -1,    -1,    -1,
-      -1,    91,    -1,    -1,    -1,    -1,    96,    97,    98,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   107,    -1,    -1,
-     110,   111,    -1,   113,    -1,   115,   116,   117,    -1,    -1,
-      -1,   121,   122,   123,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   131,   132,   133,   134,   135,    -1,   137,   138,   139,
-     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
-     150,   151,    -1,   153,   154,   155,   156,   157,   158,    -1,
-     160,   161,   162,    -1,    -1,    -1,    -1,    -1,   168,    -1,
-     170,    -1,   172,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   189,
-     190,    -1,    -1,    -1,   194,   195,   196,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   206,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   215,   216,    -1,    -1,    -1,
-      -1,    -1,    -1,   223,    -1,    -1,    -1,   227,    -1,    -1,
-      -1,    -1,    -1,   233,    -1,    -1,   236,   237,   238,   239,
-     240,   241,   242,   243,   244,   245,    -1,   247,    -1,    -1,
-      -1,    -1,    -1,   253,    -1,    -1,   256,    -1,    -1,    -1,
-     260,    -1,    -1,   263,   264,    -1,   266,    -1,    -1,   269,
-      -1,   271,    -1,    -1,    -1,   275,   276,    -1,    -1,    -1,
-      -1,    -1,   282,   283,   284,   285,    -1,    -1,    -1,    -1,
-      -1,    -1,   292,    -1,    -1,    -1,   296,    -1,    -1,    -1,
-     300,   301,     5,     6,     7,     8,     9,    10,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   316,    -1,    -1,    22,
-      23,   321,   322,    26,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    38,    -1,    -1,    41,    -1,
-      -1,    -1,   342,    -1,    -1,    -1,    -1,    -1,    -1,    52,
+      51,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    62,    63,    64,    65,    66,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    75,    76,    77,    78,    -1,    -1,
+      81,    -1,    -1,    84,    -1,    -1,    -1,    -1,    -1,    90,
+      -1,    -1,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,
+     108,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   109,    -1,
+      -1,   112,    -1,   114,   115,   116,    -1,    -1,    -1,    -1,
+     121,   122,   130,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   138,   139,    -1,
+      -1,   142,    -1,   144,   145,   146,   147,   148,   149,   150,
+      -1,   152,    -1,   154,   155,   156,   157,    -1,   159,    -1,
+     161,   169,    -1,    -1,    -1,    -1,   167,    -1,    -1,   170,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   187,
+     188,   189,   190,   191,   192,   193,   194,   195,   196,    -1,
+      -1,    -1,    -1,   201,   202,   203,   204,   205,   206,   207,
+     208,   209,   210,   211,   212,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,
+     221,    -1,    -1,   224,   225,    -1,    -1,    -1,    -1,    -1,
+     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,    -1,   245,   246,    -1,    -1,    -1,    -1,
+     251,   252,   253,   254,    -1,    -1,    -1,   258,    -1,    -1,
+     261,   262,    -1,   264,    -1,    -1,   267,   268,   269,   270,
+     271,    -1,   273,   274,    -1,    -1,    -1,    -1,    -1,    -1,
+     281,   282,   283,   284,    -1,    -1,    -1,    -1,    -1,    -1,
+     291,    -1,    -1,    -1,   295,    -1,    -1,    -1,    -1,    -1,
+     301,    -1,    -1,    -1,    -1,    -1,   307,   308,     4,     5,
+       6,     7,     8,     9,   315,    -1,    -1,    -1,    -1,   320,
+     321,    -1,    -1,    -1,    -1,    21,    22,    -1,    -1,    25,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      63,    -1,    -1,    -1,    67,    68,    69,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    79,    -1,    -1,    82,
-      -1,    -1,    85,    -1,    -1,    -1,    -1,    -1,    91,    -1,
-      -1,    -1,    -1,    96,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,    -1,
-     113,    -1,   115,   116,   117,   131,    -1,    -1,    -1,   122,
-     123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   139,   140,    -1,    -1,
-     143,    -1,   145,   146,   147,   148,   149,   150,   151,    -1,
-     153,    -1,   155,   156,   157,   158,    -1,   160,    -1,   162,
-      -1,    -1,    -1,    -1,    -1,   168,    -1,   170,    -1,   172,
-      -1,    -1,    -1,   189,   190,   191,   192,   193,    -1,    -1,
-      -1,   197,   198,   199,   200,   201,    -1,   203,   204,   205,
-     206,   207,   208,   209,   210,   211,   212,   213,   214,    -1,
+      -1,    37,    -1,    -1,    40,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    51,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    62,    63,    64,    65,
+      66,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    75,
+      76,    77,    78,    -1,    -1,    81,    -1,    -1,    84,    -1,
+      -1,    -1,    -1,    -1,    90,    -1,    -1,    -1,    -1,    95,
+      96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   109,    -1,    -1,   112,    -1,   114,   115,
+     116,   130,    -1,    -1,    -1,   121,   122,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   215,   216,    -1,    -1,    -1,    -1,    -1,    -1,
-     223,    -1,    -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,
-     233,    -1,    -1,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,    -1,   247,    -1,    -1,    -1,    -1,    -1,
-     253,    -1,    -1,   256,    -1,    -1,    -1,   260,    -1,    -1,
-     263,   264,    -1,   266,    -1,    -1,   269,    -1,   271,    -1,
-      -1,    -1,   275,   276,    -1,    -1,    -1,    -1,    -1,   282,
-     283,   284,   285,    -1,    -1,    -1,    -1,    -1,    -1,   292,
-      -1,     5,     6,     7,     8,     9,    10,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,
-      -1,    -1,    26,   316,    -1,    -1,    -1,    -1,   321,   322,
-      -1,   337,    -1,    -1,    38,    -1,    -1,    41,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   340,    52,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    63,
-      64,    65,    66,    67,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    76,    77,    78,    79,    -1,    -1,    82,    -1,
-      -1,    85,    -1,    -1,    -1,    -1,    -1,    91,    -1,    -1,
-      -1,    -1,    96,    97,    98,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,    -1,   113,
-      -1,   115,   116,   117,    -1,   131,    -1,    -1,   122,   123,
+      -1,    -1,   138,   139,    -1,    -1,   142,    -1,   144,   145,
+     146,   147,   148,   149,   150,    -1,   152,    -1,   154,   155,
+     156,   157,    -1,   159,    -1,   161,    -1,    -1,    -1,    -1,
+      -1,   167,    -1,    -1,   170,    -1,    -1,    -1,   187,   188,
+     189,   190,   191,   192,   193,   194,   195,   196,    -1,    -1,
+      -1,    -1,   201,   202,   203,   204,   205,   206,   207,   208,
+     209,   210,   211,   212,    -1,    -1,    -1,    -1,    -1,    -1,
+     219,   220,    -1,    -1,    -1,    -1,    -1,   213,   214,    -1,
+      -1,    -1,    -1,    -1,    -1,   221,    -1,    -1,   224,   225,
+      -1,    -1,    -1,    -1,    -1,   231,   232,   233,   234,   235,
+     236,   237,   238,   239,   240,   241,   242,   243,    -1,   245,
+     246,    -1,    -1,    -1,    -1,   251,   252,   253,   254,    -1,
+      -1,    -1,   258,    -1,    -1,   261,   262,    -1,   264,    -1,
+      -1,   267,   268,   269,   270,   271,    -1,   273,   274,    -1,
+      -1,    -1,    -1,    -1,    -1,   281,   282,   283,   284,    -1,
+      -1,    -1,    -1,    -1,    -1,   291,    -1,    -1,    -1,   295,
+      -1,    -1,    -1,    -1,    -1,   301,    -1,    -1,    -1,    -1,
+      -1,    -1,   308,     4,     5,     6,     7,     8,     9,   315,
+      -1,    -1,    -1,    -1,   320,   321,    -1,    -1,    -1,    -1,
+      21,    22,    -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,    40,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   139,   140,    -1,    -1,   143,
-      -1,   145,   146,   147,   148,   149,   150,   151,    -1,   153,
-      -1,   155,   156,   157,   158,    -1,   160,    -1,   162,    -1,
-      -1,    -1,    -1,    -1,   168,    -1,    -1,    -1,   172,    -1,
-      -1,    -1,    -1,   189,   190,   191,   192,   193,    -1,    -1,
-      -1,   197,   198,   199,   200,   201,    -1,   203,   204,   205,
-     206,   207,   208,   209,   210,   211,   212,   213,   214,    -1,
+      51,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    62,    63,    64,    65,    66,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    75,    76,    77,    78,    -1,    -1,
+      81,    -1,    -1,    84,    -1,    -1,    -1,    -1,    -1,    90,
+      -1,    -1,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   109,    -1,
+      -1,   112,    -1,   114,   115,   116,   130,    -1,    -1,    -1,
+     121,   122,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   138,   139,    -1,
+      -1,   142,    -1,   144,   145,   146,   147,   148,   149,   150,
+      -1,   152,    -1,   154,   155,   156,   157,    -1,   159,    -1,
+     161,    -1,    -1,    -1,   178,    -1,   167,    -1,    -1,   170,
+      -1,    -1,    -1,   187,   188,   189,   190,   191,   192,   193,
+     194,   195,   196,    -1,    -1,    -1,    -1,   201,   202,   203,
+     204,   205,   206,   207,   208,   209,   210,   211,   212,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   215,   216,    -1,    -1,    -1,    -1,    -1,    -1,   223,
-      -1,    -1,   226,   227,    -1,    -1,    -1,    -1,    -1,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,    -1,   247,   248,    -1,    -1,    -1,    -1,   253,
-     254,   255,   256,    -1,    -1,    -1,   260,    -1,    -1,   263,
-     264,    -1,   266,    -1,    -1,   269,   270,   271,   272,   273,
-      -1,   275,   276,    -1,    -1,    -1,    -1,    -1,   282,   283,
-     284,   285,   298,    -1,    -1,    -1,    -1,    -1,   292,    -1,
-      -1,    -1,   296,    -1,    -1,   299,    -1,    -1,   302,   303,
-     304,    -1,    -1,    -1,    -1,   309,     5,     6,     7,     8,
-       9,    10,   316,    -1,    -1,    -1,    -1,   321,   322,    -1,
-      -1,    -1,    -1,    22,    23,    -1,    -1,    26,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    38,
-      -1,    -1,    41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    52,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    63,    64,    65,    66,    67,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    76,    77,    78,
-      79,    -1,    -1,    82,    -1,    -1,    85,    -1,    -1,    -1,
-      -1,    -1,    91,    -1,    -1,    -1,    -1,    96,    97,    98,
+      -1,    -1,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,
+     221,    -1,    -1,    -1,   225,    -1,    -1,    -1,    -1,    -1,
+     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,    -1,   245,    -1,    -1,    -1,    -1,    -1,
+     251,   252,   253,   254,    -1,    -1,    -1,   258,    -1,    -1,
+     261,   262,    -1,   264,    -1,    -1,   267,   268,   269,   270,
+      -1,    -1,   273,   274,    -1,    -1,    -1,    -1,    -1,    -1,
+     281,   282,   283,   284,    -1,    -1,    -1,    -1,    -1,    -1,
+     291,    -1,    -1,    -1,   295,    -1,    -1,    -1,    -1,    -1,
+     301,    -1,    -1,    -1,    -1,   306,    -1,   308,     4,     5,
+       6,     7,     8,     9,   315,    -1,    -1,    -1,    -1,   320,
+     321,    -1,    -1,    -1,    -1,    21,    22,    -1,    -1,    25,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   110,    -1,    -1,   113,    -1,   115,   116,   117,    -1,
-     131,    -1,    -1,   122,   123,    -1,    -1,    -1,    -1,    -1,
+      -1,    37,    -1,    -1,    40,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    51,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    62,    63,    64,    65,
+      66,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    75,
+      76,    77,    78,    -1,    -1,    81,    -1,    -1,    84,    -1,
+      -1,    -1,    -1,    -1,    90,    -1,    -1,    -1,    -1,    95,
+      96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   109,    -1,    -1,   112,    -1,   114,   115,
+     116,    -1,    -1,   130,    -1,   121,   122,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     139,   140,    -1,    -1,   143,    -1,   145,   146,   147,   148,
-     149,   150,   151,    -1,   153,    -1,   155,   156,   157,   158,
-      -1,   160,    -1,   162,    -1,    -1,    -1,    -1,    -1,   168,
-      -1,    -1,    -1,   172,    -1,    -1,    -1,    -1,   189,   190,
-     191,   192,   193,    -1,    -1,    -1,   197,   198,   199,   200,
-     201,    -1,   203,   204,   205,   206,   207,   208,   209,   210,
-     211,   212,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   215,   216,    -1,    -1,
-      -1,    -1,    -1,    -1,   223,    -1,    -1,   226,   227,    -1,
-      -1,    -1,    -1,   232,   233,   234,   235,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,    -1,   247,   248,
-      -1,    -1,    -1,    -1,   253,   254,   255,   256,    -1,    -1,
-      -1,   260,    -1,    -1,   263,   264,    -1,   266,    -1,    -1,
-     269,   270,   271,   272,   273,    -1,   275,   276,    -1,    -1,
-      -1,    -1,    -1,   282,   283,   284,   285,   298,    -1,    -1,
-      -1,    -1,    -1,   292,    -1,    -1,    -1,   296,    -1,    -1,
-      -1,    -1,    -1,   302,    -1,    -1,    -1,    -1,   307,    -1,
-     309,     5,     6,     7,     8,     9,    10,   316,    -1,    -1,
-      -1,    -1,   321,   322,    -1,    -1,    -1,    -1,    22,    23,
-      -1,    -1,    26,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    38,    -1,    -1,    41,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    52,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    63,
-      64,    65,    66,    67,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    76,    77,    78,    79,    -1,    -1,    82,    -1,
-      -1,    85,    -1,    -1,    -1,    -1,    -1,    91,    -1,    -1,
-      -1,    -1,    96,    97,    98,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,    -1,   113,
-      -1,   115,   116,   117,    -1,    -1,   131,    -1,   122,   123,
+      -1,    -1,   138,   139,    -1,    -1,   142,    -1,   144,   145,
+     146,   147,   148,   149,   150,    -1,   152,    -1,   154,   155,
+     156,   157,   169,   159,    -1,   161,    -1,    -1,    -1,    -1,
+      -1,   167,    -1,    -1,   170,    -1,    -1,    -1,    -1,    -1,
+     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
+      -1,    -1,    -1,    -1,   201,   202,   203,   204,   205,   206,
+     207,   208,   209,   210,   211,   212,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   213,   214,    -1,
+      -1,    -1,    -1,    -1,    -1,   221,    -1,    -1,    -1,   225,
+      -1,    -1,    -1,    -1,    -1,   231,   232,   233,   234,   235,
+     236,   237,   238,   239,   240,   241,   242,   243,    -1,   245,
+      -1,    -1,    -1,    -1,    -1,   251,   252,   253,   254,    -1,
+      -1,    -1,   258,    -1,    -1,   261,   262,    -1,   264,    -1,
+      -1,   267,   268,   269,   270,    -1,    -1,   273,   274,    -1,
+      -1,    -1,    -1,    -1,    -1,   281,   282,   283,   284,    -1,
+      -1,    -1,    -1,    -1,    -1,   291,    -1,    -1,    -1,   295,
+      -1,    -1,    -1,    -1,    -1,   301,    -1,    -1,    -1,    -1,
+      -1,   307,   308,    -1,    -1,    -1,    -1,    -1,    -1,   315,
+      -1,    -1,    -1,    -1,   320,   321,     4,     5,     6,     7,
+       8,     9,    -1,    -1,    -1,    -1,    -1,    -1,    16,    -1,
+      -1,    -1,    -1,    21,    22,    -1,    -1,    25,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,
+      -1,    -1,    40,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    51,    -1,    -1,    -1,    -1,    -1,    57,
+      -1,    -1,    -1,    -1,    62,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   139,   140,    -1,    -1,   143,
-      -1,   145,   146,   147,   148,   149,   150,   151,    -1,   153,
-      -1,   155,   156,   157,   158,    -1,   160,    -1,   162,    -1,
-      -1,    -1,    -1,    -1,   168,    -1,    -1,    -1,   172,    -1,
-      -1,    -1,    -1,    -1,   189,   190,   191,   192,   193,    -1,
-      -1,    -1,   197,   198,   199,   200,   201,    -1,   203,   204,
-     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
+      78,    -1,    -1,    81,    -1,    -1,    84,    -1,    -1,    -1,
+      -1,    -1,    90,    -1,    -1,    -1,    -1,    95,    96,    97,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   215,   216,    -1,    -1,    -1,    -1,    -1,    -1,   223,
-      -1,    -1,   226,   227,    -1,    -1,    -1,    -1,   232,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,    -1,   247,   248,    -1,    -1,    -1,    -1,   253,
-     254,   255,   256,    -1,    -1,    -1,   260,    -1,    -1,   263,
-     264,    -1,   266,    -1,    -1,   269,   270,   271,   272,   273,
-      -1,   275,   276,    -1,    -1,    -1,    -1,    -1,   282,   283,
-     284,   285,   297,    -1,    -1,    -1,    -1,    -1,   292,    -1,
-      -1,    -1,   296,    -1,    -1,    -1,    -1,    -1,   302,    -1,
-      -1,    -1,    -1,   307,    -1,   309,     5,     6,     7,     8,
-       9,    10,   316,    -1,    -1,    -1,    -1,   321,   322,    -1,
-      -1,    -1,    -1,    22,    23,    -1,    -1,    26,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    38,
-      -1,    -1,    41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    52,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    63,    64,    65,    66,    67,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    76,    77,    78,
-      79,    -1,    -1,    82,    -1,    -1,    85,    -1,    -1,    -1,
-      -1,    -1,    91,    -1,    -1,    -1,    -1,    96,    97,    98,
+      -1,   109,    -1,    -1,   112,    -1,   114,   115,   116,    -1,
+      -1,   130,    -1,   121,   122,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   110,    -1,    -1,   113,    -1,   115,   116,   117,    -1,
-      -1,   131,    -1,   122,   123,    -1,    -1,    -1,    -1,    -1,
+     138,   139,    -1,    -1,   142,    -1,   144,   145,   146,   147,
+     148,   149,   150,    -1,   152,    -1,   154,   155,   156,   157,
+     169,   159,    -1,   161,    -1,    -1,    -1,    -1,    -1,   167,
+      -1,    -1,   170,    -1,    -1,    -1,    -1,    -1,   187,   188,
+     189,   190,   191,   192,   193,   194,   195,   196,    -1,    -1,
+      -1,    -1,   201,   202,   203,   204,   205,   206,   207,   208,
+     209,   210,   211,   212,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   213,   214,   215,   216,   217,
+     218,    -1,    -1,   221,    -1,    -1,    -1,   225,    -1,    -1,
+      -1,    -1,    -1,   231,    -1,    -1,   234,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,    -1,   245,    -1,    -1,
+      -1,    -1,    -1,   251,    -1,    -1,   254,    -1,    -1,    -1,
+     258,    -1,    -1,   261,   262,    -1,   264,    -1,    -1,   267,
+      -1,   269,    -1,    -1,    -1,   273,   274,     4,     5,     6,
+       7,     8,     9,   281,   282,   283,   284,    -1,    -1,    -1,
+      -1,    -1,    -1,   291,    21,    22,    -1,    -1,    25,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     139,   140,    -1,    -1,   143,    -1,   145,   146,   147,   148,
-     149,   150,   151,    -1,   153,    -1,   155,   156,   157,   158,
-      -1,   160,    -1,   162,    -1,    -1,    -1,    -1,    -1,   168,
-      -1,    -1,    -1,   172,    -1,    -1,    -1,    -1,    -1,   189,
-     190,   191,   192,   193,    -1,    -1,    -1,   197,   198,   199,
-     200,   201,    -1,   203,   204,   205,   206,   207,   208,   209,
-     210,   211,   212,   213,   214,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   215,   216,    -1,    -1,
-      -1,    -1,    -1,    -1,   223,    -1,    -1,   226,   227,    -1,
-      -1,    -1,    -1,    -1,   233,   234,   235,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,    -1,   247,   248,
-      -1,    -1,    -1,    -1,   253,   254,   255,   256,    -1,    -1,
-      -1,   260,    -1,    -1,   263,   264,    -1,   266,    -1,    -1,
-     269,   270,   271,   272,   273,    -1,   275,   276,    -1,    -1,
-      -1,    -1,    -1,   282,   283,   284,   285,   297,    -1,    -1,
-      -1,    -1,    -1,   292,    -1,    -1,    -1,   296,    -1,    -1,
-      -1,    -1,    -1,   302,    -1,   304,    -1,    -1,    -1,    -1,
-     309,     5,     6,     7,     8,     9,    10,   316,    -1,    -1,
-      -1,    -1,   321,   322,    -1,    -1,    -1,    -1,    22,    23,
-      -1,    -1,    26,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    38,    -1,    -1,    41,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    52,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    63,
-      64,    65,    66,    67,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    76,    77,    78,    79,    -1,    -1,    82,    -1,
-      -1,    85,    -1,    -1,    -1,    -1,    -1,    91,    -1,    -1,
-      -1,    -1,    96,    97,    98,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,    -1,   113,
-      -1,   115,   116,   117,   131,    -1,    -1,    -1,   122,   123,
+      37,    -1,    -1,    40,    -1,    -1,    -1,   315,    -1,    -1,
+      -1,    -1,   320,   321,    51,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    62,    -1,    -1,    -1,    66,
+      67,    68,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    78,    -1,    -1,    81,    -1,    -1,    84,    -1,    -1,
+      -1,    -1,    -1,    90,    -1,    -1,    -1,    -1,    95,    96,
+      97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   109,    -1,    -1,   112,    -1,   114,   115,   116,
+     130,    -1,    -1,    -1,   121,   122,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   139,   140,    -1,    -1,   143,
-      -1,   145,   146,   147,   148,   149,   150,   151,    -1,   153,
-      -1,   155,   156,   157,   158,    -1,   160,    -1,   162,    -1,
-      -1,    -1,    -1,    -1,   168,    -1,    -1,    -1,   172,    -1,
-      -1,    -1,   189,   190,   191,   192,   193,    -1,    -1,    -1,
-     197,   198,   199,   200,   201,    -1,   203,   204,   205,   206,
-     207,   208,   209,   210,   211,   212,   213,   214,    -1,    -1,
+      -1,   138,   139,    -1,    -1,   142,    -1,   144,   145,   146,
+     147,   148,   149,   150,    -1,   152,    -1,   154,   155,   156,
+     157,    -1,   159,    -1,   161,    -1,    -1,    -1,    -1,    -1,
+     167,    -1,    -1,   170,    -1,    -1,    -1,   187,   188,   189,
+     190,   191,   192,   193,   194,   195,   196,    -1,    -1,    -1,
+      -1,   201,   202,   203,   204,   205,   206,   207,   208,   209,
+     210,   211,   212,    -1,   201,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   213,   214,    -1,    -1,
+      -1,    -1,    -1,    -1,   221,    -1,    -1,    -1,   225,    -1,
+      -1,    -1,    -1,    -1,   231,    -1,    -1,   234,   235,   236,
+     237,   238,   239,   240,   241,   242,   243,    -1,   245,    -1,
+      -1,    -1,    -1,    -1,   251,    -1,    -1,   254,    -1,    -1,
+      -1,   258,    -1,    -1,   261,   262,    -1,   264,    -1,    -1,
+     267,    -1,   269,    -1,    -1,    -1,   273,   274,     4,     5,
+       6,     7,     8,     9,   281,   282,   283,   284,    -1,    -1,
+      -1,    -1,    -1,    -1,   291,    21,    22,    -1,    -1,    25,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   215,   216,    -1,    -1,    -1,    -1,    -1,    -1,   223,
-      -1,    -1,   226,   227,    -1,    -1,    -1,    -1,    -1,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,   259,   247,   248,    -1,    -1,    -1,    -1,   253,
-     254,   255,   256,    -1,    -1,    -1,   260,    -1,    -1,   263,
-     264,    -1,   266,    -1,    -1,   269,   270,   271,   272,   273,
-      -1,   275,   276,    -1,    -1,    -1,    -1,    -1,   282,   283,
-     284,   285,    -1,    -1,    -1,    -1,    -1,    -1,   292,    -1,
-      -1,    -1,   296,    -1,    -1,    -1,    -1,    -1,   302,    -1,
-      -1,    -1,    -1,    -1,   308,   309,     5,     6,     7,     8,
-       9,    10,   316,    -1,    -1,    -1,    -1,   321,   322,    -1,
-      -1,    -1,    -1,    22,    23,    -1,    -1,    26,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    38,
-      -1,    -1,    41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    52,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    63,    64,    65,    66,    67,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    76,    77,    78,
-      79,    -1,    -1,    82,    -1,    -1,    85,    -1,    -1,    -1,
-      -1,    -1,    91,   104,    -1,    -1,    -1,    96,    97,    98,
+      -1,    37,    -1,    -1,    40,    -1,    -1,    -1,   315,    -1,
+      -1,    -1,    -1,   320,   321,    51,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    62,    -1,    -1,    -1,
+      66,    67,    68,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    78,    -1,    -1,    81,    -1,    -1,    84,    -1,
+      -1,    -1,    -1,    -1,    90,    -1,    -1,    -1,    -1,    95,
+      96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   109,    -1,    -1,   112,    -1,   114,   115,
+     116,    -1,    -1,    -1,    -1,   121,   122,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   110,    -1,    -1,   113,    -1,   115,   116,   117,    -1,
-     131,    -1,    -1,   122,   123,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   138,   139,    -1,    -1,   142,    -1,   144,   145,
+     146,   147,   148,   149,   150,    -1,   152,    -1,   154,   155,
+     156,   157,    -1,   159,    -1,   161,    -1,    -1,    -1,    -1,
+      -1,   167,    -1,    -1,   170,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     139,   140,    -1,    -1,   143,    -1,   145,   146,   147,   148,
-     149,   150,   151,    -1,   153,    -1,   155,   156,   157,   158,
-      -1,   160,    -1,   162,    -1,    -1,    -1,    -1,    -1,   168,
-      -1,    -1,    -1,   172,    -1,    -1,    -1,    -1,   189,   190,
-     191,   192,   193,    -1,    -1,    -1,   197,   198,   199,   200,
-     201,    -1,   203,   204,   205,   206,   207,   208,   209,   210,
-     211,   212,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   215,   216,    -1,    -1,
-      -1,    -1,    -1,    -1,   223,    -1,    -1,   226,   227,    -1,
-      -1,    -1,    -1,    -1,   233,   234,   235,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,    -1,   247,   248,
-      -1,    -1,    -1,    -1,   253,   254,   255,   256,    -1,    -1,
-      -1,   260,    -1,    -1,   263,   264,    -1,   266,    -1,    -1,
-     269,   270,   271,   272,   273,    -1,   275,   276,    -1,    -1,
-      -1,    -1,    -1,   282,   283,   284,   285,    -1,    -1,    -1,
-      -1,    -1,    -1,   292,    -1,    -1,    -1,   296,    -1,    -1,
-      -1,    -1,    -1,   302,    -1,    -1,    -1,    -1,    -1,    -1,
-     309,     5,     6,     7,     8,     9,    10,   316,    -1,    -1,
-      -1,    -1,   321,   322,    -1,    -1,    -1,    -1,    22,    23,
-      -1,    -1,    26,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    38,    -1,    -1,    41,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    52,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    63,
-      64,    65,    66,    67,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    76,    77,    78,    79,    -1,    -1,    82,    -1,
-      -1,    85,    -1,    -1,    -1,    -1,    -1,    91,    -1,    -1,
-      -1,    -1,    96,    97,    98,   109,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,    -1,   113,
-      -1,   115,   116,   117,    -1,    -1,    -1,   131,   122,   123,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   139,   140,    -1,    -1,   143,
-      -1,   145,   146,   147,   148,   149,   150,   151,    -1,   153,
-      -1,   155,   156,   157,   158,    -1,   160,   171,   162,    -1,
-      -1,    -1,    -1,    -1,   168,    -1,    -1,    -1,   172,    -1,
-      -1,    -1,    -1,    -1,    -1,   189,   190,   191,   192,   193,
-      -1,    -1,    -1,   197,   198,   199,   200,   201,    -1,   203,
-     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
-     214,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   215,   216,    -1,    -1,    -1,    -1,    -1,    -1,   223,
-      -1,    -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,    -1,   247,    -1,    -1,    -1,    -1,    -1,   253,
-     254,   255,   256,    -1,    -1,    -1,   260,    -1,    -1,   263,
-     264,    -1,   266,    -1,    -1,   269,   270,   271,   272,    -1,
-      -1,   275,   276,    -1,    -1,    -1,    -1,    -1,   282,   283,
-     284,   285,    -1,    -1,    -1,    -1,    -1,    -1,   292,    -1,
-      -1,    -1,   296,    -1,    -1,    -1,    -1,    -1,   302,    -1,
-      -1,    -1,    -1,   307,    -1,   309,     5,     6,     7,     8,
-       9,    10,   316,    -1,    -1,    -1,    -1,   321,   322,    -1,
-      -1,    -1,    -1,    22,    23,    -1,    -1,    26,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    38,
-      -1,    -1,    41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    52,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    63,    64,    65,    66,    67,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    76,    77,    78,
-      79,    -1,    -1,    82,    -1,    -1,    85,    -1,    -1,    -1,
-      -1,    -1,    91,    -1,    -1,    -1,    -1,    96,    97,    98,
+      -1,    -1,    -1,    -1,    -1,   201,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   213,   214,    -1,
+      -1,    -1,    -1,    -1,    -1,   221,    -1,    -1,    -1,   225,
+      -1,    -1,    -1,    -1,    -1,   231,    -1,    -1,   234,   235,
+     236,   237,   238,   239,   240,   241,   242,   243,    -1,   245,
+      -1,    -1,    -1,    -1,    -1,   251,    -1,    -1,   254,    -1,
+      -1,    -1,   258,    -1,    -1,   261,   262,    -1,   264,    -1,
+      -1,   267,    -1,   269,    -1,    -1,    -1,   273,   274,     4,
+       5,     6,     7,     8,     9,   281,   282,   283,   284,    -1,
+      -1,    -1,    -1,    -1,    -1,   291,    21,    22,    -1,    -1,
+      25,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    37,    -1,    -1,    40,    -1,    -1,    -1,   315,
+      -1,    -1,    -1,    -1,   320,   321,    51,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    62,    -1,    -1,
+      -1,    66,    67,    68,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    78,    -1,    -1,    81,    -1,    -1,    84,
+      -1,    -1,    -1,    -1,    -1,    90,    -1,    -1,    -1,    -1,
+      95,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   109,    -1,    -1,   112,    -1,   114,
+     115,   116,    -1,    -1,   130,    -1,   121,   122,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   110,    -1,    -1,   113,    -1,   115,   116,   117,   131,
-      -1,    -1,    -1,   122,   123,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   138,   139,    -1,    -1,   142,    -1,   144,
+     145,   146,   147,   148,   149,   150,    -1,   152,    -1,   154,
+     155,   156,   157,   169,   159,    -1,   161,    -1,    -1,    -1,
+      -1,    -1,   167,    -1,    -1,   170,    -1,    -1,    -1,    -1,
+      -1,   187,   188,   189,   190,   191,   192,   193,   194,   195,
+     196,    -1,    -1,    -1,    -1,   201,   202,   203,   204,   205,
+     206,   207,   208,   209,   210,   211,   212,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   213,   214,
+      -1,    -1,    -1,    -1,    -1,    -1,   221,    -1,    -1,    -1,
+     225,    -1,    -1,    -1,    -1,    -1,   231,    -1,    -1,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,    -1,
+     245,    -1,    -1,    -1,    -1,    -1,   251,    -1,    -1,   254,
+      -1,    -1,    -1,   258,    -1,    -1,   261,   262,    -1,   264,
+      -1,    -1,   267,    -1,   269,    -1,    -1,    -1,   273,   274,
+       4,     5,     6,     7,     8,     9,   281,   282,   283,   284,
+      -1,    -1,    -1,    -1,    -1,    -1,   291,    21,    22,    -1,
+      -1,    25,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    37,    -1,    -1,    40,    -1,    -1,    -1,
+     315,    -1,    -1,    -1,    -1,   320,   321,    51,    -1,    -1,
+      54,    55,    56,    -1,    -1,    -1,    -1,    -1,    62,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     139,   140,    -1,    -1,   143,    -1,   145,   146,   147,   148,
-     149,   150,   151,    -1,   153,    -1,   155,   156,   157,   158,
-      -1,   160,    -1,   162,    -1,    -1,    -1,    -1,    -1,   168,
-      -1,    -1,    -1,   172,    -1,    -1,    -1,   189,   190,   191,
-     192,   193,    -1,    -1,    -1,   197,   198,   199,   200,   201,
-      -1,   203,   204,   205,   206,   207,   208,   209,   210,   211,
-     212,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,   221,
-     222,    -1,    -1,    -1,    -1,    -1,   215,   216,    -1,    -1,
-      -1,    -1,    -1,    -1,   223,    -1,    -1,    -1,   227,    -1,
-      -1,    -1,    -1,    -1,   233,   234,   235,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,    -1,   247,    -1,
-      -1,    -1,    -1,    -1,   253,   254,   255,   256,    -1,    -1,
-      -1,   260,    -1,    -1,   263,   264,    -1,   266,    -1,    -1,
-     269,   270,   271,   272,    -1,    -1,   275,   276,    -1,    -1,
-      -1,    -1,    -1,   282,   283,   284,   285,    -1,    -1,    -1,
-      -1,    -1,    -1,   292,    -1,    -1,    -1,   296,    -1,    -1,
-      -1,    -1,    -1,   302,    -1,    -1,    -1,    -1,    -1,   308,
-     309,    -1,    -1,    -1,    -1,    -1,    -1,   316,    -1,    -1,
-      -1,    -1,   321,   322,     5,     6,     7,     8,     9,    10,
-      -1,    -1,    -1,    -1,    -1,    -1,    17,    -1,    -1,    -1,
-      -1,    22,    23,    -1,    -1,    26,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    38,    -1,    -1,
-      41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    52,    -1,    -1,    -1,    -1,    -1,    58,    -1,    -1,
-      -1,    -1,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    79,    -1,
-      -1,    82,    -1,    -1,    85,    -1,    -1,    -1,    -1,    -1,
-      91,    -1,    -1,    -1,    -1,    96,    97,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,
-      -1,    -1,   113,    -1,   115,   116,   117,    -1,   131,    -1,
-      -1,   122,   123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   139,   140,
-      -1,    -1,   143,    -1,   145,   146,   147,   148,   149,   150,
-     151,    -1,   153,    -1,   155,   156,   157,   158,    -1,   160,
-      -1,   162,    -1,    -1,    -1,    -1,    -1,   168,   181,    -1,
-      -1,   172,    -1,    -1,    -1,    -1,   189,   190,   191,   192,
-     193,    -1,    -1,    -1,   197,   198,   199,   200,   201,    -1,
-     203,   204,   205,   206,   207,   208,   209,   210,   211,   212,
-     213,   214,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   215,   216,   217,   218,   219,   220,
-      -1,    -1,   223,    -1,    -1,    -1,   227,    -1,    -1,    -1,
-      -1,    -1,   233,    -1,    -1,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,    -1,   247,    -1,    -1,    -1,
-      -1,    -1,   253,    -1,    -1,   256,    -1,    -1,    -1,   260,
-      -1,    -1,   263,   264,    -1,   266,    -1,    -1,   269,    -1,
-     271,    -1,    -1,    -1,   275,   276,    -1,    -1,    -1,    -1,
-      -1,   282,   283,   284,   285,    -1,    -1,    -1,    -1,    -1,
-      -1,   292,     5,     6,     7,     8,     9,    10,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,
-      23,    -1,    -1,    26,    -1,   316,    -1,    -1,    -1,    -1,
-     321,   322,    -1,    -1,    -1,    38,    -1,    -1,    41,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    52,
+      -1,    -1,    -1,    -1,    78,    -1,    -1,    81,    -1,    -1,
+      84,    -1,    -1,    -1,    -1,    -1,    90,    -1,    -1,    -1,
+      -1,    95,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   109,    -1,    -1,   112,    -1,
+     114,   115,   116,    -1,    -1,   130,    -1,   121,   122,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   138,   139,    -1,    -1,   142,    -1,
+     144,   145,   146,   147,   148,   149,   150,    -1,   152,    -1,
+     154,   155,   156,   157,   169,   159,    -1,   161,    -1,    -1,
+      -1,    -1,    -1,   167,    -1,    -1,   170,    -1,    -1,    -1,
+      -1,    -1,   187,   188,   189,   190,   191,   192,   193,   194,
+     195,   196,    -1,    -1,    -1,    -1,   201,   202,   203,   204,
+     205,   206,   207,   208,   209,   210,   211,   212,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   213,
+     214,    -1,    -1,    -1,    -1,    -1,    -1,   221,    -1,    -1,
+      -1,   225,    -1,    -1,    -1,    -1,    -1,   231,    -1,    -1,
+     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
+      -1,   245,    -1,    -1,    -1,    -1,    -1,   251,    -1,    -1,
+     254,    -1,    -1,    -1,   258,    -1,    -1,   261,   262,    -1,
+     264,    -1,   130,   267,    -1,   269,    -1,    -1,    -1,   273,
+     274,     4,     5,     6,     7,     8,     9,   281,   282,   283,
+     284,    -1,    -1,    -1,    -1,    -1,    -1,   291,    21,    22,
+      -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   169,    -1,    -1,    37,    -1,    -1,    40,    -1,    -1,
+      -1,   315,    -1,    -1,    -1,    -1,   320,   321,    51,   187,
+     188,   189,   190,   191,   192,   193,   194,   195,   196,    62,
+      -1,    -1,    -1,   201,   202,   203,   204,   205,   206,   207,
+     208,   209,   210,   211,   212,    78,    -1,    -1,    81,    -1,
+      -1,    84,    -1,    -1,    -1,    -1,    -1,    90,    -1,    -1,
+      -1,    -1,    95,    96,    97,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   109,    -1,    -1,   112,
+      -1,   114,   115,   116,    -1,    -1,   130,    -1,   121,   122,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      63,    -1,    -1,    -1,    67,    68,    69,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    79,    -1,    -1,    82,
-      -1,    -1,    85,    -1,    -1,    -1,    -1,    -1,    91,    -1,
-      -1,    -1,    -1,    96,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,    -1,
-     113,    -1,   115,   116,   117,    -1,   131,    -1,    -1,   122,
-     123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   139,   140,    -1,    -1,
-     143,    -1,   145,   146,   147,   148,   149,   150,   151,    -1,
-     153,    -1,   155,   156,   157,   158,   171,   160,    -1,   162,
-      -1,    -1,    -1,    -1,    -1,   168,    -1,    -1,    -1,   172,
-      -1,    -1,    -1,    -1,   189,   190,   191,   192,   193,    -1,
-      -1,    -1,   197,   198,   199,   200,   201,    -1,   203,   204,
-     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
-     203,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   215,   216,    -1,    -1,    -1,    -1,    -1,    -1,
-     223,    -1,    -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,
-     233,    -1,    -1,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,    -1,   247,    -1,    -1,    -1,    -1,    -1,
-     253,    -1,    -1,   256,    -1,    -1,    -1,   260,    -1,    -1,
-     263,   264,    -1,   266,    -1,    -1,   269,    -1,   271,    -1,
-      -1,    -1,   275,   276,    -1,    -1,    -1,    -1,    -1,   282,
-     283,   284,   285,    -1,    -1,    -1,    -1,    -1,    -1,   292,
-       5,     6,     7,     8,     9,    10,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    -1,
-      -1,    26,    -1,   316,    -1,    -1,    -1,    -1,   321,   322,
-      -1,    -1,    -1,    38,    -1,    -1,    41,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    52,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,
-      -1,    -1,    67,    68,    69,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    79,    -1,    -1,    82,    -1,    -1,
-      85,    -1,    -1,    -1,    -1,    -1,    91,    -1,    -1,    -1,
-      -1,    96,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   110,    -1,    -1,   113,    -1,
-     115,   116,   117,    -1,   131,    -1,    -1,   122,   123,    -1,
+      -1,    -1,    -1,    -1,    -1,   138,   139,    -1,    -1,   142,
+      -1,   144,   145,   146,   147,   148,   149,   150,    -1,   152,
+      -1,   154,   155,   156,   157,   169,   159,    -1,   161,    -1,
+      -1,    -1,    -1,    -1,   167,    -1,    -1,   170,    -1,    -1,
+      -1,    -1,    -1,   187,   188,   189,   190,   191,   192,   193,
+     194,   195,   196,    -1,    -1,    -1,    -1,   201,   202,   203,
+     204,   205,   206,   207,   208,   209,   210,   211,   212,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   139,   140,    -1,    -1,   143,    -1,
-     145,   146,   147,   148,   149,   150,   151,    -1,   153,    -1,
-     155,   156,   157,   158,   171,   160,    -1,   162,    -1,    -1,
-      -1,    -1,    -1,   168,    -1,    -1,    -1,   172,    -1,    -1,
-      -1,    -1,   189,   190,   191,   192,   193,    -1,    -1,    -1,
-     197,   198,   199,   200,   201,    -1,   203,   204,   205,   206,
-     207,   208,   209,   210,   211,   212,   213,   214,   203,    -1,
+     213,   214,    -1,    -1,    -1,    -1,    -1,    -1,   221,    -1,
+      -1,    -1,   225,   226,   227,   228,    -1,    -1,   231,    -1,
+      -1,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,    -1,   245,    -1,    -1,    -1,    -1,    -1,   251,    -1,
+      -1,   254,    -1,    -1,    -1,   258,    -1,    -1,   261,   262,
+      -1,   264,    -1,    -1,   267,    -1,   269,    -1,    -1,    -1,
+     273,   274,     4,     5,     6,     7,     8,     9,   281,   282,
+     283,   284,    -1,    -1,    -1,    -1,    -1,    -1,   291,    21,
+      22,    -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,    40,    -1,
+      -1,    -1,   315,    -1,    -1,    -1,    -1,   320,   321,    51,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     215,   216,    -1,    -1,    -1,    -1,    -1,    -1,   223,    -1,
-      -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,   233,    -1,
-      -1,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,    -1,   247,    -1,    -1,    -1,    -1,    -1,   253,    -1,
-      -1,   256,    -1,    -1,    -1,   260,    -1,    -1,   263,   264,
-      -1,   266,    -1,    -1,   269,    -1,   271,    -1,    -1,    -1,
-     275,   276,    -1,    -1,    -1,    -1,    -1,   282,   283,   284,
-     285,    -1,    -1,    -1,    -1,    -1,    -1,   292,     5,     6,
-       7,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    22,    23,    -1,    -1,    26,
-      -1,   316,    -1,    -1,    -1,    -1,   321,   322,    -1,    -1,
-      -1,    38,    -1,    -1,    41,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    52,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,    -1,    -1,
-      67,    68,    69,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    79,    -1,    -1,    82,    -1,    -1,    85,    -1,
-      -1,    -1,    -1,    -1,    91,    -1,    -1,    -1,    -1,    96,
-      97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   110,    -1,    -1,   113,    -1,   115,   116,
-     117,    -1,   131,    -1,    -1,   122,   123,    -1,    -1,    -1,
+      62,    -1,    -1,    -1,    66,    67,    68,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,    81,
+      -1,    -1,    84,    -1,    -1,    -1,    -1,    -1,    90,    -1,
+      -1,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   109,    -1,    -1,
+     112,    -1,   114,   115,   116,    -1,    -1,    -1,    -1,   121,
+     122,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   138,   139,    -1,    -1,
+     142,    -1,   144,   145,   146,   147,   148,   149,   150,    -1,
+     152,    -1,   154,   155,   156,   157,    -1,   159,    -1,   161,
+      -1,    -1,    -1,    -1,    -1,   167,    -1,    -1,   170,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   139,   140,    -1,    -1,   143,    -1,   145,   146,
-     147,   148,   149,   150,   151,    -1,   153,    -1,   155,   156,
-     157,   158,   171,   160,    -1,   162,    -1,    -1,    -1,    -1,
-      -1,   168,    -1,    -1,    -1,   172,    -1,    -1,    -1,    -1,
-     189,   190,   191,   192,   193,    -1,    -1,    -1,   197,   198,
-     199,   200,   201,    -1,   203,   204,   205,   206,   207,   208,
-     209,   210,   211,   212,   213,   214,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   215,   216,
-      -1,    -1,    -1,    -1,    -1,    -1,   223,    -1,    -1,    -1,
-     227,    -1,    -1,    -1,    -1,    -1,   233,    -1,    -1,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,    -1,
-     247,    -1,    -1,    -1,    -1,    -1,   253,    -1,    -1,   256,
-      -1,    -1,    -1,   260,    -1,    -1,   263,   264,    -1,   266,
-      -1,    -1,   269,    -1,   271,    -1,    -1,    -1,   275,   276,
-      -1,    -1,    -1,    -1,    -1,   282,   283,   284,   285,    -1,
-      -1,    -1,    -1,    -1,    -1,   292,     5,     6,     7,     8,
-       9,    10,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    22,    23,    -1,    -1,    26,    -1,   316,
-      -1,    -1,    -1,    -1,   321,   322,    -1,    -1,    -1,    38,
-      -1,    -1,    41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    52,    -1,    -1,    55,    56,    57,    -1,
-      -1,    -1,    -1,    -1,    63,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      79,    -1,    -1,    82,    -1,    -1,    85,    -1,    -1,    -1,
-      -1,    -1,    91,    -1,    -1,    -1,    -1,    96,    97,    98,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   110,    -1,    -1,   113,    -1,   115,   116,   117,    -1,
-     131,    -1,    -1,   122,   123,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     139,   140,    -1,    -1,   143,    -1,   145,   146,   147,   148,
-     149,   150,   151,    -1,   153,    -1,   155,   156,   157,   158,
-     171,   160,    -1,   162,    -1,    -1,    -1,    -1,    -1,   168,
-      -1,    -1,    -1,   172,    -1,    -1,    -1,    -1,   189,   190,
-     191,   192,   193,    -1,    -1,    -1,   197,   198,   199,   200,
-     201,    -1,   203,   204,   205,   206,   207,   208,   209,   210,
-     211,   212,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   215,   216,    -1,    -1,
-      -1,    -1,    -1,    -1,   223,    -1,    -1,    -1,   227,    -1,
-      -1,    -1,    -1,    -1,   233,    -1,    -1,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,    -1,   247,    -1,
-      -1,    -1,    -1,    -1,   253,    -1,    -1,   256,    -1,    -1,
-      -1,   260,    -1,    -1,   263,   264,    -1,   266,    -1,    -1,
-     269,    -1,   271,    -1,    -1,    -1,   275,   276,    -1,    -1,
-      -1,    -1,    -1,   282,   283,   284,   285,    -1,    -1,    -1,
-      -1,    -1,    -1,   292,     5,     6,     7,     8,     9,    10,
+      -1,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,   221,
+      -1,    -1,    -1,   225,    -1,    -1,    -1,    -1,    -1,   231,
+      -1,    -1,   234,   235,   236,   237,   238,   239,   240,   241,
+     242,   243,    -1,   245,    -1,    -1,    -1,    -1,    -1,   251,
+      -1,    -1,   254,    -1,    -1,    -1,   258,    -1,    -1,   261,
+     262,    -1,   264,    -1,    -1,   267,    -1,   269,    -1,    -1,
+      -1,   273,   274,     4,     5,     6,     7,     8,     9,   281,
+     282,   283,   284,    -1,    -1,    -1,    -1,    -1,    -1,   291,
+      21,    22,    -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,    40,
+      -1,    -1,    -1,   315,    -1,    -1,    -1,    -1,   320,   321,
+      51,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    62,    -1,    -1,    65,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,
+      81,    -1,    -1,    84,    -1,    -1,    -1,    -1,    -1,    90,
+      -1,    -1,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   109,    -1,
+      -1,   112,    -1,   114,   115,   116,    -1,    -1,    -1,    -1,
+     121,   122,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   138,   139,    -1,
+      -1,   142,    -1,   144,   145,   146,   147,   148,   149,   150,
+      -1,   152,    -1,   154,   155,   156,   157,    -1,   159,    -1,
+     161,    -1,    -1,    -1,    -1,    -1,   167,   168,    -1,   170,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    22,    23,    -1,    -1,    26,    -1,   316,    -1,    -1,
-      -1,    -1,   321,   322,    -1,    -1,    -1,    38,    -1,    -1,
-      41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    52,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    79,    -1,
-      -1,    82,    -1,    -1,    85,    -1,    -1,    -1,    -1,    -1,
-      91,    -1,    -1,    -1,    -1,    96,    97,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,
-      -1,    -1,   113,    -1,   115,   116,   117,    -1,   131,    -1,
-      -1,   122,   123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   139,   140,
-      -1,    -1,   143,    -1,   145,   146,   147,   148,   149,   150,
-     151,    -1,   153,    -1,   155,   156,   157,   158,   171,   160,
-      -1,   162,    -1,    -1,    -1,    -1,    -1,   168,    -1,    -1,
-      -1,   172,    -1,    -1,    -1,    -1,   189,   190,   191,   192,
-     193,    -1,    -1,    -1,   197,   198,   199,   200,   201,    -1,
-     203,   204,   205,   206,   207,   208,   209,   210,   211,   212,
-     213,   214,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   215,   216,    -1,    -1,    -1,    -1,
-      -1,    -1,   223,    -1,    -1,    -1,   227,   228,   229,   230,
-      -1,    -1,   233,    -1,    -1,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,    -1,   247,    -1,    -1,    -1,
-      -1,    -1,   253,    -1,    -1,   256,    -1,    -1,    -1,   260,
-      -1,    -1,   263,   264,    -1,   266,    -1,    -1,   269,    -1,
-     271,    -1,    -1,    -1,   275,   276,    -1,    -1,    -1,    -1,
-      -1,   282,   283,   284,   285,    -1,    -1,    -1,    -1,    -1,
-      -1,   292,     5,     6,     7,     8,     9,    10,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,
-      23,    -1,    -1,    26,    -1,   316,    -1,    -1,    -1,    -1,
-     321,   322,    -1,    -1,    -1,    38,    -1,    -1,    41,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    52,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      63,    -1,    -1,    -1,    67,    68,    69,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    79,    -1,    -1,    82,
-      -1,    -1,    85,    -1,    -1,    -1,    -1,    -1,    91,    -1,
-      -1,    -1,    -1,    96,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,    -1,
-     113,    -1,   115,   116,   117,    -1,   131,    -1,    -1,   122,
-     123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   139,   140,    -1,    -1,
-     143,    -1,   145,   146,   147,   148,   149,   150,   151,    -1,
-     153,    -1,   155,   156,   157,   158,   171,   160,    -1,   162,
-      -1,    -1,    -1,    -1,    -1,   168,    -1,    -1,    -1,   172,
-      -1,    -1,    -1,    -1,   189,   190,   191,   192,   193,    -1,
-      -1,    -1,   197,   198,   199,   200,   201,    -1,   203,   204,
-     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   215,   216,    -1,    -1,    -1,    -1,    -1,    -1,
-     223,    -1,    -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,
-     233,    -1,    -1,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,    -1,   247,    -1,    -1,    -1,    -1,    -1,
-     253,    -1,    -1,   256,    -1,    -1,    -1,   260,    -1,    -1,
-     263,   264,    -1,   266,    -1,    -1,   269,    -1,   271,    -1,
-      -1,    -1,   275,   276,    -1,    -1,    -1,    -1,    -1,   282,
-     283,   284,   285,    -1,    -1,    -1,    -1,    -1,    -1,   292,
-       5,     6,     7,     8,     9,    10,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    -1,
-      -1,    26,    -1,   316,    -1,    -1,    -1,    -1,   321,   322,
-      -1,    -1,    -1,    38,    -1,    -1,    41,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    52,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,
-      -1,    66,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    79,    -1,    -1,    82,    -1,    -1,
-      85,    -1,    -1,    -1,    -1,    -1,    91,    -1,    -1,    -1,
-      -1,    96,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   110,    -1,    -1,   113,    -1,
-     115,   116,   117,   131,    -1,    -1,    -1,   122,   123,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   139,   140,    -1,    -1,   143,    -1,
-     145,   146,   147,   148,   149,   150,   151,    -1,   153,    -1,
-     155,   156,   157,   158,    -1,   160,    -1,   162,    -1,    -1,
-      -1,    -1,    -1,   168,    -1,   170,    -1,   172,    -1,    -1,
-      -1,   189,   190,   191,   192,   193,    -1,    -1,    -1,   197,
-     198,   199,   200,   201,    -1,   203,   204,   205,   206,   207,
-     208,   209,   210,   211,   212,   213,   214,    -1,    -1,    -1,
+      -1,    -1,   213,   214,    -1,    -1,    -1,    -1,    -1,    -1,
+     221,    -1,    -1,    -1,   225,    -1,    -1,    -1,    -1,    -1,
+     231,    -1,    -1,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,    -1,   245,    -1,    -1,    -1,    -1,    -1,
+     251,    -1,    -1,   254,    -1,    -1,    -1,   258,    -1,    -1,
+     261,   262,    -1,   264,    -1,    -1,   267,    -1,   269,    -1,
+      -1,    -1,   273,   274,     4,     5,     6,     7,     8,     9,
+     281,   282,   283,   284,    -1,    -1,    -1,    -1,    -1,    -1,
+     291,    21,    22,    -1,    -1,    25,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,
+      40,    -1,    -1,    -1,   315,    -1,    -1,    -1,    -1,   320,
+     321,    51,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    62,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,
+      -1,    81,    -1,    -1,    84,    -1,    -1,    -1,    -1,    -1,
+      90,    -1,    -1,    -1,    -1,    95,    96,    97,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   109,
+      -1,    -1,   112,    -1,   114,   115,   116,    -1,    -1,    -1,
+      -1,   121,   122,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   138,   139,
+      -1,    -1,   142,    -1,   144,   145,   146,   147,   148,   149,
+     150,    -1,   152,    -1,   154,   155,   156,   157,    -1,   159,
+      -1,   161,    -1,    -1,    -1,    -1,    -1,   167,    -1,    -1,
+     170,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     180,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     215,   216,    -1,    -1,    -1,    -1,    -1,    -1,   223,    -1,
-      -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,   233,    -1,
-      -1,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,    -1,   247,    -1,    -1,    -1,    -1,    -1,   253,    -1,
-      -1,   256,    -1,    -1,    -1,   260,    -1,    -1,   263,   264,
-      -1,   266,    -1,    -1,   269,    -1,   271,    -1,    -1,    -1,
-     275,   276,    -1,    -1,    -1,    -1,    -1,   282,   283,   284,
-     285,    -1,    -1,    -1,    -1,    -1,    -1,   292,     5,     6,
-       7,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    22,    23,    -1,    -1,    26,
-      -1,   316,    -1,    -1,    -1,    -1,   321,   322,    -1,    -1,
-      -1,    38,    -1,    -1,    41,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    52,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    79,    -1,    -1,    82,    -1,    -1,    85,    -1,
-      -1,    -1,    -1,    -1,    91,    -1,    -1,    -1,    -1,    96,
-      97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   110,    -1,    -1,   113,    -1,   115,   116,
-     117,    -1,    -1,    -1,    -1,   122,   123,    -1,    -1,    -1,
+      -1,    -1,    -1,   213,   214,    -1,    -1,    -1,    -1,    -1,
+      -1,   221,    -1,   223,    -1,   225,    -1,    -1,    -1,    -1,
+      -1,   231,    -1,    -1,   234,   235,   236,   237,   238,   239,
+     240,   241,   242,   243,    -1,   245,    -1,    -1,    -1,    -1,
+      -1,   251,    -1,    -1,   254,    -1,    -1,    -1,   258,    -1,
+      -1,   261,   262,    -1,   264,    -1,    -1,   267,    -1,   269,
+      -1,    -1,    -1,   273,   274,     4,     5,     6,     7,     8,
+       9,   281,   282,   283,   284,    -1,    -1,    -1,    -1,    -1,
+      -1,   291,    21,    22,    -1,    -1,    25,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,    -1,
+      -1,    40,    -1,    -1,    -1,   315,    -1,    -1,    -1,    -1,
+     320,   321,    51,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    62,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,
+      -1,    -1,    81,    -1,    -1,    84,    -1,    -1,    -1,    -1,
+      -1,    90,    -1,    -1,    -1,    -1,    95,    96,    97,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   139,   140,    -1,    -1,   143,    -1,   145,   146,
-     147,   148,   149,   150,   151,    -1,   153,    -1,   155,   156,
-     157,   158,    -1,   160,    -1,   162,    -1,    -1,    -1,    -1,
-      -1,   168,    -1,    -1,    -1,   172,    -1,    -1,    -1,    -1,
-      -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     109,    -1,    -1,   112,    -1,   114,   115,   116,    -1,    -1,
+      -1,    -1,   121,   122,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   138,
+     139,    -1,    -1,   142,    -1,   144,   145,   146,   147,   148,
+     149,   150,    -1,   152,    -1,   154,   155,   156,   157,    -1,
+     159,    -1,   161,    -1,    -1,    -1,    -1,    -1,   167,    -1,
+      -1,   170,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   215,   216,
-      -1,    -1,    -1,    -1,    -1,    -1,   223,    -1,   225,    -1,
-     227,    -1,    -1,    -1,    -1,    -1,   233,    -1,    -1,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,    -1,
-     247,    -1,    -1,    -1,    -1,    -1,   253,    -1,    -1,   256,
-      -1,    -1,    -1,   260,    -1,    -1,   263,   264,    -1,   266,
-      -1,    -1,   269,    -1,   271,    -1,    -1,    -1,   275,   276,
-      -1,    -1,    -1,    -1,    -1,   282,   283,   284,   285,    -1,
-      -1,    -1,    -1,    -1,    -1,   292,     5,     6,     7,     8,
-       9,    10,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    22,    23,    -1,    -1,    26,    -1,   316,
-      -1,    -1,    -1,    -1,   321,   322,    -1,    -1,    -1,    38,
-      -1,    -1,    41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    52,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    63,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      79,    -1,    -1,    82,    -1,    -1,    85,    -1,    -1,    -1,
-      -1,    -1,    91,    -1,    -1,    -1,    -1,    96,    97,    98,
+      -1,    -1,    -1,    -1,   213,   214,    -1,    -1,    -1,    -1,
+      -1,    -1,   221,    -1,    -1,    -1,   225,    -1,    -1,    -1,
+      -1,    -1,   231,    -1,    -1,   234,   235,   236,   237,   238,
+     239,   240,   241,   242,   243,    -1,   245,    -1,    -1,    -1,
+      -1,    -1,   251,    -1,    -1,   254,    -1,    -1,    -1,   258,
+      -1,    -1,   261,   262,    -1,   264,    -1,    -1,   267,   268,
+     269,    -1,    -1,    -1,   273,   274,     4,     5,     6,     7,
+       8,     9,   281,   282,   283,   284,    -1,    -1,    -1,    -1,
+      -1,    -1,   291,    21,    22,    -1,    -1,    25,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,
+      -1,    -1,    40,    -1,    -1,    -1,   315,    -1,    -1,    -1,
+      -1,   320,   321,    51,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    62,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   110,    -1,    -1,   113,    -1,   115,   116,   117,    -1,
-      -1,    -1,    -1,   122,   123,    -1,    -1,    -1,    -1,    -1,
+      78,    -1,    -1,    81,    -1,    -1,    84,    -1,    -1,    -1,
+      -1,    -1,    90,    -1,    -1,    -1,    -1,    95,    96,    97,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     139,   140,    -1,    -1,   143,    -1,   145,   146,   147,   148,
-     149,   150,   151,    -1,   153,    -1,   155,   156,   157,   158,
-      -1,   160,    -1,   162,    -1,    -1,    -1,    -1,    -1,   168,
-      -1,    -1,    -1,   172,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   109,    -1,    -1,   112,    -1,   114,   115,   116,    -1,
+      -1,    -1,    -1,   121,   122,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     138,   139,    -1,    -1,   142,    -1,   144,   145,   146,   147,
+     148,   149,   150,    -1,   152,    -1,   154,   155,   156,   157,
+      -1,   159,    -1,   161,    -1,    -1,    -1,    -1,    -1,   167,
+     168,    -1,   170,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   215,   216,    -1,    -1,
-      -1,    -1,    -1,    -1,   223,    -1,    -1,    -1,   227,    -1,
-      -1,    -1,    -1,    -1,   233,    -1,    -1,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,    -1,   247,    -1,
-      -1,    -1,    -1,    -1,   253,    -1,    -1,   256,    -1,    -1,
-      -1,   260,    -1,    -1,   263,   264,    -1,   266,    -1,    -1,
-     269,   270,   271,    -1,    -1,    -1,   275,   276,    -1,    -1,
-      -1,    -1,    -1,   282,   283,   284,   285,    -1,    -1,    -1,
-      -1,    -1,    -1,   292,     5,     6,     7,     8,     9,    10,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    22,    23,    -1,    -1,    26,    -1,   316,    -1,    -1,
-      -1,    -1,   321,   322,    -1,    -1,    -1,    38,    -1,    -1,
-      41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    52,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    79,    -1,
-      -1,    82,    -1,    -1,    85,    -1,    -1,    -1,    -1,    -1,
-      91,    -1,    -1,    -1,    -1,    96,    97,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,
-      -1,    -1,   113,    -1,   115,   116,   117,    -1,    -1,    -1,
-      -1,   122,   123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   139,   140,
-      -1,    -1,   143,    -1,   145,   146,   147,   148,   149,   150,
-     151,    -1,   153,    -1,   155,   156,   157,   158,    -1,   160,
-      -1,   162,    -1,    -1,    -1,    -1,    -1,   168,    -1,   170,
-      -1,   172,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   213,   214,    -1,    -1,    -1,
+      -1,    -1,    -1,   221,    -1,    -1,    -1,   225,    -1,    -1,
+      -1,    -1,    -1,   231,    -1,    -1,   234,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,    -1,   245,    -1,    -1,
+      -1,    -1,    -1,   251,    -1,    -1,   254,    -1,    -1,    -1,
+     258,    -1,    -1,   261,   262,    -1,   264,    -1,    -1,   267,
+      -1,   269,    -1,    -1,    -1,   273,   274,     4,     5,     6,
+       7,     8,     9,   281,   282,   283,   284,    -1,    -1,    -1,
+      -1,    -1,    -1,   291,    21,    22,    -1,    -1,    25,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      37,    -1,    -1,    40,    -1,    -1,    -1,   315,    -1,    -1,
+      -1,    -1,   320,   321,    51,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    62,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    78,    -1,    -1,    81,    -1,    -1,    84,    -1,    -1,
+      -1,    -1,    -1,    90,    -1,    -1,    -1,    -1,    95,    96,
+      97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   109,    -1,    -1,   112,    -1,   114,   115,   116,
+      -1,    -1,    -1,    -1,   121,   122,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   215,   216,    -1,    -1,    -1,    -1,
-      -1,    -1,   223,    -1,    -1,    -1,   227,    -1,    -1,    -1,
-      -1,    -1,   233,    -1,    -1,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,    -1,   247,    -1,    -1,    -1,
-      -1,    -1,   253,    -1,    -1,   256,    -1,    -1,    -1,   260,
-      -1,    -1,   263,   264,    -1,   266,    -1,    -1,   269,    -1,
-     271,    -1,    -1,    -1,   275,   276,    -1,    -1,    -1,    -1,
-      -1,   282,   283,   284,   285,    -1,    -1,    -1,    -1,    -1,
-      -1,   292,     5,     6,     7,     8,     9,    10,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,
-      23,    -1,    -1,    26,    -1,   316,    -1,    -1,    -1,    -1,
-     321,   322,    -1,    -1,    -1,    38,    -1,    -1,    41,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    52,
+      -1,   138,   139,    -1,    -1,   142,    -1,   144,   145,   146,
+     147,   148,   149,   150,    -1,   152,    -1,   154,   155,   156,
+     157,    -1,   159,    -1,   161,    -1,    -1,    -1,    -1,    -1,
+     167,    -1,    -1,   170,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    79,    -1,    -1,    82,
-      -1,    -1,    85,    -1,    -1,    -1,    -1,    -1,    91,    -1,
-      -1,    -1,    -1,    96,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,    -1,
-     113,    -1,   115,   116,   117,    -1,    -1,    -1,    -1,   122,
-     123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   139,   140,    -1,    -1,
-     143,    -1,   145,   146,   147,   148,   149,   150,   151,    -1,
-     153,    -1,   155,   156,   157,   158,    -1,   160,    -1,   162,
-      -1,    -1,    -1,    -1,    -1,   168,    -1,    -1,    -1,   172,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   201,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   213,   214,    -1,    -1,
+      -1,    -1,    -1,    -1,   221,    -1,    -1,    -1,   225,    -1,
+      -1,    -1,    -1,    -1,   231,    -1,    -1,   234,   235,   236,
+     237,   238,   239,   240,   241,   242,   243,    -1,   245,    -1,
+      -1,    -1,    -1,    -1,   251,    -1,    -1,   254,    -1,    -1,
+      -1,   258,    -1,    -1,   261,   262,    -1,   264,    -1,    -1,
+     267,    -1,   269,    -1,    -1,    -1,   273,   274,     4,     5,
+       6,     7,     8,     9,   281,   282,   283,   284,    -1,    -1,
+      -1,    -1,    -1,    -1,   291,    21,    22,    -1,    -1,    25,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    37,    -1,    -1,    40,    -1,    -1,    -1,   315,    -1,
+      -1,    -1,    -1,   320,   321,    51,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    62,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     203,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   215,   216,    -1,    -1,    -1,    -1,    -1,    -1,
-     223,    -1,    -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,
-     233,    -1,    -1,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,    -1,   247,    -1,    -1,    -1,    -1,    -1,
-     253,    -1,    -1,   256,    -1,    -1,    -1,   260,    -1,    -1,
-     263,   264,    -1,   266,    -1,    -1,   269,    -1,   271,    -1,
-      -1,    -1,   275,   276,    -1,    -1,    -1,    -1,    -1,   282,
-     283,   284,   285,    -1,    -1,    -1,    -1,    -1,    -1,   292,
-       5,     6,     7,     8,     9,    10,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    -1,
-      -1,    26,    -1,   316,    -1,    -1,    -1,    -1,   321,   322,
-      -1,    -1,    -1,    38,    -1,    -1,    41,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    52,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,
+      -1,    -1,    78,    -1,    -1,    81,    -1,    -1,    84,    -1,
+      -1,    -1,    -1,    -1,    90,    -1,    -1,    -1,    -1,    95,
+      96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   109,    -1,    -1,   112,    -1,   114,   115,
+     116,    -1,    -1,    -1,    -1,   121,   122,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    79,    -1,    -1,    82,    -1,    -1,
-      85,    -1,    -1,    -1,    -1,    -1,    91,    -1,    -1,    -1,
-      -1,    96,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   110,    -1,    -1,   113,    -1,
-     115,   116,   117,    -1,    -1,    -1,    -1,   122,   123,    -1,
+      -1,    -1,   138,   139,    -1,    -1,   142,    -1,   144,   145,
+     146,   147,   148,   149,   150,    -1,   152,    -1,   154,   155,
+     156,   157,    -1,   159,    -1,   161,    -1,    -1,    -1,    -1,
+      -1,   167,    -1,    -1,   170,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   139,   140,    -1,    -1,   143,    -1,
-     145,   146,   147,   148,   149,   150,   151,    -1,   153,    -1,
-     155,   156,   157,   158,    -1,   160,    -1,   162,    -1,    -1,
-      -1,    -1,    -1,   168,    -1,    -1,    -1,   172,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   213,   214,    -1,
+      -1,    -1,    -1,    -1,    -1,   221,    -1,   223,    -1,   225,
+      -1,    -1,    -1,    -1,    -1,   231,    -1,    -1,   234,   235,
+     236,   237,   238,   239,   240,   241,   242,   243,    -1,   245,
+      -1,    -1,    -1,    -1,    -1,   251,    -1,    -1,   254,    -1,
+      -1,    -1,   258,    -1,    -1,   261,   262,    -1,   264,    -1,
+      -1,   267,    -1,   269,    -1,    -1,    -1,   273,   274,     4,
+       5,     6,     7,     8,     9,   281,   282,   283,   284,    -1,
+      -1,    -1,    -1,    -1,    -1,   291,    21,    22,    -1,    -1,
+      25,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    37,    -1,    -1,    40,    -1,    -1,    -1,   315,
+      -1,    -1,    -1,    -1,   320,   321,    51,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    62,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    78,    -1,    -1,    81,    -1,    -1,    84,
+      -1,    -1,    -1,    -1,    -1,    90,    -1,    -1,    -1,    -1,
+      95,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   109,    -1,    -1,   112,    -1,   114,
+     115,   116,    -1,    -1,    -1,    -1,   121,   122,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     215,   216,    -1,    -1,    -1,    -1,    -1,    -1,   223,    -1,
-     225,    -1,   227,    -1,    -1,    -1,    -1,    -1,   233,    -1,
-      -1,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,    -1,   247,    -1,    -1,    -1,    -1,    -1,   253,    -1,
-      -1,   256,    -1,    -1,    -1,   260,    -1,    -1,   263,   264,
-      -1,   266,    -1,    -1,   269,    -1,   271,    -1,    -1,    -1,
-     275,   276,    -1,    -1,    -1,    -1,    -1,   282,   283,   284,
-     285,    -1,    -1,    -1,    -1,    -1,    -1,   292,     5,     6,
-       7,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    22,    23,    -1,    -1,    26,
-      -1,   316,    -1,    -1,    -1,    -1,   321,   322,    -1,    -1,
-      -1,    38,    -1,    -1,    41,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    52,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,    -1,    -1,
+      -1,    -1,    -1,   138,   139,    -1,    -1,   142,    -1,   144,
+     145,   146,   147,   148,   149,   150,    -1,   152,    -1,   154,
+     155,   156,   157,    -1,   159,    -1,   161,    -1,    -1,    -1,
+      -1,    -1,   167,    -1,    -1,   170,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    79,    -1,    -1,    82,    -1,    -1,    85,    -1,
-      -1,    -1,    -1,    -1,    91,    -1,    -1,    -1,    -1,    96,
-      97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   110,    -1,    -1,   113,    -1,   115,   116,
-     117,    -1,    -1,    -1,    -1,   122,   123,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   139,   140,    -1,    -1,   143,    -1,   145,   146,
-     147,   148,   149,   150,   151,    -1,   153,    -1,   155,   156,
-     157,   158,    -1,   160,    -1,   162,    -1,    -1,    -1,    -1,
-      -1,   168,    -1,    -1,    -1,   172,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   213,   214,
+      -1,    -1,    -1,    -1,    -1,    -1,   221,    -1,    -1,    -1,
+     225,    -1,    -1,    -1,    -1,    -1,   231,    -1,    -1,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,    -1,
+     245,    -1,    -1,    -1,    -1,    -1,   251,    -1,    -1,   254,
+      -1,    -1,    -1,   258,    -1,    -1,   261,   262,    -1,   264,
+      -1,    -1,   267,    -1,   269,    -1,    -1,    -1,   273,   274,
+       4,     5,     6,     7,     8,     9,   281,   282,   283,   284,
+      -1,    -1,    -1,    -1,    -1,    -1,   291,    21,    22,    -1,
+      -1,    25,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    37,    -1,    -1,    40,    -1,    -1,    -1,
+     315,    -1,    -1,    -1,    -1,   320,   321,    51,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    62,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    -1,    -1,    81,    -1,    -1,
+      84,    -1,    -1,    -1,    -1,    -1,    90,    -1,    -1,    -1,
+      -1,    95,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   109,    -1,    -1,   112,    -1,
+     114,   115,   116,    -1,    -1,    -1,    -1,   121,   122,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   215,   216,
-      -1,    -1,    -1,    -1,    -1,    -1,   223,    -1,    -1,    -1,
-     227,    -1,    -1,    -1,    -1,    -1,   233,    -1,    -1,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,    -1,
-     247,    -1,    -1,    -1,    -1,    -1,   253,    -1,    -1,   256,
-      -1,    -1,    -1,   260,    -1,    -1,   263,   264,    -1,   266,
-      -1,    -1,   269,    -1,   271,    -1,    -1,    -1,   275,   276,
-      -1,    -1,    -1,    -1,    -1,   282,   283,   284,   285,    -1,
-      -1,    -1,    -1,    -1,    -1,   292,     5,     6,     7,     8,
-       9,    10,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    22,    23,    -1,    -1,    26,    -1,   316,
-      -1,    -1,    -1,    -1,   321,   322,    -1,    -1,    -1,    38,
-      -1,    -1,    41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    52,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    63,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   138,   139,    -1,    -1,   142,    -1,
+     144,   145,   146,   147,   148,   149,   150,    -1,   152,    -1,
+     154,   155,   156,   157,    -1,   159,    -1,   161,    -1,    -1,
+      -1,    -1,    -1,   167,    -1,    -1,   170,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      79,    -1,    -1,    82,    -1,    -1,    85,    -1,    -1,    -1,
-      -1,    -1,    91,    -1,    -1,    -1,    -1,    96,    97,    98,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   110,    -1,    -1,   113,    -1,   115,   116,   117,    -1,
-      -1,    -1,    -1,   122,   123,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     139,   140,    -1,    -1,   143,    -1,   145,   146,   147,   148,
-     149,   150,   151,    -1,   153,    -1,   155,   156,   157,   158,
-      -1,   160,    -1,   162,    -1,    -1,    -1,    -1,    -1,   168,
-      -1,    -1,    -1,   172,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   213,
+     214,    -1,    -1,    -1,    -1,    -1,    -1,   221,    -1,    -1,
+      -1,   225,    -1,    -1,    -1,    -1,    -1,   231,    -1,    -1,
+     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
+      -1,   245,    -1,    -1,    -1,    -1,    -1,   251,    -1,    -1,
+     254,    -1,    -1,    -1,   258,    -1,    -1,   261,   262,    -1,
+     264,    -1,    -1,   267,    -1,   269,    -1,    -1,    -1,   273,
+     274,     4,     5,     6,     7,     8,     9,   281,   282,   283,
+     284,    -1,    -1,    -1,    -1,    -1,    -1,   291,    21,    22,
+      -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    37,    -1,    -1,    40,    -1,    -1,
+      -1,   315,    -1,    -1,    -1,    -1,   320,   321,    51,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    62,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,    81,    -1,
+      -1,    84,    -1,    -1,    -1,    -1,    -1,    90,    -1,    -1,
+      -1,    -1,    95,    96,    97,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   109,    -1,    -1,   112,
+      -1,   114,   115,   116,    -1,    -1,    -1,    -1,   121,   122,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   138,   139,    -1,    -1,   142,
+      -1,   144,   145,   146,   147,   148,   149,   150,    -1,   152,
+      -1,   154,   155,   156,   157,    -1,   159,    -1,   161,    -1,
+      -1,    -1,    -1,    -1,   167,    -1,    -1,   170,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   215,   216,    -1,    -1,
-      -1,    -1,    -1,    -1,   223,    -1,    -1,    -1,   227,    -1,
-      -1,    -1,    -1,    -1,   233,    -1,    -1,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,    -1,   247,    -1,
-      -1,    -1,    -1,    -1,   253,    -1,    -1,   256,    -1,    -1,
-      -1,   260,    -1,    -1,   263,   264,    -1,   266,    -1,    -1,
-     269,    -1,   271,    -1,    -1,    -1,   275,   276,    -1,    -1,
-      -1,    -1,    -1,   282,   283,   284,   285,    -1,    -1,    -1,
-      -1,    -1,    -1,   292,     5,     6,     7,     8,     9,    10,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    22,    23,    -1,    -1,    26,    -1,   316,    -1,    -1,
-      -1,    -1,   321,   322,    -1,    -1,    -1,    38,    -1,    -1,
-      41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    52,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    79,    -1,
-      -1,    82,    -1,    -1,    85,    -1,    -1,    -1,    -1,    -1,
-      91,    -1,    -1,    -1,    -1,    96,    97,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,
-      -1,    -1,   113,    -1,   115,   116,   117,    -1,    -1,    -1,
-      -1,   122,   123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   139,   140,
-      -1,    -1,   143,    -1,   145,   146,   147,   148,   149,   150,
-     151,    -1,   153,    -1,   155,   156,   157,   158,    -1,   160,
-      -1,   162,    -1,    -1,    -1,    -1,    -1,   168,    -1,    -1,
-      -1,   172,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     213,   214,    -1,    -1,    -1,    -1,    -1,    -1,   221,    -1,
+      -1,    -1,   225,    -1,    -1,    -1,    -1,    -1,   231,    -1,
+      -1,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,    -1,   245,    -1,    -1,    -1,    -1,    -1,   251,    -1,
+      -1,   254,    -1,    -1,    -1,   258,    -1,    -1,   261,   262,
+      -1,   264,    -1,    -1,   267,    -1,   269,    -1,    -1,    -1,
+     273,   274,    -1,    -1,    -1,    -1,    -1,    -1,   281,   282,
+     283,   284,    -1,    -1,    -1,    -1,    -1,    -1,   291,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   215,   216,    -1,    -1,    -1,    -1,
-      -1,    -1,   223,    -1,    -1,    -1,   227,    -1,    -1,    -1,
-      -1,    -1,   233,    -1,    -1,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,    -1,   247,    -1,    -1,    -1,
-      -1,    -1,   253,    -1,    -1,   256,    -1,    -1,    -1,   260,
-      -1,    -1,   263,   264,    -1,   266,    -1,    -1,   269,    -1,
-     271,    -1,    -1,    -1,   275,   276,    -1,    -1,    -1,    -1,
-      -1,   282,   283,   284,   285,    -1,    -1,    -1,    -1,    -1,
-      -1,   292,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   316,    -1,    -1,    -1,    -1,
-     321,   322
+      -1,    -1,   315,    -1,    -1,    -1,    -1,   320,   321
 };
 
 /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
    symbol of state STATE-NUM.  */
 static const yytype_uint16 yystos[] =
 {
-       0,     1,    51,    64,    65,    66,    67,    76,    77,    78,
-      79,    85,   130,   169,   170,   226,   234,   235,   237,   239,
-     240,   241,   242,   243,   244,   245,   248,   254,   255,   270,
-     273,   309,   344,   351,   352,   353,   354,   355,   357,   359,
+       0,     1,    50,    63,    64,    65,    66,    75,    76,    77,
+      78,    84,   129,   168,   224,   232,   233,   235,   237,   238,
+     239,   240,   241,   242,   243,   246,   252,   253,   268,   271,
+     280,   308,   344,   351,   352,   353,   354,   355,   357,   359,
      360,   369,   374,   386,   391,   392,   398,   443,   445,   453,
      474,   488,   492,   493,   494,   502,   517,   518,   519,   536,
-     540,   541,   542,   545,   668,   130,   108,     5,     6,     7,
-       8,     9,    10,    22,    23,    26,    38,    41,    52,    63,
-      79,    82,    85,    91,    96,    97,    98,   110,   113,   115,
-     116,   117,   122,   123,   139,   140,   143,   145,   146,   147,
-     148,   149,   150,   151,   153,   155,   156,   157,   158,   160,
-     162,   168,   172,   215,   216,   223,   227,   233,   236,   237,
-     238,   239,   240,   241,   242,   243,   244,   245,   247,   253,
-     256,   260,   263,   264,   266,   269,   271,   275,   276,   282,
-     283,   284,   285,   292,   316,   321,   322,   633,   661,   662,
-     186,   247,   528,   258,    80,   499,   499,   661,    78,    86,
-     537,   538,   661,    66,   545,    67,    68,    69,   604,   605,
-     606,   661,   633,   347,   346,   349,   350,   348,   345,     5,
-      11,   666,   669,     5,     6,     7,     8,     9,    10,    64,
-      65,    66,    67,   186,   245,   268,   309,   370,   377,   378,
-     379,   381,   382,   383,   659,   660,   254,   257,   375,   376,
-      58,    86,    55,   112,   275,    11,   170,   294,   438,   439,
-     510,   536,   542,   649,   665,     0,    17,    55,    58,   112,
-     162,   215,   216,   217,   218,   219,   220,   227,   228,   229,
-     230,   256,   269,   275,   278,   280,   317,   399,   400,   403,
-     404,   437,    55,   112,   162,   186,   227,   228,   229,   230,
-     256,   269,   275,   280,   315,   317,   487,    55,    56,    57,
-      63,   256,   269,   283,   630,   661,   215,   216,   275,   358,
-     403,   435,   661,   130,   101,   165,   166,   167,   561,   130,
-     633,   270,   338,     3,     5,     6,     7,     8,     9,    10,
-      11,    12,    13,    14,    15,    18,    19,    27,    28,    44,
-      45,    46,    47,    48,    49,    50,    62,   103,   107,   111,
-     121,   131,   132,   133,   134,   135,   137,   138,   141,   142,
-     144,   154,   161,   170,   173,   189,   190,   194,   195,   196,
-     203,   206,   282,   283,   284,   285,   296,   300,   301,   340,
+     540,   541,   542,   545,   668,   129,   107,     4,     5,     6,
+       7,     8,     9,    21,    22,    25,    37,    40,    51,    62,
+      78,    81,    84,    90,    95,    96,    97,   109,   112,   114,
+     115,   116,   121,   122,   138,   139,   142,   144,   145,   146,
+     147,   148,   149,   150,   152,   154,   155,   156,   157,   159,
+     161,   167,   170,   213,   214,   221,   225,   231,   234,   235,
+     236,   237,   238,   239,   240,   241,   242,   243,   245,   251,
+     254,   258,   261,   262,   264,   267,   269,   273,   274,   281,
+     282,   283,   284,   291,   315,   320,   321,   633,   661,   662,
+     173,   245,   528,   256,    79,   499,   499,   661,    77,    85,
+      65,   545,    66,    67,    68,   604,   605,   606,   661,   633,
+     347,   346,   349,   350,   348,   345,     4,    10,   666,   669,
+       4,     5,     6,     7,     8,     9,    63,    64,    65,    66,
+     173,   243,   266,   308,   370,   377,   378,   379,   381,   382,
+     383,   659,   660,   252,   255,   375,   376,    57,    85,    54,
+     111,   273,   537,   538,   661,    10,   168,   293,   438,   439,
+     510,   536,   542,   649,   665,     0,    16,    54,    57,   111,
+     161,   213,   214,   215,   216,   217,   218,   225,   226,   227,
+     228,   254,   267,   273,   276,   278,   316,   399,   400,   403,
+     404,   437,    54,   111,   161,   173,   225,   226,   227,   228,
+     254,   267,   273,   278,   314,   316,   487,    54,    55,    56,
+      62,   254,   267,   282,   630,   661,   213,   214,   273,   358,
+     403,   435,   661,   129,   100,   162,   163,   164,   561,   129,
+     633,   268,   338,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    17,    18,    26,    27,    43,
+      44,    45,    46,    47,    48,    49,    61,   102,   106,   110,
+     120,   130,   131,   132,   133,   134,   136,   137,   140,   141,
+     143,   153,   160,   168,   171,   187,   188,   197,   198,   199,
+     201,   204,   281,   282,   283,   284,   295,   299,   300,   340,
      342,   524,   548,   559,   560,   568,   569,   570,   571,   573,
      575,   576,   578,   580,   582,   583,   584,   585,   586,   587,
      588,   589,   590,   603,   604,   607,   609,   610,   611,   613,
      614,   615,   616,   617,   630,   631,   632,   634,   635,   637,
      654,   657,   661,   667,   676,   677,   678,   679,   680,   694,
-     701,   703,   706,   716,   717,   747,   633,   187,   500,   500,
-     661,    87,    90,    96,   495,   496,   497,   337,   539,   542,
-     170,   441,   442,   528,   171,   170,   338,   441,   355,   355,
-     344,   344,   355,   355,   170,   441,   441,   266,   441,   108,
-     258,   277,   337,   277,   337,   261,   337,   262,   262,   377,
-     370,    86,   495,   270,   661,   633,   633,   438,   545,   649,
-     258,    27,   258,   294,   310,   215,   216,   661,   215,   216,
-     633,   229,   275,   275,   275,   275,   633,   633,   633,   633,
-     661,   223,   361,   661,   633,   633,   633,   315,   275,   661,
-     633,   229,   162,   228,   229,   230,   633,   633,   633,   633,
-     661,   633,   633,   633,   633,   633,    42,    43,   491,   223,
-     661,   661,   292,   174,   174,   337,     5,     6,     7,    20,
-      24,    25,    26,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    52,    53,    54,   282,   283,   284,   285,   337,
-     622,   629,   652,   654,   655,   656,   657,   102,   186,   247,
-     546,   546,   546,   293,   562,   281,   531,   442,   529,   530,
-     658,   661,   661,   667,   667,   667,   170,   170,    22,   170,
-     608,   608,   608,   608,   608,   170,   584,   170,   122,   661,
-     170,   170,   170,   170,   170,   170,   170,   170,   170,   170,
-     170,   170,   279,   536,   545,   559,   569,   577,   604,   661,
-     569,   170,   586,   586,   170,   170,   170,   586,   667,   170,
-     620,   170,   621,   189,   190,   618,   297,   586,   642,   643,
-     170,   170,   569,   581,   108,   258,   549,   550,   316,   612,
-     176,   174,   177,   178,   179,   180,   181,   182,   183,   184,
-     187,   188,   633,   131,   189,   190,   191,   192,   193,   197,
-     198,   199,   200,   201,   203,   204,   205,   206,   207,   208,
-     209,   210,   211,   212,   213,   214,   259,   327,   338,   337,
-     170,   170,   170,   667,   667,   338,   170,   246,   279,   439,
-     442,   520,    81,    82,   277,   501,    88,    89,    91,    97,
-     337,   538,   435,   316,   548,   171,   525,   586,   638,   606,
-     661,   295,   564,   130,   130,   130,   130,   170,   171,   523,
-     525,   527,   545,   267,   384,   385,   659,   659,   384,   379,
-     162,   275,   380,   487,   633,   383,   109,   109,   108,   108,
-     495,   251,   252,   401,   169,   250,   270,   387,   113,   114,
-     115,   116,   117,   118,   119,   120,   123,   316,   394,   396,
-     397,   248,   270,   273,   274,   171,   313,   667,   258,   633,
-     649,   294,   169,    85,   316,   393,   395,   397,   633,   633,
-     633,   633,   633,   232,   170,   170,   170,   169,   367,   362,
-     661,   246,   363,   223,   170,   406,   407,   441,   441,   319,
-     320,   475,   661,   633,   633,   229,   633,   633,   633,   491,
-     170,   489,   489,   489,   491,   491,   491,   661,    58,   285,
-     632,   661,   525,   435,   170,   170,    21,    22,   170,   170,
-     170,    38,   170,   620,   621,   286,   287,   288,   289,   290,
-     291,   623,   625,   627,   628,   661,   170,   170,   170,   170,
-     565,   566,   586,   164,   547,   547,   547,   588,   648,   664,
-     665,   294,   563,   559,   174,   337,   531,   174,   338,   559,
-     636,   636,    23,   171,   291,   623,   624,   109,   586,   587,
-     586,   673,   674,   675,   673,   233,   152,   695,   721,   149,
-     151,   719,   233,     3,   707,   587,   112,   718,   719,   673,
-     545,   170,   521,   171,   171,   171,   171,   337,   338,   586,
-     586,   586,   666,   169,   619,   666,   619,   667,   559,   297,
-     640,   641,   299,   642,   644,   586,   525,   639,   337,   341,
-     170,   340,   532,   551,   552,   553,   584,   604,   633,   661,
-     543,   544,   661,   531,   661,   559,   569,   574,   586,   574,
-     574,   574,   170,   170,    99,   100,   572,   572,   560,   175,
-     185,   186,   569,   579,   582,   586,   586,   586,   586,   586,
-     586,   586,   586,   586,   586,   586,   586,   586,   586,   174,
-     586,   586,   586,   586,   586,   586,   586,   586,   586,   107,
-     173,   170,   203,   611,   171,   186,   203,   247,   586,   645,
-     661,   645,     8,     9,    10,   203,   661,   279,   521,   520,
-      81,    78,    87,    94,    95,   498,   666,   497,   171,   170,
-     171,   337,    14,   588,   650,   664,   238,   356,   171,   337,
-     169,   337,   372,   169,   371,   633,   384,   384,   253,   401,
-     277,   269,   102,   169,   647,   665,   647,   647,   652,   396,
-     225,   275,   276,   389,   390,    67,    87,   388,   390,   275,
-     390,    16,   508,   509,   508,   633,   441,   310,   649,   401,
-     169,   652,   395,   170,   406,   406,   406,   406,   233,   203,
-     472,   473,   661,   472,   472,   257,    20,   264,   670,   671,
-     362,   179,   225,   409,   410,   411,   413,   416,   424,   425,
-     436,   658,   661,    98,   402,   316,   316,    64,    65,    67,
-     476,   261,   406,   489,   633,   491,   491,   491,   171,   490,
-     652,   652,   646,   666,   646,    23,   646,   646,   646,   666,
-      53,   653,   667,   619,   619,   621,   620,   277,   646,   666,
-     646,   646,   646,   337,   221,   222,   567,   102,   545,   545,
-     545,   588,   650,   564,   584,   530,   559,   661,   316,   337,
-     108,   633,   155,   720,   337,   720,   720,   661,   682,   170,
-     586,   696,   697,   698,   337,   587,   661,   704,   143,   708,
-     720,   673,   561,   171,   522,   525,   526,   171,   337,   181,
-     182,   569,   337,   181,   108,   337,   171,   283,   667,   171,
-     667,   628,   298,   586,   640,   644,   586,   308,   337,   337,
-     171,   337,   569,   170,   532,   553,   554,   337,    68,    69,
-      70,    72,    73,    74,    75,   163,   533,   534,   316,   555,
-     661,   555,   555,   338,   337,   549,   106,   556,   104,   523,
-     523,   569,   569,   584,   586,   107,   328,   591,   592,   645,
-     171,   645,   171,   338,   337,   338,   661,    92,    93,    87,
-     539,   525,   527,   257,   385,   108,   373,   254,   373,   373,
-     373,   667,   253,   661,   661,   647,   584,   649,   661,   661,
-     661,    89,    88,    89,   661,   633,   410,   107,   511,   311,
-     511,   108,   108,   253,   649,   472,   261,   661,   171,   337,
-     652,   171,   171,    56,    62,   368,   270,   661,   663,   672,
-     351,   352,   364,   365,   366,   369,   374,   386,   391,   488,
-     633,   661,   171,   337,   249,   265,   278,   433,   127,   128,
-     412,   652,   169,   661,   438,   438,   318,   261,   633,   261,
-     405,   491,   171,   337,   171,   171,   171,   171,   337,   171,
-     337,   171,   337,   291,   623,   626,   171,   337,   171,   171,
-     171,   566,   170,   652,   652,   586,   112,   151,   171,   673,
-     171,   171,   337,   681,    82,   246,   586,   722,   723,   725,
-     726,   727,   262,   337,   692,   316,   699,    83,   139,   702,
-     337,   705,   102,   709,   729,   720,   171,   158,   730,   731,
-     720,   171,   337,   170,   170,   170,   586,   586,   586,   586,
-     292,   525,   298,   308,   586,   525,   525,   171,   545,   553,
-      74,   533,    74,   553,   553,    74,    71,   661,   170,   661,
-     544,   102,   105,   558,   667,   171,   171,   187,   187,   102,
-     171,   101,   593,   171,   171,   203,   645,   661,   171,   262,
-     368,   262,    16,   667,   491,   491,   491,   248,   270,   316,
-     480,   667,   170,   515,   516,   667,   312,   515,   667,   171,
-       3,    66,    79,    85,   232,   235,   272,   296,   302,   307,
-     357,   359,   360,   369,   374,   386,   391,   446,   449,   451,
-     452,   453,   457,   459,   465,   467,   468,   488,   492,   493,
-     541,   661,   661,   231,   231,   661,   337,   366,   411,   661,
-     260,   260,   442,   124,   129,   246,   414,   415,   418,   419,
-     421,   422,   425,   263,     3,   169,   408,   169,   440,   435,
-     661,   170,    76,   490,   651,   666,   666,   666,   621,   666,
-     557,   634,   661,   171,   171,   171,   136,   586,   683,   689,
-     690,   691,   721,   720,   246,   725,   171,   337,   316,   107,
-     145,   147,   148,   693,   697,   720,   661,   700,   140,   140,
-     171,   587,   720,   122,   146,   587,   710,   711,   712,   713,
-     714,   729,   277,   171,   171,   526,   522,   523,   523,   337,
-     171,   109,   171,   171,   337,   525,   171,   341,   553,    74,
-     553,    16,   261,   535,   535,   553,   170,   663,   557,   559,
-     569,   569,   557,   102,    84,   335,   594,   595,   171,   171,
-     324,   270,   246,    98,   107,   173,   246,   667,   337,   516,
-      82,   514,   337,   170,   505,   505,   233,   232,   528,   233,
-     454,   455,   633,   275,   439,   458,   559,   297,   462,   463,
-     586,   559,   306,   447,   304,   339,   652,   275,   471,   652,
-     471,   661,   442,   442,   125,   420,   585,   418,   107,   173,
-     224,   265,   268,   278,   432,   434,   170,    82,   168,   224,
-     326,   477,   435,    64,    83,   248,   171,   171,   171,   171,
-     171,   337,   338,   170,   337,   337,   692,   337,   171,   723,
-     661,   724,   261,   261,   261,   261,   171,   171,   316,   728,
-     729,   337,   107,   148,   715,   159,   171,   171,   171,   586,
-     586,   586,   555,   553,   442,   559,   535,   663,   171,   565,
-     183,   329,   336,   587,   596,   597,   598,   599,   253,   269,
-       3,   107,   107,   420,   667,   171,   225,   667,   506,   507,
-     661,   508,   508,   667,   233,   548,   444,   661,   170,   170,
-     559,   299,   462,   464,   297,   460,   461,   298,   447,   449,
-     559,   170,   232,   236,   446,   232,   236,   268,   316,   107,
-     170,   260,   633,   417,   418,   168,   262,   323,   324,   478,
-     479,   109,   482,   483,   171,    84,    84,   634,   661,   586,
-     684,   685,   687,   689,   691,   683,   689,   107,    82,   107,
-     107,   107,   661,   711,   261,   261,   171,    82,   157,   160,
-     732,   733,   738,   171,   171,   171,   171,   597,   321,   332,
-     332,   330,   602,   667,   661,   337,   171,   337,     3,   511,
-     511,   269,   444,   338,   456,   586,   439,   298,   447,   308,
-     586,   460,   464,   447,   449,   130,   305,   470,   658,   233,
-       5,   233,     5,   633,   126,   559,   441,   171,   337,   275,
-     321,   481,   275,   481,   479,   325,   297,   485,   171,   337,
-     316,   686,   337,   151,   728,   148,   148,   153,   661,   739,
-       3,   734,   735,    82,   150,   153,   740,   741,   743,   744,
-     187,    82,   106,   329,   334,   667,   507,    59,   512,   512,
-     661,   661,   171,   337,   171,   447,   449,   296,   298,   308,
-     299,   303,   466,   130,   308,   447,   171,   337,   652,   444,
-       4,   444,     4,   441,   170,   423,   171,   110,   431,   418,
-     480,   480,   480,   480,   321,   322,   484,   559,   307,   357,
-     359,   369,   374,   450,   451,   486,   492,   493,   541,   685,
-     661,   688,   689,   156,   736,   736,   153,   661,   746,   735,
-     745,   742,   743,   329,   336,   587,   600,   601,   333,   321,
-      60,   513,   513,   586,   130,   447,   296,   447,   559,   308,
-     308,   308,   658,   431,   393,    39,    40,    70,   430,   261,
-     427,   428,   429,   661,   661,   661,   661,   306,   735,   737,
-     321,   331,   332,    61,   514,   514,   298,   302,   304,   652,
-     429,   171,    64,    65,   261,   428,   261,   427,   448,   314,
-     503,   447,   469,   661,    42,    43,    82,   270,   426,   426,
-     308,   450,   170,   466,    41,   107,   246,   130,   504,   649,
-     171,   337,   649
+     701,   703,   706,   716,   717,   747,   633,   185,   500,   500,
+     661,    86,    89,    95,   495,   496,   497,   528,   169,   168,
+     338,   168,   441,   442,   355,   355,   344,   344,   355,   355,
+     168,   441,   441,   264,   441,   107,   256,   275,   337,   275,
+     337,   259,   337,   260,   260,   377,   370,    85,   495,   268,
+     661,   633,   633,   337,   539,   542,   441,   438,   545,   649,
+     256,    26,   256,   293,   309,   213,   214,   661,   213,   214,
+     633,   227,   273,   273,   273,   273,   633,   633,   633,   633,
+     661,   221,   361,   661,   633,   633,   633,   314,   273,   661,
+     633,   227,   161,   226,   227,   228,   633,   633,   633,   633,
+     661,   633,   633,   633,   633,   633,    41,    42,   491,   221,
+     661,   661,   291,   172,   172,   337,     4,     5,     6,    19,
+      23,    24,    25,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    51,    52,    53,   281,   282,   283,   284,   337,
+     622,   629,   652,   654,   655,   656,   657,   101,   173,   245,
+     546,   546,   546,   292,   562,   279,   531,   442,   529,   530,
+     658,   661,   661,   667,   667,   667,   168,   168,    21,   168,
+     608,   608,   608,   608,   608,   168,   584,   168,   121,   661,
+     168,   168,   168,   168,   168,   168,   168,   168,   168,   168,
+     168,   168,   277,   536,   545,   559,   569,   577,   604,   661,
+     569,   168,   586,   586,   168,   168,   168,   586,   667,   168,
+     620,   168,   621,   187,   188,   618,   296,   586,   642,   643,
+     168,   168,   569,   581,   107,   256,   549,   550,   315,   612,
+     183,   172,   175,   176,   177,   178,   179,   180,   181,   182,
+     185,   186,   633,   130,   187,   188,   189,   190,   191,   192,
+     193,   194,   195,   196,   201,   202,   203,   204,   205,   206,
+     207,   208,   209,   210,   211,   212,   257,   326,   338,   337,
+     168,   168,   168,   667,   667,   338,   168,   244,   277,   439,
+     442,   520,    80,    81,   275,   501,    87,    88,    90,    96,
+     337,   548,   169,   525,   586,   638,   606,   661,   435,   294,
+     564,   129,   129,   129,   129,   168,   169,   523,   525,   527,
+     545,   265,   384,   385,   659,   659,   384,   379,   161,   273,
+     380,   487,   633,   383,   108,   108,   107,   107,   495,   249,
+     250,   401,   248,   268,   280,   387,   112,   113,   114,   115,
+     116,   117,   118,   119,   122,   315,   394,   396,   397,   246,
+     268,   271,   272,   538,   315,   169,    26,   312,   667,   256,
+     633,   649,   293,   280,    84,   315,   393,   395,   397,   633,
+     633,   633,   633,   633,   230,   168,   168,   168,   280,   367,
+     362,   661,   244,   363,   221,   168,   406,   407,   441,   441,
+     318,   319,   475,   661,   633,   633,   227,   633,   633,   633,
+     491,   168,   489,   489,   489,   491,   491,   491,   661,    57,
+     284,   632,   661,   525,   435,   168,   168,    20,    21,   168,
+     168,   168,    37,   168,   620,   621,   285,   286,   287,   288,
+     289,   290,   623,   625,   627,   628,   661,   168,   168,   168,
+     168,   565,   566,   586,   165,   547,   547,   547,   588,   648,
+     664,   665,   293,   563,   559,   172,   337,   531,   172,   338,
+     559,   636,   636,    22,   169,   290,   623,   624,   108,   586,
+     587,   586,   673,   674,   675,   673,   231,   151,   695,   721,
+     148,   150,   719,   231,     3,   707,   587,   111,   718,   719,
+     673,   545,   168,   521,   169,   169,   169,   169,   337,   338,
+     586,   586,   586,   666,   280,   619,   666,   619,   667,   559,
+     296,   640,   641,   298,   642,   644,   586,   525,   639,   337,
+     341,   168,   340,   532,   551,   552,   553,   584,   604,   633,
+     661,   543,   544,   661,   531,   661,   559,   569,    98,    99,
+     572,   572,   168,   168,   574,   586,   574,   574,   574,   560,
+     173,   174,   184,   569,   579,   582,   586,   586,   586,   586,
+     586,   586,   586,   586,   586,   586,   586,   586,   586,   586,
+     172,   586,   586,   586,   586,   586,   586,   586,   586,   586,
+     106,   171,   168,   201,   611,   169,   173,   201,   245,   586,
+     645,   661,   645,     7,     8,     9,   201,   661,   277,   521,
+     520,    80,    77,    86,    93,    94,   498,   666,   497,   169,
+     337,   169,    13,   588,   650,   664,   236,   356,   169,   337,
+     280,   337,   372,   280,   371,   633,   384,   384,   251,   275,
+     267,   401,   101,   280,   647,   665,   647,   647,   652,   396,
+     223,   273,   274,   389,   390,    66,    86,   388,   390,   273,
+     390,   168,   168,   515,   516,   667,    15,   508,   509,   508,
+     633,   441,   309,   649,   401,   280,   652,   395,   168,   406,
+     406,   406,   406,   231,   201,   472,   473,   661,   472,   472,
+     255,    19,   262,   670,   671,   362,   180,   223,   409,   410,
+     411,   413,   416,   424,   425,   436,   658,   661,    97,   402,
+     315,   315,    63,    64,    66,   476,   259,   406,   489,   633,
+     491,   491,   491,   169,   490,   652,   652,   646,   666,   646,
+      22,   646,   646,   646,   666,    52,   653,   667,   619,   619,
+     621,   620,   275,   646,   666,   646,   646,   646,   337,   219,
+     220,   567,   101,   545,   545,   545,   588,   650,   564,   584,
+     530,   559,   661,   315,   337,   107,   633,   154,   720,   337,
+     720,   720,   661,   682,   168,   586,   696,   697,   698,   337,
+     587,   661,   704,   142,   708,   720,   673,   561,   169,   522,
+     525,   526,   169,   337,   177,   178,   569,   107,   337,   178,
+     337,   169,   282,   667,   169,   667,   628,   297,   586,   640,
+     644,   586,   307,   337,   337,   169,   337,   569,   168,   532,
+     553,   554,   337,    67,    68,    69,    71,    72,    73,    74,
+     166,   533,   534,   315,   555,   661,   555,   555,   338,   337,
+     549,   105,   556,   569,   569,   523,   523,   103,   584,   586,
+     106,   327,   591,   592,   645,   169,   645,   169,   338,   337,
+     338,   661,    91,    92,    86,   525,   527,   255,   385,   107,
+     373,   252,   373,   373,   373,   667,   661,   661,   251,   647,
+     584,   649,   661,   661,   661,    88,    87,    88,   661,   633,
+     410,   539,   516,   337,   106,   511,   310,   511,   107,   107,
+     251,   649,   472,   259,   661,   169,   337,   652,   169,   169,
+      55,    61,   368,   268,   661,   663,   672,   351,   352,   364,
+     365,   366,   369,   374,   386,   391,   488,   633,   661,   169,
+     337,   247,   263,   276,   433,   126,   127,   412,   652,   280,
+     661,   438,   438,   317,   259,   633,   259,   405,   491,   169,
+     337,   169,   169,   169,   169,   337,   169,   337,   169,   337,
+     290,   623,   626,   169,   337,   169,   169,   169,   566,   168,
+     652,   652,   586,   111,   150,   169,   673,   169,   169,   337,
+     681,    81,   244,   586,   722,   723,   725,   726,   727,   260,
+     337,   692,   315,   699,    82,   138,   702,   337,   705,   101,
+     709,   729,   720,   169,   157,   730,   731,   720,   169,   337,
+     168,   168,   168,   586,   586,   586,   586,   291,   525,   297,
+     307,   586,   525,   525,   169,   545,   553,    73,   533,    73,
+     553,   553,    73,    70,   661,   168,   661,   544,   101,   104,
+     558,   185,   185,   169,   169,   667,   101,   169,   100,   593,
+     169,   169,   201,   645,   661,   260,   368,   260,    15,   667,
+     491,   491,   491,   246,   268,   169,   169,   667,   315,   480,
+     667,   515,   311,   515,   667,   169,     3,    65,    78,    84,
+     230,   233,   270,   295,   301,   306,   357,   359,   360,   369,
+     374,   386,   391,   446,   449,   451,   452,   453,   457,   459,
+     465,   467,   468,   488,   492,   493,   541,   661,   661,   229,
+     229,   661,   337,   366,   411,   661,   258,   258,   442,   123,
+     128,   244,   414,   415,   418,   419,   421,   422,   425,   261,
+       3,   280,   408,   280,   440,   435,   661,   168,    75,   490,
+     651,   666,   666,   666,   621,   666,   557,   634,   661,   169,
+     169,   169,   135,   586,   683,   689,   690,   691,   721,   720,
+     244,   725,   169,   337,   315,   106,   144,   146,   147,   693,
+     697,   720,   661,   700,   139,   139,   169,   587,   720,   121,
+     145,   587,   710,   711,   712,   713,   714,   729,   275,   169,
+     169,   526,   522,   523,   523,   108,   169,   169,   337,   169,
+     337,   525,   169,   341,   553,    73,   553,    15,   259,   535,
+     535,   553,   168,   663,   557,   559,   569,   569,   557,   101,
+      83,   334,   594,   595,   169,   169,   323,   268,   244,    97,
+     106,   171,   244,   667,   337,    81,   514,   168,   505,   505,
+     231,   230,   528,   231,   454,   455,   633,   273,   439,   458,
+     559,   296,   462,   463,   586,   559,   305,   447,   303,   339,
+     652,   273,   471,   652,   471,   661,   442,   442,   124,   420,
+     585,   418,   106,   171,   222,   263,   266,   276,   432,   434,
+     168,    81,   167,   222,   325,   477,   435,    63,    82,   246,
+     169,   169,   169,   169,   169,   337,   338,   168,   337,   337,
+     692,   337,   169,   723,   661,   724,   259,   259,   259,   259,
+     169,   169,   315,   728,   729,   337,   106,   147,   715,   158,
+     169,   169,   169,   586,   586,   586,   555,   553,   442,   559,
+     535,   663,   169,   565,   176,   328,   335,   587,   596,   597,
+     598,   599,   251,   267,     3,   106,   106,   420,   667,   223,
+     506,   507,   661,   508,   508,   667,   231,   548,   444,   661,
+     168,   168,   559,   298,   462,   464,   296,   460,   461,   297,
+     447,   449,   559,   168,   230,   234,   446,   230,   234,   266,
+     315,   106,   168,   258,   633,   417,   418,   167,   260,   322,
+     323,   478,   479,   108,   482,   483,   169,    83,    83,   634,
+     661,   586,   684,   685,   687,   689,   691,   683,   689,   106,
+      81,   106,   106,   106,   661,   711,   259,   259,   169,    81,
+     156,   159,   732,   733,   738,   169,   169,   169,   169,   597,
+     320,   331,   331,   329,   602,   667,   661,   337,   169,   337,
+       3,   511,   511,   267,   444,   338,   456,   586,   439,   297,
+     447,   307,   586,   460,   464,   447,   449,   129,   304,   470,
+     658,   231,     4,   231,     4,   633,   125,   559,   441,   169,
+     337,   273,   320,   481,   273,   481,   479,   324,   296,   485,
+     169,   337,   315,   686,   337,   150,   728,   147,   147,   152,
+     661,   739,     3,   734,   735,    81,   149,   152,   740,   741,
+     743,   744,   185,    81,   105,   328,   333,   667,   507,    58,
+     512,   512,   661,   661,   169,   337,   169,   447,   449,   295,
+     297,   307,   298,   302,   466,   129,   307,   447,   169,   337,
+     652,   444,   336,   444,   336,   441,   168,   423,   169,   109,
+     431,   418,   480,   480,   480,   480,   320,   321,   484,   559,
+     306,   357,   359,   369,   374,   450,   451,   486,   492,   493,
+     541,   685,   661,   688,   689,   155,   736,   736,   152,   661,
+     746,   735,   745,   742,   743,   328,   335,   587,   600,   601,
+     332,   320,    59,   513,   513,   586,   129,   447,   295,   447,
+     559,   307,   307,   307,   658,   431,   393,    38,    39,    69,
+     430,   259,   427,   428,   429,   661,   661,   661,   661,   305,
+     735,   737,   320,   330,   331,    60,   514,   514,   297,   301,
+     303,   652,   429,   169,    63,    64,   259,   428,   259,   427,
+     448,   313,   503,   447,   469,   661,    41,    42,    81,   268,
+     426,   426,   307,   450,   168,   466,    40,   106,   244,   129,
+     504,   649,   169,   337,   649
 };
 
 #define yyerrok		(yyerrstatus = 0)
@@ -9516,86 +9470,94 @@ yyreduce:
     break;
 
   case 439:
-#line 2541 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = NULL; }
+#line 2539 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { dlist *l = L();
+	  append_symbol(l, (yyvsp[(2) - (5)].sym));
+	  append_list(l, (yyvsp[(5) - (5)].l));
+	  (yyval.sym) = _symbol_create_list( SQL_BINCOPYTO, l ); }
     break;
 
   case 440:
-#line 2542 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = (yyvsp[(3) - (4)].l); }
+#line 2546 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = NULL; }
     break;
 
   case 441:
 #line 2547 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_lng(L(), (yyvsp[(1) - (1)].l_val)); }
+    { (yyval.l) = (yyvsp[(3) - (4)].l); }
     break;
 
   case 442:
-#line 2549 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_lng((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].l_val)); }
+#line 2552 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_lng(L(), (yyvsp[(1) - (1)].l_val)); }
     break;
 
   case 443:
-#line 2553 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = NULL; }
+#line 2554 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_lng((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].l_val)); }
     break;
 
   case 444:
-#line 2554 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = (yyvsp[(2) - (3)].l); }
+#line 2558 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = NULL; }
     break;
 
   case 445:
-#line 2558 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_list(L(), (yyvsp[(1) - (1)].l)); }
+#line 2559 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = (yyvsp[(2) - (3)].l); }
     break;
 
   case 446:
-#line 2559 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_list((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].l)); }
+#line 2563 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_list(L(), (yyvsp[(1) - (1)].l)); }
     break;
 
   case 447:
 #line 2564 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_list((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].l)); }
+    break;
+
+  case 448:
+#line 2569 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_string(l, (yyvsp[(1) - (1)].sval) );
 			  (yyval.l) = l; }
     break;
 
-  case 448:
-#line 2568 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 449:
+#line 2573 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_string(l, (yyvsp[(1) - (2)].sval) );
 			  append_string(l, (yyvsp[(2) - (2)].sval) );
 			  (yyval.l) = l; }
     break;
 
-  case 449:
-#line 2576 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 450:
+#line 2581 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 				  append_string(l, sa_strdup(SA, "|"));
 				  append_string(l, sa_strdup(SA, "\\n"));
 				  (yyval.l) = l; }
     break;
 
-  case 450:
-#line 2581 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 451:
+#line 2586 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 				  append_string(l, (yyvsp[(3) - (3)].sval));
 				  append_string(l, sa_strdup(SA, "\\n"));
 				  (yyval.l) = l; }
     break;
 
-  case 451:
-#line 2586 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 452:
+#line 2591 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 				  append_string(l, (yyvsp[(3) - (5)].sval));
 				  append_string(l, (yyvsp[(5) - (5)].sval));
 				  (yyval.l) = l; }
     break;
 
-  case 452:
-#line 2591 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 453:
+#line 2596 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 				  append_string(l, (yyvsp[(3) - (7)].sval));
 				  append_string(l, (yyvsp[(5) - (7)].sval));
@@ -9603,111 +9565,111 @@ yyreduce:
 				  (yyval.l) = l; }
     break;
 
-  case 453:
-#line 2599 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = NULL; }
-    break;
-
   case 454:
-#line 2600 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 2604 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = NULL; }
     break;
 
   case 455:
-#line 2604 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = NULL; }
+#line 2605 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = NULL; }
     break;
 
   case 456:
-#line 2605 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_lng(append_lng(L(), (yyvsp[(1) - (2)].l_val)), 0); }
+#line 2609 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = NULL; }
     break;
 
   case 457:
-#line 2606 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_lng(append_lng(L(), -1), (yyvsp[(2) - (2)].l_val)); }
+#line 2610 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_lng(append_lng(L(), (yyvsp[(1) - (2)].l_val)), 0); }
     break;
 
   case 458:
-#line 2608 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_lng(append_lng(L(), (yyvsp[(1) - (4)].l_val)), (yyvsp[(3) - (4)].l_val)); }
+#line 2611 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_lng(append_lng(L(), -1), (yyvsp[(2) - (2)].l_val)); }
     break;
 
   case 459:
-#line 2610 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_lng(append_lng(L(), (yyvsp[(1) - (4)].l_val)), (yyvsp[(4) - (4)].l_val)); }
+#line 2613 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_lng(append_lng(L(), (yyvsp[(1) - (4)].l_val)), (yyvsp[(3) - (4)].l_val)); }
     break;
 
   case 460:
-#line 2614 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = NULL; }
-    break;
-
-  case 461:
 #line 2615 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = (yyvsp[(3) - (3)].sval); }
+    { (yyval.l) = append_lng(append_lng(L(), (yyvsp[(1) - (4)].l_val)), (yyvsp[(4) - (4)].l_val)); }
     break;
 
-  case 462:
+  case 461:
 #line 2619 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.bval) = FALSE; }
+    { (yyval.sval) = NULL; }
     break;
 
-  case 463:
+  case 462:
 #line 2620 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.bval) = TRUE; }
+    { (yyval.sval) = (yyvsp[(3) - (3)].sval); }
     break;
 
-  case 464:
+  case 463:
 #line 2624 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.bval) = FALSE; }
     break;
 
-  case 465:
+  case 464:
 #line 2625 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.bval) = TRUE; }
     break;
 
-  case 466:
+  case 465:
 #line 2629 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.bval) = FALSE; }
+    break;
+
+  case 466:
+#line 2630 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.bval) = TRUE; }
     break;
 
   case 467:
-#line 2630 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.bval) = FALSE; }
+#line 2634 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.bval) = TRUE; }
     break;
 
   case 468:
-#line 2634 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = (yyvsp[(1) - (1)].l); }
+#line 2635 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.bval) = FALSE; }
     break;
 
   case 469:
-#line 2635 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = (yyvsp[(2) - (3)].l); }
+#line 2639 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = (yyvsp[(1) - (1)].l); }
     break;
 
   case 470:
-#line 2639 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_string(L(), (yyvsp[(1) - (1)].sval)); }
+#line 2640 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = (yyvsp[(2) - (3)].l); }
     break;
 
   case 471:
-#line 2641 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_string((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sval)); }
+#line 2644 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_string(L(), (yyvsp[(1) - (1)].sval)); }
     break;
 
   case 472:
-#line 2647 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 2646 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_string((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sval)); }
+    break;
+
+  case 473:
+#line 2652 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_list(l, (yyvsp[(3) - (4)].l));
 	  append_symbol(l, (yyvsp[(4) - (4)].sym));
 	  (yyval.sym) = _symbol_create_list( SQL_DELETE, l ); }
     break;
 
-  case 473:
-#line 2656 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 474:
+#line 2661 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_list(l, (yyvsp[(2) - (5)].l));
 	  append_list(l, (yyvsp[(4) - (5)].l));
@@ -9715,8 +9677,8 @@ yyreduce:
 	  (yyval.sym) = _symbol_create_list( SQL_UPDATE, l ); }
     break;
 
-  case 474:
-#line 2697 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 475:
+#line 2702 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_list(l, (yyvsp[(3) - (4)].l));
 	  append_list(l, NULL);
@@ -9724,8 +9686,8 @@ yyreduce:
 	  (yyval.sym) = _symbol_create_list( SQL_INSERT, l ); }
     break;
 
-  case 475:
-#line 2705 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 476:
+#line 2710 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_list(l, (yyvsp[(3) - (5)].l));
 	  append_list(l, (yyvsp[(4) - (5)].l));
@@ -9733,53 +9695,53 @@ yyreduce:
 	  (yyval.sym) = _symbol_create_list( SQL_INSERT, l ); }
     break;
 
-  case 476:
-#line 2714 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 477:
+#line 2719 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list( SQL_VALUES, L()); }
     break;
 
-  case 477:
-#line 2716 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 478:
+#line 2721 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list( SQL_VALUES, L()); }
     break;
 
-  case 478:
-#line 2718 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 479:
+#line 2723 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list( SQL_VALUES, (yyvsp[(2) - (2)].l)); }
     break;
 
-  case 480:
-#line 2724 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 481:
+#line 2729 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_list(L(), (yyvsp[(2) - (3)].l)); }
     break;
 
-  case 481:
-#line 2726 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 482:
+#line 2731 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_list((yyvsp[(1) - (5)].l), (yyvsp[(4) - (5)].l)); }
     break;
 
-  case 482:
-#line 2730 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 483:
+#line 2735 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol(L(), (yyvsp[(1) - (1)].sym)); }
     break;
 
-  case 483:
-#line 2732 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 484:
+#line 2737 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sym)); }
     break;
 
-  case 484:
-#line 2736 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 485:
+#line 2741 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol(L(), (yyvsp[(1) - (1)].sym)); }
     break;
 
-  case 485:
-#line 2738 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 486:
+#line 2743 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sym)); }
     break;
 
-  case 486:
-#line 2743 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 487:
+#line 2748 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { 
 	  if (m->emode == m_normal && m->caching) {
 		/* replace by argument */
@@ -9794,72 +9756,72 @@ yyreduce:
 	}
     break;
 
-  case 491:
-#line 2772 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.bval) = FALSE; }
-    break;
-
   case 492:
-#line 2773 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 2777 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.bval) = FALSE; }
     break;
 
   case 493:
-#line 2774 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.bval) = TRUE; }
+#line 2778 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.bval) = FALSE; }
     break;
 
   case 494:
-#line 2778 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_symbol(L(), (yyvsp[(1) - (1)].sym) ); }
+#line 2779 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.bval) = TRUE; }
     break;
 
   case 495:
-#line 2780 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_symbol((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sym) ); }
+#line 2783 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_symbol(L(), (yyvsp[(1) - (1)].sym) ); }
     break;
 
   case 496:
 #line 2785 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_symbol((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sym) ); }
+    break;
+
+  case 497:
+#line 2790 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(3) - (3)].sym) );
 	  append_string(l, (yyvsp[(1) - (3)].sval));
 	  (yyval.sym) = _symbol_create_list( SQL_ASSIGN, l); }
     break;
 
-  case 497:
-#line 2790 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 498:
+#line 2795 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(3) - (3)].sym));
 	  append_list(l, (yyvsp[(1) - (3)].l));
 	  (yyval.sym) = _symbol_create_list( SQL_ASSIGN, l ); }
     break;
 
-  case 498:
-#line 2797 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 499:
+#line 2802 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = NULL; }
     break;
 
-  case 499:
-#line 2798 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 500:
+#line 2803 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(2) - (2)].sym); }
     break;
 
-  case 500:
-#line 2805 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 501:
+#line 2810 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(2) - (3)].sym); }
     break;
 
-  case 501:
-#line 2808 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 502:
+#line 2813 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(1) - (4)].sym));
 	  append_symbol(l, (yyvsp[(4) - (4)].sym));
 	  (yyval.sym) = _symbol_create_list( SQL_CROSS, l); }
     break;
 
-  case 502:
-#line 2813 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 503:
+#line 2818 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(1) - (4)].sym));
 	  append_int(l, 0);
@@ -9869,8 +9831,8 @@ yyreduce:
 	  (yyval.sym) = _symbol_create_list( SQL_UNIONJOIN, l); }
     break;
 
-  case 503:
-#line 2821 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 504:
+#line 2826 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(1) - (4)].sym));
 	  append_int(l, 0);
@@ -9880,8 +9842,8 @@ yyreduce:
 	  (yyval.sym) = _symbol_create_list( SQL_JOIN, l); }
     break;
 
-  case 504:
-#line 2829 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 505:
+#line 2834 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(1) - (4)].sym));
 	  append_int(l, 1);
@@ -9891,8 +9853,8 @@ yyreduce:
 	  (yyval.sym) = _symbol_create_list( SQL_JOIN, l); }
     break;
 
-  case 505:
-#line 2837 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 506:
+#line 2842 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(1) - (5)].sym));
 	  append_int(l, 0);
@@ -9902,8 +9864,8 @@ yyreduce:
 	  (yyval.sym) = _symbol_create_list( SQL_JOIN, l); }
     break;
 
-  case 506:
-#line 2845 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 507:
+#line 2850 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(1) - (5)].sym));
 	  append_int(l, 1);
@@ -9913,48 +9875,48 @@ yyreduce:
 	  (yyval.sym) = _symbol_create_list( SQL_JOIN, l); }
     break;
 
-  case 507:
-#line 2855 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 508:
+#line 2860 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 0; }
     break;
 
-  case 508:
-#line 2856 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 509:
+#line 2861 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 1 + (yyvsp[(1) - (2)].i_val); }
     break;
 
-  case 509:
-#line 2857 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 510:
+#line 2862 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 1 + (yyvsp[(1) - (1)].i_val); }
     break;
 
-  case 510:
-#line 2861 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 511:
+#line 2866 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 0; }
     break;
 
-  case 511:
-#line 2862 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 512:
+#line 2867 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 1; }
     break;
 
-  case 512:
-#line 2863 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 513:
+#line 2868 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 2; }
     break;
 
-  case 513:
-#line 2867 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 514:
+#line 2872 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(2) - (2)].sym); }
     break;
 
-  case 514:
-#line 2869 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 515:
+#line 2874 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list( SQL_USING, (yyvsp[(2) - (2)].l)); }
     break;
 
-  case 516:
-#line 2893 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 517:
+#line 2898 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 		dlist *l = L();
 	  	append_list(l, (yyvsp[(2) - (3)].l));
@@ -9963,18 +9925,18 @@ yyreduce:
 	}
     break;
 
-  case 517:
-#line 2902 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 518:
+#line 2907 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sym)); }
     break;
 
-  case 518:
-#line 2903 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 519:
+#line 2908 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol(L(), (yyvsp[(1) - (1)].sym)); }
     break;
 
-  case 519:
-#line 2908 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 520:
+#line 2913 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {  dlist *l = L();
 	  append_list(l, append_string(L(), (yyvsp[(1) - (6)].sval)));
 	  append_list(l, (yyvsp[(2) - (6)].l));
@@ -9985,8 +9947,8 @@ yyreduce:
 	}
     break;
 
-  case 523:
-#line 2931 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 524:
+#line 2936 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = newSelectNode( SA, (yyvsp[(2) - (4)].bval), (yyvsp[(3) - (4)].l), NULL,
 		(yyvsp[(4) - (4)].l)->h->data.sym,
 		(yyvsp[(4) - (4)].l)->h->next->data.sym,
@@ -9996,8 +9958,8 @@ yyreduce:
 	}
     break;
 
-  case 524:
-#line 2942 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 525:
+#line 2947 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = newSelectNode( SA, (yyvsp[(2) - (6)].bval), (yyvsp[(3) - (6)].l), (yyvsp[(5) - (6)].l),
 		(yyvsp[(6) - (6)].l)->h->data.sym,
 		(yyvsp[(6) - (6)].l)->h->next->data.sym,
@@ -10007,8 +9969,8 @@ yyreduce:
 	}
     break;
 
-  case 525:
-#line 2953 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 526:
+#line 2958 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { 
 	  (yyval.sym) = (yyvsp[(1) - (5)].sym);
 	  if ((yyvsp[(2) - (5)].sym) || (yyvsp[(3) - (5)].sym) || (yyvsp[(4) - (5)].sym) || (yyvsp[(5) - (5)].sym)) {
@@ -10038,18 +10000,18 @@ yyreduce:
 	}
     break;
 
-  case 526:
-#line 2983 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 527:
+#line 2988 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_string(L(), (yyvsp[(1) - (1)].sval)); }
     break;
 
-  case 527:
-#line 2985 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 528:
+#line 2990 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_string((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sval)); }
     break;
 
-  case 529:
-#line 2995 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 530:
+#line 3000 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(1) - (5)].sym));
 	  append_int(l, (yyvsp[(3) - (5)].bval));
@@ -10058,8 +10020,8 @@ yyreduce:
 	  (yyval.sym) = _symbol_create_list( SQL_UNION, l); }
     break;
 
-  case 530:
-#line 3004 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 531:
+#line 3009 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(1) - (5)].sym));
 	  append_int(l, (yyvsp[(3) - (5)].bval));
@@ -10068,8 +10030,8 @@ yyreduce:
 	  (yyval.sym) = _symbol_create_list( SQL_EXCEPT, l); }
     break;
 
-  case 531:
-#line 3013 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 532:
+#line 3018 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(1) - (5)].sym));
 	  append_int(l, (yyvsp[(3) - (5)].bval));
@@ -10078,43 +10040,43 @@ yyreduce:
 	  (yyval.sym) = _symbol_create_list( SQL_INTERSECT, l); }
     break;
 
-  case 532:
-#line 3019 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 533:
+#line 3024 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(2) - (3)].sym); }
     break;
 
-  case 534:
-#line 3024 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 535:
+#line 3029 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.bval) = TRUE; }
     break;
 
-  case 535:
-#line 3025 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 536:
+#line 3030 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.bval) = FALSE; }
     break;
 
-  case 536:
-#line 3026 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 537:
+#line 3031 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.bval) = TRUE; }
     break;
 
-  case 537:
-#line 3031 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 538:
+#line 3036 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = NULL; }
     break;
 
-  case 538:
-#line 3033 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 539:
+#line 3038 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = L(); }
     break;
 
-  case 539:
-#line 3035 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 540:
+#line 3040 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = (yyvsp[(4) - (5)].l); }
     break;
 
-  case 541:
-#line 3045 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 542:
+#line 3050 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = L();
 	  append_symbol((yyval.l), (yyvsp[(1) - (4)].sym));
 	  append_symbol((yyval.l), (yyvsp[(2) - (4)].sym));
@@ -10122,60 +10084,60 @@ yyreduce:
 	  append_symbol((yyval.l), (yyvsp[(4) - (4)].sym)); }
     break;
 
-  case 542:
-#line 3053 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 543:
+#line 3058 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = NULL; }
     break;
 
-  case 543:
-#line 3054 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 544:
+#line 3059 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list( SQL_FROM, (yyvsp[(2) - (2)].l)); }
     break;
 
-  case 544:
-#line 3058 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 545:
+#line 3063 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol(L(), (yyvsp[(1) - (1)].sym)); }
     break;
 
-  case 545:
-#line 3060 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 546:
+#line 3065 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sym)); }
     break;
 
-  case 546:
-#line 3064 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 547:
+#line 3069 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  		  append_list(l, (yyvsp[(1) - (1)].l));
 		  	  	  append_symbol(l, NULL);
 		  		  (yyval.sym) = _symbol_create_list(SQL_NAME, l); }
     break;
 
-  case 547:
-#line 3068 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 548:
+#line 3073 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  		  append_list(l, (yyvsp[(1) - (2)].l));
 		  	  	  append_symbol(l, (yyvsp[(2) - (2)].sym));
 		  		  (yyval.sym) = _symbol_create_list(SQL_NAME, l); }
     break;
 
-  case 548:
-#line 3072 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 549:
+#line 3077 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  		  append_symbol(l, (yyvsp[(1) - (2)].sym));
 		  	  	  append_symbol(l, (yyvsp[(2) - (2)].sym));
 		  		  (yyval.sym) = _symbol_create_list(SQL_TABLE, l); }
     break;
 
-  case 549:
-#line 3076 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 550:
+#line 3081 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  		  append_symbol(l, (yyvsp[(1) - (1)].sym));
 		  	  	  append_symbol(l, NULL);
 		  		  (yyval.sym) = _symbol_create_list(SQL_TABLE, l); }
     break;
 
-  case 551:
-#line 3085 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 552:
+#line 3090 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 				  (yyval.sym) = (yyvsp[(1) - (2)].sym);
 				  if ((yyval.sym)->token == SQL_SELECT) {
@@ -10187,27 +10149,27 @@ yyreduce:
 				}
     break;
 
-  case 552:
-#line 3095 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 553:
+#line 3100 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = NULL;
 				  yyerror(m, "subquery table reference needs alias, use AS xxx");
 				  YYABORT;
 				}
     break;
 
-  case 553:
-#line 3099 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 554:
+#line 3104 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(1) - (1)].sym);
 				  append_symbol((yyvsp[(1) - (1)].sym)->data.lval, NULL); }
     break;
 
-  case 554:
-#line 3109 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 555:
+#line 3114 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { m->caching = 0; }
     break;
 
-  case 555:
-#line 3111 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 556:
+#line 3116 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 		dlist *op = L();
 
@@ -10217,203 +10179,203 @@ yyreduce:
 	}
     break;
 
-  case 556:
-#line 3122 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 557:
+#line 3127 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  		  append_string(l, (yyvsp[(2) - (5)].sval));
 		  	  	  append_list(l, (yyvsp[(4) - (5)].l));
 		  		  (yyval.sym) = _symbol_create_list(SQL_NAME, l); }
     break;
 
-  case 557:
-#line 3127 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 558:
+#line 3132 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  		  append_string(l, (yyvsp[(2) - (2)].sval));
 		  	  	  append_list(l, NULL);
 		  		  (yyval.sym) = _symbol_create_list(SQL_NAME, l); }
     break;
 
-  case 558:
-#line 3132 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 559:
+#line 3137 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  		  append_string(l, (yyvsp[(1) - (4)].sval));
 		  	  	  append_list(l, (yyvsp[(3) - (4)].l));
 		  		  (yyval.sym) = _symbol_create_list(SQL_NAME, l); }
     break;
 
-  case 559:
-#line 3137 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 560:
+#line 3142 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  		  append_string(l, (yyvsp[(1) - (1)].sval));
 		  	  	  append_list(l, NULL);
 		  		  (yyval.sym) = _symbol_create_list(SQL_NAME, l); }
     break;
 
-  case 560:
-#line 3144 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 561:
+#line 3149 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = NULL; }
     break;
 
-  case 561:
-#line 3145 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 562:
+#line 3150 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list( SQL_GROUPBY, (yyvsp[(3) - (3)].l) );}
     break;
 
-  case 562:
-#line 3149 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 563:
+#line 3154 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol(L(),
 			       _symbol_create_list(SQL_COLUMN,(yyvsp[(1) - (1)].l))); }
     break;
 
-  case 563:
-#line 3152 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 564:
+#line 3157 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol( (yyvsp[(1) - (3)].l),
 			       _symbol_create_list(SQL_COLUMN,(yyvsp[(3) - (3)].l))); }
     break;
 
-  case 564:
-#line 3157 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 565:
+#line 3162 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = NULL; }
     break;
 
-  case 565:
-#line 3158 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 566:
+#line 3163 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(2) - (2)].sym); }
     break;
 
-  case 566:
-#line 3164 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 567:
+#line 3169 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  append_symbol(l, (yyvsp[(1) - (3)].sym));
 		  append_symbol(l, (yyvsp[(3) - (3)].sym));
 		  (yyval.sym) = _symbol_create_list(SQL_OR, l ); }
     break;
 
-  case 567:
-#line 3168 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 568:
+#line 3173 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(1) - (1)].sym); }
     break;
 
-  case 568:
-#line 3173 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 569:
+#line 3178 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  append_symbol(l, (yyvsp[(1) - (3)].sym));
 		  append_symbol(l, (yyvsp[(3) - (3)].sym));
 		  (yyval.sym) = _symbol_create_list(SQL_AND, l ); }
     break;
 
-  case 569:
-#line 3177 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 570:
+#line 3182 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(1) - (1)].sym); }
     break;
 
-  case 570:
-#line 3181 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 571:
+#line 3186 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = NULL; }
     break;
 
-  case 571:
-#line 3183 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 572:
+#line 3188 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list( SQL_ORDERBY, (yyvsp[(3) - (3)].l)); }
     break;
 
-  case 572:
-#line 3187 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 573:
+#line 3192 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = NULL; }
     break;
 
-  case 573:
-#line 3188 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 574:
+#line 3193 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { 
 		  	  sql_subtype *t = sql_bind_localtype("wrd");
 			  (yyval.sym) = _newAtomNode( atom_int(SA, t, (yyvsp[(2) - (2)].w_val))); 
 			}
     break;
 
-  case 574:
-#line 3192 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 575:
+#line 3197 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(2) - (2)].sym); }
     break;
 
-  case 575:
-#line 3196 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 576:
+#line 3201 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = NULL; }
     break;
 
-  case 576:
-#line 3197 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 577:
+#line 3202 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { 
 		  	  sql_subtype *t = sql_bind_localtype("wrd");
 			  (yyval.sym) = _newAtomNode( atom_int(SA, t, (yyvsp[(2) - (2)].w_val))); 
 			}
     break;
 
-  case 577:
-#line 3201 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 578:
+#line 3206 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(2) - (2)].sym); }
     break;
 
-  case 578:
-#line 3205 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 579:
+#line 3210 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = NULL; }
     break;
 
-  case 579:
-#line 3206 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 580:
+#line 3211 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 		  	  sql_subtype *t = sql_bind_localtype("wrd");
 			  (yyval.sym) = _newAtomNode( atom_int(SA, t, (yyvsp[(2) - (2)].w_val)));
 			}
     break;
 
-  case 580:
-#line 3210 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 581:
+#line 3215 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 		  	  sql_subtype *t = sql_bind_localtype("dbl");
 			  (yyval.sym) = _newAtomNode( atom_float(SA, t, strtod((yyvsp[(2) - (2)].sval),NULL)));
 			}
     break;
 
-  case 581:
-#line 3214 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 582:
+#line 3219 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(2) - (2)].sym); }
     break;
 
-  case 582:
-#line 3218 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 583:
+#line 3223 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol(L(), (yyvsp[(1) - (1)].sym)); }
     break;
 
-  case 583:
-#line 3220 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 584:
+#line 3225 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol( (yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sym) ); }
     break;
 
-  case 584:
-#line 3225 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 585:
+#line 3230 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(1) - (2)].sym));
 	  append_int(l, (yyvsp[(2) - (2)].bval));
 	  (yyval.sym) = _symbol_create_list(SQL_COLUMN, l ); }
     break;
 
-  case 585:
-#line 3233 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 586:
+#line 3238 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.bval) = TRUE; }
     break;
 
-  case 586:
-#line 3234 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 587:
+#line 3239 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.bval) = TRUE; }
     break;
 
-  case 587:
-#line 3235 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 588:
+#line 3240 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.bval) = FALSE; }
     break;
 
-  case 597:
-#line 3252 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 598:
+#line 3257 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(2) - (2)].sym);
 
 		  if ((yyval.sym)->token == SQL_EXISTS)
@@ -10432,13 +10394,13 @@ yyreduce:
 			(yyval.sym) = _symbol_create_symbol(SQL_NOT, (yyvsp[(2) - (2)].sym)); }
     break;
 
-  case 598:
-#line 3268 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 599:
+#line 3273 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(1) - (1)].sym); }
     break;
 
-  case 599:
-#line 3273 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 600:
+#line 3278 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 
 		  append_symbol(l, (yyvsp[(1) - (3)].sym));
@@ -10447,8 +10409,8 @@ yyreduce:
 		  (yyval.sym) = _symbol_create_list(SQL_COMPARE, l ); }
     break;
 
-  case 600:
-#line 3280 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 601:
+#line 3285 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 
 		  append_symbol(l, (yyvsp[(1) - (3)].sym));
@@ -10457,8 +10419,8 @@ yyreduce:
 		  (yyval.sym) = _symbol_create_list(SQL_COMPARE, l ); }
     break;
 
-  case 601:
-#line 3290 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 602:
+#line 3295 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  append_symbol(l, (yyvsp[(1) - (6)].sym));
 		  append_int(l, (yyvsp[(3) - (6)].i_val));
@@ -10467,33 +10429,33 @@ yyreduce:
 		  (yyval.sym) = _symbol_create_list(SQL_NOT_BETWEEN, l ); }
     break;
 
-  case 602:
-#line 3297 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 603:
+#line 3302 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  append_symbol(l, (yyvsp[(1) - (6)].sym));
 		  append_int(l, (yyvsp[(3) - (6)].i_val));
 		  append_symbol(l, (yyvsp[(4) - (6)].sym));
 		  append_symbol(l, (yyvsp[(6) - (6)].sym));
-		  (yyval.sym) = _symbol_create_list(SQL_BETWEEN, l ); }
-    break;
-
-  case 603:
-#line 3306 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.i_val) = 0; }
+		  (yyval.sym) = _symbol_create_list(SQL_BETWEEN, l ); }
     break;
 
   case 604:
-#line 3307 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 3311 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 0; }
     break;
 
   case 605:
-#line 3308 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.i_val) = 1; }
+#line 3312 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.i_val) = 0; }
     break;
 
   case 606:
 #line 3313 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.i_val) = 1; }
+    break;
+
+  case 607:
+#line 3318 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  append_symbol(l, (yyvsp[(1) - (3)].sym));
 		  append_symbol(l, (yyvsp[(3) - (3)].sym));
@@ -10502,8 +10464,8 @@ yyreduce:
 		  (yyval.sym) = _symbol_create_list( SQL_LIKE, l ); }
     break;
 
-  case 607:
-#line 3320 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 608:
+#line 3325 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  append_symbol(l, (yyvsp[(1) - (3)].sym));
 		  append_symbol(l, (yyvsp[(3) - (3)].sym));
@@ -10512,8 +10474,8 @@ yyreduce:
 		  (yyval.sym) = _symbol_create_list( SQL_LIKE, l ); }
     break;
 
-  case 608:
-#line 3327 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 609:
+#line 3332 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  append_symbol(l, (yyvsp[(1) - (3)].sym));
 		  append_symbol(l, (yyvsp[(3) - (3)].sym));
@@ -10522,8 +10484,8 @@ yyreduce:
 		  (yyval.sym) = _symbol_create_list( SQL_LIKE, l ); }
     break;
 
-  case 609:
-#line 3334 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 610:
+#line 3339 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  append_symbol(l, (yyvsp[(1) - (3)].sym));
 		  append_symbol(l, (yyvsp[(3) - (3)].sym));
@@ -10532,15 +10494,15 @@ yyreduce:
 		  (yyval.sym) = _symbol_create_list( SQL_LIKE, l ); }
     break;
 
-  case 610:
-#line 3344 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 611:
+#line 3349 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(1) - (1)].sym));
 	  (yyval.sym) = _symbol_create_list(SQL_ESCAPE, l ); }
     break;
 
-  case 611:
-#line 3348 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 612:
+#line 3353 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { const char *s = sql2str((yyvsp[(3) - (3)].sval));
 	  if (_strlen(s) != 1) {
 		char *msg = sql_message("\b22025!ESCAPE must be one character");
@@ -10557,18 +10519,18 @@ yyreduce:
 	}
     break;
 
-  case 612:
-#line 3365 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 613:
+#line 3370 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_symbol( SQL_IS_NOT_NULL, (yyvsp[(1) - (4)].sym) );}
     break;
 
-  case 613:
-#line 3366 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 614:
+#line 3371 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_symbol( SQL_IS_NULL, (yyvsp[(1) - (3)].sym) ); }
     break;
 
-  case 614:
-#line 3371 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 615:
+#line 3376 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 
 		  append_symbol(l, (yyvsp[(1) - (5)].sym));
@@ -10576,8 +10538,8 @@ yyreduce:
 		  (yyval.sym) = _symbol_create_list(SQL_NOT_IN, l ); }
     break;
 
-  case 615:
-#line 3377 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 616:
+#line 3382 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 
 		  append_symbol(l, (yyvsp[(1) - (5)].sym));
@@ -10585,34 +10547,34 @@ yyreduce:
 		  (yyval.sym) = _symbol_create_list(SQL_IN, l ); }
     break;
 
-  case 616:
-#line 3383 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 617:
+#line 3388 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  append_list(l, (yyvsp[(2) - (7)].l));
 		  append_list(l, (yyvsp[(6) - (7)].l));
 		  (yyval.sym) = _symbol_create_list(SQL_NOT_IN, l ); }
     break;
 
-  case 617:
-#line 3388 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 618:
+#line 3393 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  append_list(l, (yyvsp[(2) - (7)].l));
 		  append_list(l, (yyvsp[(6) - (7)].l));
 		  (yyval.sym) = _symbol_create_list(SQL_IN, l ); }
     break;
 
-  case 618:
-#line 3396 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 619:
+#line 3401 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol( L(), (yyvsp[(1) - (1)].sym));}
     break;
 
-  case 619:
-#line 3398 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 620:
+#line 3403 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol( (yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sym)); }
     break;
 
-  case 620:
-#line 3404 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 621:
+#line 3409 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  append_symbol(l, (yyvsp[(1) - (4)].sym));
 		  append_string(l, (yyvsp[(2) - (4)].sval));
@@ -10621,43 +10583,43 @@ yyreduce:
 		  (yyval.sym) = _symbol_create_list(SQL_COMPARE, l ); }
     break;
 
-  case 621:
-#line 3413 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.i_val) = 0; }
-    break;
-
   case 622:
-#line 3414 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 3418 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 0; }
     break;
 
   case 623:
-#line 3415 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.i_val) = 1; }
+#line 3419 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.i_val) = 0; }
     break;
 
   case 624:
-#line 3419 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = _symbol_create_symbol( SQL_EXISTS, (yyvsp[(2) - (2)].sym) ); }
+#line 3420 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.i_val) = 1; }
     break;
 
   case 625:
-#line 3423 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_symbol(L(), (yyvsp[(1) - (1)].sym)); }
+#line 3424 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sym) = _symbol_create_symbol( SQL_EXISTS, (yyvsp[(2) - (2)].sym) ); }
     break;
 
   case 626:
-#line 3424 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_symbol((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sym));  }
+#line 3428 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_symbol(L(), (yyvsp[(1) - (1)].sym)); }
     break;
 
   case 627:
-#line 3428 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = (yyvsp[(2) - (3)].l); }
+#line 3429 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_symbol((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sym));  }
     break;
 
   case 628:
 #line 3433 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = (yyvsp[(2) - (3)].l); }
+    break;
+
+  case 629:
+#line 3438 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  append_list(l, (yyvsp[(1) - (3)].l));
 		  append_list(l, (yyvsp[(2) - (3)].l));
@@ -10665,23 +10627,23 @@ yyreduce:
 		  (yyval.sym) = _symbol_create_list(SQL_FILTER, l ); }
     break;
 
-  case 629:
-#line 3441 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 630:
+#line 3446 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(2) - (3)].sym); }
     break;
 
-  case 630:
-#line 3443 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 631:
+#line 3448 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list( SQL_VALUES, (yyvsp[(3) - (4)].l)); }
     break;
 
-  case 631:
-#line 3445 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 632:
+#line 3450 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(2) - (3)].sym); }
     break;
 
-  case 633:
-#line 3452 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 634:
+#line 3457 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(append_string(L(), sa_strdup(SA, "sys")), sa_strdup(SA, "sql_add")));
@@ -10690,8 +10652,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 634:
-#line 3459 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 635:
+#line 3464 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(append_string(L(), sa_strdup(SA, "sys")), sa_strdup(SA, "sql_sub")));
@@ -10700,8 +10662,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 635:
-#line 3466 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 636:
+#line 3471 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(append_string(L(), sa_strdup(SA, "sys")), sa_strdup(SA, "sql_mul")));
@@ -10710,8 +10672,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 636:
-#line 3473 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 637:
+#line 3478 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(append_string(L(), sa_strdup(SA, "sys")), sa_strdup(SA, "sql_div")));
@@ -10720,8 +10682,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 637:
-#line 3480 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 638:
+#line 3485 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(append_string(L(), sa_strdup(SA, "sys")), sa_strdup(SA, "mod")));
@@ -10730,8 +10692,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 638:
-#line 3487 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 639:
+#line 3492 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(append_string(L(), sa_strdup(SA, "sys")), sa_strdup(SA, "bit_xor")));
@@ -10740,8 +10702,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 639:
-#line 3494 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 640:
+#line 3499 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(append_string(L(), sa_strdup(SA, "sys")), sa_strdup(SA, "bit_and")));
@@ -10750,8 +10712,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 640:
-#line 3501 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 641:
+#line 3506 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(L(), sa_strdup(SA, "mbr_overlap")));
@@ -10760,8 +10722,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 641:
-#line 3508 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 642:
+#line 3513 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(L(), sa_strdup(SA, "mbr_overlap_or_left")));
@@ -10770,8 +10732,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 642:
-#line 3515 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 643:
+#line 3520 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(L(), sa_strdup(SA, "mbr_overlap_or_right")));
@@ -10780,8 +10742,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 643:
-#line 3522 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 644:
+#line 3527 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(L(), sa_strdup(SA, "mbr_overlap_or_below")));
@@ -10790,8 +10752,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 644:
-#line 3529 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 645:
+#line 3534 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, append_string(L(), sa_strdup(SA, "mbr_below")));
 	  		  append_symbol(l, (yyvsp[(1) - (3)].sym));
@@ -10799,8 +10761,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 645:
-#line 3535 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 646:
+#line 3540 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(L(), sa_strdup(SA, "mbr_overlap_or_above")));
@@ -10809,8 +10771,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 646:
-#line 3542 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 647:
+#line 3547 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(L(), sa_strdup(SA, "mbr_above")));
@@ -10819,8 +10781,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 647:
-#line 3549 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 648:
+#line 3554 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(L(), sa_strdup(SA, "mbr_distance")));
@@ -10829,8 +10791,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 648:
-#line 3556 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 649:
+#line 3561 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(L(), sa_strdup(SA, "mbr_contained")));
@@ -10839,8 +10801,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 649:
-#line 3563 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 650:
+#line 3568 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(append_string(L(), sa_strdup(SA, "sys")), sa_strdup(SA, "bit_or")));
@@ -10849,8 +10811,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 650:
-#line 3570 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 651:
+#line 3575 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(L(), sa_strdup(SA, "mbr_contains")));
@@ -10859,8 +10821,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 651:
-#line 3577 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 652:
+#line 3582 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(L(), sa_strdup(SA, "mbr_equal")));
@@ -10869,8 +10831,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 652:
-#line 3584 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 653:
+#line 3589 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(append_string(L(), sa_strdup(SA, "sys")), sa_strdup(SA, "bit_not")));
@@ -10878,8 +10840,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_UNOP, l ); }
     break;
 
-  case 653:
-#line 3590 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 654:
+#line 3595 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(append_string(L(), sa_strdup(SA, "sys")), sa_strdup(SA, "left_shift")));
@@ -10888,8 +10850,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 654:
-#line 3597 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 655:
+#line 3602 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(append_string(L(), sa_strdup(SA, "sys")), sa_strdup(SA, "right_shift")));
@@ -10898,8 +10860,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 655:
-#line 3604 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 656:
+#line 3609 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(append_string(L(), sa_strdup(SA, "sys")), sa_strdup(SA, "left_shift_assign")));
@@ -10908,8 +10870,8 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 656:
-#line 3611 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 657:
+#line 3616 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l, 
 			  	append_string(append_string(L(), sa_strdup(SA, "sys")), sa_strdup(SA, "right_shift_assign")));
@@ -10918,13 +10880,13 @@ yyreduce:
 	  		  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 657:
-#line 3618 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 658:
+#line 3623 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(2) - (2)].sym); }
     break;
 
-  case 658:
-#line 3620 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 659:
+#line 3625 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { 
  			  (yyval.sym) = NULL;
 			  assert((yyvsp[(2) - (2)].sym)->token != SQL_COLUMN || (yyvsp[(2) - (2)].sym)->data.lval->h->type != type_lng);
@@ -10951,40 +10913,40 @@ yyreduce:
 			}
     break;
 
-  case 659:
-#line 3644 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 660:
+#line 3649 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(2) - (3)].sym); }
     break;
 
-  case 660:
-#line 3648 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 661:
+#line 3653 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(1) - (1)].sym); }
     break;
 
-  case 663:
-#line 3654 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 664:
+#line 3659 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list( SQL_COLUMN, 
 			  append_string(L(), sa_strdup(SA, "current_user"))); }
     break;
 
-  case 664:
-#line 3656 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 665:
+#line 3661 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list( SQL_COLUMN, 
 			  append_string(L(), sa_strdup(SA, "current_role"))); }
     break;
 
-  case 666:
-#line 3659 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 667:
+#line 3664 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list( SQL_COLUMN, (yyvsp[(1) - (1)].l)); }
     break;
 
-  case 670:
-#line 3663 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 671:
+#line 3668 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list( SQL_NEXT, (yyvsp[(4) - (4)].l)); }
     break;
 
-  case 678:
-#line 3675 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 679:
+#line 3680 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { 
 	  int nr = (m->params)?list_length(m->params):0;
 
@@ -10993,156 +10955,156 @@ yyreduce:
 	}
     break;
 
-  case 679:
-#line 3745 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 680:
+#line 3750 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list( SQL_RANK, 
 		append_list(append_symbol(L(), (yyvsp[(1) - (5)].sym)), (yyvsp[(4) - (5)].l))); }
     break;
 
-  case 680:
-#line 3750 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 681:
+#line 3755 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list( SQL_RANK, (yyvsp[(1) - (3)].l) ); }
     break;
 
-  case 682:
-#line 3756 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_symbol(append_symbol(append_symbol(L(), (yyvsp[(1) - (3)].sym)), (yyvsp[(2) - (3)].sym)), (yyvsp[(3) - (3)].sym)); }
-    break;
-
   case 683:
-#line 3760 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = NULL; }
+#line 3761 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_symbol(append_symbol(append_symbol(L(), (yyvsp[(1) - (3)].sym)), (yyvsp[(2) - (3)].sym)), (yyvsp[(3) - (3)].sym)); }
     break;
 
   case 684:
-#line 3762 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = _symbol_create_list( SQL_GROUPBY, (yyvsp[(3) - (3)].l) ); }
+#line 3765 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sym) = NULL; }
     break;
 
   case 685:
-#line 3766 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = NULL; }
+#line 3767 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sym) = _symbol_create_list( SQL_GROUPBY, (yyvsp[(3) - (3)].l) ); }
     break;
 
   case 686:
-#line 3768 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = _symbol_create_list( SQL_ORDERBY, (yyvsp[(3) - (3)].l) ); }
+#line 3771 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sym) = NULL; }
     break;
 
   case 687:
-#line 3772 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = NULL; }
+#line 3773 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sym) = _symbol_create_list( SQL_ORDERBY, (yyvsp[(3) - (3)].l) ); }
     break;
 
   case 688:
-#line 3774 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = _symbol_create_list( SQL_FRAME, append_int(append_int((yyvsp[(2) - (3)].l), (yyvsp[(1) - (3)].i_val)), (yyvsp[(3) - (3)].i_val))); }
+#line 3777 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sym) = NULL; }
     break;
 
   case 689:
-#line 3778 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.i_val) = FRAME_ROWS; }
+#line 3779 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sym) = _symbol_create_list( SQL_FRAME, append_int(append_int((yyvsp[(2) - (3)].l), (yyvsp[(1) - (3)].i_val)), (yyvsp[(3) - (3)].i_val))); }
     break;
 
   case 690:
-#line 3779 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.i_val) = FRAME_RANGE; }
+#line 3783 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.i_val) = FRAME_ROWS; }
     break;
 
   case 691:
-#line 3783 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_symbol(append_symbol(L(), (yyvsp[(1) - (1)].sym)), _symbol_create_int(SQL_FRAME, -1)); }
+#line 3784 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.i_val) = FRAME_RANGE; }
     break;
 
   case 692:
-#line 3784 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = (yyvsp[(1) - (1)].l); }
+#line 3788 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_symbol(append_symbol(L(), (yyvsp[(1) - (1)].sym)), _symbol_create_int(SQL_FRAME, -1)); }
     break;
 
   case 693:
-#line 3788 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = _symbol_create_int(SQL_FRAME, -1); }
+#line 3789 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = (yyvsp[(1) - (1)].l); }
     break;
 
   case 694:
-#line 3789 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = (yyvsp[(1) - (1)].sym); }
+#line 3793 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sym) = _symbol_create_int(SQL_FRAME, -1); }
     break;
 
   case 695:
-#line 3790 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = _symbol_create_int(SQL_FRAME, 0); }
+#line 3794 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sym) = (yyvsp[(1) - (1)].sym); }
     break;
 
   case 696:
-#line 3794 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = (yyvsp[(1) - (2)].sym); }
+#line 3795 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sym) = _symbol_create_int(SQL_FRAME, 0); }
     break;
 
   case 697:
 #line 3799 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_symbol(append_symbol(L(), (yyvsp[(2) - (4)].sym)), (yyvsp[(4) - (4)].sym)); }
+    { (yyval.sym) = (yyvsp[(1) - (2)].sym); }
     break;
 
   case 698:
-#line 3803 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = _symbol_create_int(SQL_FRAME, -1); }
+#line 3804 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_symbol(append_symbol(L(), (yyvsp[(2) - (4)].sym)), (yyvsp[(4) - (4)].sym)); }
     break;
 
   case 699:
-#line 3804 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = (yyvsp[(1) - (1)].sym); }
+#line 3808 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sym) = _symbol_create_int(SQL_FRAME, -1); }
     break;
 
   case 700:
-#line 3805 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = _symbol_create_int(SQL_FRAME, 0); }
+#line 3809 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sym) = (yyvsp[(1) - (1)].sym); }
     break;
 
   case 701:
-#line 3809 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = (yyvsp[(1) - (2)].sym); }
+#line 3810 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sym) = _symbol_create_int(SQL_FRAME, 0); }
     break;
 
   case 702:
-#line 3813 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.i_val) = EXCLUDE_NONE; }
+#line 3814 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sym) = (yyvsp[(1) - (2)].sym); }
     break;
 
   case 703:
-#line 3814 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.i_val) = EXCLUDE_CURRENT_ROW; }
+#line 3818 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.i_val) = EXCLUDE_NONE; }
     break;
 
   case 704:
-#line 3815 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.i_val) = EXCLUDE_GROUP; }
+#line 3819 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.i_val) = EXCLUDE_CURRENT_ROW; }
     break;
 
   case 705:
-#line 3816 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.i_val) = EXCLUDE_TIES; }
+#line 3820 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.i_val) = EXCLUDE_GROUP; }
     break;
 
   case 706:
-#line 3817 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.i_val) = EXCLUDE_NO_OTHERS; }
+#line 3821 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.i_val) = EXCLUDE_TIES; }
     break;
 
   case 707:
-#line 3821 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = _symbol_create( SQL_NAME, (yyvsp[(2) - (2)].sval) ); }
+#line 3822 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.i_val) = EXCLUDE_NO_OTHERS; }
     break;
 
   case 708:
 #line 3826 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sym) = _symbol_create( SQL_NAME, (yyvsp[(2) - (2)].sval) ); }
+    break;
+
+  case 709:
+#line 3831 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   	  append_list(l, (yyvsp[(1) - (3)].l));
 	  (yyval.sym) = _symbol_create_list( SQL_OP, l ); }
     break;
 
-  case 709:
-#line 3830 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 710:
+#line 3835 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   	  append_list(l, (yyvsp[(1) - (4)].l));
 	  if (dlist_length((yyvsp[(3) - (4)].l)) == 1) {
@@ -11159,39 +11121,39 @@ yyreduce:
 	}
     break;
 
-  case 710:
-#line 3857 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 711:
+#line 3862 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_string(L(), (yyvsp[(1) - (1)].sval)); }
     break;
 
-  case 711:
-#line 3858 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 712:
+#line 3863 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_string(
 					append_string(L(), (yyvsp[(1) - (3)].sval)), (yyvsp[(3) - (3)].sval));}
     break;
 
-  case 712:
-#line 3863 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 713:
+#line 3868 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
-  case 713:
-#line 3864 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 714:
+#line 3869 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = sa_strdup(SA, "left"); }
     break;
 
-  case 714:
-#line 3865 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 715:
+#line 3870 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = sa_strdup(SA, "right"); }
     break;
 
-  case 715:
-#line 3866 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 716:
+#line 3871 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = sa_strdup(SA, "insert"); }
     break;
 
-  case 716:
-#line 3871 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 717:
+#line 3876 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  const char *ident = datetime_field((itype)(yyvsp[(3) - (6)].i_val));
 			  append_list(l,
@@ -11200,19 +11162,11 @@ yyreduce:
 		  	  (yyval.sym) = _symbol_create_list( SQL_UNOP, l ); }
     break;
 
-  case 717:
-#line 3878 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { dlist *l = L();
-			  append_list(l,
-			  	append_string(L(), sa_strdup(SA, "current_date")));
-	  		  (yyval.sym) = _symbol_create_list( SQL_OP, l ); }
-    break;
-
   case 718:
 #line 3883 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l,
-			  	append_string(L(), sa_strdup(SA, "current_time")));
+			  	append_string(L(), sa_strdup(SA, "current_date")));
 	  		  (yyval.sym) = _symbol_create_list( SQL_OP, l ); }
     break;
 
@@ -11220,7 +11174,7 @@ yyreduce:
 #line 3888 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l,
-			  	append_string(L(), sa_strdup(SA, "current_timestamp")));
+			  	append_string(L(), sa_strdup(SA, "current_time")));
 	  		  (yyval.sym) = _symbol_create_list( SQL_OP, l ); }
     break;
 
@@ -11228,7 +11182,7 @@ yyreduce:
 #line 3893 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l,
-			  	append_string(L(), sa_strdup(SA, "localtime")));
+			  	append_string(L(), sa_strdup(SA, "current_timestamp")));
 	  		  (yyval.sym) = _symbol_create_list( SQL_OP, l ); }
     break;
 
@@ -11236,22 +11190,30 @@ yyreduce:
 #line 3898 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  append_list(l,
-			  	append_string(L(), sa_strdup(SA, "localtimestamp")));
+			  	append_string(L(), sa_strdup(SA, "localtime")));
 	  		  (yyval.sym) = _symbol_create_list( SQL_OP, l ); }
     break;
 
   case 722:
-#line 3905 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.bval) = 0; }
+#line 3903 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { dlist *l = L();
+			  append_list(l,
+			  	append_string(L(), sa_strdup(SA, "localtimestamp")));
+	  		  (yyval.sym) = _symbol_create_list( SQL_OP, l ); }
     break;
 
   case 723:
-#line 3906 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.bval) = 1; }
+#line 3910 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.bval) = 0; }
     break;
 
   case 724:
 #line 3911 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.bval) = 1; }
+    break;
+
+  case 725:
+#line 3916 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  dlist *ops = L();
   		  	  append_list(l,
@@ -11263,8 +11225,8 @@ yyreduce:
 		  	  (yyval.sym) = _symbol_create_list( SQL_NOP, l ); }
     break;
 
-  case 725:
-#line 3921 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 726:
+#line 3926 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  dlist *ops = L();
   		  	  append_list(l,
@@ -11276,8 +11238,8 @@ yyreduce:
 		  	  (yyval.sym) = _symbol_create_list( SQL_NOP, l ); }
     break;
 
-  case 726:
-#line 3931 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 727:
+#line 3936 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   		  	  append_list(l,
   		  	  	append_string(L(), sa_strdup(SA, "substring")));
@@ -11286,8 +11248,8 @@ yyreduce:
 		  	  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 727:
-#line 3938 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 728:
+#line 3943 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   		  	  append_list(l,
   		  	  	append_string(L(), sa_strdup(SA, "substring")));
@@ -11296,8 +11258,8 @@ yyreduce:
 		  	  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 728:
-#line 3945 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 729:
+#line 3950 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   		  	  append_list(l,
   		  	  	append_string(L(), sa_strdup(SA, "locate")));
@@ -11306,8 +11268,8 @@ yyreduce:
 		  	  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 729:
-#line 3952 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 730:
+#line 3957 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   		  	  append_list(l,
   		  	  	append_string(L(), sa_strdup(SA, "concat")));
@@ -11316,8 +11278,8 @@ yyreduce:
 		  	  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 730:
-#line 3959 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 731:
+#line 3964 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 			  dlist *ops = L();
   		  	  append_list(l,
@@ -11329,60 +11291,60 @@ yyreduce:
 		  	  (yyval.sym) = _symbol_create_list( SQL_NOP, l ); }
     break;
 
-  case 731:
-#line 3971 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 732:
+#line 3976 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol(L(), (yyvsp[(1) - (1)].sym) ); }
     break;
 
-  case 732:
-#line 3973 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 733:
+#line 3978 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol( (yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sym) ); }
     break;
 
-  case 733:
-#line 3978 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 734:
+#line 3983 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   		  append_string(l, NULL);
   		  append_string(l, NULL);
   		  (yyval.sym) = _symbol_create_list( SQL_TABLE, l ); }
     break;
 
-  case 734:
-#line 3983 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 735:
+#line 3988 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   		  append_string(l, (yyvsp[(1) - (3)].sval));
   		  append_string(l, NULL);
   		  (yyval.sym) = _symbol_create_list( SQL_TABLE, l ); }
     break;
 
-  case 735:
-#line 3988 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 736:
+#line 3993 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   		  append_symbol(l, (yyvsp[(1) - (3)].sym));
   		  append_string(l, NULL);
   		  (yyval.sym) = _symbol_create_list( SQL_TABLE, l ); }
     break;
 
-  case 736:
-#line 3993 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 737:
+#line 3998 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   		  append_symbol(l, (yyvsp[(1) - (2)].sym));
   		  append_string(l, (yyvsp[(2) - (2)].sval));
   		  (yyval.sym) = _symbol_create_list( SQL_COLUMN, l ); }
     break;
 
-  case 737:
-#line 4000 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 738:
+#line 4005 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = NULL; }
     break;
 
-  case 738:
-#line 4001 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 739:
+#line 4006 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = (yyvsp[(2) - (2)].sval); }
     break;
 
-  case 739:
-#line 4006 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 740:
+#line 4011 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { 
 	  if (m->emode == m_normal && m->caching) { 
 	  	/* replace by argument */
@@ -11403,41 +11365,41 @@ yyreduce:
 	}
     break;
 
-  case 740:
-#line 4027 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 741:
+#line 4032 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_string(L(), (yyvsp[(1) - (1)].sval)); }
     break;
 
-  case 741:
-#line 4028 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 742:
+#line 4033 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_string(
 			  append_string(L(), (yyvsp[(1) - (3)].sval)), (yyvsp[(3) - (3)].sval));}
     break;
 
-  case 742:
-#line 4033 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 743:
+#line 4038 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_string(L(), (yyvsp[(1) - (1)].sval)); }
     break;
 
-  case 743:
-#line 4034 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 744:
+#line 4039 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_string(
 			  append_string(L(), (yyvsp[(1) - (3)].sval)), (yyvsp[(3) - (3)].sval));}
     break;
 
-  case 744:
-#line 4039 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 745:
+#line 4044 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_string(L(), (yyvsp[(1) - (1)].sval)); }
     break;
 
-  case 745:
-#line 4040 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 746:
+#line 4045 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_string(
 			  append_string(L(), (yyvsp[(1) - (3)].sval)), (yyvsp[(3) - (3)].sval));}
     break;
 
-  case 746:
-#line 4047 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 747:
+#line 4052 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   		  append_list(l, (yyvsp[(1) - (4)].l));
   		  append_int(l, FALSE);
@@ -11445,8 +11407,8 @@ yyreduce:
 		  (yyval.sym) = _symbol_create_list( SQL_AGGR, l ); }
     break;
 
-  case 747:
-#line 4053 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 748:
+#line 4058 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   		  append_list(l, (yyvsp[(1) - (6)].l));
   		  append_int(l, FALSE);
@@ -11454,8 +11416,8 @@ yyreduce:
 		  (yyval.sym) = _symbol_create_list( SQL_AGGR, l ); }
     break;
 
-  case 748:
-#line 4059 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 749:
+#line 4064 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   		  append_list(l, (yyvsp[(1) - (5)].l));
   		  append_int(l, TRUE);
@@ -11463,8 +11425,8 @@ yyreduce:
 		  (yyval.sym) = _symbol_create_list( SQL_AGGR, l ); }
     break;
 
-  case 749:
-#line 4065 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 750:
+#line 4070 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   		  append_list(l, (yyvsp[(1) - (5)].l));
   		  append_int(l, FALSE);
@@ -11472,8 +11434,8 @@ yyreduce:
 		  (yyval.sym) = _symbol_create_list( SQL_AGGR, l ); }
     break;
 
-  case 750:
-#line 4071 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 751:
+#line 4076 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   		  append_list(l, (yyvsp[(1) - (4)].l));
   		  append_int(l, FALSE);
@@ -11481,8 +11443,8 @@ yyreduce:
 		  (yyval.sym) = _symbol_create_list( SQL_AGGR, l ); }
     break;
 
-  case 751:
-#line 4077 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 752:
+#line 4082 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   		  append_list(l, (yyvsp[(1) - (6)].l));
   		  append_int(l, FALSE);
@@ -11491,58 +11453,58 @@ yyreduce:
 		  (yyval.sym) = _symbol_create_list( SQL_AGGR, l ); }
     break;
 
-  case 753:
-#line 4087 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 754:
+#line 4092 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 1; }
     break;
 
-  case 754:
-#line 4088 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 755:
+#line 4093 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = -1; }
     break;
 
-  case 755:
-#line 4089 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 756:
+#line 4094 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 1; }
     break;
 
-  case 756:
-#line 4093 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 757:
+#line 4098 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.bval) = 1; }
     break;
 
-  case 757:
-#line 4094 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 758:
+#line 4099 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.bval) = 0; }
     break;
 
-  case 758:
-#line 4105 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 759:
+#line 4110 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = (yyvsp[(2) - (3)].i_val)+1; }
     break;
 
-  case 759:
-#line 4107 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 760:
+#line 4112 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 0+1; }
     break;
 
-  case 760:
-#line 4111 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 761:
+#line 4116 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = (yyvsp[(2) - (3)].i_val)+1; }
     break;
 
-  case 761:
-#line 4113 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 762:
+#line 4118 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 6+1; }
     break;
 
-  case 762:
-#line 4117 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 763:
+#line 4122 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "date", 0, 0); }
     break;
 
-  case 763:
-#line 4119 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 764:
+#line 4124 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { if ((yyvsp[(3) - (3)].bval))
 				sql_find_subtype(&(yyval.type), "timetz", (yyvsp[(2) - (3)].i_val), 0); 
 			  else
@@ -11550,8 +11512,8 @@ yyreduce:
 			}
     break;
 
-  case 764:
-#line 4125 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 765:
+#line 4130 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { if ((yyvsp[(3) - (3)].bval))
 				sql_find_subtype(&(yyval.type), "timestamptz", (yyvsp[(2) - (3)].i_val), 0); 
 			  else
@@ -11559,79 +11521,79 @@ yyreduce:
 			}
     break;
 
-  case 765:
-#line 4133 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 766:
+#line 4138 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = iyear; }
     break;
 
-  case 766:
-#line 4134 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 767:
+#line 4139 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = imonth; }
     break;
 
-  case 767:
-#line 4135 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 768:
+#line 4140 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = iday; }
     break;
 
-  case 768:
-#line 4136 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 769:
+#line 4141 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = ihour; }
     break;
 
-  case 769:
-#line 4137 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 770:
+#line 4142 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = imin; }
     break;
 
-  case 771:
-#line 4142 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 772:
+#line 4147 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = isec; }
     break;
 
-  case 772:
-#line 4147 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 773:
+#line 4152 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_int(
 			 	append_int( L(), (yyvsp[(1) - (2)].i_val)), (yyvsp[(2) - (2)].i_val)-1);  }
     break;
 
-  case 773:
-#line 4153 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 774:
+#line 4158 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_int(
 			 	append_int( L(), (yyvsp[(1) - (1)].i_val)), 0);  }
     break;
 
-  case 774:
-#line 4156 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 775:
+#line 4161 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_int(
 			 	append_int( L(), isec), (yyvsp[(2) - (2)].i_val)-1);  }
     break;
 
-  case 775:
-#line 4162 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 776:
+#line 4167 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_int(
 			 	append_int( L(), (yyvsp[(1) - (2)].i_val)), (yyvsp[(2) - (2)].i_val)-1);  }
     break;
 
-  case 776:
-#line 4165 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 777:
+#line 4170 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_int(
 			 	append_int( L(), isec), (yyvsp[(2) - (2)].i_val)-1);  }
     break;
 
-  case 777:
-#line 4171 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 778:
+#line 4176 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) =  append_list(
 			append_list( L(), (yyvsp[(1) - (3)].l)), (yyvsp[(3) - (3)].l) ); }
     break;
 
-  case 778:
-#line 4174 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 779:
+#line 4179 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) =  append_list( L(), (yyvsp[(1) - (1)].l)); }
     break;
 
-  case 779:
-#line 4178 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 780:
+#line 4183 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 		int sk, ek, sp, ep;
 	  	int tpe;
@@ -11651,8 +11613,8 @@ yyreduce:
 	}
     break;
 
-  case 783:
-#line 4204 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 784:
+#line 4209 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { const char *s = sql2str((yyvsp[(1) - (1)].sval));
 		  int len = UTF8_strlen(s);
 		  sql_subtype t;
@@ -11660,8 +11622,8 @@ yyreduce:
 		  (yyval.sym) = _newAtomNode( _atom_string(&t, s)); }
     break;
 
-  case 784:
-#line 4210 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 785:
+#line 4215 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { int len = _strlen((yyvsp[(1) - (1)].sval)), i = 2, err = 0;
 		  char * hexa = (yyvsp[(1) - (1)].sval);
 	 	  sql_subtype t;
@@ -11728,8 +11690,8 @@ yyreduce:
 		}
     break;
 
-  case 785:
-#line 4275 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 786:
+#line 4280 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { int err = 0, len = sizeof(lng);
 		  lng value, *p = &value;
 		  sql_subtype t;
@@ -11762,8 +11724,8 @@ yyreduce:
 		}
     break;
 
-  case 786:
-#line 4306 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 787:
+#line 4311 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { int digits = _strlen((yyvsp[(1) - (1)].sval)), err = 0;
 #ifdef HAVE_HGE
 		  hge value, *p = &value;
@@ -11816,8 +11778,8 @@ yyreduce:
 		}
     break;
 
-  case 787:
-#line 4357 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 788:
+#line 4362 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { char *s = strip_extra_zeros(sa_strdup(SA, (yyvsp[(1) - (1)].sval)));
 		  char *dot = strchr(s, '.');
 		  int digits = _strlen(s) - 1;
@@ -11858,8 +11820,8 @@ yyreduce:
 		}
     break;
 
-  case 788:
-#line 4396 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 789:
+#line 4401 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_subtype t;
   		  char *p = (yyvsp[(1) - (1)].sval);
 		  double val;
@@ -11878,8 +11840,8 @@ yyreduce:
 		  (yyval.sym) = _newAtomNode(atom_float(SA, &t, val)); }
     break;
 
-  case 789:
-#line 4413 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 790:
+#line 4418 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_subtype t;
 		  atom *a;
 		  int r;
@@ -11897,8 +11859,8 @@ yyreduce:
 		} }
     break;
 
-  case 790:
-#line 4429 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 791:
+#line 4434 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_subtype t;
 		  atom *a;
 		  int r;
@@ -11916,8 +11878,8 @@ yyreduce:
 		} }
     break;
 
-  case 791:
-#line 4445 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 792:
+#line 4450 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_subtype t;
 		  atom *a;
 		  int r;
@@ -11935,8 +11897,8 @@ yyreduce:
 		} }
     break;
 
-  case 793:
-#line 4462 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 794:
+#line 4467 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_subtype t;
 		  atom *a= 0;
 		  int r;
@@ -11955,8 +11917,8 @@ yyreduce:
 		}
     break;
 
-  case 794:
-#line 4479 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 795:
+#line 4484 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_subtype t;
 		  atom *a= 0;
 		  int r;
@@ -11975,8 +11937,8 @@ yyreduce:
 		}
     break;
 
-  case 795:
-#line 4496 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 796:
+#line 4501 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_subtype t; 
 		  atom *a = 0;
 		  int r;
@@ -11995,8 +11957,8 @@ yyreduce:
 		}
     break;
 
-  case 796:
-#line 4513 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 797:
+#line 4518 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 		  sql_type *t = mvc_bind_type(m, (yyvsp[(1) - (2)].sval));
 		  atom *a;
@@ -12019,22 +11981,22 @@ yyreduce:
 		}
     break;
 
-  case 797:
-#line 4534 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 798:
+#line 4539 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_subtype t;
 		  sql_find_subtype(&t, "boolean", 0, 0 );
 		  (yyval.sym) = _newAtomNode( atom_bool(SA, &t, FALSE)); }
     break;
 
-  case 798:
-#line 4538 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 799:
+#line 4543 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_subtype t;
 		  sql_find_subtype(&t, "boolean", 0, 0 );
 		  (yyval.sym) = _newAtomNode( atom_bool(SA, &t, TRUE)); }
     break;
 
-  case 799:
-#line 4544 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 800:
+#line 4549 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { 
 		sql_subtype t;
 		int sk, ek, sp, ep, tpe;
@@ -12077,21 +12039,21 @@ yyreduce:
 	}
     break;
 
-  case 800:
-#line 4589 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 801:
+#line 4594 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_string(L(), (yyvsp[(1) - (1)].sval)); }
     break;
 
-  case 801:
-#line 4590 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 802:
+#line 4595 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 				  m->scanner.schema = (yyvsp[(1) - (3)].sval);
 				  (yyval.l) = append_string(
 					append_string(L(), (yyvsp[(1) - (3)].sval)), (yyvsp[(3) - (3)].sval));}
     break;
 
-  case 802:
-#line 4594 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 803:
+#line 4599 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 				  m->scanner.schema = (yyvsp[(1) - (5)].sval);
 				  (yyval.l) = append_string(
@@ -12102,58 +12064,58 @@ yyreduce:
 				;}
     break;
 
-  case 803:
-#line 4605 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 804:
+#line 4610 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_string(
 				L(), (yyvsp[(1) - (1)].sval)); }
     break;
 
-  case 804:
-#line 4608 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 805:
+#line 4613 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_string(
 				append_string(
 				 L(), (yyvsp[(1) - (3)].sval)), (yyvsp[(3) - (3)].sval));}
     break;
 
-  case 805:
-#line 4613 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 806:
+#line 4618 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_string(
 				append_string(
 				 append_string(
 				  L(), (yyvsp[(1) - (5)].sval)), (yyvsp[(3) - (5)].sval)), (yyvsp[(5) - (5)].sval));}
     break;
 
-  case 806:
-#line 4621 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 807:
+#line 4626 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(3) - (6)].sym));
 	  append_type(l, &(yyvsp[(5) - (6)].type));
 	  (yyval.sym) = _symbol_create_list( SQL_CAST, l ); }
     break;
 
-  case 807:
-#line 4627 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 808:
+#line 4632 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(3) - (6)].sym));
 	  append_type(l, &(yyvsp[(5) - (6)].type));
 	  (yyval.sym) = _symbol_create_list( SQL_CAST, l ); }
     break;
 
-  case 809:
-#line 4639 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 810:
+#line 4644 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list(SQL_NULLIF,
 		   append_symbol(
 		    append_symbol(
 		     L(), (yyvsp[(3) - (6)].sym)), (yyvsp[(5) - (6)].sym))); }
     break;
 
-  case 810:
-#line 4644 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 811:
+#line 4649 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list(SQL_COALESCE, (yyvsp[(3) - (4)].l)); }
     break;
 
-  case 811:
-#line 4646 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 812:
+#line 4651 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list(SQL_CASE,
 		   append_symbol(
 		    append_list(
@@ -12161,84 +12123,84 @@ yyreduce:
 		      L(),(yyvsp[(2) - (5)].sym)),(yyvsp[(3) - (5)].l)),(yyvsp[(4) - (5)].sym))); }
     break;
 
-  case 812:
-#line 4652 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 813:
+#line 4657 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list(SQL_CASE,
 		   append_symbol(
 		    append_list(
 		     L(),(yyvsp[(2) - (4)].l)),(yyvsp[(3) - (4)].sym))); }
     break;
 
-  case 813:
-#line 4660 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 814:
+#line 4665 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol( L(), (yyvsp[(1) - (1)].sym)); }
     break;
 
-  case 814:
-#line 4662 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 815:
+#line 4667 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol( (yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sym)); }
     break;
 
-  case 815:
-#line 4667 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 816:
+#line 4672 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol( L(), (yyvsp[(1) - (3)].sym));
 			  (yyval.l) = append_symbol( (yyval.l), (yyvsp[(3) - (3)].sym));
 			}
     break;
 
-  case 816:
-#line 4671 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 817:
+#line 4676 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol( (yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sym)); }
     break;
 
-  case 817:
-#line 4677 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 818:
+#line 4682 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list( SQL_WHEN,
 			   append_symbol(
 			    append_symbol(
 			     L(), (yyvsp[(2) - (4)].sym)),(yyvsp[(4) - (4)].sym))); }
     break;
 
-  case 818:
-#line 4685 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 819:
+#line 4690 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol( L(), (yyvsp[(1) - (1)].sym));}
     break;
 
-  case 819:
-#line 4687 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 820:
+#line 4692 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol( (yyvsp[(1) - (2)].l), (yyvsp[(2) - (2)].sym)); }
     break;
 
-  case 820:
-#line 4692 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 821:
+#line 4697 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list( SQL_WHEN,
 			   append_symbol(
 			    append_symbol(
 			     L(), (yyvsp[(2) - (4)].sym)),(yyvsp[(4) - (4)].sym))); }
     break;
 
-  case 821:
-#line 4700 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 822:
+#line 4705 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol( L(), (yyvsp[(1) - (1)].sym)); }
     break;
 
-  case 822:
-#line 4702 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 823:
+#line 4707 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol( (yyvsp[(1) - (2)].l), (yyvsp[(2) - (2)].sym)); }
     break;
 
-  case 823:
-#line 4706 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 824:
+#line 4711 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = NULL; }
     break;
 
-  case 824:
-#line 4707 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 825:
+#line 4712 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(2) - (2)].sym); }
     break;
 
-  case 826:
-#line 4717 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 827:
+#line 4722 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = (yyvsp[(1) - (1)].i_val);
 		  if ((yyval.i_val) <= 0) {
 			(yyval.i_val) = -1;
@@ -12248,8 +12210,8 @@ yyreduce:
 		}
     break;
 
-  case 827:
-#line 4728 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 828:
+#line 4733 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l_val) = (yyvsp[(1) - (1)].l_val);
 		  if ((yyval.l_val) <= 0) {
 			(yyval.l_val) = -1;
@@ -12259,8 +12221,8 @@ yyreduce:
 		}
     break;
 
-  case 828:
-#line 4739 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 829:
+#line 4744 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.w_val) = (yyvsp[(1) - (1)].w_val);
 		  if ((yyval.w_val) <= 0) {
 			(yyval.w_val) = -1;
@@ -12270,8 +12232,8 @@ yyreduce:
 		}
     break;
 
-  case 829:
-#line 4749 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 830:
+#line 4754 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l_val) = (yyvsp[(1) - (1)].l_val);
 		  if ((yyval.l_val) < 0) {
 			(yyval.l_val) = -1;
@@ -12281,8 +12243,8 @@ yyreduce:
 		}
     break;
 
-  case 830:
-#line 4759 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 831:
+#line 4764 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.w_val) = (yyvsp[(1) - (1)].w_val);
 		  if ((yyval.w_val) < 0) {
 			(yyval.w_val) = -1;
@@ -12292,8 +12254,8 @@ yyreduce:
 		}
     break;
 
-  case 831:
-#line 4769 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 832:
+#line 4774 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = (yyvsp[(1) - (1)].i_val);
 		  if ((yyval.i_val) < 0) {
 			(yyval.i_val) = -1;
@@ -12303,36 +12265,36 @@ yyreduce:
 		}
     break;
 
-  case 832:
-#line 4780 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 833:
+#line 4785 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "char", 1, 0); }
     break;
 
-  case 833:
-#line 4782 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 834:
+#line 4787 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.type).type = NULL;
 			  yyerror(m, "CHARACTER VARYING needs a mandatory length specification");
 			  YYABORT;
 			}
     break;
 
-  case 834:
-#line 4786 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 835:
+#line 4791 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "clob", 0, 0); }
     break;
 
-  case 835:
-#line 4788 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 836:
+#line 4793 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "char", (yyvsp[(3) - (4)].i_val), 0); }
     break;
 
-  case 836:
-#line 4790 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 837:
+#line 4795 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "varchar", (yyvsp[(3) - (4)].i_val), 0); }
     break;
 
-  case 837:
-#line 4792 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 838:
+#line 4797 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "clob", (yyvsp[(3) - (4)].i_val), 0);
 			  /* NOTE: CLOB may be called as CLOB(2K) which is equivalent
 			   *       to CLOB(2048).  Due to 'nonzero' it is not possible
@@ -12343,13 +12305,13 @@ yyreduce:
 			}
     break;
 
-  case 838:
-#line 4800 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 839:
+#line 4805 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "blob", 0, 0); }
     break;
 
-  case 839:
-#line 4802 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 840:
+#line 4807 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "blob", (yyvsp[(3) - (4)].i_val), 0);
 			  /* NOTE: BLOB may be called as BLOB(2K) which is equivalent
 			   *       to BLOB(2048).  Due to 'nonzero' it is not possible
@@ -12360,38 +12322,38 @@ yyreduce:
 			}
     break;
 
-  case 840:
-#line 4810 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 841:
+#line 4815 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "tinyint", 0, 0); }
     break;
 
-  case 841:
-#line 4811 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 842:
+#line 4816 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "smallint", 0, 0); }
     break;
 
-  case 842:
-#line 4812 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 843:
+#line 4817 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "int", 0, 0); }
     break;
 
-  case 843:
-#line 4813 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 844:
+#line 4818 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "bigint", 0, 0); }
     break;
 
-  case 844:
-#line 4814 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 845:
+#line 4819 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "hugeint", 0, 0); }
     break;
 
-  case 845:
-#line 4816 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 846:
+#line 4821 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "decimal", 18, 3); }
     break;
 
-  case 846:
-#line 4818 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 847:
+#line 4823 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { 
 			  int d = (yyvsp[(3) - (4)].i_val);
 			  if (d > MAX_DEC_DIGITS) {
@@ -12406,8 +12368,8 @@ yyreduce:
 			}
     break;
 
-  case 847:
-#line 4831 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 848:
+#line 4836 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { 
 			  int d = (yyvsp[(3) - (6)].i_val);
 			  int s = (yyvsp[(5) - (6)].i_val);
@@ -12427,13 +12389,13 @@ yyreduce:
 			}
     break;
 
-  case 848:
-#line 4848 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 849:
+#line 4853 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "double", 0, 0); }
     break;
 
-  case 849:
-#line 4850 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 850:
+#line 4855 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { if ((yyvsp[(3) - (4)].i_val) > 0 && (yyvsp[(3) - (4)].i_val) <= 24) {
 				sql_find_subtype(&(yyval.type), "real", (yyvsp[(3) - (4)].i_val), 0);
 			  } else if ((yyvsp[(3) - (4)].i_val) > 24 && (yyvsp[(3) - (4)].i_val) <= 53) {
@@ -12449,8 +12411,8 @@ yyreduce:
 			}
     break;
 
-  case 850:
-#line 4864 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 851:
+#line 4869 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { if ((yyvsp[(5) - (6)].i_val) >= (yyvsp[(3) - (6)].i_val)) {
 				char *msg = sql_message("\b22003!precision(%d) should be less than number of digits(%d)", (yyvsp[(5) - (6)].i_val), (yyvsp[(3) - (6)].i_val));
 
@@ -12472,43 +12434,43 @@ yyreduce:
 			}
     break;
 
-  case 851:
-#line 4883 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 852:
+#line 4888 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "double", 0, 0); }
     break;
 
-  case 852:
-#line 4884 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 853:
+#line 4889 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "double", 0, 0); }
     break;
 
-  case 853:
-#line 4885 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 854:
+#line 4890 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), "real", 0, 0); }
     break;
 
-  case 856:
-#line 4888 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 857:
+#line 4893 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), (yyvsp[(1) - (1)].sval), 0, 0); }
     break;
 
-  case 857:
-#line 4890 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 858:
+#line 4895 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), (yyvsp[(1) - (4)].sval), (yyvsp[(3) - (4)].i_val), 0); }
     break;
 
-  case 858:
-#line 4891 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 859:
+#line 4896 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), (yyvsp[(1) - (1)].sval), 0, 0); }
     break;
 
-  case 859:
-#line 4893 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 860:
+#line 4898 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { sql_find_subtype(&(yyval.type), (yyvsp[(1) - (4)].sval), (yyvsp[(3) - (4)].i_val), 0); }
     break;
 
-  case 860:
-#line 4895 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 861:
+#line 4900 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { if ((yyvsp[(5) - (6)].i_val) >= (yyvsp[(3) - (6)].i_val)) {
 				char *msg = sql_message("\b22003!precision(%d) should be less than number of digits(%d)", (yyvsp[(5) - (6)].i_val), (yyvsp[(3) - (6)].i_val));
 
@@ -12522,8 +12484,8 @@ yyreduce:
 			}
     break;
 
-  case 861:
-#line 4906 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 862:
+#line 4911 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 			  sql_type *t = mvc_bind_type(m, (yyvsp[(1) - (1)].sval));
 			  if (!t) {
@@ -12539,8 +12501,8 @@ yyreduce:
 			}
     break;
 
-  case 862:
-#line 4921 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 863:
+#line 4926 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 			  sql_type *t = mvc_bind_type(m, (yyvsp[(1) - (4)].sval));
 			  if (!t) {
@@ -12556,15 +12518,15 @@ yyreduce:
 			}
     break;
 
-  case 863:
-#line 4934 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 864:
+#line 4939 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 		sql_find_subtype(&(yyval.type), "geometry", 0, 0 );
 	}
     break;
 
-  case 864:
-#line 4937 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 865:
+#line 4942 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 		int geoSubType = (yyvsp[(3) - (4)].i_val); 
 
@@ -12582,8 +12544,8 @@ yyreduce:
 	}
     break;
 
-  case 865:
-#line 4952 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 866:
+#line 4957 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 		int geoSubType = (yyvsp[(3) - (6)].i_val); 
 		int srid = (yyvsp[(5) - (6)].i_val); 
@@ -12601,15 +12563,15 @@ yyreduce:
 	}
     break;
 
-  case 866:
-#line 4967 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 867:
+#line 4972 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 		sql_find_subtype(&(yyval.type), "geometrya", 0, 0 );
 	}
     break;
 
-  case 867:
-#line 4970 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 868:
+#line 4975 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 	int geoSubType = find_subgeometry_type((yyvsp[(1) - (1)].sval));
 
@@ -12629,8 +12591,8 @@ yyreduce:
 }
     break;
 
-  case 868:
-#line 4990 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 869:
+#line 4995 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 	int subtype = find_subgeometry_type((yyvsp[(1) - (1)].sval));
 	char* geoSubType = (yyvsp[(1) - (1)].sval);
@@ -12645,8 +12607,8 @@ yyreduce:
 }
     break;
 
-  case 869:
-#line 5002 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 870:
+#line 5007 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 	int subtype = find_subgeometry_type((yyvsp[(1) - (1)].sval));
 	char* geoSubType = (yyvsp[(1) - (1)].sval);
@@ -12661,8 +12623,8 @@ yyreduce:
 }
     break;
 
-  case 870:
-#line 5018 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 871:
+#line 5023 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { 	char *t = sql_bind_alias((yyvsp[(1) - (1)].sval));
 	  	if (!t) {
 			char *msg = sql_message("\b22000!type (%s) unknown", (yyvsp[(1) - (1)].sval));
@@ -12676,483 +12638,483 @@ yyreduce:
 	}
     break;
 
-  case 871:
-#line 5032 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
-    break;
-
   case 872:
-#line 5033 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = (yyvsp[(1) - (2)].sval); }
+#line 5037 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
   case 873:
-#line 5037 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
+#line 5038 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = (yyvsp[(1) - (2)].sval); }
     break;
 
   case 874:
-#line 5038 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 5042 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
   case 875:
-#line 5039 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = (yyvsp[(1) - (3)].sval); }
+#line 5043 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
   case 876:
-#line 5042 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
+#line 5044 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = (yyvsp[(1) - (3)].sval); }
     break;
 
   case 877:
-#line 5043 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = (yyvsp[(1) - (3)].sval); }
+#line 5047 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
-  case 880:
-#line 5051 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
+  case 878:
+#line 5048 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = (yyvsp[(1) - (3)].sval); }
     break;
 
   case 881:
-#line 5052 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 5056 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
   case 882:
-#line 5053 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 5057 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
   case 883:
-#line 5054 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 5058 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
   case 884:
-#line 5055 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 5059 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
   case 885:
-#line 5056 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 5060 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
   case 886:
-#line 5060 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 5061 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
   case 887:
-#line 5061 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 5065 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
   case 888:
-#line 5062 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 5066 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
   case 889:
-#line 5063 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 5067 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
   case 890:
-#line 5064 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 5068 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
   case 891:
-#line 5065 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 5069 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
   case 892:
-#line 5066 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 5070 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
-  case 894:
+  case 893:
 #line 5071 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "large"); }
+    { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
   case 895:
-#line 5072 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "name"); }
+#line 5076 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "large"); }
     break;
 
   case 896:
-#line 5073 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "object"); }
+#line 5077 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "name"); }
     break;
 
   case 897:
-#line 5074 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "password"); }
+#line 5078 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "object"); }
     break;
 
   case 898:
-#line 5075 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "path"); }
+#line 5079 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "password"); }
     break;
 
   case 899:
-#line 5076 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "precision"); }
+#line 5080 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "path"); }
     break;
 
   case 900:
-#line 5077 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "privileges"); }
+#line 5081 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "precision"); }
     break;
 
   case 901:
-#line 5078 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "role"); }
+#line 5082 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "privileges"); }
     break;
 
   case 902:
-#line 5079 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "size"); }
+#line 5083 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "role"); }
     break;
 
   case 903:
-#line 5080 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "type"); }
+#line 5084 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "size"); }
     break;
 
   case 904:
-#line 5081 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "release"); }
+#line 5085 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "type"); }
     break;
 
   case 905:
-#line 5082 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "value"); }
+#line 5086 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "release"); }
     break;
 
   case 906:
-#line 5083 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "zone"); }
+#line 5087 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "value"); }
     break;
 
   case 907:
-#line 5085 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "action"); }
+#line 5088 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "zone"); }
     break;
 
   case 908:
-#line 5086 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "as"); }
+#line 5090 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "action"); }
     break;
 
   case 909:
-#line 5087 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "authorization"); }
+#line 5091 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "as"); }
     break;
 
   case 910:
-#line 5088 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "column"); }
+#line 5092 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "authorization"); }
     break;
 
   case 911:
-#line 5089 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "cycle"); }
+#line 5093 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "column"); }
     break;
 
   case 912:
-#line 5090 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "distinct"); }
+#line 5094 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "cycle"); }
     break;
 
   case 913:
-#line 5091 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "increment"); }
+#line 5095 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "distinct"); }
     break;
 
   case 914:
-#line 5092 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "maxvalue"); }
+#line 5096 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "increment"); }
     break;
 
   case 915:
-#line 5093 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "minvalue"); }
+#line 5097 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "maxvalue"); }
     break;
 
   case 916:
-#line 5094 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "plan"); }
+#line 5098 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "minvalue"); }
     break;
 
   case 917:
-#line 5095 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "schema"); }
+#line 5099 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "plan"); }
     break;
 
   case 918:
-#line 5096 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "start"); }
+#line 5100 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "schema"); }
     break;
 
   case 919:
-#line 5097 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "statement"); }
+#line 5101 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "start"); }
     break;
 
   case 920:
-#line 5098 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "table"); }
+#line 5102 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "statement"); }
     break;
 
   case 921:
-#line 5100 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "cache"); }
+#line 5103 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "table"); }
     break;
 
   case 922:
-#line 5101 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "data"); }
+#line 5105 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "cache"); }
     break;
 
   case 923:
-#line 5102 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "diagnostics"); }
+#line 5106 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "data"); }
     break;
 
   case 924:
-#line 5103 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "match"); }
+#line 5107 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "diagnostics"); }
     break;
 
   case 925:
-#line 5104 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "options"); }
+#line 5108 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "match"); }
     break;
 
   case 926:
-#line 5105 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "row"); }
+#line 5109 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "options"); }
     break;
 
   case 927:
-#line 5106 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "key"); }
+#line 5110 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "row"); }
     break;
 
   case 928:
-#line 5107 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "language"); }
+#line 5111 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "key"); }
     break;
 
   case 929:
-#line 5108 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "level"); }
+#line 5112 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "language"); }
     break;
 
   case 930:
-#line 5109 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "session"); }
+#line 5113 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "level"); }
     break;
 
   case 931:
-#line 5110 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "date"); }
+#line 5114 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "session"); }
     break;
 
   case 932:
-#line 5111 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "time"); }
+#line 5115 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "date"); }
     break;
 
   case 933:
-#line 5112 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "timestamp"); }
+#line 5116 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "time"); }
     break;
 
   case 934:
-#line 5113 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "interval"); }
+#line 5117 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "timestamp"); }
     break;
 
   case 935:
-#line 5115 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "prepare"); }
+#line 5118 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "interval"); }
     break;
 
   case 936:
-#line 5116 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "execute"); }
+#line 5120 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "prepare"); }
     break;
 
   case 937:
-#line 5117 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "explain"); }
+#line 5121 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "execute"); }
     break;
 
   case 938:
-#line 5118 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "dot"); }
+#line 5122 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "explain"); }
     break;
 
   case 939:
-#line 5119 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "debug"); }
+#line 5123 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "dot"); }
     break;
 
   case 940:
-#line 5120 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "trace"); }
+#line 5124 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "debug"); }
     break;
 
   case 941:
-#line 5121 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "text"); }
+#line 5125 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "trace"); }
     break;
 
   case 942:
-#line 5122 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "auto_commit"); }
+#line 5126 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "text"); }
     break;
 
   case 943:
-#line 5123 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "no"); }
+#line 5127 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "auto_commit"); }
     break;
 
   case 944:
-#line 5125 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "strip"); }
+#line 5128 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "no"); }
     break;
 
   case 945:
-#line 5126 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "whitespace"); }
+#line 5130 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "strip"); }
     break;
 
   case 946:
-#line 5127 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "passing"); }
+#line 5131 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "whitespace"); }
     break;
 
   case 947:
-#line 5128 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "nil"); }
+#line 5132 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "passing"); }
     break;
 
   case 948:
-#line 5129 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "ref"); }
+#line 5133 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "nil"); }
     break;
 
   case 949:
-#line 5130 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "absent"); }
+#line 5134 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "ref"); }
     break;
 
   case 950:
-#line 5131 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "empty"); }
+#line 5135 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "absent"); }
     break;
 
   case 951:
-#line 5132 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "document"); }
+#line 5136 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "empty"); }
     break;
 
   case 952:
-#line 5133 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "element"); }
+#line 5137 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "document"); }
     break;
 
   case 953:
-#line 5134 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "content"); }
+#line 5138 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "element"); }
     break;
 
   case 954:
-#line 5135 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "namespace"); }
+#line 5139 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "content"); }
     break;
 
   case 955:
-#line 5136 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "returning"); }
+#line 5140 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "namespace"); }
     break;
 
   case 956:
-#line 5137 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "location"); }
+#line 5141 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "returning"); }
     break;
 
   case 957:
-#line 5138 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "id"); }
+#line 5142 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "location"); }
     break;
 
   case 958:
-#line 5139 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "according"); }
+#line 5143 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "id"); }
     break;
 
   case 959:
-#line 5140 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "uri"); }
+#line 5144 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "according"); }
     break;
 
   case 960:
-#line 5141 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "filter"); }
+#line 5145 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "uri"); }
     break;
 
   case 961:
-#line 5142 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "temporary"); }
+#line 5146 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "filter"); }
     break;
 
   case 962:
-#line 5143 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "temp"); }
+#line 5147 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "temporary"); }
     break;
 
   case 963:
-#line 5144 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "analyze"); }
+#line 5148 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "temp"); }
     break;
 
   case 964:
-#line 5145 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "MinMax"); }
+#line 5149 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "analyze"); }
     break;
 
   case 965:
-#line 5146 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "storage"); }
+#line 5150 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "MinMax"); }
     break;
 
   case 966:
-#line 5147 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = sa_strdup(SA, "geometry"); }
+#line 5151 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "storage"); }
     break;
 
   case 967:
-#line 5151 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_string(L(), (yyvsp[(1) - (1)].sval)); }
+#line 5152 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = sa_strdup(SA, "geometry"); }
     break;
 
   case 968:
-#line 5153 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_string((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sval)); }
+#line 5156 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_string(L(), (yyvsp[(1) - (1)].sval)); }
     break;
 
   case 969:
-#line 5157 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 5158 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_string((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sval)); }
+    break;
+
+  case 970:
+#line 5162 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { 
 		lng l = (yyvsp[(1) - (1)].l_val);
 #if SIZEOF_WRD == SIZEOF_INT
@@ -13170,8 +13132,8 @@ yyreduce:
 	}
     break;
 
-  case 970:
-#line 5176 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 971:
+#line 5181 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 		  char *end = NULL, *s = (yyvsp[(1) - (1)].sval);
 		  int l = _strlen(s);
@@ -13194,8 +13156,8 @@ yyreduce:
 		}
     break;
 
-  case 971:
-#line 5199 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 972:
+#line 5204 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 		  char *end = NULL, *s = (yyvsp[(1) - (1)].sval);
 		  int l = _strlen(s);
@@ -13218,8 +13180,8 @@ yyreduce:
 		}
     break;
 
-  case 972:
-#line 5219 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 973:
+#line 5224 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 		  char *name = (yyvsp[(1) - (1)].sval);
 		  sql_subtype *tpe;
@@ -13251,88 +13213,88 @@ yyreduce:
 		}
     break;
 
-  case 973:
-#line 5252 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 974:
+#line 5257 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
     break;
 
-  case 974:
-#line 5254 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 975:
+#line 5259 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { char *s = strconcat((yyvsp[(1) - (2)].sval),(yyvsp[(2) - (2)].sval)); 
 	 	  (yyval.sval) = sa_strdup(SA, s);	
 		  _DELETE(s);
 		}
     break;
 
-  case 975:
-#line 5262 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 976:
+#line 5267 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     {
 		  m->emode = m_execute;
 		  (yyval.sym) = (yyvsp[(2) - (2)].sym); }
     break;
 
-  case 976:
-#line 5269 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 977:
+#line 5274 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   	  append_int(l, (yyvsp[(1) - (3)].i_val));
   	  append_list(l, NULL);
 	  (yyval.sym) = _symbol_create_list( SQL_NOP, l ); }
     break;
 
-  case 977:
-#line 5274 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 978:
+#line 5279 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
   	  append_int(l, (yyvsp[(1) - (4)].i_val));
   	  append_list(l, (yyvsp[(3) - (4)].l));
 	  (yyval.sym) = _symbol_create_list( SQL_NOP, l ); }
     break;
 
-  case 978:
-#line 5288 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 979:
+#line 5293 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = NULL; }
     break;
 
-  case 980:
-#line 5293 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 981:
+#line 5298 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = _symbol_create_list( SQL_PATH, (yyvsp[(2) - (2)].l)); }
     break;
 
-  case 983:
-#line 5304 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 984:
+#line 5309 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol(L(), (yyvsp[(1) - (1)].sym)); }
     break;
 
-  case 984:
-#line 5306 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 985:
+#line 5311 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sym)); }
     break;
 
-  case 996:
-#line 5328 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 997:
+#line 5333 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(3) - (5)].sym));
 	  append_int(l, (yyvsp[(4) - (5)].i_val));
 	  (yyval.sym) = _symbol_create_list( SQL_XMLCOMMENT, l); }
     break;
 
-  case 997:
-#line 5336 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 998:
+#line 5341 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_list(l, (yyvsp[(3) - (5)].l));
 	  append_int(l, (yyvsp[(4) - (5)].i_val));
 	  (yyval.sym) = _symbol_create_list( SQL_XMLCONCAT, l); }
     break;
 
-  case 998:
-#line 5344 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 999:
+#line 5349 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(3) - (5)].sym));
 	  append_int(l, (yyvsp[(4) - (5)].i_val));
 	  (yyval.sym) = _symbol_create_list( SQL_XMLDOCUMENT, l); }
     break;
 
-  case 999:
-#line 5354 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1000:
+#line 5359 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_string(l, (yyvsp[(4) - (7)].sval));
 	  append_list(l, (yyvsp[(5) - (7)].l));
@@ -13341,72 +13303,72 @@ yyreduce:
 	}
     break;
 
-  case 1000:
-#line 5364 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1001:
+#line 5369 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = NULL; }
     break;
 
-  case 1001:
-#line 5366 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1002:
+#line 5371 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol(L(), (yyvsp[(2) - (2)].sym));
 	  (yyval.l) = append_symbol((yyval.l), NULL);
 	  (yyval.l) = append_list((yyval.l), NULL); }
     break;
 
-  case 1002:
-#line 5370 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1003:
+#line 5375 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol(L(), (yyvsp[(2) - (4)].sym));
 	  (yyval.l) = append_symbol((yyval.l), (yyvsp[(4) - (4)].sym));
 	  (yyval.l) = append_list((yyval.l), NULL); }
     break;
 
-  case 1003:
-#line 5374 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1004:
+#line 5379 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol(L(), (yyvsp[(2) - (6)].sym));
 	  (yyval.l) = append_symbol((yyval.l), (yyvsp[(4) - (6)].sym));
 	  (yyval.l) = append_list((yyval.l), (yyvsp[(6) - (6)].l)); }
     break;
 
-  case 1004:
-#line 5378 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1005:
+#line 5383 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol(L(), (yyvsp[(2) - (4)].sym));
 	  (yyval.l) = append_symbol((yyval.l), NULL);
 	  (yyval.l) = append_list((yyval.l), (yyvsp[(4) - (4)].l)); }
     break;
 
-  case 1005:
-#line 5382 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1006:
+#line 5387 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol(L(), NULL);
 	  (yyval.l) = append_symbol((yyval.l), (yyvsp[(2) - (2)].sym));
 	  (yyval.l) = append_list((yyval.l), NULL); }
     break;
 
-  case 1006:
-#line 5386 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1007:
+#line 5391 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol(L(), NULL);
 	  (yyval.l) = append_symbol((yyval.l), (yyvsp[(2) - (4)].sym));
 	  (yyval.l) = append_list((yyval.l), (yyvsp[(4) - (4)].l)); }
     break;
 
-  case 1007:
-#line 5390 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1008:
+#line 5395 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol(L(), NULL);
 	  (yyval.l) = append_symbol((yyval.l), NULL);
 	  (yyval.l) = append_list((yyval.l), (yyvsp[(2) - (2)].l)); }
     break;
 
-  case 1009:
-#line 5400 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1010:
+#line 5405 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(3) - (4)].sym); }
     break;
 
-  case 1010:
-#line 5404 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1011:
+#line 5409 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(1) - (1)].sym); }
     break;
 
-  case 1011:
-#line 5406 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1012:
+#line 5411 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  append_list(l, 
 		  	append_string(L(), sa_strdup(SA, "concat")));
@@ -13415,78 +13377,78 @@ yyreduce:
 	  	  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 1012:
-#line 5416 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1013:
+#line 5421 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_string(l, (yyvsp[(2) - (2)].sval));
 	  append_symbol(l, (yyvsp[(1) - (2)].sym));
 	  (yyval.sym) = _symbol_create_list( SQL_XMLATTRIBUTE, l ); }
     break;
 
-  case 1013:
-#line 5423 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1014:
+#line 5428 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = NULL; }
     break;
 
-  case 1014:
-#line 5424 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1015:
+#line 5429 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sval) = (yyvsp[(2) - (2)].sval); }
     break;
 
-  case 1017:
-#line 5437 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1018:
+#line 5442 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = L();
 		  (yyval.l) = append_list((yyval.l), (yyvsp[(1) - (2)].l));
 		  (yyval.l) = append_int((yyval.l), (yyvsp[(2) - (2)].i_val)); 	}
     break;
 
-  case 1018:
-#line 5444 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1019:
+#line 5449 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol(L(), (yyvsp[(1) - (1)].sym)); }
     break;
 
-  case 1019:
-#line 5446 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1020:
+#line 5451 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.l) = append_symbol((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].sym)); }
     break;
 
-  case 1021:
-#line 5454 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1022:
+#line 5459 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 0; }
     break;
 
-  case 1022:
-#line 5455 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1023:
+#line 5460 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = (yyvsp[(2) - (2)].i_val); }
     break;
 
-  case 1023:
-#line 5459 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1024:
+#line 5464 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 0; }
     break;
 
-  case 1024:
-#line 5460 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1025:
+#line 5465 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 1; }
     break;
 
-  case 1025:
-#line 5461 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1026:
+#line 5466 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 2; }
     break;
 
-  case 1026:
-#line 5462 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1027:
+#line 5467 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 3; }
     break;
 
-  case 1027:
-#line 5463 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1028:
+#line 5468 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 4; }
     break;
 
-  case 1028:
-#line 5470 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1029:
+#line 5475 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(3) - (7)].sym));
 	  append_list(l, (yyvsp[(4) - (7)].l));
@@ -13496,54 +13458,54 @@ yyreduce:
 	}
     break;
 
-  case 1029:
-#line 5480 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = NULL; }
-    break;
-
   case 1030:
-#line 5481 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = (yyvsp[(1) - (2)].sym); }
+#line 5485 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sym) = NULL; }
     break;
 
   case 1031:
 #line 5486 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_list(L(), (yyvsp[(1) - (1)].l)); }
+    { (yyval.sym) = (yyvsp[(1) - (2)].sym); }
     break;
 
   case 1032:
-#line 5488 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_list((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].l)); }
+#line 5491 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.l) = append_list(L(), (yyvsp[(1) - (1)].l)); }
     break;
 
   case 1033:
 #line 5493 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.l) = append_symbol(L(), (yyvsp[(1) - (2)].sym));
-		  (yyval.l) = append_string((yyval.l), (yyvsp[(2) - (2)].sval)); }
+    { (yyval.l) = append_list((yyvsp[(1) - (3)].l), (yyvsp[(3) - (3)].l)); }
     break;
 
   case 1034:
 #line 5498 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sym) = (yyvsp[(1) - (1)].sym); }
+    { (yyval.l) = append_symbol(L(), (yyvsp[(1) - (2)].sym));
+		  (yyval.l) = append_string((yyval.l), (yyvsp[(2) - (2)].sval)); }
     break;
 
   case 1035:
-#line 5502 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = NULL; }
+#line 5503 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sym) = (yyvsp[(1) - (1)].sym); }
     break;
 
   case 1036:
-#line 5503 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = (yyvsp[(2) - (2)].sval); }
+#line 5507 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = NULL; }
     break;
 
   case 1037:
-#line 5507 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
-    { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
+#line 5508 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = (yyvsp[(2) - (2)].sval); }
     break;
 
   case 1038:
-#line 5514 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 5512 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+    { (yyval.sval) = (yyvsp[(1) - (1)].sval); }
+    break;
+
+  case 1039:
+#line 5519 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_int(l, (yyvsp[(3) - (6)].i_val) );
 	  append_symbol(l, (yyvsp[(4) - (6)].sym));
@@ -13551,18 +13513,18 @@ yyreduce:
 	  (yyval.sym) = _symbol_create_list( SQL_XMLPARSE, l); }
     break;
 
-  case 1039:
-#line 5521 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1040:
+#line 5526 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 0; }
     break;
 
-  case 1040:
-#line 5522 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1041:
+#line 5527 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 1; }
     break;
 
-  case 1041:
-#line 5529 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1042:
+#line 5534 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_string(l, (yyvsp[(4) - (7)].sval));
 	  append_symbol(l, (yyvsp[(5) - (7)].sym));
@@ -13570,76 +13532,76 @@ yyreduce:
 	  (yyval.sym) = _symbol_create_list( SQL_XMLPI, l); }
     break;
 
-  case 1043:
-#line 5541 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1044:
+#line 5546 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = NULL; }
     break;
 
-  case 1044:
-#line 5543 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1045:
+#line 5548 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(2) - (2)].sym); }
     break;
 
-  case 1045:
-#line 5554 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1046:
+#line 5559 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = NULL; }
     break;
 
-  case 1060:
-#line 5600 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1061:
+#line 5605 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  append_symbol(l, (yyvsp[(3) - (5)].sym));
 	  append_int(l, (yyvsp[(4) - (5)].i_val));
 	  (yyval.sym) = _symbol_create_list( SQL_XMLTEXT, l); }
     break;
 
-  case 1061:
-#line 5611 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1062:
+#line 5616 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = NULL; }
     break;
 
-  case 1063:
-#line 5616 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1064:
+#line 5621 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 2; }
     break;
 
-  case 1064:
-#line 5620 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1065:
+#line 5625 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 0; }
     break;
 
-  case 1065:
-#line 5621 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1066:
+#line 5626 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 1; }
     break;
 
-  case 1066:
-#line 5625 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1067:
+#line 5630 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 0; }
     break;
 
-  case 1067:
-#line 5626 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1068:
+#line 5631 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 0; }
     break;
 
-  case 1068:
-#line 5627 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1069:
+#line 5632 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.i_val) = 1; }
     break;
 
-  case 1069:
-#line 5642 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1070:
+#line 5647 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(3) - (4)].sym); }
     break;
 
-  case 1070:
-#line 5646 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1071:
+#line 5651 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = (yyvsp[(1) - (1)].sym); }
     break;
 
-  case 1071:
-#line 5648 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1072:
+#line 5653 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 		  append_list(l, 
 		  	append_string(L(), sa_strdup(SA, "concat")));
@@ -13648,8 +13610,8 @@ yyreduce:
 	  	  (yyval.sym) = _symbol_create_list( SQL_BINOP, l ); }
     break;
 
-  case 1076:
-#line 5671 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1077:
+#line 5676 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { char *s = strconcat("xmlns:", (yyvsp[(3) - (3)].sval));
 				  dlist *l = L();
 	  			  append_string(l, sa_strdup(SA, s));
@@ -13658,21 +13620,21 @@ yyreduce:
 	  			  (yyval.sym) = _symbol_create_list( SQL_XMLATTRIBUTE, l ); }
     break;
 
-  case 1077:
-#line 5680 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1078:
+#line 5685 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { dlist *l = L();
 	  			  append_string(l, sa_strdup(SA, "xmlns" ));
 	  			  append_symbol(l, (yyvsp[(2) - (2)].sym));
 	  			  (yyval.sym) = _symbol_create_list( SQL_XMLATTRIBUTE, l ); }
     break;
 
-  case 1078:
-#line 5684 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1079:
+#line 5689 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { (yyval.sym) = NULL; }
     break;
 
-  case 1108:
-#line 5780 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+  case 1109:
+#line 5785 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
     { 
           dlist *aggr = L();
 
@@ -13696,7 +13658,7 @@ yyreduce:
 
 
 /* Line 1267 of yacc.c.  */
-#line 13700 "y.tab.c"
+#line 13662 "y.tab.c"
       default: break;
     }
   YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
@@ -13910,7 +13872,7 @@ yyreturn:
 }
 
 
-#line 5801 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
+#line 5806 "/Users/hannes/source/MonetDBLite/src/sql/server/sql_parser.y"
 
 int find_subgeometry_type(char* geoSubType) {
 	int subType = 0;
@@ -14073,6 +14035,7 @@ char *token2string(int token)
 	SQL(COPYFROM);
 	SQL(BINCOPYFROM);
 	SQL(COPYTO);
+	SQL(BINCOPYTO);
 	SQL(EXPORT);
 	SQL(NEXT);
 	SQL(MULSTMT);
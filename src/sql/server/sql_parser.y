@@ -2535,6 +2535,11 @@ copyfrom_stmt:
 	  append_list(l, $5);
 	  append_string(l, $6);
 	  $$ = _symbol_create_list( SQL_COPYTO, l ); }
+  | COPY query_expression_def INTO BINARY string_commalist /* binary copy into */
+	{ dlist *l = L();
+	  append_symbol(l, $2);
+	  append_list(l, $5);
+	  $$ = _symbol_create_list( SQL_BINCOPYTO, l ); }
   ;
 
 opt_fwf_widths:
@@ -5960,6 +5965,7 @@ char *token2string(int token)
 	SQL(COPYFROM);
 	SQL(BINCOPYFROM);
 	SQL(COPYTO);
+	SQL(BINCOPYTO);
 	SQL(EXPORT);
 	SQL(NEXT);
 	SQL(MULSTMT);
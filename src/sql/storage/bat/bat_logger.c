@@ -403,6 +403,24 @@ bl_tend(void)
 	return log_tend(bat_logger);
 }
 
+static void
+bl_commit_delay(int ms)
+{
+	log_commit_delay(bat_logger, ms);
+}
+
+static lng
+bl_commits(void)
+{
+	return log_commits(bat_logger);
+}
+
+static int
+bl_sync(lng nr)
+{
+	return log_sync(bat_logger, nr);
+}
+
 static int 
 bl_sequence(int seq, lng id)
 {
@@ -433,6 +451,9 @@ bat_logger_init( logger_functions *lf )
 	lf->log_isnew = bl_log_isnew;
 	lf->log_tstart = bl_tstart;
 	lf->log_tend = bl_tend;
+	lf->log_commit_delay = bl_commit_delay;
+	lf->log_commits = bl_commits;
+	lf->log_sync = bl_sync;
 	lf->log_sequence = bl_sequence;
 	lf->log_isdestroyed = bl_isdestroyed;
 
@@ -15,10 +15,17 @@
 
 #define SNAPSHOT_MINSIZE ((BUN) 1024*128)
 
+/* transactions started by sql_trans_begin_snapshot are not listed, so
+ * this is the oldest transaction started under the store lock (or tr
+ * itself) */
 static sql_trans *
-oldest_active_transaction(void)
+oldest_active_transaction(sql_trans *tr)
 {
-	sql_session *s = active_sessions->h->data;
+	sql_session *s;
+
+	if (!active_sessions->h)
+		return tr;
+	s = active_sessions->h->data;
 	return s->tr;
 }
 
@@ -209,6 +216,161 @@ bind_idx(sql_trans *tr, sql_idx * i, int access)
 	return delta_bind_bat( i->data, access, isTemp(i));
 }
 
+static void
+BATcleanProps( BAT *b )
+{
+	if (b->T->props) {
+		PROPdestroy(b->T->props);
+		b->T->props = NULL;
+	}
+}
+
+/* The min and max properties of the persistent column bats are kept up
+ * to date whenever inserts and updates are merged into them at commit,
+ * at a cost proportional to the merged values only. Updates can only
+ * widen the range, so the bounds may be loose but are never wrong. */
+static int
+minmax_type(BAT *b)
+{
+	return b->ttype != TYPE_void && ATOMstorage(b->ttype) < TYPE_str &&
+		ATOMstorage(b->ttype) != TYPE_ptr;
+}
+
+/* start with nil bounds, i.e. no values yet */
+static int
+minmax_init(BAT *b, ValPtr min, ValPtr max)
+{
+	if (!minmax_type(b))
+		return 0;
+	VALset(min, b->ttype, (ptr) ATOMnilptr(b->ttype));
+	VALset(max, b->ttype, (ptr) ATOMnilptr(b->ttype));
+	return 1;
+}
+
+/* get the current bounds of b */
+static int
+minmax_get(BAT *b, ValPtr min, ValPtr max)
+{
+	ValPtr pmin, pmax;
+
+	if (BATcount(b) == 0)
+		return minmax_init(b, min, max);
+	if (!minmax_type(b))
+		return 0;
+	if ((pmin = BATgetpropval(b, GDK_MIN_VALUE)) == NULL ||
+	    (pmax = BATgetpropval(b, GDK_MAX_VALUE)) == NULL)
+		return 0;
+	*min = *pmin;
+	*max = *pmax;
+	return 1;
+}
+
+/* widen the bounds with the values of u, returns 0 if that failed and
+ * the bounds can no longer be trusted */
+static int
+minmax_widen(ValPtr min, ValPtr max, BAT *u)
+{
+	int tt = min->vtype;
+	const void *nil = ATOMnilptr(tt);
+	ValRecord v;
+
+	if (!BATcount(u))
+		return 1;
+	if (ATOMtype(u->ttype) != ATOMtype(tt))
+		return 0;
+	v.vtype = tt;
+	if (BATmin(u, &v.val) == NULL)
+		return 0;
+	if (ATOMcmp(tt, &v.val, nil) != 0 &&
+	    (ATOMcmp(tt, VALptr(min), nil) == 0 || ATOMcmp(tt, &v.val, VALptr(min)) < 0))
+		*min = v;
+	if (BATmax(u, &v.val) == NULL)
+		return 0;
+	if (ATOMcmp(tt, &v.val, nil) != 0 &&
+	    (ATOMcmp(tt, VALptr(max), nil) == 0 || ATOMcmp(tt, &v.val, VALptr(max)) > 0))
+		*max = v;
+	return 1;
+}
+
+static void
+minmax_set(BAT *b, ValPtr min, ValPtr max)
+{
+	if (ATOMcmp(min->vtype, VALptr(min), ATOMnilptr(min->vtype)) == 0)
+		return;
+	BATsetprop(b, GDK_MIN_VALUE, min->vtype, VALget(min));
+	BATsetprop(b, GDK_MAX_VALUE, max->vtype, VALget(max));
+}
+
+#define UPDATE_COMPACT_MIN 1024
+
+/* Continuous point updates would otherwise grow the update delta
+ * without bound, while every scan, every new transaction and the final
+ * merge replays all of it. Once it has doubled since it was last
+ * compacted it is rewritten as a run sorted on row id, keeping only
+ * the last update of each row. */
+static int
+delta_compact_updates( sql_delta *bat )
+{
+	BAT *ui, *uv, *sui = NULL, *ord = NULL, *keep, *nui, *nuv;
+	const oid *id, *o;
+	oid *k;
+	BUN i, n, cnt = 0;
+
+	ui = temp_descriptor(bat->uibid);
+	n = BATcount(ui);
+	if (n < UPDATE_COMPACT_MIN || n < 2 * bat->ucompact) {
+		bat_destroy(ui);
+		return LOG_OK;
+	}
+	if (BATsort(&sui, &ord, NULL, ui, NULL, NULL, 0, 1) != GDK_SUCCEED) {
+		bat_destroy(ui);
+		return LOG_ERR;
+	}
+	if ((keep = bat_new(TYPE_void, TYPE_oid, n, TRANSIENT)) == NULL) {
+		bat_destroy(sui);
+		bat_destroy(ord);
+		bat_destroy(ui);
+		return LOG_ERR;
+	}
+	/* the sort is stable, the last of a run of equal ids is the latest;
+	 * sorted input comes back as dense (void) bats */
+	id = sui->ttype == TYPE_void ? NULL : (const oid *) Tloc(sui, BUNfirst(sui));
+	o = ord->ttype == TYPE_void ? NULL : (const oid *) Tloc(ord, BUNfirst(ord));
+	k = (oid *) Tloc(keep, BUNfirst(keep));
+	for (i = 0; i < n; i++)
+		if (!id || i + 1 == n || id[i] != id[i + 1])
+			k[cnt++] = o ? o[i] : ord->tseqbase + i;
+	bat_destroy(sui);
+	bat_destroy(ord);
+	BATsetcount(keep, cnt);
+	keep->tsorted = keep->trevsorted = cnt <= 1;
+	keep->tkey = 1;
+	keep->tdense = 0;
+	keep->T->nil = 0;
+	keep->T->nonil = 1;
+
+	uv = temp_descriptor(bat->uvbid);
+	nui = BATproject(keep, ui);
+	nuv = BATproject(keep, uv);
+	bat_destroy(keep);
+	bat_destroy(ui);
+	bat_destroy(uv);
+	if (nui == NULL || nuv == NULL) {
+		bat_destroy(nui);
+		bat_destroy(nuv);
+		return LOG_ERR;
+	}
+	nui->tsorted = nui->tkey = 1;
+	temp_destroy(bat->uibid);
+	temp_destroy(bat->uvbid);
+	bat->uibid = temp_create(nui);
+	bat->uvbid = temp_create(nuv);
+	bat->ucompact = cnt;
+	bat_destroy(nui);
+	bat_destroy(nuv);
+	return LOG_OK;
+}
+
 static int
 delta_update_bat( sql_delta *bat, BAT *tids, BAT *updates, int is_new) 
 {
@@ -276,6 +438,8 @@ delta_update_bat( sql_delta *bat, BAT *tids, BAT *updates, int is_new)
 			bat_destroy(updates);
 			tids = otids;
 		}
+		if (delta_compact_updates(bat) != LOG_OK)
+			return LOG_ERR;
 	} else if (is_new && bat->bid) { 
 		BAT *ib = temp_descriptor(bat->ibid);
 		b = temp_descriptor(bat->bid);
@@ -304,6 +468,8 @@ delta_update_bat( sql_delta *bat, BAT *tids, BAT *updates, int is_new)
 			b = temp_descriptor(bat->bid);
 			void_replace_bat(b, tids, updates, TRUE);
 		}
+		/* updated in place, the bounds may no longer hold */
+		BATcleanProps(b);
 		bat_destroy(ib);
 		bat_destroy(b);
 	} else {
@@ -356,6 +522,10 @@ delta_update_val( sql_delta *bat, oid rid, void *upd)
 			bat->ucnt++;
 			bat_destroy(ui);
 			bat_destroy(uv);
+			if (delta_compact_updates(bat) != LOG_OK) {
+				bat_destroy(ib);
+				return LOG_ERR;
+			}
 		}
 		bat_destroy(ib);
 	} else {
@@ -378,6 +548,7 @@ dup_delta(sql_trans *tr, sql_delta *obat, sql_delta *bat, int type, int oc_isnew
 	bat->ibase = obat->ibase;
 	bat->cnt = obat->cnt;
 	bat->ucnt = obat->ucnt;
+	bat->ucompact = obat->ucompact;
 	bat->wtime = obat->wtime;
 
 	bat->name = _STRDUP(obat->name);
@@ -835,10 +1006,46 @@ count_col(sql_trans *tr, sql_column *c, int all)
 		return b->cnt - b->ibase;
 }
 
+/* Estimate the number of distinct values in a column of cnt values from
+ * the sorted sample s (the Duj1 estimator of Haas et al.), the values
+ * seen only once in the sample tell how many are missed. */
+static size_t
+sample_dcount(BAT *s, size_t cnt)
+{
+	BATiter si = bat_iterator(s);
+	BUN p, q, run = 0;
+	dbl n = (dbl) BATcount(s), d = 0, f1 = 0;
+	const void *prv = NULL;
+
+	BATloop(s, p, q) {
+		const void *v = BUNtail(si, p);
+
+		if (prv && ATOMcmp(s->ttype, prv, v) == 0) {
+			run++;
+		} else {
+			if (run == 1)
+				f1++;
+			d++;
+			run = 1;
+		}
+		prv = v;
+	}
+	if (run == 1)
+		f1++;
+	if (n == 0)
+		return 0;
+	return (size_t) (n * d / (n - f1 + f1 * n / cnt));
+}
+
+/* columns up to this size are counted exactly when a query is
+ * compiled, larger ones are sampled */
+#define DCOUNT_EXACT	(64 * 1024)
+
 static size_t
 dcount_col(sql_trans *tr, sql_column *c)
 {
 	sql_delta *b;
+	BAT *v;
 
 	if (!isTable(c->t)) 
 		return 0;
@@ -849,25 +1056,36 @@ dcount_col(sql_trans *tr, sql_column *c)
         b = c->data;
 	if (!b)
 		return 1;
-	if (b->cnt > 1024) {
+	/* small columns are counted exactly, large ones on a sample;
+	 * without the column bat fall back to the default estimate */
+	if (b->cnt > 0 && (v = delta_bind_bat(b, RDONLY, 0)) != NULL) {
 		size_t dcnt = 0;
-		dbl f = 1.0;
-		BAT *v = delta_bind_bat(b, RDONLY, 0), *o = v, *u;
-
-		if ((dcnt = (size_t) BATcount(v)) > 1024*1024) {
-			v = BATsample(v, 1024);
-			f = dcnt/1024.0;
+		BAT *u, *s;
+
+		if ((dcnt = (size_t) BATcount(v)) > DCOUNT_EXACT) {
+			if (!v->tkey) {
+				/* the sample holds the positions of the values */
+				s = BATsample(v, 1024);
+				u = s?BATproject(s, v):NULL;
+				bat_destroy(s);
+				if (u && BATsort(&s, NULL, NULL, u, NULL, NULL, 0, 0) == GDK_SUCCEED) {
+					dcnt = sample_dcount(s, dcnt);
+					bat_destroy(s);
+				}
+				bat_destroy(u);
+			}
+			bat_destroy(v);
+			return dcnt;
 		}
 		u = BATunique(v, NULL);
-		bat_destroy(o);
-		if (v!=o)
-			bat_destroy(v);
-		dcnt = (size_t) (BATcount(u) * f);
-		bat_destroy(u);
+		bat_destroy(v);
+		if (u) {
+			dcnt = (size_t) BATcount(u);
+			bat_destroy(u);
+		}
 		return dcnt;
-	} else {
-		return 64;
 	}
+	return 64;
 }
 
 static size_t
@@ -949,6 +1167,50 @@ double_elim_col(sql_trans *tr, sql_column *col)
 	return de;
 }
 
+/* the bounds of the values of a column as seen by tr: those maintained
+ * on the persistent bat widened with the transaction's own inserts and
+ * updates, formatted as strings (like the analyze statistics) */
+static int
+minmax_col(sql_trans *tr, sql_column *c, char **min, char **max)
+{
+	sql_delta *d;
+	BAT *b;
+	ValRecord vmin, vmax;
+	int ok;
+
+	if (!isTable(c->t) || c->type.type->localtype >= TYPE_str)
+		return 0;
+	if (!c->data) {
+		sql_column *oc = tr_find_column(tr->parent, c);
+		c->data = timestamp_delta(oc->data, tr->stime);
+	}
+	d = c->data;
+	if (!d || !d->bid || (b = temp_descriptor(d->bid)) == NULL)
+		return 0;
+	ok = minmax_get(b, &vmin, &vmax);
+	bat_destroy(b);
+	if (!ok)
+		return 0;
+	if (d->ibid && (b = temp_descriptor(d->ibid)) != NULL) {
+		ok = minmax_widen(&vmin, &vmax, b);
+		bat_destroy(b);
+	}
+	if (ok && d->uvbid && (b = temp_descriptor(d->uvbid)) != NULL) {
+		ok = minmax_widen(&vmin, &vmax, b);
+		bat_destroy(b);
+	}
+	if (!ok || ATOMcmp(vmin.vtype, VALptr(&vmin), ATOMnilptr(vmin.vtype)) == 0)
+		return 0;
+	*min = *max = NULL;
+	if (ATOMformat(vmin.vtype, VALptr(&vmin), min) < 0 ||
+	    ATOMformat(vmax.vtype, VALptr(&vmax), max) < 0) {
+		_DELETE(*min);
+		_DELETE(*max);
+		return 0;
+	}
+	return 1;
+}
+
 static int
 load_delta(sql_delta *bat, int bid, int type)
 {
@@ -960,7 +1222,7 @@ load_delta(sql_delta *bat, int bid, int type)
 	bat->bid = temp_create(b);
 	bat->ibase = BATcount(b);
 	bat->cnt = bat->ibase; 
-	bat->ucnt = 0; 
+	bat->ucnt = bat->ucompact = 0; 
 	bat->uibid = e_bat(TYPE_oid);
 	bat->uvbid = e_bat(type);
 	bat->ibid = e_bat(type);
@@ -1021,7 +1283,7 @@ new_persistent_delta( sql_delta *bat, int sz )
 
 		bat->ibase = BATcount(b);
 		bat->cnt = BATcount(b) + BATcount(i);
-		bat->ucnt = 0;
+		bat->ucnt = bat->ucompact = 0;
 		bat->ibid = temp_copy(i->batCacheid, FALSE);
 		if (bat->ibid == BID_NIL) 
 			return LOG_ERR;
@@ -1036,7 +1298,7 @@ new_persistent_delta( sql_delta *bat, int sz )
 
 		bat->bid = bat->ibid;
 		bat->cnt = bat->ibase = BATcount(b);
-		bat->ucnt = 0;
+		bat->ucnt = bat->ucompact = 0;
 		bat_destroy(b);
 
 		i = bat_new(TYPE_void, type, sz, PERSISTENT);
@@ -1069,7 +1331,7 @@ create_delta( sql_delta *d, BAT *b, BAT *i)
 		d->bid = temp_create(b);
 	}
 	d->uibid = d->uvbid = 0;
-	d->ucnt = 0;
+	d->ucnt = d->ucompact = 0;
 }
 
 static bat
@@ -1207,7 +1469,7 @@ create_idx(sql_trans *tr, sql_idx *ni)
 		bat->ibid = copyBat(d->ibid, type, d->ibase);
 		bat->ibase = d->ibase;
 		bat->cnt = d->cnt;
-		bat->ucnt = 0;
+		bat->ucnt = bat->ucompact = 0;
 
 		if (d->uibid) 
 			bat->uibid = e_bat(TYPE_oid);
@@ -1515,7 +1777,7 @@ clear_delta(sql_trans *tr, sql_delta *bat)
 		bat_destroy(b);
 	}
 	bat->cnt = 0;
-	bat->ucnt = 0;
+	bat->ucnt = bat->ucompact = 0;
 	bat->wtime = tr->wstime;
 	return sz;
 }
@@ -1562,7 +1824,7 @@ empty_col(sql_column *c)
 	bat->ibid = e_bat(type);
 	bat->ibase = 0;
 	bat->cnt = BATcount(BBPquickdesc(bat->bid, 0));
-	bat->ucnt = 0;
+	bat->ucnt = bat->ucompact = 0;
 
 	if (bat->bid == bat->ibid)
 		bat->bid = copyBat(bat->ibid, type, 0);
@@ -1597,7 +1859,7 @@ empty_idx(sql_idx *i)
 	bat->ibid = e_bat(type);
 	bat->ibase = 0;
 	bat->cnt = BATcount(BBPquickdesc(bat->bid, 0));
-	bat->ucnt = 0;
+	bat->ucnt = bat->ucompact = 0;
 
 	if (bat->bid == bat->ibid) 
 		bat->bid = copyBat(bat->ibid, type, 0);
@@ -1655,25 +1917,18 @@ clear_del(sql_trans *tr, sql_table *t)
 	return clear_dbat(tr, t->data);
 }
 
-static void
-BATcleanProps( BAT *b )
-{
-	if (b->T->props) {
-		PROPdestroy(b->T->props);
-		b->T->props = NULL;
-	}
-}
-
 static int 
 gtr_update_delta( sql_trans *tr, sql_delta *cbat, int *changes)
 {
-	int ok = LOG_OK;
+	int ok = LOG_OK, mm;
 	BAT *ins, *cur;
+	ValRecord min, max;
 
 	(void)tr;
 	assert(store_nr_active==0);
 	
 	cur = temp_descriptor(cbat->bid);
+	mm = minmax_get(cur, &min, &max);
 	ins = temp_descriptor(cbat->ibid);
 	/* any inserts */
 	if (BUNlast(ins) > BUNfirst(ins)) {
@@ -1682,6 +1937,8 @@ gtr_update_delta( sql_trans *tr, sql_delta *cbat, int *changes)
 		BATappend(cur,ins,TRUE);
 		cbat->cnt = cbat->ibase = BATcount(cur);
 		BATcleanProps(cur);
+		if (mm)
+			mm = minmax_widen(&min, &max, ins);
 		temp_destroy(cbat->ibid);
 		cbat->ibid = e_bat(cur->ttype);
 	}
@@ -1694,15 +1951,21 @@ gtr_update_delta( sql_trans *tr, sql_delta *cbat, int *changes)
 		if (BUNlast(ui) > BUNfirst(ui)) {
 			(*changes)++;
 			void_replace_bat(cur, ui, uv, TRUE);
+			if (mm)
+				mm = minmax_widen(&min, &max, uv);
 			temp_destroy(cbat->uibid);
 			temp_destroy(cbat->uvbid);
 			cbat->uibid = e_bat(TYPE_oid);
 			cbat->uvbid = e_bat(cur->ttype);
-			cbat->ucnt = 0;
+			cbat->ucnt = cbat->ucompact = 0;
 		}
 		bat_destroy(ui);
 		bat_destroy(uv);
 	}
+	if (mm)
+		minmax_set(cur, &min, &max);
+	else if (cur)
+		BATcleanProps(cur);
 	bat_destroy(cur);
 	if (cbat->next) { 
 		ok = destroy_bat(tr, cbat->next);
@@ -1818,54 +2081,226 @@ gtr_update( sql_trans *tr )
 	return _gtr_update(tr, &gtr_update_table);
 }
 
-static int 
-gtr_minmax_col( sql_trans *tr, sql_column *c)
+/* only bats which made it to disk once can be written out as snapshot,
+ * new ones wait for the next full checkpoint */
+static int
+persistent_bat(log_bid bid)
 {
-	int ok = LOG_OK;
-	sql_delta *cbat = c->data;
-	BAT *cur;
-	lng val;
+	BAT *b;
+	int persists;
 
-	(void)tr;
-	/* already set */
-	if (!cbat || c->type.type->localtype >= TYPE_str || c->t->system)
-		return ok;
+	if (!bid || (b = temp_descriptor(bid)) == NULL)
+		return 0;
+	persists = b->batPersistence == PERSISTENT;
+	bat_destroy(b);
+	return persists;
+}
 
-	cur = temp_descriptor(cbat->bid);
-	if (BATgetprop(cur, GDK_MIN_VALUE)) {
-		bat_destroy(cur);
-		return ok;
-	}
+/* memory size of a bat, which is what writing it out may cost */
+static size_t
+checkpoint_size(log_bid bid)
+{
+	BAT *b;
+	size_t sz;
 
-	BATmin(cur, &val);
-	BATsetprop(cur, GDK_MIN_VALUE, cur->ttype, &val);
-	BATmax(cur, &val);
-	BATsetprop(cur, GDK_MAX_VALUE, cur->ttype, &val);
-	bat_destroy(cur);
+	if (!bid || (b = temp_descriptor(bid)) == NULL)
+		return 0;
+	sz = BATmemsize(b, 0);
+	bat_destroy(b);
+	return sz;
+}
+
+static int
+log_use_bat(log_bid bid, char *name)
+{
+	BAT *b = temp_descriptor(bid);
+	int ok;
+
+	if (!b)
+		return LOG_ERR;
+	ok = log_bat_persists(bat_logger, b, name);
+	bat_destroy(b);
 	return ok;
 }
 
+/* Write out the persistent bats of table t which changed since its
+ * last checkpoint. Most changes are applied to these bats when the
+ * transaction commits, left over deltas are merged first (as gtr_update
+ * does). The bats are logged as used, which makes log_tend write them
+ * out and lets a replay skip their older log records. Tables whose
+ * changed bats (with their pending inserts) take more than *budget
+ * bytes are left alone, otherwise their size is taken from *budget.
+ * Returns the number of bats written or LOG_ERR. */
 static int
-gtr_minmax_table(sql_trans *tr, sql_table *t, int *changes)
+gtr_checkpoint_table(sql_trans *tr, sql_table *t, size_t *budget)
 {
-	int ok = LOG_OK;
+	sql_dbat *d = t->data;
+	log_bid dbid;
+	int changes = 0, bats = 1;
+	size_t bytes;
 	node *n;
 
-	(void)changes;
-	if (t->access > TABLE_WRITABLE) {
-		for (n = t->columns.set->h; ok == LOG_OK && n; n = n->next) {
-			sql_column *c = n->data;
-	
-			ok = gtr_minmax_col(tr, c);
+	if (!d || !persistent_bat(dbid = logger_find_bat(bat_logger, d->dname)))
+		return 0;
+	bytes = checkpoint_size(dbid);
+	for (n = t->columns.set->h; n; n = n->next) {
+		sql_column *c = n->data;
+		sql_delta *cbat = c->data;
+
+		if (c->base.wtime <= c->base.allocated)
+			continue;
+		if (!persistent_bat(logger_find_bat(bat_logger, cbat->name)))
+			return 0;
+		bytes += checkpoint_size(cbat->bid) + checkpoint_size(cbat->ibid);
+	}
+	if (t->idxs.set) {
+		for (n = t->idxs.set->h; n; n = n->next) {
+			sql_idx *ci = n->data;
+			sql_delta *ibat = ci->data;
+
+			if (!ibat || ci->base.wtime <= ci->base.allocated)
+				continue;
+			if (!persistent_bat(logger_find_bat(bat_logger, ibat->name)))
+				return 0;
+			bytes += checkpoint_size(ibat->bid) + checkpoint_size(ibat->ibid);
 		}
 	}
-	return ok;
+	if (bytes > *budget)
+		return 0;
+	*budget -= bytes;
+
+	if (gtr_update_table(tr, t, &changes) != LOG_OK)
+		return LOG_ERR;
+
+	if (log_use_bat(dbid, d->dname) != LOG_OK)
+		return LOG_ERR;
+	for (n = t->columns.set->h; n; n = n->next) {
+		sql_column *c = n->data;
+		sql_delta *cbat = c->data;
+
+		if (!c->base.wtime || (c->base.wtime <= c->base.allocated &&
+		    c->base.allocated != tr->wstime))
+			continue;
+		if (log_use_bat(cbat->bid, cbat->name) != LOG_OK)
+			return LOG_ERR;
+		c->base.allocated = c->base.wtime = tr->wstime;
+		bats++;
+	}
+	if (t->idxs.set) {
+		for (n = t->idxs.set->h; n; n = n->next) {
+			sql_idx *ci = n->data;
+			sql_delta *ibat = ci->data;
+
+			if (!ibat || !ci->base.wtime ||
+			    (ci->base.wtime <= ci->base.allocated &&
+			     ci->base.allocated != tr->wstime))
+				continue;
+			if (log_use_bat(ibat->bid, ibat->name) != LOG_OK)
+				return LOG_ERR;
+			ci->base.allocated = ci->base.wtime = tr->wstime;
+			bats++;
+		}
+	}
+	t->base.allocated = t->base.wtime = tr->wstime;
+	return bats;
+}
+
+/* incremental checkpoint, merge and write out tables with pending
+ * changes, at most maxbytes worth of bats */
+static int
+gtr_checkpoint( sql_trans *tr, size_t maxbytes )
+{
+	int bats = 0;
+	size_t budget = maxbytes;
+	node *sn;
+
+	for (sn = tr->schemas.set->h; sn && budget > 0; sn = sn->next) {
+		sql_schema *s = sn->data;
+		node *n;
+
+		if (!s->base.wtime || s->base.wtime <= s->base.allocated ||
+		    isTempSchema(s) || !s->tables.set)
+			continue;
+		for (n = s->tables.set->h; n && budget > 0; n = n->next) {
+			sql_table *t = n->data;
+			int nr;
+
+			if (!isTable(t) || !isGlobal(t) ||
+			    t->base.wtime <= t->base.allocated)
+				continue;
+			if ((nr = gtr_checkpoint_table(tr, t, &budget)) < 0)
+				return LOG_ERR;
+			bats += nr;
+		}
+	}
+	if (bats)
+		tr->wtime = tr->wstime;
+	return bats;
+}
+
+/* compute the bounds of a column bat which has none yet, returns the
+ * number of bytes scanned */
+static size_t
+gtr_minmax_col( sql_column *c, int *done)
+{
+	sql_delta *cbat = c->data;
+	BAT *cur;
+	ValRecord min, max;
+	size_t size = 0;
+
+	if (!cbat || !cbat->bid || c->type.type->localtype >= TYPE_str)
+		return 0;
+
+	cur = temp_descriptor(cbat->bid);
+	if (cur == NULL)
+		return 0;
+	/* already set */
+	if (!minmax_get(cur, &min, &max) && minmax_init(cur, &min, &max)) {
+		size = (size_t) BATcount(cur) << cur->T->shift;
+		if (minmax_widen(&min, &max, cur)) {
+			minmax_set(cur, &min, &max);
+			*done += BATgetprop(cur, GDK_MIN_VALUE) != NULL;
+		}
+	}
+	bat_destroy(cur);
+	return size;
 }
 
+/* the commits keep the bounds up to date, also for writable tables,
+ * here they are computed for the bats which have none yet, at most
+ * maxbytes worth of bats per call such that the store lock is not held
+ * for long, returns 1 if the budget ran out while bounds were found,
+ * ie more bats may be waiting.  Bats without bounds afterwards, eg
+ * those holding only nils, are scanned again on every call. */
 static int
-gtr_minmax( sql_trans *tr )
+gtr_minmax( sql_trans *tr, size_t maxbytes )
 {
-	return _gtr_update(tr, &gtr_minmax_table);
+	size_t budget = maxbytes;
+	node *sn;
+	int done = 0;
+
+	for (sn = tr->schemas.set->h; sn; sn = sn->next) {
+		sql_schema *s = sn->data;
+		node *n;
+
+		if (!s->base.wtime || isTempSchema(s) || !s->tables.set)
+			continue;
+		for (n = s->tables.set->h; n; n = n->next) {
+			sql_table *t = n->data;
+			node *m;
+
+			if (!isTable(t) || !isGlobal(t) || isTempTable(t) || t->system)
+				continue;
+			for (m = t->columns.set->h; m; m = m->next) {
+				size_t size = gtr_minmax_col(m->data, &done);
+
+				if (size >= budget)
+					return done > 0;
+				budget -= size;
+			}
+		}
+	}
+	return 0;
 }
 
 static int 
@@ -1873,7 +2308,8 @@ tr_update_delta( sql_trans *tr, sql_delta *obat, sql_delta *cbat, int unique)
 {
 	int ok = LOG_OK;
 	BAT *ins, *cur = NULL;
-	int cleared = 0;
+	int cleared = 0, mm = 0;
+	ValRecord min, max;
 
 	(void)tr;
 	assert(store_nr_active==1);
@@ -1906,6 +2342,8 @@ tr_update_delta( sql_trans *tr, sql_delta *obat, sql_delta *cbat, int unique)
 		cbat->cached = NULL;
 		return ok;
 	}
+	if (cur)
+		mm = minmax_get(cur, &min, &max);
 	ins = temp_descriptor(cbat->ibid);
 	/* any inserts */
 	if (BUNlast(ins) > BUNfirst(ins) || cleared) {
@@ -1923,6 +2361,8 @@ tr_update_delta( sql_trans *tr, sql_delta *obat, sql_delta *cbat, int unique)
 			BATmsync(ins);
 			ins = cur;
 			cur = newcur;
+			if ((mm = minmax_init(cur, &min, &max)) != 0)
+				mm = minmax_widen(&min, &max, cur);
 		} else {
 			assert(cur->T->heap.storage != STORE_PRIV);
 			assert((BATcount(cur) + BATcount(ins)) == cbat->cnt);
@@ -1930,6 +2370,8 @@ tr_update_delta( sql_trans *tr, sql_delta *obat, sql_delta *cbat, int unique)
 			assert(!BATcount(ins) || !isEbat(ins));
 			BATappend(cur,ins,TRUE);
 			BATcleanProps(cur);
+			if (mm)
+				mm = minmax_widen(&min, &max, ins);
 			temp_destroy(cbat->bid);
 			temp_destroy(cbat->ibid);
 			cbat->bid = cbat->ibid = 0;
@@ -1953,6 +2395,8 @@ tr_update_delta( sql_trans *tr, sql_delta *obat, sql_delta *cbat, int unique)
 		/* any updates */
 		if (BUNlast(ui) > BUNfirst(ui)) {
 			void_replace_bat(cur, ui, uv, TRUE);
+			if (mm)
+				mm = minmax_widen(&min, &max, uv);
 			/* cleanup the old deltas */
 			temp_destroy(obat->uibid);
 			temp_destroy(obat->uvbid);
@@ -1962,10 +2406,15 @@ tr_update_delta( sql_trans *tr, sql_delta *obat, sql_delta *cbat, int unique)
 			temp_destroy(cbat->uvbid);
 			cbat->uibid = cbat->uvbid = 0;
 			cbat->ucnt = obat->ucnt = 0;
+			cbat->ucompact = obat->ucompact = 0;
 		}
 		bat_destroy(ui);
 		bat_destroy(uv);
 	}
+	if (mm)
+		minmax_set(cur, &min, &max);
+	else if (cur)
+		BATcleanProps(cur);
 	bat_destroy(cur);
 	if (obat->next) { 
 		ok = destroy_bat(tr, obat->next);
@@ -1979,7 +2428,8 @@ tr_merge_delta( sql_trans *tr, sql_delta *obat, int unique)
 {
 	int ok = LOG_OK;
 	BAT *ins, *cur = NULL;
-	int cleared = 0;
+	int cleared = 0, mm = 0;
+	ValRecord min, max;
 
 	(void)tr;
 	assert(store_nr_active==1);
@@ -1991,6 +2441,8 @@ tr_merge_delta( sql_trans *tr, sql_delta *obat, int unique)
 	}
 	if (obat->bid)
 		cur = temp_descriptor(obat->bid);
+	if (cur)
+		mm = minmax_get(cur, &min, &max);
 	ins = temp_descriptor(obat->ibid);
 	/* any inserts */
 	if (BUNlast(ins) > BUNfirst(ins) || cleared) {
@@ -2007,9 +2459,13 @@ tr_merge_delta( sql_trans *tr, sql_delta *obat, int unique)
 			BATmsync(ins);
 			ins = cur;
 			cur = newcur;
+			if ((mm = minmax_init(cur, &min, &max)) != 0)
+				mm = minmax_widen(&min, &max, cur);
 		} else {
 			BATappend(cur,ins,TRUE);
 			BATcleanProps(cur);
+			if (mm)
+				mm = minmax_widen(&min, &max, ins);
 			if (cur->batPersistence == PERSISTENT)
 				BATmsync(cur);
 		}
@@ -2026,16 +2482,22 @@ tr_merge_delta( sql_trans *tr, sql_delta *obat, int unique)
 		/* any updates */
 		if (BUNlast(ui) > BUNfirst(ui)) {
 			void_replace_bat(cur, ui, uv, TRUE);
+			if (mm)
+				mm = minmax_widen(&min, &max, uv);
 			/* cleanup the old deltas */
 			temp_destroy(obat->uibid);
 			temp_destroy(obat->uvbid);
 			obat->uibid = e_bat(TYPE_oid);
 			obat->uvbid = e_bat(cur->ttype);
-			obat->ucnt = 0;
+			obat->ucnt = obat->ucompact = 0;
 		}
 		bat_destroy(ui);
 		bat_destroy(uv);
 	}
+	if (mm)
+		minmax_set(cur, &min, &max);
+	else if (cur)
+		BATcleanProps(cur);
 	bat_destroy(cur);
 	if (obat->next) { 
 		ok = destroy_bat(tr, obat->next);
@@ -2133,7 +2595,7 @@ tr_merge_dbat(sql_trans *tr, sql_dbat *tdb)
 static int
 update_table(sql_trans *tr, sql_table *ft, sql_table *tt)
 {
-	sql_trans *oldest = oldest_active_transaction();
+	sql_trans *oldest = oldest_active_transaction(tr);
 	int ok = LOG_OK;
 	node *n, *m;
 
@@ -2483,6 +2945,7 @@ bat_storage_init( store_functions *sf)
 	sf->dcount_col = (dcount_col_fptr)&dcount_col;
 	sf->sorted_col = (prop_col_fptr)&sorted_col;
 	sf->double_elim_col = (prop_col_fptr)&double_elim_col;
+	sf->minmax_col = (minmax_col_fptr)&minmax_col;
 
 	sf->create_col = (create_col_fptr)&create_col;
 	sf->create_idx = (create_idx_fptr)&create_idx;
@@ -2516,7 +2979,8 @@ bat_storage_init( store_functions *sf)
 	sf->log_table = (update_table_fptr)&log_table;
 	sf->snapshot_table = (update_table_fptr)&snapshot_table;
 	sf->gtrans_update = (gtrans_update_fptr)&gtr_update;
-	sf->gtrans_minmax = (gtrans_update_fptr)&gtr_minmax;
+	sf->gtrans_minmax = (gtrans_minmax_fptr)&gtr_minmax;
+	sf->gtrans_checkpoint = (gtrans_checkpoint_fptr)&gtr_checkpoint;
 	return LOG_OK;
 }
 
@@ -36,7 +36,7 @@ _delta_cands(sql_trans *tr, sql_table *t)
 		BAT *d, *diff = NULL;
 
 		if ((d = store_funcs.bind_del(tr, t, RD_INS)) != NULL) {
-			diff = BATdiff(tids, d, NULL, NULL, 0, BUN_NONE);
+			diff = BATrangediff(0, (BUN) nr, d);
 			bat_destroy(d);
 		}
 		bat_destroy(tids);
@@ -35,7 +35,7 @@ typedef enum store_type {
 
 extern sql_trans *gtrans;
 extern list *active_sessions;
-extern int store_nr_active;
+extern volatile ATOMIC_TYPE store_nr_active;
 extern store_type active_store_type;
 extern int store_readonly;
 extern int store_singleuser;
@@ -134,6 +134,7 @@ typedef size_t (*count_col_fptr) (sql_trans *tr, sql_column *c, int all /* all o
 typedef size_t (*count_idx_fptr) (sql_trans *tr, sql_idx *i, int all /* all or new only */);
 typedef size_t (*dcount_col_fptr) (sql_trans *tr, sql_column *c);
 typedef int (*prop_col_fptr) (sql_trans *tr, sql_column *c);
+typedef int (*minmax_col_fptr) (sql_trans *tr, sql_column *c, char **min, char **max);
 
 /*
 -- create the necessary storage resources for columns, indices and tables
@@ -179,6 +180,20 @@ typedef int (*update_table_fptr) (sql_trans *tr, sql_table *ft, sql_table *tt);
 */
 typedef int (*gtrans_update_fptr) (sql_trans *tr); 
 
+/*
+-- gtrans_checkpoint push the ibats and ubats of some tables and write
+-- those out, at most maxbytes worth of bats
+-- returns the number of bats written or LOG_ERR
+*/
+typedef int (*gtrans_checkpoint_fptr) (sql_trans *tr, size_t maxbytes); 
+
+/*
+-- gtrans_minmax compute the missing min and max properties of the
+-- column bats, at most maxbytes worth of bats
+-- returns 1 if more bats remain, else 0
+*/
+typedef int (*gtrans_minmax_fptr) (sql_trans *tr, size_t maxbytes); 
+
 /*
 -- handle inserts and updates of columns and indices
 -- returns LOG_OK, LOG_ERR
@@ -212,6 +227,7 @@ typedef struct store_functions {
 	dcount_col_fptr dcount_col;
 	prop_col_fptr sorted_col;
 	prop_col_fptr double_elim_col; /* varsize col with double elimination */
+	minmax_col_fptr minmax_col; /* bounds of the column values, maintained on commit */
 
 	create_col_fptr create_col;
 	create_idx_fptr create_idx;
@@ -252,7 +268,8 @@ typedef struct store_functions {
 	update_table_fptr log_table;
 	update_table_fptr update_table;
 	gtrans_update_fptr gtrans_update;
-	gtrans_update_fptr gtrans_minmax;
+	gtrans_minmax_fptr gtrans_minmax;
+	gtrans_checkpoint_fptr gtrans_checkpoint;
 
 	col_ins_fptr col_ins;
 	col_upd_fptr col_upd;
@@ -282,6 +299,9 @@ typedef int (*logger_reload_fptr) (void);
 typedef int (*log_isnew_fptr)(void);
 typedef int (*log_tstart_fptr) (void);
 typedef int (*log_tend_fptr) (void);
+typedef void (*log_commit_delay_fptr) (int ms);
+typedef lng (*log_commits_fptr) (void);
+typedef int (*log_sync_fptr) (lng nr);
 typedef int (*log_sequence_fptr) (int seq, lng id);
 typedef int (*log_isdestroyed_fptr)(void);
 
@@ -303,6 +323,9 @@ typedef struct logger_functions {
 	log_isnew_fptr log_isnew;
 	log_tstart_fptr log_tstart;
 	log_tend_fptr log_tend;
+	log_commit_delay_fptr log_commit_delay;
+	log_commits_fptr log_commits;
+	log_sync_fptr log_sync;
 	log_sequence_fptr log_sequence;
 	log_isdestroyed_fptr log_isdestroyed;
 
@@ -331,6 +354,8 @@ extern void minmax_manager(void);
 
 extern void store_lock(void);
 extern void store_unlock(void);
+extern lng store_commit_nr(void);
+extern int store_sync(lng nr);
 extern int store_next_oid(void);
 
 extern sql_trans *sql_trans_create(backend_stack stk, sql_trans *parent, const char *name);
@@ -394,6 +419,7 @@ extern sql_session * sql_session_create(backend_stack stk, int autocommit);
 extern void sql_session_destroy(sql_session *s);
 extern void sql_session_reset(sql_session *s, int autocommit);
 extern int sql_trans_begin(sql_session *s);
+extern int sql_trans_begin_snapshot(sql_session *s);
 extern void sql_trans_end(sql_session *s);
 
 extern list* sql_trans_schema_user_dependencies(sql_trans *tr, int schema_id);
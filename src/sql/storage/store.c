@@ -23,13 +23,23 @@
 int catalog_version = 0;
 
 static MT_Lock bs_lock MT_LOCK_INITIALIZER("bs_lock");
+#ifdef ATOMIC_LOCK
+static MT_Lock store_atomic_lock MT_LOCK_INITIALIZER("store_atomic_lock");
+#endif
+/* raised when the store lock is taken and again when it is released,
+ * so it is odd while the lock is held, see sql_trans_begin_snapshot */
+static volatile ATOMIC_TYPE store_busy = 0;
+static volatile ATOMIC_TYPE store_entering = 0;
+/* snapshot transactions which ended while the lock was held, they are
+ * only removed from store_nr_active when the lock is taken next */
+static volatile ATOMIC_TYPE store_leaving = 0;
 static int store_oid = 0;
 static int prev_oid = 0;
 static int nr_sessions = 0;
 static int transactions = 0;
 sql_trans *gtrans = NULL;
 list *active_sessions = NULL;
-int store_nr_active = 0;
+volatile ATOMIC_TYPE store_nr_active = 0;
 store_type active_store_type = store_bat;
 int store_readonly = 0;
 int store_singleuser = 0;
@@ -63,10 +73,10 @@ key_cmp(sql_key *k, sqlid *id)
 	return 1;
 }
 
-static int stamp = 1;
+static volatile ATOMIC_TYPE stamp = 1;
 
 static int timestamp (void) {
-	return stamp++;
+	return (int) ATOMIC_INC(stamp, store_atomic_lock) - 1;
 }
 
 void
@@ -547,6 +557,7 @@ load_column(sql_trans *tr, sql_table *t, oid rid)
 		store_funcs.create_col(tr, c);
 	c->sorted = sql_trans_is_sorted(tr, c);
 	c->dcount = 0;
+	c->dcount_cnt = 0;
 	if (bs_debug)
 		fprintf(stderr, "#\t\tload column %s\n", c->base.name);
 	return c;
@@ -1011,9 +1022,9 @@ static sqlid
 next_oid(void)
 {
 	int id = 0;
-	MT_lock_set(&bs_lock);
+	store_lock();
 	id = store_oid++;
-	MT_lock_unset(&bs_lock);
+	store_unlock();
 	return id;
 }
 
@@ -1242,6 +1253,7 @@ dup_sql_column(sql_allocator *sa, sql_table *t, sql_column *c)
 		col->storage_type = sa_strdup(sa, c->storage_type);
 	col->sorted = c->sorted;
 	col->dcount = c->dcount;
+	col->dcount_cnt = c->dcount_cnt;
 	cs_add(&t->columns, col, TR_NEW);
 	return col;
 }
@@ -1558,7 +1570,7 @@ int
 store_init(int debug, store_type store, int readonly, int singleuser, logger_settings *log_settings, backend_stack stk)
 {
 
-	int v = 1;
+	int v = 1, first;
 
 	backend_stk = stk;
 	logger_debug = debug;
@@ -1575,7 +1587,8 @@ store_init(int debug, store_type store, int readonly, int singleuser, logger_set
 #ifdef NEED_MT_LOCK_INIT
 	MT_lock_init(&bs_lock, "SQL_bs_lock");
 #endif
-	MT_lock_set(&bs_lock);
+	ATOMIC_INIT(store_atomic_lock);
+	store_lock();
 
 	/* check if all parameters for a shared log are set */
 	if (store_readonly && log_settings->shared_logdir != NULL && log_settings->shared_drift_threshold >= 0) {
@@ -1595,7 +1608,7 @@ store_init(int debug, store_type store, int readonly, int singleuser, logger_set
 	active_store_type = store;
 	if (!logger_funcs.create ||
 	    logger_funcs.create(debug, log_settings->logdir, CATALOG_VERSION*v, keep_persisted_log_files) == LOG_ERR) {
-		MT_lock_unset(&bs_lock);
+		store_unlock();
 		return -1;
 	}
 
@@ -1605,14 +1618,18 @@ store_init(int debug, store_type store, int readonly, int singleuser, logger_set
 	fprintf(stderr, "#store_init creating shared logger\n");
 #endif
 		if (!shared_logger_funcs.create_shared || shared_logger_funcs.create_shared(debug, log_settings->shared_logdir, CATALOG_VERSION*v, log_settings->logdir) == LOG_ERR) {
-			MT_lock_unset(&bs_lock);
+			store_unlock();
 			return -1;
 		}
 	}
 
 	/* create the initial store structure or re-load previous data */
-	MT_lock_unset(&bs_lock);
-	return store_load();
+	store_unlock();
+	first = store_load();
+	/* bootstrap commits are synced, group commit starts afterwards */
+	if (first >= 0 && logger_funcs.log_commit_delay)
+		logger_funcs.log_commit_delay(log_settings->commit_delay);
+	return first;
 }
 
 static int logging = 0;
@@ -1620,7 +1637,7 @@ static int logging = 0;
 void
 store_exit(void)
 {
-	MT_lock_set(&bs_lock);
+	store_lock();
 
 #ifdef STORE_DEBUG
 	fprintf(stderr, "#store exit locked\n");
@@ -1628,15 +1645,15 @@ store_exit(void)
 
 	/* busy wait till the logmanager is ready */
 	while (logging) {
-		MT_lock_unset(&bs_lock);
+		store_unlock();
 		MT_sleep_ms(100);
-		MT_lock_set(&bs_lock);
+		store_lock();
 	}
 
 	if (gtrans) {
-		MT_lock_unset(&bs_lock);
+		store_unlock();
 		sequences_exit();
-		MT_lock_set(&bs_lock);
+		store_lock();
 	}
 	if (spares > 0)
 		destroy_spare_transactions();
@@ -1662,7 +1679,7 @@ store_exit(void)
 #ifdef STORE_DEBUG
 	fprintf(stderr, "#store exit unlocked\n");
 #endif
-	MT_lock_unset(&bs_lock);
+	store_unlock();
 }
 
 /* call locked ! */
@@ -1690,6 +1707,56 @@ store_flush_log(void)
 	need_flush = 1;
 }
 
+/* Incremental checkpointing. Between the full checkpoints (log
+ * restarts) the store manager writes out the changed persistent bats
+ * of a few tables at a time, as a logged transaction of its own, which
+ * leaves little work for the next full checkpoint. A step holds the
+ * store lock while it writes, so it only starts when no transaction is
+ * active and writes at most CHECKPOINT_BYTES worth of bats, which
+ * bounds how long new transactions wait for it. Tables larger than
+ * that are left to the full checkpoint. */
+#define CHECKPOINT_BYTES	((size_t) 64 << 20)
+#define CHECKPOINT_CHANGES	100000
+#define CHECKPOINT_INTERVAL	1000	/* ms */
+
+static int checkpoint_changes = 0;	/* logged changes at the last step */
+
+static void
+store_checkpoint(void)
+{
+	int changes, bats = 0;
+
+	if (store_readonly || create_shared_logger || !store_funcs.gtrans_checkpoint)
+		return;
+	store_lock();
+	if (GDKexiting() || logger_funcs.log_isdestroyed() || store_nr_active) {
+		store_unlock();
+		return;
+	}
+	changes = logger_funcs.changes();
+	if (changes < checkpoint_changes)	/* the log was restarted */
+		checkpoint_changes = 0;
+	if (changes - checkpoint_changes < CHECKPOINT_CHANGES) {
+		store_unlock();
+		return;
+	}
+	/* make sure we reset all transactions on re-activation */
+	gtrans->wstime = timestamp();
+	if (logger_funcs.log_tstart() != LOG_OK ||
+	    (bats = store_funcs.gtrans_checkpoint(gtrans, CHECKPOINT_BYTES)) < 0 ||
+	    logger_funcs.log_tend() != LOG_OK ||
+	    store_sync(store_commit_nr()) != LOG_OK) {
+		store_unlock();
+		GDKfatal("write-ahead logging failure, disk full?");
+	}
+	if (bs_debug)
+		fprintf(stderr, "#store_checkpoint wrote %d bats\n", bats);
+	/* nothing left to merge, wait for new changes */
+	if (bats == 0)
+		checkpoint_changes = changes;
+	store_unlock();
+}
+
 void
 store_manager(void)
 {
@@ -1704,6 +1771,8 @@ store_manager(void)
 			MT_sleep_ms(timeout);
 			if (GDKexiting())
 				return;
+			if (t % CHECKPOINT_INTERVAL < timeout)
+				store_checkpoint();
 		}
 		/* check if we have a shared logger as well */
 		if (create_shared_logger) {
@@ -1717,30 +1786,30 @@ store_manager(void)
 			}
 		}
 
-		MT_lock_set(&bs_lock);
+		store_lock();
 		if (GDKexiting() || logger_funcs.log_isdestroyed()) {
-			MT_lock_unset(&bs_lock);
+			store_unlock();
 			return;
 		}
 		if ((!need_flush && logger_funcs.changes() < 1000000 && shared_transactions_drift < shared_drift_threshold)) {
-			MT_lock_unset(&bs_lock);
+			store_unlock();
 			continue;
 		}
 		need_flush = 0;
 		while (store_nr_active) { /* find a moment to flush */
-			MT_lock_unset(&bs_lock);
+			store_unlock();
 			if (GDKexiting()) {
 				return;
 			}
 			MT_sleep_ms(timeout);
-			MT_lock_set(&bs_lock);
+			store_lock();
 		}
 
 		if (create_shared_logger) {
 			/* (re)load data from shared write-ahead log */
 			res = shared_logger_funcs.reload();
 			if (res != LOG_OK) {
-				MT_lock_unset(&bs_lock);
+				store_unlock();
 				GDKfatal("shared write-ahead log loading failure");
 			}
 			/* destroy all global transactions
@@ -1751,12 +1820,12 @@ store_manager(void)
 			/* re-set the store_oid */
 			store_oid = 0;
 			/* reload the store and the global transactions */
-			MT_lock_unset(&bs_lock);
+			store_unlock();
 			res = store_load();
 			if (res < 0) {
 				GDKfatal("shared write-ahead log store re-load failure");
 			}
-			MT_lock_set(&bs_lock);
+			store_lock();
 		}
 
 		logging = 1;
@@ -1767,14 +1836,14 @@ store_manager(void)
 		}
 		res = logger_funcs.restart();
 
-		MT_lock_unset(&bs_lock);
+		store_unlock();
 		if (logging && res == LOG_OK) {
 			res = logger_funcs.cleanup(keep_persisted_log_files);
 		}
 
-		MT_lock_set(&bs_lock);
+		store_lock();
 		logging = 0;
-		MT_lock_unset(&bs_lock);
+		store_unlock();
 
 		if (res != LOG_OK) {
 			GDKfatal("write-ahead logging failure, disk full?");
@@ -1782,25 +1851,32 @@ store_manager(void)
 	}
 }
 
+#define MINMAX_BYTES	((size_t) 64 << 20)
+
+/* after a restart the bounds of all persistent columns are missing,
+ * they are computed a limited amount at a time so the store lock is
+ * released regularly, and again shortly after while some remain */
 void
 minmax_manager(void)
 {
+	int more = 0;
+
 	while (!GDKexiting()) {
 		int t;
 
-		for (t = 30000; t > 0; t -= 50) {
+		for (t = more ? CHECKPOINT_INTERVAL : 30000; t > 0; t -= 50) {
 			MT_sleep_ms(50);
 			if (GDKexiting())
 				return;
 		}
-		MT_lock_set(&bs_lock);
+		store_lock();
 		if (store_nr_active || GDKexiting()) {
-			MT_lock_unset(&bs_lock);
+			store_unlock();
 			continue;
 		}
 		if (store_funcs.gtrans_minmax)
-			store_funcs.gtrans_minmax(gtrans);
-		MT_lock_unset(&bs_lock);
+			more = store_funcs.gtrans_minmax(gtrans, MINMAX_BYTES);
+		store_unlock();
 	}
 }
 
@@ -1808,7 +1884,19 @@ minmax_manager(void)
 void
 store_lock(void)
 {
+	ATOMIC_TYPE left;
+
 	MT_lock_set(&bs_lock);
+	(void) ATOMIC_INC(store_busy, store_atomic_lock);
+	/* let snapshot transactions which are just starting or ending
+	 * finish (un)registering themselves */
+	while (ATOMIC_GET(store_entering, store_atomic_lock))
+		MT_sleep_ms(0);
+	/* from here on store_nr_active stays put until store_unlock */
+	if ((left = ATOMIC_GET(store_leaving, store_atomic_lock)) != 0) {
+		(void) ATOMIC_SUB(store_leaving, left, store_atomic_lock);
+		(void) ATOMIC_SUB(store_nr_active, left, store_atomic_lock);
+	}
 #ifdef STORE_DEBUG
 	fprintf(stderr, "#locked\n");
 #endif
@@ -1820,9 +1908,30 @@ store_unlock(void)
 #ifdef STORE_DEBUG
 	fprintf(stderr, "#unlocked\n");
 #endif
+	(void) ATOMIC_INC(store_busy, store_atomic_lock);
 	MT_lock_unset(&bs_lock);
 }
 
+/* With group commit (gdk_commit_delay >= 0) a commit is only on disk
+ * after store_sync. Get the commit number while holding the store lock
+ * and sync after releasing it, such that concurrent committers share a
+ * single fsync of the log. */
+lng
+store_commit_nr(void)
+{
+	if (!logger_funcs.log_commits)
+		return 0;
+	return logger_funcs.log_commits();
+}
+
+int
+store_sync(lng nr)
+{
+	if (!logger_funcs.log_sync || logger_funcs.log_isdestroyed())
+		return LOG_OK;
+	return logger_funcs.log_sync(nr);
+}
+
 static sql_kc *
 kc_dup_(sql_trans *tr, int flag, sql_kc *kc, sql_table *t, int copy)
 {
@@ -4688,16 +4797,25 @@ sql_trans_is_sorted( sql_trans *tr, sql_column *col )
 	return 0;
 }
 
+/* The distinct count of a column is kept with the row count it was
+ * determined at, and determined again once the table has grown or
+ * shrunk by more than an eighth since. */
 size_t
 sql_trans_dist_count( sql_trans *tr, sql_column *col )
 {
-	if (col->dcount)
-		return col->dcount;
-
 	if (col && isTable(col->t)) {
+		size_t cnt = store_funcs.count_col(tr, col, 1);
+		sql_schema *sys;
+		sql_table *stats;
+
+		if (col->dcount &&
+		    (cnt > col->dcount_cnt ? cnt - col->dcount_cnt : col->dcount_cnt - cnt) <= col->dcount_cnt / 8)
+			return col->dcount;
+		col->dcount = 0;
+		col->dcount_cnt = cnt;
 		/* get from statistics */
-		sql_schema *sys = find_sql_schema(tr, "sys");
-		sql_table *stats = find_sql_table(sys, "statistics");
+		sys = find_sql_schema(tr, "sys");
+		stats = find_sql_table(sys, "statistics");
 		if (stats) {
 			sql_column *stats_column_id = find_sql_column(stats, "column_id");
 			oid rid = table_funcs.column_find_row(tr, stats_column_id, &col->base.id, NULL);
@@ -4713,7 +4831,7 @@ sql_trans_dist_count( sql_trans *tr, sql_column *col )
 		}
 		return col->dcount;
 	}
-	return 0;
+	return col ? col->dcount : 0;
 }
 
 int
@@ -4723,7 +4841,16 @@ sql_trans_ranges( sql_trans *tr, sql_column *col, void **min, void **max )
 		/* get from statistics */
 		sql_schema *sys = find_sql_schema(tr, "sys");
 		sql_table *stats = find_sql_table(sys, "statistics");
-
+		char *smin, *smax;
+
+		/* the bounds maintained by the storage are always current */
+		if (store_funcs.minmax_col && store_funcs.minmax_col(tr, col, &smin, &smax)) {
+			*min = sa_strdup(tr->sa, smin);
+			*max = sa_strdup(tr->sa, smax);
+			_DELETE(smin);
+			_DELETE(smax);
+			return 1;
+		}
 		if (col->min && col->max) {
 			*min = col->min;
 			*max = col->max;
@@ -5417,9 +5544,10 @@ sql_trans_begin(sql_session *s)
 		reset_trans(tr, gtrans);
 	tr = trans_init(tr, tr->stk, tr->parent);
 	s->active = 1;
+	s->snapshot = 0;
 	s->schema = find_sql_schema(tr, s->schema_name);
 	s->tr = tr;
-	store_nr_active ++;
+	(void) ATOMIC_INC(store_nr_active, store_atomic_lock);
 	list_append(active_sessions, s); 
 	s->status = 0;
 #ifdef STORE_DEBUG
@@ -5428,6 +5556,62 @@ sql_trans_begin(sql_session *s)
 	return snr != tr->schema_number;
 }
 
+/* Start a transaction without taking the store lock.
+ *
+ * Most transactions are short reads on a private catalog copy that is
+ * still current, ie no commit happened since it was last reset.  Then
+ * sql_trans_begin only re-initialises the copy, which does not need
+ * the store lock.  Only when the lock is free, the session registers
+ * itself in store_nr_active.  Every holder of the store lock raises
+ * store_busy and then waits for sessions which are just registering
+ * (store_entering), so lock holders never see store_nr_active grow.
+ * The state of gtrans is read once and only used when store_busy did
+ * not change meanwhile, ie no commit ran while it was read.  Otherwise
+ * the session falls back to sql_trans_begin and 0 is returned.
+ *
+ * Snapshot transactions without changes also end without the lock
+ * (see mvc_commit).  When the lock is held at that moment, they are
+ * counted in store_leaving instead, such that the commit phases of the
+ * lock holder all see the same store_nr_active. */
+int
+sql_trans_begin_snapshot(sql_session *s)
+{
+	sql_trans *tr = s->tr;
+	ATOMIC_TYPE busy;
+	int wtime, wstime, snr;
+
+	(void) ATOMIC_INC(store_entering, store_atomic_lock);
+	busy = ATOMIC_GET(store_busy, store_atomic_lock);
+	if ((busy & 1) == 0)
+		(void) ATOMIC_INC(store_nr_active, store_atomic_lock);
+	(void) ATOMIC_DEC(store_entering, store_atomic_lock);
+	if (busy & 1)
+		return 0;
+	wtime = gtrans->wtime;
+	wstime = gtrans->wstime;
+	snr = store_schema_number();
+	if (ATOMIC_GET(store_busy, store_atomic_lock) != busy ||
+	    tr->parent != gtrans || tr->stime < wstime ||
+	    tr->wtime || snr != tr->schema_number) {
+		(void) ATOMIC_DEC(store_nr_active, store_atomic_lock);
+		return 0;
+	}
+	tr = trans_init(tr, tr->stk, tr->parent);
+	/* a commit may have started since, keep what was checked */
+	tr->stime = wtime;
+	tr->schema_number = snr;
+	s->active = 1;
+	s->snapshot = 1;
+	s->schema = find_sql_schema(tr, s->schema_name);
+	s->status = 0;
+#ifdef STORE_DEBUG
+	fprintf(stderr,"#sql trans begin snapshot (%d)\n", tr->schema_number);
+#endif
+	return 1;
+}
+
+/* the store lock is only needed for transactions which did not start
+ * as snapshot */
 void
 sql_trans_end(sql_session *s)
 {
@@ -5436,7 +5620,18 @@ sql_trans_end(sql_session *s)
 #endif
 	s->active = 0;
 	s->auto_commit = s->ac_on_commit;
+	if (s->snapshot) {
+		s->snapshot = 0;
+		/* same handshake as sql_trans_begin_snapshot */
+		(void) ATOMIC_INC(store_entering, store_atomic_lock);
+		if (ATOMIC_GET(store_busy, store_atomic_lock) & 1)
+			(void) ATOMIC_INC(store_leaving, store_atomic_lock);
+		else
+			(void) ATOMIC_DEC(store_nr_active, store_atomic_lock);
+		(void) ATOMIC_DEC(store_entering, store_atomic_lock);
+		return;
+	}
 	list_remove_data(active_sessions, s);
-	store_nr_active --;
-	assert(list_length(active_sessions) == store_nr_active);
+	(void) ATOMIC_DEC(store_nr_active, store_atomic_lock);
+	assert(list_length(active_sessions) <= store_nr_active);
 }